@@ -16,6 +16,7 @@ AWS_PUSH_SANE_WARNING_LEVEL
 
 enum aws_compression_error {
     AWS_ERROR_COMPRESSION_UNKNOWN_SYMBOL = AWS_ERROR_ENUM_BEGIN_RANGE(AWS_C_COMPRESSION_PACKAGE_ID),
+    AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER,
 
     AWS_ERROR_END_COMPRESSION_RANGE = AWS_ERROR_ENUM_END_RANGE(AWS_C_COMPRESSION_PACKAGE_ID)
 };
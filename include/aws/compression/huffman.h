@@ -47,6 +47,167 @@ typedef struct aws_huffman_code(aws_huffman_symbol_encoder_fn)(uint8_t symbol, v
  */
 typedef uint8_t(aws_huffman_symbol_decoder_fn)(uint32_t bits, uint8_t *symbol, void *userdata);
 
+/**
+ * Kinds of entries found in a table-driven decoder's lookup table
+ */
+enum aws_huffman_decode_entry_type {
+    /** No code begins with the bits used to index this entry */
+    AWS_HUFFMAN_DECODE_ENTRY_INVALID,
+    /** A complete code, value holds the symbol */
+    AWS_HUFFMAN_DECODE_ENTRY_SYMBOL,
+    /** The code continues past this table, value holds the index of the sub-table to continue in */
+    AWS_HUFFMAN_DECODE_ENTRY_LINK,
+};
+
+/**
+ * One entry of a table-driven decoder, as emitted by the generator's table mode.
+ *
+ * The primary table is indexed by the most significant root bits of the input.
+ * Codes longer than that are resolved through link entries, each of which
+ * points to a sub-table indexed by the bits that follow.
+ */
+struct aws_huffman_decode_entry {
+    /** For symbol entries, the symbol. For link entries, the index of the first entry of the sub-table. */
+    uint16_t value;
+    /**
+     * For symbol entries, the length of the whole code.
+     * For link entries, the number of bits used to index the sub-table.
+     */
+    uint8_t num_bits;
+    /** One of aws_huffman_decode_entry_type */
+    uint8_t type;
+};
+
+/**
+ * Lookup tables for a table-driven decoder, as emitted by the generator's table mode.
+ */
+struct aws_huffman_decode_table {
+    /** The primary table of (1 << root_bits) entries, followed by all sub-tables */
+    const struct aws_huffman_decode_entry *entries;
+    uint8_t root_bits;
+};
+
+/**
+ * Compact decoder for canonical codes, as emitted by the generator's canonical mode.
+ *
+ * A code is canonical when sorting its codes numerically also sorts them by length, and codes of the same length
+ * are consecutive. The length of the code at the front of the input is then the shortest length whose limit the
+ * input does not exceed, and its symbol is found by its distance from the first code of that length.
+ *
+ * Arrays indexed by length hold (max_bits - min_bits + 1) entries, the first being for min_bits.
+ */
+struct aws_huffman_canonical_table {
+    /** By length: the largest 32 bit input that begins with a code of this length or shorter */
+    const uint32_t *limits;
+    /** By length: the first code of this length, shifted to the top of 32 bits */
+    const uint32_t *first_codes;
+    /** By length: the index in symbols of the first code of this length */
+    const uint16_t *offsets;
+    /**
+     * Indexed by the number of leading 1 bits in the input, capped at max_bits.
+     * The shortest length (less min_bits) that an input beginning that way may hold.
+     */
+    const uint8_t *start_lengths;
+    /** All symbols, in code order */
+    const uint8_t *symbols;
+    uint8_t min_bits;
+    uint8_t max_bits;
+};
+
+/**
+ * The most symbols a single aws_huffman_multi_symbol_entry may produce
+ */
+#define AWS_HUFFMAN_MULTI_SYMBOL_MAX 4
+
+/**
+ * One entry of a multi-symbol decode table, as emitted by the generator's --multi-symbol-bits option.
+ */
+struct aws_huffman_multi_symbol_entry {
+    /** The symbols whose codes fit entirely within the bits used to index this entry, in order */
+    uint8_t symbols[AWS_HUFFMAN_MULTI_SYMBOL_MAX];
+    /** The number of valid symbols. 0 if the first code is longer than the index */
+    uint8_t num_symbols;
+    /** The combined length of the codes of all symbols */
+    uint8_t num_bits;
+};
+
+/**
+ * Decode table indexed by the most significant index_bits of the input,
+ * where each entry retires up to AWS_HUFFMAN_MULTI_SYMBOL_MAX symbols at once.
+ */
+struct aws_huffman_multi_symbol_table {
+    /** Must contain (1 << index_bits) entries */
+    const struct aws_huffman_multi_symbol_entry *entries;
+    uint8_t index_bits;
+};
+
+/**
+ * Flags describing a transition of a finite-state-machine decoder
+ */
+enum aws_huffman_fsm_flags {
+    /** After this transition, the input may legally end: no bits are pending, or only EOS padding is */
+    AWS_HUFFMAN_FSM_ACCEPT = 0x1,
+    /** This transition completes a code, symbol holds the decoded symbol */
+    AWS_HUFFMAN_FSM_SYMBOL = 0x2,
+    /** No code begins with the bits consumed so far */
+    AWS_HUFFMAN_FSM_FAIL = 0x4,
+};
+
+/**
+ * One transition of a finite-state-machine decoder, as emitted by the generator's --fsm option.
+ */
+struct aws_huffman_fsm_transition {
+    uint16_t next_state;
+    /** Combination of aws_huffman_fsm_flags */
+    uint8_t flags;
+    uint8_t symbol;
+};
+
+/**
+ * Decoder that consumes input 4 bits at a time.
+ * Each state is a position in the code tree, state 0 being the root.
+ * Transitions are indexed by (state * 16 + nibble).
+ *
+ * Padding is considered valid if it is fewer than 8 bits, all 1s, as HPACK requires.
+ */
+struct aws_huffman_fsm_table {
+    const struct aws_huffman_fsm_transition *transitions;
+    uint16_t num_states;
+};
+
+/**
+ * The low bits of an aws_huffman_pair_table entry, which hold the combined length of the pair's codes
+ */
+#define AWS_HUFFMAN_PAIR_BITS_MASK 0x3f
+
+/**
+ * The longest combined length of a pair of codes that an aws_huffman_pair_table entry may hold
+ */
+#define AWS_HUFFMAN_PAIR_MAX_BITS 56
+
+/**
+ * Rank of a symbol that has no entries in a compact aws_huffman_pair_table
+ */
+#define AWS_HUFFMAN_PAIR_UNRANKED 0xff
+
+/**
+ * Encode table indexed by two symbols at once, as emitted by the generator's --pair-symbols option.
+ *
+ * Each entry holds the code of the first symbol followed by the code of the second, shifted to the top of 64 bits,
+ * with their combined length in the low bits (AWS_HUFFMAN_PAIR_BITS_MASK). An entry is 0 if either symbol has no
+ * code, or the codes are longer than AWS_HUFFMAN_PAIR_MAX_BITS combined.
+ *
+ * A full table covers every pair of the 256 symbols. A compact one covers only pairs of the num_ranked most
+ * frequent symbols, and is indexed by (ranks[first] * num_ranked + ranks[second]).
+ */
+struct aws_huffman_pair_table {
+    const uint64_t *entries;
+    /** NULL for a full table, indexed by (first << 8 | second). Otherwise the rank of each of the 256 symbols */
+    const uint8_t *ranks;
+    /** Number of symbols with a rank, fewer than AWS_HUFFMAN_PAIR_UNRANKED. Unused by a full table */
+    uint8_t num_ranked;
+};
+
 /**
  * Structure used to define how symbols are encoded and decoded
  */
@@ -54,6 +215,45 @@ struct aws_huffman_symbol_coder {
     aws_huffman_symbol_encoder_fn *encode;
     aws_huffman_symbol_decoder_fn *decode;
     void *userdata;
+
+    /**
+     * Optional. The codes for all 256 symbols, indexed by symbol.
+     * If set, encoding reads codes from here instead of calling encode.
+     */
+    const struct aws_huffman_code *encode_table;
+
+    /**
+     * Optional. The length in bits of the code for each of the 256 symbols, indexed by symbol.
+     * If set, aws_huffman_get_encoded_length() sums these, which are denser than encode_table.
+     */
+    const uint8_t *code_lengths;
+
+    /**
+     * Optional. If set, aws_huffman_encode() looks codes up here two symbols at a time,
+     * and falls back to encode_table or encode for pairs the table doesn't hold.
+     */
+    const struct aws_huffman_pair_table *pair_table;
+
+    /**
+     * Optional. If set, aws_huffman_decode() looks codes up here instead of calling decode.
+     */
+    const struct aws_huffman_decode_table *decode_table;
+
+    /**
+     * Optional. If set, and decode_table is not, aws_huffman_decode() looks codes up here instead of calling decode.
+     */
+    const struct aws_huffman_canonical_table *canonical_table;
+
+    /**
+     * Optional. If set, aws_huffman_decode() looks here first, and only falls back to decode_table,
+     * canonical_table or decode for codes that are longer than the index, or near the end of the input or output.
+     */
+    const struct aws_huffman_multi_symbol_table *multi_symbol_table;
+
+    /**
+     * Optional. If set, aws_huffman_decode() runs this state machine instead of using any of the above.
+     */
+    const struct aws_huffman_fsm_table *fsm_table;
 };
 
 /**
@@ -64,6 +264,10 @@ struct aws_huffman_encoder {
     /* Params */
     struct aws_huffman_symbol_coder *coder;
     uint8_t eos_padding;
+    bool allow_growth;
+    /* Length of the coder's longest code, which bounds how much output a given input can produce.
+     * Found by aws_huffman_encoder_allow_growth(), since only growth needs it */
+    uint8_t max_code_bits;
 
     /* State */
     struct aws_huffman_code overflow_bits;
@@ -77,10 +281,85 @@ struct aws_huffman_decoder {
     /* Param */
     struct aws_huffman_symbol_coder *coder;
     bool allow_growth;
+    /* Length of the coder's shortest code, which bounds how many symbols a given input can produce.
+     * 0 if the coder has neither code_lengths nor encode_table to find it from */
+    uint8_t min_code_bits;
 
     /* State */
     uint64_t working_bits;
     uint8_t num_bits;
+
+    /* State for coders with an fsm_table */
+    uint16_t fsm_state;
+    uint8_t fsm_flags;
+};
+
+/**
+ * The first 8 bytes of a serialized coder, including the terminating 0
+ */
+#define AWS_HUFFMAN_SERIALIZED_MAGIC "AWSHUFF"
+
+/**
+ * The version of the serialized coder format written by the generator's --serialize option, and read by
+ * aws_huffman_mapped_coder_init()
+ */
+#define AWS_HUFFMAN_SERIALIZED_VERSION 1
+
+/**
+ * The start of a serialized coder.
+ *
+ * Each table follows in the in-memory layout of its struct, so a coder can point straight into the file once it's
+ * mapped. Files are only readable on machines with the byte order and struct sizes they were written with.
+ * Offsets are from the start of the file, and are multiples of 8.
+ */
+struct aws_huffman_serialized_header {
+    /** AWS_HUFFMAN_SERIALIZED_MAGIC */
+    char magic[8];
+    /** AWS_HUFFMAN_SERIALIZED_VERSION */
+    uint32_t version;
+    /** 0x01020304, in the writer's byte order */
+    uint32_t byte_order;
+    /** The size of the whole file */
+    uint32_t file_size;
+    /** The writer's sizeof struct aws_huffman_code, aws_huffman_decode_entry, aws_huffman_multi_symbol_entry and
+     * aws_huffman_fsm_transition */
+    uint8_t code_size;
+    uint8_t decode_entry_size;
+    uint8_t multi_symbol_entry_size;
+    uint8_t fsm_transition_size;
+    /** 256 struct aws_huffman_code, indexed by symbol */
+    uint32_t encode_table_offset;
+    /** 256 code lengths, indexed by symbol */
+    uint32_t code_lengths_offset;
+    /** The decode table's entries, the primary table first, then each sub-table in the order its link is found
+     * by walking the tables depth first */
+    uint32_t decode_entries_offset;
+    uint32_t num_decode_entries;
+    /** (1 << multi_symbol_index_bits) multi-symbol entries, or 0 if there's no multi-symbol table */
+    uint32_t multi_symbol_offset;
+    /** (fsm_num_states * 16) state machine transitions, or 0 if there's no state machine */
+    uint32_t fsm_offset;
+    uint16_t fsm_num_states;
+    uint8_t root_bits;
+    uint8_t multi_symbol_index_bits;
+};
+
+/**
+ * A symbol coder whose tables live in a serialized coder, such as a file mapped by aws_huffman_mapped_coder_init().
+ * Processes that map the same file share one copy of its tables.
+ */
+struct aws_huffman_mapped_coder {
+    /** Pass this to aws_huffman_encoder_init() and aws_huffman_decoder_init(). It has no encode or decode callbacks,
+     * only tables. */
+    struct aws_huffman_symbol_coder coder;
+
+    struct aws_huffman_decode_table decode_table;
+    struct aws_huffman_multi_symbol_table multi_symbol_table;
+    struct aws_huffman_fsm_table fsm_table;
+
+    /* The mapping, or NULL if the tables belong to the caller */
+    void *mapping;
+    size_t mapping_size;
 };
 
 AWS_EXTERN_C_BEGIN
@@ -120,12 +399,36 @@ void aws_huffman_decoder_reset(struct aws_huffman_decoder *decoder);
 AWS_COMPRESSION_API
 size_t aws_huffman_get_encoded_length(struct aws_huffman_encoder *encoder, struct aws_byte_cursor to_encode);
 
+/**
+ * Returned by aws_huffman_get_encoded_length_limited() when the encoded length exceeds the limit
+ */
+#define AWS_HUFFMAN_ENCODED_LENGTH_EXCEEDED SIZE_MAX
+
+/**
+ * Get the byte length of to_encode post-encoding, if it's no more than limit.
+ * Stops reading to_encode soon after the length passes limit,
+ * so long strings that won't be worth encoding are not read all the way through.
+ *
+ * \param[in]       encoder         The encoder object to use
+ * \param[in]       to_encode       The symbol buffer to encode
+ * \param[in]       limit           The most bytes of interest
+ *
+ * \return The length of the encoded string, or AWS_HUFFMAN_ENCODED_LENGTH_EXCEEDED if it would be more than limit.
+ */
+AWS_COMPRESSION_API
+size_t aws_huffman_get_encoded_length_limited(
+    struct aws_huffman_encoder *encoder,
+    struct aws_byte_cursor to_encode,
+    size_t limit);
+
 /**
  * Encode a symbol buffer into the output buffer.
  *
  * \param[in]       encoder         The encoder object to use
  * \param[in]       to_encode       The symbol buffer to encode
- * \param[in]       output          The buffer to write encoded bytes to
+ * \param[in]       output          The buffer to write encoded bytes to.
+ *                                  If encoder is set to allow growth, capacity will be increased up front
+ *                                  to fit all of to_encode.
  *
  * \return AWS_OP_SUCCESS if encoding is successful, AWS_OP_ERR otherwise
  */
@@ -135,6 +438,132 @@ int aws_huffman_encode(
     struct aws_byte_cursor *to_encode,
     struct aws_byte_buf *output);
 
+/**
+ * Encode a chunk of a longer symbol buffer into the output buffer.
+ * Unlike aws_huffman_encode(), the last partial byte is not padded, but kept in the encoder,
+ * so the codes of the next chunk continue right after it. Call aws_huffman_encode_finish() after the last chunk.
+ *
+ * \param[in]       encoder         The encoder object to use
+ * \param[in]       to_encode       The chunk of symbols to encode
+ * \param[in]       output          The buffer to write encoded bytes to.
+ *                                  If encoder is set to allow growth, capacity will be increased up front
+ *                                  to fit all of to_encode.
+ *
+ * \return AWS_OP_SUCCESS if the whole chunk was encoded, AWS_OP_ERR otherwise
+ */
+AWS_COMPRESSION_API
+int aws_huffman_encode_update(
+    struct aws_huffman_encoder *encoder,
+    struct aws_byte_cursor *to_encode,
+    struct aws_byte_buf *output);
+
+/**
+ * Write out the partial byte kept by aws_huffman_encode_update(), padded with eos_padding.
+ * Raises AWS_ERROR_SHORT_BUFFER if output has no room for it, in which case it may be called again.
+ *
+ * \param[in]       encoder         The encoder object to use
+ * \param[in]       output          The buffer to write encoded bytes to
+ *
+ * \return AWS_OP_SUCCESS if everything was written, AWS_OP_ERR otherwise
+ */
+AWS_COMPRESSION_API
+int aws_huffman_encode_finish(struct aws_huffman_encoder *encoder, struct aws_byte_buf *output);
+
+/**
+ * Encode a symbol buffer into a series of output buffers, such as fixed-size frames.
+ * Each segment is filled from its len to its capacity before moving on to the next,
+ * and codes continue from one segment to the next without padding. Segments are never grown.
+ *
+ * If every segment fills up, AWS_ERROR_SHORT_BUFFER is raised as by aws_huffman_encode(),
+ * and encoding continues with the next call, which should be given fresh segments.
+ *
+ * \param[in]       encoder         The encoder object to use
+ * \param[in]       to_encode       The symbol buffer to encode
+ * \param[in]       segments        num_segments buffers to write encoded bytes to, in order
+ * \param[in]       num_segments    The number of segments, at least 1
+ *
+ * \return AWS_OP_SUCCESS if encoding is successful, AWS_OP_ERR otherwise
+ */
+AWS_COMPRESSION_API
+int aws_huffman_encode_segments(
+    struct aws_huffman_encoder *encoder,
+    struct aws_byte_cursor *to_encode,
+    struct aws_byte_buf *segments,
+    size_t num_segments);
+
+/**
+ * Encode the symbols in buffer, replacing them with their encoded form, padded with eos_padding.
+ * Codes are written behind the symbols still to be read. Where the codes would overtake them,
+ * the symbols ahead are moved to a small side buffer, or, failing that, to the end of buffer's spare capacity.
+ *
+ * The encoder must not be partway through a string, and is reset if encoding fails.
+ *
+ * \param[in]       encoder         The encoder object to use
+ * \param[in,out]   buffer          In: the symbols to encode. Out: the encoded bytes.
+ *                                  If encoding fails, the contents are unspecified.
+ *
+ * \return AWS_OP_SUCCESS if encoding is successful, AWS_OP_ERR otherwise.
+ *         AWS_ERROR_SHORT_BUFFER is raised if there was no room to write codes without overwriting input.
+ */
+AWS_COMPRESSION_API
+int aws_huffman_encode_in_place(struct aws_huffman_encoder *encoder, struct aws_byte_buf *buffer);
+
+/**
+ * Encode several symbol buffers into the output buffer as one, as if they had been concatenated.
+ * EOS padding is only written after the last.
+ *
+ * Like aws_huffman_encode(), this may stop early with AWS_ERROR_SHORT_BUFFER, having advanced each cursor past
+ * the symbols it encoded. Call again with the same cursors to continue.
+ *
+ * \param[in]       encoder         The encoder object to use
+ * \param[in]       to_encode       count symbol buffers to encode, in order
+ * \param[in]       output          The buffer to write encoded bytes to.
+ *                                  If encoder is set to allow growth, capacity will be increased up front
+ *                                  to fit all of to_encode.
+ * \param[in]       count           The number of symbol buffers
+ *
+ * \return AWS_OP_SUCCESS if encoding is successful, AWS_OP_ERR otherwise
+ */
+AWS_COMPRESSION_API
+int aws_huffman_encode_cursors(
+    struct aws_huffman_encoder *encoder,
+    struct aws_byte_cursor *to_encode,
+    struct aws_byte_buf *output,
+    size_t count);
+
+/**
+ * Set whether or not to increase capacity when the output buffer may be too small for encoding.
+ * Room is reserved for every symbol encoded with the coder's longest code, and capacity at least doubles
+ * whenever it grows, so each call to aws_huffman_encode() finishes in one pass.
+ * This is false by default.
+ */
+AWS_COMPRESSION_API
+void aws_huffman_encoder_allow_growth(struct aws_huffman_encoder *encoder, bool allow_growth);
+
+/**
+ * Writes to_encode to output in whichever form is shorter: Huffman encoded, or as is.
+ * Huffman encoding stops as soon as it's no shorter than the raw bytes, so the input is only read once
+ * when Huffman wins, and at most twice otherwise. Where the forms are the same length, the raw bytes are written.
+ * Input that the coder can't encode is also written raw.
+ *
+ * The encoder is reset before and after. Output should have room for to_encode.len bytes,
+ * which is reserved if the encoder allows growth.
+ *
+ * \param[in]       encoder                 The encoder object to use
+ * \param[in]       to_encode               The symbol buffer to encode
+ * \param[in]       output                  The buffer to write to
+ * \param[out]      out_huffman_encoded     Set to whether the Huffman form was written
+ *
+ * \return AWS_OP_SUCCESS if either form was written, AWS_OP_ERR otherwise.
+ *         AWS_ERROR_SHORT_BUFFER is raised, and nothing written, if neither form fits.
+ */
+AWS_COMPRESSION_API
+int aws_huffman_encode_if_smaller(
+    struct aws_huffman_encoder *encoder,
+    struct aws_byte_cursor to_encode,
+    struct aws_byte_buf *output,
+    bool *out_huffman_encoded);
+
 /**
  * Decodes a byte buffer into the provided symbol array.
  *
@@ -151,6 +580,29 @@ int aws_huffman_decode(
     struct aws_byte_cursor *to_decode,
     struct aws_byte_buf *output);
 
+/**
+ * Decodes several independent byte buffers at once, as if by calling aws_huffman_decode() on each in turn.
+ * Strings are decoded a few at a time, a symbol from each in turn, so that the lookups for one hide the
+ * latency of the others.
+ *
+ * \param[in]       decoders        count decoders, one per string. Each may use its own coder.
+ * \param[in]       to_decode       count encoded byte buffers to read from
+ * \param[in]       output          count buffers to write decoded symbols to
+ * \param[out]      error_codes     count error codes, set to 0 for each string decoded successfully,
+ *                                  or to the error aws_huffman_decode() would have raised for it
+ * \param[in]       count           The number of strings
+ *
+ * \return AWS_OP_SUCCESS if every string decoded successfully,
+ *         otherwise AWS_OP_ERR, raising the error of the first string that failed
+ */
+AWS_COMPRESSION_API
+int aws_huffman_decode_batch(
+    struct aws_huffman_decoder *decoders,
+    struct aws_byte_cursor *to_decode,
+    struct aws_byte_buf *output,
+    int *error_codes,
+    size_t count);
+
 /**
  * Set whether or not to increase capacity when the output buffer fills up while decoding.
  * This is false by default.
@@ -158,6 +610,75 @@ int aws_huffman_decode(
 AWS_COMPRESSION_API
 void aws_huffman_decoder_allow_growth(struct aws_huffman_decoder *decoder, bool allow_growth);
 
+/**
+ * Returns whether the input decoded so far ends cleanly: every bit belongs to a decoded symbol,
+ * or the bits left over are fewer than 8 and all 1s, as HPACK requires of EOS padding.
+ * Only meaningful once all input has been passed to aws_huffman_decode().
+ */
+AWS_COMPRESSION_API
+bool aws_huffman_decoder_is_complete(const struct aws_huffman_decoder *decoder);
+
+/**
+ * Builds the optimal prefix code for the given symbol frequencies whose codes are no longer than max_bits,
+ * by the package-merge algorithm. Symbols with a frequency of 0 get no code; give every symbol a frequency of
+ * at least 1 if they should all be encodable.
+ *
+ * \param[in]       allocator       Used for scratch space
+ * \param[in]       frequencies     How often each of the 256 symbols occurs, indexed by symbol
+ * \param[in]       max_bits        The longest code allowed, 1-32
+ * \param[out]      code_lengths    The length of each of the 256 symbols' code, indexed by symbol. 0 if it has none
+ *
+ * \return AWS_OP_SUCCESS if a code was built, AWS_OP_ERR otherwise.
+ *         AWS_ERROR_INVALID_ARGUMENT is raised if max_bits is out of range, or too few for the number of symbols.
+ */
+AWS_COMPRESSION_API
+int aws_huffman_build_code_lengths(
+    struct aws_allocator *allocator,
+    const uint64_t *frequencies,
+    uint8_t max_bits,
+    uint8_t *code_lengths);
+
+/**
+ * Assigns canonical codes of the given lengths: codes sorted numerically are sorted by length,
+ * and codes of the same length are consecutive, in order of symbol.
+ * The result is suitable as an aws_huffman_symbol_coder's encode_table, and for the generator's canonical decoder.
+ *
+ * \param[in]       code_lengths    The length of each of the 256 symbols' code, 0-32, such as built by
+ *                                  aws_huffman_build_code_lengths()
+ * \param[out]      codes           The code for each of the 256 symbols, with num_bits 0 for those without
+ */
+AWS_COMPRESSION_API
+void aws_huffman_build_canonical_codes(const uint8_t *code_lengths, struct aws_huffman_code *codes);
+
+/**
+ * Maps the serialized coder at path read-only, and sets up coder to use its tables in place.
+ * The mapping lasts until aws_huffman_mapped_coder_clean_up().
+ *
+ * \return AWS_OP_SUCCESS if the coder is ready, AWS_OP_ERR otherwise.
+ *         AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER is raised if the file is malformed, or was written for
+ *         another version of the format, byte order or struct layout.
+ */
+AWS_COMPRESSION_API
+int aws_huffman_mapped_coder_init(struct aws_huffman_mapped_coder *coder, const char *path);
+
+/**
+ * Sets up coder to use the tables of a serialized coder already in memory, which must outlive it and be aligned
+ * to 8 bytes.
+ *
+ * \return AWS_OP_SUCCESS if the coder is ready, AWS_OP_ERR otherwise, as for aws_huffman_mapped_coder_init().
+ */
+AWS_COMPRESSION_API
+int aws_huffman_mapped_coder_init_from_memory(
+    struct aws_huffman_mapped_coder *coder,
+    struct aws_byte_cursor serialized);
+
+/**
+ * Unmaps the file mapped by aws_huffman_mapped_coder_init(). Encoders and decoders using the coder must not be used
+ * after this.
+ */
+AWS_COMPRESSION_API
+void aws_huffman_mapped_coder_clean_up(struct aws_huffman_mapped_coder *coder);
+
 AWS_EXTERN_C_END
 AWS_POP_SANE_WARNING_LEVEL
 
@@ -0,0 +1,46 @@
+#ifndef AWS_COMPRESSION_HUFFMAN_SIMD_H
+#define AWS_COMPRESSION_HUFFMAN_SIMD_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/compression/huffman.h>
+
+/* The number of strings a SIMD kernel decodes at once */
+#define AWS_HUFFMAN_SIMD_LANES 8
+
+/**
+ * One string being decoded by a SIMD kernel.
+ * Input is read starting bit_pos bits into input, and symbols are appended to output at output_len.
+ */
+struct aws_huffman_simd_lane {
+    const uint8_t *input;
+    uint8_t *output;
+    size_t output_len;
+    uint32_t bit_pos;
+    /* Bits of input left after bit_pos */
+    uint32_t bits_left;
+    /* The lane stops once bits_left drops below this. Must be at least 32, so reads stay within input */
+    uint32_t unchecked_until;
+    uint32_t min_code_bits;
+};
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Decodes lanes side by side with AVX2, a symbol from each per step, while each lane's bits_left is at least its
+ * unchecked_until. A lane also stops at the first code not found in the table's primary table.
+ *
+ * All lanes share table. Output is not checked: each lane's output must have room for every symbol its input down
+ * to unchecked_until could produce, plus one. Input is read 4 bytes at a time from the byte holding bit_pos.
+ */
+void aws_huffman_private_decode_lanes_avx2(
+    const struct aws_huffman_decode_table *table,
+    struct aws_huffman_simd_lane *lanes,
+    size_t num_lanes);
+
+AWS_EXTERN_C_END
+
+#endif /* AWS_COMPRESSION_HUFFMAN_SIMD_H */
@@ -0,0 +1,111 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/compression/private/huffman_simd.h>
+
+#include <immintrin.h>
+
+/* Decode entries are read as one 32 bit word: value in the low 16 bits, then num_bits, then type */
+AWS_STATIC_ASSERT(sizeof(struct aws_huffman_decode_entry) == sizeof(int32_t));
+
+void aws_huffman_private_decode_lanes_avx2(
+    const struct aws_huffman_decode_table *table,
+    struct aws_huffman_simd_lane *lanes,
+    size_t num_lanes) {
+
+    AWS_ASSERT(num_lanes > 0 && num_lanes <= AWS_HUFFMAN_SIMD_LANES);
+
+    /* Input is gathered relative to the first lane's, with each lane's offset from it as the index */
+    const uint8_t *input_base = lanes[0].input;
+    int64_t input_offsets[AWS_HUFFMAN_SIMD_LANES] = {0};
+    int32_t bit_pos[AWS_HUFFMAN_SIMD_LANES] = {0};
+    int32_t bits_left[AWS_HUFFMAN_SIMD_LANES] = {0};
+    int32_t unchecked_until[AWS_HUFFMAN_SIMD_LANES] = {0};
+    int32_t min_code_bits[AWS_HUFFMAN_SIMD_LANES] = {0};
+    int32_t active[AWS_HUFFMAN_SIMD_LANES] = {0};
+
+    for (size_t i = 0; i < num_lanes; ++i) {
+        AWS_ASSERT(lanes[i].unchecked_until >= 32 && lanes[i].bits_left <= INT32_MAX);
+        input_offsets[i] = (int64_t)((intptr_t)lanes[i].input - (intptr_t)input_base);
+        bit_pos[i] = (int32_t)lanes[i].bit_pos;
+        bits_left[i] = (int32_t)lanes[i].bits_left;
+        unchecked_until[i] = (int32_t)lanes[i].unchecked_until;
+        min_code_bits[i] = (int32_t)lanes[i].min_code_bits;
+        active[i] = lanes[i].bits_left >= lanes[i].unchecked_until ? -1 : 0;
+    }
+
+    const __m256i input_offsets_lo = _mm256_loadu_si256((const __m256i *)&input_offsets[0]);
+    const __m256i input_offsets_hi = _mm256_loadu_si256((const __m256i *)&input_offsets[4]);
+    const __m256i one = _mm256_set1_epi32(1);
+    /* There's no greater-or-equal compare, so compare greater than one less */
+    const __m256i until_minus_one = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i *)unchecked_until), one);
+    const __m256i min_minus_one = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i *)min_code_bits), one);
+    const __m128i index_shift = _mm_cvtsi32_si128(32 - table->root_bits);
+    const __m256i symbol_type = _mm256_set1_epi32(AWS_HUFFMAN_DECODE_ENTRY_SYMBOL);
+    const __m256i byte_mask = _mm256_set1_epi32(0xff);
+    const __m256i seven = _mm256_set1_epi32(7);
+    const __m256i bswap32 = _mm256_setr_epi8(
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    __m256i pos = _mm256_loadu_si256((const __m256i *)bit_pos);
+    __m256i left = _mm256_loadu_si256((const __m256i *)bits_left);
+    __m256i mask = _mm256_loadu_si256((const __m256i *)active);
+
+    while (!_mm256_testz_si256(mask, mask)) {
+
+        /* Load 32 bits from the byte holding each lane's position. Inactive lanes load nothing. */
+        const __m256i byte_offsets = _mm256_srli_epi32(pos, 3);
+        const __m256i offsets_lo =
+            _mm256_add_epi64(input_offsets_lo, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(byte_offsets)));
+        const __m256i offsets_hi =
+            _mm256_add_epi64(input_offsets_hi, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(byte_offsets, 1)));
+        const __m128i words_lo = _mm256_mask_i64gather_epi32(
+            _mm_setzero_si128(), (const int *)input_base, offsets_lo, _mm256_castsi256_si128(mask), 1);
+        const __m128i words_hi = _mm256_mask_i64gather_epi32(
+            _mm_setzero_si128(), (const int *)input_base, offsets_hi, _mm256_extracti128_si256(mask, 1), 1);
+        __m256i window = _mm256_inserti128_si256(_mm256_castsi128_si256(words_lo), words_hi, 1);
+
+        /* Big-endian, with the bits already consumed from the first byte shifted out */
+        window = _mm256_shuffle_epi8(window, bswap32);
+        window = _mm256_sllv_epi32(window, _mm256_and_si256(pos, seven));
+
+        /* Look up the primary table */
+        const __m256i index = _mm256_srl_epi32(window, index_shift);
+        const __m256i entries = _mm256_mask_i32gather_epi32(
+            _mm256_setzero_si256(), (const int *)table->entries, index, mask, sizeof(struct aws_huffman_decode_entry));
+
+        const __m256i type = _mm256_srli_epi32(entries, 24);
+        const __m256i num_bits = _mm256_and_si256(_mm256_srli_epi32(entries, 16), byte_mask);
+        const __m256i is_symbol = _mm256_and_si256(
+            _mm256_and_si256(mask, _mm256_cmpeq_epi32(type, symbol_type)),
+            _mm256_cmpgt_epi32(num_bits, min_minus_one));
+
+        const __m256i consumed = _mm256_and_si256(num_bits, is_symbol);
+        pos = _mm256_add_epi32(pos, consumed);
+        left = _mm256_sub_epi32(left, consumed);
+
+        /* Every active lane has room for one more symbol, so store unconditionally and count only complete codes */
+        int32_t symbols[AWS_HUFFMAN_SIMD_LANES];
+        int32_t stored[AWS_HUFFMAN_SIMD_LANES];
+        _mm256_storeu_si256((__m256i *)symbols, _mm256_and_si256(entries, byte_mask));
+        _mm256_storeu_si256((__m256i *)stored, is_symbol);
+        const int active_bits = _mm256_movemask_ps(_mm256_castsi256_ps(mask));
+        for (size_t i = 0; i < num_lanes; ++i) {
+            if (active_bits & (1 << i)) {
+                lanes[i].output[lanes[i].output_len] = (uint8_t)symbols[i];
+                lanes[i].output_len += (size_t)(stored[i] & 1);
+            }
+        }
+
+        mask = _mm256_and_si256(is_symbol, _mm256_cmpgt_epi32(left, until_minus_one));
+    }
+
+    _mm256_storeu_si256((__m256i *)bit_pos, pos);
+    _mm256_storeu_si256((__m256i *)bits_left, left);
+    for (size_t i = 0; i < num_lanes; ++i) {
+        lanes[i].bit_pos = (uint32_t)bit_pos[i];
+        lanes[i].bits_left = (uint32_t)bits_left[i];
+    }
+}
@@ -14,6 +14,9 @@ static struct aws_error_info s_errors[] = {
     DEFINE_ERROR_INFO(
         AWS_ERROR_COMPRESSION_UNKNOWN_SYMBOL,
         "Compression encountered an unknown symbol."),
+    DEFINE_ERROR_INFO(
+        AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER,
+        "Serialized Huffman coder is malformed, or was written for a different version or platform."),
 };
 /* clang-format on */
 
@@ -5,10 +5,29 @@
 
 #include <aws/compression/huffman.h>
 
+#include <aws/common/byte_order.h>
+#include <aws/common/math.h>
+
+#include <stdlib.h>
+
+#ifdef USE_SIMD_DECODING
+#    include <aws/common/cpuid.h>
+#    include <aws/compression/private/huffman_simd.h>
+#endif
+
 #define BITSIZEOF(val) (sizeof(val) * 8)
 
 static uint8_t MAX_PATTERN_BITS = BITSIZEOF(((struct aws_huffman_code *)0)->pattern);
 
+/* Finds the code for a symbol, preferring the coder's table over a call through its function pointer */
+static struct aws_huffman_code encode_get_code(const struct aws_huffman_symbol_coder *coder, uint8_t symbol) {
+
+    if (coder->encode_table) {
+        return coder->encode_table[symbol];
+    }
+    return coder->encode(symbol, coder->userdata);
+}
+
 void aws_huffman_encoder_init(struct aws_huffman_encoder *encoder, struct aws_huffman_symbol_coder *coder) {
 
     AWS_ASSERT(encoder);
@@ -26,6 +45,23 @@ void aws_huffman_encoder_reset(struct aws_huffman_encoder *encoder) {
     AWS_ZERO_STRUCT(encoder->overflow_bits);
 }
 
+void aws_huffman_encoder_allow_growth(struct aws_huffman_encoder *encoder, bool allow_growth) {
+    encoder->allow_growth = allow_growth;
+
+    /* Only growth needs the longest code, so it's found the first time growth is turned on */
+    const struct aws_huffman_symbol_coder *coder = encoder->coder;
+    if (!allow_growth || encoder->max_code_bits || !(coder->code_lengths || coder->encode_table || coder->encode)) {
+        return;
+    }
+    for (size_t symbol = 0; symbol <= UINT8_MAX; ++symbol) {
+        const uint8_t num_bits =
+            coder->code_lengths ? coder->code_lengths[symbol] : encode_get_code(coder, (uint8_t)symbol).num_bits;
+        if (num_bits > encoder->max_code_bits) {
+            encoder->max_code_bits = num_bits;
+        }
+    }
+}
+
 void aws_huffman_decoder_init(struct aws_huffman_decoder *decoder, struct aws_huffman_symbol_coder *coder) {
 
     AWS_ASSERT(decoder);
@@ -33,91 +69,227 @@ void aws_huffman_decoder_init(struct aws_huffman_decoder *decoder, struct aws_hu
 
     AWS_ZERO_STRUCT(*decoder);
     decoder->coder = coder;
+
+    /* Only found from the coder's tables, to spare a call per symbol. Without them this is left at 0, and decode
+     * assumes the worst: 1 bit per symbol */
+    if (coder->code_lengths || coder->encode_table) {
+        decoder->min_code_bits = MAX_PATTERN_BITS;
+        for (size_t symbol = 0; symbol <= UINT8_MAX; ++symbol) {
+            const uint8_t num_bits =
+                coder->code_lengths ? coder->code_lengths[symbol] : coder->encode_table[symbol].num_bits;
+            if (num_bits && num_bits < decoder->min_code_bits) {
+                decoder->min_code_bits = num_bits;
+            }
+        }
+    }
 }
 
 void aws_huffman_decoder_reset(struct aws_huffman_decoder *decoder) {
 
     decoder->working_bits = 0;
     decoder->num_bits = 0;
+    decoder->fsm_state = 0;
+    decoder->fsm_flags = 0;
 }
 
 void aws_huffman_decoder_allow_growth(struct aws_huffman_decoder *decoder, bool allow_growth) {
     decoder->allow_growth = allow_growth;
 }
 
+bool aws_huffman_decoder_is_complete(const struct aws_huffman_decoder *decoder) {
+
+    AWS_PRECONDITION(decoder);
+    AWS_PRECONDITION(decoder->coder);
+
+    if (decoder->coder->fsm_table) {
+        /* A nibble still waiting for output space means the input isn't done */
+        return decoder->num_bits == 0 && (decoder->fsm_state == 0 || (decoder->fsm_flags & AWS_HUFFMAN_FSM_ACCEPT));
+    }
+
+    if (decoder->num_bits == 0) {
+        return true;
+    }
+
+    return decoder->num_bits < 8 &&
+           decoder->working_bits == UINT64_MAX << (BITSIZEOF(decoder->working_bits) - decoder->num_bits);
+}
+
 /* Much of encode is written in a helper function,
    so this struct helps avoid passing all the parameters through by hand */
 struct encoder_state {
     struct aws_huffman_encoder *encoder;
     struct aws_byte_buf *output_buf;
-    uint8_t working;
-    uint8_t bit_pos;
+    /* Buffers to carry on writing to once output_buf fills up, if encoding into segments */
+    struct aws_byte_buf *next_segments;
+    size_t num_next_segments;
+    /* Bits waiting to be written, most significant first */
+    uint64_t working;
+    uint8_t num_bits;
 };
 
-/* Helper function to write a single bit_pattern to memory (or working_bits if
- * out of buffer space) */
-static int encode_write_bit_pattern(struct encoder_state *state, struct aws_huffman_code bit_pattern) {
-    AWS_PRECONDITION(state->output_buf->len < state->output_buf->capacity);
+/* Adds a code to the working bits, which must have room for it */
+static void encode_append_code(struct encoder_state *state, struct aws_huffman_code code) {
+    AWS_PRECONDITION(code.num_bits > 0 && code.num_bits <= MAX_PATTERN_BITS);
+    AWS_PRECONDITION(state->num_bits + code.num_bits <= BITSIZEOF(state->working));
 
-    if (bit_pattern.num_bits == 0) {
-        return aws_raise_error(AWS_ERROR_COMPRESSION_UNKNOWN_SYMBOL);
-    }
+    /* Chop off anything above the code's bits, then position it after the bits already waiting */
+    const uint64_t pattern = code.pattern & (UINT32_MAX >> (MAX_PATTERN_BITS - code.num_bits));
+    state->working |= pattern << (BITSIZEOF(state->working) - state->num_bits - code.num_bits);
+    state->num_bits += code.num_bits;
+}
 
-    uint8_t bits_to_write = bit_pattern.num_bits;
-    while (bits_to_write > 0) {
-        uint8_t bits_for_current = bits_to_write > state->bit_pos ? state->bit_pos : bits_to_write;
-        /* Chop off the top 0s and bits that have already been read */
-        uint8_t bits_to_cut =
-            (BITSIZEOF(bit_pattern.pattern) - bit_pattern.num_bits) + (bit_pattern.num_bits - bits_to_write);
+/* Returns the pair table's entry for two symbols, 0 if it doesn't hold them */
+static uint64_t encode_get_pair(const struct aws_huffman_pair_table *pair_table, uint8_t first, uint8_t second) {
 
-        /* Write the appropiate number of bits to this byte
-            Shift to the left to cut any unneeded bits
-            Shift to the right to position the bits correctly */
-        state->working |= (bit_pattern.pattern << bits_to_cut) >> (MAX_PATTERN_BITS - state->bit_pos);
+    if (!pair_table->ranks) {
+        return pair_table->entries[(size_t)first << 8 | second];
+    }
 
-        bits_to_write -= bits_for_current;
-        state->bit_pos -= bits_for_current;
+    const uint8_t first_rank = pair_table->ranks[first];
+    const uint8_t second_rank = pair_table->ranks[second];
+    if (first_rank == AWS_HUFFMAN_PAIR_UNRANKED || second_rank == AWS_HUFFMAN_PAIR_UNRANKED) {
+        return 0;
+    }
+    return pair_table->entries[(size_t)first_rank * pair_table->num_ranked + second_rank];
+}
 
-        if (state->bit_pos == 0) {
-            /* Save the whole byte */
-            aws_byte_buf_write_u8(state->output_buf, state->working);
+/* Adds a pair table entry's codes to the working bits, which must have room for them */
+static void encode_append_pair(struct encoder_state *state, uint64_t pair) {
+    const uint8_t num_bits = (uint8_t)(pair & AWS_HUFFMAN_PAIR_BITS_MASK);
+    AWS_PRECONDITION(num_bits > 0 && num_bits <= AWS_HUFFMAN_PAIR_MAX_BITS);
+    AWS_PRECONDITION(state->num_bits + num_bits <= BITSIZEOF(state->working));
 
-            state->bit_pos = 8;
-            state->working = 0;
+    /* The codes are already at the top of the entry, so drop the length and slide them after the waiting bits */
+    state->working |= (pair & ~(uint64_t)AWS_HUFFMAN_PAIR_BITS_MASK) >> state->num_bits;
+    state->num_bits += num_bits;
+}
 
-            if (state->output_buf->len == state->output_buf->capacity) {
-                state->encoder->overflow_bits.num_bits = bits_to_write;
+/* Writes all whole bytes of the working bits with a single store. The output must have room for 8 bytes. */
+static void encode_flush_word(struct encoder_state *state) {
+    AWS_PRECONDITION(state->output_buf->capacity - state->output_buf->len >= sizeof(uint64_t));
 
-                if (bits_to_write) {
-                    /* If buffer is full and there are remaining bits, save them to overflow and return */
-                    bits_to_cut += bits_for_current;
+    const uint8_t num_bytes = state->num_bits / 8;
+    const uint64_t word = aws_hton64(state->working);
+    memcpy(state->output_buf->buffer + state->output_buf->len, &word, sizeof(word));
 
-                    state->encoder->overflow_bits.pattern =
-                        (bit_pattern.pattern << bits_to_cut) >> (MAX_PATTERN_BITS - bits_to_write);
+    state->output_buf->len += num_bytes;
+    state->working <<= num_bytes * 8;
+    state->num_bits -= num_bytes * 8;
+}
 
-                    return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
-                }
-            }
+/* Moves on to the next segment with room, if encoding into segments. Returns whether there was one. */
+static bool encode_next_segment(struct encoder_state *state) {
+    while (state->num_next_segments) {
+        state->output_buf = state->next_segments++;
+        --state->num_next_segments;
+        if (state->output_buf->len < state->output_buf->capacity) {
+            return true;
         }
     }
+    return false;
+}
+
+/* Returns whether the output is full, after moving on to the next segment if there is one */
+static bool encode_output_is_full(struct encoder_state *state) {
+    return state->output_buf->len == state->output_buf->capacity && !encode_next_segment(state);
+}
+
+/* Writes whole bytes of the working bits one at a time, as many as fit */
+static void encode_flush_bytes(struct encoder_state *state) {
+    while (state->num_bits >= 8 && !encode_output_is_full(state)) {
+        aws_byte_buf_write_u8(state->output_buf, (uint8_t)(state->working >> (BITSIZEOF(state->working) - 8)));
+        state->working <<= 8;
+        state->num_bits -= 8;
+    }
+}
+
+/* Saves the bits left waiting in the encoder's overflow_bits, for the next call to pick up */
+static void encode_save_overflow(struct encoder_state *state) {
+    AWS_PRECONDITION(state->num_bits <= MAX_PATTERN_BITS);
+
+    state->encoder->overflow_bits.pattern =
+        state->num_bits ? (uint32_t)(state->working >> (BITSIZEOF(state->working) - state->num_bits)) : 0;
+    state->encoder->overflow_bits.num_bits = state->num_bits;
+
+    state->working = 0;
+    state->num_bits = 0;
+}
+
+/**
+ * Helper function to write a single bit_pattern to memory (or overflow_bits if out of buffer space).
+ * Fewer than 8 bits may be waiting, and the output must not be full, so if the output fills up,
+ * only bits of this code are left to be saved.
+ */
+static int encode_write_bit_pattern(struct encoder_state *state, struct aws_huffman_code bit_pattern) {
+    AWS_PRECONDITION(state->output_buf->len < state->output_buf->capacity);
+    AWS_PRECONDITION(state->num_bits < 8);
+
+    if (bit_pattern.num_bits == 0) {
+        return aws_raise_error(AWS_ERROR_COMPRESSION_UNKNOWN_SYMBOL);
+    }
+
+    encode_append_code(state, bit_pattern);
+    encode_flush_bytes(state);
+
+    if (state->num_bits && encode_output_is_full(state)) {
+        /* If buffer is full and there are remaining bits, save them to overflow and return */
+        encode_save_overflow(state);
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
 
     return AWS_OP_SUCCESS;
 }
 
-size_t aws_huffman_get_encoded_length(struct aws_huffman_encoder *encoder, struct aws_byte_cursor to_encode) {
+/* Sums the code lengths of symbols, 16 at a time, spread over independent sums so the loads can overlap */
+static size_t encode_sum_code_lengths(const uint8_t *code_lengths, const uint8_t *symbols, size_t len) {
+
+    size_t sum_0 = 0;
+    size_t sum_1 = 0;
+    size_t sum_2 = 0;
+    size_t sum_3 = 0;
+
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        for (size_t j = i; j < i + 16; j += 4) {
+            sum_0 += code_lengths[symbols[j]];
+            sum_1 += code_lengths[symbols[j + 1]];
+            sum_2 += code_lengths[symbols[j + 2]];
+            sum_3 += code_lengths[symbols[j + 3]];
+        }
+    }
+    for (; i < len; ++i) {
+        sum_0 += code_lengths[symbols[i]];
+    }
 
-    AWS_PRECONDITION(encoder);
-    AWS_PRECONDITION(aws_byte_cursor_is_valid(&to_encode));
+    return sum_0 + sum_1 + sum_2 + sum_3;
+}
+
+/* Sums the code lengths of all of to_encode, by whichever means the coder offers */
+static size_t encode_count_bits(const struct aws_huffman_symbol_coder *coder, struct aws_byte_cursor to_encode) {
 
     size_t num_bits = 0;
 
-    while (to_encode.len) {
-        uint8_t new_byte = 0;
-        aws_byte_cursor_read_u8(&to_encode, &new_byte);
-        struct aws_huffman_code code_point = encoder->coder->encode(new_byte, encoder->coder->userdata);
-        num_bits += code_point.num_bits;
+    const struct aws_huffman_code *encode_table = coder->encode_table;
+    if (coder->code_lengths) {
+        num_bits = encode_sum_code_lengths(coder->code_lengths, to_encode.ptr, to_encode.len);
+    } else if (encode_table) {
+        for (size_t i = 0; i < to_encode.len; ++i) {
+            num_bits += encode_table[to_encode.ptr[i]].num_bits;
+        }
+    } else {
+        while (to_encode.len) {
+            uint8_t new_byte = 0;
+            aws_byte_cursor_read_u8(&to_encode, &new_byte);
+            struct aws_huffman_code code_point = coder->encode(new_byte, coder->userdata);
+            num_bits += code_point.num_bits;
+        }
     }
 
+    return num_bits;
+}
+
+static size_t encode_bits_to_bytes(size_t num_bits) {
+
     size_t length = num_bits / 8;
 
     /* Round up */
@@ -128,159 +300,1270 @@ size_t aws_huffman_get_encoded_length(struct aws_huffman_encoder *encoder, struc
     return length;
 }
 
-int aws_huffman_encode(
+size_t aws_huffman_get_encoded_length(struct aws_huffman_encoder *encoder, struct aws_byte_cursor to_encode) {
+
+    AWS_PRECONDITION(encoder);
+    AWS_PRECONDITION(aws_byte_cursor_is_valid(&to_encode));
+
+    return encode_bits_to_bytes(encode_count_bits(encoder->coder, to_encode));
+}
+
+/* How many symbols aws_huffman_get_encoded_length_limited() measures between checks against the limit */
+enum { ENCODED_LENGTH_BLOCK_SIZE = 64 };
+
+size_t aws_huffman_get_encoded_length_limited(
     struct aws_huffman_encoder *encoder,
-    struct aws_byte_cursor *to_encode,
+    struct aws_byte_cursor to_encode,
+    size_t limit) {
+
+    AWS_PRECONDITION(encoder);
+    AWS_PRECONDITION(aws_byte_cursor_is_valid(&to_encode));
+
+    const size_t limit_bits = aws_mul_size_saturating(limit, 8);
+    size_t num_bits = 0;
+
+    while (to_encode.len) {
+        struct aws_byte_cursor block =
+            aws_byte_cursor_advance(&to_encode, aws_min_size(to_encode.len, ENCODED_LENGTH_BLOCK_SIZE));
+
+        num_bits += encode_count_bits(encoder->coder, block);
+        if (num_bits > limit_bits) {
+            return AWS_HUFFMAN_ENCODED_LENGTH_EXCEEDED;
+        }
+    }
+
+    return encode_bits_to_bytes(num_bits);
+}
+
+/**
+ * Every symbol takes at most max_code_bits, which bounds how much output the input can produce.
+ * Makes sure there's room for all of it, plus a word so that the fast loop runs to the end of the input.
+ * When growing, capacity at least doubles, so that many small calls into the same buffer don't each reallocate.
+ */
+static int encode_reserve_worst_case(
+    const struct aws_huffman_encoder *encoder,
+    size_t to_encode_len,
     struct aws_byte_buf *output) {
 
-    AWS_ASSERT(encoder);
-    AWS_ASSERT(encoder->coder);
-    AWS_ASSERT(to_encode);
-    AWS_ASSERT(output);
+    size_t worst_case_bits = 0;
+    if (aws_mul_size_checked(to_encode_len, encoder->max_code_bits, &worst_case_bits) ||
+        aws_add_size_checked(worst_case_bits, encoder->overflow_bits.num_bits + 7u, &worst_case_bits)) {
+        return AWS_OP_ERR;
+    }
 
-    struct encoder_state state = {
-        .working = 0,
-        .bit_pos = 8,
-    };
-    state.encoder = encoder;
-    state.output_buf = output;
+    const size_t worst_case = worst_case_bits / 8 + sizeof(uint64_t);
+    if (output->capacity - output->len >= worst_case) {
+        return AWS_OP_SUCCESS;
+    }
+    return aws_byte_buf_reserve_relative(output, aws_max_size(worst_case, output->capacity));
+}
+
+/**
+ * Picks up any bits left over from the previous call, writing all their whole bytes.
+ * Fewer than 8 may be left waiting, even if the output is full.
+ */
+static int encode_restore_overflow(struct encoder_state *state) {
+
+    struct aws_huffman_encoder *encoder = state->encoder;
 
-    /* Write any bits leftover from previous invocation */
     if (encoder->overflow_bits.num_bits) {
-        if (output->len == output->capacity) {
+        const struct aws_huffman_code overflow_bits = encoder->overflow_bits;
+        encoder->overflow_bits.num_bits = 0;
+
+        encode_append_code(state, overflow_bits);
+        encode_flush_bytes(state);
+
+        if (state->num_bits >= 8) {
+            encode_save_overflow(state);
             return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
         }
+    }
 
-        if (encode_write_bit_pattern(&state, encoder->overflow_bits)) {
-            return AWS_OP_ERR;
-        }
+    return AWS_OP_SUCCESS;
+}
 
-        encoder->overflow_bits.num_bits = 0;
+/* Reserves room if the encoder allows growth, then picks up any bits left over from the previous call */
+static int encode_begin(struct encoder_state *state, size_t to_encode_len) {
+
+    struct aws_huffman_encoder *encoder = state->encoder;
+
+    if (encoder->allow_growth && encode_reserve_worst_case(encoder, to_encode_len, state->output_buf)) {
+        return AWS_OP_ERR;
     }
 
+    return encode_restore_overflow(state);
+}
+
+/* Encodes all of to_encode after the bits already waiting, which must be fewer than 8,
+ * and leaves fewer than 8 waiting for whatever comes next */
+static int encode_symbols(struct encoder_state *state, struct aws_byte_cursor *to_encode) {
+    AWS_PRECONDITION(state->num_bits < 8);
+
+    struct aws_huffman_encoder *encoder = state->encoder;
+    const struct aws_huffman_pair_table *pair_table = encoder->coder->pair_table;
+
+    /* Only moving on to a new segment makes room again, so with a single output this runs once */
     while (to_encode->len) {
-        if (output->len == output->capacity) {
-            return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+
+        /* While there's room for a whole word of output, gather codes into the working bits,
+         * and write them out with a single store once 32 or more are waiting.
+         * With a pair table, a lookup may add up to 56 bits, so write out after every lookup instead,
+         * which leaves fewer than 8 bits waiting for the next. */
+        while (to_encode->len && state->output_buf->capacity - state->output_buf->len >= sizeof(uint64_t)) {
+
+            if (pair_table && to_encode->len >= 2) {
+                const uint64_t pair = encode_get_pair(pair_table, to_encode->ptr[0], to_encode->ptr[1]);
+                if (pair) {
+                    aws_byte_cursor_advance(to_encode, 2);
+                    encode_append_pair(state, pair);
+                    encode_flush_word(state);
+                    continue;
+                }
+            }
+
+            uint8_t new_byte = 0;
+            aws_byte_cursor_read_u8(to_encode, &new_byte);
+            struct aws_huffman_code code_point = encode_get_code(encoder->coder, new_byte);
+
+            if (code_point.num_bits == 0) {
+                encode_flush_bytes(state);
+                return aws_raise_error(AWS_ERROR_COMPRESSION_UNKNOWN_SYMBOL);
+            }
+
+            encode_append_code(state, code_point);
+            if (pair_table || state->num_bits >= MAX_PATTERN_BITS) {
+                encode_flush_word(state);
+            }
         }
 
-        uint8_t new_byte = 0;
-        aws_byte_cursor_read_u8(to_encode, &new_byte);
-        struct aws_huffman_code code_point = encoder->coder->encode(new_byte, encoder->coder->userdata);
+        /* Near the end of the output, write a code at a time, so that running out of room leaves only part of the
+         * current code to save. The loop above only stops for lack of room right after a flush,
+         * which leaves fewer than 8 bits waiting. */
+        while (to_encode->len && state->output_buf->capacity - state->output_buf->len < sizeof(uint64_t)) {
+            if (encode_output_is_full(state)) {
+                encode_save_overflow(state);
+                return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+            }
 
-        if (encode_write_bit_pattern(&state, code_point)) {
-            return AWS_OP_ERR;
+            uint8_t new_byte = 0;
+            aws_byte_cursor_read_u8(to_encode, &new_byte);
+            struct aws_huffman_code code_point = encode_get_code(encoder->coder, new_byte);
+
+            if (encode_write_bit_pattern(state, code_point)) {
+                return AWS_OP_ERR;
+            }
         }
     }
 
-    /* The following code only runs when the buffer has written successfully */
+    /* Anything left waiting fits: the fast loop stopped at the end of the input with room for a word,
+     * or the careful loop left fewer than 8 bits and room for a byte */
+    encode_flush_bytes(state);
+    AWS_ASSERT(state->num_bits < 8);
+
+    return AWS_OP_SUCCESS;
+}
+
+/* Pads the last partial byte out with EOS, once all input has been encoded */
+static int encode_finish(struct encoder_state *state) {
+    AWS_PRECONDITION(state->num_bits < 8);
+
+    if (state->num_bits) {
+        if (encode_output_is_full(state)) {
+            encode_save_overflow(state);
+            return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+        }
 
-    /* If whole buffer processed, write EOS */
-    if (state.bit_pos != 8) {
         struct aws_huffman_code eos_cp;
-        eos_cp.pattern = encoder->eos_padding;
-        eos_cp.num_bits = state.bit_pos;
-        encode_write_bit_pattern(&state, eos_cp);
-        AWS_ASSERT(state.bit_pos == 8);
+        eos_cp.pattern = state->encoder->eos_padding;
+        eos_cp.num_bits = 8 - state->num_bits;
+        encode_append_code(state, eos_cp);
+        encode_flush_bytes(state);
+        AWS_ASSERT(state->num_bits == 0);
     }
 
     return AWS_OP_SUCCESS;
 }
 
-/* Decode's reading is written in a helper function,
-   so this struct helps avoid passing all the parameters through by hand */
-struct huffman_decoder_state {
-    struct aws_huffman_decoder *decoder;
-    struct aws_byte_cursor *input_cursor;
-};
-
-static void decode_fill_working_bits(struct huffman_decoder_state *state) {
-
-    /* Read from bytes in the buffer until there are enough bytes to process */
-    while (state->decoder->num_bits < MAX_PATTERN_BITS && state->input_cursor->len) {
+int aws_huffman_encode(
+    struct aws_huffman_encoder *encoder,
+    struct aws_byte_cursor *to_encode,
+    struct aws_byte_buf *output) {
 
-        /* Read the appropiate number of bits from this byte */
-        uint8_t new_byte = 0;
-        aws_byte_cursor_read_u8(state->input_cursor, &new_byte);
+    AWS_ASSERT(encoder);
+    AWS_ASSERT(encoder->coder);
+    AWS_ASSERT(to_encode);
+    AWS_ASSERT(output);
 
-        uint64_t positioned = ((uint64_t)new_byte)
-                              << (BITSIZEOF(state->decoder->working_bits) - 8 - state->decoder->num_bits);
-        state->decoder->working_bits |= positioned;
+    struct encoder_state state = {
+        .working = 0,
+        .num_bits = 0,
+    };
+    state.encoder = encoder;
+    state.output_buf = output;
 
-        state->decoder->num_bits += 8;
+    /* If whole buffer processed, write EOS */
+    if (encode_begin(&state, to_encode->len) || encode_symbols(&state, to_encode) || encode_finish(&state)) {
+        return AWS_OP_ERR;
     }
+
+    return AWS_OP_SUCCESS;
 }
 
-int aws_huffman_decode(
-    struct aws_huffman_decoder *decoder,
-    struct aws_byte_cursor *to_decode,
+int aws_huffman_encode_update(
+    struct aws_huffman_encoder *encoder,
+    struct aws_byte_cursor *to_encode,
     struct aws_byte_buf *output) {
 
-    AWS_ASSERT(decoder);
-    AWS_ASSERT(decoder->coder);
-    AWS_ASSERT(to_decode);
+    AWS_ASSERT(encoder);
+    AWS_ASSERT(encoder->coder);
+    AWS_ASSERT(to_encode);
     AWS_ASSERT(output);
 
-    struct huffman_decoder_state state;
-    state.decoder = decoder;
-    state.input_cursor = to_decode;
-
-    /* Measures how much of the input was read */
-    size_t bits_left = decoder->num_bits + to_decode->len * 8;
+    struct encoder_state state = {
+        .working = 0,
+        .num_bits = 0,
+    };
+    state.encoder = encoder;
+    state.output_buf = output;
 
-    while (1) {
+    if (encode_begin(&state, to_encode->len) || encode_symbols(&state, to_encode)) {
+        return AWS_OP_ERR;
+    }
 
-        decode_fill_working_bits(&state);
+    /* Rather than padding the partial byte, keep it for the next call */
+    encode_save_overflow(&state);
 
-        uint8_t symbol;
-        uint8_t bits_read = decoder->coder->decode(
-            (uint32_t)(decoder->working_bits >> (BITSIZEOF(decoder->working_bits) - MAX_PATTERN_BITS)),
-            &symbol,
-            decoder->coder->userdata);
+    return AWS_OP_SUCCESS;
+}
 
-        if (bits_read == 0) {
-            if (bits_left < MAX_PATTERN_BITS) {
-                /* More input is needed to continue */
-                return AWS_OP_SUCCESS;
-            }
-            /* Unknown symbol found */
-            return aws_raise_error(AWS_ERROR_COMPRESSION_UNKNOWN_SYMBOL);
-        }
-        if (bits_read > bits_left) {
-            /* Check if the buffer has been overrun.
-            Note: because of the check in decode_fill_working_bits,
-            the buffer won't actually overrun, instead there will
-            be 0's in the bottom of working_bits. */
+int aws_huffman_encode_finish(struct aws_huffman_encoder *encoder, struct aws_byte_buf *output) {
 
-            return AWS_OP_SUCCESS;
-        }
+    AWS_ASSERT(encoder);
+    AWS_ASSERT(encoder->coder);
+    AWS_ASSERT(output);
 
-        if (output->len == output->capacity) {
-            /* Check if we've hit the end of the output buffer.
-             * Grow buffer, or raise error, depending on settings */
-            if (decoder->allow_growth) {
-                /* Double the capacity */
-                if (aws_byte_buf_reserve_relative(output, output->capacity)) {
-                    return AWS_OP_ERR;
-                }
-            } else {
-                return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
-            }
-        }
+    struct encoder_state state = {
+        .working = 0,
+        .num_bits = 0,
+    };
+    state.encoder = encoder;
+    state.output_buf = output;
 
-        bits_left -= bits_read;
-        decoder->working_bits <<= bits_read;
-        decoder->num_bits -= bits_read;
+    if (encode_begin(&state, 0) || encode_finish(&state)) {
+        return AWS_OP_ERR;
+    }
 
-        /* Store the found symbol */
-        aws_byte_buf_write_u8(output, symbol);
+    return AWS_OP_SUCCESS;
+}
 
-        /* Successfully decoded whole buffer */
-        if (bits_left == 0) {
-            return AWS_OP_SUCCESS;
-        }
-    }
+int aws_huffman_encode_segments(
+    struct aws_huffman_encoder *encoder,
+    struct aws_byte_cursor *to_encode,
+    struct aws_byte_buf *segments,
+    size_t num_segments) {
 
-    /* This case is unreachable */
+    AWS_ASSERT(encoder);
+    AWS_ASSERT(encoder->coder);
+    AWS_ASSERT(to_encode);
+    AWS_ASSERT(segments && num_segments);
+
+    struct encoder_state state = {
+        .working = 0,
+        .num_bits = 0,
+    };
+    state.encoder = encoder;
+    state.output_buf = &segments[0];
+    state.next_segments = &segments[1];
+    state.num_next_segments = num_segments - 1;
+
+    if (encode_restore_overflow(&state) || encode_symbols(&state, to_encode) || encode_finish(&state)) {
+        return AWS_OP_ERR;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+/* How many symbols aws_huffman_encode_in_place() may move aside when its output catches up with its input */
+enum { IN_PLACE_SIDE_BUFFER_SIZE = 256 };
+
+int aws_huffman_encode_in_place(struct aws_huffman_encoder *encoder, struct aws_byte_buf *buffer) {
+
+    AWS_ASSERT(encoder);
+    AWS_ASSERT(encoder->coder);
+    AWS_ASSERT(encoder->overflow_bits.num_bits == 0);
+    AWS_ASSERT(buffer);
+
+    /* Symbols are read from the front of buffer, and codes written behind them. Output may only go as far as the
+     * next unread symbol, or, once every symbol has been read, to the end of the buffer's capacity. */
+    struct aws_byte_buf output = *buffer;
+    output.len = 0;
+    output.capacity = 0;
+
+    struct encoder_state state = {
+        .working = 0,
+        .num_bits = 0,
+    };
+    state.encoder = encoder;
+    state.output_buf = &output;
+
+    /* Symbols moved out of the way of the output, which are read before those still in buffer */
+    uint8_t side_buffer[IN_PLACE_SIDE_BUFFER_SIZE];
+    struct aws_byte_cursor side = aws_byte_cursor_from_array(side_buffer, 0);
+
+    size_t read = 0;
+    size_t end = buffer->len;
+
+    while (side.len || read < end) {
+
+        uint8_t new_byte = 0;
+        if (side.len) {
+            aws_byte_cursor_read_u8(&side, &new_byte);
+        } else {
+            new_byte = buffer->buffer[read++];
+        }
+        output.capacity = read == end ? buffer->capacity : read;
+
+        struct aws_huffman_code code_point = encode_get_code(encoder->coder, new_byte);
+        if (code_point.num_bits == 0) {
+            aws_raise_error(AWS_ERROR_COMPRESSION_UNKNOWN_SYMBOL);
+            goto error;
+        }
+
+        encode_append_code(&state, code_point);
+
+        if (output.capacity - output.len >= sizeof(uint64_t)) {
+            if (state.num_bits >= MAX_PATTERN_BITS) {
+                encode_flush_word(&state);
+            }
+            continue;
+        }
+
+        /* Close behind the input, write a byte at a time. If the output has caught up and too many bits are
+         * waiting to take another code, move the input that follows aside to make room for them. */
+        encode_flush_bytes(&state);
+        while (state.num_bits > MAX_PATTERN_BITS) {
+            if (side.len == sizeof(side_buffer) || read == end) {
+                /* Last resort: move all unread input to the end of the buffer, giving up its spare capacity */
+                const size_t spare = buffer->capacity - end;
+                if (read == end || spare == 0) {
+                    aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+                    goto error;
+                }
+                memmove(buffer->buffer + read + spare, buffer->buffer + read, end - read);
+                read += spare;
+                end += spare;
+            } else {
+                memmove(side_buffer, side.ptr, side.len);
+                side.ptr = side_buffer;
+
+                const size_t num_moved = aws_min_size(sizeof(side_buffer) - side.len, end - read);
+                memcpy(side_buffer + side.len, buffer->buffer + read, num_moved);
+                side.len += num_moved;
+                read += num_moved;
+            }
+
+            output.capacity = read == end ? buffer->capacity : read;
+            encode_flush_bytes(&state);
+        }
+    }
+
+    /* All input is read, so the output may use the whole buffer */
+    output.capacity = buffer->capacity;
+    encode_flush_bytes(&state);
+    if (state.num_bits >= 8) {
+        aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+        goto error;
+    }
+
+    if (encode_finish(&state)) {
+        goto error;
+    }
+
+    buffer->len = output.len;
+    return AWS_OP_SUCCESS;
+
+error:
+    aws_huffman_encoder_reset(encoder);
+    return AWS_OP_ERR;
+}
+
+int aws_huffman_encode_cursors(
+    struct aws_huffman_encoder *encoder,
+    struct aws_byte_cursor *to_encode,
+    struct aws_byte_buf *output,
+    size_t count) {
+
+    AWS_ASSERT(encoder);
+    AWS_ASSERT(encoder->coder);
+    AWS_ASSERT(to_encode || count == 0);
+    AWS_ASSERT(output);
+
+    struct encoder_state state = {
+        .working = 0,
+        .num_bits = 0,
+    };
+    state.encoder = encoder;
+    state.output_buf = output;
+
+    size_t total_len = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total_len = aws_add_size_saturating(total_len, to_encode[i].len);
+    }
+
+    if (encode_begin(&state, total_len)) {
+        return AWS_OP_ERR;
+    }
+
+    /* Bits left waiting at the end of one cursor run straight into the codes of the next */
+    for (size_t i = 0; i < count; ++i) {
+        if (encode_symbols(&state, &to_encode[i])) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    return encode_finish(&state);
+}
+
+int aws_huffman_encode_if_smaller(
+    struct aws_huffman_encoder *encoder,
+    struct aws_byte_cursor to_encode,
+    struct aws_byte_buf *output,
+    bool *out_huffman_encoded) {
+
+    AWS_ASSERT(encoder);
+    AWS_ASSERT(output);
+    AWS_ASSERT(out_huffman_encoded);
+
+    *out_huffman_encoded = false;
+    aws_huffman_encoder_reset(encoder);
+
+    /* A growing encoder makes room for the raw form, which the Huffman form must beat, so it need not grow again */
+    if (encoder->allow_growth && aws_byte_buf_reserve_relative(output, to_encode.len)) {
+        return AWS_OP_ERR;
+    }
+
+    if (to_encode.len) {
+        /* The Huffman form only wins if it's strictly shorter, so cap the output just below the raw length.
+         * The encoder gives up with AWS_ERROR_SHORT_BUFFER the moment its output reaches the cap. */
+        const size_t original_len = output->len;
+        const size_t original_capacity = output->capacity;
+        output->capacity = original_len + aws_min_size(original_capacity - original_len, to_encode.len - 1);
+
+        const bool allow_growth = encoder->allow_growth;
+        encoder->allow_growth = false;
+
+        struct aws_byte_cursor huffman_input = to_encode;
+        const int result = aws_huffman_encode(encoder, &huffman_input, output);
+
+        encoder->allow_growth = allow_growth;
+        output->capacity = original_capacity;
+        aws_huffman_encoder_reset(encoder);
+
+        if (result == AWS_OP_SUCCESS) {
+            *out_huffman_encoded = true;
+            return AWS_OP_SUCCESS;
+        }
+
+        /* Fall back to the raw bytes */
+        output->len = original_len;
+
+        const int error_code = aws_last_error();
+        if (error_code != AWS_ERROR_SHORT_BUFFER && error_code != AWS_ERROR_COMPRESSION_UNKNOWN_SYMBOL) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    if (!aws_byte_buf_write_from_whole_cursor(output, to_encode)) {
+        return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+/* Decode's reading is written in a helper function,
+   so this struct helps avoid passing all the parameters through by hand */
+struct huffman_decoder_state {
+    struct aws_huffman_decoder *decoder;
+    struct aws_byte_cursor *input_cursor;
+};
+
+static void decode_fill_working_bits(struct huffman_decoder_state *state) {
+
+    struct aws_huffman_decoder *decoder = state->decoder;
+    struct aws_byte_cursor *input_cursor = state->input_cursor;
+
+    if (decoder->num_bits < MAX_PATTERN_BITS && input_cursor->len >= sizeof(uint64_t)) {
+        /* Take as many whole bytes as will fit with a single unaligned big-endian load */
+        uint64_t word;
+        memcpy(&word, input_cursor->ptr, sizeof(word));
+        word = aws_ntoh64(word);
+
+        const uint8_t num_bytes = (uint8_t)((BITSIZEOF(decoder->working_bits) - decoder->num_bits) / 8);
+
+        /* Drop the bytes that don't fit, they'll be loaded again next time */
+        word &= UINT64_MAX << (BITSIZEOF(word) - num_bytes * 8);
+        decoder->working_bits |= word >> decoder->num_bits;
+        decoder->num_bits += num_bytes * 8;
+
+        aws_byte_cursor_advance(input_cursor, num_bytes);
+        return;
+    }
+
+    /* Near the end of the input, read one byte at a time until there are enough bits to process */
+    while (state->decoder->num_bits < MAX_PATTERN_BITS && state->input_cursor->len) {
+
+        /* Read the appropiate number of bits from this byte */
+        uint8_t new_byte = 0;
+        aws_byte_cursor_read_u8(state->input_cursor, &new_byte);
+
+        uint64_t positioned = ((uint64_t)new_byte)
+                              << (BITSIZEOF(state->decoder->working_bits) - 8 - state->decoder->num_bits);
+        state->decoder->working_bits |= positioned;
+
+        state->decoder->num_bits += 8;
+    }
+}
+
+/* Finds the multi-symbol entry for the bits at the front of working_bits, or NULL if the coder has no such table */
+static const struct aws_huffman_multi_symbol_entry *decode_multi_symbol_lookup(
+    const struct aws_huffman_decoder *decoder) {
+
+    const struct aws_huffman_multi_symbol_table *table = decoder->coder->multi_symbol_table;
+    if (!table) {
+        return NULL;
+    }
+
+    return &table->entries[decoder->working_bits >> (BITSIZEOF(decoder->working_bits) - table->index_bits)];
+}
+
+/* Walks a decode table from its primary table through any sub-tables. Returns the code length, or 0 if invalid. */
+static uint8_t decode_table_lookup(const struct aws_huffman_decode_table *table, uint32_t bits, uint8_t *symbol) {
+
+    const struct aws_huffman_decode_entry *entry = &table->entries[bits >> (MAX_PATTERN_BITS - table->root_bits)];
+    uint8_t consumed = table->root_bits;
+    while (entry->type == AWS_HUFFMAN_DECODE_ENTRY_LINK) {
+        const uint8_t sub_bits = entry->num_bits;
+        entry = &table->entries[entry->value + ((bits << consumed) >> (MAX_PATTERN_BITS - sub_bits))];
+        consumed += sub_bits;
+    }
+
+    if (entry->type != AWS_HUFFMAN_DECODE_ENTRY_SYMBOL) {
+        return 0;
+    }
+
+    *symbol = (uint8_t)entry->value;
+    return entry->num_bits;
+}
+
+/* Decodes a single symbol from the bits at the front of working_bits, and returns the length of its code */
+static uint8_t decode_canonical_lookup(
+    const struct aws_huffman_canonical_table *table,
+    uint32_t bits,
+    uint8_t *symbol) {
+
+    /* Long codes start with long runs of 1s, so the run picks where to start looking */
+    const size_t leading_ones = aws_min_size(aws_clz_u32(~bits), table->max_bits);
+    const size_t last = (size_t)(table->max_bits - table->min_bits);
+
+    size_t i = table->start_lengths[leading_ones];
+    while (bits > table->limits[i]) {
+        if (i == last) {
+            return 0;
+        }
+        ++i;
+    }
+
+    /* Canonical codes may leave gaps between lengths, which no code begins with */
+    if (bits < table->first_codes[i]) {
+        return 0;
+    }
+
+    const uint8_t num_bits = (uint8_t)(table->min_bits + i);
+    *symbol = table->symbols[table->offsets[i] + ((bits - table->first_codes[i]) >> (MAX_PATTERN_BITS - num_bits))];
+    return num_bits;
+}
+
+static uint8_t decode_single_symbol(const struct aws_huffman_decoder *decoder, uint8_t *symbol) {
+
+    const uint32_t bits = (uint32_t)(decoder->working_bits >> (BITSIZEOF(decoder->working_bits) - MAX_PATTERN_BITS));
+
+    if (decoder->coder->decode_table) {
+        return decode_table_lookup(decoder->coder->decode_table, bits, symbol);
+    }
+    if (decoder->coder->canonical_table) {
+        return decode_canonical_lookup(decoder->coder->canonical_table, bits, symbol);
+    }
+    return decoder->coder->decode(bits, symbol, decoder->coder->userdata);
+}
+
+/* Drops bits that have been decoded from the front of working_bits */
+static void decode_consume_bits(struct aws_huffman_decoder *decoder, size_t *bits_left, uint8_t num_bits) {
+
+    *bits_left -= num_bits;
+    decoder->working_bits <<= num_bits;
+    decoder->num_bits -= num_bits;
+}
+
+/* Makes room in output for one more symbol, growing it if the decoder allows */
+static int decode_reserve_symbol(struct aws_huffman_decoder *decoder, struct aws_byte_buf *output) {
+
+    if (output->len == output->capacity) {
+        /* Check if we've hit the end of the output buffer.
+         * Grow buffer, or raise error, depending on settings */
+        if (decoder->allow_growth) {
+            /* Double the capacity */
+            if (aws_byte_buf_reserve_relative(output, output->capacity)) {
+                return AWS_OP_ERR;
+            }
+        } else {
+            return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+/* Returns the fewest bits any symbol takes to decode, which is at least 1 */
+static size_t decode_min_code_bits(const struct aws_huffman_decoder *decoder) {
+    return decoder->min_code_bits ? decoder->min_code_bits : 1;
+}
+
+/**
+ * Every symbol takes at least min_code_bits, which bounds how much output the input can produce.
+ * Reserves room for all of it if growth is allowed and the coder's shortest code is known. Assuming 1 bit per
+ * symbol would reserve 8 bytes per byte of input, so without it the output is left to grow as it fills.
+ * Also finds the point down to which bits_left may be decoded without checking the output for each symbol:
+ * until the input left could produce more than fits.
+ * A full window of input is always available before that point, so the only thing to check per symbol is that
+ * it's valid.
+ */
+static int decode_prepare_unchecked(
+    struct aws_huffman_decoder *decoder,
+    size_t bits_left,
+    struct aws_byte_buf *output,
+    size_t *unchecked_until) {
+
+    const size_t min_code_bits = decode_min_code_bits(decoder);
+    const size_t worst_case = bits_left / min_code_bits;
+    if (decoder->allow_growth && decoder->min_code_bits && output->capacity - output->len < worst_case) {
+        if (aws_byte_buf_reserve_relative(output, worst_case)) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    const size_t budget_bits = aws_mul_size_saturating(output->capacity - output->len, min_code_bits);
+    *unchecked_until = MAX_PATTERN_BITS + (bits_left > budget_bits ? bits_left - budget_bits : 0);
+    return AWS_OP_SUCCESS;
+}
+
+/**
+ * Decodes codes found in the decode_table's primary table without branching on their values:
+ * every lookup stores its symbol, but only a complete code advances the output and the input.
+ * Stops at the first code that isn't in the primary table, or once bits_left drops below until.
+ * The output must have room for every symbol the input beyond until could produce, plus one for the last store.
+ */
+static void decode_branchless(
+    struct huffman_decoder_state *state,
+    size_t *bits_left,
+    size_t until,
+    size_t min_code_bits,
+    struct aws_byte_buf *output) {
+
+    struct aws_huffman_decoder *decoder = state->decoder;
+    struct aws_byte_cursor *input_cursor = state->input_cursor;
+    const struct aws_huffman_decode_entry *entries = decoder->coder->decode_table->entries;
+    const uint8_t index_shift = (uint8_t)(BITSIZEOF(decoder->working_bits) - decoder->coder->decode_table->root_bits);
+
+    /* Work on locals, output stores may alias anything the compiler can't see through */
+    uint64_t working_bits = decoder->working_bits;
+    size_t num_bits = decoder->num_bits;
+    size_t remaining = *bits_left;
+    uint8_t *out = output->buffer;
+    size_t out_len = output->len;
+
+    while (remaining >= until) {
+
+        const struct aws_huffman_decode_entry *entry = &entries[working_bits >> index_shift];
+        const bool is_symbol = entry->type == AWS_HUFFMAN_DECODE_ENTRY_SYMBOL && entry->num_bits >= min_code_bits;
+        const size_t code_bits = is_symbol ? entry->num_bits : 0;
+
+        out[out_len] = (uint8_t)entry->value;
+        out_len += is_symbol;
+        working_bits <<= code_bits;
+        num_bits -= code_bits;
+        remaining -= code_bits;
+
+        if (!is_symbol) {
+            break;
+        }
+
+        if (input_cursor->len >= sizeof(uint64_t)) {
+            /* Top up to 56-63 bits. Bits past the last whole byte taken are loaded again next time. */
+            uint64_t word;
+            memcpy(&word, input_cursor->ptr, sizeof(word));
+            working_bits |= aws_ntoh64(word) >> num_bits;
+            aws_byte_cursor_advance(input_cursor, (BITSIZEOF(working_bits) - 1 - num_bits) / 8);
+            num_bits |= BITSIZEOF(working_bits) - 8;
+        } else {
+            decoder->working_bits = working_bits;
+            decoder->num_bits = (uint8_t)num_bits;
+            decode_fill_working_bits(state);
+            working_bits = decoder->working_bits;
+            num_bits = decoder->num_bits;
+        }
+    }
+
+    /* Clear any bits loaded past num_bits, so the rest of the decoder sees only whole bytes */
+    if (num_bits < BITSIZEOF(working_bits)) {
+        working_bits &= ~(UINT64_MAX >> num_bits);
+    }
+
+    decoder->working_bits = working_bits;
+    decoder->num_bits = (uint8_t)num_bits;
+    *bits_left = remaining;
+    output->len = out_len;
+}
+
+/* Runs one nibble through the coder's state machine. On failure, the decoder's state is left untouched. */
+static int decode_fsm_nibble(struct aws_huffman_decoder *decoder, uint8_t nibble, struct aws_byte_buf *output) {
+
+    const struct aws_huffman_fsm_transition *transition =
+        &decoder->coder->fsm_table->transitions[decoder->fsm_state * 16 + nibble];
+
+    if (transition->flags & AWS_HUFFMAN_FSM_FAIL) {
+        return aws_raise_error(AWS_ERROR_COMPRESSION_UNKNOWN_SYMBOL);
+    }
+
+    if (transition->flags & AWS_HUFFMAN_FSM_SYMBOL) {
+        if (decode_reserve_symbol(decoder, output)) {
+            return AWS_OP_ERR;
+        }
+        aws_byte_buf_write_u8(output, transition->symbol);
+    }
+
+    decoder->fsm_state = transition->next_state;
+    decoder->fsm_flags = transition->flags;
+    return AWS_OP_SUCCESS;
+}
+
+static int decode_fsm(
+    struct aws_huffman_decoder *decoder,
+    struct aws_byte_cursor *to_decode,
+    struct aws_byte_buf *output) {
+
+    /* The low half of a byte may be left over from a previous call that ran out of output */
+    if (decoder->num_bits) {
+        AWS_ASSERT(decoder->num_bits == 4);
+        uint8_t nibble = (uint8_t)(decoder->working_bits >> (BITSIZEOF(decoder->working_bits) - 4));
+        if (decode_fsm_nibble(decoder, nibble, output)) {
+            return AWS_OP_ERR;
+        }
+
+        decoder->working_bits = 0;
+        decoder->num_bits = 0;
+    }
+
+    /* A transition holds at most one symbol, so each byte produces at most 2 */
+    const size_t worst_case = aws_mul_size_saturating(to_decode->len, 2);
+    if (decoder->allow_growth && output->capacity - output->len < worst_case) {
+        if (aws_byte_buf_reserve_relative(output, worst_case)) {
+            return AWS_OP_ERR;
+        }
+    }
+
+    /* Decode the bytes whose output is sure to fit without checking the output for each symbol */
+    const struct aws_huffman_fsm_transition *transitions = decoder->coder->fsm_table->transitions;
+    size_t unchecked_bytes = aws_min_size(to_decode->len, (output->capacity - output->len) / 2);
+    for (; unchecked_bytes; --unchecked_bytes) {
+        const uint8_t byte = *to_decode->ptr;
+
+        const struct aws_huffman_fsm_transition *high = &transitions[decoder->fsm_state * 16 + (byte >> 4)];
+        const struct aws_huffman_fsm_transition *low = &transitions[high->next_state * 16 + (byte & 0x0f)];
+        if ((high->flags | low->flags) & AWS_HUFFMAN_FSM_FAIL) {
+            /* Let the checked loop raise the error */
+            break;
+        }
+
+        if (high->flags & AWS_HUFFMAN_FSM_SYMBOL) {
+            output->buffer[output->len++] = high->symbol;
+        }
+        if (low->flags & AWS_HUFFMAN_FSM_SYMBOL) {
+            output->buffer[output->len++] = low->symbol;
+        }
+
+        decoder->fsm_state = low->next_state;
+        decoder->fsm_flags = low->flags;
+        aws_byte_cursor_advance(to_decode, 1);
+    }
+
+    while (to_decode->len) {
+        const uint8_t byte = *to_decode->ptr;
+
+        if (decode_fsm_nibble(decoder, byte >> 4, output)) {
+            return AWS_OP_ERR;
+        }
+
+        aws_byte_cursor_advance(to_decode, 1);
+
+        if (decode_fsm_nibble(decoder, byte & 0x0f, output)) {
+            /* The byte has been consumed, so hold on to its low half */
+            decoder->working_bits = (uint64_t)(byte & 0x0f) << (BITSIZEOF(decoder->working_bits) - 4);
+            decoder->num_bits = 4;
+            return AWS_OP_ERR;
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+int aws_huffman_decode(
+    struct aws_huffman_decoder *decoder,
+    struct aws_byte_cursor *to_decode,
+    struct aws_byte_buf *output) {
+
+    AWS_ASSERT(decoder);
+    AWS_ASSERT(decoder->coder);
+    AWS_ASSERT(to_decode);
+    AWS_ASSERT(output);
+
+    if (decoder->coder->fsm_table) {
+        return decode_fsm(decoder, to_decode, output);
+    }
+
+    struct huffman_decoder_state state;
+    state.decoder = decoder;
+    state.input_cursor = to_decode;
+
+    /* Measures how much of the input was read */
+    size_t bits_left = decoder->num_bits + to_decode->len * 8;
+
+    const size_t min_code_bits = decode_min_code_bits(decoder);
+    size_t unchecked_until = 0;
+    if (decode_prepare_unchecked(decoder, bits_left, output, &unchecked_until)) {
+        return AWS_OP_ERR;
+    }
+
+    /* Coders with a multi-symbol table are better served by it, so only use the branchless kernel without one */
+    const bool branchless = decoder->coder->decode_table && !decoder->coder->multi_symbol_table;
+
+    while (bits_left >= unchecked_until) {
+
+        decode_fill_working_bits(&state);
+
+        if (branchless) {
+            decode_branchless(&state, &bits_left, unchecked_until, min_code_bits, output);
+            if (bits_left < unchecked_until) {
+                break;
+            }
+            /* Stopped on a code that needs a sub-table, decode it below */
+        }
+
+        const struct aws_huffman_multi_symbol_entry *entry = decode_multi_symbol_lookup(decoder);
+        if (entry && entry->num_symbols && entry->num_bits >= entry->num_symbols * min_code_bits) {
+            memcpy(output->buffer + output->len, entry->symbols, entry->num_symbols);
+            output->len += entry->num_symbols;
+
+            decode_consume_bits(decoder, &bits_left, entry->num_bits);
+            continue;
+        }
+
+        uint8_t symbol;
+        uint8_t bits_read = decode_single_symbol(decoder, &symbol);
+
+        if (bits_read < min_code_bits) {
+            /* Unknown symbol (or a coder breaking its own rules), let the checked loop handle it */
+            break;
+        }
+
+        decode_consume_bits(decoder, &bits_left, bits_read);
+        output->buffer[output->len++] = symbol;
+    }
+
+    while (1) {
+
+        decode_fill_working_bits(&state);
+
+        /* Retire as many symbols as one lookup allows, as long as they're all in the input and fit in the output.
+         * Otherwise, fall through and decode a single symbol. */
+        const struct aws_huffman_multi_symbol_entry *entry = decode_multi_symbol_lookup(decoder);
+        if (entry && entry->num_symbols && entry->num_bits <= bits_left &&
+            aws_byte_buf_write(output, entry->symbols, entry->num_symbols)) {
+
+            decode_consume_bits(decoder, &bits_left, entry->num_bits);
+
+            /* Successfully decoded whole buffer */
+            if (bits_left == 0) {
+                return AWS_OP_SUCCESS;
+            }
+            continue;
+        }
+
+        uint8_t symbol;
+        uint8_t bits_read = decode_single_symbol(decoder, &symbol);
+
+        if (bits_read == 0) {
+            if (bits_left < MAX_PATTERN_BITS) {
+                /* More input is needed to continue */
+                return AWS_OP_SUCCESS;
+            }
+            /* Unknown symbol found */
+            return aws_raise_error(AWS_ERROR_COMPRESSION_UNKNOWN_SYMBOL);
+        }
+        if (bits_read > bits_left) {
+            /* Check if the buffer has been overrun.
+            Note: because of the check in decode_fill_working_bits,
+            the buffer won't actually overrun, instead there will
+            be 0's in the bottom of working_bits. */
+
+            return AWS_OP_SUCCESS;
+        }
+
+        if (decode_reserve_symbol(decoder, output)) {
+            return AWS_OP_ERR;
+        }
+
+        decode_consume_bits(decoder, &bits_left, bits_read);
+
+        /* Store the found symbol */
+        aws_byte_buf_write_u8(output, symbol);
+
+        /* Successfully decoded whole buffer */
+        if (bits_left == 0) {
+            return AWS_OP_SUCCESS;
+        }
+    }
+
+    /* This case is unreachable */
     AWS_ASSERT(0);
     return aws_raise_error(AWS_ERROR_INVALID_STATE);
 }
+
+/* The number of strings aws_huffman_decode_batch() advances together, enough to fill an AVX2 register */
+enum { DECODE_BATCH_LANES = 8 };
+
+struct decode_batch_lane {
+    struct huffman_decoder_state state;
+    struct aws_byte_buf *output;
+    size_t bits_left;
+    size_t unchecked_until;
+    size_t min_code_bits;
+};
+
+/* Decodes a symbol from each lane in turn, until each reaches the end of its unchecked region */
+static void decode_batch_interleaved(struct decode_batch_lane *lanes, size_t num_lanes) {
+
+    struct decode_batch_lane *active[DECODE_BATCH_LANES];
+    size_t num_active = 0;
+    for (size_t i = 0; i < num_lanes; ++i) {
+        active[num_active++] = &lanes[i];
+    }
+
+    while (num_active) {
+        for (size_t i = 0; i < num_active;) {
+            struct decode_batch_lane *lane = active[i];
+            struct aws_huffman_decoder *decoder = lane->state.decoder;
+
+            uint8_t symbol = 0;
+            uint8_t bits_read = 0;
+            if (lane->bits_left >= lane->unchecked_until) {
+                decode_fill_working_bits(&lane->state);
+                bits_read = decode_single_symbol(decoder, &symbol);
+            }
+
+            if (bits_read < lane->min_code_bits) {
+                /* Done, or an unknown symbol for aws_huffman_decode() to report. Swap in the last lane. */
+                active[i] = active[--num_active];
+                continue;
+            }
+
+            decode_consume_bits(decoder, &lane->bits_left, bits_read);
+            lane->output->buffer[lane->output->len++] = symbol;
+            ++i;
+        }
+    }
+}
+
+#ifdef USE_SIMD_DECODING
+/**
+ * Runs the lanes that can be decoded with AVX2 through that kernel first: those that share the first lane's
+ * decode_table, and that start on a byte boundary. The interleaved loop picks up wherever each one stops.
+ */
+static void decode_batch_avx2(struct decode_batch_lane *lanes, size_t num_lanes) {
+
+    AWS_STATIC_ASSERT(DECODE_BATCH_LANES <= AWS_HUFFMAN_SIMD_LANES);
+
+    const struct aws_huffman_decode_table *table = NULL;
+    struct aws_huffman_simd_lane simd_lanes[AWS_HUFFMAN_SIMD_LANES];
+    struct decode_batch_lane *sources[AWS_HUFFMAN_SIMD_LANES];
+    size_t num_simd_lanes = 0;
+
+    for (size_t i = 0; i < num_lanes; ++i) {
+        struct decode_batch_lane *lane = &lanes[i];
+        const struct aws_huffman_decoder *decoder = lane->state.decoder;
+
+        if (!decoder->coder->decode_table || decoder->num_bits || lane->bits_left > INT32_MAX ||
+            lane->bits_left < lane->unchecked_until) {
+            continue;
+        }
+        if (!table) {
+            table = decoder->coder->decode_table;
+        } else if (table != decoder->coder->decode_table) {
+            continue;
+        }
+
+        struct aws_huffman_simd_lane *simd_lane = &simd_lanes[num_simd_lanes];
+        simd_lane->input = lane->state.input_cursor->ptr;
+        simd_lane->output = lane->output->buffer;
+        simd_lane->output_len = lane->output->len;
+        simd_lane->bit_pos = 0;
+        simd_lane->bits_left = (uint32_t)lane->bits_left;
+        simd_lane->unchecked_until = (uint32_t)lane->unchecked_until;
+        simd_lane->min_code_bits = (uint32_t)lane->min_code_bits;
+        sources[num_simd_lanes++] = lane;
+    }
+
+    if (num_simd_lanes == 0) {
+        return;
+    }
+
+    aws_huffman_private_decode_lanes_avx2(table, simd_lanes, num_simd_lanes);
+
+    for (size_t i = 0; i < num_simd_lanes; ++i) {
+        struct decode_batch_lane *lane = sources[i];
+        struct aws_huffman_decoder *decoder = lane->state.decoder;
+        struct aws_byte_cursor *input_cursor = lane->state.input_cursor;
+        const uint32_t bit_pos = simd_lanes[i].bit_pos;
+
+        lane->output->len = simd_lanes[i].output_len;
+        lane->bits_left = simd_lanes[i].bits_left;
+
+        /* Take whole bytes off the input, and keep what's left of a partly consumed byte in working_bits */
+        aws_byte_cursor_advance(input_cursor, bit_pos / 8);
+        if (bit_pos % 8) {
+            uint8_t partial = 0;
+            aws_byte_cursor_read_u8(input_cursor, &partial);
+            decoder->working_bits = (uint64_t)partial << (BITSIZEOF(decoder->working_bits) - 8 + bit_pos % 8);
+            decoder->num_bits = (uint8_t)(8 - bit_pos % 8);
+        }
+    }
+}
+#endif
+
+int aws_huffman_decode_batch(
+    struct aws_huffman_decoder *decoders,
+    struct aws_byte_cursor *to_decode,
+    struct aws_byte_buf *output,
+    int *error_codes,
+    size_t count) {
+
+    AWS_ASSERT(count == 0 || (decoders && to_decode && output && error_codes));
+
+    int first_error = 0;
+
+    for (size_t first = 0; first < count; first += DECODE_BATCH_LANES) {
+        const size_t num_strings = aws_min_size(count - first, DECODE_BATCH_LANES);
+
+        /* State machine decoders consume nibbles rather than codes, leave those to aws_huffman_decode() */
+        struct decode_batch_lane lanes[DECODE_BATCH_LANES];
+        size_t num_lanes = 0;
+        for (size_t i = first; i < first + num_strings; ++i) {
+            error_codes[i] = 0;
+
+            struct aws_huffman_decoder *decoder = &decoders[i];
+            AWS_ASSERT(decoder->coder);
+            if (decoder->coder->fsm_table) {
+                continue;
+            }
+
+            struct decode_batch_lane *lane = &lanes[num_lanes];
+            lane->state.decoder = decoder;
+            lane->state.input_cursor = &to_decode[i];
+            lane->output = &output[i];
+            lane->bits_left = decoder->num_bits + to_decode[i].len * 8;
+            lane->min_code_bits = decode_min_code_bits(decoder);
+            if (decode_prepare_unchecked(decoder, lane->bits_left, &output[i], &lane->unchecked_until)) {
+                error_codes[i] = aws_last_error();
+                continue;
+            }
+            ++num_lanes;
+        }
+
+#ifdef USE_SIMD_DECODING
+        if (aws_cpu_has_feature(AWS_CPU_FEATURE_AVX2)) {
+            decode_batch_avx2(lanes, num_lanes);
+        }
+#endif
+
+        decode_batch_interleaved(lanes, num_lanes);
+
+        /* Finish each string where output space, input, or a bad code stopped the interleaved loop */
+        for (size_t i = first; i < first + num_strings; ++i) {
+            if (!error_codes[i] && aws_huffman_decode(&decoders[i], &to_decode[i], &output[i])) {
+                error_codes[i] = aws_last_error();
+            }
+            if (error_codes[i] && !first_error) {
+                first_error = error_codes[i];
+            }
+        }
+    }
+
+    if (first_error) {
+        return aws_raise_error(first_error);
+    }
+    return AWS_OP_SUCCESS;
+}
+
+/* A symbol with its weight, or a package of two items from the list for the next length down */
+struct package_merge_item {
+    uint64_t weight;
+    /* For a leaf, its symbol. For a package, the index of the first of its two items. */
+    uint16_t value;
+    bool is_package;
+};
+
+static int package_merge_compare_leaves(const void *a, const void *b) {
+    const struct package_merge_item *lhs = a;
+    const struct package_merge_item *rhs = b;
+    if (lhs->weight != rhs->weight) {
+        return lhs->weight < rhs->weight ? -1 : 1;
+    }
+    return lhs->value < rhs->value ? -1 : lhs->value > rhs->value;
+}
+
+/* Adds 1 to the code length of every leaf within an item, descending through packages */
+static void package_merge_count(
+    const struct package_merge_item *lists,
+    size_t list_capacity,
+    size_t level,
+    size_t index,
+    uint8_t *code_lengths) {
+
+    const struct package_merge_item *item = &lists[level * list_capacity + index];
+    if (!item->is_package) {
+        ++code_lengths[item->value];
+        return;
+    }
+
+    AWS_ASSERT(level > 0);
+    package_merge_count(lists, list_capacity, level - 1, item->value, code_lengths);
+    package_merge_count(lists, list_capacity, level - 1, item->value + 1u, code_lengths);
+}
+
+int aws_huffman_build_code_lengths(
+    struct aws_allocator *allocator,
+    const uint64_t *frequencies,
+    uint8_t max_bits,
+    uint8_t *code_lengths) {
+
+    AWS_PRECONDITION(allocator);
+    AWS_PRECONDITION(frequencies);
+    AWS_PRECONDITION(code_lengths);
+
+    if (max_bits == 0 || max_bits > MAX_PATTERN_BITS) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    struct package_merge_item leaves[UINT8_MAX + 1];
+    size_t num_leaves = 0;
+    for (size_t symbol = 0; symbol <= UINT8_MAX; ++symbol) {
+        if (frequencies[symbol]) {
+            leaves[num_leaves].weight = frequencies[symbol];
+            leaves[num_leaves].value = (uint16_t)symbol;
+            leaves[num_leaves].is_package = false;
+            ++num_leaves;
+        }
+    }
+
+    if ((uint64_t)num_leaves > (uint64_t)1 << max_bits) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    memset(code_lengths, 0, UINT8_MAX + 1);
+    if (num_leaves < 2) {
+        /* A lone symbol still needs a bit to be written at all */
+        if (num_leaves == 1) {
+            code_lengths[leaves[0].value] = 1;
+        }
+        return AWS_OP_SUCCESS;
+    }
+
+    qsort(leaves, num_leaves, sizeof(leaves[0]), package_merge_compare_leaves);
+
+    /**
+     * Package-merge: list 0 holds the leaves, and each list after it the leaves merged with packages of pairs from
+     * the list before, each list being sorted by weight. Picking the lightest (2 * num_leaves - 2) items of the last
+     * list picks the optimal code, where each leaf's code length is the number of times it's picked, counting
+     * through packages.
+     */
+    const size_t list_capacity = 2 * num_leaves;
+    struct package_merge_item *lists =
+        aws_mem_calloc(allocator, (size_t)max_bits * list_capacity, sizeof(struct package_merge_item));
+    if (!lists) {
+        return AWS_OP_ERR;
+    }
+
+    memcpy(lists, leaves, num_leaves * sizeof(leaves[0]));
+    size_t list_len = num_leaves;
+
+    for (size_t level = 1; level < max_bits; ++level) {
+        const struct package_merge_item *previous = &lists[(level - 1) * list_capacity];
+        struct package_merge_item *current = &lists[level * list_capacity];
+        const size_t num_packages = list_len / 2;
+
+        size_t leaf = 0;
+        size_t package = 0;
+        list_len = 0;
+        while (leaf < num_leaves || package < num_packages) {
+            const uint64_t package_weight =
+                package < num_packages
+                    ? aws_add_u64_saturating(previous[2 * package].weight, previous[2 * package + 1].weight)
+                    : UINT64_MAX;
+
+            /* Leaves go first among equals, which keeps codes short where it makes no difference */
+            if (leaf < num_leaves && (package == num_packages || leaves[leaf].weight <= package_weight)) {
+                current[list_len++] = leaves[leaf++];
+            } else {
+                current[list_len].weight = package_weight;
+                current[list_len].value = (uint16_t)(2 * package);
+                current[list_len].is_package = true;
+                ++list_len;
+                ++package;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < 2 * num_leaves - 2; ++i) {
+        package_merge_count(lists, list_capacity, max_bits - 1u, i, code_lengths);
+    }
+
+    aws_mem_release(allocator, lists);
+    return AWS_OP_SUCCESS;
+}
+
+void aws_huffman_build_canonical_codes(const uint8_t *code_lengths, struct aws_huffman_code *codes) {
+
+    AWS_PRECONDITION(code_lengths);
+    AWS_PRECONDITION(codes);
+
+    /* Codes of each length follow on from the codes of the length before, in order of symbol */
+    size_t length_counts[BITSIZEOF(uint32_t) + 1];
+    AWS_ZERO_ARRAY(length_counts);
+    for (size_t symbol = 0; symbol <= UINT8_MAX; ++symbol) {
+        AWS_ASSERT(code_lengths[symbol] <= MAX_PATTERN_BITS);
+        ++length_counts[code_lengths[symbol]];
+    }
+    length_counts[0] = 0;
+
+    uint64_t next_codes[BITSIZEOF(uint32_t) + 1];
+    uint64_t code = 0;
+    for (size_t length = 1; length <= MAX_PATTERN_BITS; ++length) {
+        code = (code + length_counts[length - 1]) << 1;
+        next_codes[length] = code;
+    }
+
+    for (size_t symbol = 0; symbol <= UINT8_MAX; ++symbol) {
+        const uint8_t length = code_lengths[symbol];
+        codes[symbol].num_bits = length;
+        codes[symbol].pattern = length ? (uint32_t)next_codes[length]++ : 0;
+    }
+}
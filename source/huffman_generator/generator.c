@@ -78,7 +78,11 @@ int read_code_points(const char *input_path) {
                     uint8_t symbol = (uint8_t)atoi(current_char);
                     struct huffman_code_point *code_point = &code_points[symbol];
 
-                    assert(!code_point->symbol && "Symbol already found!");
+                    if (code_point->code.num_bits) {
+                        fprintf(stderr, "%s: symbol %u is defined more than once\n", input_path, symbol);
+                        fclose(file);
+                        return 1;
+                    }
 
                     code_point->symbol = symbol;
 
@@ -91,7 +95,13 @@ int read_code_points(const char *input_path) {
 
                     current_char += read_past_comma(current_char);
 
-                    code_point->code.num_bits = (uint8_t)atoi(current_char);
+                    const int num_bits = atoi(current_char);
+                    if (num_bits < 1 || num_bits > 32 || (num_bits < 32 && code_point->code.bits >> num_bits)) {
+                        fprintf(stderr, "%s: symbol %u has an invalid code\n", input_path, symbol);
+                        fclose(file);
+                        return 1;
+                    }
+                    code_point->code.num_bits = (uint8_t)num_bits;
                 }
             } else if (line[i] == '*' && line[i + 1] == '/') {
                 is_comment = 0;
@@ -101,135 +111,1850 @@ int read_code_points(const char *input_path) {
 
     fclose(file);
 
+    /* The tree, and every decoder built from it, assumes no code is a prefix of another */
+    for (size_t i = 0; i < num_code_points; ++i) {
+        const struct huffman_code *shorter = &code_points[i].code;
+        for (size_t j = 0; j < num_code_points && shorter->num_bits; ++j) {
+            const struct huffman_code *longer = &code_points[j].code;
+            if (i != j && longer->num_bits >= shorter->num_bits &&
+                (uint64_t)longer->bits >> (longer->num_bits - shorter->num_bits) == shorter->bits) {
+                fprintf(stderr, "%s: the code for symbol %zu is a prefix of the code for %zu\n", input_path, i, j);
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/* Returns the length of the shortest code, or 32 if no symbol has one */
+uint8_t code_points_min_bits(void) {
+    uint8_t min_bits = 32;
+    for (size_t i = 0; i < num_code_points; ++i) {
+        if (code_points[i].code.num_bits && code_points[i].code.num_bits < min_bits) {
+            min_bits = code_points[i].code.num_bits;
+        }
+    }
+    return min_bits;
+}
+
+void code_write(struct huffman_code *code, FILE *file) {
+
+    for (int bit_idx = code->num_bits - 1; bit_idx >= 0; --bit_idx) {
+        char bit = ((code->bits >> bit_idx) & 0x1) ? '1' : '0';
+        fprintf(file, "%c", bit);
+    }
+}
+
+/* Reads lines of "symbol count", symbol being 0-255. Lines starting with # are comments. */
+int read_frequencies(const char *input_path, uint64_t *frequencies) {
+
+    memset(frequencies, 0, num_code_points * sizeof(uint64_t));
+    FILE *file = fopen(input_path, "r");
+    if (!file) {
+        printf("Failed to open file '%s' for read.", input_path);
+        return 1;
+    }
+
+    char line[120];
+    size_t line_number = 0;
+    while (fgets(line, sizeof(line), file) != NULL) {
+        ++line_number;
+        const char *current_char = line + skip_whitespace(line);
+        if (*current_char == '#' || *current_char == '\n' || *current_char == '\0') {
+            continue;
+        }
+
+        char *end = NULL;
+        const long symbol = strtol(current_char, &end, 10);
+        const unsigned long long count = strtoull(end, &end, 10);
+        if (symbol < 0 || symbol >= num_code_points || end == current_char) {
+            fprintf(stderr, "%s:%zu: expected a symbol from 0 to 255 and its count\n", input_path, line_number);
+            fclose(file);
+            return 1;
+        }
+        frequencies[symbol] += count;
+    }
+
+    fclose(file);
+
+    return 0;
+}
+
+struct package_merge_item {
+    uint64_t weight;
+    /* For a leaf, its symbol. For a package, the index of the first of its two items. */
+    uint16_t value;
+    int is_package;
+};
+
+static int package_merge_compare_leaves(const void *a, const void *b) {
+    const struct package_merge_item *lhs = a;
+    const struct package_merge_item *rhs = b;
+    if (lhs->weight != rhs->weight) {
+        return lhs->weight < rhs->weight ? -1 : 1;
+    }
+    return lhs->value < rhs->value ? -1 : lhs->value > rhs->value;
+}
+
+static void package_merge_count(
+    const struct package_merge_item *lists,
+    size_t list_capacity,
+    size_t level,
+    size_t index,
+    uint8_t *code_lengths) {
+
+    const struct package_merge_item *item = &lists[level * list_capacity + index];
+    if (!item->is_package) {
+        ++code_lengths[item->value];
+        return;
+    }
+
+    assert(level > 0);
+    package_merge_count(lists, list_capacity, level - 1, item->value, code_lengths);
+    package_merge_count(lists, list_capacity, level - 1, item->value + 1u, code_lengths);
+}
+
+/* Same as aws_huffman_build_code_lengths(), which the generator can't link against */
+int build_code_lengths(const uint64_t *frequencies, uint8_t max_bits, uint8_t *code_lengths) {
+
+    struct package_merge_item leaves[num_code_points];
+    size_t num_leaves = 0;
+    for (size_t symbol = 0; symbol < num_code_points; ++symbol) {
+        if (frequencies[symbol]) {
+            leaves[num_leaves].weight = frequencies[symbol];
+            leaves[num_leaves].value = (uint16_t)symbol;
+            leaves[num_leaves].is_package = 0;
+            ++num_leaves;
+        }
+    }
+
+    if ((uint64_t)num_leaves > (uint64_t)1 << max_bits) {
+        fprintf(stderr, "%zu symbols don't fit in codes of %u bits\n", num_leaves, max_bits);
+        return 1;
+    }
+
+    memset(code_lengths, 0, num_code_points);
+    if (num_leaves < 2) {
+        if (num_leaves == 1) {
+            code_lengths[leaves[0].value] = 1;
+        }
+        return 0;
+    }
+
+    qsort(leaves, num_leaves, sizeof(leaves[0]), package_merge_compare_leaves);
+
+    const size_t list_capacity = 2 * num_leaves;
+    struct package_merge_item *lists = calloc((size_t)max_bits * list_capacity, sizeof(struct package_merge_item));
+    assert(lists);
+    memcpy(lists, leaves, num_leaves * sizeof(leaves[0]));
+    size_t list_len = num_leaves;
+
+    for (size_t level = 1; level < max_bits; ++level) {
+        const struct package_merge_item *previous = &lists[(level - 1) * list_capacity];
+        struct package_merge_item *current = &lists[level * list_capacity];
+        const size_t num_packages = list_len / 2;
+
+        size_t leaf = 0;
+        size_t package = 0;
+        list_len = 0;
+        while (leaf < num_leaves || package < num_packages) {
+            uint64_t package_weight = UINT64_MAX;
+            if (package < num_packages) {
+                package_weight = previous[2 * package].weight + previous[2 * package + 1].weight;
+                if (package_weight < previous[2 * package].weight) {
+                    package_weight = UINT64_MAX;
+                }
+            }
+
+            if (leaf < num_leaves && (package == num_packages || leaves[leaf].weight <= package_weight)) {
+                current[list_len++] = leaves[leaf++];
+            } else {
+                current[list_len].weight = package_weight;
+                current[list_len].value = (uint16_t)(2 * package);
+                current[list_len].is_package = 1;
+                ++list_len;
+                ++package;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < 2 * num_leaves - 2; ++i) {
+        package_merge_count(lists, list_capacity, max_bits - 1u, i, code_lengths);
+    }
+
+    free(lists);
+    return 0;
+}
+
+/* Replaces code_points with canonical codes of the given lengths */
+void assign_canonical_codes(const uint8_t *code_lengths) {
+
+    size_t length_counts[33] = {0};
+    for (size_t symbol = 0; symbol < num_code_points; ++symbol) {
+        ++length_counts[code_lengths[symbol]];
+    }
+    length_counts[0] = 0;
+
+    uint64_t next_codes[33] = {0};
+    uint64_t code = 0;
+    for (size_t length = 1; length <= 32; ++length) {
+        code = (code + length_counts[length - 1]) << 1;
+        next_codes[length] = code;
+    }
+
+    memset(code_points, 0, sizeof(code_points));
+    for (size_t symbol = 0; symbol < num_code_points; ++symbol) {
+        const uint8_t length = code_lengths[symbol];
+        if (length) {
+            code_points[symbol].symbol = (uint8_t)symbol;
+            code_points[symbol].code.num_bits = length;
+            code_points[symbol].code.bits = (uint32_t)next_codes[length]++;
+        }
+    }
+}
+
+/* Writes code_points in the HUFFMAN_CODE format read_code_points() reads */
+int def_write(const char *output_path) {
+
+    FILE *file = fopen(output_path, "w");
+    if (!file) {
+        printf("Failed to open file '%s' for write.", output_path);
+        return 1;
+    }
+
+    fprintf(
+        file,
+        "/**\n"
+        " * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.\n"
+        " * SPDX-License-Identifier: Apache-2.0.\n"
+        " */\n"
+        "\n"
+        "/* WARNING: THIS FILE WAS AUTOMATICALLY GENERATED. DO NOT EDIT. */\n"
+        "\n"
+        "#ifndef HUFFMAN_CODE\n"
+        "#error \"Macro HUFFMAN_CODE must be defined before including this header file!\"\n"
+        "#endif\n"
+        "\n"
+        "/*           sym                                bits         code len */\n");
+
+    for (size_t i = 0; i < num_code_points; ++i) {
+        struct huffman_code *code = &code_points[i].code;
+        if (code->num_bits == 0) {
+            continue;
+        }
+        char hex[16];
+        snprintf(hex, sizeof(hex), "0x%x", code->bits);
+        fprintf(file, "HUFFMAN_CODE(%3zu, %*s\"", i, 32 - code->num_bits, "");
+        code_write(code, file);
+        fprintf(file, "\", %10s, %2u)\n", hex, code->num_bits);
+    }
+
+    fclose(file);
+
+    return 0;
+}
+
+struct huffman_node {
+    struct huffman_code_point *value;
+
+    struct huffman_code code;
+    struct huffman_node *children[2];
+
+    /* Only assigned to branch nodes, when emitting a state machine */
+    uint16_t fsm_state;
+};
+
+struct huffman_node *huffman_node_new(struct huffman_code code) {
+
+    struct huffman_node *node = malloc(sizeof(struct huffman_node));
+    memset(node, 0, sizeof(struct huffman_node));
+    node->code = code;
+    return node;
+}
+
+struct huffman_node *huffman_node_new_value(struct huffman_code_point *value) {
+
+    struct huffman_node *node = malloc(sizeof(struct huffman_node));
+    memset(node, 0, sizeof(struct huffman_node));
+    node->value = value;
+    node->code = value->code;
+    return node;
+}
+
+/* note: Does not actually free the memory.
+   This is useful so this function may be called on the tree root. */
+void huffman_node_clean_up(struct huffman_node *node) {
+
+    for (int i = 0; i < 2; ++i) {
+        if (node->children[i]) {
+            huffman_node_clean_up(node->children[i]);
+            free(node->children[i]);
+        }
+    }
+
+    memset(node, 0, sizeof(struct huffman_node));
+}
+
+/* This function writes what to do if the pattern for node is a match */
+void huffman_node_write_decode_handle_value(struct huffman_node *node, FILE *file) {
+
+    if (!node) {
+        /* Invalid node, return 0 */
+        fprintf(file, "        return 0; /* invalid node */\n");
+    } else if (node->value) {
+        /* Attempt to inline value return */
+        fprintf(
+            file,
+            "        *symbol = %u;\n"
+            "        return %u;\n",
+            node->value->symbol,
+            node->value->code.num_bits);
+    } else {
+        /* Otherwise go to branch check */
+        fprintf(file, "        goto node_");
+        code_write(&node->code, file);
+        fprintf(file, ";\n");
+    }
+}
+
+void huffman_node_write_decode(struct huffman_node *node, FILE *file, uint8_t current_bit) {
+
+    /* Value nodes should have been inlined into parent branch checks */
+    assert(!node->value);
+    assert(node->children[0] || node->children[1]);
+
+    static int write_label = 0;
+
+    if (write_label) {
+        /* Write this node's label after the first run */
+        fprintf(file, "node_");
+        code_write(&node->code, file);
+        fprintf(file, ":\n");
+    }
+
+    write_label = 1;
+
+    /* Check 1 bit pattern */
+    uint32_t single_bit_mask = (uint32_t)(1ull << (31 - current_bit));
+    uint32_t left_aligned_pattern = ((node->code.bits << 1) + 1) << (31 - node->code.num_bits);
+    uint32_t check_pattern = left_aligned_pattern & single_bit_mask;
+    fprintf(file, "    if (bits & 0x%x) {\n", check_pattern);
+
+    huffman_node_write_decode_handle_value(node->children[1], file);
+
+    fprintf(file, "    } else {\n");
+
+    /* Child 0 is valid, go there */
+    huffman_node_write_decode_handle_value(node->children[0], file);
+
+    fprintf(file, "    }\n\n");
+
+    /* Recursively write child nodes */
+    for (uint8_t i = 0; i < 2; ++i) {
+        struct huffman_node *child = node->children[i];
+        if (child && !child->value) {
+            huffman_node_write_decode(child, file, current_bit + 1);
+        }
+    }
+}
+
+/* Writes a decode_symbol that walks the tree a bit at a time, its name starting with prefix */
+void tree_decode_write(struct huffman_node *root, const char *prefix, FILE *file) {
+
+    fprintf(
+        file,
+        "/* NOLINTNEXTLINE(readability-function-size) */\n"
+        "static uint8_t %sdecode_symbol(uint32_t bits, uint8_t *symbol, void "
+        "*userdata) {\n"
+        "    (void)userdata;\n\n",
+        prefix);
+
+    /* Traverse the tree */
+    huffman_node_write_decode(root, file, 0);
+
+    fprintf(file, "}\n");
+}
+
+/* Decode table emitted when the generator runs in table mode.
+   Mirrors struct aws_huffman_decode_entry. */
+enum decode_entry_type {
+    DECODE_ENTRY_INVALID,
+    DECODE_ENTRY_SYMBOL,
+    DECODE_ENTRY_LINK,
+};
+
+struct decode_entry {
+    uint16_t value;
+    uint8_t num_bits;
+    uint8_t type;
+};
+
+struct decode_table {
+    struct decode_entry *entries;
+    size_t num_entries;
+    size_t capacity;
+};
+
+static const char *decode_entry_type_names[] = {
+    [DECODE_ENTRY_INVALID] = "AWS_HUFFMAN_DECODE_ENTRY_INVALID",
+    [DECODE_ENTRY_SYMBOL] = "AWS_HUFFMAN_DECODE_ENTRY_SYMBOL",
+    [DECODE_ENTRY_LINK] = "AWS_HUFFMAN_DECODE_ENTRY_LINK",
+};
+
+/* Returns the length of the longest code below node */
+uint8_t huffman_node_height(struct huffman_node *node) {
+
+    if (!node || node->value) {
+        return 0;
+    }
+
+    uint8_t height_0 = huffman_node_height(node->children[0]);
+    uint8_t height_1 = huffman_node_height(node->children[1]);
+    return 1 + (height_0 > height_1 ? height_0 : height_1);
+}
+
+/* Reserves num_entries invalid entries at the end of the table, and returns the index of the first one */
+size_t decode_table_push(struct decode_table *table, size_t num_entries) {
+
+    size_t offset = table->num_entries;
+    table->num_entries += num_entries;
+
+    /* Link entries store sub-table offsets in 16 bits */
+    assert(offset <= UINT16_MAX && "Decode table too large, try a different root table size");
+
+    if (table->num_entries > table->capacity) {
+        table->capacity = table->num_entries * 2;
+        table->entries = realloc(table->entries, table->capacity * sizeof(struct decode_entry));
+        assert(table->entries);
+    }
+
+    memset(&table->entries[offset], 0, num_entries * sizeof(struct decode_entry));
+    return offset;
+}
+
+/* Fills the table of size 2^table_bits at offset with every code reachable from node.
+   Codes that don't fit in table_bits get a sub-table of up to max_sub_bits. */
+void decode_table_fill(
+    struct decode_table *table,
+    struct huffman_node *node,
+    size_t offset,
+    uint8_t table_bits,
+    uint8_t max_sub_bits) {
+
+    for (uint32_t index = 0; index < (1u << table_bits); ++index) {
+
+        /* Walk down the tree using the bits of index, most significant first */
+        struct huffman_node *current = node;
+        for (int bit_idx = table_bits - 1; bit_idx >= 0 && current && !current->value; --bit_idx) {
+            current = current->children[(index >> bit_idx) & 0x1];
+        }
+
+        struct decode_entry entry = {.type = DECODE_ENTRY_INVALID};
+        if (current && current->value) {
+            entry.type = DECODE_ENTRY_SYMBOL;
+            entry.value = current->value->symbol;
+            entry.num_bits = current->value->code.num_bits;
+        } else if (current) {
+            /* Ran out of bits partway down the tree, continue in a sub-table */
+            uint8_t sub_bits = huffman_node_height(current);
+            if (sub_bits > max_sub_bits) {
+                sub_bits = max_sub_bits;
+            }
+
+            entry.type = DECODE_ENTRY_LINK;
+            entry.value = (uint16_t)decode_table_push(table, (size_t)1 << sub_bits);
+            entry.num_bits = sub_bits;
+            decode_table_fill(table, current, entry.value, sub_bits, max_sub_bits);
+        }
+
+        /* Written last, the recursive fill may have moved entries */
+        table->entries[offset + index] = entry;
+    }
+}
+
+/* Writes the table and its decode_symbol, their names starting with prefix */
+void decode_table_write(struct decode_table *table, uint8_t root_bits, const char *prefix, FILE *file) {
+
+    fprintf(file, "static const struct aws_huffman_decode_entry %sdecode_entries[] = {\n", prefix);
+
+    for (size_t i = 0; i < table->num_entries; ++i) {
+        struct decode_entry *entry = &table->entries[i];
+        fprintf(
+            file,
+            "    { .value = 0x%x, .num_bits = %u, .type = %s }, /* %zu",
+            entry->value,
+            entry->num_bits,
+            decode_entry_type_names[entry->type],
+            i);
+        if (entry->type == DECODE_ENTRY_SYMBOL && isprint(entry->value)) {
+            fprintf(file, " '%c'", entry->value);
+        }
+        fprintf(file, " */\n");
+    }
+
+    fprintf(
+        file,
+        "};\n"
+        "\n"
+        "static uint8_t %sdecode_symbol(uint32_t bits, uint8_t *symbol, void "
+        "*userdata) {\n"
+        "    (void)userdata;\n"
+        "\n"
+        "    const struct aws_huffman_decode_entry *entry = &%sdecode_entries[bits >> (32 - %u)];\n"
+        "    uint8_t consumed = %u;\n"
+        "    while (entry->type == AWS_HUFFMAN_DECODE_ENTRY_LINK) {\n"
+        "        const uint8_t sub_bits = entry->num_bits;\n"
+        "        entry = &%sdecode_entries[entry->value + ((bits << consumed) >> (32 - sub_bits))];\n"
+        "        consumed += sub_bits;\n"
+        "    }\n"
+        "\n"
+        "    if (entry->type != AWS_HUFFMAN_DECODE_ENTRY_SYMBOL) {\n"
+        "        return 0;\n"
+        "    }\n"
+        "\n"
+        "    *symbol = (uint8_t)entry->value;\n"
+        "    return entry->num_bits;\n"
+        "}\n"
+        "\n"
+        "static const struct aws_huffman_decode_table %sdecode_table = {\n"
+        "    .entries = %sdecode_entries,\n"
+        "    .root_bits = %u,\n"
+        "};\n",
+        prefix,
+        prefix,
+        root_bits,
+        root_bits,
+        prefix,
+        prefix,
+        prefix,
+        root_bits);
+}
+
+/* Mirrors struct aws_huffman_canonical_table, with arrays indexed by (length - min_bits) */
+struct canonical_table {
+    uint32_t limits[32];
+    uint32_t first_codes[32];
+    uint16_t offsets[32];
+    uint8_t start_lengths[33];
+    uint8_t symbols[num_code_points];
+    size_t num_symbols;
+    uint8_t min_bits;
+    uint8_t max_bits;
+};
+
+static uint32_t canonical_left_aligned(const struct huffman_code_point *cp) {
+    return (uint32_t)((uint64_t)cp->code.bits << (32 - cp->code.num_bits));
+}
+
+static int canonical_compare(const void *a, const void *b) {
+    const uint32_t left_a = canonical_left_aligned(*(const struct huffman_code_point *const *)a);
+    const uint32_t left_b = canonical_left_aligned(*(const struct huffman_code_point *const *)b);
+    return left_a < left_b ? -1 : left_a > left_b;
+}
+
+/* Returns non-zero if the code is not canonical */
+int canonical_table_build(struct canonical_table *table) {
+
+    struct huffman_code_point *sorted[num_code_points];
+    size_t num_sorted = 0;
+    for (size_t i = 0; i < num_code_points; ++i) {
+        if (code_points[i].code.num_bits) {
+            sorted[num_sorted++] = &code_points[i];
+        }
+    }
+    if (num_sorted == 0) {
+        return 1;
+    }
+    qsort(sorted, num_sorted, sizeof(sorted[0]), canonical_compare);
+
+    memset(table, 0, sizeof(struct canonical_table));
+    table->num_symbols = num_sorted;
+    table->min_bits = sorted[0]->code.num_bits;
+    table->max_bits = sorted[num_sorted - 1]->code.num_bits;
+
+    for (size_t i = 0; i < num_sorted; ++i) {
+        const struct huffman_code_point *cp = sorted[i];
+        const size_t length = cp->code.num_bits - table->min_bits;
+
+        if (i > 0) {
+            const struct huffman_code_point *prev = sorted[i - 1];
+            if (cp->code.num_bits < prev->code.num_bits) {
+                return 1;
+            }
+            if (cp->code.num_bits == prev->code.num_bits && cp->code.bits != prev->code.bits + 1) {
+                return 1;
+            }
+        }
+
+        if (i == 0 || cp->code.num_bits != sorted[i - 1]->code.num_bits) {
+            table->first_codes[length] = canonical_left_aligned(cp);
+            table->offsets[length] = (uint16_t)i;
+        }
+        table->limits[length] = canonical_left_aligned(cp) | (UINT32_MAX >> cp->code.num_bits);
+        table->symbols[i] = cp->symbol;
+    }
+
+    /* Lengths without codes take the limit before them, so lookups step over them */
+    for (size_t length = 1; length <= (size_t)(table->max_bits - table->min_bits); ++length) {
+        if (table->limits[length] == 0) {
+            table->limits[length] = table->limits[length - 1];
+            table->first_codes[length] = table->limits[length - 1];
+        }
+    }
+
+    /* The smallest input with a given number of leading 1s holds the shortest code any such input may */
+    for (size_t ones = 0; ones <= table->max_bits; ++ones) {
+        const uint32_t smallest = ones >= 32 ? UINT32_MAX : ~(UINT32_MAX >> ones);
+        uint8_t length = 0;
+        while (length < table->max_bits - table->min_bits && smallest > table->limits[length]) {
+            ++length;
+        }
+        table->start_lengths[ones] = length;
+    }
+
+    return 0;
+}
+
+/* Writes the table and its decode_symbol, the function's name starting with prefix */
+void canonical_table_write(const struct canonical_table *table, const char *prefix, FILE *file) {
+
+    const size_t num_lengths = (size_t)(table->max_bits - table->min_bits + 1);
+
+    fprintf(file, "static const uint32_t canonical_limits[] = {\n");
+    for (size_t i = 0; i < num_lengths; ++i) {
+        fprintf(file, "    0x%08x, /* %zu bits */\n", table->limits[i], table->min_bits + i);
+    }
+    fprintf(file, "};\n\nstatic const uint32_t canonical_first_codes[] = {\n");
+    for (size_t i = 0; i < num_lengths; ++i) {
+        fprintf(file, "    0x%08x, /* %zu bits */\n", table->first_codes[i], table->min_bits + i);
+    }
+    fprintf(file, "};\n\nstatic const uint16_t canonical_offsets[] = {\n");
+    for (size_t i = 0; i < num_lengths; ++i) {
+        fprintf(file, "    %u, /* %zu bits */\n", table->offsets[i], table->min_bits + i);
+    }
+    fprintf(file, "};\n\nstatic const uint8_t canonical_start_lengths[] = {\n   ");
+    for (size_t i = 0; i <= table->max_bits; ++i) {
+        fprintf(file, " %u,", table->start_lengths[i]);
+    }
+    fprintf(file, "\n};\n\nstatic const uint8_t canonical_symbols[] = {\n");
+    for (size_t i = 0; i < table->num_symbols; ++i) {
+        fprintf(file, "%s0x%02x,%s", i % 12 == 0 ? "    " : " ", table->symbols[i], i % 12 == 11 ? "\n" : "");
+    }
+    if (table->num_symbols % 12 != 0) {
+        fprintf(file, "\n");
+    }
+
+    fprintf(
+        file,
+        "};\n"
+        "\n"
+        "static uint8_t %sdecode_symbol(uint32_t bits, uint8_t *symbol, void "
+        "*userdata) {\n"
+        "    (void)userdata;\n"
+        "\n"
+        "    const size_t leading_ones = aws_min_size(aws_clz_u32(~bits), %u);\n"
+        "\n"
+        "    size_t i = canonical_start_lengths[leading_ones];\n"
+        "    while (bits > canonical_limits[i]) {\n"
+        "        if (i == %u) {\n"
+        "            return 0;\n"
+        "        }\n"
+        "        ++i;\n"
+        "    }\n"
+        "\n"
+        "    if (bits < canonical_first_codes[i]) {\n"
+        "        return 0;\n"
+        "    }\n"
+        "\n"
+        "    const uint8_t num_bits = (uint8_t)(%u + i);\n"
+        "    const uint32_t index = (bits - canonical_first_codes[i]) >> (32 - num_bits);\n"
+        "    *symbol = canonical_symbols[canonical_offsets[i] + index];\n"
+        "    return num_bits;\n"
+        "}\n"
+        "\n"
+        "static const struct aws_huffman_canonical_table canonical_table = {\n"
+        "    .limits = canonical_limits,\n"
+        "    .first_codes = canonical_first_codes,\n"
+        "    .offsets = canonical_offsets,\n"
+        "    .start_lengths = canonical_start_lengths,\n"
+        "    .symbols = canonical_symbols,\n"
+        "    .min_bits = %u,\n"
+        "    .max_bits = %u,\n"
+        "};\n",
+        prefix,
+        table->max_bits,
+        table->max_bits - table->min_bits,
+        table->min_bits,
+        table->min_bits,
+        table->max_bits);
+}
+
+/* Mirrors AWS_HUFFMAN_MULTI_SYMBOL_MAX */
+enum { multi_symbol_max = 4 };
+
+/* Mirrors struct aws_huffman_multi_symbol_entry */
+struct multi_symbol_entry {
+    uint8_t symbols[multi_symbol_max];
+    uint8_t num_symbols;
+    uint8_t num_bits;
+};
+
+/* Greedily decodes codes from the front of index, index_bits long, until one runs past the end */
+struct multi_symbol_entry multi_symbol_entry_build(struct huffman_node *root, uint8_t index_bits, uint32_t index) {
+
+    struct multi_symbol_entry entry;
+    memset(&entry, 0, sizeof(entry));
+
+    while (entry.num_symbols < multi_symbol_max) {
+        struct huffman_node *current = root;
+        uint8_t bit_pos = entry.num_bits;
+        while (bit_pos < index_bits && current && !current->value) {
+            current = current->children[(index >> (index_bits - 1 - bit_pos)) & 0x1];
+            ++bit_pos;
+        }
+
+        if (!current || !current->value) {
+            break;
+        }
+
+        entry.symbols[entry.num_symbols++] = current->value->symbol;
+        entry.num_bits = bit_pos;
+    }
+
+    return entry;
+}
+
+/* Writes a table indexed by index_bits bits, where each entry holds every whole code found in those bits */
+void multi_symbol_table_write(struct huffman_node *root, uint8_t index_bits, FILE *file) {
+
+    fprintf(file, "static const struct aws_huffman_multi_symbol_entry multi_symbol_entries[] = {\n");
+
+    for (uint32_t index = 0; index < (1u << index_bits); ++index) {
+
+        const struct multi_symbol_entry entry = multi_symbol_entry_build(root, index_bits, index);
+
+        fprintf(file, "    { .symbols = { ");
+        for (int i = 0; i < multi_symbol_max; ++i) {
+            fprintf(file, "%s0x%x", i ? ", " : "", entry.symbols[i]);
+        }
+        fprintf(
+            file, " }, .num_symbols = %u, .num_bits = %u }, /* 0x%x */\n", entry.num_symbols, entry.num_bits, index);
+    }
+
+    fprintf(
+        file,
+        "};\n"
+        "\n"
+        "static const struct aws_huffman_multi_symbol_table multi_symbol_table = {\n"
+        "    .entries = multi_symbol_entries,\n"
+        "    .index_bits = %u,\n"
+        "};\n"
+        "\n",
+        index_bits);
+}
+
+/* Mirrors enum aws_huffman_fsm_flags */
+enum fsm_flags {
+    FSM_ACCEPT = 0x1,
+    FSM_SYMBOL = 0x2,
+    FSM_FAIL = 0x4,
+};
+
+/* Numbers every branch node in pre-order, so the root is state 0. Returns the number of states. */
+size_t fsm_assign_states(struct huffman_node *node, size_t next_state) {
+
+    if (!node || node->value) {
+        return next_state;
+    }
+
+    assert(next_state <= UINT16_MAX && "Too many branch nodes for a state machine");
+    node->fsm_state = (uint16_t)next_state++;
+
+    for (int i = 0; i < 2; ++i) {
+        next_state = fsm_assign_states(node->children[i], next_state);
+    }
+    return next_state;
+}
+
+/* Collects branch nodes by state number */
+void fsm_collect_states(struct huffman_node *node, struct huffman_node **states) {
+
+    if (!node || node->value) {
+        return;
+    }
+
+    states[node->fsm_state] = node;
+    for (int i = 0; i < 2; ++i) {
+        fsm_collect_states(node->children[i], states);
+    }
+}
+
+/* Mirrors struct aws_huffman_fsm_transition */
+struct fsm_transition {
+    uint16_t next_state;
+    uint8_t flags;
+    uint8_t symbol;
+};
+
+/* Follows nibble from the branch node state. States must have been assigned by fsm_assign_states(). */
+struct fsm_transition fsm_transition_build(struct huffman_node *root, struct huffman_node *state, uint8_t nibble) {
+
+    struct huffman_node *current = state;
+    struct fsm_transition transition = {.next_state = 0};
+
+    for (int bit_idx = 3; bit_idx >= 0; --bit_idx) {
+        current = current->children[(nibble >> bit_idx) & 0x1];
+        if (!current) {
+            transition.flags = FSM_FAIL;
+            break;
+        }
+        if (current->value) {
+            assert(!(transition.flags & FSM_SYMBOL) && "Codes shorter than 4 bits can't be decoded by a state machine");
+            transition.flags |= FSM_SYMBOL;
+            transition.symbol = current->value->symbol;
+            current = root;
+        }
+    }
+
+    if (current) {
+        transition.next_state = current->fsm_state;
+
+        /* Stopping here is fine if nothing is pending, or what's pending could be EOS padding */
+        const uint32_t all_ones = (uint32_t)((1ull << current->code.num_bits) - 1);
+        if (current->code.num_bits < 8 && current->code.bits == all_ones) {
+            transition.flags |= FSM_ACCEPT;
+        }
+    }
+
+    return transition;
+}
+
+/* Writes a state machine consuming 4 bits per transition.
+   Requires every code to be at least 4 bits long, so a transition completes at most one symbol. */
+void fsm_table_write(struct huffman_node *root, FILE *file) {
+
+    size_t num_states = fsm_assign_states(root, 0);
+    struct huffman_node **states = calloc(num_states, sizeof(struct huffman_node *));
+    assert(states);
+    fsm_collect_states(root, states);
+
+    fprintf(
+        file,
+        "/* Indexed by (state * 16 + nibble), each entry is { next_state, flags, symbol } */\n"
+        "static const struct aws_huffman_fsm_transition fsm_transitions[] = {\n");
+
+    for (size_t state = 0; state < num_states; ++state) {
+        fprintf(file, "    /* state %zu: ", state);
+        code_write(&states[state]->code, file);
+        fprintf(file, " */\n");
+
+        for (uint8_t nibble = 0; nibble < 16; ++nibble) {
+            const struct fsm_transition transition = fsm_transition_build(root, states[state], nibble);
+            fprintf(
+                file,
+                "%s{ %u, 0x%x, 0x%x },%s",
+                nibble % 4 == 0 ? "    " : " ",
+                transition.next_state,
+                transition.flags,
+                transition.symbol,
+                nibble % 4 == 3 ? "\n" : "");
+        }
+    }
+
+    fprintf(
+        file,
+        "};\n"
+        "\n"
+        "static const struct aws_huffman_fsm_table fsm_table = {\n"
+        "    .transitions = fsm_transitions,\n"
+        "    .num_states = %zu,\n"
+        "};\n"
+        "\n",
+        num_states);
+
+    free(states);
+}
+
+/* Mirrors AWS_HUFFMAN_PAIR_MAX_BITS, AWS_HUFFMAN_PAIR_UNRANKED */
+enum { pair_max_bits = 56, pair_unranked = 0xff };
+
+/* Orders code points from shortest code to longest, those without a code last */
+static int pair_rank_compare(const void *a, const void *b) {
+    const struct huffman_code_point *lhs = *(const struct huffman_code_point *const *)a;
+    const struct huffman_code_point *rhs = *(const struct huffman_code_point *const *)b;
+    const unsigned lhs_bits = lhs->code.num_bits ? lhs->code.num_bits : UINT8_MAX + 1u;
+    const unsigned rhs_bits = rhs->code.num_bits ? rhs->code.num_bits : UINT8_MAX + 1u;
+    if (lhs_bits != rhs_bits) {
+        return lhs_bits < rhs_bits ? -1 : 1;
+    }
+    return lhs < rhs ? -1 : lhs > rhs;
+}
+
+/* Writes a table of the codes of pairs of symbols. With fewer than 256 symbols, the table is compact,
+ * covering only the symbols with the shortest codes, which are taken to be the most frequent. */
+void pair_table_write(uint16_t num_symbols, FILE *file) {
+
+    const int compact = num_symbols < num_code_points;
+
+    /* Symbols in table order: by symbol for a full table, by rank for a compact one */
+    struct huffman_code_point *ranked[num_code_points];
+    for (size_t i = 0; i < num_code_points; ++i) {
+        ranked[i] = &code_points[i];
+    }
+
+    if (compact) {
+        qsort(ranked, num_code_points, sizeof(ranked[0]), pair_rank_compare);
+
+        uint8_t ranks[num_code_points];
+        memset(ranks, pair_unranked, sizeof(ranks));
+        for (size_t i = 0; i < num_symbols; ++i) {
+            ranks[ranked[i] - code_points] = (uint8_t)i;
+        }
+
+        fprintf(file, "static const uint8_t pair_ranks[] = {\n");
+        for (size_t i = 0; i < num_code_points; ++i) {
+            fprintf(file, "%s0x%02x,%s", i % 12 == 0 ? "    " : " ", ranks[i], i % 12 == 11 ? "\n" : "");
+        }
+        fprintf(file, "\n};\n\n");
+    }
+
+    fprintf(file, "static const uint64_t pair_entries[] = {\n");
+    for (size_t first = 0; first < num_symbols; ++first) {
+        for (size_t second = 0; second < num_symbols; ++second) {
+            const struct huffman_code *first_code = &ranked[first]->code;
+            const struct huffman_code *second_code = &ranked[second]->code;
+            const unsigned num_bits = first_code->num_bits + second_code->num_bits;
+
+            uint64_t entry = 0;
+            if (first_code->num_bits && second_code->num_bits && num_bits <= pair_max_bits) {
+                const uint64_t codes = (uint64_t)first_code->bits << second_code->num_bits | second_code->bits;
+                entry = codes << (64 - num_bits) | num_bits;
+            }
+
+            const size_t i = first * num_symbols + second;
+            fprintf(
+                file, "%s0x%016llx,%s", i % 4 == 0 ? "    " : " ", (unsigned long long)entry, i % 4 == 3 ? "\n" : "");
+        }
+    }
+    if ((size_t)num_symbols * num_symbols % 4 != 0) {
+        fprintf(file, "\n");
+    }
+
+    fprintf(
+        file,
+        "};\n"
+        "\n"
+        "static const struct aws_huffman_pair_table pair_table = {\n"
+        "    .entries = pair_entries,\n");
+    if (compact) {
+        fprintf(
+            file,
+            "    .ranks = pair_ranks,\n"
+            "    .num_ranked = %u,\n",
+            num_symbols);
+    }
+    fprintf(file, "};\n\n");
+}
+
+/* Writes encode and decode loops for this code alone, built on the file's own code_points and the decode_symbol
+ * named with decode_prefix, which the compiler is then free to inline and fold into them */
+void specialized_write(const char *name, const char *decode_prefix, FILE *file) {
+
+    int has_unknown_symbols = 0;
+    for (size_t i = 0; i < num_code_points; ++i) {
+        if (code_points[i].code.num_bits == 0) {
+            has_unknown_symbols = 1;
+        }
+    }
+
+    fprintf(
+        file,
+        "int %s_encode(struct aws_byte_cursor *to_encode, struct aws_byte_buf *output) {\n"
+        "    uint64_t working = 0;\n"
+        "    size_t num_bits = 0;\n"
+        "    size_t len = output->len;\n"
+        "\n"
+        "    for (size_t i = 0; i < to_encode->len; ++i) {\n"
+        "        const struct aws_huffman_code code = code_points[to_encode->ptr[i]];\n",
+        name);
+
+    /* Every symbol has a code in most tables, so the check can usually be left out */
+    if (has_unknown_symbols) {
+        fprintf(
+            file,
+            "        if (code.num_bits == 0) {\n"
+            "            return aws_raise_error(AWS_ERROR_COMPRESSION_UNKNOWN_SYMBOL);\n"
+            "        }\n");
+    }
+
+    fprintf(
+        file,
+        "        working |= (uint64_t)code.pattern << (64 - num_bits - code.num_bits);\n"
+        "        num_bits += code.num_bits;\n"
+        "\n"
+        "        while (num_bits >= 8) {\n"
+        "            if (len == output->capacity) {\n"
+        "                return aws_raise_error(AWS_ERROR_SHORT_BUFFER);\n"
+        "            }\n"
+        "            output->buffer[len++] = (uint8_t)(working >> 56);\n"
+        "            working <<= 8;\n"
+        "            num_bits -= 8;\n"
+        "        }\n"
+        "    }\n"
+        "\n"
+        "    /* Pad the last byte with 1s */\n"
+        "    if (num_bits) {\n"
+        "        if (len == output->capacity) {\n"
+        "            return aws_raise_error(AWS_ERROR_SHORT_BUFFER);\n"
+        "        }\n"
+        "        output->buffer[len++] = (uint8_t)(working >> 56 | 0xffu >> num_bits);\n"
+        "    }\n"
+        "\n"
+        "    output->len = len;\n"
+        "    aws_byte_cursor_advance(to_encode, to_encode->len);\n"
+        "    return AWS_OP_SUCCESS;\n"
+        "}\n"
+        "\n"
+        "int %s_decode(struct aws_byte_cursor *to_decode, struct aws_byte_buf *output) {\n"
+        "    uint64_t working = 0;\n"
+        "    size_t num_bits = 0;\n"
+        "    size_t read = 0;\n"
+        "    size_t len = output->len;\n"
+        "\n"
+        "    while (1) {\n"
+        "        while (num_bits <= 56 && read < to_decode->len) {\n"
+        "            working |= (uint64_t)to_decode->ptr[read++] << (56 - num_bits);\n"
+        "            num_bits += 8;\n"
+        "        }\n"
+        "        if (num_bits == 0) {\n"
+        "            break;\n"
+        "        }\n"
+        "\n"
+        "        uint8_t symbol = 0;\n"
+        "        const size_t code_bits = %sdecode_symbol((uint32_t)(working >> 32), &symbol, NULL);\n"
+        "        if (code_bits == 0 || code_bits > num_bits) {\n"
+        "            /* Whatever is left must be padding: fewer than 8 bits, all 1s */\n"
+        "            if (num_bits < 8 && working == UINT64_MAX << (64 - num_bits)) {\n"
+        "                break;\n"
+        "            }\n"
+        "            return aws_raise_error(AWS_ERROR_COMPRESSION_UNKNOWN_SYMBOL);\n"
+        "        }\n"
+        "\n"
+        "        if (len == output->capacity) {\n"
+        "            return aws_raise_error(AWS_ERROR_SHORT_BUFFER);\n"
+        "        }\n"
+        "        output->buffer[len++] = symbol;\n"
+        "        working <<= code_bits;\n"
+        "        num_bits -= code_bits;\n"
+        "    }\n"
+        "\n"
+        "    output->len = len;\n"
+        "    aws_byte_cursor_advance(to_decode, to_decode->len);\n"
+        "    return AWS_OP_SUCCESS;\n"
+        "}\n"
+        "\n",
+        name,
+        decode_prefix);
+}
+
+/* Sizes of the library's table entries, which the generator doesn't include */
+enum {
+    decode_entry_size = 4,
+    multi_symbol_entry_size = 6,
+    fsm_transition_size = 4,
+    pair_entry_size = 8,
+};
+
+static void report_size(FILE *file, const char *label, size_t bytes) {
+    if (bytes >= 1024) {
+        fprintf(file, "  %-30s %8zu bytes (%.1fKiB)\n", label, bytes, bytes / 1024.0);
+    } else {
+        fprintf(file, "  %-30s %8zu bytes\n", label, bytes);
+    }
+}
+
+/* Writes the code's completeness, lengths, cost on an optional corpus, and the size of each decoder's tables */
+int report_write(struct huffman_node *root, const char *corpus_path, FILE *file) {
+
+    size_t num_symbols = 0;
+    uint8_t min_bits = 32;
+    uint8_t max_bits = 0;
+    /* Sum of 2^(32 - length), which is 2^32 for a complete code */
+    uint64_t kraft_sum = 0;
+    for (size_t i = 0; i < num_code_points; ++i) {
+        const uint8_t num_bits = code_points[i].code.num_bits;
+        if (num_bits) {
+            ++num_symbols;
+            min_bits = num_bits < min_bits ? num_bits : min_bits;
+            max_bits = num_bits > max_bits ? num_bits : max_bits;
+            kraft_sum += (uint64_t)1 << (32 - num_bits);
+        }
+    }
+
+    if (num_symbols == 0) {
+        fprintf(stderr, "The code has no symbols\n");
+        return 1;
+    }
+
+    fprintf(file, "Code:\n");
+    fprintf(file, "  symbols with a code             %zu of %d\n", num_symbols, num_code_points);
+    fprintf(file, "  shortest code                   %u bits\n", min_bits);
+    fprintf(file, "  longest code                    %u bits\n", max_bits);
+    fprintf(file, "  Kraft sum                       %.9f", kraft_sum / 4294967296.0);
+    if (kraft_sum == (uint64_t)1 << 32) {
+        fprintf(file, " (complete)\n");
+    } else {
+        fprintf(file, " (incomplete, %.9f of the code space is unused)\n", 1.0 - kraft_sum / 4294967296.0);
+    }
+
+    if (corpus_path) {
+        FILE *corpus = fopen(corpus_path, "rb");
+        if (!corpus) {
+            fprintf(stderr, "Failed to open file '%s' for read.\n", corpus_path);
+            return 1;
+        }
+
+        uint64_t frequencies[num_code_points] = {0};
+        uint8_t buffer[4096];
+        size_t read = 0;
+        while ((read = fread(buffer, 1, sizeof(buffer), corpus)) > 0) {
+            for (size_t i = 0; i < read; ++i) {
+                ++frequencies[buffer[i]];
+            }
+        }
+        fclose(corpus);
+
+        uint64_t total = 0;
+        uint64_t encoded_bits = 0;
+        size_t num_missing = 0;
+        for (size_t i = 0; i < num_code_points; ++i) {
+            total += frequencies[i];
+            encoded_bits += frequencies[i] * code_points[i].code.num_bits;
+            if (frequencies[i] && code_points[i].code.num_bits == 0) {
+                ++num_missing;
+            }
+        }
+
+        fprintf(file, "\nCorpus '%s', %llu bytes:\n", corpus_path, (unsigned long long)total);
+        if (num_missing) {
+            fprintf(file, "  %zu symbols in the corpus have no code, and can't be encoded\n", num_missing);
+        } else if (total) {
+            uint8_t optimal_lengths[num_code_points];
+            uint64_t optimal_bits = 0;
+            if (build_code_lengths(frequencies, max_bits, optimal_lengths) == 0) {
+                for (size_t i = 0; i < num_code_points; ++i) {
+                    optimal_bits += frequencies[i] * optimal_lengths[i];
+                }
+            }
+
+            fprintf(file, "  bits per symbol                 %.3f\n", (double)encoded_bits / total);
+            fprintf(
+                file,
+                "  encoded size                    %llu bytes (%.1f%% of the corpus)\n",
+                (unsigned long long)((encoded_bits + 7) / 8),
+                100.0 * encoded_bits / (8.0 * total));
+            if (optimal_bits) {
+                fprintf(
+                    file,
+                    "  optimal code, up to %2u bits     %.3f bits per symbol, %llu bytes\n",
+                    max_bits,
+                    (double)optimal_bits / total,
+                    (unsigned long long)((optimal_bits + 7) / 8));
+            }
+        }
+    }
+
+    fprintf(file, "\nDecoder tables:\n");
+    const size_t num_branches = fsm_assign_states(root, 0);
+    fprintf(file, "  %-30s %8zu branches of code\n", "--decoder=tree", num_branches);
+
+    for (uint8_t root_bits = 8; root_bits <= 11; ++root_bits) {
+        struct decode_table table;
+        memset(&table, 0, sizeof(struct decode_table));
+        decode_table_push(&table, (size_t)1 << root_bits);
+        decode_table_fill(&table, root, 0, root_bits, root_bits);
+
+        char label[64];
+        snprintf(label, sizeof(label), "--decoder=table, %u root bits", root_bits);
+        report_size(file, label, table.num_entries * decode_entry_size);
+        free(table.entries);
+    }
+
+    struct canonical_table canonical;
+    if (canonical_table_build(&canonical) == 0) {
+        const size_t num_lengths = (size_t)(canonical.max_bits - canonical.min_bits + 1);
+        report_size(
+            file,
+            "--decoder=canonical",
+            num_lengths * (sizeof(uint32_t) * 2 + sizeof(uint16_t)) + canonical.max_bits + 1u + canonical.num_symbols);
+    } else {
+        fprintf(file, "  %-30s not canonical\n", "--decoder=canonical");
+    }
+
+    for (uint8_t index_bits = 12; index_bits <= 16; index_bits += 2) {
+        char label[64];
+        snprintf(label, sizeof(label), "--multi-symbol-bits=%u", index_bits);
+        report_size(file, label, ((size_t)1 << index_bits) * multi_symbol_entry_size);
+    }
+
+    if (min_bits >= 4) {
+        report_size(file, "--fsm", num_branches * 16 * fsm_transition_size);
+    } else {
+        fprintf(file, "  %-30s needs codes of at least 4 bits\n", "--fsm");
+    }
+
+    report_size(file, "--pair-symbols=16", 16 * 16 * pair_entry_size + num_code_points);
+    report_size(file, "--pair-symbols=64", 64 * 64 * pair_entry_size + num_code_points);
+    report_size(file, "--pair-symbols=256", (size_t)num_code_points * num_code_points * pair_entry_size);
+
     return 0;
 }
 
-void code_write(struct huffman_code *code, FILE *file) {
+enum decoder_mode {
+    DECODER_MODE_TREE,
+    DECODER_MODE_TABLE,
+    DECODER_MODE_CANONICAL,
+};
 
-    for (int bit_idx = code->num_bits - 1; bit_idx >= 0; --bit_idx) {
-        char bit = ((code->bits >> bit_idx) & 0x1) ? '1' : '0';
-        fprintf(file, "%c", bit);
+struct generator_options {
+    enum decoder_mode decoder;
+    uint8_t root_bits;
+    /* 0 to skip the multi-symbol table */
+    uint8_t multi_symbol_bits;
+    /* Whether to emit a state machine */
+    int fsm;
+    /* 0 to skip the pair table */
+    uint16_t pair_symbols;
+    /* Whether to emit encode and decode loops for this code alone */
+    int specialize;
+    /* Whether the input holds symbol frequencies to build a code from, rather than the code itself */
+    int from_frequencies;
+    /* The longest code to build from frequencies */
+    uint8_t max_code_bits;
+    /* Where to also write the code built from frequencies, NULL to skip */
+    const char *write_def;
+    /* Whether to print statistics about the code */
+    int report;
+    /* Sample input to measure the code against in the report, NULL to skip */
+    const char *corpus;
+    /* Whether to emit every decoder, for a benchmark to pick from */
+    int autotune;
+    /* Where to write the benchmark driver for --autotune, NULL to skip */
+    const char *benchmark;
+    /* Where to also write the tables in binary, NULL to skip */
+    const char *serialize;
+};
+
+static int parse_option(const char *arg, struct generator_options *options) {
+
+    static const char DECODER_OPT[] = "--decoder=";
+    static const char ROOT_BITS_OPT[] = "--root-bits=";
+    static const char MULTI_SYMBOL_BITS_OPT[] = "--multi-symbol-bits=";
+    static const char PAIR_SYMBOLS_OPT[] = "--pair-symbols=";
+    static const char MAX_CODE_BITS_OPT[] = "--max-code-bits=";
+    static const char WRITE_DEF_OPT[] = "--write-def=";
+    static const char CORPUS_OPT[] = "--corpus=";
+    static const char BENCHMARK_OPT[] = "--benchmark=";
+    static const char SERIALIZE_OPT[] = "--serialize=";
+
+    if (strncmp(arg, DECODER_OPT, sizeof(DECODER_OPT) - 1) == 0) {
+        const char *value = arg + sizeof(DECODER_OPT) - 1;
+        if (strcmp(value, "tree") == 0) {
+            options->decoder = DECODER_MODE_TREE;
+        } else if (strcmp(value, "table") == 0) {
+            options->decoder = DECODER_MODE_TABLE;
+        } else if (strcmp(value, "canonical") == 0) {
+            options->decoder = DECODER_MODE_CANONICAL;
+        } else {
+            fprintf(stderr, "Unknown decoder '%s', expected tree, table or canonical\n", value);
+            return 1;
+        }
+    } else if (strncmp(arg, ROOT_BITS_OPT, sizeof(ROOT_BITS_OPT) - 1) == 0) {
+        int root_bits = atoi(arg + sizeof(ROOT_BITS_OPT) - 1);
+        if (root_bits < 8 || root_bits > 11) {
+            fprintf(stderr, "--root-bits must be between 8 and 11\n");
+            return 1;
+        }
+        options->root_bits = (uint8_t)root_bits;
+    } else if (strncmp(arg, MULTI_SYMBOL_BITS_OPT, sizeof(MULTI_SYMBOL_BITS_OPT) - 1) == 0) {
+        int multi_symbol_bits = atoi(arg + sizeof(MULTI_SYMBOL_BITS_OPT) - 1);
+        if (multi_symbol_bits < 12 || multi_symbol_bits > 16) {
+            fprintf(stderr, "--multi-symbol-bits must be between 12 and 16\n");
+            return 1;
+        }
+        options->multi_symbol_bits = (uint8_t)multi_symbol_bits;
+    } else if (strcmp(arg, "--fsm") == 0) {
+        options->fsm = 1;
+    } else if (strcmp(arg, "--specialize") == 0) {
+        options->specialize = 1;
+    } else if (strncmp(arg, PAIR_SYMBOLS_OPT, sizeof(PAIR_SYMBOLS_OPT) - 1) == 0) {
+        int pair_symbols = atoi(arg + sizeof(PAIR_SYMBOLS_OPT) - 1);
+        if ((pair_symbols < 2 || pair_symbols >= pair_unranked) && pair_symbols != num_code_points) {
+            fprintf(stderr, "--pair-symbols must be between 2 and %d, or %d\n", pair_unranked - 1, num_code_points);
+            return 1;
+        }
+        options->pair_symbols = (uint16_t)pair_symbols;
+    } else if (strcmp(arg, "--from-frequencies") == 0) {
+        options->from_frequencies = 1;
+    } else if (strncmp(arg, MAX_CODE_BITS_OPT, sizeof(MAX_CODE_BITS_OPT) - 1) == 0) {
+        int max_code_bits = atoi(arg + sizeof(MAX_CODE_BITS_OPT) - 1);
+        if (max_code_bits < 1 || max_code_bits > 32) {
+            fprintf(stderr, "--max-code-bits must be between 1 and 32\n");
+            return 1;
+        }
+        options->max_code_bits = (uint8_t)max_code_bits;
+    } else if (strncmp(arg, WRITE_DEF_OPT, sizeof(WRITE_DEF_OPT) - 1) == 0) {
+        options->write_def = arg + sizeof(WRITE_DEF_OPT) - 1;
+    } else if (strcmp(arg, "--report") == 0) {
+        options->report = 1;
+    } else if (strncmp(arg, CORPUS_OPT, sizeof(CORPUS_OPT) - 1) == 0) {
+        options->corpus = arg + sizeof(CORPUS_OPT) - 1;
+    } else if (strcmp(arg, "--autotune") == 0) {
+        options->autotune = 1;
+    } else if (strncmp(arg, BENCHMARK_OPT, sizeof(BENCHMARK_OPT) - 1) == 0) {
+        options->benchmark = arg + sizeof(BENCHMARK_OPT) - 1;
+    } else if (strncmp(arg, SERIALIZE_OPT, sizeof(SERIALIZE_OPT) - 1) == 0) {
+        options->serialize = arg + sizeof(SERIALIZE_OPT) - 1;
+    } else {
+        fprintf(stderr, "Unknown option '%s'\n", arg);
+        return 1;
     }
+
+    return 0;
 }
 
-struct huffman_node {
-    struct huffman_code_point *value;
+/* Writes the name of the macro that picks name's strategy, NAME_STRATEGY, to macro */
+static void strategy_macro(const char *name, char *macro, size_t size) {
+    size_t len = 0;
+    for (; name[len] && len + sizeof("_STRATEGY") < size; ++len) {
+        macro[len] = (char)toupper((unsigned char)name[len]);
+    }
+    strcpy(&macro[len], "_STRATEGY");
+}
 
-    struct huffman_code code;
-    struct huffman_node *children[2];
+struct autotune_strategy {
+    const char *name;
+    /* Prefix of the strategy's decode_symbol */
+    const char *decode_prefix;
+    /* The decoder tables set in its coder, beyond those every coder shares */
+    const char *fields;
 };
 
-struct huffman_node *huffman_node_new(struct huffman_code code) {
+/* Declares every function the generated file exports, ahead of their definitions, so that they're checked against
+   the same signatures consumers declare */
+void exports_write(const char *name, const struct generator_options *options, FILE *file) {
 
-    struct huffman_node *node = malloc(sizeof(struct huffman_node));
-    memset(node, 0, sizeof(struct huffman_node));
-    node->code = code;
-    return node;
-}
+    if (options->autotune) {
+        fprintf(
+            file,
+            "struct aws_huffman_symbol_coder *%s_get_strategy_coder(size_t index);\n"
+            "const char *%s_get_strategy_name(size_t index);\n",
+            name,
+            name);
+    }
 
-struct huffman_node *huffman_node_new_value(struct huffman_code_point *value) {
+    fprintf(file, "struct aws_huffman_symbol_coder *%s_get_coder(void);\n", name);
 
-    struct huffman_node *node = malloc(sizeof(struct huffman_node));
-    memset(node, 0, sizeof(struct huffman_node));
-    node->value = value;
-    node->code = value->code;
-    return node;
+    if (options->specialize) {
+        fprintf(
+            file,
+            "int %s_encode(struct aws_byte_cursor *to_encode, struct aws_byte_buf *output);\n"
+            "int %s_decode(struct aws_byte_cursor *to_decode, struct aws_byte_buf *output);\n",
+            name,
+            name);
+    }
+
+    fprintf(file, "\n");
 }
 
-/* note: Does not actually free the memory.
-   This is useful so this function may be called on the tree root. */
-void huffman_node_clean_up(struct huffman_node *node) {
+/* Writes every decoder the code allows, and a coder for each, exported by index for the benchmark driver.
+   NAME_get_coder() returns the one named by NAME_STRATEGY, or the table decoder by default. */
+void autotune_write(
+    struct huffman_node *root,
+    const struct canonical_table *canonical,
+    const struct generator_options *options,
+    const char *name,
+    FILE *file) {
+
+    struct autotune_strategy strategies[6];
+    size_t num_strategies = 0;
+
+    tree_decode_write(root, "tree_", file);
+    fprintf(file, "\n");
+    strategies[num_strategies++] = (struct autotune_strategy){"tree", "tree_", ""};
+
+    struct decode_table table;
+    memset(&table, 0, sizeof(struct decode_table));
+    decode_table_push(&table, (size_t)1 << options->root_bits);
+    decode_table_fill(&table, root, 0, options->root_bits, options->root_bits);
+    decode_table_write(&table, options->root_bits, "table_", file);
+    fprintf(file, "\n");
+    free(table.entries);
+    strategies[num_strategies++] =
+        (struct autotune_strategy){"table", "table_", "        .decode_table = &table_decode_table,\n"};
+
+    /* A single table indexed by the longest code, when that's no more than 16 bits */
+    const uint8_t max_bits = huffman_node_height(root);
+    if (max_bits > options->root_bits && max_bits <= 16) {
+        memset(&table, 0, sizeof(struct decode_table));
+        decode_table_push(&table, (size_t)1 << max_bits);
+        decode_table_fill(&table, root, 0, max_bits, max_bits);
+        decode_table_write(&table, max_bits, "flat_", file);
+        fprintf(file, "\n");
+        free(table.entries);
+        strategies[num_strategies++] =
+            (struct autotune_strategy){"flat", "flat_", "        .decode_table = &flat_decode_table,\n"};
+    }
 
-    for (int i = 0; i < 2; ++i) {
-        if (node->children[i]) {
-            huffman_node_clean_up(node->children[i]);
-            free(node->children[i]);
-        }
+    if (canonical) {
+        canonical_table_write(canonical, "canonical_", file);
+        fprintf(file, "\n");
+        strategies[num_strategies++] = (struct autotune_strategy){
+            "canonical", "canonical_", "        .canonical_table = &canonical_table,\n"};
     }
 
-    memset(node, 0, sizeof(struct huffman_node));
-}
+    multi_symbol_table_write(root, options->multi_symbol_bits ? options->multi_symbol_bits : 12, file);
+    strategies[num_strategies++] = (struct autotune_strategy){
+        "multi_symbol",
+        "table_",
+        "        .decode_table = &table_decode_table,\n"
+        "        .multi_symbol_table = &multi_symbol_table,\n"};
+
+    if (code_points_min_bits() >= 4) {
+        fsm_table_write(root, file);
+        strategies[num_strategies++] = (struct autotune_strategy){
+            "fsm",
+            "table_",
+            "        .decode_table = &table_decode_table,\n"
+            "        .fsm_table = &fsm_table,\n"};
+    }
 
-/* This function writes what to do if the pattern for node is a match */
-void huffman_node_write_decode_handle_value(struct huffman_node *node, FILE *file) {
+    if (options->pair_symbols) {
+        pair_table_write(options->pair_symbols, file);
+    }
 
-    if (!node) {
-        /* Invalid node, return 0 */
-        fprintf(file, "        return 0; /* invalid node */\n");
-    } else if (node->value) {
-        /* Attempt to inline value return */
+    if (options->specialize) {
+        specialized_write(name, "table_", file);
+    }
+
+    fprintf(file, "static struct aws_huffman_symbol_coder strategies[] = {\n");
+    for (size_t i = 0; i < num_strategies; ++i) {
         fprintf(
             file,
-            "        *symbol = %u;\n"
-            "        return %u;\n",
-            node->value->symbol,
-            node->value->code.num_bits);
-    } else {
-        /* Otherwise go to branch check */
-        fprintf(file, "        goto node_");
-        code_write(&node->code, file);
-        fprintf(file, ";\n");
+            "    {\n"
+            "        .encode = encode_symbol,\n"
+            "        .decode = %sdecode_symbol,\n"
+            "        .userdata = NULL,\n"
+            "        .encode_table = code_points,\n"
+            "        .code_lengths = code_lengths,\n"
+            "%s%s"
+            "    },\n",
+            strategies[i].decode_prefix,
+            options->pair_symbols ? "        .pair_table = &pair_table,\n" : "",
+            strategies[i].fields);
+    }
+    fprintf(file, "};\n\nstatic const char *const strategy_names[] = {\n");
+    for (size_t i = 0; i < num_strategies; ++i) {
+        fprintf(file, "    \"%s\",\n", strategies[i].name);
     }
-}
 
-void huffman_node_write_decode(struct huffman_node *node, FILE *file, uint8_t current_bit) {
+    char macro[128];
+    strategy_macro(name, macro, sizeof(macro));
 
-    /* Value nodes should have been inlined into parent branch checks */
-    assert(!node->value);
-    assert(node->children[0] || node->children[1]);
+    fprintf(
+        file,
+        "};\n"
+        "\n"
+        "/* The benchmark driver prints the definition that picks the fastest strategy on the machine it runs on */\n"
+        "#ifndef %s\n"
+        "#    define %s 1 /* table */\n"
+        "#endif\n"
+        "AWS_STATIC_ASSERT(%s < AWS_ARRAY_SIZE(strategies));\n"
+        "\n"
+        "struct aws_huffman_symbol_coder *%s_get_strategy_coder(size_t index) {\n"
+        "    return index < AWS_ARRAY_SIZE(strategies) ? &strategies[index] : NULL;\n"
+        "}\n"
+        "\n"
+        "const char *%s_get_strategy_name(size_t index) {\n"
+        "    return index < AWS_ARRAY_SIZE(strategy_names) ? strategy_names[index] : NULL;\n"
+        "}\n"
+        "\n"
+        "struct aws_huffman_symbol_coder *%s_get_coder(void) {\n"
+        "    return &strategies[%s];\n"
+        "}\n",
+        macro,
+        macro,
+        macro,
+        name,
+        name,
+        name,
+        macro);
+}
 
-    static int write_label = 0;
+/* Writes a program that times decoding a corpus with each of the strategies autotune_write() emitted for name */
+int benchmark_write(const char *name, const char *output_path) {
 
-    if (write_label) {
-        /* Write this node's label after the first run */
-        fprintf(file, "node_");
-        code_write(&node->code, file);
-        fprintf(file, ":\n");
+    FILE *file = fopen(output_path, "w");
+    if (!file) {
+        printf("Failed to open file '%s' for write.", output_path);
+        return 1;
     }
 
-    write_label = 1;
+    char macro[128];
+    strategy_macro(name, macro, sizeof(macro));
 
-    /* Check 1 bit pattern */
-    uint32_t single_bit_mask = (uint32_t)(1ull << (31 - current_bit));
-    uint32_t left_aligned_pattern = ((node->code.bits << 1) + 1) << (31 - node->code.num_bits);
-    uint32_t check_pattern = left_aligned_pattern & single_bit_mask;
-    fprintf(file, "    if (bits & 0x%x) {\n", check_pattern);
+    fprintf(
+        file,
+        "/**\n"
+        " * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.\n"
+        " * SPDX-License-Identifier: Apache-2.0.\n"
+        " */\n"
+        "\n"
+        "/* WARNING: THIS FILE WAS AUTOMATICALLY GENERATED. DO NOT EDIT. */\n"
+        "/* clang-format off */\n"
+        "\n"
+        "#include <aws/common/clock.h>\n"
+        "#include <aws/compression/huffman.h>\n"
+        "\n"
+        "#include <stdio.h>\n"
+        "#include <string.h>\n"
+        "\n"
+        "struct aws_huffman_symbol_coder *%s_get_strategy_coder(size_t index);\n"
+        "const char *%s_get_strategy_name(size_t index);\n"
+        "\n"
+        "/* Decodes at least this many bytes with each strategy, keeping the fastest run */\n"
+        "enum { MIN_BYTES_DECODED = 64 * 1024 * 1024, MIN_RUNS = 10 };\n"
+        "\n",
+        name,
+        name);
 
-    huffman_node_write_decode_handle_value(node->children[1], file);
+    fprintf(
+        file,
+        "int main(int argc, char *argv[]) {\n"
+        "\n"
+        "    if (argc != 2) {\n"
+        "        fprintf(stderr, \"usage: %%s [corpus file]\\n\", argv[0]);\n"
+        "        return 1;\n"
+        "    }\n"
+        "\n"
+        "    struct aws_allocator *allocator = aws_default_allocator();\n"
+        "    aws_compression_library_init(allocator);\n"
+        "\n"
+        "    FILE *corpus_file = fopen(argv[1], \"rb\");\n"
+        "    if (!corpus_file) {\n"
+        "        fprintf(stderr, \"Failed to open file '%%s' for read.\\n\", argv[1]);\n"
+        "        return 1;\n"
+        "    }\n"
+        "    struct aws_byte_buf corpus;\n"
+        "    aws_byte_buf_init(&corpus, allocator, 4096);\n"
+        "    while (!feof(corpus_file) && !ferror(corpus_file)) {\n"
+        "        if (corpus.len == corpus.capacity) {\n"
+        "            if (aws_byte_buf_reserve(&corpus, corpus.capacity * 2)) {\n"
+        "                fprintf(stderr, \"Failed to read the corpus: %%s\\n\", aws_error_str(aws_last_error()));\n"
+        "                return 1;\n"
+        "            }\n"
+        "        }\n"
+        "        corpus.len += fread(corpus.buffer + corpus.len, 1, corpus.capacity - corpus.len, corpus_file);\n"
+        "    }\n"
+        "    fclose(corpus_file);\n"
+        "    if (corpus.len == 0) {\n"
+        "        fprintf(stderr, \"The corpus is empty\\n\");\n"
+        "        return 1;\n"
+        "    }\n"
+        "\n"
+        "    /* Every strategy shares one code, so one encoding serves them all */\n"
+        "    struct aws_huffman_encoder encoder;\n"
+        "    aws_huffman_encoder_init(&encoder, %s_get_strategy_coder(0));\n"
+        "    struct aws_byte_cursor to_encode = aws_byte_cursor_from_buf(&corpus);\n"
+        "    struct aws_byte_buf encoded;\n"
+        "    aws_byte_buf_init(&encoded, allocator, aws_huffman_get_encoded_length(&encoder, to_encode) + 1);\n"
+        "    if (aws_huffman_encode(&encoder, &to_encode, &encoded)) {\n"
+        "        fprintf(stderr, \"Failed to encode the corpus: %%s\\n\", aws_error_str(aws_last_error()));\n"
+        "        return 1;\n"
+        "    }\n"
+        "\n"
+        "    struct aws_byte_buf decoded;\n"
+        "    aws_byte_buf_init(&decoded, allocator, corpus.len);\n"
+        "\n"
+        "    size_t num_runs = MIN_BYTES_DECODED / corpus.len;\n"
+        "    if (num_runs < MIN_RUNS) {\n"
+        "        num_runs = MIN_RUNS;\n"
+        "    }\n"
+        "\n",
+        name);
 
-    fprintf(file, "    } else {\n");
+    fprintf(
+        file,
+        "    size_t fastest_strategy = 0;\n"
+        "    uint64_t fastest_ns = UINT64_MAX;\n"
+        "    for (size_t strategy = 0; %s_get_strategy_coder(strategy); ++strategy) {\n"
+        "        struct aws_huffman_decoder decoder;\n"
+        "        aws_huffman_decoder_init(&decoder, %s_get_strategy_coder(strategy));\n"
+        "\n"
+        "        uint64_t best_run_ns = UINT64_MAX;\n"
+        "        for (size_t run = 0; run < num_runs; ++run) {\n"
+        "            aws_huffman_decoder_reset(&decoder);\n"
+        "            decoded.len = 0;\n"
+        "            struct aws_byte_cursor to_decode = aws_byte_cursor_from_buf(&encoded);\n"
+        "\n"
+        "            uint64_t start = 0;\n"
+        "            uint64_t end = 0;\n"
+        "            aws_high_res_clock_get_ticks(&start);\n"
+        "            const int result = aws_huffman_decode(&decoder, &to_decode, &decoded);\n"
+        "            aws_high_res_clock_get_ticks(&end);\n"
+        "\n"
+        "            if (result || !aws_byte_buf_eq(&decoded, &corpus)) {\n"
+        "                const char *strategy_name = %s_get_strategy_name(strategy);\n"
+        "                fprintf(stderr, \"Strategy %%s decoded the corpus wrongly\\n\", strategy_name);\n"
+        "                return 1;\n"
+        "            }\n"
+        "            if (end - start < best_run_ns) {\n"
+        "                best_run_ns = end - start;\n"
+        "            }\n"
+        "        }\n"
+        "\n"
+        "        const double ns_per_byte = (double)best_run_ns / corpus.len;\n"
+        "        printf(\"%%-14s %%8.3f ns/byte\\n\", %s_get_strategy_name(strategy), ns_per_byte);\n"
+        "        if (best_run_ns < fastest_ns) {\n"
+        "            fastest_ns = best_run_ns;\n"
+        "            fastest_strategy = strategy;\n"
+        "        }\n"
+        "    }\n"
+        "\n"
+        "    /* The last line is the definition to compile the coder with */\n"
+        "    printf(\"-D%s=%%zu\\n\", fastest_strategy);\n"
+        "\n"
+        "    aws_byte_buf_clean_up(&decoded);\n"
+        "    aws_byte_buf_clean_up(&encoded);\n"
+        "    aws_byte_buf_clean_up(&corpus);\n"
+        "    aws_compression_library_clean_up();\n"
+        "    return 0;\n"
+        "}\n",
+        name,
+        name,
+        name,
+        name,
+        macro);
 
-    /* Child 0 is valid, go there */
-    huffman_node_write_decode_handle_value(node->children[0], file);
+    fclose(file);
 
-    fprintf(file, "    }\n\n");
+    return 0;
+}
 
-    /* Recursively write child nodes */
-    for (uint8_t i = 0; i < 2; ++i) {
-        struct huffman_node *child = node->children[i];
-        if (child && !child->value) {
-            huffman_node_write_decode(child, file, current_bit + 1);
+/* Mirrors struct aws_huffman_serialized_header */
+struct serialized_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t file_size;
+    uint8_t code_size;
+    uint8_t decode_entry_size;
+    uint8_t multi_symbol_entry_size;
+    uint8_t fsm_transition_size;
+    uint32_t encode_table_offset;
+    uint32_t code_lengths_offset;
+    uint32_t decode_entries_offset;
+    uint32_t num_decode_entries;
+    uint32_t multi_symbol_offset;
+    uint32_t fsm_offset;
+    uint16_t fsm_num_states;
+    uint8_t root_bits;
+    uint8_t multi_symbol_index_bits;
+};
+
+/* Mirrors struct aws_huffman_code */
+struct serialized_code {
+    uint32_t pattern;
+    uint8_t num_bits;
+};
+
+/* Mirrors AWS_HUFFMAN_SERIALIZED_VERSION */
+enum { serialized_version = 1, serialized_alignment = 8 };
+
+/* Reserves size bytes at the end of a serialized coder of *file_size bytes, and returns their offset */
+static uint32_t serialized_reserve(uint32_t *file_size, size_t size) {
+    const uint32_t offset = (*file_size + serialized_alignment - 1) / serialized_alignment * serialized_alignment;
+    *file_size = offset + (uint32_t)size;
+    return offset;
+}
+
+/* Writes the coder's tables to output_path in the format aws_huffman_mapped_coder_init() maps */
+int serialized_write(struct huffman_node *root, const struct generator_options *options, const char *output_path) {
+
+    struct decode_table table;
+    memset(&table, 0, sizeof(struct decode_table));
+    decode_table_push(&table, (size_t)1 << options->root_bits);
+    decode_table_fill(&table, root, 0, options->root_bits, options->root_bits);
+
+    const size_t num_multi_symbol_entries = options->multi_symbol_bits ? (size_t)1 << options->multi_symbol_bits : 0;
+    const size_t num_states = options->fsm ? fsm_assign_states(root, 0) : 0;
+
+    struct serialized_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "AWSHUFF", sizeof(header.magic));
+    header.version = serialized_version;
+    header.byte_order = 0x01020304;
+    header.code_size = sizeof(struct serialized_code);
+    header.decode_entry_size = sizeof(struct decode_entry);
+    header.multi_symbol_entry_size = sizeof(struct multi_symbol_entry);
+    header.fsm_transition_size = sizeof(struct fsm_transition);
+    header.root_bits = options->root_bits;
+    header.multi_symbol_index_bits = options->multi_symbol_bits;
+    header.fsm_num_states = (uint16_t)num_states;
+    header.num_decode_entries = (uint32_t)table.num_entries;
+
+    uint32_t file_size = sizeof(header);
+    header.encode_table_offset = serialized_reserve(&file_size, num_code_points * sizeof(struct serialized_code));
+    header.code_lengths_offset = serialized_reserve(&file_size, num_code_points);
+    header.decode_entries_offset = serialized_reserve(&file_size, table.num_entries * sizeof(struct decode_entry));
+    if (num_multi_symbol_entries) {
+        header.multi_symbol_offset =
+            serialized_reserve(&file_size, num_multi_symbol_entries * sizeof(struct multi_symbol_entry));
+    }
+    if (num_states) {
+        header.fsm_offset = serialized_reserve(&file_size, num_states * 16 * sizeof(struct fsm_transition));
+    }
+    header.file_size = file_size;
+
+    uint8_t *buffer = calloc(file_size, 1);
+    assert(buffer);
+    memcpy(buffer, &header, sizeof(header));
+
+    struct serialized_code *codes = (struct serialized_code *)(buffer + header.encode_table_offset);
+    uint8_t *code_lengths = buffer + header.code_lengths_offset;
+    for (size_t i = 0; i < num_code_points; ++i) {
+        codes[i].pattern = code_points[i].code.bits;
+        codes[i].num_bits = code_points[i].code.num_bits;
+        code_lengths[i] = code_points[i].code.num_bits;
+    }
+
+    memcpy(buffer + header.decode_entries_offset, table.entries, table.num_entries * sizeof(struct decode_entry));
+    free(table.entries);
+
+    struct multi_symbol_entry *multi_symbol_entries =
+        (struct multi_symbol_entry *)(buffer + header.multi_symbol_offset);
+    for (size_t index = 0; index < num_multi_symbol_entries; ++index) {
+        multi_symbol_entries[index] = multi_symbol_entry_build(root, options->multi_symbol_bits, (uint32_t)index);
+    }
+
+    if (num_states) {
+        struct huffman_node **states = calloc(num_states, sizeof(struct huffman_node *));
+        assert(states);
+        fsm_collect_states(root, states);
+
+        struct fsm_transition *transitions = (struct fsm_transition *)(buffer + header.fsm_offset);
+        for (size_t state = 0; state < num_states; ++state) {
+            for (uint8_t nibble = 0; nibble < 16; ++nibble) {
+                transitions[state * 16 + nibble] = fsm_transition_build(root, states[state], nibble);
+            }
         }
+        free(states);
+    }
+
+    FILE *file = fopen(output_path, "wb");
+    if (!file) {
+        printf("Failed to open file '%s' for write.", output_path);
+        free(buffer);
+        return 1;
+    }
+    const size_t written = fwrite(buffer, 1, file_size, file);
+    fclose(file);
+    free(buffer);
+
+    if (written != file_size) {
+        fprintf(stderr, "Failed to write '%s'\n", output_path);
+        return 1;
     }
+    return 0;
 }
 
 int main(int argc, char *argv[]) {
 
-    if (argc != 4) {
+    struct generator_options options = {
+        .decoder = DECODER_MODE_TREE,
+        .root_bits = 9,
+        .max_code_bits = 30,
+    };
+
+    /* Options may appear anywhere, everything else is positional */
+    const char *positional[3];
+    int num_positional = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], "--", 2) == 0) {
+            if (parse_option(argv[i], &options)) {
+                return 1;
+            }
+        } else if (num_positional < 3) {
+            positional[num_positional++] = argv[i];
+        } else {
+            num_positional = -1;
+            break;
+        }
+    }
+
+    /* A report or serialized tables alone need only the input */
+    if (num_positional != 3 && !((options.report || options.serialize) && num_positional == 1)) {
         fprintf(
             stderr,
-            "generator expects 3 arguments: [input file] [output file] "
+            "generator expects 3 arguments: [options] [input file] [output file] "
             "[encoding name]\n"
             "A function of the following signature will be exported:\n"
-            "struct aws_huffman_symbol_coder *[encoding name]_get_coder()\n");
+            "struct aws_huffman_symbol_coder *[encoding name]_get_coder()\n"
+            "Options:\n"
+            "  --decoder=tree|table|canonical\n"
+            "                        How decode_symbol finds codes: a bit-by-bit branch tree (default),\n"
+            "                        a lookup table with sub-tables for long codes, or, for canonical\n"
+            "                        codes only, the first code and symbols of each length\n"
+            "  --root-bits=N         Bits used to index the primary lookup table, 8-11 (default 9)\n"
+            "  --multi-symbol-bits=N Also emit a table indexed by N bits, 12-16, that decodes several\n"
+            "                        short codes per lookup\n"
+            "  --fsm                 Also emit a state machine that decodes 4 bits per step.\n"
+            "                        Requires every code to be at least 4 bits long\n"
+            "  --pair-symbols=N      Also emit an encode table for pairs of symbols. 256 covers every pair\n"
+            "                        (512KiB), 2-254 only pairs of the N symbols with the shortest codes\n"
+            "  --specialize          Also export [encoding name]_encode and [encoding name]_decode,\n"
+            "                        which encode or decode a whole string with this code alone\n"
+            "  --from-frequencies    The input file holds lines of \"[symbol] [count]\" instead of a code.\n"
+            "                        Builds the optimal canonical code from the counts, and gives no code\n"
+            "                        to symbols that aren't counted\n"
+            "  --max-code-bits=N     The longest code --from-frequencies may build, 1-32 (default 30)\n"
+            "  --write-def=PATH      Also write the code built by --from-frequencies to PATH, as\n"
+            "                        HUFFMAN_CODE lines that may be used as input later\n"
+            "  --report              Print the code's completeness and lengths, and the size of each\n"
+            "                        decoder's tables. The output file and name may then be omitted\n"
+            "  --corpus=PATH         Also report the bits per symbol the code takes to encode PATH\n"
+            "  --autotune            Emit every decoder the code allows instead of one, exported by\n"
+            "                        [encoding name]_get_strategy_coder(index). [encoding name]_get_coder()\n"
+            "                        returns the one picked by defining [ENCODING NAME]_STRATEGY\n"
+            "  --benchmark=PATH      With --autotune, also write a program to PATH that times each\n"
+            "                        decoder on a corpus and prints the definition picking the fastest\n"
+            "  --serialize=PATH      Also write the encode table, the lookup table and, if asked for,\n"
+            "                        the multi-symbol table and state machine to PATH, in the binary\n"
+            "                        format aws_huffman_mapped_coder_init() loads. The output file\n"
+            "                        and name may then be omitted\n");
         return 1;
     }
 
-    const char *input_file = argv[1];
-    const char *output_file = argv[2];
-    const char *decoder_name = argv[3];
+    const char *input_file = positional[0];
+    const char *output_file = num_positional == 3 ? positional[1] : NULL;
+    const char *decoder_name = num_positional == 3 ? positional[2] : NULL;
 
-    if (read_code_points(input_file)) {
+    if (options.from_frequencies) {
+        uint64_t frequencies[num_code_points];
+        uint8_t code_lengths[num_code_points];
+        if (read_frequencies(input_file, frequencies) ||
+            build_code_lengths(frequencies, options.max_code_bits, code_lengths)) {
+            return 1;
+        }
+        assign_canonical_codes(code_lengths);
+        if (options.write_def && def_write(options.write_def)) {
+            return 1;
+        }
+    } else if (options.write_def) {
+        fprintf(stderr, "--write-def requires --from-frequencies\n");
+        return 1;
+    } else if (read_code_points(input_file)) {
         return 1;
     }
 
@@ -277,6 +2002,45 @@ int main(int argc, char *argv[]) {
         }
     }
 
+    /* A transition completes at most one symbol, which only holds if every code is at least a nibble long */
+    const uint8_t min_bits = code_points_min_bits();
+    if (options.fsm && min_bits < 4) {
+        fprintf(stderr, "--fsm requires every code to be at least 4 bits, but the shortest is %u\n", min_bits);
+        huffman_node_clean_up(&tree_root);
+        return 1;
+    }
+
+    if (options.report && report_write(&tree_root, options.corpus, stdout)) {
+        huffman_node_clean_up(&tree_root);
+        return 1;
+    }
+
+    if (options.serialize && serialized_write(&tree_root, &options, options.serialize)) {
+        huffman_node_clean_up(&tree_root);
+        return 1;
+    }
+
+    if (!output_file) {
+        huffman_node_clean_up(&tree_root);
+        return 0;
+    }
+
+    if (options.benchmark && !options.autotune) {
+        fprintf(stderr, "--benchmark requires --autotune\n");
+        huffman_node_clean_up(&tree_root);
+        return 1;
+    }
+
+    struct canonical_table canonical;
+    if (options.decoder == DECODER_MODE_CANONICAL && canonical_table_build(&canonical)) {
+        fprintf(stderr, "The code in '%s' is not canonical, use another decoder\n", input_file);
+        huffman_node_clean_up(&tree_root);
+        return 1;
+    }
+
+    /* Autotuning includes the canonical decoder where the code allows it */
+    const int autotune_canonical = options.autotune && canonical_table_build(&canonical) == 0;
+
     /* Open the file */
     FILE *file = fopen(output_file, "w");
     if (!file) {
@@ -296,8 +2060,15 @@ int main(int argc, char *argv[]) {
         "/* clang-format off */\n"
         "\n"
         "#include <aws/compression/huffman.h>\n"
-        "\n"
-        "static struct aws_huffman_code code_points[] = {\n");
+        "\n");
+
+    if (options.decoder == DECODER_MODE_CANONICAL || autotune_canonical) {
+        fprintf(file, "#include <aws/common/math.h>\n\n");
+    }
+
+    exports_write(decoder_name, &options, file);
+
+    fprintf(file, "static const struct aws_huffman_code code_points[] = {\n");
 
     for (size_t i = 0; i < num_code_points; ++i) {
         struct huffman_code_point *cp = &code_points[i];
@@ -320,29 +2091,95 @@ int main(int argc, char *argv[]) {
         "    return code_points[symbol];\n"
         "}\n"
         "\n"
-        "/* NOLINTNEXTLINE(readability-function-size) */\n"
-        "static uint8_t decode_symbol(uint32_t bits, uint8_t *symbol, void "
-        "*userdata) {\n"
-        "    (void)userdata;\n\n");
+        "static const uint8_t code_lengths[] = {\n");
 
-    /* Traverse the tree */
-    huffman_node_write_decode(&tree_root, file, 0);
+    for (size_t i = 0; i < num_code_points; ++i) {
+        fprintf(
+            file,
+            "%s%2u,%s",
+            i % 16 == 0 ? "    " : " ",
+            code_points[i].code.num_bits,
+            i % 16 == 15 ? "\n" : "");
+    }
+
+    fprintf(file, "};\n\n");
 
-    /* Write the function footer & encode header */
+    if (options.autotune) {
+        autotune_write(&tree_root, autotune_canonical ? &canonical : NULL, &options, decoder_name, file);
+        fclose(file);
+        huffman_node_clean_up(&tree_root);
+        return options.benchmark ? benchmark_write(decoder_name, options.benchmark) : 0;
+    }
+
+    if (options.decoder == DECODER_MODE_TABLE) {
+        struct decode_table table;
+        memset(&table, 0, sizeof(struct decode_table));
+
+        decode_table_push(&table, (size_t)1 << options.root_bits);
+        decode_table_fill(&table, &tree_root, 0, options.root_bits, options.root_bits);
+        decode_table_write(&table, options.root_bits, "", file);
+
+        free(table.entries);
+    } else if (options.decoder == DECODER_MODE_CANONICAL) {
+        canonical_table_write(&canonical, "", file);
+    } else {
+        tree_decode_write(&tree_root, "", file);
+    }
+
+    fprintf(file, "\n");
+
+    if (options.multi_symbol_bits) {
+        multi_symbol_table_write(&tree_root, options.multi_symbol_bits, file);
+    }
+
+    if (options.fsm) {
+        fsm_table_write(&tree_root, file);
+    }
+
+    if (options.pair_symbols) {
+        pair_table_write(options.pair_symbols, file);
+    }
+
+    if (options.specialize) {
+        specialized_write(decoder_name, "", file);
+    }
+
+    /* Write the coder */
     fprintf(
         file,
-        "}\n"
-        "\n"
         "struct aws_huffman_symbol_coder *%s_get_coder(void) {\n"
         "\n"
         "    static struct aws_huffman_symbol_coder coder = {\n"
         "        .encode = encode_symbol,\n"
         "        .decode = decode_symbol,\n"
         "        .userdata = NULL,\n"
+        "        .encode_table = code_points,\n"
+        "        .code_lengths = code_lengths,\n",
+        decoder_name);
+
+    if (options.pair_symbols) {
+        fprintf(file, "        .pair_table = &pair_table,\n");
+    }
+
+    if (options.decoder == DECODER_MODE_TABLE) {
+        fprintf(file, "        .decode_table = &decode_table,\n");
+    } else if (options.decoder == DECODER_MODE_CANONICAL) {
+        fprintf(file, "        .canonical_table = &canonical_table,\n");
+    }
+
+    if (options.multi_symbol_bits) {
+        fprintf(file, "        .multi_symbol_table = &multi_symbol_table,\n");
+    }
+
+    if (options.fsm) {
+        fprintf(file, "        .fsm_table = &fsm_table,\n");
+    }
+
+    fprintf(
+        file,
         "    };\n"
         "    return &coder;\n"
-        "}\n",
-        decoder_name);
+        "}\n");
 
     fclose(file);
 
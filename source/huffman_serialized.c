@@ -0,0 +1,300 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/compression/huffman.h>
+
+#include <string.h>
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <errno.h>
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+enum { SERIALIZED_BYTE_ORDER = 0x01020304, SERIALIZED_ALIGNMENT = 8 };
+
+/* Finds the section of num_items items of item_size bytes at offset, or NULL if it's misaligned or out of bounds */
+static const void *serialized_section(
+    struct aws_byte_cursor serialized,
+    uint32_t offset,
+    size_t num_items,
+    size_t item_size) {
+
+    const uint64_t size = (uint64_t)num_items * item_size;
+    if (offset % SERIALIZED_ALIGNMENT != 0 || offset < sizeof(struct aws_huffman_serialized_header) ||
+        offset > serialized.len || size > serialized.len - offset) {
+        return NULL;
+    }
+    return serialized.ptr + offset;
+}
+
+/**
+ * Checks every entry of the table at offset, and of the sub-tables it links to, which must be laid out in the
+ * order they're found depth first, starting at *next_sub_table. Each entry is visited once, and following links
+ * can never consume more than 32 bits, so decoding stays within the table whatever the input.
+ */
+static bool serialized_decode_table_is_valid(
+    const struct aws_huffman_decode_entry *entries,
+    size_t num_entries,
+    size_t offset,
+    uint8_t table_bits,
+    uint8_t consumed,
+    size_t *next_sub_table) {
+
+    for (size_t index = 0; index < ((size_t)1 << table_bits); ++index) {
+        const struct aws_huffman_decode_entry *entry = &entries[offset + index];
+        switch (entry->type) {
+            case AWS_HUFFMAN_DECODE_ENTRY_INVALID:
+                break;
+            case AWS_HUFFMAN_DECODE_ENTRY_SYMBOL:
+                if (entry->num_bits == 0 || entry->num_bits > consumed || entry->value > UINT8_MAX) {
+                    return false;
+                }
+                break;
+            case AWS_HUFFMAN_DECODE_ENTRY_LINK: {
+                const size_t sub_table_size = (size_t)1 << entry->num_bits;
+                if (entry->num_bits == 0 || entry->num_bits > 32 - consumed || entry->value != *next_sub_table ||
+                    sub_table_size > num_entries - *next_sub_table) {
+                    return false;
+                }
+                *next_sub_table += sub_table_size;
+                if (!serialized_decode_table_is_valid(
+                        entries,
+                        num_entries,
+                        entry->value,
+                        entry->num_bits,
+                        (uint8_t)(consumed + entry->num_bits),
+                        next_sub_table)) {
+                    return false;
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
+int aws_huffman_mapped_coder_init_from_memory(
+    struct aws_huffman_mapped_coder *coder,
+    struct aws_byte_cursor serialized) {
+
+    AWS_PRECONDITION(coder);
+    AWS_PRECONDITION(aws_byte_cursor_is_valid(&serialized));
+
+    AWS_ZERO_STRUCT(*coder);
+
+    if (serialized.len < sizeof(struct aws_huffman_serialized_header) ||
+        (uintptr_t)serialized.ptr % SERIALIZED_ALIGNMENT != 0) {
+        return aws_raise_error(AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER);
+    }
+
+    const struct aws_huffman_serialized_header *header = (const struct aws_huffman_serialized_header *)serialized.ptr;
+    if (memcmp(header->magic, AWS_HUFFMAN_SERIALIZED_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != AWS_HUFFMAN_SERIALIZED_VERSION || header->byte_order != SERIALIZED_BYTE_ORDER ||
+        header->file_size != serialized.len || header->code_size != sizeof(struct aws_huffman_code) ||
+        header->decode_entry_size != sizeof(struct aws_huffman_decode_entry) ||
+        header->multi_symbol_entry_size != sizeof(struct aws_huffman_multi_symbol_entry) ||
+        header->fsm_transition_size != sizeof(struct aws_huffman_fsm_transition)) {
+        return aws_raise_error(AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER);
+    }
+
+    /* Encoding */
+    const struct aws_huffman_code *encode_table =
+        serialized_section(serialized, header->encode_table_offset, UINT8_MAX + 1, sizeof(struct aws_huffman_code));
+    const uint8_t *code_lengths = serialized_section(serialized, header->code_lengths_offset, UINT8_MAX + 1, 1);
+    if (!encode_table || !code_lengths) {
+        return aws_raise_error(AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER);
+    }
+    for (size_t symbol = 0; symbol <= UINT8_MAX; ++symbol) {
+        const struct aws_huffman_code code = encode_table[symbol];
+        if (code.num_bits > 32 || code_lengths[symbol] != code.num_bits ||
+            (code.num_bits < 32 && code.pattern >> code.num_bits)) {
+            return aws_raise_error(AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER);
+        }
+    }
+
+    /* Decoding, which every serialized coder supports through its decode table */
+    if (header->root_bits == 0 || header->root_bits > 16 || header->num_decode_entries < (1u << header->root_bits)) {
+        return aws_raise_error(AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER);
+    }
+    const struct aws_huffman_decode_entry *decode_entries = serialized_section(
+        serialized, header->decode_entries_offset, header->num_decode_entries, sizeof(struct aws_huffman_decode_entry));
+    size_t next_sub_table = (size_t)1 << header->root_bits;
+    if (!decode_entries ||
+        !serialized_decode_table_is_valid(
+            decode_entries, header->num_decode_entries, 0, header->root_bits, header->root_bits, &next_sub_table) ||
+        next_sub_table != header->num_decode_entries) {
+        return aws_raise_error(AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER);
+    }
+
+    coder->decode_table.entries = decode_entries;
+    coder->decode_table.root_bits = header->root_bits;
+
+    coder->coder.encode_table = encode_table;
+    coder->coder.code_lengths = code_lengths;
+    coder->coder.decode_table = &coder->decode_table;
+
+    if (header->multi_symbol_offset) {
+        const uint8_t index_bits = header->multi_symbol_index_bits;
+        const struct aws_huffman_multi_symbol_entry *entries =
+            index_bits == 0 || index_bits > 16
+                ? NULL
+                : serialized_section(
+                      serialized,
+                      header->multi_symbol_offset,
+                      (size_t)1 << index_bits,
+                      sizeof(struct aws_huffman_multi_symbol_entry));
+        if (!entries) {
+            return aws_raise_error(AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER);
+        }
+        for (size_t i = 0; i < ((size_t)1 << index_bits); ++i) {
+            /* Every code takes at least a bit, so an entry never produces symbols without consuming input */
+            if (entries[i].num_symbols > AWS_HUFFMAN_MULTI_SYMBOL_MAX || entries[i].num_bits > index_bits ||
+                entries[i].num_bits < entries[i].num_symbols) {
+                return aws_raise_error(AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER);
+            }
+        }
+
+        coder->multi_symbol_table.entries = entries;
+        coder->multi_symbol_table.index_bits = index_bits;
+        coder->coder.multi_symbol_table = &coder->multi_symbol_table;
+    }
+
+    if (header->fsm_offset) {
+        const uint16_t num_states = header->fsm_num_states;
+        const struct aws_huffman_fsm_transition *transitions =
+            num_states == 0 ? NULL
+                            : serialized_section(
+                                  serialized,
+                                  header->fsm_offset,
+                                  (size_t)num_states * 16,
+                                  sizeof(struct aws_huffman_fsm_transition));
+        if (!transitions) {
+            return aws_raise_error(AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER);
+        }
+        for (size_t i = 0; i < (size_t)num_states * 16; ++i) {
+            if (transitions[i].next_state >= num_states) {
+                return aws_raise_error(AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER);
+            }
+        }
+
+        coder->fsm_table.transitions = transitions;
+        coder->fsm_table.num_states = num_states;
+        coder->coder.fsm_table = &coder->fsm_table;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+#ifdef _WIN32
+
+static int map_file(const char *path, void **out_mapping, size_t *out_size) {
+
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return aws_raise_error(AWS_ERROR_FILE_INVALID_PATH);
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart < (LONGLONG)sizeof(struct aws_huffman_serialized_header) ||
+        (uint64_t)size.QuadPart > SIZE_MAX) {
+        CloseHandle(file);
+        return aws_raise_error(AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER);
+    }
+
+    /* The view keeps the mapping open once both handles are closed */
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    void *view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (mapping) {
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+    if (!view) {
+        return aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
+    }
+
+    *out_mapping = view;
+    *out_size = (size_t)size.QuadPart;
+    return AWS_OP_SUCCESS;
+}
+
+static void unmap_file(void *mapping, size_t size) {
+    (void)size;
+    UnmapViewOfFile(mapping);
+}
+
+#else
+
+static int map_file(const char *path, void **out_mapping, size_t *out_size) {
+
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return aws_raise_error(errno == ENOENT ? AWS_ERROR_FILE_INVALID_PATH : AWS_ERROR_SYS_CALL_FAILURE);
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size < (off_t)sizeof(struct aws_huffman_serialized_header) ||
+        (uint64_t)file_stat.st_size > SIZE_MAX) {
+        close(fd);
+        return aws_raise_error(AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER);
+    }
+
+    /* The mapping stays valid once the file is closed */
+    void *mapping = mmap(NULL, (size_t)file_stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return aws_raise_error(AWS_ERROR_SYS_CALL_FAILURE);
+    }
+
+    *out_mapping = mapping;
+    *out_size = (size_t)file_stat.st_size;
+    return AWS_OP_SUCCESS;
+}
+
+static void unmap_file(void *mapping, size_t size) {
+    munmap(mapping, size);
+}
+
+#endif /* _WIN32 */
+
+int aws_huffman_mapped_coder_init(struct aws_huffman_mapped_coder *coder, const char *path) {
+
+    AWS_PRECONDITION(coder);
+    AWS_PRECONDITION(path);
+
+    AWS_ZERO_STRUCT(*coder);
+
+    void *mapping = NULL;
+    size_t size = 0;
+    if (map_file(path, &mapping, &size)) {
+        return AWS_OP_ERR;
+    }
+
+    if (aws_huffman_mapped_coder_init_from_memory(coder, aws_byte_cursor_from_array(mapping, size))) {
+        unmap_file(mapping, size);
+        return AWS_OP_ERR;
+    }
+
+    coder->mapping = mapping;
+    coder->mapping_size = size;
+    return AWS_OP_SUCCESS;
+}
+
+void aws_huffman_mapped_coder_clean_up(struct aws_huffman_mapped_coder *coder) {
+
+    AWS_PRECONDITION(coder);
+
+    if (coder->mapping) {
+        unmap_file(coder->mapping, coder->mapping_size);
+    }
+    AWS_ZERO_STRUCT(*coder);
+}
@@ -8,8 +8,19 @@
 
 #include <aws/compression/huffman.h>
 
-/* Exported by generated file */
+/* Exported by generated files */
 struct aws_huffman_symbol_coder *test_get_coder(void);
+struct aws_huffman_symbol_coder *test_table_get_coder(void);
+struct aws_huffman_symbol_coder *test_canonical_get_coder(void);
+struct aws_huffman_symbol_coder *test_multi_symbol_get_coder(void);
+struct aws_huffman_symbol_coder *test_fsm_get_coder(void);
+struct aws_huffman_symbol_coder *test_autotune_get_coder(void);
+struct aws_huffman_symbol_coder *test_autotune_get_strategy_coder(size_t index);
+const char *test_autotune_get_strategy_name(size_t index);
+int test_table_encode(struct aws_byte_cursor *to_encode, struct aws_byte_buf *output);
+int test_table_decode(struct aws_byte_cursor *to_decode, struct aws_byte_buf *output);
+int test_canonical_encode(struct aws_byte_cursor *to_encode, struct aws_byte_buf *output);
+int test_canonical_decode(struct aws_byte_cursor *to_decode, struct aws_byte_buf *output);
 
 static struct huffman_test_code_point s_code_points[] = {
 #include "test_huffman_static_table.def"
@@ -39,6 +50,16 @@ enum { ENCODED_CODES_LEN = sizeof(s_encoded_codes) };
 static const size_t s_step_sizes[] = {1, 2, 4, 8, 16, 32, 64, 128};
 enum { NUM_STEP_SIZES = sizeof(s_step_sizes) / sizeof(s_step_sizes[0]) };
 
+/* The generated test coder with its tables cleared, so that it can only be used through its callbacks */
+static struct aws_huffman_symbol_coder *s_callback_get_coder(void) {
+    static struct aws_huffman_symbol_coder coder;
+    coder = *test_get_coder();
+    coder.encode_table = NULL;
+    coder.code_lengths = NULL;
+    coder.decode_table = NULL;
+    return &coder;
+}
+
 AWS_TEST_CASE(huffman_symbol_encoder, test_huffman_symbol_encoder)
 static int test_huffman_symbol_encoder(struct aws_allocator *allocator, void *ctx) {
     (void)allocator;
@@ -114,6 +135,239 @@ static int test_huffman_encoder_all_code_points(struct aws_allocator *allocator,
     return AWS_OP_SUCCESS;
 }
 
+AWS_TEST_CASE(huffman_table_encoder, test_huffman_table_encoder)
+static int test_huffman_table_encoder(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test encoding with a coder that exposes its codes as a table */
+
+    struct aws_huffman_symbol_coder *coder = test_table_get_coder();
+    ASSERT_NOT_NULL(coder->encode_table);
+
+    for (size_t i = 0; i < NUM_CODE_POINTS; ++i) {
+        struct huffman_test_code_point *value = &s_code_points[i];
+
+        ASSERT_UINT_EQUALS(value->code.pattern, coder->encode_table[value->symbol].pattern);
+        ASSERT_UINT_EQUALS(value->code.num_bits, coder->encode_table[value->symbol].num_bits);
+    }
+
+    struct aws_huffman_encoder encoder;
+    aws_huffman_encoder_init(&encoder, coder);
+
+    uint8_t output_buffer[ENCODED_CODES_LEN];
+    struct aws_byte_buf output_buf = aws_byte_buf_from_empty_array(output_buffer, ENCODED_CODES_LEN);
+
+    struct aws_byte_cursor to_encode = aws_byte_cursor_from_array(s_all_codes, ALL_CODES_LEN);
+    ASSERT_UINT_EQUALS(ENCODED_CODES_LEN, aws_huffman_get_encoded_length(&encoder, to_encode));
+    ASSERT_SUCCESS(aws_huffman_encode(&encoder, &to_encode, &output_buf));
+    ASSERT_BIN_ARRAYS_EQUALS(s_encoded_codes, ENCODED_CODES_LEN, output_buf.buffer, output_buf.len);
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_pair_table_encoder, test_huffman_pair_table_encoder)
+static int test_huffman_pair_table_encoder(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    /* Test encoding two symbols per lookup, with the generated compact pair table and a full one built here */
+
+    struct aws_huffman_symbol_coder *table_coder = test_table_get_coder();
+    const struct aws_huffman_pair_table *compact = table_coder->pair_table;
+    ASSERT_NOT_NULL(compact);
+    ASSERT_NOT_NULL(compact->ranks);
+
+    uint64_t *full_entries = aws_mem_calloc(allocator, 256 * 256, sizeof(uint64_t));
+    ASSERT_NOT_NULL(full_entries);
+
+    for (size_t first = 0; first < NUM_CODE_POINTS; ++first) {
+        for (size_t second = 0; second < NUM_CODE_POINTS; ++second) {
+            struct aws_huffman_code first_code = s_code_points[first].code;
+            struct aws_huffman_code second_code = s_code_points[second].code;
+            const uint8_t num_bits = first_code.num_bits + second_code.num_bits;
+            if (num_bits > AWS_HUFFMAN_PAIR_MAX_BITS) {
+                continue;
+            }
+
+            const uint64_t codes = (uint64_t)first_code.pattern << second_code.num_bits | second_code.pattern;
+            const uint64_t entry = codes << (64 - num_bits) | num_bits;
+            full_entries[s_code_points[first].symbol << 8 | s_code_points[second].symbol] = entry;
+
+            /* The compact table holds the same entries, for the symbols it ranks */
+            const uint8_t first_rank = compact->ranks[s_code_points[first].symbol];
+            const uint8_t second_rank = compact->ranks[s_code_points[second].symbol];
+            if (first_rank != AWS_HUFFMAN_PAIR_UNRANKED && second_rank != AWS_HUFFMAN_PAIR_UNRANKED) {
+                ASSERT_UINT_EQUALS(entry, compact->entries[first_rank * compact->num_ranked + second_rank]);
+            }
+        }
+    }
+
+    struct aws_huffman_pair_table full = {.entries = full_entries};
+    struct aws_huffman_symbol_coder full_coder = *table_coder;
+    full_coder.pair_table = &full;
+
+    struct aws_huffman_symbol_coder *coders[] = {table_coder, &full_coder};
+    for (size_t c = 0; c < AWS_ARRAY_SIZE(coders); ++c) {
+        struct aws_huffman_encoder encoder;
+        aws_huffman_encoder_init(&encoder, coders[c]);
+
+        for (size_t step_size = 1; step_size <= ENCODED_CODES_LEN; ++step_size) {
+            uint8_t output_buffer[ENCODED_CODES_LEN];
+            struct aws_byte_buf output_buf = aws_byte_buf_from_empty_array(output_buffer, 0);
+            struct aws_byte_cursor to_encode = aws_byte_cursor_from_array(s_all_codes, ALL_CODES_LEN);
+
+            aws_huffman_encoder_reset(&encoder);
+            while (aws_huffman_encode(&encoder, &to_encode, &output_buf)) {
+                ASSERT_UINT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+                aws_reset_error();
+                ASSERT_TRUE(output_buf.capacity < ENCODED_CODES_LEN);
+                output_buf.capacity = aws_min_size(output_buf.capacity + step_size, ENCODED_CODES_LEN);
+            }
+
+            ASSERT_BIN_ARRAYS_EQUALS(s_encoded_codes, ENCODED_CODES_LEN, output_buf.buffer, output_buf.len);
+        }
+    }
+
+    aws_mem_release(allocator, full_entries);
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_encoded_length, test_huffman_encoded_length)
+static int test_huffman_encoded_length(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test that summing code_lengths gives the same length as asking the coder, for every length of input */
+
+    struct aws_huffman_symbol_coder *coder = test_table_get_coder();
+    ASSERT_NOT_NULL(coder->code_lengths);
+
+    for (size_t i = 0; i < NUM_CODE_POINTS; ++i) {
+        struct huffman_test_code_point *value = &s_code_points[i];
+        ASSERT_UINT_EQUALS(value->code.num_bits, coder->code_lengths[value->symbol]);
+    }
+
+    struct aws_huffman_encoder encoder;
+    aws_huffman_encoder_init(&encoder, coder);
+    struct aws_huffman_encoder callback_encoder;
+    aws_huffman_encoder_init(&callback_encoder, s_callback_get_coder());
+
+    for (size_t len = 0; len <= ALL_CODES_LEN; ++len) {
+        struct aws_byte_cursor to_encode = aws_byte_cursor_from_array(s_all_codes, len);
+        ASSERT_UINT_EQUALS(
+            aws_huffman_get_encoded_length(&callback_encoder, to_encode),
+            aws_huffman_get_encoded_length(&encoder, to_encode));
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_encoded_length_limited, test_huffman_encoded_length_limited)
+static int test_huffman_encoded_length_limited(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test that the length is reported up to the limit, and the sentinel past it, whatever the coder offers */
+
+    struct aws_huffman_symbol_coder *coders[] = {s_callback_get_coder(), test_table_get_coder()};
+
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(coders); ++i) {
+        struct aws_huffman_encoder encoder;
+        aws_huffman_encoder_init(&encoder, coders[i]);
+
+        struct aws_byte_cursor to_encode = aws_byte_cursor_from_array(s_all_codes, ALL_CODES_LEN);
+        ASSERT_UINT_EQUALS(
+            ENCODED_CODES_LEN, aws_huffman_get_encoded_length_limited(&encoder, to_encode, ENCODED_CODES_LEN));
+        ASSERT_UINT_EQUALS(ENCODED_CODES_LEN, aws_huffman_get_encoded_length_limited(&encoder, to_encode, SIZE_MAX));
+        ASSERT_UINT_EQUALS(
+            AWS_HUFFMAN_ENCODED_LENGTH_EXCEEDED,
+            aws_huffman_get_encoded_length_limited(&encoder, to_encode, ENCODED_CODES_LEN - 1));
+        ASSERT_UINT_EQUALS(
+            AWS_HUFFMAN_ENCODED_LENGTH_EXCEEDED, aws_huffman_get_encoded_length_limited(&encoder, to_encode, 0));
+
+        to_encode.len = 0;
+        ASSERT_UINT_EQUALS(0, aws_huffman_get_encoded_length_limited(&encoder, to_encode, 0));
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_build_code_lengths, test_huffman_build_code_lengths)
+static int test_huffman_build_code_lengths(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    /* Test building length-limited codes from frequencies */
+
+    uint64_t frequencies[256];
+    uint8_t code_lengths[256];
+    struct aws_huffman_code codes[256];
+
+    /* Unlimited, these weights give a code of lengths 4, 4, 3, 2, 1. At 3 bits, the best is 3, 3, 3, 3, 1. */
+    AWS_ZERO_ARRAY(frequencies);
+    frequencies['a'] = 1;
+    frequencies['b'] = 1;
+    frequencies['c'] = 2;
+    frequencies['d'] = 4;
+    frequencies['e'] = 8;
+
+    ASSERT_SUCCESS(aws_huffman_build_code_lengths(allocator, frequencies, 4, code_lengths));
+    const uint8_t expected_4_bits[] = {4, 4, 3, 2, 1};
+    ASSERT_BIN_ARRAYS_EQUALS(expected_4_bits, sizeof(expected_4_bits), &code_lengths['a'], 5);
+    ASSERT_UINT_EQUALS(0, code_lengths['f']);
+
+    ASSERT_SUCCESS(aws_huffman_build_code_lengths(allocator, frequencies, 3, code_lengths));
+    const uint8_t expected_3_bits[] = {3, 3, 3, 3, 1};
+    ASSERT_BIN_ARRAYS_EQUALS(expected_3_bits, sizeof(expected_3_bits), &code_lengths['a'], 5);
+
+    /* Codes of the same length are consecutive, in order of symbol */
+    aws_huffman_build_canonical_codes(code_lengths, codes);
+    ASSERT_UINT_EQUALS(0x0, codes['e'].pattern);
+    ASSERT_UINT_EQUALS(0x4, codes['a'].pattern);
+    ASSERT_UINT_EQUALS(0x5, codes['b'].pattern);
+    ASSERT_UINT_EQUALS(0x6, codes['c'].pattern);
+    ASSERT_UINT_EQUALS(0x7, codes['d'].pattern);
+    ASSERT_UINT_EQUALS(0, codes['f'].num_bits);
+
+    /* 5 symbols don't fit in 2 bits */
+    ASSERT_FAILS(aws_huffman_build_code_lengths(allocator, frequencies, 2, code_lengths));
+    ASSERT_UINT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+    aws_reset_error();
+
+    /* Every symbol, weighted towards the test string */
+    for (size_t i = 0; i < 256; ++i) {
+        frequencies[i] = 1;
+    }
+    for (size_t i = 0; i < ALL_CODES_LEN; ++i) {
+        frequencies[(uint8_t)s_all_codes[i]] += 1000 + i * i;
+    }
+
+    uint64_t unlimited_cost = 0;
+    ASSERT_SUCCESS(aws_huffman_build_code_lengths(allocator, frequencies, 32, code_lengths));
+    for (size_t i = 0; i < 256; ++i) {
+        unlimited_cost += frequencies[i] * code_lengths[i];
+    }
+
+    ASSERT_SUCCESS(aws_huffman_build_code_lengths(allocator, frequencies, 9, code_lengths));
+    uint64_t limited_cost = 0;
+    uint64_t kraft_sum = 0;
+    for (size_t i = 0; i < 256; ++i) {
+        ASSERT_TRUE(code_lengths[i] >= 1 && code_lengths[i] <= 9);
+        limited_cost += frequencies[i] * code_lengths[i];
+        kraft_sum += (uint64_t)1 << (9 - code_lengths[i]);
+    }
+    ASSERT_UINT_EQUALS(1 << 9, kraft_sum);
+    ASSERT_TRUE(limited_cost >= unlimited_cost);
+
+    /* No code is a prefix of another */
+    aws_huffman_build_canonical_codes(code_lengths, codes);
+    for (size_t i = 0; i < 256; ++i) {
+        for (size_t j = 0; j < 256; ++j) {
+            if (i != j && codes[i].num_bits <= codes[j].num_bits) {
+                const uint32_t prefix = codes[j].pattern >> (codes[j].num_bits - codes[i].num_bits);
+                ASSERT_FALSE(prefix == codes[i].pattern);
+            }
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
 AWS_TEST_CASE(huffman_encoder_partial_output, test_huffman_encoder_partial_output)
 static int test_huffman_encoder_partial_output(struct aws_allocator *allocator, void *ctx) {
     (void)allocator;
@@ -164,6 +418,354 @@ static int test_huffman_encoder_partial_output(struct aws_allocator *allocator,
     return AWS_OP_SUCCESS;
 }
 
+AWS_TEST_CASE(huffman_encoder_partial_output_overflow, test_huffman_encoder_partial_output_overflow)
+static int test_huffman_encoder_partial_output_overflow(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test that whenever the output fills up, every bit of the symbols read so far has been written,
+     * except for the end of the last code, which waits in overflow_bits */
+
+    struct aws_huffman_encoder encoder;
+    aws_huffman_encoder_init(&encoder, test_table_get_coder());
+
+    uint8_t output_buffer[ENCODED_CODES_LEN];
+
+    for (size_t step_size = 1; step_size <= 24; ++step_size) {
+
+        aws_huffman_encoder_reset(&encoder);
+
+        struct aws_byte_cursor to_encode = aws_byte_cursor_from_array(s_all_codes, ALL_CODES_LEN);
+        struct aws_byte_buf output_buf = aws_byte_buf_from_empty_array(output_buffer, (size_t)-1);
+        output_buf.capacity = 0;
+        AWS_ZERO_ARRAY(output_buffer);
+
+        int result = AWS_OP_ERR;
+        while (result != AWS_OP_SUCCESS) {
+            output_buf.capacity = aws_min_size(output_buf.capacity + step_size, ENCODED_CODES_LEN);
+
+            result = aws_huffman_encode(&encoder, &to_encode, &output_buf);
+            if (result != AWS_OP_SUCCESS) {
+                ASSERT_UINT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+                aws_reset_error();
+
+                ASSERT_UINT_EQUALS(output_buf.capacity, output_buf.len);
+
+                size_t read_bits = 0;
+                for (size_t i = 0; i < ALL_CODES_LEN - to_encode.len; ++i) {
+                    struct huffman_test_code_point *value = &s_code_points[(uint8_t)s_all_codes[i]];
+                    ASSERT_UINT_EQUALS((uint8_t)s_all_codes[i], value->symbol);
+                    read_bits += value->code.num_bits;
+                }
+                ASSERT_UINT_EQUALS(read_bits, output_buf.len * 8 + encoder.overflow_bits.num_bits);
+            }
+        }
+
+        ASSERT_BIN_ARRAYS_EQUALS(s_encoded_codes, ENCODED_CODES_LEN, output_buf.buffer, output_buf.len);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_encode_if_smaller, test_huffman_encode_if_smaller)
+static int test_huffman_encode_if_smaller(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test that the shorter of the Huffman and raw forms is written */
+
+    struct aws_huffman_encoder encoder;
+    aws_huffman_encoder_init(&encoder, test_table_get_coder());
+
+    uint8_t output_buffer[URL_STRING_LEN + 8];
+    struct aws_byte_buf output_buf = aws_byte_buf_from_empty_array(output_buffer, sizeof(output_buffer));
+    bool huffman_encoded = false;
+
+    /* Common characters are shorter Huffman encoded */
+    struct aws_byte_cursor to_encode = aws_byte_cursor_from_array(s_url_string, URL_STRING_LEN);
+    ASSERT_SUCCESS(aws_huffman_encode_if_smaller(&encoder, to_encode, &output_buf, &huffman_encoded));
+    ASSERT_TRUE(huffman_encoded);
+    ASSERT_BIN_ARRAYS_EQUALS(s_encoded_url, ENCODED_URL_LEN, output_buf.buffer, output_buf.len);
+
+    /* Rare characters are not, and are written after what's already in the output */
+    static const uint8_t s_rare[] = {0x00, 0x01, 0x02, 0xfe};
+    to_encode = aws_byte_cursor_from_array(s_rare, sizeof(s_rare));
+    ASSERT_SUCCESS(aws_huffman_encode_if_smaller(&encoder, to_encode, &output_buf, &huffman_encoded));
+    ASSERT_FALSE(huffman_encoded);
+    ASSERT_UINT_EQUALS(ENCODED_URL_LEN + sizeof(s_rare), output_buf.len);
+    ASSERT_BIN_ARRAYS_EQUALS(s_rare, sizeof(s_rare), output_buf.buffer + ENCODED_URL_LEN, sizeof(s_rare));
+
+    /* A tie goes to the raw bytes: "e" takes 5 bits, which round up to the same single byte */
+    aws_byte_buf_reset(&output_buf, false);
+    to_encode = aws_byte_cursor_from_c_str("e");
+    ASSERT_SUCCESS(aws_huffman_encode_if_smaller(&encoder, to_encode, &output_buf, &huffman_encoded));
+    ASSERT_FALSE(huffman_encoded);
+    ASSERT_BIN_ARRAYS_EQUALS("e", 1, output_buf.buffer, output_buf.len);
+
+    /* Neither form fits */
+    aws_byte_buf_reset(&output_buf, false);
+    output_buf.capacity = 2;
+    to_encode = aws_byte_cursor_from_array(s_rare, sizeof(s_rare));
+    ASSERT_FAILS(aws_huffman_encode_if_smaller(&encoder, to_encode, &output_buf, &huffman_encoded));
+    ASSERT_UINT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+    ASSERT_UINT_EQUALS(0, output_buf.len);
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_encode_segments, test_huffman_encode_segments)
+static int test_huffman_encode_segments(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test that encoding into segments of any size gives the same bytes as encoding into one buffer,
+     * and that running out of segments part way carries on in the next call */
+
+    enum { MAX_SEGMENTS = ENCODED_CODES_LEN };
+    uint8_t output_buffer[ENCODED_CODES_LEN];
+    struct aws_byte_buf segments[MAX_SEGMENTS];
+
+    struct aws_huffman_symbol_coder *coders[] = {s_callback_get_coder(), test_table_get_coder()};
+    for (size_t c = 0; c < AWS_ARRAY_SIZE(coders); ++c) {
+        struct aws_huffman_encoder encoder;
+        aws_huffman_encoder_init(&encoder, coders[c]);
+
+        for (size_t segment_size = 1; segment_size <= 24; ++segment_size) {
+            AWS_ZERO_ARRAY(output_buffer);
+            size_t num_segments = 0;
+            for (size_t offset = 0; offset < ENCODED_CODES_LEN; offset += segment_size) {
+                const size_t capacity = aws_min_size(segment_size, ENCODED_CODES_LEN - offset);
+                segments[num_segments++] = aws_byte_buf_from_empty_array(output_buffer + offset, capacity);
+            }
+
+            /* Hand over the first half of the segments, then the rest */
+            const size_t first_call_segments = num_segments / 2 ? num_segments / 2 : 1;
+            struct aws_byte_cursor to_encode = aws_byte_cursor_from_array(s_all_codes, ALL_CODES_LEN);
+            aws_huffman_encoder_reset(&encoder);
+
+            int result = aws_huffman_encode_segments(&encoder, &to_encode, segments, first_call_segments);
+            if (first_call_segments < num_segments) {
+                ASSERT_FAILS(result);
+                ASSERT_UINT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+                aws_reset_error();
+                for (size_t i = 0; i < first_call_segments; ++i) {
+                    ASSERT_UINT_EQUALS(segments[i].capacity, segments[i].len);
+                }
+
+                ASSERT_SUCCESS(aws_huffman_encode_segments(
+                    &encoder, &to_encode, segments + first_call_segments, num_segments - first_call_segments));
+            } else {
+                ASSERT_SUCCESS(result);
+            }
+
+            ASSERT_UINT_EQUALS(0, to_encode.len);
+            for (size_t i = 0; i < num_segments; ++i) {
+                ASSERT_UINT_EQUALS(segments[i].capacity, segments[i].len);
+            }
+            ASSERT_BIN_ARRAYS_EQUALS(s_encoded_codes, ENCODED_CODES_LEN, output_buffer, ENCODED_CODES_LEN);
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_encode_in_place, test_huffman_encode_in_place)
+static int test_huffman_encode_in_place(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test that encoding in place gives the same output as encoding into another buffer,
+     * including where the codes are longer than the symbols and would overtake them */
+
+    /* Symbols with 10 bit codes, enough that the codes get further ahead than the side buffer can make up for */
+    enum { LONG_CODES_LEN = 2000 };
+    uint8_t long_codes[LONG_CODES_LEN];
+    for (size_t i = 0; i < LONG_CODES_LEN; ++i) {
+        long_codes[i] = (uint8_t)(i % 10);
+    }
+
+    const struct aws_byte_cursor inputs[] = {
+        aws_byte_cursor_from_array(s_url_string, URL_STRING_LEN),
+        aws_byte_cursor_from_array(s_all_codes, ALL_CODES_LEN),
+        aws_byte_cursor_from_array(long_codes, LONG_CODES_LEN),
+    };
+
+    struct aws_huffman_symbol_coder *coders[] = {s_callback_get_coder(), test_table_get_coder()};
+    for (size_t c = 0; c < AWS_ARRAY_SIZE(coders); ++c) {
+        struct aws_huffman_encoder encoder;
+        aws_huffman_encoder_init(&encoder, coders[c]);
+
+        for (size_t i = 0; i < AWS_ARRAY_SIZE(inputs); ++i) {
+            uint8_t expected_buffer[LONG_CODES_LEN * 2];
+            struct aws_byte_buf expected = aws_byte_buf_from_empty_array(expected_buffer, sizeof(expected_buffer));
+            struct aws_byte_cursor to_encode = inputs[i];
+            ASSERT_SUCCESS(aws_huffman_encode(&encoder, &to_encode, &expected));
+
+            /* Just enough room for whichever is longer */
+            uint8_t buffer[LONG_CODES_LEN * 2];
+            struct aws_byte_buf buf = aws_byte_buf_from_array(buffer, inputs[i].len);
+            memcpy(buffer, inputs[i].ptr, inputs[i].len);
+            buf.capacity = aws_max_size(inputs[i].len, expected.len);
+
+            ASSERT_SUCCESS(aws_huffman_encode_in_place(&encoder, &buf));
+            ASSERT_BIN_ARRAYS_EQUALS(expected.buffer, expected.len, buf.buffer, buf.len);
+
+            /* One byte short */
+            if (expected.len > inputs[i].len) {
+                buf = aws_byte_buf_from_array(buffer, inputs[i].len);
+                memcpy(buffer, inputs[i].ptr, inputs[i].len);
+                buf.capacity = expected.len - 1;
+
+                ASSERT_FAILS(aws_huffman_encode_in_place(&encoder, &buf));
+                ASSERT_UINT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+                aws_reset_error();
+                ASSERT_UINT_EQUALS(0, encoder.overflow_bits.num_bits);
+            }
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_encode_update, test_huffman_encode_update)
+static int test_huffman_encode_update(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test that encoding a string in chunks gives the same output as encoding it whole,
+     * however it's chunked, and however little room the output has */
+
+    struct aws_huffman_symbol_coder *coders[] = {s_callback_get_coder(), test_table_get_coder()};
+    for (size_t c = 0; c < AWS_ARRAY_SIZE(coders); ++c) {
+        struct aws_huffman_encoder encoder;
+        aws_huffman_encoder_init(&encoder, coders[c]);
+
+        for (size_t chunk_size = 1; chunk_size <= ALL_CODES_LEN; chunk_size += 3) {
+            for (size_t i = 0; i < NUM_STEP_SIZES; ++i) {
+                const size_t step_size = s_step_sizes[i];
+
+                uint8_t output_buffer[ENCODED_CODES_LEN];
+                struct aws_byte_buf output_buf = aws_byte_buf_from_empty_array(output_buffer, 0);
+                aws_huffman_encoder_reset(&encoder);
+
+                for (size_t offset = 0; offset < ALL_CODES_LEN; offset += chunk_size) {
+                    const size_t len = aws_min_size(chunk_size, ALL_CODES_LEN - offset);
+                    struct aws_byte_cursor chunk = aws_byte_cursor_from_array(s_all_codes + offset, len);
+
+                    while (aws_huffman_encode_update(&encoder, &chunk, &output_buf)) {
+                        ASSERT_UINT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+                        aws_reset_error();
+                        ASSERT_TRUE(output_buf.capacity < ENCODED_CODES_LEN);
+                        output_buf.capacity = aws_min_size(output_buf.capacity + step_size, ENCODED_CODES_LEN);
+                    }
+
+                    /* Only the partial byte is kept back */
+                    ASSERT_UINT_EQUALS(0, chunk.len);
+                    ASSERT_TRUE(encoder.overflow_bits.num_bits < 8);
+                }
+
+                while (aws_huffman_encode_finish(&encoder, &output_buf)) {
+                    ASSERT_UINT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+                    aws_reset_error();
+                    ASSERT_TRUE(output_buf.capacity < ENCODED_CODES_LEN);
+                    output_buf.capacity = aws_min_size(output_buf.capacity + step_size, ENCODED_CODES_LEN);
+                }
+
+                ASSERT_UINT_EQUALS(0, encoder.overflow_bits.num_bits);
+                ASSERT_BIN_ARRAYS_EQUALS(s_encoded_codes, ENCODED_CODES_LEN, output_buf.buffer, output_buf.len);
+            }
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_encode_cursors, test_huffman_encode_cursors)
+static int test_huffman_encode_cursors(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test that encoding pieces of a string gives the same output as encoding it whole,
+     * wherever it's split, and however little room the output has */
+
+    struct aws_huffman_symbol_coder *coders[] = {s_callback_get_coder(), test_table_get_coder()};
+    for (size_t c = 0; c < AWS_ARRAY_SIZE(coders); ++c) {
+        struct aws_huffman_encoder encoder;
+        aws_huffman_encoder_init(&encoder, coders[c]);
+
+        for (size_t split = 0; split <= ALL_CODES_LEN; split += 7) {
+            for (size_t i = 0; i < NUM_STEP_SIZES; ++i) {
+                const size_t step_size = s_step_sizes[i];
+
+                /* An empty piece in the middle, and the remainder split in two */
+                const size_t second_split = split + (ALL_CODES_LEN - split) / 2;
+                struct aws_byte_cursor pieces[] = {
+                    aws_byte_cursor_from_array(s_all_codes, split),
+                    aws_byte_cursor_from_array(s_all_codes + split, 0),
+                    aws_byte_cursor_from_array(s_all_codes + split, second_split - split),
+                    aws_byte_cursor_from_array(s_all_codes + second_split, ALL_CODES_LEN - second_split),
+                };
+
+                uint8_t output_buffer[ENCODED_CODES_LEN];
+                struct aws_byte_buf output_buf = aws_byte_buf_from_empty_array(output_buffer, 0);
+
+                aws_huffman_encoder_reset(&encoder);
+                while (aws_huffman_encode_cursors(&encoder, pieces, &output_buf, AWS_ARRAY_SIZE(pieces))) {
+                    ASSERT_UINT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+                    aws_reset_error();
+                    ASSERT_TRUE(output_buf.capacity < ENCODED_CODES_LEN);
+                    output_buf.capacity = aws_min_size(output_buf.capacity + step_size, ENCODED_CODES_LEN);
+                }
+
+                for (size_t p = 0; p < AWS_ARRAY_SIZE(pieces); ++p) {
+                    ASSERT_UINT_EQUALS(0, pieces[p].len);
+                }
+                ASSERT_BIN_ARRAYS_EQUALS(s_encoded_codes, ENCODED_CODES_LEN, output_buf.buffer, output_buf.len);
+            }
+        }
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_encoder_allow_growth, test_huffman_encoder_allow_growth)
+static int test_huffman_encoder_allow_growth(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    /* Test that encoder will grow output buffer if allow-growth is set, and finish in one call */
+
+    struct aws_huffman_symbol_coder *coders[] = {s_callback_get_coder(), test_table_get_coder()};
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(coders); ++i) {
+        struct aws_huffman_encoder encoder;
+        aws_huffman_encoder_init(&encoder, coders[i]);
+        aws_huffman_encoder_allow_growth(&encoder, true);
+
+        struct aws_byte_buf output_buf;
+        ASSERT_SUCCESS(aws_byte_buf_init(&output_buf, allocator, 1 /* way too small */));
+
+        struct aws_byte_cursor to_encode = aws_byte_cursor_from_array(s_all_codes, ALL_CODES_LEN);
+        ASSERT_SUCCESS(aws_huffman_encode(&encoder, &to_encode, &output_buf));
+
+        ASSERT_UINT_EQUALS(0, to_encode.len);
+        ASSERT_BIN_ARRAYS_EQUALS(s_encoded_codes, ENCODED_CODES_LEN, output_buf.buffer, output_buf.len);
+
+        /* encode_if_smaller makes room for the raw form, then lets the Huffman form beat it */
+        aws_byte_buf_clean_up(&output_buf);
+        ASSERT_SUCCESS(aws_byte_buf_init(&output_buf, allocator, 1));
+
+        bool huffman_encoded = false;
+        to_encode = aws_byte_cursor_from_array(s_url_string, URL_STRING_LEN);
+        ASSERT_SUCCESS(aws_huffman_encode_if_smaller(&encoder, to_encode, &output_buf, &huffman_encoded));
+        ASSERT_TRUE(huffman_encoded);
+        ASSERT_BIN_ARRAYS_EQUALS(s_encoded_url, ENCODED_URL_LEN, output_buf.buffer, output_buf.len);
+
+        aws_byte_buf_clean_up(&output_buf);
+    }
+
+    /* A decode-only coder has no codes to look at, and setting up an encoder with it must not look for them */
+    struct aws_huffman_symbol_coder decode_only = *s_callback_get_coder();
+    decode_only.encode = NULL;
+    struct aws_huffman_encoder encoder;
+    aws_huffman_encoder_init(&encoder, &decode_only);
+    aws_huffman_encoder_allow_growth(&encoder, true);
+    ASSERT_UINT_EQUALS(0, encoder.max_code_bits);
+
+    return AWS_OP_SUCCESS;
+}
+
 AWS_TEST_CASE(huffman_encoder_exact_output, test_huffman_encoder_exact_output)
 static int test_huffman_encoder_exact_output(struct aws_allocator *allocator, void *ctx) {
     (void)allocator;
@@ -196,13 +798,7 @@ static int test_huffman_encoder_exact_output(struct aws_allocator *allocator, vo
     return AWS_OP_SUCCESS;
 }
 
-AWS_TEST_CASE(huffman_symbol_decoder, test_huffman_symbol_decoder)
-static int test_huffman_symbol_decoder(struct aws_allocator *allocator, void *ctx) {
-    (void)allocator;
-    (void)ctx;
-    /* Test decoding each character */
-
-    struct aws_huffman_symbol_coder *coder = test_get_coder();
+static int s_check_symbol_decoder(struct aws_huffman_symbol_coder *coder) {
 
     for (size_t i = 0; i < NUM_CODE_POINTS; ++i) {
         struct huffman_test_code_point *value = &s_code_points[i];
@@ -214,6 +810,104 @@ static int test_huffman_symbol_decoder(struct aws_allocator *allocator, void *ct
 
         ASSERT_UINT_EQUALS(value->symbol, out);
         ASSERT_UINT_EQUALS(value->code.num_bits, bits_read);
+
+        /* Trailing bits must not change the result */
+        bits_read = coder->decode(bit_pattern | (UINT32_MAX >> value->code.num_bits), &out, NULL);
+
+        ASSERT_UINT_EQUALS(value->symbol, out);
+        ASSERT_UINT_EQUALS(value->code.num_bits, bits_read);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_symbol_decoder, test_huffman_symbol_decoder)
+static int test_huffman_symbol_decoder(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test decoding each character */
+
+    return s_check_symbol_decoder(test_get_coder());
+}
+
+AWS_TEST_CASE(huffman_table_symbol_decoder, test_huffman_table_symbol_decoder)
+static int test_huffman_table_symbol_decoder(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test decoding each character with the table-driven decoder */
+
+    return s_check_symbol_decoder(test_table_get_coder());
+}
+
+AWS_TEST_CASE(huffman_canonical_symbol_decoder, test_huffman_canonical_symbol_decoder)
+static int test_huffman_canonical_symbol_decoder(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test decoding each character with the canonical decoder */
+
+    struct aws_huffman_symbol_coder *coder = test_canonical_get_coder();
+    ASSERT_SUCCESS(s_check_symbol_decoder(coder));
+
+    /* No code begins with 000, which sits before the first code of the shortest length */
+    uint8_t out;
+    ASSERT_UINT_EQUALS(0, coder->decode(0, &out, NULL));
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_specialized_coder, test_huffman_specialized_coder)
+static int test_huffman_specialized_coder(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test the encode and decode functions the generator emits with --specialize */
+
+    const struct {
+        int (*encode)(struct aws_byte_cursor *, struct aws_byte_buf *);
+        int (*decode)(struct aws_byte_cursor *, struct aws_byte_buf *);
+    } coders[] = {
+        {test_table_encode, test_table_decode},
+        {test_canonical_encode, test_canonical_decode},
+    };
+
+    for (size_t c = 0; c < AWS_ARRAY_SIZE(coders); ++c) {
+        uint8_t encoded_buffer[ENCODED_CODES_LEN];
+        struct aws_byte_buf encoded = aws_byte_buf_from_empty_array(encoded_buffer, sizeof(encoded_buffer));
+        struct aws_byte_cursor to_encode = aws_byte_cursor_from_array(s_all_codes, ALL_CODES_LEN);
+        ASSERT_SUCCESS(coders[c].encode(&to_encode, &encoded));
+        ASSERT_UINT_EQUALS(0, to_encode.len);
+        ASSERT_BIN_ARRAYS_EQUALS(s_encoded_codes, ENCODED_CODES_LEN, encoded.buffer, encoded.len);
+
+        uint8_t decoded_buffer[ALL_CODES_LEN];
+        struct aws_byte_buf decoded = aws_byte_buf_from_empty_array(decoded_buffer, sizeof(decoded_buffer));
+        struct aws_byte_cursor to_decode = aws_byte_cursor_from_buf(&encoded);
+        ASSERT_SUCCESS(coders[c].decode(&to_decode, &decoded));
+        ASSERT_UINT_EQUALS(0, to_decode.len);
+        ASSERT_BIN_ARRAYS_EQUALS(s_all_codes, ALL_CODES_LEN, decoded.buffer, decoded.len);
+
+        /* Neither writes anything unless all of it fits */
+        encoded = aws_byte_buf_from_empty_array(encoded_buffer, ENCODED_CODES_LEN - 1);
+        to_encode = aws_byte_cursor_from_array(s_all_codes, ALL_CODES_LEN);
+        ASSERT_FAILS(coders[c].encode(&to_encode, &encoded));
+        ASSERT_UINT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+        ASSERT_UINT_EQUALS(0, encoded.len);
+        ASSERT_UINT_EQUALS(ALL_CODES_LEN, to_encode.len);
+
+        decoded = aws_byte_buf_from_empty_array(decoded_buffer, ALL_CODES_LEN - 1);
+        to_decode = aws_byte_cursor_from_array(s_encoded_codes, ENCODED_CODES_LEN);
+        ASSERT_FAILS(coders[c].decode(&to_decode, &decoded));
+        ASSERT_UINT_EQUALS(AWS_ERROR_SHORT_BUFFER, aws_last_error());
+        ASSERT_UINT_EQUALS(0, decoded.len);
+        ASSERT_UINT_EQUALS(ENCODED_CODES_LEN, to_decode.len);
+
+        /* Padding that isn't all 1s is rejected */
+        uint8_t bad_padding[ENCODED_URL_LEN];
+        memcpy(bad_padding, s_encoded_url, ENCODED_URL_LEN);
+        bad_padding[ENCODED_URL_LEN - 1] &= 0xfe;
+        decoded = aws_byte_buf_from_empty_array(decoded_buffer, sizeof(decoded_buffer));
+        to_decode = aws_byte_cursor_from_array(bad_padding, ENCODED_URL_LEN);
+        ASSERT_FAILS(coders[c].decode(&to_decode, &decoded));
+        ASSERT_UINT_EQUALS(AWS_ERROR_COMPRESSION_UNKNOWN_SYMBOL, aws_last_error());
+        aws_reset_error();
     }
 
     return AWS_OP_SUCCESS;
@@ -272,14 +966,10 @@ static int test_huffman_decoder_all_code_points(struct aws_allocator *allocator,
     return AWS_OP_SUCCESS;
 }
 
-AWS_TEST_CASE(huffman_decoder_partial_input, test_huffman_decoder_partial_input)
-static int test_huffman_decoder_partial_input(struct aws_allocator *allocator, void *ctx) {
-    (void)allocator;
-    (void)ctx;
-    /* Test decoding a buffer in chunks */
+static int s_check_decoder_partial_input(struct aws_huffman_symbol_coder *coder) {
 
     struct aws_huffman_decoder decoder;
-    aws_huffman_decoder_init(&decoder, test_get_coder());
+    aws_huffman_decoder_init(&decoder, coder);
 
     char output_buffer[150];
 
@@ -313,14 +1003,221 @@ static int test_huffman_decoder_partial_input(struct aws_allocator *allocator, v
     return AWS_OP_SUCCESS;
 }
 
-AWS_TEST_CASE(huffman_decoder_partial_output, test_huffman_decoder_partial_output)
-static int test_huffman_decoder_partial_output(struct aws_allocator *allocator, void *ctx) {
+AWS_TEST_CASE(huffman_decoder_partial_input, test_huffman_decoder_partial_input)
+static int test_huffman_decoder_partial_input(struct aws_allocator *allocator, void *ctx) {
     (void)allocator;
     (void)ctx;
-    /* Test decoding when the output buffer size is limited */
+    /* Test decoding a buffer in chunks */
+
+    return s_check_decoder_partial_input(test_get_coder());
+}
+
+AWS_TEST_CASE(huffman_multi_symbol_decoder_partial_input, test_huffman_multi_symbol_decoder_partial_input)
+static int test_huffman_multi_symbol_decoder_partial_input(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test decoding a buffer in chunks, where lookups often span the end of a chunk */
+
+    return s_check_decoder_partial_input(test_multi_symbol_get_coder());
+}
+
+AWS_TEST_CASE(huffman_fsm_decoder_partial_input, test_huffman_fsm_decoder_partial_input)
+static int test_huffman_fsm_decoder_partial_input(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test decoding a buffer in chunks with the state machine decoder */
+
+    return s_check_decoder_partial_input(test_fsm_get_coder());
+}
+
+/* Counts the entries of the table at offset, and of all the sub-tables it links to */
+static size_t s_count_decode_entries(const struct aws_huffman_decode_table *table, size_t offset, uint8_t bits) {
+    size_t count = (size_t)1 << bits;
+    for (size_t i = 0; i < ((size_t)1 << bits); ++i) {
+        const struct aws_huffman_decode_entry *entry = &table->entries[offset + i];
+        if (entry->type == AWS_HUFFMAN_DECODE_ENTRY_LINK) {
+            count += s_count_decode_entries(table, entry->value, entry->num_bits);
+        }
+    }
+    return count;
+}
+
+static uint32_t s_serialize_section(uint8_t *image, uint32_t *size, const void *data, size_t data_size) {
+    const uint32_t offset = (*size + 7) / 8 * 8;
+    memcpy(image + offset, data, data_size);
+    *size = offset + (uint32_t)data_size;
+    return offset;
+}
+
+/* Lays out the tables of the multi-symbol coder and the state machine of the fsm coder, as the generator would */
+static uint32_t s_serialize_test_coder(uint8_t *image) {
+    const struct aws_huffman_symbol_coder *coder = test_multi_symbol_get_coder();
+    const struct aws_huffman_fsm_table *fsm_table = test_fsm_get_coder()->fsm_table;
+
+    struct aws_huffman_serialized_header header;
+    AWS_ZERO_STRUCT(header);
+    memcpy(header.magic, AWS_HUFFMAN_SERIALIZED_MAGIC, sizeof(header.magic));
+    header.version = AWS_HUFFMAN_SERIALIZED_VERSION;
+    header.byte_order = 0x01020304;
+    header.code_size = sizeof(struct aws_huffman_code);
+    header.decode_entry_size = sizeof(struct aws_huffman_decode_entry);
+    header.multi_symbol_entry_size = sizeof(struct aws_huffman_multi_symbol_entry);
+    header.fsm_transition_size = sizeof(struct aws_huffman_fsm_transition);
+    header.root_bits = coder->decode_table->root_bits;
+    header.num_decode_entries = (uint32_t)s_count_decode_entries(coder->decode_table, 0, header.root_bits);
+    header.multi_symbol_index_bits = coder->multi_symbol_table->index_bits;
+    header.fsm_num_states = fsm_table->num_states;
+
+    uint32_t size = sizeof(header);
+    header.encode_table_offset =
+        s_serialize_section(image, &size, coder->encode_table, 256 * sizeof(struct aws_huffman_code));
+    header.code_lengths_offset = s_serialize_section(image, &size, coder->code_lengths, 256);
+    header.decode_entries_offset = s_serialize_section(
+        image,
+        &size,
+        coder->decode_table->entries,
+        header.num_decode_entries * sizeof(struct aws_huffman_decode_entry));
+    header.multi_symbol_offset = s_serialize_section(
+        image,
+        &size,
+        coder->multi_symbol_table->entries,
+        ((size_t)1 << header.multi_symbol_index_bits) * sizeof(struct aws_huffman_multi_symbol_entry));
+    header.fsm_offset = s_serialize_section(
+        image, &size, fsm_table->transitions, fsm_table->num_states * 16 * sizeof(struct aws_huffman_fsm_transition));
+    header.file_size = size;
+
+    memcpy(image, &header, sizeof(header));
+    return size;
+}
+
+static int s_check_mapped_coder(struct aws_huffman_mapped_coder *mapped) {
+    char encoded_buffer[ENCODED_CODES_LEN];
+    struct aws_byte_buf encoded_buf = aws_byte_buf_from_empty_array(encoded_buffer, sizeof(encoded_buffer));
+    struct aws_byte_cursor to_encode = aws_byte_cursor_from_array(s_all_codes, ALL_CODES_LEN);
+    struct aws_huffman_encoder encoder;
+    aws_huffman_encoder_init(&encoder, &mapped->coder);
+    ASSERT_SUCCESS(aws_huffman_encode(&encoder, &to_encode, &encoded_buf));
+    ASSERT_BIN_ARRAYS_EQUALS(s_encoded_codes, ENCODED_CODES_LEN, encoded_buf.buffer, encoded_buf.len);
+
+    return s_check_decoder_partial_input(&mapped->coder);
+}
+
+AWS_TEST_CASE(huffman_mapped_coder, test_huffman_mapped_coder)
+static int test_huffman_mapped_coder(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test coders using serialized tables in place, from memory and from a mapped file */
+
+    static uint64_t s_image[64 * 1024 / sizeof(uint64_t)];
+    uint8_t *image = (uint8_t *)s_image;
+    const uint32_t image_size = s_serialize_test_coder(image);
+    struct aws_huffman_serialized_header *header = (struct aws_huffman_serialized_header *)image;
+
+    struct aws_huffman_mapped_coder mapped;
+    ASSERT_SUCCESS(aws_huffman_mapped_coder_init_from_memory(&mapped, aws_byte_cursor_from_array(image, image_size)));
+    ASSERT_NOT_NULL(mapped.coder.fsm_table);
+    ASSERT_NOT_NULL(mapped.coder.multi_symbol_table);
+    ASSERT_SUCCESS(s_check_mapped_coder(&mapped));
+    aws_huffman_mapped_coder_clean_up(&mapped);
+
+    /* Without the state machine, decoding goes through the multi-symbol and lookup tables */
+    const uint32_t fsm_offset = header->fsm_offset;
+    header->fsm_offset = 0;
+    ASSERT_SUCCESS(aws_huffman_mapped_coder_init_from_memory(&mapped, aws_byte_cursor_from_array(image, image_size)));
+    ASSERT_NULL(mapped.coder.fsm_table);
+    ASSERT_SUCCESS(s_check_mapped_coder(&mapped));
+    aws_huffman_mapped_coder_clean_up(&mapped);
+    header->fsm_offset = fsm_offset;
+
+    static const char s_path[] = "huffman_mapped_coder_test.bin";
+    FILE *file = fopen(s_path, "wb");
+    ASSERT_NOT_NULL(file);
+    ASSERT_UINT_EQUALS(image_size, fwrite(image, 1, image_size, file));
+    fclose(file);
+
+    ASSERT_SUCCESS(aws_huffman_mapped_coder_init(&mapped, s_path));
+    ASSERT_NOT_NULL(mapped.mapping);
+    ASSERT_SUCCESS(s_check_mapped_coder(&mapped));
+    aws_huffman_mapped_coder_clean_up(&mapped);
+    remove(s_path);
+
+    ASSERT_ERROR(AWS_ERROR_FILE_INVALID_PATH, aws_huffman_mapped_coder_init(&mapped, s_path));
+
+    /* Anything that could send a lookup out of bounds is rejected */
+    ASSERT_ERROR(
+        AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER,
+        aws_huffman_mapped_coder_init_from_memory(&mapped, aws_byte_cursor_from_array(image, image_size - 1)));
+
+    header->version = AWS_HUFFMAN_SERIALIZED_VERSION + 1;
+    ASSERT_ERROR(
+        AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER,
+        aws_huffman_mapped_coder_init_from_memory(&mapped, aws_byte_cursor_from_array(image, image_size)));
+    header->version = AWS_HUFFMAN_SERIALIZED_VERSION;
+
+    header->decode_entries_offset += 4;
+    ASSERT_ERROR(
+        AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER,
+        aws_huffman_mapped_coder_init_from_memory(&mapped, aws_byte_cursor_from_array(image, image_size)));
+    header->decode_entries_offset -= 4;
+
+    struct aws_huffman_decode_entry *decode_entries =
+        (struct aws_huffman_decode_entry *)(image + header->decode_entries_offset);
+    size_t link = 0;
+    while (decode_entries[link].type != AWS_HUFFMAN_DECODE_ENTRY_LINK) {
+        ++link;
+    }
+    decode_entries[link].value += 1;
+    ASSERT_ERROR(
+        AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER,
+        aws_huffman_mapped_coder_init_from_memory(&mapped, aws_byte_cursor_from_array(image, image_size)));
+    decode_entries[link].value -= 1;
+
+    struct aws_huffman_fsm_transition *transitions = (struct aws_huffman_fsm_transition *)(image + header->fsm_offset);
+    transitions[0].next_state = header->fsm_num_states;
+    ASSERT_ERROR(
+        AWS_ERROR_COMPRESSION_INVALID_SERIALIZED_CODER,
+        aws_huffman_mapped_coder_init_from_memory(&mapped, aws_byte_cursor_from_array(image, image_size)));
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_autotune_strategies, test_huffman_autotune_strategies)
+static int test_huffman_autotune_strategies(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test every decoder emitted by --autotune, and that the table decoder is picked by default */
+
+    static const char *expected_names[] = {"tree", "table", "flat", "canonical", "multi_symbol", "fsm"};
+
+    size_t num_strategies = 0;
+    while (test_autotune_get_strategy_coder(num_strategies)) {
+        struct aws_huffman_symbol_coder *coder = test_autotune_get_strategy_coder(num_strategies);
+        ASSERT_TRUE(num_strategies < AWS_ARRAY_SIZE(expected_names));
+        ASSERT_STR_EQUALS(expected_names[num_strategies], test_autotune_get_strategy_name(num_strategies));
+
+        char encoded_buffer[ENCODED_CODES_LEN];
+        struct aws_byte_buf encoded_buf = aws_byte_buf_from_empty_array(encoded_buffer, sizeof(encoded_buffer));
+        struct aws_byte_cursor to_encode = aws_byte_cursor_from_array(s_all_codes, ALL_CODES_LEN);
+        struct aws_huffman_encoder encoder;
+        aws_huffman_encoder_init(&encoder, coder);
+        ASSERT_SUCCESS(aws_huffman_encode(&encoder, &to_encode, &encoded_buf));
+        ASSERT_BIN_ARRAYS_EQUALS(s_encoded_codes, ENCODED_CODES_LEN, encoded_buf.buffer, encoded_buf.len);
+
+        ASSERT_SUCCESS(s_check_decoder_partial_input(coder));
+        ++num_strategies;
+    }
+
+    ASSERT_UINT_EQUALS(AWS_ARRAY_SIZE(expected_names), num_strategies);
+    ASSERT_NULL(test_autotune_get_strategy_name(num_strategies));
+    ASSERT_PTR_EQUALS(test_autotune_get_strategy_coder(1), test_autotune_get_coder());
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_check_decoder_partial_output(struct aws_huffman_symbol_coder *coder) {
 
     struct aws_huffman_decoder decoder;
-    aws_huffman_decoder_init(&decoder, test_get_coder());
+    aws_huffman_decoder_init(&decoder, coder);
 
     char output_buffer[150];
 
@@ -362,6 +1259,29 @@ static int test_huffman_decoder_partial_output(struct aws_allocator *allocator,
     return AWS_OP_SUCCESS;
 }
 
+AWS_TEST_CASE(huffman_decoder_partial_output, test_huffman_decoder_partial_output)
+static int test_huffman_decoder_partial_output(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test decoding when the output buffer size is limited */
+
+    return s_check_decoder_partial_output(test_get_coder());
+}
+
+AWS_TEST_CASE(huffman_decoder_partial_output_all_coders, test_huffman_decoder_partial_output_all_coders)
+static int test_huffman_decoder_partial_output_all_coders(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test that each decoder stops exactly where the output runs out, even when decoding without per-symbol checks */
+
+    ASSERT_SUCCESS(s_check_decoder_partial_output(test_table_get_coder()));
+    ASSERT_SUCCESS(s_check_decoder_partial_output(test_canonical_get_coder()));
+    ASSERT_SUCCESS(s_check_decoder_partial_output(test_multi_symbol_get_coder()));
+    ASSERT_SUCCESS(s_check_decoder_partial_output(test_fsm_get_coder()));
+
+    return AWS_OP_SUCCESS;
+}
+
 AWS_TEST_CASE(huffman_decoder_allow_growth, test_huffman_decoder_allow_growth)
 static int test_huffman_decoder_allow_growth(struct aws_allocator *allocator, void *ctx) {
     (void)ctx;
@@ -380,7 +1300,222 @@ static int test_huffman_decoder_allow_growth(struct aws_allocator *allocator, vo
     ASSERT_UINT_EQUALS(0, to_decode.len);
     ASSERT_BIN_ARRAYS_EQUALS(s_url_string, URL_STRING_LEN, output_buf.buffer, output_buf.len);
 
+    /* Without tables, the shortest code isn't known, so the output grows as it fills rather than up front */
+    aws_huffman_decoder_init(&decoder, s_callback_get_coder());
+    ASSERT_UINT_EQUALS(0, decoder.min_code_bits);
+    aws_huffman_decoder_allow_growth(&decoder, true);
+
     aws_byte_buf_clean_up(&output_buf);
+    ASSERT_SUCCESS(aws_byte_buf_init(&output_buf, allocator, 1 /* way too small */));
+
+    to_decode = aws_byte_cursor_from_array(s_encoded_codes, ENCODED_CODES_LEN);
+    ASSERT_SUCCESS(aws_huffman_decode(&decoder, &to_decode, &output_buf));
+
+    ASSERT_UINT_EQUALS(0, to_decode.len);
+    ASSERT_BIN_ARRAYS_EQUALS(s_all_codes, ALL_CODES_LEN, output_buf.buffer, output_buf.len);
+    ASSERT_TRUE(output_buf.capacity < 2 * ALL_CODES_LEN);
+
+    aws_byte_buf_clean_up(&output_buf);
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_decode_batch, test_huffman_decode_batch)
+static int test_huffman_decode_batch(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    /* Test that decoding a batch gives the same output and errors as decoding each string in turn */
+
+    static const uint8_t s_invalid[] = {0x00, 0x00, 0x00, 0x00, 0x00};
+    const struct {
+        struct aws_huffman_symbol_coder *coder;
+        const uint8_t *input;
+        size_t input_len;
+        size_t output_capacity;
+        bool allow_growth;
+    } cases[] = {
+        {test_table_get_coder(), s_encoded_codes, ENCODED_CODES_LEN, ALL_CODES_LEN, false},
+        {test_get_coder(), s_encoded_url, ENCODED_URL_LEN, URL_STRING_LEN, false},
+        {test_canonical_get_coder(), s_invalid, sizeof(s_invalid), ALL_CODES_LEN, false},
+        {test_multi_symbol_get_coder(), s_encoded_codes, ENCODED_CODES_LEN, 10 /* too small */, false},
+        {test_fsm_get_coder(), s_encoded_url, ENCODED_URL_LEN, URL_STRING_LEN, false},
+        {test_table_get_coder(), s_encoded_codes, 0, ALL_CODES_LEN, false},
+        {test_canonical_get_coder(), s_encoded_codes, ENCODED_CODES_LEN, 1 /* way too small */, true},
+        /* Stops partway through a code */
+        {test_table_get_coder(), s_encoded_url, ENCODED_URL_LEN - 1, URL_STRING_LEN, false},
+        {test_get_coder(), s_encoded_codes, ENCODED_CODES_LEN, ALL_CODES_LEN, false},
+    };
+    enum { NUM_CASES = sizeof(cases) / sizeof(cases[0]) };
+
+    struct aws_huffman_decoder expected_decoders[NUM_CASES];
+    struct aws_byte_cursor expected_inputs[NUM_CASES];
+    struct aws_byte_buf expected_outputs[NUM_CASES];
+    int expected_errors[NUM_CASES];
+
+    struct aws_huffman_decoder decoders[NUM_CASES];
+    struct aws_byte_cursor inputs[NUM_CASES];
+    struct aws_byte_buf outputs[NUM_CASES];
+    int errors[NUM_CASES];
+
+    for (size_t i = 0; i < NUM_CASES; ++i) {
+        aws_huffman_decoder_init(&expected_decoders[i], cases[i].coder);
+        aws_huffman_decoder_allow_growth(&expected_decoders[i], cases[i].allow_growth);
+        expected_inputs[i] = aws_byte_cursor_from_array(cases[i].input, cases[i].input_len);
+        ASSERT_SUCCESS(aws_byte_buf_init(&expected_outputs[i], allocator, cases[i].output_capacity));
+
+        aws_reset_error();
+        aws_huffman_decode(&expected_decoders[i], &expected_inputs[i], &expected_outputs[i]);
+        expected_errors[i] = aws_last_error();
+
+        aws_huffman_decoder_init(&decoders[i], cases[i].coder);
+        aws_huffman_decoder_allow_growth(&decoders[i], cases[i].allow_growth);
+        inputs[i] = aws_byte_cursor_from_array(cases[i].input, cases[i].input_len);
+        ASSERT_SUCCESS(aws_byte_buf_init(&outputs[i], allocator, cases[i].output_capacity));
+    }
+
+    ASSERT_FAILS(aws_huffman_decode_batch(decoders, inputs, outputs, errors, NUM_CASES));
+    ASSERT_INT_EQUALS(AWS_ERROR_COMPRESSION_UNKNOWN_SYMBOL, aws_last_error());
+
+    for (size_t i = 0; i < NUM_CASES; ++i) {
+        ASSERT_INT_EQUALS(expected_errors[i], errors[i]);
+        ASSERT_UINT_EQUALS(expected_inputs[i].len, inputs[i].len);
+        ASSERT_BIN_ARRAYS_EQUALS(
+            expected_outputs[i].buffer, expected_outputs[i].len, outputs[i].buffer, outputs[i].len);
+        ASSERT_UINT_EQUALS(expected_decoders[i].num_bits, decoders[i].num_bits);
+        ASSERT_UINT_EQUALS(expected_decoders[i].working_bits, decoders[i].working_bits);
+
+        aws_byte_buf_clean_up(&expected_outputs[i]);
+        aws_byte_buf_clean_up(&outputs[i]);
+    }
+
+    /* Every string decoding successfully */
+    for (size_t i = 0; i < NUM_CASES; ++i) {
+        aws_huffman_decoder_init(&decoders[i], test_table_get_coder());
+        inputs[i] = aws_byte_cursor_from_array(s_encoded_codes, ENCODED_CODES_LEN);
+        ASSERT_SUCCESS(aws_byte_buf_init(&outputs[i], allocator, ALL_CODES_LEN));
+    }
+
+    ASSERT_SUCCESS(aws_huffman_decode_batch(decoders, inputs, outputs, errors, NUM_CASES));
+
+    for (size_t i = 0; i < NUM_CASES; ++i) {
+        ASSERT_INT_EQUALS(0, errors[i]);
+        ASSERT_BIN_ARRAYS_EQUALS(s_all_codes, ALL_CODES_LEN, outputs[i].buffer, outputs[i].len);
+        aws_byte_buf_clean_up(&outputs[i]);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_decode_batch_tokens, test_huffman_decode_batch_tokens)
+static int test_huffman_decode_batch_tokens(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    /* Test decoding a batch of random-looking values of many lengths, sharing a coder so they can be decoded side by
+     * side in SIMD lanes where supported, with the odd code too long for the primary table mixed in */
+
+    enum { NUM_TOKENS = 20, MAX_TOKEN_LEN = 200 };
+    static const char s_token_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+    struct aws_huffman_symbol_coder *coder = test_table_get_coder();
+
+    char tokens[NUM_TOKENS][MAX_TOKEN_LEN];
+    size_t token_lens[NUM_TOKENS];
+    uint8_t encoded[NUM_TOKENS][MAX_TOKEN_LEN * 2];
+
+    struct aws_huffman_decoder decoders[NUM_TOKENS];
+    struct aws_byte_cursor inputs[NUM_TOKENS];
+    struct aws_byte_buf outputs[NUM_TOKENS];
+    int errors[NUM_TOKENS];
+
+    uint32_t seed = 0x9e3779b9;
+    for (size_t i = 0; i < NUM_TOKENS; ++i) {
+        token_lens[i] = (i * 37) % MAX_TOKEN_LEN;
+        for (size_t j = 0; j < token_lens[i]; ++j) {
+            seed = seed * 1664525 + 1013904223;
+            tokens[i][j] = i % 3 == 0 && j % 23 == 22 ? (char)(0x80 | (seed >> 25)) : s_token_chars[seed >> 26];
+        }
+
+        struct aws_huffman_encoder encoder;
+        aws_huffman_encoder_init(&encoder, coder);
+        struct aws_byte_cursor to_encode = aws_byte_cursor_from_array(tokens[i], token_lens[i]);
+        struct aws_byte_buf encoded_buf = aws_byte_buf_from_empty_array(encoded[i], sizeof(encoded[i]));
+        ASSERT_SUCCESS(aws_huffman_encode(&encoder, &to_encode, &encoded_buf));
+
+        aws_huffman_decoder_init(&decoders[i], coder);
+        inputs[i] = aws_byte_cursor_from_buf(&encoded_buf);
+        ASSERT_SUCCESS(aws_byte_buf_init(&outputs[i], allocator, token_lens[i]));
+    }
+
+    ASSERT_SUCCESS(aws_huffman_decode_batch(decoders, inputs, outputs, errors, NUM_TOKENS));
+
+    for (size_t i = 0; i < NUM_TOKENS; ++i) {
+        ASSERT_INT_EQUALS(0, errors[i]);
+        ASSERT_UINT_EQUALS(0, inputs[i].len);
+        ASSERT_BIN_ARRAYS_EQUALS(tokens[i], token_lens[i], outputs[i].buffer, outputs[i].len);
+        ASSERT_TRUE(aws_huffman_decoder_is_complete(&decoders[i]));
+        aws_byte_buf_clean_up(&outputs[i]);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_check_decoder_is_complete(struct aws_huffman_symbol_coder *coder) {
+
+    struct aws_huffman_decoder decoder;
+    aws_huffman_decoder_init(&decoder, coder);
+    ASSERT_TRUE(aws_huffman_decoder_is_complete(&decoder));
+
+    char output_buffer[URL_STRING_LEN * 2];
+    struct aws_byte_buf output_buf = aws_byte_buf_from_empty_array(output_buffer, sizeof(output_buffer));
+
+    /* The encoded url ends in fewer than 8 bits of 1s */
+    struct aws_byte_cursor to_decode = aws_byte_cursor_from_array(s_encoded_url, ENCODED_URL_LEN);
+    ASSERT_SUCCESS(aws_huffman_decode(&decoder, &to_decode, &output_buf));
+    ASSERT_BIN_ARRAYS_EQUALS(s_url_string, URL_STRING_LEN, output_buf.buffer, output_buf.len);
+    ASSERT_TRUE(aws_huffman_decoder_is_complete(&decoder));
+
+    /* 8 bits of 1s is too much padding */
+    aws_huffman_decoder_reset(&decoder);
+    aws_byte_buf_reset(&output_buf, false);
+    static const uint8_t s_too_much_padding[] = {0xff};
+    to_decode = aws_byte_cursor_from_array(s_too_much_padding, sizeof(s_too_much_padding));
+    ASSERT_SUCCESS(aws_huffman_decode(&decoder, &to_decode, &output_buf));
+    ASSERT_FALSE(aws_huffman_decoder_is_complete(&decoder));
+
+    /* Input that stops partway through a code */
+    aws_huffman_decoder_reset(&decoder);
+    aws_byte_buf_reset(&output_buf, false);
+    to_decode = aws_byte_cursor_from_array(s_encoded_url, 2);
+    ASSERT_SUCCESS(aws_huffman_decode(&decoder, &to_decode, &output_buf));
+    ASSERT_FALSE(aws_huffman_decoder_is_complete(&decoder));
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_decoder_is_complete, test_huffman_decoder_is_complete)
+static int test_huffman_decoder_is_complete(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test checking the padding at the end of a stream */
+
+    return s_check_decoder_is_complete(test_get_coder());
+}
+
+AWS_TEST_CASE(huffman_fsm_decoder_is_complete, test_huffman_fsm_decoder_is_complete)
+static int test_huffman_fsm_decoder_is_complete(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test checking the padding at the end of a stream with the state machine decoder */
+
+    ASSERT_SUCCESS(s_check_decoder_is_complete(test_fsm_get_coder()));
+
+    /* Bits that can't begin any code fail immediately, rather than waiting for more input */
+    struct aws_huffman_decoder decoder;
+    aws_huffman_decoder_init(&decoder, test_fsm_get_coder());
+
+    char output_buffer[8];
+    struct aws_byte_buf output_buf = aws_byte_buf_from_empty_array(output_buffer, sizeof(output_buffer));
+
+    static const uint8_t s_invalid[] = {0x00};
+    struct aws_byte_cursor to_decode = aws_byte_cursor_from_array(s_invalid, sizeof(s_invalid));
+    ASSERT_ERROR(AWS_ERROR_COMPRESSION_UNKNOWN_SYMBOL, aws_huffman_decode(&decoder, &to_decode, &output_buf));
+
     return AWS_OP_SUCCESS;
 }
 
@@ -444,3 +1579,113 @@ static int test_huffman_transitive_chunked(struct aws_allocator *allocator, void
 
     return AWS_OP_SUCCESS;
 }
+
+AWS_TEST_CASE(huffman_table_transitive_chunked, test_huffman_table_transitive_chunked)
+static int test_huffman_table_transitive_chunked(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test the table-driven decoder against all character values, in chunks */
+
+    for (size_t i = 0; i < NUM_STEP_SIZES; ++i) {
+        const size_t step_size = s_step_sizes[i];
+
+        const char *error_message = NULL;
+        int result = huffman_test_transitive_chunked(
+            test_table_get_coder(), s_all_codes, ALL_CODES_LEN, ENCODED_CODES_LEN, step_size, &error_message);
+        ASSERT_SUCCESS(result, error_message);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_table_transitive_tokens, test_huffman_table_transitive_tokens)
+static int test_huffman_table_transitive_tokens(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test the table-driven decoder against long random-looking values, with the odd code too long for the
+     * primary table mixed in */
+
+    static const char s_token_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+    char token[1024];
+    uint32_t seed = 0x2545f491;
+    for (size_t i = 0; i < sizeof(token); ++i) {
+        seed = seed * 1664525 + 1013904223;
+        token[i] = i % 37 == 36 ? (char)(0x80 | (seed >> 25)) : s_token_chars[seed >> 26];
+    }
+
+    const char *error_message = NULL;
+    ASSERT_SUCCESS(
+        huffman_test_transitive(test_table_get_coder(), token, sizeof(token), 0, &error_message), error_message);
+
+    for (size_t i = 0; i < NUM_STEP_SIZES; ++i) {
+        const size_t step_size = s_step_sizes[i];
+
+        int result = huffman_test_transitive_chunked(
+            test_table_get_coder(), token, sizeof(token), 0, step_size, &error_message);
+        ASSERT_SUCCESS(result, error_message);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_canonical_transitive_chunked, test_huffman_canonical_transitive_chunked)
+static int test_huffman_canonical_transitive_chunked(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test the canonical decoder against all character values, in chunks */
+
+    for (size_t i = 0; i < NUM_STEP_SIZES; ++i) {
+        const size_t step_size = s_step_sizes[i];
+
+        const char *error_message = NULL;
+        int result = huffman_test_transitive_chunked(
+            test_canonical_get_coder(), s_all_codes, ALL_CODES_LEN, ENCODED_CODES_LEN, step_size, &error_message);
+        ASSERT_SUCCESS(result, error_message);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_multi_symbol_transitive_chunked, test_huffman_multi_symbol_transitive_chunked)
+static int test_huffman_multi_symbol_transitive_chunked(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test the multi-symbol decoder against all character values, with output too small to fit a whole entry */
+
+    for (size_t i = 0; i < NUM_STEP_SIZES; ++i) {
+        const size_t step_size = s_step_sizes[i];
+
+        const char *error_message = NULL;
+        int result = huffman_test_transitive_chunked(
+            test_multi_symbol_get_coder(), s_all_codes, ALL_CODES_LEN, ENCODED_CODES_LEN, step_size, &error_message);
+        ASSERT_SUCCESS(result, error_message);
+    }
+
+    /* Short codes back to back, so most lookups produce several symbols */
+    static const char s_short_codes[] = "eeeeaaaa    tttt0123abcdefghij";
+    const char *error_message = NULL;
+    ASSERT_SUCCESS(
+        huffman_test_transitive(
+            test_multi_symbol_get_coder(), s_short_codes, sizeof(s_short_codes) - 1, 0, &error_message),
+        error_message);
+
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(huffman_fsm_transitive_chunked, test_huffman_fsm_transitive_chunked)
+static int test_huffman_fsm_transitive_chunked(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+    /* Test the state machine decoder against all character values, in chunks */
+
+    for (size_t i = 0; i < NUM_STEP_SIZES; ++i) {
+        const size_t step_size = s_step_sizes[i];
+
+        const char *error_message = NULL;
+        int result = huffman_test_transitive_chunked(
+            test_fsm_get_coder(), s_all_codes, ALL_CODES_LEN, ENCODED_CODES_LEN, step_size, &error_message);
+        ASSERT_SUCCESS(result, error_message);
+    }
+
+    return AWS_OP_SUCCESS;
+}
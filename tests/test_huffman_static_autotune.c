@@ -0,0 +1,9809 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+/* WARNING: THIS FILE WAS AUTOMATICALLY GENERATED. DO NOT EDIT. */
+/* clang-format off */
+
+#include <aws/compression/huffman.h>
+
+#include <aws/common/math.h>
+
+struct aws_huffman_symbol_coder *test_autotune_get_strategy_coder(size_t index);
+const char *test_autotune_get_strategy_name(size_t index);
+struct aws_huffman_symbol_coder *test_autotune_get_coder(void);
+
+static const struct aws_huffman_code code_points[] = {
+    { .pattern = 0x32e, .num_bits = 10 }, /* ' ' 0 */
+    { .pattern = 0x32f, .num_bits = 10 }, /* ' ' 1 */
+    { .pattern = 0x330, .num_bits = 10 }, /* ' ' 2 */
+    { .pattern = 0x331, .num_bits = 10 }, /* ' ' 3 */
+    { .pattern = 0x332, .num_bits = 10 }, /* ' ' 4 */
+    { .pattern = 0x333, .num_bits = 10 }, /* ' ' 5 */
+    { .pattern = 0x334, .num_bits = 10 }, /* ' ' 6 */
+    { .pattern = 0x335, .num_bits = 10 }, /* ' ' 7 */
+    { .pattern = 0x336, .num_bits = 10 }, /* ' ' 8 */
+    { .pattern = 0x337, .num_bits = 10 }, /* ' ' 9 */
+    { .pattern = 0xb8, .num_bits = 8 }, /* ' ' 10 */
+    { .pattern = 0x338, .num_bits = 10 }, /* ' ' 11 */
+    { .pattern = 0x339, .num_bits = 10 }, /* ' ' 12 */
+    { .pattern = 0x33a, .num_bits = 10 }, /* ' ' 13 */
+    { .pattern = 0x33b, .num_bits = 10 }, /* ' ' 14 */
+    { .pattern = 0x33c, .num_bits = 10 }, /* ' ' 15 */
+    { .pattern = 0x33d, .num_bits = 10 }, /* ' ' 16 */
+    { .pattern = 0x33e, .num_bits = 10 }, /* ' ' 17 */
+    { .pattern = 0x33f, .num_bits = 10 }, /* ' ' 18 */
+    { .pattern = 0x340, .num_bits = 10 }, /* ' ' 19 */
+    { .pattern = 0x341, .num_bits = 10 }, /* ' ' 20 */
+    { .pattern = 0x342, .num_bits = 10 }, /* ' ' 21 */
+    { .pattern = 0x343, .num_bits = 10 }, /* ' ' 22 */
+    { .pattern = 0x344, .num_bits = 10 }, /* ' ' 23 */
+    { .pattern = 0x345, .num_bits = 10 }, /* ' ' 24 */
+    { .pattern = 0x346, .num_bits = 10 }, /* ' ' 25 */
+    { .pattern = 0x347, .num_bits = 10 }, /* ' ' 26 */
+    { .pattern = 0x348, .num_bits = 10 }, /* ' ' 27 */
+    { .pattern = 0x349, .num_bits = 10 }, /* ' ' 28 */
+    { .pattern = 0x34a, .num_bits = 10 }, /* ' ' 29 */
+    { .pattern = 0x34b, .num_bits = 10 }, /* ' ' 30 */
+    { .pattern = 0x34c, .num_bits = 10 }, /* ' ' 31 */
+    { .pattern = 0x4, .num_bits = 5 }, /* ' ' 32 */
+    { .pattern = 0x34d, .num_bits = 10 }, /* '!' 33 */
+    { .pattern = 0x34e, .num_bits = 10 }, /* '"' 34 */
+    { .pattern = 0x34f, .num_bits = 10 }, /* '#' 35 */
+    { .pattern = 0x350, .num_bits = 10 }, /* '$' 36 */
+    { .pattern = 0x351, .num_bits = 10 }, /* '%' 37 */
+    { .pattern = 0x352, .num_bits = 10 }, /* '&' 38 */
+    { .pattern = 0x56, .num_bits = 7 }, /* ''' 39 */
+    { .pattern = 0x353, .num_bits = 10 }, /* '(' 40 */
+    { .pattern = 0x354, .num_bits = 10 }, /* ')' 41 */
+    { .pattern = 0x355, .num_bits = 10 }, /* '*' 42 */
+    { .pattern = 0x356, .num_bits = 10 }, /* '+' 43 */
+    { .pattern = 0xb9, .num_bits = 8 }, /* ',' 44 */
+    { .pattern = 0x188, .num_bits = 9 }, /* '-' 45 */
+    { .pattern = 0x57, .num_bits = 7 }, /* '.' 46 */
+    { .pattern = 0x357, .num_bits = 10 }, /* '/' 47 */
+    { .pattern = 0x358, .num_bits = 10 }, /* '0' 48 */
+    { .pattern = 0x359, .num_bits = 10 }, /* '1' 49 */
+    { .pattern = 0x35a, .num_bits = 10 }, /* '2' 50 */
+    { .pattern = 0x35b, .num_bits = 10 }, /* '3' 51 */
+    { .pattern = 0x35c, .num_bits = 10 }, /* '4' 52 */
+    { .pattern = 0x35d, .num_bits = 10 }, /* '5' 53 */
+    { .pattern = 0x35e, .num_bits = 10 }, /* '6' 54 */
+    { .pattern = 0x35f, .num_bits = 10 }, /* '7' 55 */
+    { .pattern = 0x360, .num_bits = 10 }, /* '8' 56 */
+    { .pattern = 0x361, .num_bits = 10 }, /* '9' 57 */
+    { .pattern = 0x362, .num_bits = 10 }, /* ':' 58 */
+    { .pattern = 0x363, .num_bits = 10 }, /* ';' 59 */
+    { .pattern = 0x364, .num_bits = 10 }, /* '<' 60 */
+    { .pattern = 0x365, .num_bits = 10 }, /* '=' 61 */
+    { .pattern = 0x366, .num_bits = 10 }, /* '>' 62 */
+    { .pattern = 0xba, .num_bits = 8 }, /* '?' 63 */
+    { .pattern = 0x367, .num_bits = 10 }, /* '@' 64 */
+    { .pattern = 0x368, .num_bits = 10 }, /* 'A' 65 */
+    { .pattern = 0xbb, .num_bits = 8 }, /* 'B' 66 */
+    { .pattern = 0x189, .num_bits = 9 }, /* 'C' 67 */
+    { .pattern = 0x18a, .num_bits = 9 }, /* 'D' 68 */
+    { .pattern = 0x18b, .num_bits = 9 }, /* 'E' 69 */
+    { .pattern = 0x18c, .num_bits = 9 }, /* 'F' 70 */
+    { .pattern = 0x18d, .num_bits = 9 }, /* 'G' 71 */
+    { .pattern = 0x18e, .num_bits = 9 }, /* 'H' 72 */
+    { .pattern = 0xbc, .num_bits = 8 }, /* 'I' 73 */
+    { .pattern = 0x369, .num_bits = 10 }, /* 'J' 74 */
+    { .pattern = 0x36a, .num_bits = 10 }, /* 'K' 75 */
+    { .pattern = 0x18f, .num_bits = 9 }, /* 'L' 76 */
+    { .pattern = 0x190, .num_bits = 9 }, /* 'M' 77 */
+    { .pattern = 0x36b, .num_bits = 10 }, /* 'N' 78 */
+    { .pattern = 0x36c, .num_bits = 10 }, /* 'O' 79 */
+    { .pattern = 0x191, .num_bits = 9 }, /* 'P' 80 */
+    { .pattern = 0x36d, .num_bits = 10 }, /* 'Q' 81 */
+    { .pattern = 0x36e, .num_bits = 10 }, /* 'R' 82 */
+    { .pattern = 0x36f, .num_bits = 10 }, /* 'S' 83 */
+    { .pattern = 0xbd, .num_bits = 8 }, /* 'T' 84 */
+    { .pattern = 0x370, .num_bits = 10 }, /* 'U' 85 */
+    { .pattern = 0x192, .num_bits = 9 }, /* 'V' 86 */
+    { .pattern = 0xbe, .num_bits = 8 }, /* 'W' 87 */
+    { .pattern = 0x371, .num_bits = 10 }, /* 'X' 88 */
+    { .pattern = 0x193, .num_bits = 9 }, /* 'Y' 89 */
+    { .pattern = 0x372, .num_bits = 10 }, /* 'Z' 90 */
+    { .pattern = 0x373, .num_bits = 10 }, /* '[' 91 */
+    { .pattern = 0x374, .num_bits = 10 }, /* '\' 92 */
+    { .pattern = 0x375, .num_bits = 10 }, /* ']' 93 */
+    { .pattern = 0x376, .num_bits = 10 }, /* '^' 94 */
+    { .pattern = 0x377, .num_bits = 10 }, /* '_' 95 */
+    { .pattern = 0x378, .num_bits = 10 }, /* '`' 96 */
+    { .pattern = 0x5, .num_bits = 5 }, /* 'a' 97 */
+    { .pattern = 0x58, .num_bits = 7 }, /* 'b' 98 */
+    { .pattern = 0x20, .num_bits = 6 }, /* 'c' 99 */
+    { .pattern = 0x21, .num_bits = 6 }, /* 'd' 100 */
+    { .pattern = 0x6, .num_bits = 5 }, /* 'e' 101 */
+    { .pattern = 0x22, .num_bits = 6 }, /* 'f' 102 */
+    { .pattern = 0x59, .num_bits = 7 }, /* 'g' 103 */
+    { .pattern = 0x23, .num_bits = 6 }, /* 'h' 104 */
+    { .pattern = 0x7, .num_bits = 5 }, /* 'i' 105 */
+    { .pattern = 0xbf, .num_bits = 8 }, /* 'j' 106 */
+    { .pattern = 0x24, .num_bits = 6 }, /* 'k' 107 */
+    { .pattern = 0x25, .num_bits = 6 }, /* 'l' 108 */
+    { .pattern = 0x26, .num_bits = 6 }, /* 'm' 109 */
+    { .pattern = 0x8, .num_bits = 5 }, /* 'n' 110 */
+    { .pattern = 0x9, .num_bits = 5 }, /* 'o' 111 */
+    { .pattern = 0x5a, .num_bits = 7 }, /* 'p' 112 */
+    { .pattern = 0x194, .num_bits = 9 }, /* 'q' 113 */
+    { .pattern = 0xa, .num_bits = 5 }, /* 'r' 114 */
+    { .pattern = 0xb, .num_bits = 5 }, /* 's' 115 */
+    { .pattern = 0xc, .num_bits = 5 }, /* 't' 116 */
+    { .pattern = 0xd, .num_bits = 5 }, /* 'u' 117 */
+    { .pattern = 0xc0, .num_bits = 8 }, /* 'v' 118 */
+    { .pattern = 0x27, .num_bits = 6 }, /* 'w' 119 */
+    { .pattern = 0xc1, .num_bits = 8 }, /* 'x' 120 */
+    { .pattern = 0x28, .num_bits = 6 }, /* 'y' 121 */
+    { .pattern = 0x379, .num_bits = 10 }, /* 'z' 122 */
+    { .pattern = 0x37a, .num_bits = 10 }, /* '{' 123 */
+    { .pattern = 0x37b, .num_bits = 10 }, /* '|' 124 */
+    { .pattern = 0x37c, .num_bits = 10 }, /* '}' 125 */
+    { .pattern = 0x37d, .num_bits = 10 }, /* '~' 126 */
+    { .pattern = 0x37e, .num_bits = 10 }, /* ' ' 127 */
+    { .pattern = 0x37f, .num_bits = 10 }, /* ' ' 128 */
+    { .pattern = 0x380, .num_bits = 10 }, /* ' ' 129 */
+    { .pattern = 0x381, .num_bits = 10 }, /* ' ' 130 */
+    { .pattern = 0x382, .num_bits = 10 }, /* ' ' 131 */
+    { .pattern = 0x383, .num_bits = 10 }, /* ' ' 132 */
+    { .pattern = 0x384, .num_bits = 10 }, /* ' ' 133 */
+    { .pattern = 0x385, .num_bits = 10 }, /* ' ' 134 */
+    { .pattern = 0x386, .num_bits = 10 }, /* ' ' 135 */
+    { .pattern = 0x387, .num_bits = 10 }, /* ' ' 136 */
+    { .pattern = 0x388, .num_bits = 10 }, /* ' ' 137 */
+    { .pattern = 0x389, .num_bits = 10 }, /* ' ' 138 */
+    { .pattern = 0x38a, .num_bits = 10 }, /* ' ' 139 */
+    { .pattern = 0x38b, .num_bits = 10 }, /* ' ' 140 */
+    { .pattern = 0x38c, .num_bits = 10 }, /* ' ' 141 */
+    { .pattern = 0x38d, .num_bits = 10 }, /* ' ' 142 */
+    { .pattern = 0x38e, .num_bits = 10 }, /* ' ' 143 */
+    { .pattern = 0x38f, .num_bits = 10 }, /* ' ' 144 */
+    { .pattern = 0x390, .num_bits = 10 }, /* ' ' 145 */
+    { .pattern = 0x391, .num_bits = 10 }, /* ' ' 146 */
+    { .pattern = 0x392, .num_bits = 10 }, /* ' ' 147 */
+    { .pattern = 0x393, .num_bits = 10 }, /* ' ' 148 */
+    { .pattern = 0x394, .num_bits = 10 }, /* ' ' 149 */
+    { .pattern = 0x395, .num_bits = 10 }, /* ' ' 150 */
+    { .pattern = 0x396, .num_bits = 10 }, /* ' ' 151 */
+    { .pattern = 0x397, .num_bits = 10 }, /* ' ' 152 */
+    { .pattern = 0x398, .num_bits = 10 }, /* ' ' 153 */
+    { .pattern = 0x399, .num_bits = 10 }, /* ' ' 154 */
+    { .pattern = 0x39a, .num_bits = 10 }, /* ' ' 155 */
+    { .pattern = 0x39b, .num_bits = 10 }, /* ' ' 156 */
+    { .pattern = 0x39c, .num_bits = 10 }, /* ' ' 157 */
+    { .pattern = 0x39d, .num_bits = 10 }, /* ' ' 158 */
+    { .pattern = 0x39e, .num_bits = 10 }, /* ' ' 159 */
+    { .pattern = 0x39f, .num_bits = 10 }, /* ' ' 160 */
+    { .pattern = 0x3a0, .num_bits = 10 }, /* ' ' 161 */
+    { .pattern = 0x3a1, .num_bits = 10 }, /* ' ' 162 */
+    { .pattern = 0x3a2, .num_bits = 10 }, /* ' ' 163 */
+    { .pattern = 0x3a3, .num_bits = 10 }, /* ' ' 164 */
+    { .pattern = 0x3a4, .num_bits = 10 }, /* ' ' 165 */
+    { .pattern = 0x3a5, .num_bits = 10 }, /* ' ' 166 */
+    { .pattern = 0x3a6, .num_bits = 10 }, /* ' ' 167 */
+    { .pattern = 0x3a7, .num_bits = 10 }, /* ' ' 168 */
+    { .pattern = 0x3a8, .num_bits = 10 }, /* ' ' 169 */
+    { .pattern = 0x3a9, .num_bits = 10 }, /* ' ' 170 */
+    { .pattern = 0x3aa, .num_bits = 10 }, /* ' ' 171 */
+    { .pattern = 0x3ab, .num_bits = 10 }, /* ' ' 172 */
+    { .pattern = 0x3ac, .num_bits = 10 }, /* ' ' 173 */
+    { .pattern = 0x3ad, .num_bits = 10 }, /* ' ' 174 */
+    { .pattern = 0x3ae, .num_bits = 10 }, /* ' ' 175 */
+    { .pattern = 0x3af, .num_bits = 10 }, /* ' ' 176 */
+    { .pattern = 0x3b0, .num_bits = 10 }, /* ' ' 177 */
+    { .pattern = 0x3b1, .num_bits = 10 }, /* ' ' 178 */
+    { .pattern = 0x3b2, .num_bits = 10 }, /* ' ' 179 */
+    { .pattern = 0x3b3, .num_bits = 10 }, /* ' ' 180 */
+    { .pattern = 0x3b4, .num_bits = 10 }, /* ' ' 181 */
+    { .pattern = 0x3b5, .num_bits = 10 }, /* ' ' 182 */
+    { .pattern = 0x3b6, .num_bits = 10 }, /* ' ' 183 */
+    { .pattern = 0x3b7, .num_bits = 10 }, /* ' ' 184 */
+    { .pattern = 0x3b8, .num_bits = 10 }, /* ' ' 185 */
+    { .pattern = 0x3b9, .num_bits = 10 }, /* ' ' 186 */
+    { .pattern = 0x3ba, .num_bits = 10 }, /* ' ' 187 */
+    { .pattern = 0x3bb, .num_bits = 10 }, /* ' ' 188 */
+    { .pattern = 0x3bc, .num_bits = 10 }, /* ' ' 189 */
+    { .pattern = 0x3bd, .num_bits = 10 }, /* ' ' 190 */
+    { .pattern = 0x3be, .num_bits = 10 }, /* ' ' 191 */
+    { .pattern = 0x3bf, .num_bits = 10 }, /* ' ' 192 */
+    { .pattern = 0x3c0, .num_bits = 10 }, /* ' ' 193 */
+    { .pattern = 0x3c1, .num_bits = 10 }, /* ' ' 194 */
+    { .pattern = 0x3c2, .num_bits = 10 }, /* ' ' 195 */
+    { .pattern = 0x3c3, .num_bits = 10 }, /* ' ' 196 */
+    { .pattern = 0x3c4, .num_bits = 10 }, /* ' ' 197 */
+    { .pattern = 0x3c5, .num_bits = 10 }, /* ' ' 198 */
+    { .pattern = 0x3c6, .num_bits = 10 }, /* ' ' 199 */
+    { .pattern = 0x3c7, .num_bits = 10 }, /* ' ' 200 */
+    { .pattern = 0x3c8, .num_bits = 10 }, /* ' ' 201 */
+    { .pattern = 0x3c9, .num_bits = 10 }, /* ' ' 202 */
+    { .pattern = 0x3ca, .num_bits = 10 }, /* ' ' 203 */
+    { .pattern = 0x3cb, .num_bits = 10 }, /* ' ' 204 */
+    { .pattern = 0x3cc, .num_bits = 10 }, /* ' ' 205 */
+    { .pattern = 0x3cd, .num_bits = 10 }, /* ' ' 206 */
+    { .pattern = 0x3ce, .num_bits = 10 }, /* ' ' 207 */
+    { .pattern = 0x3cf, .num_bits = 10 }, /* ' ' 208 */
+    { .pattern = 0x3d0, .num_bits = 10 }, /* ' ' 209 */
+    { .pattern = 0x3d1, .num_bits = 10 }, /* ' ' 210 */
+    { .pattern = 0x3d2, .num_bits = 10 }, /* ' ' 211 */
+    { .pattern = 0x3d3, .num_bits = 10 }, /* ' ' 212 */
+    { .pattern = 0x3d4, .num_bits = 10 }, /* ' ' 213 */
+    { .pattern = 0x3d5, .num_bits = 10 }, /* ' ' 214 */
+    { .pattern = 0x3d6, .num_bits = 10 }, /* ' ' 215 */
+    { .pattern = 0x3d7, .num_bits = 10 }, /* ' ' 216 */
+    { .pattern = 0x3d8, .num_bits = 10 }, /* ' ' 217 */
+    { .pattern = 0x3d9, .num_bits = 10 }, /* ' ' 218 */
+    { .pattern = 0x3da, .num_bits = 10 }, /* ' ' 219 */
+    { .pattern = 0x3db, .num_bits = 10 }, /* ' ' 220 */
+    { .pattern = 0x3dc, .num_bits = 10 }, /* ' ' 221 */
+    { .pattern = 0x3dd, .num_bits = 10 }, /* ' ' 222 */
+    { .pattern = 0x3de, .num_bits = 10 }, /* ' ' 223 */
+    { .pattern = 0x3df, .num_bits = 10 }, /* ' ' 224 */
+    { .pattern = 0x3e0, .num_bits = 10 }, /* ' ' 225 */
+    { .pattern = 0x3e1, .num_bits = 10 }, /* ' ' 226 */
+    { .pattern = 0x3e2, .num_bits = 10 }, /* ' ' 227 */
+    { .pattern = 0x3e3, .num_bits = 10 }, /* ' ' 228 */
+    { .pattern = 0x3e4, .num_bits = 10 }, /* ' ' 229 */
+    { .pattern = 0x3e5, .num_bits = 10 }, /* ' ' 230 */
+    { .pattern = 0x3e6, .num_bits = 10 }, /* ' ' 231 */
+    { .pattern = 0x3e7, .num_bits = 10 }, /* ' ' 232 */
+    { .pattern = 0x3e8, .num_bits = 10 }, /* ' ' 233 */
+    { .pattern = 0x3e9, .num_bits = 10 }, /* ' ' 234 */
+    { .pattern = 0x3ea, .num_bits = 10 }, /* ' ' 235 */
+    { .pattern = 0x3eb, .num_bits = 10 }, /* ' ' 236 */
+    { .pattern = 0x3ec, .num_bits = 10 }, /* ' ' 237 */
+    { .pattern = 0x3ed, .num_bits = 10 }, /* ' ' 238 */
+    { .pattern = 0x3ee, .num_bits = 10 }, /* ' ' 239 */
+    { .pattern = 0x3ef, .num_bits = 10 }, /* ' ' 240 */
+    { .pattern = 0x3f0, .num_bits = 10 }, /* ' ' 241 */
+    { .pattern = 0x3f1, .num_bits = 10 }, /* ' ' 242 */
+    { .pattern = 0x3f2, .num_bits = 10 }, /* ' ' 243 */
+    { .pattern = 0x3f3, .num_bits = 10 }, /* ' ' 244 */
+    { .pattern = 0x3f4, .num_bits = 10 }, /* ' ' 245 */
+    { .pattern = 0x3f5, .num_bits = 10 }, /* ' ' 246 */
+    { .pattern = 0x3f6, .num_bits = 10 }, /* ' ' 247 */
+    { .pattern = 0x3f7, .num_bits = 10 }, /* ' ' 248 */
+    { .pattern = 0x3f8, .num_bits = 10 }, /* ' ' 249 */
+    { .pattern = 0x3f9, .num_bits = 10 }, /* ' ' 250 */
+    { .pattern = 0x3fa, .num_bits = 10 }, /* ' ' 251 */
+    { .pattern = 0x3fb, .num_bits = 10 }, /* ' ' 252 */
+    { .pattern = 0x3fc, .num_bits = 10 }, /* ' ' 253 */
+    { .pattern = 0x3fd, .num_bits = 10 }, /* ' ' 254 */
+    { .pattern = 0x3fe, .num_bits = 10 }, /* ' ' 255 */
+};
+
+static struct aws_huffman_code encode_symbol(uint8_t symbol, void *userdata) {
+    (void)userdata;
+
+    return code_points[symbol];
+}
+
+static const uint8_t code_lengths[] = {
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  8, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+     5, 10, 10, 10, 10, 10, 10,  7, 10, 10, 10, 10,  8,  9,  7, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  8,
+    10, 10,  8,  9,  9,  9,  9,  9,  9,  8, 10, 10,  9,  9, 10, 10,
+     9, 10, 10, 10,  8, 10,  9,  8, 10,  9, 10, 10, 10, 10, 10, 10,
+    10,  5,  7,  6,  6,  5,  6,  7,  6,  5,  8,  6,  6,  6,  5,  5,
+     7,  9,  5,  5,  5,  5,  8,  6,  8,  6, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+};
+
+/* NOLINTNEXTLINE(readability-function-size) */
+static uint8_t tree_decode_symbol(uint32_t bits, uint8_t *symbol, void *userdata) {
+    (void)userdata;
+
+    if (bits & 0x80000000) {
+        goto node_1;
+    } else {
+        goto node_0;
+    }
+
+node_0:
+    if (bits & 0x40000000) {
+        goto node_01;
+    } else {
+        goto node_00;
+    }
+
+node_00:
+    if (bits & 0x20000000) {
+        goto node_001;
+    } else {
+        return 0; /* invalid node */
+    }
+
+node_001:
+    if (bits & 0x10000000) {
+        goto node_0011;
+    } else {
+        goto node_0010;
+    }
+
+node_0010:
+    if (bits & 0x8000000) {
+        *symbol = 97;
+        return 5;
+    } else {
+        *symbol = 32;
+        return 5;
+    }
+
+node_0011:
+    if (bits & 0x8000000) {
+        *symbol = 105;
+        return 5;
+    } else {
+        *symbol = 101;
+        return 5;
+    }
+
+node_01:
+    if (bits & 0x20000000) {
+        goto node_011;
+    } else {
+        goto node_010;
+    }
+
+node_010:
+    if (bits & 0x10000000) {
+        goto node_0101;
+    } else {
+        goto node_0100;
+    }
+
+node_0100:
+    if (bits & 0x8000000) {
+        *symbol = 111;
+        return 5;
+    } else {
+        *symbol = 110;
+        return 5;
+    }
+
+node_0101:
+    if (bits & 0x8000000) {
+        *symbol = 115;
+        return 5;
+    } else {
+        *symbol = 114;
+        return 5;
+    }
+
+node_011:
+    if (bits & 0x10000000) {
+        return 0; /* invalid node */
+    } else {
+        goto node_0110;
+    }
+
+node_0110:
+    if (bits & 0x8000000) {
+        *symbol = 117;
+        return 5;
+    } else {
+        *symbol = 116;
+        return 5;
+    }
+
+node_1:
+    if (bits & 0x40000000) {
+        goto node_11;
+    } else {
+        goto node_10;
+    }
+
+node_10:
+    if (bits & 0x20000000) {
+        goto node_101;
+    } else {
+        goto node_100;
+    }
+
+node_100:
+    if (bits & 0x10000000) {
+        goto node_1001;
+    } else {
+        goto node_1000;
+    }
+
+node_1000:
+    if (bits & 0x8000000) {
+        goto node_10001;
+    } else {
+        goto node_10000;
+    }
+
+node_10000:
+    if (bits & 0x4000000) {
+        *symbol = 100;
+        return 6;
+    } else {
+        *symbol = 99;
+        return 6;
+    }
+
+node_10001:
+    if (bits & 0x4000000) {
+        *symbol = 104;
+        return 6;
+    } else {
+        *symbol = 102;
+        return 6;
+    }
+
+node_1001:
+    if (bits & 0x8000000) {
+        goto node_10011;
+    } else {
+        goto node_10010;
+    }
+
+node_10010:
+    if (bits & 0x4000000) {
+        *symbol = 108;
+        return 6;
+    } else {
+        *symbol = 107;
+        return 6;
+    }
+
+node_10011:
+    if (bits & 0x4000000) {
+        *symbol = 119;
+        return 6;
+    } else {
+        *symbol = 109;
+        return 6;
+    }
+
+node_101:
+    if (bits & 0x10000000) {
+        goto node_1011;
+    } else {
+        goto node_1010;
+    }
+
+node_1010:
+    if (bits & 0x8000000) {
+        goto node_10101;
+    } else {
+        goto node_10100;
+    }
+
+node_10100:
+    if (bits & 0x4000000) {
+        return 0; /* invalid node */
+    } else {
+        *symbol = 121;
+        return 6;
+    }
+
+node_10101:
+    if (bits & 0x4000000) {
+        goto node_101011;
+    } else {
+        return 0; /* invalid node */
+    }
+
+node_101011:
+    if (bits & 0x2000000) {
+        *symbol = 46;
+        return 7;
+    } else {
+        *symbol = 39;
+        return 7;
+    }
+
+node_1011:
+    if (bits & 0x8000000) {
+        goto node_10111;
+    } else {
+        goto node_10110;
+    }
+
+node_10110:
+    if (bits & 0x4000000) {
+        goto node_101101;
+    } else {
+        goto node_101100;
+    }
+
+node_101100:
+    if (bits & 0x2000000) {
+        *symbol = 103;
+        return 7;
+    } else {
+        *symbol = 98;
+        return 7;
+    }
+
+node_101101:
+    if (bits & 0x2000000) {
+        return 0; /* invalid node */
+    } else {
+        *symbol = 112;
+        return 7;
+    }
+
+node_10111:
+    if (bits & 0x4000000) {
+        goto node_101111;
+    } else {
+        goto node_101110;
+    }
+
+node_101110:
+    if (bits & 0x2000000) {
+        goto node_1011101;
+    } else {
+        goto node_1011100;
+    }
+
+node_1011100:
+    if (bits & 0x1000000) {
+        *symbol = 44;
+        return 8;
+    } else {
+        *symbol = 10;
+        return 8;
+    }
+
+node_1011101:
+    if (bits & 0x1000000) {
+        *symbol = 66;
+        return 8;
+    } else {
+        *symbol = 63;
+        return 8;
+    }
+
+node_101111:
+    if (bits & 0x2000000) {
+        goto node_1011111;
+    } else {
+        goto node_1011110;
+    }
+
+node_1011110:
+    if (bits & 0x1000000) {
+        *symbol = 84;
+        return 8;
+    } else {
+        *symbol = 73;
+        return 8;
+    }
+
+node_1011111:
+    if (bits & 0x1000000) {
+        *symbol = 106;
+        return 8;
+    } else {
+        *symbol = 87;
+        return 8;
+    }
+
+node_11:
+    if (bits & 0x20000000) {
+        goto node_111;
+    } else {
+        goto node_110;
+    }
+
+node_110:
+    if (bits & 0x10000000) {
+        goto node_1101;
+    } else {
+        goto node_1100;
+    }
+
+node_1100:
+    if (bits & 0x8000000) {
+        goto node_11001;
+    } else {
+        goto node_11000;
+    }
+
+node_11000:
+    if (bits & 0x4000000) {
+        goto node_110001;
+    } else {
+        goto node_110000;
+    }
+
+node_110000:
+    if (bits & 0x2000000) {
+        return 0; /* invalid node */
+    } else {
+        goto node_1100000;
+    }
+
+node_1100000:
+    if (bits & 0x1000000) {
+        *symbol = 120;
+        return 8;
+    } else {
+        *symbol = 118;
+        return 8;
+    }
+
+node_110001:
+    if (bits & 0x2000000) {
+        goto node_1100011;
+    } else {
+        goto node_1100010;
+    }
+
+node_1100010:
+    if (bits & 0x1000000) {
+        goto node_11000101;
+    } else {
+        goto node_11000100;
+    }
+
+node_11000100:
+    if (bits & 0x800000) {
+        *symbol = 67;
+        return 9;
+    } else {
+        *symbol = 45;
+        return 9;
+    }
+
+node_11000101:
+    if (bits & 0x800000) {
+        *symbol = 69;
+        return 9;
+    } else {
+        *symbol = 68;
+        return 9;
+    }
+
+node_1100011:
+    if (bits & 0x1000000) {
+        goto node_11000111;
+    } else {
+        goto node_11000110;
+    }
+
+node_11000110:
+    if (bits & 0x800000) {
+        *symbol = 71;
+        return 9;
+    } else {
+        *symbol = 70;
+        return 9;
+    }
+
+node_11000111:
+    if (bits & 0x800000) {
+        *symbol = 76;
+        return 9;
+    } else {
+        *symbol = 72;
+        return 9;
+    }
+
+node_11001:
+    if (bits & 0x4000000) {
+        goto node_110011;
+    } else {
+        goto node_110010;
+    }
+
+node_110010:
+    if (bits & 0x2000000) {
+        goto node_1100101;
+    } else {
+        goto node_1100100;
+    }
+
+node_1100100:
+    if (bits & 0x1000000) {
+        goto node_11001001;
+    } else {
+        goto node_11001000;
+    }
+
+node_11001000:
+    if (bits & 0x800000) {
+        *symbol = 80;
+        return 9;
+    } else {
+        *symbol = 77;
+        return 9;
+    }
+
+node_11001001:
+    if (bits & 0x800000) {
+        *symbol = 89;
+        return 9;
+    } else {
+        *symbol = 86;
+        return 9;
+    }
+
+node_1100101:
+    if (bits & 0x1000000) {
+        goto node_11001011;
+    } else {
+        goto node_11001010;
+    }
+
+node_11001010:
+    if (bits & 0x800000) {
+        return 0; /* invalid node */
+    } else {
+        *symbol = 113;
+        return 9;
+    }
+
+node_11001011:
+    if (bits & 0x800000) {
+        goto node_110010111;
+    } else {
+        return 0; /* invalid node */
+    }
+
+node_110010111:
+    if (bits & 0x400000) {
+        *symbol = 1;
+        return 10;
+    } else {
+        *symbol = 0;
+        return 10;
+    }
+
+node_110011:
+    if (bits & 0x2000000) {
+        goto node_1100111;
+    } else {
+        goto node_1100110;
+    }
+
+node_1100110:
+    if (bits & 0x1000000) {
+        goto node_11001101;
+    } else {
+        goto node_11001100;
+    }
+
+node_11001100:
+    if (bits & 0x800000) {
+        goto node_110011001;
+    } else {
+        goto node_110011000;
+    }
+
+node_110011000:
+    if (bits & 0x400000) {
+        *symbol = 3;
+        return 10;
+    } else {
+        *symbol = 2;
+        return 10;
+    }
+
+node_110011001:
+    if (bits & 0x400000) {
+        *symbol = 5;
+        return 10;
+    } else {
+        *symbol = 4;
+        return 10;
+    }
+
+node_11001101:
+    if (bits & 0x800000) {
+        goto node_110011011;
+    } else {
+        goto node_110011010;
+    }
+
+node_110011010:
+    if (bits & 0x400000) {
+        *symbol = 7;
+        return 10;
+    } else {
+        *symbol = 6;
+        return 10;
+    }
+
+node_110011011:
+    if (bits & 0x400000) {
+        *symbol = 9;
+        return 10;
+    } else {
+        *symbol = 8;
+        return 10;
+    }
+
+node_1100111:
+    if (bits & 0x1000000) {
+        goto node_11001111;
+    } else {
+        goto node_11001110;
+    }
+
+node_11001110:
+    if (bits & 0x800000) {
+        goto node_110011101;
+    } else {
+        goto node_110011100;
+    }
+
+node_110011100:
+    if (bits & 0x400000) {
+        *symbol = 12;
+        return 10;
+    } else {
+        *symbol = 11;
+        return 10;
+    }
+
+node_110011101:
+    if (bits & 0x400000) {
+        *symbol = 14;
+        return 10;
+    } else {
+        *symbol = 13;
+        return 10;
+    }
+
+node_11001111:
+    if (bits & 0x800000) {
+        goto node_110011111;
+    } else {
+        goto node_110011110;
+    }
+
+node_110011110:
+    if (bits & 0x400000) {
+        *symbol = 16;
+        return 10;
+    } else {
+        *symbol = 15;
+        return 10;
+    }
+
+node_110011111:
+    if (bits & 0x400000) {
+        *symbol = 18;
+        return 10;
+    } else {
+        *symbol = 17;
+        return 10;
+    }
+
+node_1101:
+    if (bits & 0x8000000) {
+        goto node_11011;
+    } else {
+        goto node_11010;
+    }
+
+node_11010:
+    if (bits & 0x4000000) {
+        goto node_110101;
+    } else {
+        goto node_110100;
+    }
+
+node_110100:
+    if (bits & 0x2000000) {
+        goto node_1101001;
+    } else {
+        goto node_1101000;
+    }
+
+node_1101000:
+    if (bits & 0x1000000) {
+        goto node_11010001;
+    } else {
+        goto node_11010000;
+    }
+
+node_11010000:
+    if (bits & 0x800000) {
+        goto node_110100001;
+    } else {
+        goto node_110100000;
+    }
+
+node_110100000:
+    if (bits & 0x400000) {
+        *symbol = 20;
+        return 10;
+    } else {
+        *symbol = 19;
+        return 10;
+    }
+
+node_110100001:
+    if (bits & 0x400000) {
+        *symbol = 22;
+        return 10;
+    } else {
+        *symbol = 21;
+        return 10;
+    }
+
+node_11010001:
+    if (bits & 0x800000) {
+        goto node_110100011;
+    } else {
+        goto node_110100010;
+    }
+
+node_110100010:
+    if (bits & 0x400000) {
+        *symbol = 24;
+        return 10;
+    } else {
+        *symbol = 23;
+        return 10;
+    }
+
+node_110100011:
+    if (bits & 0x400000) {
+        *symbol = 26;
+        return 10;
+    } else {
+        *symbol = 25;
+        return 10;
+    }
+
+node_1101001:
+    if (bits & 0x1000000) {
+        goto node_11010011;
+    } else {
+        goto node_11010010;
+    }
+
+node_11010010:
+    if (bits & 0x800000) {
+        goto node_110100101;
+    } else {
+        goto node_110100100;
+    }
+
+node_110100100:
+    if (bits & 0x400000) {
+        *symbol = 28;
+        return 10;
+    } else {
+        *symbol = 27;
+        return 10;
+    }
+
+node_110100101:
+    if (bits & 0x400000) {
+        *symbol = 30;
+        return 10;
+    } else {
+        *symbol = 29;
+        return 10;
+    }
+
+node_11010011:
+    if (bits & 0x800000) {
+        goto node_110100111;
+    } else {
+        goto node_110100110;
+    }
+
+node_110100110:
+    if (bits & 0x400000) {
+        *symbol = 33;
+        return 10;
+    } else {
+        *symbol = 31;
+        return 10;
+    }
+
+node_110100111:
+    if (bits & 0x400000) {
+        *symbol = 35;
+        return 10;
+    } else {
+        *symbol = 34;
+        return 10;
+    }
+
+node_110101:
+    if (bits & 0x2000000) {
+        goto node_1101011;
+    } else {
+        goto node_1101010;
+    }
+
+node_1101010:
+    if (bits & 0x1000000) {
+        goto node_11010101;
+    } else {
+        goto node_11010100;
+    }
+
+node_11010100:
+    if (bits & 0x800000) {
+        goto node_110101001;
+    } else {
+        goto node_110101000;
+    }
+
+node_110101000:
+    if (bits & 0x400000) {
+        *symbol = 37;
+        return 10;
+    } else {
+        *symbol = 36;
+        return 10;
+    }
+
+node_110101001:
+    if (bits & 0x400000) {
+        *symbol = 40;
+        return 10;
+    } else {
+        *symbol = 38;
+        return 10;
+    }
+
+node_11010101:
+    if (bits & 0x800000) {
+        goto node_110101011;
+    } else {
+        goto node_110101010;
+    }
+
+node_110101010:
+    if (bits & 0x400000) {
+        *symbol = 42;
+        return 10;
+    } else {
+        *symbol = 41;
+        return 10;
+    }
+
+node_110101011:
+    if (bits & 0x400000) {
+        *symbol = 47;
+        return 10;
+    } else {
+        *symbol = 43;
+        return 10;
+    }
+
+node_1101011:
+    if (bits & 0x1000000) {
+        goto node_11010111;
+    } else {
+        goto node_11010110;
+    }
+
+node_11010110:
+    if (bits & 0x800000) {
+        goto node_110101101;
+    } else {
+        goto node_110101100;
+    }
+
+node_110101100:
+    if (bits & 0x400000) {
+        *symbol = 49;
+        return 10;
+    } else {
+        *symbol = 48;
+        return 10;
+    }
+
+node_110101101:
+    if (bits & 0x400000) {
+        *symbol = 51;
+        return 10;
+    } else {
+        *symbol = 50;
+        return 10;
+    }
+
+node_11010111:
+    if (bits & 0x800000) {
+        goto node_110101111;
+    } else {
+        goto node_110101110;
+    }
+
+node_110101110:
+    if (bits & 0x400000) {
+        *symbol = 53;
+        return 10;
+    } else {
+        *symbol = 52;
+        return 10;
+    }
+
+node_110101111:
+    if (bits & 0x400000) {
+        *symbol = 55;
+        return 10;
+    } else {
+        *symbol = 54;
+        return 10;
+    }
+
+node_11011:
+    if (bits & 0x4000000) {
+        goto node_110111;
+    } else {
+        goto node_110110;
+    }
+
+node_110110:
+    if (bits & 0x2000000) {
+        goto node_1101101;
+    } else {
+        goto node_1101100;
+    }
+
+node_1101100:
+    if (bits & 0x1000000) {
+        goto node_11011001;
+    } else {
+        goto node_11011000;
+    }
+
+node_11011000:
+    if (bits & 0x800000) {
+        goto node_110110001;
+    } else {
+        goto node_110110000;
+    }
+
+node_110110000:
+    if (bits & 0x400000) {
+        *symbol = 57;
+        return 10;
+    } else {
+        *symbol = 56;
+        return 10;
+    }
+
+node_110110001:
+    if (bits & 0x400000) {
+        *symbol = 59;
+        return 10;
+    } else {
+        *symbol = 58;
+        return 10;
+    }
+
+node_11011001:
+    if (bits & 0x800000) {
+        goto node_110110011;
+    } else {
+        goto node_110110010;
+    }
+
+node_110110010:
+    if (bits & 0x400000) {
+        *symbol = 61;
+        return 10;
+    } else {
+        *symbol = 60;
+        return 10;
+    }
+
+node_110110011:
+    if (bits & 0x400000) {
+        *symbol = 64;
+        return 10;
+    } else {
+        *symbol = 62;
+        return 10;
+    }
+
+node_1101101:
+    if (bits & 0x1000000) {
+        goto node_11011011;
+    } else {
+        goto node_11011010;
+    }
+
+node_11011010:
+    if (bits & 0x800000) {
+        goto node_110110101;
+    } else {
+        goto node_110110100;
+    }
+
+node_110110100:
+    if (bits & 0x400000) {
+        *symbol = 74;
+        return 10;
+    } else {
+        *symbol = 65;
+        return 10;
+    }
+
+node_110110101:
+    if (bits & 0x400000) {
+        *symbol = 78;
+        return 10;
+    } else {
+        *symbol = 75;
+        return 10;
+    }
+
+node_11011011:
+    if (bits & 0x800000) {
+        goto node_110110111;
+    } else {
+        goto node_110110110;
+    }
+
+node_110110110:
+    if (bits & 0x400000) {
+        *symbol = 81;
+        return 10;
+    } else {
+        *symbol = 79;
+        return 10;
+    }
+
+node_110110111:
+    if (bits & 0x400000) {
+        *symbol = 83;
+        return 10;
+    } else {
+        *symbol = 82;
+        return 10;
+    }
+
+node_110111:
+    if (bits & 0x2000000) {
+        goto node_1101111;
+    } else {
+        goto node_1101110;
+    }
+
+node_1101110:
+    if (bits & 0x1000000) {
+        goto node_11011101;
+    } else {
+        goto node_11011100;
+    }
+
+node_11011100:
+    if (bits & 0x800000) {
+        goto node_110111001;
+    } else {
+        goto node_110111000;
+    }
+
+node_110111000:
+    if (bits & 0x400000) {
+        *symbol = 88;
+        return 10;
+    } else {
+        *symbol = 85;
+        return 10;
+    }
+
+node_110111001:
+    if (bits & 0x400000) {
+        *symbol = 91;
+        return 10;
+    } else {
+        *symbol = 90;
+        return 10;
+    }
+
+node_11011101:
+    if (bits & 0x800000) {
+        goto node_110111011;
+    } else {
+        goto node_110111010;
+    }
+
+node_110111010:
+    if (bits & 0x400000) {
+        *symbol = 93;
+        return 10;
+    } else {
+        *symbol = 92;
+        return 10;
+    }
+
+node_110111011:
+    if (bits & 0x400000) {
+        *symbol = 95;
+        return 10;
+    } else {
+        *symbol = 94;
+        return 10;
+    }
+
+node_1101111:
+    if (bits & 0x1000000) {
+        goto node_11011111;
+    } else {
+        goto node_11011110;
+    }
+
+node_11011110:
+    if (bits & 0x800000) {
+        goto node_110111101;
+    } else {
+        goto node_110111100;
+    }
+
+node_110111100:
+    if (bits & 0x400000) {
+        *symbol = 122;
+        return 10;
+    } else {
+        *symbol = 96;
+        return 10;
+    }
+
+node_110111101:
+    if (bits & 0x400000) {
+        *symbol = 124;
+        return 10;
+    } else {
+        *symbol = 123;
+        return 10;
+    }
+
+node_11011111:
+    if (bits & 0x800000) {
+        goto node_110111111;
+    } else {
+        goto node_110111110;
+    }
+
+node_110111110:
+    if (bits & 0x400000) {
+        *symbol = 126;
+        return 10;
+    } else {
+        *symbol = 125;
+        return 10;
+    }
+
+node_110111111:
+    if (bits & 0x400000) {
+        *symbol = 128;
+        return 10;
+    } else {
+        *symbol = 127;
+        return 10;
+    }
+
+node_111:
+    if (bits & 0x10000000) {
+        goto node_1111;
+    } else {
+        goto node_1110;
+    }
+
+node_1110:
+    if (bits & 0x8000000) {
+        goto node_11101;
+    } else {
+        goto node_11100;
+    }
+
+node_11100:
+    if (bits & 0x4000000) {
+        goto node_111001;
+    } else {
+        goto node_111000;
+    }
+
+node_111000:
+    if (bits & 0x2000000) {
+        goto node_1110001;
+    } else {
+        goto node_1110000;
+    }
+
+node_1110000:
+    if (bits & 0x1000000) {
+        goto node_11100001;
+    } else {
+        goto node_11100000;
+    }
+
+node_11100000:
+    if (bits & 0x800000) {
+        goto node_111000001;
+    } else {
+        goto node_111000000;
+    }
+
+node_111000000:
+    if (bits & 0x400000) {
+        *symbol = 130;
+        return 10;
+    } else {
+        *symbol = 129;
+        return 10;
+    }
+
+node_111000001:
+    if (bits & 0x400000) {
+        *symbol = 132;
+        return 10;
+    } else {
+        *symbol = 131;
+        return 10;
+    }
+
+node_11100001:
+    if (bits & 0x800000) {
+        goto node_111000011;
+    } else {
+        goto node_111000010;
+    }
+
+node_111000010:
+    if (bits & 0x400000) {
+        *symbol = 134;
+        return 10;
+    } else {
+        *symbol = 133;
+        return 10;
+    }
+
+node_111000011:
+    if (bits & 0x400000) {
+        *symbol = 136;
+        return 10;
+    } else {
+        *symbol = 135;
+        return 10;
+    }
+
+node_1110001:
+    if (bits & 0x1000000) {
+        goto node_11100011;
+    } else {
+        goto node_11100010;
+    }
+
+node_11100010:
+    if (bits & 0x800000) {
+        goto node_111000101;
+    } else {
+        goto node_111000100;
+    }
+
+node_111000100:
+    if (bits & 0x400000) {
+        *symbol = 138;
+        return 10;
+    } else {
+        *symbol = 137;
+        return 10;
+    }
+
+node_111000101:
+    if (bits & 0x400000) {
+        *symbol = 140;
+        return 10;
+    } else {
+        *symbol = 139;
+        return 10;
+    }
+
+node_11100011:
+    if (bits & 0x800000) {
+        goto node_111000111;
+    } else {
+        goto node_111000110;
+    }
+
+node_111000110:
+    if (bits & 0x400000) {
+        *symbol = 142;
+        return 10;
+    } else {
+        *symbol = 141;
+        return 10;
+    }
+
+node_111000111:
+    if (bits & 0x400000) {
+        *symbol = 144;
+        return 10;
+    } else {
+        *symbol = 143;
+        return 10;
+    }
+
+node_111001:
+    if (bits & 0x2000000) {
+        goto node_1110011;
+    } else {
+        goto node_1110010;
+    }
+
+node_1110010:
+    if (bits & 0x1000000) {
+        goto node_11100101;
+    } else {
+        goto node_11100100;
+    }
+
+node_11100100:
+    if (bits & 0x800000) {
+        goto node_111001001;
+    } else {
+        goto node_111001000;
+    }
+
+node_111001000:
+    if (bits & 0x400000) {
+        *symbol = 146;
+        return 10;
+    } else {
+        *symbol = 145;
+        return 10;
+    }
+
+node_111001001:
+    if (bits & 0x400000) {
+        *symbol = 148;
+        return 10;
+    } else {
+        *symbol = 147;
+        return 10;
+    }
+
+node_11100101:
+    if (bits & 0x800000) {
+        goto node_111001011;
+    } else {
+        goto node_111001010;
+    }
+
+node_111001010:
+    if (bits & 0x400000) {
+        *symbol = 150;
+        return 10;
+    } else {
+        *symbol = 149;
+        return 10;
+    }
+
+node_111001011:
+    if (bits & 0x400000) {
+        *symbol = 152;
+        return 10;
+    } else {
+        *symbol = 151;
+        return 10;
+    }
+
+node_1110011:
+    if (bits & 0x1000000) {
+        goto node_11100111;
+    } else {
+        goto node_11100110;
+    }
+
+node_11100110:
+    if (bits & 0x800000) {
+        goto node_111001101;
+    } else {
+        goto node_111001100;
+    }
+
+node_111001100:
+    if (bits & 0x400000) {
+        *symbol = 154;
+        return 10;
+    } else {
+        *symbol = 153;
+        return 10;
+    }
+
+node_111001101:
+    if (bits & 0x400000) {
+        *symbol = 156;
+        return 10;
+    } else {
+        *symbol = 155;
+        return 10;
+    }
+
+node_11100111:
+    if (bits & 0x800000) {
+        goto node_111001111;
+    } else {
+        goto node_111001110;
+    }
+
+node_111001110:
+    if (bits & 0x400000) {
+        *symbol = 158;
+        return 10;
+    } else {
+        *symbol = 157;
+        return 10;
+    }
+
+node_111001111:
+    if (bits & 0x400000) {
+        *symbol = 160;
+        return 10;
+    } else {
+        *symbol = 159;
+        return 10;
+    }
+
+node_11101:
+    if (bits & 0x4000000) {
+        goto node_111011;
+    } else {
+        goto node_111010;
+    }
+
+node_111010:
+    if (bits & 0x2000000) {
+        goto node_1110101;
+    } else {
+        goto node_1110100;
+    }
+
+node_1110100:
+    if (bits & 0x1000000) {
+        goto node_11101001;
+    } else {
+        goto node_11101000;
+    }
+
+node_11101000:
+    if (bits & 0x800000) {
+        goto node_111010001;
+    } else {
+        goto node_111010000;
+    }
+
+node_111010000:
+    if (bits & 0x400000) {
+        *symbol = 162;
+        return 10;
+    } else {
+        *symbol = 161;
+        return 10;
+    }
+
+node_111010001:
+    if (bits & 0x400000) {
+        *symbol = 164;
+        return 10;
+    } else {
+        *symbol = 163;
+        return 10;
+    }
+
+node_11101001:
+    if (bits & 0x800000) {
+        goto node_111010011;
+    } else {
+        goto node_111010010;
+    }
+
+node_111010010:
+    if (bits & 0x400000) {
+        *symbol = 166;
+        return 10;
+    } else {
+        *symbol = 165;
+        return 10;
+    }
+
+node_111010011:
+    if (bits & 0x400000) {
+        *symbol = 168;
+        return 10;
+    } else {
+        *symbol = 167;
+        return 10;
+    }
+
+node_1110101:
+    if (bits & 0x1000000) {
+        goto node_11101011;
+    } else {
+        goto node_11101010;
+    }
+
+node_11101010:
+    if (bits & 0x800000) {
+        goto node_111010101;
+    } else {
+        goto node_111010100;
+    }
+
+node_111010100:
+    if (bits & 0x400000) {
+        *symbol = 170;
+        return 10;
+    } else {
+        *symbol = 169;
+        return 10;
+    }
+
+node_111010101:
+    if (bits & 0x400000) {
+        *symbol = 172;
+        return 10;
+    } else {
+        *symbol = 171;
+        return 10;
+    }
+
+node_11101011:
+    if (bits & 0x800000) {
+        goto node_111010111;
+    } else {
+        goto node_111010110;
+    }
+
+node_111010110:
+    if (bits & 0x400000) {
+        *symbol = 174;
+        return 10;
+    } else {
+        *symbol = 173;
+        return 10;
+    }
+
+node_111010111:
+    if (bits & 0x400000) {
+        *symbol = 176;
+        return 10;
+    } else {
+        *symbol = 175;
+        return 10;
+    }
+
+node_111011:
+    if (bits & 0x2000000) {
+        goto node_1110111;
+    } else {
+        goto node_1110110;
+    }
+
+node_1110110:
+    if (bits & 0x1000000) {
+        goto node_11101101;
+    } else {
+        goto node_11101100;
+    }
+
+node_11101100:
+    if (bits & 0x800000) {
+        goto node_111011001;
+    } else {
+        goto node_111011000;
+    }
+
+node_111011000:
+    if (bits & 0x400000) {
+        *symbol = 178;
+        return 10;
+    } else {
+        *symbol = 177;
+        return 10;
+    }
+
+node_111011001:
+    if (bits & 0x400000) {
+        *symbol = 180;
+        return 10;
+    } else {
+        *symbol = 179;
+        return 10;
+    }
+
+node_11101101:
+    if (bits & 0x800000) {
+        goto node_111011011;
+    } else {
+        goto node_111011010;
+    }
+
+node_111011010:
+    if (bits & 0x400000) {
+        *symbol = 182;
+        return 10;
+    } else {
+        *symbol = 181;
+        return 10;
+    }
+
+node_111011011:
+    if (bits & 0x400000) {
+        *symbol = 184;
+        return 10;
+    } else {
+        *symbol = 183;
+        return 10;
+    }
+
+node_1110111:
+    if (bits & 0x1000000) {
+        goto node_11101111;
+    } else {
+        goto node_11101110;
+    }
+
+node_11101110:
+    if (bits & 0x800000) {
+        goto node_111011101;
+    } else {
+        goto node_111011100;
+    }
+
+node_111011100:
+    if (bits & 0x400000) {
+        *symbol = 186;
+        return 10;
+    } else {
+        *symbol = 185;
+        return 10;
+    }
+
+node_111011101:
+    if (bits & 0x400000) {
+        *symbol = 188;
+        return 10;
+    } else {
+        *symbol = 187;
+        return 10;
+    }
+
+node_11101111:
+    if (bits & 0x800000) {
+        goto node_111011111;
+    } else {
+        goto node_111011110;
+    }
+
+node_111011110:
+    if (bits & 0x400000) {
+        *symbol = 190;
+        return 10;
+    } else {
+        *symbol = 189;
+        return 10;
+    }
+
+node_111011111:
+    if (bits & 0x400000) {
+        *symbol = 192;
+        return 10;
+    } else {
+        *symbol = 191;
+        return 10;
+    }
+
+node_1111:
+    if (bits & 0x8000000) {
+        goto node_11111;
+    } else {
+        goto node_11110;
+    }
+
+node_11110:
+    if (bits & 0x4000000) {
+        goto node_111101;
+    } else {
+        goto node_111100;
+    }
+
+node_111100:
+    if (bits & 0x2000000) {
+        goto node_1111001;
+    } else {
+        goto node_1111000;
+    }
+
+node_1111000:
+    if (bits & 0x1000000) {
+        goto node_11110001;
+    } else {
+        goto node_11110000;
+    }
+
+node_11110000:
+    if (bits & 0x800000) {
+        goto node_111100001;
+    } else {
+        goto node_111100000;
+    }
+
+node_111100000:
+    if (bits & 0x400000) {
+        *symbol = 194;
+        return 10;
+    } else {
+        *symbol = 193;
+        return 10;
+    }
+
+node_111100001:
+    if (bits & 0x400000) {
+        *symbol = 196;
+        return 10;
+    } else {
+        *symbol = 195;
+        return 10;
+    }
+
+node_11110001:
+    if (bits & 0x800000) {
+        goto node_111100011;
+    } else {
+        goto node_111100010;
+    }
+
+node_111100010:
+    if (bits & 0x400000) {
+        *symbol = 198;
+        return 10;
+    } else {
+        *symbol = 197;
+        return 10;
+    }
+
+node_111100011:
+    if (bits & 0x400000) {
+        *symbol = 200;
+        return 10;
+    } else {
+        *symbol = 199;
+        return 10;
+    }
+
+node_1111001:
+    if (bits & 0x1000000) {
+        goto node_11110011;
+    } else {
+        goto node_11110010;
+    }
+
+node_11110010:
+    if (bits & 0x800000) {
+        goto node_111100101;
+    } else {
+        goto node_111100100;
+    }
+
+node_111100100:
+    if (bits & 0x400000) {
+        *symbol = 202;
+        return 10;
+    } else {
+        *symbol = 201;
+        return 10;
+    }
+
+node_111100101:
+    if (bits & 0x400000) {
+        *symbol = 204;
+        return 10;
+    } else {
+        *symbol = 203;
+        return 10;
+    }
+
+node_11110011:
+    if (bits & 0x800000) {
+        goto node_111100111;
+    } else {
+        goto node_111100110;
+    }
+
+node_111100110:
+    if (bits & 0x400000) {
+        *symbol = 206;
+        return 10;
+    } else {
+        *symbol = 205;
+        return 10;
+    }
+
+node_111100111:
+    if (bits & 0x400000) {
+        *symbol = 208;
+        return 10;
+    } else {
+        *symbol = 207;
+        return 10;
+    }
+
+node_111101:
+    if (bits & 0x2000000) {
+        goto node_1111011;
+    } else {
+        goto node_1111010;
+    }
+
+node_1111010:
+    if (bits & 0x1000000) {
+        goto node_11110101;
+    } else {
+        goto node_11110100;
+    }
+
+node_11110100:
+    if (bits & 0x800000) {
+        goto node_111101001;
+    } else {
+        goto node_111101000;
+    }
+
+node_111101000:
+    if (bits & 0x400000) {
+        *symbol = 210;
+        return 10;
+    } else {
+        *symbol = 209;
+        return 10;
+    }
+
+node_111101001:
+    if (bits & 0x400000) {
+        *symbol = 212;
+        return 10;
+    } else {
+        *symbol = 211;
+        return 10;
+    }
+
+node_11110101:
+    if (bits & 0x800000) {
+        goto node_111101011;
+    } else {
+        goto node_111101010;
+    }
+
+node_111101010:
+    if (bits & 0x400000) {
+        *symbol = 214;
+        return 10;
+    } else {
+        *symbol = 213;
+        return 10;
+    }
+
+node_111101011:
+    if (bits & 0x400000) {
+        *symbol = 216;
+        return 10;
+    } else {
+        *symbol = 215;
+        return 10;
+    }
+
+node_1111011:
+    if (bits & 0x1000000) {
+        goto node_11110111;
+    } else {
+        goto node_11110110;
+    }
+
+node_11110110:
+    if (bits & 0x800000) {
+        goto node_111101101;
+    } else {
+        goto node_111101100;
+    }
+
+node_111101100:
+    if (bits & 0x400000) {
+        *symbol = 218;
+        return 10;
+    } else {
+        *symbol = 217;
+        return 10;
+    }
+
+node_111101101:
+    if (bits & 0x400000) {
+        *symbol = 220;
+        return 10;
+    } else {
+        *symbol = 219;
+        return 10;
+    }
+
+node_11110111:
+    if (bits & 0x800000) {
+        goto node_111101111;
+    } else {
+        goto node_111101110;
+    }
+
+node_111101110:
+    if (bits & 0x400000) {
+        *symbol = 222;
+        return 10;
+    } else {
+        *symbol = 221;
+        return 10;
+    }
+
+node_111101111:
+    if (bits & 0x400000) {
+        *symbol = 224;
+        return 10;
+    } else {
+        *symbol = 223;
+        return 10;
+    }
+
+node_11111:
+    if (bits & 0x4000000) {
+        goto node_111111;
+    } else {
+        goto node_111110;
+    }
+
+node_111110:
+    if (bits & 0x2000000) {
+        goto node_1111101;
+    } else {
+        goto node_1111100;
+    }
+
+node_1111100:
+    if (bits & 0x1000000) {
+        goto node_11111001;
+    } else {
+        goto node_11111000;
+    }
+
+node_11111000:
+    if (bits & 0x800000) {
+        goto node_111110001;
+    } else {
+        goto node_111110000;
+    }
+
+node_111110000:
+    if (bits & 0x400000) {
+        *symbol = 226;
+        return 10;
+    } else {
+        *symbol = 225;
+        return 10;
+    }
+
+node_111110001:
+    if (bits & 0x400000) {
+        *symbol = 228;
+        return 10;
+    } else {
+        *symbol = 227;
+        return 10;
+    }
+
+node_11111001:
+    if (bits & 0x800000) {
+        goto node_111110011;
+    } else {
+        goto node_111110010;
+    }
+
+node_111110010:
+    if (bits & 0x400000) {
+        *symbol = 230;
+        return 10;
+    } else {
+        *symbol = 229;
+        return 10;
+    }
+
+node_111110011:
+    if (bits & 0x400000) {
+        *symbol = 232;
+        return 10;
+    } else {
+        *symbol = 231;
+        return 10;
+    }
+
+node_1111101:
+    if (bits & 0x1000000) {
+        goto node_11111011;
+    } else {
+        goto node_11111010;
+    }
+
+node_11111010:
+    if (bits & 0x800000) {
+        goto node_111110101;
+    } else {
+        goto node_111110100;
+    }
+
+node_111110100:
+    if (bits & 0x400000) {
+        *symbol = 234;
+        return 10;
+    } else {
+        *symbol = 233;
+        return 10;
+    }
+
+node_111110101:
+    if (bits & 0x400000) {
+        *symbol = 236;
+        return 10;
+    } else {
+        *symbol = 235;
+        return 10;
+    }
+
+node_11111011:
+    if (bits & 0x800000) {
+        goto node_111110111;
+    } else {
+        goto node_111110110;
+    }
+
+node_111110110:
+    if (bits & 0x400000) {
+        *symbol = 238;
+        return 10;
+    } else {
+        *symbol = 237;
+        return 10;
+    }
+
+node_111110111:
+    if (bits & 0x400000) {
+        *symbol = 240;
+        return 10;
+    } else {
+        *symbol = 239;
+        return 10;
+    }
+
+node_111111:
+    if (bits & 0x2000000) {
+        goto node_1111111;
+    } else {
+        goto node_1111110;
+    }
+
+node_1111110:
+    if (bits & 0x1000000) {
+        goto node_11111101;
+    } else {
+        goto node_11111100;
+    }
+
+node_11111100:
+    if (bits & 0x800000) {
+        goto node_111111001;
+    } else {
+        goto node_111111000;
+    }
+
+node_111111000:
+    if (bits & 0x400000) {
+        *symbol = 242;
+        return 10;
+    } else {
+        *symbol = 241;
+        return 10;
+    }
+
+node_111111001:
+    if (bits & 0x400000) {
+        *symbol = 244;
+        return 10;
+    } else {
+        *symbol = 243;
+        return 10;
+    }
+
+node_11111101:
+    if (bits & 0x800000) {
+        goto node_111111011;
+    } else {
+        goto node_111111010;
+    }
+
+node_111111010:
+    if (bits & 0x400000) {
+        *symbol = 246;
+        return 10;
+    } else {
+        *symbol = 245;
+        return 10;
+    }
+
+node_111111011:
+    if (bits & 0x400000) {
+        *symbol = 248;
+        return 10;
+    } else {
+        *symbol = 247;
+        return 10;
+    }
+
+node_1111111:
+    if (bits & 0x1000000) {
+        goto node_11111111;
+    } else {
+        goto node_11111110;
+    }
+
+node_11111110:
+    if (bits & 0x800000) {
+        goto node_111111101;
+    } else {
+        goto node_111111100;
+    }
+
+node_111111100:
+    if (bits & 0x400000) {
+        *symbol = 250;
+        return 10;
+    } else {
+        *symbol = 249;
+        return 10;
+    }
+
+node_111111101:
+    if (bits & 0x400000) {
+        *symbol = 252;
+        return 10;
+    } else {
+        *symbol = 251;
+        return 10;
+    }
+
+node_11111111:
+    if (bits & 0x800000) {
+        goto node_111111111;
+    } else {
+        goto node_111111110;
+    }
+
+node_111111110:
+    if (bits & 0x400000) {
+        *symbol = 254;
+        return 10;
+    } else {
+        *symbol = 253;
+        return 10;
+    }
+
+node_111111111:
+    if (bits & 0x400000) {
+        return 0; /* invalid node */
+    } else {
+        *symbol = 255;
+        return 10;
+    }
+
+}
+
+static const struct aws_huffman_decode_entry table_decode_entries[] = {
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 0 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 1 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 2 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 3 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 4 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 5 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 6 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 7 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 8 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 9 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 10 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 11 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 12 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 13 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 14 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 15 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 16 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 17 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 18 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 19 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 20 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 21 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 22 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 23 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 24 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 25 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 26 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 27 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 28 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 29 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 30 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 31 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 32 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 33 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 34 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 35 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 36 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 37 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 38 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 39 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 40 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 41 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 42 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 43 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 44 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 45 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 46 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 47 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 48 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 49 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 50 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 51 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 52 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 53 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 54 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 55 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 56 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 57 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 58 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 59 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 60 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 61 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 62 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 63 */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 64 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 65 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 66 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 67 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 68 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 69 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 70 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 71 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 72 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 73 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 74 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 75 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 76 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 77 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 78 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 79 ' ' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 80 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 81 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 82 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 83 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 84 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 85 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 86 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 87 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 88 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 89 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 90 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 91 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 92 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 93 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 94 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 95 'a' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 96 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 97 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 98 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 99 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 100 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 101 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 102 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 103 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 104 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 105 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 106 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 107 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 108 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 109 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 110 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 111 'e' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 112 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 113 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 114 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 115 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 116 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 117 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 118 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 119 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 120 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 121 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 122 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 123 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 124 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 125 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 126 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 127 'i' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 128 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 129 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 130 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 131 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 132 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 133 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 134 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 135 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 136 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 137 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 138 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 139 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 140 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 141 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 142 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 143 'n' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 144 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 145 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 146 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 147 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 148 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 149 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 150 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 151 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 152 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 153 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 154 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 155 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 156 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 157 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 158 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 159 'o' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 160 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 161 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 162 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 163 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 164 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 165 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 166 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 167 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 168 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 169 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 170 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 171 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 172 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 173 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 174 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 175 'r' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 176 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 177 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 178 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 179 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 180 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 181 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 182 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 183 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 184 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 185 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 186 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 187 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 188 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 189 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 190 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 191 's' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 192 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 193 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 194 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 195 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 196 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 197 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 198 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 199 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 200 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 201 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 202 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 203 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 204 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 205 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 206 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 207 't' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 208 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 209 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 210 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 211 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 212 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 213 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 214 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 215 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 216 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 217 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 218 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 219 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 220 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 221 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 222 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 223 'u' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 224 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 225 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 226 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 227 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 228 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 229 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 230 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 231 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 232 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 233 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 234 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 235 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 236 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 237 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 238 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 239 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 240 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 241 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 242 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 243 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 244 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 245 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 246 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 247 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 248 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 249 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 250 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 251 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 252 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 253 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 254 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 255 */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 256 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 257 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 258 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 259 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 260 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 261 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 262 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 263 'c' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 264 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 265 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 266 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 267 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 268 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 269 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 270 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 271 'd' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 272 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 273 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 274 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 275 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 276 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 277 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 278 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 279 'f' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 280 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 281 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 282 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 283 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 284 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 285 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 286 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 287 'h' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 288 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 289 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 290 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 291 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 292 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 293 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 294 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 295 'k' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 296 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 297 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 298 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 299 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 300 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 301 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 302 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 303 'l' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 304 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 305 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 306 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 307 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 308 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 309 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 310 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 311 'm' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 312 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 313 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 314 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 315 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 316 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 317 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 318 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 319 'w' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 320 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 321 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 322 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 323 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 324 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 325 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 326 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 327 'y' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 328 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 329 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 330 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 331 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 332 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 333 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 334 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 335 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 336 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 337 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 338 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 339 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 340 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 341 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 342 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 343 */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 344 ''' */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 345 ''' */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 346 ''' */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 347 ''' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 348 '.' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 349 '.' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 350 '.' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 351 '.' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 352 'b' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 353 'b' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 354 'b' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 355 'b' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 356 'g' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 357 'g' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 358 'g' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 359 'g' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 360 'p' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 361 'p' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 362 'p' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 363 'p' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 364 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 365 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 366 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 367 */
+    { .value = 0xa, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 368 */
+    { .value = 0xa, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 369 */
+    { .value = 0x2c, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 370 ',' */
+    { .value = 0x2c, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 371 ',' */
+    { .value = 0x3f, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 372 '?' */
+    { .value = 0x3f, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 373 '?' */
+    { .value = 0x42, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 374 'B' */
+    { .value = 0x42, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 375 'B' */
+    { .value = 0x49, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 376 'I' */
+    { .value = 0x49, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 377 'I' */
+    { .value = 0x54, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 378 'T' */
+    { .value = 0x54, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 379 'T' */
+    { .value = 0x57, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 380 'W' */
+    { .value = 0x57, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 381 'W' */
+    { .value = 0x6a, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 382 'j' */
+    { .value = 0x6a, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 383 'j' */
+    { .value = 0x76, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 384 'v' */
+    { .value = 0x76, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 385 'v' */
+    { .value = 0x78, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 386 'x' */
+    { .value = 0x78, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 387 'x' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 388 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 389 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 390 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 391 */
+    { .value = 0x2d, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 392 '-' */
+    { .value = 0x43, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 393 'C' */
+    { .value = 0x44, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 394 'D' */
+    { .value = 0x45, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 395 'E' */
+    { .value = 0x46, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 396 'F' */
+    { .value = 0x47, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 397 'G' */
+    { .value = 0x48, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 398 'H' */
+    { .value = 0x4c, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 399 'L' */
+    { .value = 0x4d, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 400 'M' */
+    { .value = 0x50, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 401 'P' */
+    { .value = 0x56, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 402 'V' */
+    { .value = 0x59, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 403 'Y' */
+    { .value = 0x71, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 404 'q' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 405 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 406 */
+    { .value = 0x200, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 407 */
+    { .value = 0x202, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 408 */
+    { .value = 0x204, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 409 */
+    { .value = 0x206, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 410 */
+    { .value = 0x208, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 411 */
+    { .value = 0x20a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 412 */
+    { .value = 0x20c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 413 */
+    { .value = 0x20e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 414 */
+    { .value = 0x210, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 415 */
+    { .value = 0x212, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 416 */
+    { .value = 0x214, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 417 */
+    { .value = 0x216, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 418 */
+    { .value = 0x218, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 419 */
+    { .value = 0x21a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 420 */
+    { .value = 0x21c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 421 */
+    { .value = 0x21e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 422 */
+    { .value = 0x220, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 423 */
+    { .value = 0x222, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 424 */
+    { .value = 0x224, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 425 */
+    { .value = 0x226, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 426 */
+    { .value = 0x228, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 427 */
+    { .value = 0x22a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 428 */
+    { .value = 0x22c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 429 */
+    { .value = 0x22e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 430 */
+    { .value = 0x230, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 431 */
+    { .value = 0x232, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 432 */
+    { .value = 0x234, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 433 */
+    { .value = 0x236, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 434 */
+    { .value = 0x238, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 435 */
+    { .value = 0x23a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 436 */
+    { .value = 0x23c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 437 */
+    { .value = 0x23e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 438 */
+    { .value = 0x240, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 439 */
+    { .value = 0x242, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 440 */
+    { .value = 0x244, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 441 */
+    { .value = 0x246, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 442 */
+    { .value = 0x248, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 443 */
+    { .value = 0x24a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 444 */
+    { .value = 0x24c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 445 */
+    { .value = 0x24e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 446 */
+    { .value = 0x250, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 447 */
+    { .value = 0x252, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 448 */
+    { .value = 0x254, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 449 */
+    { .value = 0x256, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 450 */
+    { .value = 0x258, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 451 */
+    { .value = 0x25a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 452 */
+    { .value = 0x25c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 453 */
+    { .value = 0x25e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 454 */
+    { .value = 0x260, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 455 */
+    { .value = 0x262, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 456 */
+    { .value = 0x264, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 457 */
+    { .value = 0x266, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 458 */
+    { .value = 0x268, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 459 */
+    { .value = 0x26a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 460 */
+    { .value = 0x26c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 461 */
+    { .value = 0x26e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 462 */
+    { .value = 0x270, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 463 */
+    { .value = 0x272, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 464 */
+    { .value = 0x274, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 465 */
+    { .value = 0x276, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 466 */
+    { .value = 0x278, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 467 */
+    { .value = 0x27a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 468 */
+    { .value = 0x27c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 469 */
+    { .value = 0x27e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 470 */
+    { .value = 0x280, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 471 */
+    { .value = 0x282, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 472 */
+    { .value = 0x284, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 473 */
+    { .value = 0x286, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 474 */
+    { .value = 0x288, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 475 */
+    { .value = 0x28a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 476 */
+    { .value = 0x28c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 477 */
+    { .value = 0x28e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 478 */
+    { .value = 0x290, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 479 */
+    { .value = 0x292, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 480 */
+    { .value = 0x294, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 481 */
+    { .value = 0x296, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 482 */
+    { .value = 0x298, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 483 */
+    { .value = 0x29a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 484 */
+    { .value = 0x29c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 485 */
+    { .value = 0x29e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 486 */
+    { .value = 0x2a0, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 487 */
+    { .value = 0x2a2, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 488 */
+    { .value = 0x2a4, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 489 */
+    { .value = 0x2a6, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 490 */
+    { .value = 0x2a8, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 491 */
+    { .value = 0x2aa, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 492 */
+    { .value = 0x2ac, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 493 */
+    { .value = 0x2ae, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 494 */
+    { .value = 0x2b0, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 495 */
+    { .value = 0x2b2, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 496 */
+    { .value = 0x2b4, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 497 */
+    { .value = 0x2b6, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 498 */
+    { .value = 0x2b8, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 499 */
+    { .value = 0x2ba, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 500 */
+    { .value = 0x2bc, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 501 */
+    { .value = 0x2be, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 502 */
+    { .value = 0x2c0, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 503 */
+    { .value = 0x2c2, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 504 */
+    { .value = 0x2c4, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 505 */
+    { .value = 0x2c6, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 506 */
+    { .value = 0x2c8, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 507 */
+    { .value = 0x2ca, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 508 */
+    { .value = 0x2cc, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 509 */
+    { .value = 0x2ce, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 510 */
+    { .value = 0x2d0, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 511 */
+    { .value = 0x0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 512 */
+    { .value = 0x1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 513 */
+    { .value = 0x2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 514 */
+    { .value = 0x3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 515 */
+    { .value = 0x4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 516 */
+    { .value = 0x5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 517 */
+    { .value = 0x6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 518 */
+    { .value = 0x7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 519 */
+    { .value = 0x8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 520 */
+    { .value = 0x9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 521 */
+    { .value = 0xb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 522 */
+    { .value = 0xc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 523 */
+    { .value = 0xd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 524 */
+    { .value = 0xe, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 525 */
+    { .value = 0xf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 526 */
+    { .value = 0x10, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 527 */
+    { .value = 0x11, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 528 */
+    { .value = 0x12, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 529 */
+    { .value = 0x13, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 530 */
+    { .value = 0x14, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 531 */
+    { .value = 0x15, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 532 */
+    { .value = 0x16, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 533 */
+    { .value = 0x17, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 534 */
+    { .value = 0x18, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 535 */
+    { .value = 0x19, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 536 */
+    { .value = 0x1a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 537 */
+    { .value = 0x1b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 538 */
+    { .value = 0x1c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 539 */
+    { .value = 0x1d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 540 */
+    { .value = 0x1e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 541 */
+    { .value = 0x1f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 542 */
+    { .value = 0x21, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 543 '!' */
+    { .value = 0x22, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 544 '"' */
+    { .value = 0x23, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 545 '#' */
+    { .value = 0x24, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 546 '$' */
+    { .value = 0x25, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 547 '%' */
+    { .value = 0x26, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 548 '&' */
+    { .value = 0x28, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 549 '(' */
+    { .value = 0x29, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 550 ')' */
+    { .value = 0x2a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 551 '*' */
+    { .value = 0x2b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 552 '+' */
+    { .value = 0x2f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 553 '/' */
+    { .value = 0x30, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 554 '0' */
+    { .value = 0x31, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 555 '1' */
+    { .value = 0x32, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 556 '2' */
+    { .value = 0x33, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 557 '3' */
+    { .value = 0x34, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 558 '4' */
+    { .value = 0x35, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 559 '5' */
+    { .value = 0x36, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 560 '6' */
+    { .value = 0x37, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 561 '7' */
+    { .value = 0x38, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 562 '8' */
+    { .value = 0x39, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 563 '9' */
+    { .value = 0x3a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 564 ':' */
+    { .value = 0x3b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 565 ';' */
+    { .value = 0x3c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 566 '<' */
+    { .value = 0x3d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 567 '=' */
+    { .value = 0x3e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 568 '>' */
+    { .value = 0x40, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 569 '@' */
+    { .value = 0x41, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 570 'A' */
+    { .value = 0x4a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 571 'J' */
+    { .value = 0x4b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 572 'K' */
+    { .value = 0x4e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 573 'N' */
+    { .value = 0x4f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 574 'O' */
+    { .value = 0x51, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 575 'Q' */
+    { .value = 0x52, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 576 'R' */
+    { .value = 0x53, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 577 'S' */
+    { .value = 0x55, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 578 'U' */
+    { .value = 0x58, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 579 'X' */
+    { .value = 0x5a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 580 'Z' */
+    { .value = 0x5b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 581 '[' */
+    { .value = 0x5c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 582 '\' */
+    { .value = 0x5d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 583 ']' */
+    { .value = 0x5e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 584 '^' */
+    { .value = 0x5f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 585 '_' */
+    { .value = 0x60, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 586 '`' */
+    { .value = 0x7a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 587 'z' */
+    { .value = 0x7b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 588 '{' */
+    { .value = 0x7c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 589 '|' */
+    { .value = 0x7d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 590 '}' */
+    { .value = 0x7e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 591 '~' */
+    { .value = 0x7f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 592 */
+    { .value = 0x80, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 593 */
+    { .value = 0x81, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 594 */
+    { .value = 0x82, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 595 */
+    { .value = 0x83, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 596 */
+    { .value = 0x84, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 597 */
+    { .value = 0x85, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 598 */
+    { .value = 0x86, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 599 */
+    { .value = 0x87, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 600 */
+    { .value = 0x88, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 601 */
+    { .value = 0x89, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 602 */
+    { .value = 0x8a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 603 */
+    { .value = 0x8b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 604 */
+    { .value = 0x8c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 605 */
+    { .value = 0x8d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 606 */
+    { .value = 0x8e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 607 */
+    { .value = 0x8f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 608 */
+    { .value = 0x90, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 609 */
+    { .value = 0x91, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 610 */
+    { .value = 0x92, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 611 */
+    { .value = 0x93, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 612 */
+    { .value = 0x94, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 613 */
+    { .value = 0x95, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 614 */
+    { .value = 0x96, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 615 */
+    { .value = 0x97, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 616 */
+    { .value = 0x98, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 617 */
+    { .value = 0x99, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 618 */
+    { .value = 0x9a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 619 */
+    { .value = 0x9b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 620 */
+    { .value = 0x9c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 621 */
+    { .value = 0x9d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 622 */
+    { .value = 0x9e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 623 */
+    { .value = 0x9f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 624 */
+    { .value = 0xa0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 625 */
+    { .value = 0xa1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 626 */
+    { .value = 0xa2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 627 */
+    { .value = 0xa3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 628 */
+    { .value = 0xa4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 629 */
+    { .value = 0xa5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 630 */
+    { .value = 0xa6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 631 */
+    { .value = 0xa7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 632 */
+    { .value = 0xa8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 633 */
+    { .value = 0xa9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 634 */
+    { .value = 0xaa, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 635 */
+    { .value = 0xab, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 636 */
+    { .value = 0xac, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 637 */
+    { .value = 0xad, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 638 */
+    { .value = 0xae, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 639 */
+    { .value = 0xaf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 640 */
+    { .value = 0xb0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 641 */
+    { .value = 0xb1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 642 */
+    { .value = 0xb2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 643 */
+    { .value = 0xb3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 644 */
+    { .value = 0xb4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 645 */
+    { .value = 0xb5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 646 */
+    { .value = 0xb6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 647 */
+    { .value = 0xb7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 648 */
+    { .value = 0xb8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 649 */
+    { .value = 0xb9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 650 */
+    { .value = 0xba, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 651 */
+    { .value = 0xbb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 652 */
+    { .value = 0xbc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 653 */
+    { .value = 0xbd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 654 */
+    { .value = 0xbe, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 655 */
+    { .value = 0xbf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 656 */
+    { .value = 0xc0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 657 */
+    { .value = 0xc1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 658 */
+    { .value = 0xc2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 659 */
+    { .value = 0xc3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 660 */
+    { .value = 0xc4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 661 */
+    { .value = 0xc5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 662 */
+    { .value = 0xc6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 663 */
+    { .value = 0xc7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 664 */
+    { .value = 0xc8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 665 */
+    { .value = 0xc9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 666 */
+    { .value = 0xca, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 667 */
+    { .value = 0xcb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 668 */
+    { .value = 0xcc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 669 */
+    { .value = 0xcd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 670 */
+    { .value = 0xce, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 671 */
+    { .value = 0xcf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 672 */
+    { .value = 0xd0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 673 */
+    { .value = 0xd1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 674 */
+    { .value = 0xd2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 675 */
+    { .value = 0xd3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 676 */
+    { .value = 0xd4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 677 */
+    { .value = 0xd5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 678 */
+    { .value = 0xd6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 679 */
+    { .value = 0xd7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 680 */
+    { .value = 0xd8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 681 */
+    { .value = 0xd9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 682 */
+    { .value = 0xda, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 683 */
+    { .value = 0xdb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 684 */
+    { .value = 0xdc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 685 */
+    { .value = 0xdd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 686 */
+    { .value = 0xde, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 687 */
+    { .value = 0xdf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 688 */
+    { .value = 0xe0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 689 */
+    { .value = 0xe1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 690 */
+    { .value = 0xe2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 691 */
+    { .value = 0xe3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 692 */
+    { .value = 0xe4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 693 */
+    { .value = 0xe5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 694 */
+    { .value = 0xe6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 695 */
+    { .value = 0xe7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 696 */
+    { .value = 0xe8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 697 */
+    { .value = 0xe9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 698 */
+    { .value = 0xea, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 699 */
+    { .value = 0xeb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 700 */
+    { .value = 0xec, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 701 */
+    { .value = 0xed, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 702 */
+    { .value = 0xee, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 703 */
+    { .value = 0xef, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 704 */
+    { .value = 0xf0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 705 */
+    { .value = 0xf1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 706 */
+    { .value = 0xf2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 707 */
+    { .value = 0xf3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 708 */
+    { .value = 0xf4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 709 */
+    { .value = 0xf5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 710 */
+    { .value = 0xf6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 711 */
+    { .value = 0xf7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 712 */
+    { .value = 0xf8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 713 */
+    { .value = 0xf9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 714 */
+    { .value = 0xfa, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 715 */
+    { .value = 0xfb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 716 */
+    { .value = 0xfc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 717 */
+    { .value = 0xfd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 718 */
+    { .value = 0xfe, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 719 */
+    { .value = 0xff, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 720 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 721 */
+};
+
+static uint8_t table_decode_symbol(uint32_t bits, uint8_t *symbol, void *userdata) {
+    (void)userdata;
+
+    const struct aws_huffman_decode_entry *entry = &table_decode_entries[bits >> (32 - 9)];
+    uint8_t consumed = 9;
+    while (entry->type == AWS_HUFFMAN_DECODE_ENTRY_LINK) {
+        const uint8_t sub_bits = entry->num_bits;
+        entry = &table_decode_entries[entry->value + ((bits << consumed) >> (32 - sub_bits))];
+        consumed += sub_bits;
+    }
+
+    if (entry->type != AWS_HUFFMAN_DECODE_ENTRY_SYMBOL) {
+        return 0;
+    }
+
+    *symbol = (uint8_t)entry->value;
+    return entry->num_bits;
+}
+
+static const struct aws_huffman_decode_table table_decode_table = {
+    .entries = table_decode_entries,
+    .root_bits = 9,
+};
+
+static const struct aws_huffman_decode_entry flat_decode_entries[] = {
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 0 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 1 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 2 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 3 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 4 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 5 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 6 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 7 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 8 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 9 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 10 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 11 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 12 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 13 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 14 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 15 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 16 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 17 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 18 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 19 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 20 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 21 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 22 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 23 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 24 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 25 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 26 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 27 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 28 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 29 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 30 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 31 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 32 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 33 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 34 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 35 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 36 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 37 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 38 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 39 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 40 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 41 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 42 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 43 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 44 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 45 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 46 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 47 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 48 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 49 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 50 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 51 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 52 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 53 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 54 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 55 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 56 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 57 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 58 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 59 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 60 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 61 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 62 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 63 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 64 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 65 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 66 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 67 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 68 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 69 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 70 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 71 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 72 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 73 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 74 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 75 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 76 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 77 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 78 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 79 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 80 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 81 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 82 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 83 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 84 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 85 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 86 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 87 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 88 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 89 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 90 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 91 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 92 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 93 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 94 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 95 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 96 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 97 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 98 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 99 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 100 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 101 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 102 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 103 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 104 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 105 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 106 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 107 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 108 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 109 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 110 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 111 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 112 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 113 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 114 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 115 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 116 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 117 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 118 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 119 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 120 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 121 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 122 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 123 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 124 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 125 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 126 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 127 */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 128 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 129 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 130 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 131 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 132 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 133 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 134 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 135 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 136 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 137 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 138 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 139 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 140 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 141 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 142 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 143 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 144 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 145 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 146 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 147 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 148 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 149 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 150 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 151 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 152 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 153 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 154 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 155 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 156 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 157 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 158 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 159 ' ' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 160 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 161 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 162 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 163 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 164 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 165 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 166 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 167 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 168 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 169 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 170 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 171 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 172 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 173 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 174 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 175 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 176 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 177 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 178 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 179 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 180 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 181 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 182 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 183 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 184 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 185 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 186 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 187 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 188 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 189 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 190 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 191 'a' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 192 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 193 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 194 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 195 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 196 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 197 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 198 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 199 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 200 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 201 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 202 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 203 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 204 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 205 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 206 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 207 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 208 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 209 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 210 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 211 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 212 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 213 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 214 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 215 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 216 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 217 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 218 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 219 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 220 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 221 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 222 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 223 'e' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 224 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 225 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 226 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 227 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 228 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 229 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 230 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 231 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 232 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 233 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 234 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 235 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 236 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 237 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 238 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 239 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 240 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 241 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 242 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 243 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 244 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 245 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 246 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 247 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 248 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 249 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 250 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 251 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 252 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 253 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 254 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 255 'i' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 256 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 257 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 258 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 259 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 260 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 261 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 262 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 263 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 264 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 265 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 266 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 267 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 268 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 269 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 270 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 271 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 272 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 273 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 274 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 275 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 276 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 277 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 278 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 279 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 280 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 281 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 282 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 283 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 284 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 285 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 286 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 287 'n' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 288 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 289 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 290 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 291 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 292 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 293 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 294 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 295 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 296 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 297 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 298 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 299 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 300 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 301 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 302 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 303 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 304 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 305 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 306 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 307 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 308 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 309 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 310 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 311 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 312 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 313 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 314 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 315 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 316 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 317 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 318 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 319 'o' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 320 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 321 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 322 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 323 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 324 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 325 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 326 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 327 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 328 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 329 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 330 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 331 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 332 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 333 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 334 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 335 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 336 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 337 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 338 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 339 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 340 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 341 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 342 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 343 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 344 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 345 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 346 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 347 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 348 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 349 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 350 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 351 'r' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 352 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 353 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 354 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 355 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 356 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 357 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 358 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 359 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 360 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 361 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 362 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 363 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 364 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 365 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 366 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 367 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 368 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 369 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 370 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 371 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 372 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 373 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 374 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 375 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 376 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 377 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 378 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 379 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 380 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 381 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 382 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 383 's' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 384 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 385 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 386 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 387 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 388 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 389 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 390 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 391 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 392 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 393 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 394 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 395 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 396 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 397 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 398 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 399 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 400 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 401 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 402 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 403 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 404 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 405 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 406 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 407 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 408 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 409 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 410 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 411 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 412 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 413 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 414 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 415 't' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 416 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 417 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 418 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 419 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 420 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 421 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 422 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 423 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 424 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 425 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 426 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 427 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 428 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 429 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 430 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 431 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 432 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 433 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 434 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 435 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 436 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 437 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 438 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 439 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 440 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 441 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 442 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 443 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 444 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 445 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 446 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 447 'u' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 448 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 449 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 450 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 451 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 452 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 453 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 454 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 455 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 456 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 457 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 458 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 459 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 460 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 461 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 462 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 463 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 464 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 465 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 466 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 467 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 468 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 469 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 470 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 471 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 472 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 473 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 474 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 475 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 476 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 477 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 478 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 479 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 480 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 481 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 482 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 483 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 484 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 485 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 486 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 487 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 488 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 489 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 490 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 491 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 492 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 493 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 494 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 495 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 496 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 497 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 498 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 499 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 500 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 501 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 502 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 503 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 504 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 505 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 506 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 507 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 508 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 509 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 510 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 511 */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 512 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 513 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 514 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 515 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 516 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 517 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 518 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 519 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 520 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 521 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 522 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 523 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 524 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 525 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 526 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 527 'c' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 528 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 529 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 530 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 531 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 532 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 533 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 534 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 535 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 536 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 537 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 538 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 539 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 540 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 541 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 542 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 543 'd' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 544 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 545 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 546 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 547 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 548 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 549 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 550 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 551 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 552 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 553 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 554 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 555 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 556 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 557 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 558 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 559 'f' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 560 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 561 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 562 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 563 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 564 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 565 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 566 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 567 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 568 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 569 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 570 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 571 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 572 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 573 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 574 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 575 'h' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 576 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 577 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 578 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 579 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 580 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 581 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 582 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 583 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 584 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 585 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 586 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 587 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 588 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 589 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 590 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 591 'k' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 592 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 593 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 594 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 595 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 596 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 597 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 598 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 599 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 600 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 601 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 602 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 603 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 604 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 605 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 606 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 607 'l' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 608 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 609 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 610 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 611 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 612 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 613 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 614 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 615 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 616 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 617 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 618 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 619 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 620 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 621 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 622 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 623 'm' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 624 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 625 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 626 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 627 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 628 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 629 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 630 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 631 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 632 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 633 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 634 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 635 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 636 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 637 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 638 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 639 'w' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 640 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 641 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 642 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 643 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 644 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 645 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 646 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 647 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 648 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 649 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 650 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 651 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 652 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 653 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 654 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 655 'y' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 656 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 657 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 658 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 659 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 660 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 661 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 662 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 663 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 664 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 665 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 666 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 667 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 668 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 669 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 670 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 671 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 672 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 673 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 674 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 675 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 676 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 677 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 678 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 679 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 680 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 681 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 682 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 683 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 684 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 685 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 686 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 687 */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 688 ''' */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 689 ''' */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 690 ''' */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 691 ''' */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 692 ''' */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 693 ''' */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 694 ''' */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 695 ''' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 696 '.' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 697 '.' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 698 '.' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 699 '.' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 700 '.' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 701 '.' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 702 '.' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 703 '.' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 704 'b' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 705 'b' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 706 'b' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 707 'b' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 708 'b' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 709 'b' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 710 'b' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 711 'b' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 712 'g' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 713 'g' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 714 'g' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 715 'g' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 716 'g' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 717 'g' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 718 'g' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 719 'g' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 720 'p' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 721 'p' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 722 'p' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 723 'p' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 724 'p' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 725 'p' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 726 'p' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 727 'p' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 728 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 729 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 730 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 731 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 732 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 733 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 734 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 735 */
+    { .value = 0xa, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 736 */
+    { .value = 0xa, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 737 */
+    { .value = 0xa, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 738 */
+    { .value = 0xa, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 739 */
+    { .value = 0x2c, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 740 ',' */
+    { .value = 0x2c, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 741 ',' */
+    { .value = 0x2c, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 742 ',' */
+    { .value = 0x2c, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 743 ',' */
+    { .value = 0x3f, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 744 '?' */
+    { .value = 0x3f, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 745 '?' */
+    { .value = 0x3f, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 746 '?' */
+    { .value = 0x3f, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 747 '?' */
+    { .value = 0x42, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 748 'B' */
+    { .value = 0x42, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 749 'B' */
+    { .value = 0x42, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 750 'B' */
+    { .value = 0x42, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 751 'B' */
+    { .value = 0x49, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 752 'I' */
+    { .value = 0x49, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 753 'I' */
+    { .value = 0x49, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 754 'I' */
+    { .value = 0x49, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 755 'I' */
+    { .value = 0x54, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 756 'T' */
+    { .value = 0x54, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 757 'T' */
+    { .value = 0x54, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 758 'T' */
+    { .value = 0x54, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 759 'T' */
+    { .value = 0x57, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 760 'W' */
+    { .value = 0x57, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 761 'W' */
+    { .value = 0x57, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 762 'W' */
+    { .value = 0x57, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 763 'W' */
+    { .value = 0x6a, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 764 'j' */
+    { .value = 0x6a, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 765 'j' */
+    { .value = 0x6a, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 766 'j' */
+    { .value = 0x6a, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 767 'j' */
+    { .value = 0x76, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 768 'v' */
+    { .value = 0x76, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 769 'v' */
+    { .value = 0x76, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 770 'v' */
+    { .value = 0x76, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 771 'v' */
+    { .value = 0x78, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 772 'x' */
+    { .value = 0x78, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 773 'x' */
+    { .value = 0x78, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 774 'x' */
+    { .value = 0x78, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 775 'x' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 776 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 777 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 778 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 779 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 780 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 781 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 782 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 783 */
+    { .value = 0x2d, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 784 '-' */
+    { .value = 0x2d, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 785 '-' */
+    { .value = 0x43, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 786 'C' */
+    { .value = 0x43, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 787 'C' */
+    { .value = 0x44, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 788 'D' */
+    { .value = 0x44, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 789 'D' */
+    { .value = 0x45, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 790 'E' */
+    { .value = 0x45, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 791 'E' */
+    { .value = 0x46, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 792 'F' */
+    { .value = 0x46, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 793 'F' */
+    { .value = 0x47, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 794 'G' */
+    { .value = 0x47, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 795 'G' */
+    { .value = 0x48, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 796 'H' */
+    { .value = 0x48, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 797 'H' */
+    { .value = 0x4c, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 798 'L' */
+    { .value = 0x4c, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 799 'L' */
+    { .value = 0x4d, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 800 'M' */
+    { .value = 0x4d, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 801 'M' */
+    { .value = 0x50, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 802 'P' */
+    { .value = 0x50, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 803 'P' */
+    { .value = 0x56, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 804 'V' */
+    { .value = 0x56, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 805 'V' */
+    { .value = 0x59, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 806 'Y' */
+    { .value = 0x59, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 807 'Y' */
+    { .value = 0x71, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 808 'q' */
+    { .value = 0x71, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 809 'q' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 810 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 811 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 812 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 813 */
+    { .value = 0x0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 814 */
+    { .value = 0x1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 815 */
+    { .value = 0x2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 816 */
+    { .value = 0x3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 817 */
+    { .value = 0x4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 818 */
+    { .value = 0x5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 819 */
+    { .value = 0x6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 820 */
+    { .value = 0x7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 821 */
+    { .value = 0x8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 822 */
+    { .value = 0x9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 823 */
+    { .value = 0xb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 824 */
+    { .value = 0xc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 825 */
+    { .value = 0xd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 826 */
+    { .value = 0xe, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 827 */
+    { .value = 0xf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 828 */
+    { .value = 0x10, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 829 */
+    { .value = 0x11, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 830 */
+    { .value = 0x12, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 831 */
+    { .value = 0x13, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 832 */
+    { .value = 0x14, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 833 */
+    { .value = 0x15, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 834 */
+    { .value = 0x16, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 835 */
+    { .value = 0x17, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 836 */
+    { .value = 0x18, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 837 */
+    { .value = 0x19, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 838 */
+    { .value = 0x1a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 839 */
+    { .value = 0x1b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 840 */
+    { .value = 0x1c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 841 */
+    { .value = 0x1d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 842 */
+    { .value = 0x1e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 843 */
+    { .value = 0x1f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 844 */
+    { .value = 0x21, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 845 '!' */
+    { .value = 0x22, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 846 '"' */
+    { .value = 0x23, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 847 '#' */
+    { .value = 0x24, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 848 '$' */
+    { .value = 0x25, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 849 '%' */
+    { .value = 0x26, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 850 '&' */
+    { .value = 0x28, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 851 '(' */
+    { .value = 0x29, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 852 ')' */
+    { .value = 0x2a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 853 '*' */
+    { .value = 0x2b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 854 '+' */
+    { .value = 0x2f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 855 '/' */
+    { .value = 0x30, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 856 '0' */
+    { .value = 0x31, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 857 '1' */
+    { .value = 0x32, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 858 '2' */
+    { .value = 0x33, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 859 '3' */
+    { .value = 0x34, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 860 '4' */
+    { .value = 0x35, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 861 '5' */
+    { .value = 0x36, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 862 '6' */
+    { .value = 0x37, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 863 '7' */
+    { .value = 0x38, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 864 '8' */
+    { .value = 0x39, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 865 '9' */
+    { .value = 0x3a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 866 ':' */
+    { .value = 0x3b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 867 ';' */
+    { .value = 0x3c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 868 '<' */
+    { .value = 0x3d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 869 '=' */
+    { .value = 0x3e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 870 '>' */
+    { .value = 0x40, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 871 '@' */
+    { .value = 0x41, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 872 'A' */
+    { .value = 0x4a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 873 'J' */
+    { .value = 0x4b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 874 'K' */
+    { .value = 0x4e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 875 'N' */
+    { .value = 0x4f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 876 'O' */
+    { .value = 0x51, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 877 'Q' */
+    { .value = 0x52, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 878 'R' */
+    { .value = 0x53, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 879 'S' */
+    { .value = 0x55, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 880 'U' */
+    { .value = 0x58, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 881 'X' */
+    { .value = 0x5a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 882 'Z' */
+    { .value = 0x5b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 883 '[' */
+    { .value = 0x5c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 884 '\' */
+    { .value = 0x5d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 885 ']' */
+    { .value = 0x5e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 886 '^' */
+    { .value = 0x5f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 887 '_' */
+    { .value = 0x60, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 888 '`' */
+    { .value = 0x7a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 889 'z' */
+    { .value = 0x7b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 890 '{' */
+    { .value = 0x7c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 891 '|' */
+    { .value = 0x7d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 892 '}' */
+    { .value = 0x7e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 893 '~' */
+    { .value = 0x7f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 894 */
+    { .value = 0x80, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 895 */
+    { .value = 0x81, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 896 */
+    { .value = 0x82, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 897 */
+    { .value = 0x83, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 898 */
+    { .value = 0x84, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 899 */
+    { .value = 0x85, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 900 */
+    { .value = 0x86, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 901 */
+    { .value = 0x87, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 902 */
+    { .value = 0x88, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 903 */
+    { .value = 0x89, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 904 */
+    { .value = 0x8a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 905 */
+    { .value = 0x8b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 906 */
+    { .value = 0x8c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 907 */
+    { .value = 0x8d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 908 */
+    { .value = 0x8e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 909 */
+    { .value = 0x8f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 910 */
+    { .value = 0x90, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 911 */
+    { .value = 0x91, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 912 */
+    { .value = 0x92, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 913 */
+    { .value = 0x93, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 914 */
+    { .value = 0x94, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 915 */
+    { .value = 0x95, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 916 */
+    { .value = 0x96, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 917 */
+    { .value = 0x97, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 918 */
+    { .value = 0x98, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 919 */
+    { .value = 0x99, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 920 */
+    { .value = 0x9a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 921 */
+    { .value = 0x9b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 922 */
+    { .value = 0x9c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 923 */
+    { .value = 0x9d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 924 */
+    { .value = 0x9e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 925 */
+    { .value = 0x9f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 926 */
+    { .value = 0xa0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 927 */
+    { .value = 0xa1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 928 */
+    { .value = 0xa2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 929 */
+    { .value = 0xa3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 930 */
+    { .value = 0xa4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 931 */
+    { .value = 0xa5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 932 */
+    { .value = 0xa6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 933 */
+    { .value = 0xa7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 934 */
+    { .value = 0xa8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 935 */
+    { .value = 0xa9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 936 */
+    { .value = 0xaa, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 937 */
+    { .value = 0xab, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 938 */
+    { .value = 0xac, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 939 */
+    { .value = 0xad, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 940 */
+    { .value = 0xae, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 941 */
+    { .value = 0xaf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 942 */
+    { .value = 0xb0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 943 */
+    { .value = 0xb1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 944 */
+    { .value = 0xb2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 945 */
+    { .value = 0xb3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 946 */
+    { .value = 0xb4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 947 */
+    { .value = 0xb5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 948 */
+    { .value = 0xb6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 949 */
+    { .value = 0xb7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 950 */
+    { .value = 0xb8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 951 */
+    { .value = 0xb9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 952 */
+    { .value = 0xba, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 953 */
+    { .value = 0xbb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 954 */
+    { .value = 0xbc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 955 */
+    { .value = 0xbd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 956 */
+    { .value = 0xbe, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 957 */
+    { .value = 0xbf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 958 */
+    { .value = 0xc0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 959 */
+    { .value = 0xc1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 960 */
+    { .value = 0xc2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 961 */
+    { .value = 0xc3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 962 */
+    { .value = 0xc4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 963 */
+    { .value = 0xc5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 964 */
+    { .value = 0xc6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 965 */
+    { .value = 0xc7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 966 */
+    { .value = 0xc8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 967 */
+    { .value = 0xc9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 968 */
+    { .value = 0xca, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 969 */
+    { .value = 0xcb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 970 */
+    { .value = 0xcc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 971 */
+    { .value = 0xcd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 972 */
+    { .value = 0xce, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 973 */
+    { .value = 0xcf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 974 */
+    { .value = 0xd0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 975 */
+    { .value = 0xd1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 976 */
+    { .value = 0xd2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 977 */
+    { .value = 0xd3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 978 */
+    { .value = 0xd4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 979 */
+    { .value = 0xd5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 980 */
+    { .value = 0xd6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 981 */
+    { .value = 0xd7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 982 */
+    { .value = 0xd8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 983 */
+    { .value = 0xd9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 984 */
+    { .value = 0xda, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 985 */
+    { .value = 0xdb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 986 */
+    { .value = 0xdc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 987 */
+    { .value = 0xdd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 988 */
+    { .value = 0xde, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 989 */
+    { .value = 0xdf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 990 */
+    { .value = 0xe0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 991 */
+    { .value = 0xe1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 992 */
+    { .value = 0xe2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 993 */
+    { .value = 0xe3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 994 */
+    { .value = 0xe4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 995 */
+    { .value = 0xe5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 996 */
+    { .value = 0xe6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 997 */
+    { .value = 0xe7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 998 */
+    { .value = 0xe8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 999 */
+    { .value = 0xe9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1000 */
+    { .value = 0xea, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1001 */
+    { .value = 0xeb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1002 */
+    { .value = 0xec, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1003 */
+    { .value = 0xed, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1004 */
+    { .value = 0xee, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1005 */
+    { .value = 0xef, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1006 */
+    { .value = 0xf0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1007 */
+    { .value = 0xf1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1008 */
+    { .value = 0xf2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1009 */
+    { .value = 0xf3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1010 */
+    { .value = 0xf4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1011 */
+    { .value = 0xf5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1012 */
+    { .value = 0xf6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1013 */
+    { .value = 0xf7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1014 */
+    { .value = 0xf8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1015 */
+    { .value = 0xf9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1016 */
+    { .value = 0xfa, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1017 */
+    { .value = 0xfb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1018 */
+    { .value = 0xfc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1019 */
+    { .value = 0xfd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1020 */
+    { .value = 0xfe, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1021 */
+    { .value = 0xff, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 1022 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 1023 */
+};
+
+static uint8_t flat_decode_symbol(uint32_t bits, uint8_t *symbol, void *userdata) {
+    (void)userdata;
+
+    const struct aws_huffman_decode_entry *entry = &flat_decode_entries[bits >> (32 - 10)];
+    uint8_t consumed = 10;
+    while (entry->type == AWS_HUFFMAN_DECODE_ENTRY_LINK) {
+        const uint8_t sub_bits = entry->num_bits;
+        entry = &flat_decode_entries[entry->value + ((bits << consumed) >> (32 - sub_bits))];
+        consumed += sub_bits;
+    }
+
+    if (entry->type != AWS_HUFFMAN_DECODE_ENTRY_SYMBOL) {
+        return 0;
+    }
+
+    *symbol = (uint8_t)entry->value;
+    return entry->num_bits;
+}
+
+static const struct aws_huffman_decode_table flat_decode_table = {
+    .entries = flat_decode_entries,
+    .root_bits = 10,
+};
+
+static const uint32_t canonical_limits[] = {
+    0x6fffffff, /* 5 bits */
+    0xa3ffffff, /* 6 bits */
+    0xb5ffffff, /* 7 bits */
+    0xc1ffffff, /* 8 bits */
+    0xca7fffff, /* 9 bits */
+    0xffbfffff, /* 10 bits */
+};
+
+static const uint32_t canonical_first_codes[] = {
+    0x20000000, /* 5 bits */
+    0x80000000, /* 6 bits */
+    0xac000000, /* 7 bits */
+    0xb8000000, /* 8 bits */
+    0xc4000000, /* 9 bits */
+    0xcb800000, /* 10 bits */
+};
+
+static const uint16_t canonical_offsets[] = {
+    0, /* 5 bits */
+    10, /* 6 bits */
+    19, /* 7 bits */
+    24, /* 8 bits */
+    34, /* 9 bits */
+    47, /* 10 bits */
+};
+
+static const uint8_t canonical_start_lengths[] = {
+    0, 1, 3, 5, 5, 5, 5, 5, 5, 5, 5,
+};
+
+static const uint8_t canonical_symbols[] = {
+    0x20, 0x61, 0x65, 0x69, 0x6e, 0x6f, 0x72, 0x73, 0x74, 0x75, 0x63, 0x64,
+    0x66, 0x68, 0x6b, 0x6c, 0x6d, 0x77, 0x79, 0x27, 0x2e, 0x62, 0x67, 0x70,
+    0x0a, 0x2c, 0x3f, 0x42, 0x49, 0x54, 0x57, 0x6a, 0x76, 0x78, 0x2d, 0x43,
+    0x44, 0x45, 0x46, 0x47, 0x48, 0x4c, 0x4d, 0x50, 0x56, 0x59, 0x71, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0b, 0x0c, 0x0d,
+    0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+    0x28, 0x29, 0x2a, 0x2b, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+    0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x40, 0x41, 0x4a, 0x4b,
+    0x4e, 0x4f, 0x51, 0x52, 0x53, 0x55, 0x58, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e,
+    0x5f, 0x60, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b,
+    0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf, 0xb0, 0xb1, 0xb2, 0xb3,
+    0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb,
+    0xcc, 0xcd, 0xce, 0xcf, 0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+    0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0xe2, 0xe3,
+    0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb,
+    0xfc, 0xfd, 0xfe, 0xff,
+};
+
+static uint8_t canonical_decode_symbol(uint32_t bits, uint8_t *symbol, void *userdata) {
+    (void)userdata;
+
+    const size_t leading_ones = aws_min_size(aws_clz_u32(~bits), 10);
+
+    size_t i = canonical_start_lengths[leading_ones];
+    while (bits > canonical_limits[i]) {
+        if (i == 5) {
+            return 0;
+        }
+        ++i;
+    }
+
+    if (bits < canonical_first_codes[i]) {
+        return 0;
+    }
+
+    const uint8_t num_bits = (uint8_t)(5 + i);
+    const uint32_t index = (bits - canonical_first_codes[i]) >> (32 - num_bits);
+    *symbol = canonical_symbols[canonical_offsets[i] + index];
+    return num_bits;
+}
+
+static const struct aws_huffman_canonical_table canonical_table = {
+    .limits = canonical_limits,
+    .first_codes = canonical_first_codes,
+    .offsets = canonical_offsets,
+    .start_lengths = canonical_start_lengths,
+    .symbols = canonical_symbols,
+    .min_bits = 5,
+    .max_bits = 10,
+};
+
+static const struct aws_huffman_multi_symbol_entry multi_symbol_entries[] = {
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x10 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x11 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x12 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x13 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x14 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x15 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x16 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x17 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x18 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x19 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x20 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x21 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x22 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x23 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x24 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x25 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x26 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x27 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x28 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x29 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x2a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x2b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x2c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x2d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x2e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x2f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x30 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x31 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x32 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x33 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x34 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x35 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x36 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x37 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x38 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x39 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x3a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x3b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x3c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x3d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x3e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x3f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x40 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x41 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x42 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x43 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x44 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x45 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x46 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x47 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x48 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x49 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x4a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x4b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x4c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x4d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x4e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x4f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x50 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x51 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x52 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x53 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x54 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x55 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x56 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x57 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x58 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x59 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x5a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x5b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x5c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x5d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x5e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x5f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x60 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x61 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x62 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x63 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x64 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x65 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x66 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x67 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x68 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x69 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x6a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x6b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x6c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x6d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x6e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x6f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x70 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x71 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x72 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x73 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x74 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x75 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x76 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x77 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x78 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x79 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x80 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x81 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x82 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x83 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x84 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x85 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x86 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x87 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x88 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x89 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x8a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x8b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x8c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x8d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x8e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x8f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x90 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x91 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x92 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x93 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x94 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x95 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x96 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x97 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x98 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x99 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x9a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x9b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x9c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x9d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x9e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x9f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xac */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xad */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xae */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xba */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xbb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xbc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xbd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xbe */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xbf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xca */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xce */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xda */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xdb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xdc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xdd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xde */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xdf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xea */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xeb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xec */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xed */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xee */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xef */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xfa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xfb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xfc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xfd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xfe */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xff */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x100 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x101 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x102 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x103 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x104 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x105 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x106 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x107 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x108 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x109 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x10a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x10b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x10c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x10d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x10e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x10f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x110 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x111 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x112 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x113 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x114 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x115 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x116 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x117 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x118 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x119 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x11a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x11b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x11c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x11d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x11e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x11f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x120 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x121 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x122 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x123 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x124 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x125 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x126 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x127 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x128 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x129 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x12a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x12b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x12c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x12d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x12e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x12f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x130 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x131 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x132 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x133 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x134 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x135 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x136 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x137 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x138 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x139 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x13a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x13b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x13c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x13d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x13e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x13f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x140 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x141 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x142 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x143 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x144 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x145 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x146 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x147 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x148 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x149 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x14a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x14b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x14c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x14d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x14e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x14f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x150 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x151 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x152 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x153 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x154 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x155 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x156 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x157 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x158 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x159 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x15a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x15b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x15c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x15d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x15e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x15f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x160 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x161 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x162 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x163 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x164 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x165 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x166 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x167 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x168 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x169 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x16a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x16b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x16c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x16d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x16e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x16f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x170 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x171 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x172 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x173 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x174 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x175 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x176 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x177 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x178 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x179 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x17a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x17b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x17c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x17d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x17e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x17f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x180 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x181 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x182 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x183 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x184 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x185 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x186 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x187 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x188 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x189 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x18a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x18b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x18c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x18d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x18e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x18f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x190 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x191 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x192 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x193 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x194 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x195 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x196 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x197 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x198 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x199 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x19a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x19b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x19c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x19d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x19e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x19f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1aa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ab */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ac */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ad */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ae */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1af */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ba */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1bb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1bc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1bd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1be */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1bf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ca */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1cb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1cc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1cd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ce */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1cf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1da */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1db */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1dc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1dd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1de */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1df */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ea */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1eb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ec */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ed */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ee */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ef */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1fa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1fb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1fc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1fd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1fe */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ff */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x200 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x201 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x202 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x203 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x204 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x205 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x206 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x207 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x208 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x209 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x20a */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x20b */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x20c */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x20d */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x20e */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x20f */
+    { .symbols = { 0x20, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x210 */
+    { .symbols = { 0x20, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x211 */
+    { .symbols = { 0x20, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x212 */
+    { .symbols = { 0x20, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x213 */
+    { .symbols = { 0x20, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x214 */
+    { .symbols = { 0x20, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x215 */
+    { .symbols = { 0x20, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x216 */
+    { .symbols = { 0x20, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x217 */
+    { .symbols = { 0x20, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x218 */
+    { .symbols = { 0x20, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x219 */
+    { .symbols = { 0x20, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x21a */
+    { .symbols = { 0x20, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x21b */
+    { .symbols = { 0x20, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x21c */
+    { .symbols = { 0x20, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x21d */
+    { .symbols = { 0x20, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x21e */
+    { .symbols = { 0x20, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x21f */
+    { .symbols = { 0x20, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x220 */
+    { .symbols = { 0x20, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x221 */
+    { .symbols = { 0x20, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x222 */
+    { .symbols = { 0x20, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x223 */
+    { .symbols = { 0x20, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x224 */
+    { .symbols = { 0x20, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x225 */
+    { .symbols = { 0x20, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x226 */
+    { .symbols = { 0x20, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x227 */
+    { .symbols = { 0x20, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x228 */
+    { .symbols = { 0x20, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x229 */
+    { .symbols = { 0x20, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x22a */
+    { .symbols = { 0x20, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x22b */
+    { .symbols = { 0x20, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x22c */
+    { .symbols = { 0x20, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x22d */
+    { .symbols = { 0x20, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x22e */
+    { .symbols = { 0x20, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x22f */
+    { .symbols = { 0x20, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x230 */
+    { .symbols = { 0x20, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x231 */
+    { .symbols = { 0x20, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x232 */
+    { .symbols = { 0x20, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x233 */
+    { .symbols = { 0x20, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x234 */
+    { .symbols = { 0x20, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x235 */
+    { .symbols = { 0x20, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x236 */
+    { .symbols = { 0x20, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x237 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x238 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x239 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x23a */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x23b */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x23c */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x23d */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x23e */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x23f */
+    { .symbols = { 0x20, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x240 */
+    { .symbols = { 0x20, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x241 */
+    { .symbols = { 0x20, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x242 */
+    { .symbols = { 0x20, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x243 */
+    { .symbols = { 0x20, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x244 */
+    { .symbols = { 0x20, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x245 */
+    { .symbols = { 0x20, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x246 */
+    { .symbols = { 0x20, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x247 */
+    { .symbols = { 0x20, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x248 */
+    { .symbols = { 0x20, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x249 */
+    { .symbols = { 0x20, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x24a */
+    { .symbols = { 0x20, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x24b */
+    { .symbols = { 0x20, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x24c */
+    { .symbols = { 0x20, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x24d */
+    { .symbols = { 0x20, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x24e */
+    { .symbols = { 0x20, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x24f */
+    { .symbols = { 0x20, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x250 */
+    { .symbols = { 0x20, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x251 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x252 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x253 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x254 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x255 */
+    { .symbols = { 0x20, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x256 */
+    { .symbols = { 0x20, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x257 */
+    { .symbols = { 0x20, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x258 */
+    { .symbols = { 0x20, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x259 */
+    { .symbols = { 0x20, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x25a */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x25b */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x25c */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x25d */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x25e */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x25f */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x260 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x261 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x262 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x263 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x264 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x265 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x266 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x267 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x268 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x269 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x26a */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x26b */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x26c */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x26d */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x26e */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x26f */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x270 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x271 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x272 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x273 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x274 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x275 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x276 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x277 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x278 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x279 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x27a */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x27b */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x27c */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x27d */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x27e */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x27f */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x280 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x281 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x282 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x283 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x284 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x285 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x286 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x287 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x288 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x289 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x28a */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x28b */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x28c */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x28d */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x28e */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x28f */
+    { .symbols = { 0x61, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x290 */
+    { .symbols = { 0x61, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x291 */
+    { .symbols = { 0x61, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x292 */
+    { .symbols = { 0x61, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x293 */
+    { .symbols = { 0x61, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x294 */
+    { .symbols = { 0x61, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x295 */
+    { .symbols = { 0x61, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x296 */
+    { .symbols = { 0x61, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x297 */
+    { .symbols = { 0x61, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x298 */
+    { .symbols = { 0x61, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x299 */
+    { .symbols = { 0x61, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x29a */
+    { .symbols = { 0x61, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x29b */
+    { .symbols = { 0x61, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x29c */
+    { .symbols = { 0x61, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x29d */
+    { .symbols = { 0x61, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x29e */
+    { .symbols = { 0x61, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x29f */
+    { .symbols = { 0x61, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a0 */
+    { .symbols = { 0x61, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a1 */
+    { .symbols = { 0x61, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a2 */
+    { .symbols = { 0x61, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a3 */
+    { .symbols = { 0x61, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a4 */
+    { .symbols = { 0x61, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a5 */
+    { .symbols = { 0x61, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a6 */
+    { .symbols = { 0x61, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a7 */
+    { .symbols = { 0x61, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a8 */
+    { .symbols = { 0x61, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a9 */
+    { .symbols = { 0x61, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2aa */
+    { .symbols = { 0x61, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2ab */
+    { .symbols = { 0x61, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2ac */
+    { .symbols = { 0x61, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2ad */
+    { .symbols = { 0x61, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2ae */
+    { .symbols = { 0x61, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2af */
+    { .symbols = { 0x61, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2b0 */
+    { .symbols = { 0x61, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2b1 */
+    { .symbols = { 0x61, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2b2 */
+    { .symbols = { 0x61, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2b3 */
+    { .symbols = { 0x61, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2b4 */
+    { .symbols = { 0x61, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2b5 */
+    { .symbols = { 0x61, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2b6 */
+    { .symbols = { 0x61, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2b7 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2b8 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2b9 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2ba */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2bb */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2bc */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2bd */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2be */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2bf */
+    { .symbols = { 0x61, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c0 */
+    { .symbols = { 0x61, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c1 */
+    { .symbols = { 0x61, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c2 */
+    { .symbols = { 0x61, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c3 */
+    { .symbols = { 0x61, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c4 */
+    { .symbols = { 0x61, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c5 */
+    { .symbols = { 0x61, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c6 */
+    { .symbols = { 0x61, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c7 */
+    { .symbols = { 0x61, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c8 */
+    { .symbols = { 0x61, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c9 */
+    { .symbols = { 0x61, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2ca */
+    { .symbols = { 0x61, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2cb */
+    { .symbols = { 0x61, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2cc */
+    { .symbols = { 0x61, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2cd */
+    { .symbols = { 0x61, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2ce */
+    { .symbols = { 0x61, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2cf */
+    { .symbols = { 0x61, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2d0 */
+    { .symbols = { 0x61, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2d1 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2d2 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2d3 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2d4 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2d5 */
+    { .symbols = { 0x61, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x2d6 */
+    { .symbols = { 0x61, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x2d7 */
+    { .symbols = { 0x61, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x2d8 */
+    { .symbols = { 0x61, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x2d9 */
+    { .symbols = { 0x61, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x2da */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2db */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2dc */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2dd */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2de */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2df */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e0 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e1 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e2 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e3 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e4 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e5 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e6 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e7 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e8 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e9 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2ea */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2eb */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2ec */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2ed */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2ee */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2ef */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f0 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f1 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f2 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f3 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f4 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f5 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f6 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f7 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f8 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f9 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2fa */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2fb */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2fc */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2fd */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2fe */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2ff */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x300 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x301 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x302 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x303 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x304 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x305 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x306 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x307 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x308 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x309 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x30a */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x30b */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x30c */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x30d */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x30e */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x30f */
+    { .symbols = { 0x65, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x310 */
+    { .symbols = { 0x65, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x311 */
+    { .symbols = { 0x65, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x312 */
+    { .symbols = { 0x65, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x313 */
+    { .symbols = { 0x65, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x314 */
+    { .symbols = { 0x65, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x315 */
+    { .symbols = { 0x65, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x316 */
+    { .symbols = { 0x65, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x317 */
+    { .symbols = { 0x65, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x318 */
+    { .symbols = { 0x65, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x319 */
+    { .symbols = { 0x65, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x31a */
+    { .symbols = { 0x65, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x31b */
+    { .symbols = { 0x65, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x31c */
+    { .symbols = { 0x65, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x31d */
+    { .symbols = { 0x65, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x31e */
+    { .symbols = { 0x65, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x31f */
+    { .symbols = { 0x65, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x320 */
+    { .symbols = { 0x65, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x321 */
+    { .symbols = { 0x65, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x322 */
+    { .symbols = { 0x65, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x323 */
+    { .symbols = { 0x65, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x324 */
+    { .symbols = { 0x65, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x325 */
+    { .symbols = { 0x65, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x326 */
+    { .symbols = { 0x65, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x327 */
+    { .symbols = { 0x65, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x328 */
+    { .symbols = { 0x65, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x329 */
+    { .symbols = { 0x65, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x32a */
+    { .symbols = { 0x65, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x32b */
+    { .symbols = { 0x65, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x32c */
+    { .symbols = { 0x65, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x32d */
+    { .symbols = { 0x65, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x32e */
+    { .symbols = { 0x65, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x32f */
+    { .symbols = { 0x65, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x330 */
+    { .symbols = { 0x65, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x331 */
+    { .symbols = { 0x65, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x332 */
+    { .symbols = { 0x65, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x333 */
+    { .symbols = { 0x65, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x334 */
+    { .symbols = { 0x65, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x335 */
+    { .symbols = { 0x65, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x336 */
+    { .symbols = { 0x65, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x337 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x338 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x339 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x33a */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x33b */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x33c */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x33d */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x33e */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x33f */
+    { .symbols = { 0x65, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x340 */
+    { .symbols = { 0x65, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x341 */
+    { .symbols = { 0x65, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x342 */
+    { .symbols = { 0x65, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x343 */
+    { .symbols = { 0x65, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x344 */
+    { .symbols = { 0x65, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x345 */
+    { .symbols = { 0x65, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x346 */
+    { .symbols = { 0x65, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x347 */
+    { .symbols = { 0x65, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x348 */
+    { .symbols = { 0x65, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x349 */
+    { .symbols = { 0x65, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x34a */
+    { .symbols = { 0x65, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x34b */
+    { .symbols = { 0x65, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x34c */
+    { .symbols = { 0x65, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x34d */
+    { .symbols = { 0x65, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x34e */
+    { .symbols = { 0x65, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x34f */
+    { .symbols = { 0x65, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x350 */
+    { .symbols = { 0x65, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x351 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x352 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x353 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x354 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x355 */
+    { .symbols = { 0x65, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x356 */
+    { .symbols = { 0x65, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x357 */
+    { .symbols = { 0x65, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x358 */
+    { .symbols = { 0x65, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x359 */
+    { .symbols = { 0x65, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x35a */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x35b */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x35c */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x35d */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x35e */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x35f */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x360 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x361 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x362 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x363 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x364 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x365 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x366 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x367 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x368 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x369 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x36a */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x36b */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x36c */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x36d */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x36e */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x36f */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x370 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x371 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x372 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x373 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x374 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x375 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x376 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x377 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x378 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x379 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x37a */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x37b */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x37c */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x37d */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x37e */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x37f */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x380 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x381 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x382 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x383 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x384 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x385 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x386 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x387 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x388 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x389 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x38a */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x38b */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x38c */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x38d */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x38e */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x38f */
+    { .symbols = { 0x69, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x390 */
+    { .symbols = { 0x69, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x391 */
+    { .symbols = { 0x69, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x392 */
+    { .symbols = { 0x69, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x393 */
+    { .symbols = { 0x69, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x394 */
+    { .symbols = { 0x69, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x395 */
+    { .symbols = { 0x69, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x396 */
+    { .symbols = { 0x69, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x397 */
+    { .symbols = { 0x69, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x398 */
+    { .symbols = { 0x69, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x399 */
+    { .symbols = { 0x69, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x39a */
+    { .symbols = { 0x69, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x39b */
+    { .symbols = { 0x69, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x39c */
+    { .symbols = { 0x69, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x39d */
+    { .symbols = { 0x69, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x39e */
+    { .symbols = { 0x69, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x39f */
+    { .symbols = { 0x69, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a0 */
+    { .symbols = { 0x69, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a1 */
+    { .symbols = { 0x69, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a2 */
+    { .symbols = { 0x69, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a3 */
+    { .symbols = { 0x69, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a4 */
+    { .symbols = { 0x69, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a5 */
+    { .symbols = { 0x69, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a6 */
+    { .symbols = { 0x69, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a7 */
+    { .symbols = { 0x69, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a8 */
+    { .symbols = { 0x69, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a9 */
+    { .symbols = { 0x69, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3aa */
+    { .symbols = { 0x69, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3ab */
+    { .symbols = { 0x69, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3ac */
+    { .symbols = { 0x69, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3ad */
+    { .symbols = { 0x69, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3ae */
+    { .symbols = { 0x69, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3af */
+    { .symbols = { 0x69, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3b0 */
+    { .symbols = { 0x69, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3b1 */
+    { .symbols = { 0x69, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3b2 */
+    { .symbols = { 0x69, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3b3 */
+    { .symbols = { 0x69, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3b4 */
+    { .symbols = { 0x69, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3b5 */
+    { .symbols = { 0x69, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3b6 */
+    { .symbols = { 0x69, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3b7 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3b8 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3b9 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3ba */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3bb */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3bc */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3bd */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3be */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3bf */
+    { .symbols = { 0x69, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c0 */
+    { .symbols = { 0x69, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c1 */
+    { .symbols = { 0x69, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c2 */
+    { .symbols = { 0x69, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c3 */
+    { .symbols = { 0x69, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c4 */
+    { .symbols = { 0x69, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c5 */
+    { .symbols = { 0x69, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c6 */
+    { .symbols = { 0x69, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c7 */
+    { .symbols = { 0x69, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c8 */
+    { .symbols = { 0x69, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c9 */
+    { .symbols = { 0x69, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3ca */
+    { .symbols = { 0x69, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3cb */
+    { .symbols = { 0x69, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3cc */
+    { .symbols = { 0x69, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3cd */
+    { .symbols = { 0x69, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3ce */
+    { .symbols = { 0x69, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3cf */
+    { .symbols = { 0x69, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3d0 */
+    { .symbols = { 0x69, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3d1 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3d2 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3d3 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3d4 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3d5 */
+    { .symbols = { 0x69, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x3d6 */
+    { .symbols = { 0x69, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x3d7 */
+    { .symbols = { 0x69, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x3d8 */
+    { .symbols = { 0x69, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x3d9 */
+    { .symbols = { 0x69, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x3da */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3db */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3dc */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3dd */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3de */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3df */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e0 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e1 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e2 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e3 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e4 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e5 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e6 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e7 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e8 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e9 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3ea */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3eb */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3ec */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3ed */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3ee */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3ef */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f0 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f1 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f2 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f3 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f4 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f5 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f6 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f7 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f8 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f9 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3fa */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3fb */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3fc */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3fd */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3fe */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3ff */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x400 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x401 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x402 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x403 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x404 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x405 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x406 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x407 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x408 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x409 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x40a */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x40b */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x40c */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x40d */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x40e */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x40f */
+    { .symbols = { 0x6e, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x410 */
+    { .symbols = { 0x6e, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x411 */
+    { .symbols = { 0x6e, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x412 */
+    { .symbols = { 0x6e, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x413 */
+    { .symbols = { 0x6e, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x414 */
+    { .symbols = { 0x6e, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x415 */
+    { .symbols = { 0x6e, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x416 */
+    { .symbols = { 0x6e, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x417 */
+    { .symbols = { 0x6e, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x418 */
+    { .symbols = { 0x6e, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x419 */
+    { .symbols = { 0x6e, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x41a */
+    { .symbols = { 0x6e, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x41b */
+    { .symbols = { 0x6e, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x41c */
+    { .symbols = { 0x6e, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x41d */
+    { .symbols = { 0x6e, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x41e */
+    { .symbols = { 0x6e, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x41f */
+    { .symbols = { 0x6e, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x420 */
+    { .symbols = { 0x6e, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x421 */
+    { .symbols = { 0x6e, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x422 */
+    { .symbols = { 0x6e, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x423 */
+    { .symbols = { 0x6e, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x424 */
+    { .symbols = { 0x6e, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x425 */
+    { .symbols = { 0x6e, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x426 */
+    { .symbols = { 0x6e, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x427 */
+    { .symbols = { 0x6e, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x428 */
+    { .symbols = { 0x6e, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x429 */
+    { .symbols = { 0x6e, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x42a */
+    { .symbols = { 0x6e, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x42b */
+    { .symbols = { 0x6e, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x42c */
+    { .symbols = { 0x6e, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x42d */
+    { .symbols = { 0x6e, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x42e */
+    { .symbols = { 0x6e, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x42f */
+    { .symbols = { 0x6e, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x430 */
+    { .symbols = { 0x6e, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x431 */
+    { .symbols = { 0x6e, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x432 */
+    { .symbols = { 0x6e, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x433 */
+    { .symbols = { 0x6e, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x434 */
+    { .symbols = { 0x6e, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x435 */
+    { .symbols = { 0x6e, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x436 */
+    { .symbols = { 0x6e, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x437 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x438 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x439 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x43a */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x43b */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x43c */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x43d */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x43e */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x43f */
+    { .symbols = { 0x6e, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x440 */
+    { .symbols = { 0x6e, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x441 */
+    { .symbols = { 0x6e, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x442 */
+    { .symbols = { 0x6e, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x443 */
+    { .symbols = { 0x6e, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x444 */
+    { .symbols = { 0x6e, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x445 */
+    { .symbols = { 0x6e, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x446 */
+    { .symbols = { 0x6e, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x447 */
+    { .symbols = { 0x6e, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x448 */
+    { .symbols = { 0x6e, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x449 */
+    { .symbols = { 0x6e, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x44a */
+    { .symbols = { 0x6e, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x44b */
+    { .symbols = { 0x6e, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x44c */
+    { .symbols = { 0x6e, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x44d */
+    { .symbols = { 0x6e, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x44e */
+    { .symbols = { 0x6e, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x44f */
+    { .symbols = { 0x6e, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x450 */
+    { .symbols = { 0x6e, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x451 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x452 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x453 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x454 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x455 */
+    { .symbols = { 0x6e, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x456 */
+    { .symbols = { 0x6e, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x457 */
+    { .symbols = { 0x6e, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x458 */
+    { .symbols = { 0x6e, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x459 */
+    { .symbols = { 0x6e, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x45a */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x45b */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x45c */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x45d */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x45e */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x45f */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x460 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x461 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x462 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x463 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x464 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x465 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x466 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x467 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x468 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x469 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x46a */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x46b */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x46c */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x46d */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x46e */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x46f */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x470 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x471 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x472 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x473 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x474 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x475 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x476 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x477 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x478 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x479 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x47a */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x47b */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x47c */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x47d */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x47e */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x47f */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x480 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x481 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x482 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x483 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x484 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x485 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x486 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x487 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x488 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x489 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x48a */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x48b */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x48c */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x48d */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x48e */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x48f */
+    { .symbols = { 0x6f, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x490 */
+    { .symbols = { 0x6f, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x491 */
+    { .symbols = { 0x6f, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x492 */
+    { .symbols = { 0x6f, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x493 */
+    { .symbols = { 0x6f, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x494 */
+    { .symbols = { 0x6f, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x495 */
+    { .symbols = { 0x6f, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x496 */
+    { .symbols = { 0x6f, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x497 */
+    { .symbols = { 0x6f, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x498 */
+    { .symbols = { 0x6f, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x499 */
+    { .symbols = { 0x6f, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x49a */
+    { .symbols = { 0x6f, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x49b */
+    { .symbols = { 0x6f, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x49c */
+    { .symbols = { 0x6f, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x49d */
+    { .symbols = { 0x6f, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x49e */
+    { .symbols = { 0x6f, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x49f */
+    { .symbols = { 0x6f, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a0 */
+    { .symbols = { 0x6f, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a1 */
+    { .symbols = { 0x6f, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a2 */
+    { .symbols = { 0x6f, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a3 */
+    { .symbols = { 0x6f, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a4 */
+    { .symbols = { 0x6f, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a5 */
+    { .symbols = { 0x6f, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a6 */
+    { .symbols = { 0x6f, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a7 */
+    { .symbols = { 0x6f, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a8 */
+    { .symbols = { 0x6f, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a9 */
+    { .symbols = { 0x6f, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4aa */
+    { .symbols = { 0x6f, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4ab */
+    { .symbols = { 0x6f, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4ac */
+    { .symbols = { 0x6f, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4ad */
+    { .symbols = { 0x6f, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4ae */
+    { .symbols = { 0x6f, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4af */
+    { .symbols = { 0x6f, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4b0 */
+    { .symbols = { 0x6f, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4b1 */
+    { .symbols = { 0x6f, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4b2 */
+    { .symbols = { 0x6f, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4b3 */
+    { .symbols = { 0x6f, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4b4 */
+    { .symbols = { 0x6f, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4b5 */
+    { .symbols = { 0x6f, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4b6 */
+    { .symbols = { 0x6f, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4b7 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4b8 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4b9 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4ba */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4bb */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4bc */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4bd */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4be */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4bf */
+    { .symbols = { 0x6f, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c0 */
+    { .symbols = { 0x6f, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c1 */
+    { .symbols = { 0x6f, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c2 */
+    { .symbols = { 0x6f, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c3 */
+    { .symbols = { 0x6f, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c4 */
+    { .symbols = { 0x6f, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c5 */
+    { .symbols = { 0x6f, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c6 */
+    { .symbols = { 0x6f, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c7 */
+    { .symbols = { 0x6f, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c8 */
+    { .symbols = { 0x6f, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c9 */
+    { .symbols = { 0x6f, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4ca */
+    { .symbols = { 0x6f, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4cb */
+    { .symbols = { 0x6f, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4cc */
+    { .symbols = { 0x6f, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4cd */
+    { .symbols = { 0x6f, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4ce */
+    { .symbols = { 0x6f, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4cf */
+    { .symbols = { 0x6f, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4d0 */
+    { .symbols = { 0x6f, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4d1 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4d2 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4d3 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4d4 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4d5 */
+    { .symbols = { 0x6f, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x4d6 */
+    { .symbols = { 0x6f, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x4d7 */
+    { .symbols = { 0x6f, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x4d8 */
+    { .symbols = { 0x6f, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x4d9 */
+    { .symbols = { 0x6f, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x4da */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4db */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4dc */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4dd */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4de */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4df */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e0 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e1 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e2 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e3 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e4 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e5 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e6 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e7 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e8 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e9 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4ea */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4eb */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4ec */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4ed */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4ee */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4ef */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f0 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f1 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f2 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f3 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f4 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f5 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f6 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f7 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f8 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f9 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4fa */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4fb */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4fc */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4fd */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4fe */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4ff */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x500 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x501 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x502 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x503 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x504 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x505 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x506 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x507 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x508 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x509 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x50a */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x50b */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x50c */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x50d */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x50e */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x50f */
+    { .symbols = { 0x72, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x510 */
+    { .symbols = { 0x72, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x511 */
+    { .symbols = { 0x72, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x512 */
+    { .symbols = { 0x72, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x513 */
+    { .symbols = { 0x72, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x514 */
+    { .symbols = { 0x72, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x515 */
+    { .symbols = { 0x72, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x516 */
+    { .symbols = { 0x72, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x517 */
+    { .symbols = { 0x72, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x518 */
+    { .symbols = { 0x72, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x519 */
+    { .symbols = { 0x72, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x51a */
+    { .symbols = { 0x72, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x51b */
+    { .symbols = { 0x72, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x51c */
+    { .symbols = { 0x72, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x51d */
+    { .symbols = { 0x72, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x51e */
+    { .symbols = { 0x72, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x51f */
+    { .symbols = { 0x72, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x520 */
+    { .symbols = { 0x72, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x521 */
+    { .symbols = { 0x72, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x522 */
+    { .symbols = { 0x72, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x523 */
+    { .symbols = { 0x72, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x524 */
+    { .symbols = { 0x72, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x525 */
+    { .symbols = { 0x72, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x526 */
+    { .symbols = { 0x72, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x527 */
+    { .symbols = { 0x72, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x528 */
+    { .symbols = { 0x72, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x529 */
+    { .symbols = { 0x72, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x52a */
+    { .symbols = { 0x72, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x52b */
+    { .symbols = { 0x72, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x52c */
+    { .symbols = { 0x72, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x52d */
+    { .symbols = { 0x72, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x52e */
+    { .symbols = { 0x72, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x52f */
+    { .symbols = { 0x72, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x530 */
+    { .symbols = { 0x72, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x531 */
+    { .symbols = { 0x72, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x532 */
+    { .symbols = { 0x72, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x533 */
+    { .symbols = { 0x72, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x534 */
+    { .symbols = { 0x72, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x535 */
+    { .symbols = { 0x72, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x536 */
+    { .symbols = { 0x72, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x537 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x538 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x539 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x53a */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x53b */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x53c */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x53d */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x53e */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x53f */
+    { .symbols = { 0x72, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x540 */
+    { .symbols = { 0x72, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x541 */
+    { .symbols = { 0x72, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x542 */
+    { .symbols = { 0x72, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x543 */
+    { .symbols = { 0x72, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x544 */
+    { .symbols = { 0x72, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x545 */
+    { .symbols = { 0x72, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x546 */
+    { .symbols = { 0x72, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x547 */
+    { .symbols = { 0x72, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x548 */
+    { .symbols = { 0x72, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x549 */
+    { .symbols = { 0x72, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x54a */
+    { .symbols = { 0x72, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x54b */
+    { .symbols = { 0x72, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x54c */
+    { .symbols = { 0x72, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x54d */
+    { .symbols = { 0x72, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x54e */
+    { .symbols = { 0x72, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x54f */
+    { .symbols = { 0x72, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x550 */
+    { .symbols = { 0x72, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x551 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x552 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x553 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x554 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x555 */
+    { .symbols = { 0x72, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x556 */
+    { .symbols = { 0x72, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x557 */
+    { .symbols = { 0x72, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x558 */
+    { .symbols = { 0x72, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x559 */
+    { .symbols = { 0x72, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x55a */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x55b */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x55c */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x55d */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x55e */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x55f */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x560 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x561 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x562 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x563 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x564 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x565 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x566 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x567 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x568 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x569 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x56a */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x56b */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x56c */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x56d */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x56e */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x56f */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x570 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x571 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x572 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x573 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x574 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x575 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x576 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x577 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x578 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x579 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x57a */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x57b */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x57c */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x57d */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x57e */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x57f */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x580 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x581 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x582 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x583 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x584 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x585 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x586 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x587 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x588 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x589 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x58a */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x58b */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x58c */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x58d */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x58e */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x58f */
+    { .symbols = { 0x73, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x590 */
+    { .symbols = { 0x73, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x591 */
+    { .symbols = { 0x73, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x592 */
+    { .symbols = { 0x73, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x593 */
+    { .symbols = { 0x73, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x594 */
+    { .symbols = { 0x73, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x595 */
+    { .symbols = { 0x73, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x596 */
+    { .symbols = { 0x73, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x597 */
+    { .symbols = { 0x73, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x598 */
+    { .symbols = { 0x73, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x599 */
+    { .symbols = { 0x73, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x59a */
+    { .symbols = { 0x73, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x59b */
+    { .symbols = { 0x73, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x59c */
+    { .symbols = { 0x73, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x59d */
+    { .symbols = { 0x73, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x59e */
+    { .symbols = { 0x73, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x59f */
+    { .symbols = { 0x73, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a0 */
+    { .symbols = { 0x73, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a1 */
+    { .symbols = { 0x73, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a2 */
+    { .symbols = { 0x73, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a3 */
+    { .symbols = { 0x73, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a4 */
+    { .symbols = { 0x73, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a5 */
+    { .symbols = { 0x73, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a6 */
+    { .symbols = { 0x73, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a7 */
+    { .symbols = { 0x73, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a8 */
+    { .symbols = { 0x73, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a9 */
+    { .symbols = { 0x73, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5aa */
+    { .symbols = { 0x73, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5ab */
+    { .symbols = { 0x73, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5ac */
+    { .symbols = { 0x73, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5ad */
+    { .symbols = { 0x73, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5ae */
+    { .symbols = { 0x73, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5af */
+    { .symbols = { 0x73, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5b0 */
+    { .symbols = { 0x73, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5b1 */
+    { .symbols = { 0x73, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5b2 */
+    { .symbols = { 0x73, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5b3 */
+    { .symbols = { 0x73, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5b4 */
+    { .symbols = { 0x73, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5b5 */
+    { .symbols = { 0x73, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5b6 */
+    { .symbols = { 0x73, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5b7 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5b8 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5b9 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5ba */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5bb */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5bc */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5bd */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5be */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5bf */
+    { .symbols = { 0x73, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c0 */
+    { .symbols = { 0x73, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c1 */
+    { .symbols = { 0x73, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c2 */
+    { .symbols = { 0x73, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c3 */
+    { .symbols = { 0x73, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c4 */
+    { .symbols = { 0x73, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c5 */
+    { .symbols = { 0x73, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c6 */
+    { .symbols = { 0x73, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c7 */
+    { .symbols = { 0x73, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c8 */
+    { .symbols = { 0x73, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c9 */
+    { .symbols = { 0x73, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5ca */
+    { .symbols = { 0x73, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5cb */
+    { .symbols = { 0x73, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5cc */
+    { .symbols = { 0x73, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5cd */
+    { .symbols = { 0x73, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5ce */
+    { .symbols = { 0x73, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5cf */
+    { .symbols = { 0x73, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5d0 */
+    { .symbols = { 0x73, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5d1 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5d2 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5d3 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5d4 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5d5 */
+    { .symbols = { 0x73, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x5d6 */
+    { .symbols = { 0x73, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x5d7 */
+    { .symbols = { 0x73, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x5d8 */
+    { .symbols = { 0x73, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x5d9 */
+    { .symbols = { 0x73, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x5da */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5db */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5dc */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5dd */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5de */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5df */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e0 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e1 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e2 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e3 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e4 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e5 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e6 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e7 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e8 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e9 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5ea */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5eb */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5ec */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5ed */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5ee */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5ef */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f0 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f1 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f2 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f3 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f4 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f5 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f6 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f7 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f8 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f9 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5fa */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5fb */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5fc */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5fd */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5fe */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5ff */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x600 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x601 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x602 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x603 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x604 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x605 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x606 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x607 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x608 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x609 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x60a */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x60b */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x60c */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x60d */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x60e */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x60f */
+    { .symbols = { 0x74, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x610 */
+    { .symbols = { 0x74, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x611 */
+    { .symbols = { 0x74, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x612 */
+    { .symbols = { 0x74, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x613 */
+    { .symbols = { 0x74, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x614 */
+    { .symbols = { 0x74, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x615 */
+    { .symbols = { 0x74, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x616 */
+    { .symbols = { 0x74, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x617 */
+    { .symbols = { 0x74, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x618 */
+    { .symbols = { 0x74, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x619 */
+    { .symbols = { 0x74, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x61a */
+    { .symbols = { 0x74, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x61b */
+    { .symbols = { 0x74, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x61c */
+    { .symbols = { 0x74, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x61d */
+    { .symbols = { 0x74, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x61e */
+    { .symbols = { 0x74, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x61f */
+    { .symbols = { 0x74, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x620 */
+    { .symbols = { 0x74, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x621 */
+    { .symbols = { 0x74, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x622 */
+    { .symbols = { 0x74, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x623 */
+    { .symbols = { 0x74, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x624 */
+    { .symbols = { 0x74, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x625 */
+    { .symbols = { 0x74, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x626 */
+    { .symbols = { 0x74, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x627 */
+    { .symbols = { 0x74, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x628 */
+    { .symbols = { 0x74, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x629 */
+    { .symbols = { 0x74, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x62a */
+    { .symbols = { 0x74, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x62b */
+    { .symbols = { 0x74, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x62c */
+    { .symbols = { 0x74, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x62d */
+    { .symbols = { 0x74, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x62e */
+    { .symbols = { 0x74, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x62f */
+    { .symbols = { 0x74, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x630 */
+    { .symbols = { 0x74, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x631 */
+    { .symbols = { 0x74, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x632 */
+    { .symbols = { 0x74, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x633 */
+    { .symbols = { 0x74, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x634 */
+    { .symbols = { 0x74, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x635 */
+    { .symbols = { 0x74, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x636 */
+    { .symbols = { 0x74, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x637 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x638 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x639 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x63a */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x63b */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x63c */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x63d */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x63e */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x63f */
+    { .symbols = { 0x74, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x640 */
+    { .symbols = { 0x74, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x641 */
+    { .symbols = { 0x74, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x642 */
+    { .symbols = { 0x74, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x643 */
+    { .symbols = { 0x74, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x644 */
+    { .symbols = { 0x74, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x645 */
+    { .symbols = { 0x74, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x646 */
+    { .symbols = { 0x74, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x647 */
+    { .symbols = { 0x74, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x648 */
+    { .symbols = { 0x74, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x649 */
+    { .symbols = { 0x74, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x64a */
+    { .symbols = { 0x74, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x64b */
+    { .symbols = { 0x74, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x64c */
+    { .symbols = { 0x74, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x64d */
+    { .symbols = { 0x74, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x64e */
+    { .symbols = { 0x74, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x64f */
+    { .symbols = { 0x74, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x650 */
+    { .symbols = { 0x74, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x651 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x652 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x653 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x654 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x655 */
+    { .symbols = { 0x74, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x656 */
+    { .symbols = { 0x74, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x657 */
+    { .symbols = { 0x74, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x658 */
+    { .symbols = { 0x74, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x659 */
+    { .symbols = { 0x74, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x65a */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x65b */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x65c */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x65d */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x65e */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x65f */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x660 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x661 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x662 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x663 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x664 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x665 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x666 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x667 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x668 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x669 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x66a */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x66b */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x66c */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x66d */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x66e */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x66f */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x670 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x671 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x672 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x673 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x674 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x675 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x676 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x677 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x678 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x679 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x67a */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x67b */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x67c */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x67d */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x67e */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x67f */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x680 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x681 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x682 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x683 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x684 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x685 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x686 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x687 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x688 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x689 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x68a */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x68b */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x68c */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x68d */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x68e */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x68f */
+    { .symbols = { 0x75, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x690 */
+    { .symbols = { 0x75, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x691 */
+    { .symbols = { 0x75, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x692 */
+    { .symbols = { 0x75, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x693 */
+    { .symbols = { 0x75, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x694 */
+    { .symbols = { 0x75, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x695 */
+    { .symbols = { 0x75, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x696 */
+    { .symbols = { 0x75, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x697 */
+    { .symbols = { 0x75, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x698 */
+    { .symbols = { 0x75, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x699 */
+    { .symbols = { 0x75, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x69a */
+    { .symbols = { 0x75, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x69b */
+    { .symbols = { 0x75, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x69c */
+    { .symbols = { 0x75, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x69d */
+    { .symbols = { 0x75, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x69e */
+    { .symbols = { 0x75, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x69f */
+    { .symbols = { 0x75, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a0 */
+    { .symbols = { 0x75, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a1 */
+    { .symbols = { 0x75, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a2 */
+    { .symbols = { 0x75, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a3 */
+    { .symbols = { 0x75, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a4 */
+    { .symbols = { 0x75, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a5 */
+    { .symbols = { 0x75, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a6 */
+    { .symbols = { 0x75, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a7 */
+    { .symbols = { 0x75, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a8 */
+    { .symbols = { 0x75, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a9 */
+    { .symbols = { 0x75, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6aa */
+    { .symbols = { 0x75, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6ab */
+    { .symbols = { 0x75, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6ac */
+    { .symbols = { 0x75, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6ad */
+    { .symbols = { 0x75, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6ae */
+    { .symbols = { 0x75, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6af */
+    { .symbols = { 0x75, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6b0 */
+    { .symbols = { 0x75, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6b1 */
+    { .symbols = { 0x75, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6b2 */
+    { .symbols = { 0x75, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6b3 */
+    { .symbols = { 0x75, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6b4 */
+    { .symbols = { 0x75, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6b5 */
+    { .symbols = { 0x75, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6b6 */
+    { .symbols = { 0x75, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6b7 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6b8 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6b9 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6ba */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6bb */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6bc */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6bd */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6be */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6bf */
+    { .symbols = { 0x75, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c0 */
+    { .symbols = { 0x75, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c1 */
+    { .symbols = { 0x75, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c2 */
+    { .symbols = { 0x75, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c3 */
+    { .symbols = { 0x75, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c4 */
+    { .symbols = { 0x75, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c5 */
+    { .symbols = { 0x75, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c6 */
+    { .symbols = { 0x75, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c7 */
+    { .symbols = { 0x75, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c8 */
+    { .symbols = { 0x75, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c9 */
+    { .symbols = { 0x75, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6ca */
+    { .symbols = { 0x75, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6cb */
+    { .symbols = { 0x75, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6cc */
+    { .symbols = { 0x75, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6cd */
+    { .symbols = { 0x75, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6ce */
+    { .symbols = { 0x75, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6cf */
+    { .symbols = { 0x75, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6d0 */
+    { .symbols = { 0x75, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6d1 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6d2 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6d3 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6d4 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6d5 */
+    { .symbols = { 0x75, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x6d6 */
+    { .symbols = { 0x75, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x6d7 */
+    { .symbols = { 0x75, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x6d8 */
+    { .symbols = { 0x75, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x6d9 */
+    { .symbols = { 0x75, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x6da */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6db */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6dc */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6dd */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6de */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6df */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e0 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e1 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e2 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e3 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e4 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e5 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e6 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e7 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e8 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e9 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6ea */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6eb */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6ec */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6ed */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6ee */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6ef */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f0 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f1 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f2 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f3 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f4 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f5 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f6 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f7 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f8 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f9 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6fa */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6fb */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6fc */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6fd */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6fe */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6ff */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x700 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x701 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x702 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x703 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x704 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x705 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x706 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x707 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x708 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x709 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x70a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x70b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x70c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x70d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x70e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x70f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x710 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x711 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x712 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x713 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x714 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x715 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x716 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x717 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x718 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x719 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x71a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x71b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x71c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x71d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x71e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x71f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x720 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x721 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x722 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x723 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x724 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x725 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x726 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x727 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x728 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x729 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x72a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x72b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x72c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x72d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x72e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x72f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x730 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x731 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x732 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x733 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x734 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x735 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x736 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x737 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x738 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x739 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x73a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x73b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x73c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x73d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x73e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x73f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x740 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x741 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x742 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x743 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x744 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x745 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x746 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x747 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x748 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x749 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x74a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x74b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x74c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x74d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x74e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x74f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x750 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x751 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x752 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x753 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x754 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x755 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x756 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x757 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x758 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x759 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x75a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x75b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x75c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x75d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x75e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x75f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x760 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x761 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x762 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x763 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x764 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x765 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x766 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x767 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x768 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x769 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x76a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x76b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x76c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x76d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x76e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x76f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x770 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x771 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x772 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x773 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x774 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x775 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x776 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x777 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x778 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x779 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x77a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x77b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x77c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x77d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x77e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x77f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x780 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x781 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x782 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x783 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x784 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x785 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x786 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x787 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x788 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x789 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x78a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x78b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x78c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x78d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x78e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x78f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x790 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x791 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x792 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x793 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x794 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x795 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x796 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x797 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x798 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x799 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x79a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x79b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x79c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x79d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x79e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x79f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7aa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ab */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ac */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ad */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ae */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7af */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ba */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7bb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7bc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7bd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7be */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7bf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ca */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7cb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7cc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7cd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ce */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7cf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7da */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7db */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7dc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7dd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7de */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7df */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ea */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7eb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ec */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ed */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ee */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ef */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7fa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7fb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7fc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7fd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7fe */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ff */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x800 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x801 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x802 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x803 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x804 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x805 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x806 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x807 */
+    { .symbols = { 0x63, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x808 */
+    { .symbols = { 0x63, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x809 */
+    { .symbols = { 0x63, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x80a */
+    { .symbols = { 0x63, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x80b */
+    { .symbols = { 0x63, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x80c */
+    { .symbols = { 0x63, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x80d */
+    { .symbols = { 0x63, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x80e */
+    { .symbols = { 0x63, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x80f */
+    { .symbols = { 0x63, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x810 */
+    { .symbols = { 0x63, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x811 */
+    { .symbols = { 0x63, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x812 */
+    { .symbols = { 0x63, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x813 */
+    { .symbols = { 0x63, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x814 */
+    { .symbols = { 0x63, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x815 */
+    { .symbols = { 0x63, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x816 */
+    { .symbols = { 0x63, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x817 */
+    { .symbols = { 0x63, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x818 */
+    { .symbols = { 0x63, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x819 */
+    { .symbols = { 0x63, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x81a */
+    { .symbols = { 0x63, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x81b */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x81c */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x81d */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x81e */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x81f */
+    { .symbols = { 0x63, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x820 */
+    { .symbols = { 0x63, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x821 */
+    { .symbols = { 0x63, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x822 */
+    { .symbols = { 0x63, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x823 */
+    { .symbols = { 0x63, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x824 */
+    { .symbols = { 0x63, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x825 */
+    { .symbols = { 0x63, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x826 */
+    { .symbols = { 0x63, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x827 */
+    { .symbols = { 0x63, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x828 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x829 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x82a */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x82b */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x82c */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x82d */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x82e */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x82f */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x830 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x831 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x832 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x833 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x834 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x835 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x836 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x837 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x838 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x839 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x83a */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x83b */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x83c */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x83d */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x83e */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x83f */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x840 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x841 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x842 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x843 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x844 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x845 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x846 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x847 */
+    { .symbols = { 0x64, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x848 */
+    { .symbols = { 0x64, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x849 */
+    { .symbols = { 0x64, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x84a */
+    { .symbols = { 0x64, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x84b */
+    { .symbols = { 0x64, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x84c */
+    { .symbols = { 0x64, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x84d */
+    { .symbols = { 0x64, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x84e */
+    { .symbols = { 0x64, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x84f */
+    { .symbols = { 0x64, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x850 */
+    { .symbols = { 0x64, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x851 */
+    { .symbols = { 0x64, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x852 */
+    { .symbols = { 0x64, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x853 */
+    { .symbols = { 0x64, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x854 */
+    { .symbols = { 0x64, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x855 */
+    { .symbols = { 0x64, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x856 */
+    { .symbols = { 0x64, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x857 */
+    { .symbols = { 0x64, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x858 */
+    { .symbols = { 0x64, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x859 */
+    { .symbols = { 0x64, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x85a */
+    { .symbols = { 0x64, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x85b */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x85c */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x85d */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x85e */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x85f */
+    { .symbols = { 0x64, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x860 */
+    { .symbols = { 0x64, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x861 */
+    { .symbols = { 0x64, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x862 */
+    { .symbols = { 0x64, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x863 */
+    { .symbols = { 0x64, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x864 */
+    { .symbols = { 0x64, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x865 */
+    { .symbols = { 0x64, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x866 */
+    { .symbols = { 0x64, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x867 */
+    { .symbols = { 0x64, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x868 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x869 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x86a */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x86b */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x86c */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x86d */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x86e */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x86f */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x870 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x871 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x872 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x873 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x874 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x875 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x876 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x877 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x878 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x879 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x87a */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x87b */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x87c */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x87d */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x87e */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x87f */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x880 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x881 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x882 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x883 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x884 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x885 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x886 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x887 */
+    { .symbols = { 0x66, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x888 */
+    { .symbols = { 0x66, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x889 */
+    { .symbols = { 0x66, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x88a */
+    { .symbols = { 0x66, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x88b */
+    { .symbols = { 0x66, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x88c */
+    { .symbols = { 0x66, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x88d */
+    { .symbols = { 0x66, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x88e */
+    { .symbols = { 0x66, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x88f */
+    { .symbols = { 0x66, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x890 */
+    { .symbols = { 0x66, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x891 */
+    { .symbols = { 0x66, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x892 */
+    { .symbols = { 0x66, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x893 */
+    { .symbols = { 0x66, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x894 */
+    { .symbols = { 0x66, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x895 */
+    { .symbols = { 0x66, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x896 */
+    { .symbols = { 0x66, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x897 */
+    { .symbols = { 0x66, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x898 */
+    { .symbols = { 0x66, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x899 */
+    { .symbols = { 0x66, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x89a */
+    { .symbols = { 0x66, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x89b */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x89c */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x89d */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x89e */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x89f */
+    { .symbols = { 0x66, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a0 */
+    { .symbols = { 0x66, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a1 */
+    { .symbols = { 0x66, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a2 */
+    { .symbols = { 0x66, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a3 */
+    { .symbols = { 0x66, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a4 */
+    { .symbols = { 0x66, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a5 */
+    { .symbols = { 0x66, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a6 */
+    { .symbols = { 0x66, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a7 */
+    { .symbols = { 0x66, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a8 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8a9 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8aa */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ab */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ac */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ad */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ae */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8af */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b0 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b1 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b2 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b3 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b4 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b5 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b6 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b7 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b8 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b9 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ba */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8bb */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8bc */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8bd */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8be */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8bf */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8c0 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8c1 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8c2 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8c3 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8c4 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8c5 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8c6 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8c7 */
+    { .symbols = { 0x68, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8c8 */
+    { .symbols = { 0x68, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8c9 */
+    { .symbols = { 0x68, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8ca */
+    { .symbols = { 0x68, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8cb */
+    { .symbols = { 0x68, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8cc */
+    { .symbols = { 0x68, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8cd */
+    { .symbols = { 0x68, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8ce */
+    { .symbols = { 0x68, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8cf */
+    { .symbols = { 0x68, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d0 */
+    { .symbols = { 0x68, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d1 */
+    { .symbols = { 0x68, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d2 */
+    { .symbols = { 0x68, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d3 */
+    { .symbols = { 0x68, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d4 */
+    { .symbols = { 0x68, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d5 */
+    { .symbols = { 0x68, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d6 */
+    { .symbols = { 0x68, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d7 */
+    { .symbols = { 0x68, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d8 */
+    { .symbols = { 0x68, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d9 */
+    { .symbols = { 0x68, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8da */
+    { .symbols = { 0x68, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8db */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8dc */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8dd */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8de */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8df */
+    { .symbols = { 0x68, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e0 */
+    { .symbols = { 0x68, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e1 */
+    { .symbols = { 0x68, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e2 */
+    { .symbols = { 0x68, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e3 */
+    { .symbols = { 0x68, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e4 */
+    { .symbols = { 0x68, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e5 */
+    { .symbols = { 0x68, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e6 */
+    { .symbols = { 0x68, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e7 */
+    { .symbols = { 0x68, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e8 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8e9 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ea */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8eb */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ec */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ed */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ee */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ef */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f0 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f1 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f2 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f3 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f4 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f5 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f6 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f7 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f8 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f9 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8fa */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8fb */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8fc */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8fd */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8fe */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ff */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x900 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x901 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x902 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x903 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x904 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x905 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x906 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x907 */
+    { .symbols = { 0x6b, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x908 */
+    { .symbols = { 0x6b, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x909 */
+    { .symbols = { 0x6b, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x90a */
+    { .symbols = { 0x6b, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x90b */
+    { .symbols = { 0x6b, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x90c */
+    { .symbols = { 0x6b, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x90d */
+    { .symbols = { 0x6b, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x90e */
+    { .symbols = { 0x6b, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x90f */
+    { .symbols = { 0x6b, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x910 */
+    { .symbols = { 0x6b, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x911 */
+    { .symbols = { 0x6b, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x912 */
+    { .symbols = { 0x6b, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x913 */
+    { .symbols = { 0x6b, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x914 */
+    { .symbols = { 0x6b, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x915 */
+    { .symbols = { 0x6b, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x916 */
+    { .symbols = { 0x6b, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x917 */
+    { .symbols = { 0x6b, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x918 */
+    { .symbols = { 0x6b, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x919 */
+    { .symbols = { 0x6b, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x91a */
+    { .symbols = { 0x6b, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x91b */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x91c */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x91d */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x91e */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x91f */
+    { .symbols = { 0x6b, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x920 */
+    { .symbols = { 0x6b, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x921 */
+    { .symbols = { 0x6b, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x922 */
+    { .symbols = { 0x6b, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x923 */
+    { .symbols = { 0x6b, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x924 */
+    { .symbols = { 0x6b, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x925 */
+    { .symbols = { 0x6b, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x926 */
+    { .symbols = { 0x6b, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x927 */
+    { .symbols = { 0x6b, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x928 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x929 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x92a */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x92b */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x92c */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x92d */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x92e */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x92f */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x930 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x931 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x932 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x933 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x934 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x935 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x936 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x937 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x938 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x939 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x93a */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x93b */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x93c */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x93d */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x93e */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x93f */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x940 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x941 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x942 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x943 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x944 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x945 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x946 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x947 */
+    { .symbols = { 0x6c, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x948 */
+    { .symbols = { 0x6c, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x949 */
+    { .symbols = { 0x6c, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x94a */
+    { .symbols = { 0x6c, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x94b */
+    { .symbols = { 0x6c, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x94c */
+    { .symbols = { 0x6c, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x94d */
+    { .symbols = { 0x6c, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x94e */
+    { .symbols = { 0x6c, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x94f */
+    { .symbols = { 0x6c, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x950 */
+    { .symbols = { 0x6c, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x951 */
+    { .symbols = { 0x6c, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x952 */
+    { .symbols = { 0x6c, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x953 */
+    { .symbols = { 0x6c, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x954 */
+    { .symbols = { 0x6c, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x955 */
+    { .symbols = { 0x6c, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x956 */
+    { .symbols = { 0x6c, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x957 */
+    { .symbols = { 0x6c, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x958 */
+    { .symbols = { 0x6c, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x959 */
+    { .symbols = { 0x6c, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x95a */
+    { .symbols = { 0x6c, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x95b */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x95c */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x95d */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x95e */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x95f */
+    { .symbols = { 0x6c, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x960 */
+    { .symbols = { 0x6c, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x961 */
+    { .symbols = { 0x6c, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x962 */
+    { .symbols = { 0x6c, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x963 */
+    { .symbols = { 0x6c, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x964 */
+    { .symbols = { 0x6c, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x965 */
+    { .symbols = { 0x6c, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x966 */
+    { .symbols = { 0x6c, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x967 */
+    { .symbols = { 0x6c, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x968 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x969 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x96a */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x96b */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x96c */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x96d */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x96e */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x96f */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x970 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x971 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x972 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x973 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x974 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x975 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x976 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x977 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x978 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x979 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x97a */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x97b */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x97c */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x97d */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x97e */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x97f */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x980 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x981 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x982 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x983 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x984 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x985 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x986 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x987 */
+    { .symbols = { 0x6d, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x988 */
+    { .symbols = { 0x6d, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x989 */
+    { .symbols = { 0x6d, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x98a */
+    { .symbols = { 0x6d, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x98b */
+    { .symbols = { 0x6d, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x98c */
+    { .symbols = { 0x6d, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x98d */
+    { .symbols = { 0x6d, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x98e */
+    { .symbols = { 0x6d, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x98f */
+    { .symbols = { 0x6d, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x990 */
+    { .symbols = { 0x6d, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x991 */
+    { .symbols = { 0x6d, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x992 */
+    { .symbols = { 0x6d, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x993 */
+    { .symbols = { 0x6d, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x994 */
+    { .symbols = { 0x6d, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x995 */
+    { .symbols = { 0x6d, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x996 */
+    { .symbols = { 0x6d, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x997 */
+    { .symbols = { 0x6d, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x998 */
+    { .symbols = { 0x6d, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x999 */
+    { .symbols = { 0x6d, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x99a */
+    { .symbols = { 0x6d, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x99b */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x99c */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x99d */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x99e */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x99f */
+    { .symbols = { 0x6d, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a0 */
+    { .symbols = { 0x6d, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a1 */
+    { .symbols = { 0x6d, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a2 */
+    { .symbols = { 0x6d, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a3 */
+    { .symbols = { 0x6d, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a4 */
+    { .symbols = { 0x6d, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a5 */
+    { .symbols = { 0x6d, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a6 */
+    { .symbols = { 0x6d, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a7 */
+    { .symbols = { 0x6d, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a8 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9a9 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9aa */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ab */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ac */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ad */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ae */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9af */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b0 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b1 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b2 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b3 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b4 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b5 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b6 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b7 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b8 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b9 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ba */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9bb */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9bc */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9bd */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9be */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9bf */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9c0 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9c1 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9c2 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9c3 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9c4 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9c5 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9c6 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9c7 */
+    { .symbols = { 0x77, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9c8 */
+    { .symbols = { 0x77, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9c9 */
+    { .symbols = { 0x77, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9ca */
+    { .symbols = { 0x77, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9cb */
+    { .symbols = { 0x77, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9cc */
+    { .symbols = { 0x77, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9cd */
+    { .symbols = { 0x77, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9ce */
+    { .symbols = { 0x77, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9cf */
+    { .symbols = { 0x77, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d0 */
+    { .symbols = { 0x77, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d1 */
+    { .symbols = { 0x77, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d2 */
+    { .symbols = { 0x77, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d3 */
+    { .symbols = { 0x77, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d4 */
+    { .symbols = { 0x77, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d5 */
+    { .symbols = { 0x77, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d6 */
+    { .symbols = { 0x77, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d7 */
+    { .symbols = { 0x77, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d8 */
+    { .symbols = { 0x77, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d9 */
+    { .symbols = { 0x77, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9da */
+    { .symbols = { 0x77, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9db */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9dc */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9dd */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9de */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9df */
+    { .symbols = { 0x77, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e0 */
+    { .symbols = { 0x77, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e1 */
+    { .symbols = { 0x77, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e2 */
+    { .symbols = { 0x77, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e3 */
+    { .symbols = { 0x77, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e4 */
+    { .symbols = { 0x77, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e5 */
+    { .symbols = { 0x77, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e6 */
+    { .symbols = { 0x77, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e7 */
+    { .symbols = { 0x77, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e8 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9e9 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ea */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9eb */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ec */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ed */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ee */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ef */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f0 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f1 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f2 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f3 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f4 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f5 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f6 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f7 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f8 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f9 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9fa */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9fb */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9fc */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9fd */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9fe */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ff */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa00 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa01 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa02 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa03 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa04 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa05 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa06 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa07 */
+    { .symbols = { 0x79, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa08 */
+    { .symbols = { 0x79, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa09 */
+    { .symbols = { 0x79, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa0a */
+    { .symbols = { 0x79, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa0b */
+    { .symbols = { 0x79, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa0c */
+    { .symbols = { 0x79, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa0d */
+    { .symbols = { 0x79, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa0e */
+    { .symbols = { 0x79, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa0f */
+    { .symbols = { 0x79, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa10 */
+    { .symbols = { 0x79, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa11 */
+    { .symbols = { 0x79, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa12 */
+    { .symbols = { 0x79, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa13 */
+    { .symbols = { 0x79, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa14 */
+    { .symbols = { 0x79, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa15 */
+    { .symbols = { 0x79, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa16 */
+    { .symbols = { 0x79, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa17 */
+    { .symbols = { 0x79, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa18 */
+    { .symbols = { 0x79, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa19 */
+    { .symbols = { 0x79, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa1a */
+    { .symbols = { 0x79, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa1b */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa1c */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa1d */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa1e */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa1f */
+    { .symbols = { 0x79, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa20 */
+    { .symbols = { 0x79, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa21 */
+    { .symbols = { 0x79, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa22 */
+    { .symbols = { 0x79, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa23 */
+    { .symbols = { 0x79, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa24 */
+    { .symbols = { 0x79, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa25 */
+    { .symbols = { 0x79, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa26 */
+    { .symbols = { 0x79, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa27 */
+    { .symbols = { 0x79, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa28 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa29 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa2a */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa2b */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa2c */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa2d */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa2e */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa2f */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa30 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa31 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa32 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa33 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa34 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa35 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa36 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa37 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa38 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa39 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa3a */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa3b */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa3c */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa3d */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa3e */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa3f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa40 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa41 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa42 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa43 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa44 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa45 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa46 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa47 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa48 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa49 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa4a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa4b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa4c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa4d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa4e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa4f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa50 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa51 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa52 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa53 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa54 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa55 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa56 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa57 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa58 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa59 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa5a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa5b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa5c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa5d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa5e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa5f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa60 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa61 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa62 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa63 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa64 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa65 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa66 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa67 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa68 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa69 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa6a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa6b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa6c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa6d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa6e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa6f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa70 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa71 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa72 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa73 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa74 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa75 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa76 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa77 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa78 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa79 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa7a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa7b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa7c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa7d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa7e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa7f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa80 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa81 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa82 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa83 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa84 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa85 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa86 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa87 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa88 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa89 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa8a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa8b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa8c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa8d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa8e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa8f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa90 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa91 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa92 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa93 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa94 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa95 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa96 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa97 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa98 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa99 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa9a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa9b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa9c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa9d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa9e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa9f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaaa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaab */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaac */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaad */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaae */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaaf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaba */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xabb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xabc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xabd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xabe */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xabf */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xac0 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xac1 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xac2 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xac3 */
+    { .symbols = { 0x27, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xac4 */
+    { .symbols = { 0x27, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xac5 */
+    { .symbols = { 0x27, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xac6 */
+    { .symbols = { 0x27, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xac7 */
+    { .symbols = { 0x27, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xac8 */
+    { .symbols = { 0x27, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xac9 */
+    { .symbols = { 0x27, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xaca */
+    { .symbols = { 0x27, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xacb */
+    { .symbols = { 0x27, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xacc */
+    { .symbols = { 0x27, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xacd */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xace */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xacf */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad0 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad1 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad2 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad3 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad4 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad5 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad6 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad7 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad8 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad9 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xada */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xadb */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xadc */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xadd */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xade */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xadf */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xae0 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xae1 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xae2 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xae3 */
+    { .symbols = { 0x2e, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xae4 */
+    { .symbols = { 0x2e, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xae5 */
+    { .symbols = { 0x2e, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xae6 */
+    { .symbols = { 0x2e, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xae7 */
+    { .symbols = { 0x2e, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xae8 */
+    { .symbols = { 0x2e, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xae9 */
+    { .symbols = { 0x2e, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xaea */
+    { .symbols = { 0x2e, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xaeb */
+    { .symbols = { 0x2e, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xaec */
+    { .symbols = { 0x2e, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xaed */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaee */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaef */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf0 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf1 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf2 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf3 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf4 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf5 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf6 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf7 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf8 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf9 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xafa */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xafb */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xafc */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xafd */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xafe */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaff */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb00 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb01 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb02 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb03 */
+    { .symbols = { 0x62, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb04 */
+    { .symbols = { 0x62, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb05 */
+    { .symbols = { 0x62, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb06 */
+    { .symbols = { 0x62, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb07 */
+    { .symbols = { 0x62, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb08 */
+    { .symbols = { 0x62, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb09 */
+    { .symbols = { 0x62, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb0a */
+    { .symbols = { 0x62, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb0b */
+    { .symbols = { 0x62, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb0c */
+    { .symbols = { 0x62, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb0d */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb0e */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb0f */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb10 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb11 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb12 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb13 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb14 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb15 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb16 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb17 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb18 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb19 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb1a */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb1b */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb1c */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb1d */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb1e */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb1f */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb20 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb21 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb22 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb23 */
+    { .symbols = { 0x67, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb24 */
+    { .symbols = { 0x67, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb25 */
+    { .symbols = { 0x67, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb26 */
+    { .symbols = { 0x67, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb27 */
+    { .symbols = { 0x67, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb28 */
+    { .symbols = { 0x67, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb29 */
+    { .symbols = { 0x67, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb2a */
+    { .symbols = { 0x67, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb2b */
+    { .symbols = { 0x67, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb2c */
+    { .symbols = { 0x67, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb2d */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb2e */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb2f */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb30 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb31 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb32 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb33 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb34 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb35 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb36 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb37 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb38 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb39 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb3a */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb3b */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb3c */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb3d */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb3e */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb3f */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb40 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb41 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb42 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb43 */
+    { .symbols = { 0x70, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb44 */
+    { .symbols = { 0x70, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb45 */
+    { .symbols = { 0x70, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb46 */
+    { .symbols = { 0x70, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb47 */
+    { .symbols = { 0x70, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb48 */
+    { .symbols = { 0x70, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb49 */
+    { .symbols = { 0x70, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb4a */
+    { .symbols = { 0x70, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb4b */
+    { .symbols = { 0x70, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb4c */
+    { .symbols = { 0x70, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb4d */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb4e */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb4f */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb50 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb51 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb52 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb53 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb54 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb55 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb56 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb57 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb58 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb59 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb5a */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb5b */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb5c */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb5d */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb5e */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb5f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb60 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb61 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb62 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb63 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb64 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb65 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb66 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb67 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb68 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb69 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb6a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb6b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb6c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb6d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb6e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb6f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb70 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb71 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb72 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb73 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb74 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb75 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb76 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb77 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb78 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb79 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb7a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb7b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb7c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb7d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb7e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb7f */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb80 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb81 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb82 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb83 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb84 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb85 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb86 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb87 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb88 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb89 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb8a */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb8b */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb8c */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb8d */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb8e */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb8f */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb90 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb91 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb92 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb93 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb94 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb95 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb96 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb97 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb98 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb99 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb9a */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb9b */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb9c */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb9d */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb9e */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb9f */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba0 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba1 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba2 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba3 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba4 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba5 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba6 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba7 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba8 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba9 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbaa */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbab */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbac */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbad */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbae */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbaf */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb0 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb1 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb2 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb3 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb4 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb5 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb6 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb7 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb8 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb9 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbba */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbbb */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbbc */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbbd */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbbe */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbbf */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc0 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc1 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc2 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc3 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc4 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc5 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc6 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc7 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc8 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc9 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbca */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbcb */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbcc */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbcd */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbce */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbcf */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd0 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd1 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd2 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd3 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd4 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd5 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd6 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd7 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd8 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd9 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbda */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbdb */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbdc */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbdd */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbde */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbdf */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe0 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe1 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe2 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe3 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe4 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe5 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe6 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe7 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe8 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe9 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbea */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbeb */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbec */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbed */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbee */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbef */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf0 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf1 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf2 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf3 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf4 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf5 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf6 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf7 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf8 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf9 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbfa */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbfb */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbfc */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbfd */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbfe */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbff */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc00 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc01 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc02 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc03 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc04 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc05 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc06 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc07 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc08 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc09 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc0a */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc0b */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc0c */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc0d */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc0e */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc0f */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc10 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc11 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc12 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc13 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc14 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc15 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc16 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc17 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc18 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc19 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc1a */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc1b */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc1c */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc1d */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc1e */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc1f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc20 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc21 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc22 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc23 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc24 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc25 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc26 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc27 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc28 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc29 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc2a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc2b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc2c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc2d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc2e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc2f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc30 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc31 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc32 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc33 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc34 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc35 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc36 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc37 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc38 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc39 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc3a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc3b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc3c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc3d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc3e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc3f */
+    { .symbols = { 0x2d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc40 */
+    { .symbols = { 0x2d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc41 */
+    { .symbols = { 0x2d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc42 */
+    { .symbols = { 0x2d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc43 */
+    { .symbols = { 0x2d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc44 */
+    { .symbols = { 0x2d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc45 */
+    { .symbols = { 0x2d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc46 */
+    { .symbols = { 0x2d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc47 */
+    { .symbols = { 0x43, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc48 */
+    { .symbols = { 0x43, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc49 */
+    { .symbols = { 0x43, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc4a */
+    { .symbols = { 0x43, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc4b */
+    { .symbols = { 0x43, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc4c */
+    { .symbols = { 0x43, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc4d */
+    { .symbols = { 0x43, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc4e */
+    { .symbols = { 0x43, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc4f */
+    { .symbols = { 0x44, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc50 */
+    { .symbols = { 0x44, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc51 */
+    { .symbols = { 0x44, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc52 */
+    { .symbols = { 0x44, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc53 */
+    { .symbols = { 0x44, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc54 */
+    { .symbols = { 0x44, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc55 */
+    { .symbols = { 0x44, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc56 */
+    { .symbols = { 0x44, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc57 */
+    { .symbols = { 0x45, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc58 */
+    { .symbols = { 0x45, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc59 */
+    { .symbols = { 0x45, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc5a */
+    { .symbols = { 0x45, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc5b */
+    { .symbols = { 0x45, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc5c */
+    { .symbols = { 0x45, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc5d */
+    { .symbols = { 0x45, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc5e */
+    { .symbols = { 0x45, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc5f */
+    { .symbols = { 0x46, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc60 */
+    { .symbols = { 0x46, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc61 */
+    { .symbols = { 0x46, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc62 */
+    { .symbols = { 0x46, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc63 */
+    { .symbols = { 0x46, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc64 */
+    { .symbols = { 0x46, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc65 */
+    { .symbols = { 0x46, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc66 */
+    { .symbols = { 0x46, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc67 */
+    { .symbols = { 0x47, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc68 */
+    { .symbols = { 0x47, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc69 */
+    { .symbols = { 0x47, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc6a */
+    { .symbols = { 0x47, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc6b */
+    { .symbols = { 0x47, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc6c */
+    { .symbols = { 0x47, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc6d */
+    { .symbols = { 0x47, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc6e */
+    { .symbols = { 0x47, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc6f */
+    { .symbols = { 0x48, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc70 */
+    { .symbols = { 0x48, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc71 */
+    { .symbols = { 0x48, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc72 */
+    { .symbols = { 0x48, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc73 */
+    { .symbols = { 0x48, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc74 */
+    { .symbols = { 0x48, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc75 */
+    { .symbols = { 0x48, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc76 */
+    { .symbols = { 0x48, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc77 */
+    { .symbols = { 0x4c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc78 */
+    { .symbols = { 0x4c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc79 */
+    { .symbols = { 0x4c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc7a */
+    { .symbols = { 0x4c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc7b */
+    { .symbols = { 0x4c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc7c */
+    { .symbols = { 0x4c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc7d */
+    { .symbols = { 0x4c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc7e */
+    { .symbols = { 0x4c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc7f */
+    { .symbols = { 0x4d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc80 */
+    { .symbols = { 0x4d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc81 */
+    { .symbols = { 0x4d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc82 */
+    { .symbols = { 0x4d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc83 */
+    { .symbols = { 0x4d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc84 */
+    { .symbols = { 0x4d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc85 */
+    { .symbols = { 0x4d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc86 */
+    { .symbols = { 0x4d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc87 */
+    { .symbols = { 0x50, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc88 */
+    { .symbols = { 0x50, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc89 */
+    { .symbols = { 0x50, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc8a */
+    { .symbols = { 0x50, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc8b */
+    { .symbols = { 0x50, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc8c */
+    { .symbols = { 0x50, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc8d */
+    { .symbols = { 0x50, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc8e */
+    { .symbols = { 0x50, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc8f */
+    { .symbols = { 0x56, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc90 */
+    { .symbols = { 0x56, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc91 */
+    { .symbols = { 0x56, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc92 */
+    { .symbols = { 0x56, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc93 */
+    { .symbols = { 0x56, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc94 */
+    { .symbols = { 0x56, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc95 */
+    { .symbols = { 0x56, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc96 */
+    { .symbols = { 0x56, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc97 */
+    { .symbols = { 0x59, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc98 */
+    { .symbols = { 0x59, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc99 */
+    { .symbols = { 0x59, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc9a */
+    { .symbols = { 0x59, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc9b */
+    { .symbols = { 0x59, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc9c */
+    { .symbols = { 0x59, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc9d */
+    { .symbols = { 0x59, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc9e */
+    { .symbols = { 0x59, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc9f */
+    { .symbols = { 0x71, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xca0 */
+    { .symbols = { 0x71, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xca1 */
+    { .symbols = { 0x71, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xca2 */
+    { .symbols = { 0x71, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xca3 */
+    { .symbols = { 0x71, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xca4 */
+    { .symbols = { 0x71, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xca5 */
+    { .symbols = { 0x71, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xca6 */
+    { .symbols = { 0x71, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xca7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xca8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xca9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcaa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcab */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcac */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcad */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcae */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcaf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcb8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcb9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcba */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcbb */
+    { .symbols = { 0x1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcbc */
+    { .symbols = { 0x1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcbd */
+    { .symbols = { 0x1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcbe */
+    { .symbols = { 0x1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcbf */
+    { .symbols = { 0x2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc0 */
+    { .symbols = { 0x2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc1 */
+    { .symbols = { 0x2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc2 */
+    { .symbols = { 0x2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc3 */
+    { .symbols = { 0x3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc4 */
+    { .symbols = { 0x3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc5 */
+    { .symbols = { 0x3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc6 */
+    { .symbols = { 0x3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc7 */
+    { .symbols = { 0x4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc8 */
+    { .symbols = { 0x4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc9 */
+    { .symbols = { 0x4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcca */
+    { .symbols = { 0x4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xccb */
+    { .symbols = { 0x5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xccc */
+    { .symbols = { 0x5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xccd */
+    { .symbols = { 0x5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcce */
+    { .symbols = { 0x5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xccf */
+    { .symbols = { 0x6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd0 */
+    { .symbols = { 0x6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd1 */
+    { .symbols = { 0x6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd2 */
+    { .symbols = { 0x6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd3 */
+    { .symbols = { 0x7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd4 */
+    { .symbols = { 0x7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd5 */
+    { .symbols = { 0x7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd6 */
+    { .symbols = { 0x7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd7 */
+    { .symbols = { 0x8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd8 */
+    { .symbols = { 0x8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd9 */
+    { .symbols = { 0x8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcda */
+    { .symbols = { 0x8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcdb */
+    { .symbols = { 0x9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcdc */
+    { .symbols = { 0x9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcdd */
+    { .symbols = { 0x9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcde */
+    { .symbols = { 0x9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcdf */
+    { .symbols = { 0xb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce0 */
+    { .symbols = { 0xb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce1 */
+    { .symbols = { 0xb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce2 */
+    { .symbols = { 0xb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce3 */
+    { .symbols = { 0xc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce4 */
+    { .symbols = { 0xc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce5 */
+    { .symbols = { 0xc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce6 */
+    { .symbols = { 0xc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce7 */
+    { .symbols = { 0xd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce8 */
+    { .symbols = { 0xd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce9 */
+    { .symbols = { 0xd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcea */
+    { .symbols = { 0xd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xceb */
+    { .symbols = { 0xe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcec */
+    { .symbols = { 0xe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xced */
+    { .symbols = { 0xe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcee */
+    { .symbols = { 0xe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcef */
+    { .symbols = { 0xf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf0 */
+    { .symbols = { 0xf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf1 */
+    { .symbols = { 0xf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf2 */
+    { .symbols = { 0xf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf3 */
+    { .symbols = { 0x10, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf4 */
+    { .symbols = { 0x10, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf5 */
+    { .symbols = { 0x10, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf6 */
+    { .symbols = { 0x10, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf7 */
+    { .symbols = { 0x11, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf8 */
+    { .symbols = { 0x11, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf9 */
+    { .symbols = { 0x11, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcfa */
+    { .symbols = { 0x11, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcfb */
+    { .symbols = { 0x12, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcfc */
+    { .symbols = { 0x12, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcfd */
+    { .symbols = { 0x12, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcfe */
+    { .symbols = { 0x12, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcff */
+    { .symbols = { 0x13, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd00 */
+    { .symbols = { 0x13, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd01 */
+    { .symbols = { 0x13, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd02 */
+    { .symbols = { 0x13, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd03 */
+    { .symbols = { 0x14, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd04 */
+    { .symbols = { 0x14, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd05 */
+    { .symbols = { 0x14, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd06 */
+    { .symbols = { 0x14, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd07 */
+    { .symbols = { 0x15, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd08 */
+    { .symbols = { 0x15, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd09 */
+    { .symbols = { 0x15, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd0a */
+    { .symbols = { 0x15, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd0b */
+    { .symbols = { 0x16, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd0c */
+    { .symbols = { 0x16, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd0d */
+    { .symbols = { 0x16, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd0e */
+    { .symbols = { 0x16, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd0f */
+    { .symbols = { 0x17, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd10 */
+    { .symbols = { 0x17, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd11 */
+    { .symbols = { 0x17, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd12 */
+    { .symbols = { 0x17, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd13 */
+    { .symbols = { 0x18, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd14 */
+    { .symbols = { 0x18, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd15 */
+    { .symbols = { 0x18, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd16 */
+    { .symbols = { 0x18, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd17 */
+    { .symbols = { 0x19, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd18 */
+    { .symbols = { 0x19, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd19 */
+    { .symbols = { 0x19, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd1a */
+    { .symbols = { 0x19, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd1b */
+    { .symbols = { 0x1a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd1c */
+    { .symbols = { 0x1a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd1d */
+    { .symbols = { 0x1a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd1e */
+    { .symbols = { 0x1a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd1f */
+    { .symbols = { 0x1b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd20 */
+    { .symbols = { 0x1b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd21 */
+    { .symbols = { 0x1b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd22 */
+    { .symbols = { 0x1b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd23 */
+    { .symbols = { 0x1c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd24 */
+    { .symbols = { 0x1c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd25 */
+    { .symbols = { 0x1c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd26 */
+    { .symbols = { 0x1c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd27 */
+    { .symbols = { 0x1d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd28 */
+    { .symbols = { 0x1d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd29 */
+    { .symbols = { 0x1d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd2a */
+    { .symbols = { 0x1d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd2b */
+    { .symbols = { 0x1e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd2c */
+    { .symbols = { 0x1e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd2d */
+    { .symbols = { 0x1e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd2e */
+    { .symbols = { 0x1e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd2f */
+    { .symbols = { 0x1f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd30 */
+    { .symbols = { 0x1f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd31 */
+    { .symbols = { 0x1f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd32 */
+    { .symbols = { 0x1f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd33 */
+    { .symbols = { 0x21, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd34 */
+    { .symbols = { 0x21, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd35 */
+    { .symbols = { 0x21, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd36 */
+    { .symbols = { 0x21, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd37 */
+    { .symbols = { 0x22, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd38 */
+    { .symbols = { 0x22, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd39 */
+    { .symbols = { 0x22, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd3a */
+    { .symbols = { 0x22, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd3b */
+    { .symbols = { 0x23, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd3c */
+    { .symbols = { 0x23, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd3d */
+    { .symbols = { 0x23, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd3e */
+    { .symbols = { 0x23, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd3f */
+    { .symbols = { 0x24, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd40 */
+    { .symbols = { 0x24, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd41 */
+    { .symbols = { 0x24, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd42 */
+    { .symbols = { 0x24, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd43 */
+    { .symbols = { 0x25, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd44 */
+    { .symbols = { 0x25, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd45 */
+    { .symbols = { 0x25, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd46 */
+    { .symbols = { 0x25, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd47 */
+    { .symbols = { 0x26, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd48 */
+    { .symbols = { 0x26, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd49 */
+    { .symbols = { 0x26, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd4a */
+    { .symbols = { 0x26, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd4b */
+    { .symbols = { 0x28, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd4c */
+    { .symbols = { 0x28, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd4d */
+    { .symbols = { 0x28, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd4e */
+    { .symbols = { 0x28, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd4f */
+    { .symbols = { 0x29, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd50 */
+    { .symbols = { 0x29, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd51 */
+    { .symbols = { 0x29, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd52 */
+    { .symbols = { 0x29, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd53 */
+    { .symbols = { 0x2a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd54 */
+    { .symbols = { 0x2a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd55 */
+    { .symbols = { 0x2a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd56 */
+    { .symbols = { 0x2a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd57 */
+    { .symbols = { 0x2b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd58 */
+    { .symbols = { 0x2b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd59 */
+    { .symbols = { 0x2b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd5a */
+    { .symbols = { 0x2b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd5b */
+    { .symbols = { 0x2f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd5c */
+    { .symbols = { 0x2f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd5d */
+    { .symbols = { 0x2f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd5e */
+    { .symbols = { 0x2f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd5f */
+    { .symbols = { 0x30, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd60 */
+    { .symbols = { 0x30, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd61 */
+    { .symbols = { 0x30, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd62 */
+    { .symbols = { 0x30, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd63 */
+    { .symbols = { 0x31, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd64 */
+    { .symbols = { 0x31, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd65 */
+    { .symbols = { 0x31, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd66 */
+    { .symbols = { 0x31, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd67 */
+    { .symbols = { 0x32, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd68 */
+    { .symbols = { 0x32, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd69 */
+    { .symbols = { 0x32, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd6a */
+    { .symbols = { 0x32, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd6b */
+    { .symbols = { 0x33, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd6c */
+    { .symbols = { 0x33, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd6d */
+    { .symbols = { 0x33, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd6e */
+    { .symbols = { 0x33, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd6f */
+    { .symbols = { 0x34, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd70 */
+    { .symbols = { 0x34, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd71 */
+    { .symbols = { 0x34, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd72 */
+    { .symbols = { 0x34, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd73 */
+    { .symbols = { 0x35, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd74 */
+    { .symbols = { 0x35, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd75 */
+    { .symbols = { 0x35, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd76 */
+    { .symbols = { 0x35, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd77 */
+    { .symbols = { 0x36, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd78 */
+    { .symbols = { 0x36, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd79 */
+    { .symbols = { 0x36, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd7a */
+    { .symbols = { 0x36, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd7b */
+    { .symbols = { 0x37, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd7c */
+    { .symbols = { 0x37, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd7d */
+    { .symbols = { 0x37, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd7e */
+    { .symbols = { 0x37, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd7f */
+    { .symbols = { 0x38, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd80 */
+    { .symbols = { 0x38, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd81 */
+    { .symbols = { 0x38, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd82 */
+    { .symbols = { 0x38, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd83 */
+    { .symbols = { 0x39, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd84 */
+    { .symbols = { 0x39, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd85 */
+    { .symbols = { 0x39, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd86 */
+    { .symbols = { 0x39, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd87 */
+    { .symbols = { 0x3a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd88 */
+    { .symbols = { 0x3a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd89 */
+    { .symbols = { 0x3a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd8a */
+    { .symbols = { 0x3a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd8b */
+    { .symbols = { 0x3b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd8c */
+    { .symbols = { 0x3b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd8d */
+    { .symbols = { 0x3b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd8e */
+    { .symbols = { 0x3b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd8f */
+    { .symbols = { 0x3c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd90 */
+    { .symbols = { 0x3c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd91 */
+    { .symbols = { 0x3c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd92 */
+    { .symbols = { 0x3c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd93 */
+    { .symbols = { 0x3d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd94 */
+    { .symbols = { 0x3d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd95 */
+    { .symbols = { 0x3d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd96 */
+    { .symbols = { 0x3d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd97 */
+    { .symbols = { 0x3e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd98 */
+    { .symbols = { 0x3e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd99 */
+    { .symbols = { 0x3e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd9a */
+    { .symbols = { 0x3e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd9b */
+    { .symbols = { 0x40, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd9c */
+    { .symbols = { 0x40, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd9d */
+    { .symbols = { 0x40, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd9e */
+    { .symbols = { 0x40, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd9f */
+    { .symbols = { 0x41, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda0 */
+    { .symbols = { 0x41, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda1 */
+    { .symbols = { 0x41, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda2 */
+    { .symbols = { 0x41, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda3 */
+    { .symbols = { 0x4a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda4 */
+    { .symbols = { 0x4a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda5 */
+    { .symbols = { 0x4a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda6 */
+    { .symbols = { 0x4a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda7 */
+    { .symbols = { 0x4b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda8 */
+    { .symbols = { 0x4b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda9 */
+    { .symbols = { 0x4b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdaa */
+    { .symbols = { 0x4b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdab */
+    { .symbols = { 0x4e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdac */
+    { .symbols = { 0x4e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdad */
+    { .symbols = { 0x4e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdae */
+    { .symbols = { 0x4e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdaf */
+    { .symbols = { 0x4f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb0 */
+    { .symbols = { 0x4f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb1 */
+    { .symbols = { 0x4f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb2 */
+    { .symbols = { 0x4f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb3 */
+    { .symbols = { 0x51, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb4 */
+    { .symbols = { 0x51, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb5 */
+    { .symbols = { 0x51, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb6 */
+    { .symbols = { 0x51, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb7 */
+    { .symbols = { 0x52, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb8 */
+    { .symbols = { 0x52, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb9 */
+    { .symbols = { 0x52, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdba */
+    { .symbols = { 0x52, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdbb */
+    { .symbols = { 0x53, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdbc */
+    { .symbols = { 0x53, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdbd */
+    { .symbols = { 0x53, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdbe */
+    { .symbols = { 0x53, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdbf */
+    { .symbols = { 0x55, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc0 */
+    { .symbols = { 0x55, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc1 */
+    { .symbols = { 0x55, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc2 */
+    { .symbols = { 0x55, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc3 */
+    { .symbols = { 0x58, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc4 */
+    { .symbols = { 0x58, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc5 */
+    { .symbols = { 0x58, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc6 */
+    { .symbols = { 0x58, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc7 */
+    { .symbols = { 0x5a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc8 */
+    { .symbols = { 0x5a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc9 */
+    { .symbols = { 0x5a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdca */
+    { .symbols = { 0x5a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdcb */
+    { .symbols = { 0x5b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdcc */
+    { .symbols = { 0x5b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdcd */
+    { .symbols = { 0x5b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdce */
+    { .symbols = { 0x5b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdcf */
+    { .symbols = { 0x5c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd0 */
+    { .symbols = { 0x5c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd1 */
+    { .symbols = { 0x5c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd2 */
+    { .symbols = { 0x5c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd3 */
+    { .symbols = { 0x5d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd4 */
+    { .symbols = { 0x5d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd5 */
+    { .symbols = { 0x5d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd6 */
+    { .symbols = { 0x5d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd7 */
+    { .symbols = { 0x5e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd8 */
+    { .symbols = { 0x5e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd9 */
+    { .symbols = { 0x5e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdda */
+    { .symbols = { 0x5e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xddb */
+    { .symbols = { 0x5f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xddc */
+    { .symbols = { 0x5f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xddd */
+    { .symbols = { 0x5f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdde */
+    { .symbols = { 0x5f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xddf */
+    { .symbols = { 0x60, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde0 */
+    { .symbols = { 0x60, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde1 */
+    { .symbols = { 0x60, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde2 */
+    { .symbols = { 0x60, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde3 */
+    { .symbols = { 0x7a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde4 */
+    { .symbols = { 0x7a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde5 */
+    { .symbols = { 0x7a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde6 */
+    { .symbols = { 0x7a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde7 */
+    { .symbols = { 0x7b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde8 */
+    { .symbols = { 0x7b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde9 */
+    { .symbols = { 0x7b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdea */
+    { .symbols = { 0x7b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdeb */
+    { .symbols = { 0x7c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdec */
+    { .symbols = { 0x7c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xded */
+    { .symbols = { 0x7c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdee */
+    { .symbols = { 0x7c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdef */
+    { .symbols = { 0x7d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf0 */
+    { .symbols = { 0x7d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf1 */
+    { .symbols = { 0x7d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf2 */
+    { .symbols = { 0x7d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf3 */
+    { .symbols = { 0x7e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf4 */
+    { .symbols = { 0x7e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf5 */
+    { .symbols = { 0x7e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf6 */
+    { .symbols = { 0x7e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf7 */
+    { .symbols = { 0x7f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf8 */
+    { .symbols = { 0x7f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf9 */
+    { .symbols = { 0x7f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdfa */
+    { .symbols = { 0x7f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdfb */
+    { .symbols = { 0x80, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdfc */
+    { .symbols = { 0x80, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdfd */
+    { .symbols = { 0x80, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdfe */
+    { .symbols = { 0x80, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdff */
+    { .symbols = { 0x81, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe00 */
+    { .symbols = { 0x81, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe01 */
+    { .symbols = { 0x81, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe02 */
+    { .symbols = { 0x81, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe03 */
+    { .symbols = { 0x82, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe04 */
+    { .symbols = { 0x82, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe05 */
+    { .symbols = { 0x82, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe06 */
+    { .symbols = { 0x82, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe07 */
+    { .symbols = { 0x83, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe08 */
+    { .symbols = { 0x83, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe09 */
+    { .symbols = { 0x83, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe0a */
+    { .symbols = { 0x83, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe0b */
+    { .symbols = { 0x84, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe0c */
+    { .symbols = { 0x84, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe0d */
+    { .symbols = { 0x84, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe0e */
+    { .symbols = { 0x84, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe0f */
+    { .symbols = { 0x85, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe10 */
+    { .symbols = { 0x85, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe11 */
+    { .symbols = { 0x85, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe12 */
+    { .symbols = { 0x85, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe13 */
+    { .symbols = { 0x86, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe14 */
+    { .symbols = { 0x86, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe15 */
+    { .symbols = { 0x86, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe16 */
+    { .symbols = { 0x86, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe17 */
+    { .symbols = { 0x87, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe18 */
+    { .symbols = { 0x87, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe19 */
+    { .symbols = { 0x87, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe1a */
+    { .symbols = { 0x87, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe1b */
+    { .symbols = { 0x88, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe1c */
+    { .symbols = { 0x88, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe1d */
+    { .symbols = { 0x88, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe1e */
+    { .symbols = { 0x88, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe1f */
+    { .symbols = { 0x89, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe20 */
+    { .symbols = { 0x89, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe21 */
+    { .symbols = { 0x89, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe22 */
+    { .symbols = { 0x89, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe23 */
+    { .symbols = { 0x8a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe24 */
+    { .symbols = { 0x8a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe25 */
+    { .symbols = { 0x8a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe26 */
+    { .symbols = { 0x8a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe27 */
+    { .symbols = { 0x8b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe28 */
+    { .symbols = { 0x8b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe29 */
+    { .symbols = { 0x8b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe2a */
+    { .symbols = { 0x8b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe2b */
+    { .symbols = { 0x8c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe2c */
+    { .symbols = { 0x8c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe2d */
+    { .symbols = { 0x8c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe2e */
+    { .symbols = { 0x8c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe2f */
+    { .symbols = { 0x8d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe30 */
+    { .symbols = { 0x8d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe31 */
+    { .symbols = { 0x8d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe32 */
+    { .symbols = { 0x8d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe33 */
+    { .symbols = { 0x8e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe34 */
+    { .symbols = { 0x8e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe35 */
+    { .symbols = { 0x8e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe36 */
+    { .symbols = { 0x8e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe37 */
+    { .symbols = { 0x8f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe38 */
+    { .symbols = { 0x8f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe39 */
+    { .symbols = { 0x8f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe3a */
+    { .symbols = { 0x8f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe3b */
+    { .symbols = { 0x90, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe3c */
+    { .symbols = { 0x90, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe3d */
+    { .symbols = { 0x90, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe3e */
+    { .symbols = { 0x90, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe3f */
+    { .symbols = { 0x91, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe40 */
+    { .symbols = { 0x91, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe41 */
+    { .symbols = { 0x91, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe42 */
+    { .symbols = { 0x91, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe43 */
+    { .symbols = { 0x92, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe44 */
+    { .symbols = { 0x92, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe45 */
+    { .symbols = { 0x92, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe46 */
+    { .symbols = { 0x92, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe47 */
+    { .symbols = { 0x93, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe48 */
+    { .symbols = { 0x93, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe49 */
+    { .symbols = { 0x93, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe4a */
+    { .symbols = { 0x93, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe4b */
+    { .symbols = { 0x94, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe4c */
+    { .symbols = { 0x94, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe4d */
+    { .symbols = { 0x94, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe4e */
+    { .symbols = { 0x94, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe4f */
+    { .symbols = { 0x95, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe50 */
+    { .symbols = { 0x95, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe51 */
+    { .symbols = { 0x95, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe52 */
+    { .symbols = { 0x95, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe53 */
+    { .symbols = { 0x96, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe54 */
+    { .symbols = { 0x96, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe55 */
+    { .symbols = { 0x96, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe56 */
+    { .symbols = { 0x96, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe57 */
+    { .symbols = { 0x97, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe58 */
+    { .symbols = { 0x97, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe59 */
+    { .symbols = { 0x97, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe5a */
+    { .symbols = { 0x97, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe5b */
+    { .symbols = { 0x98, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe5c */
+    { .symbols = { 0x98, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe5d */
+    { .symbols = { 0x98, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe5e */
+    { .symbols = { 0x98, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe5f */
+    { .symbols = { 0x99, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe60 */
+    { .symbols = { 0x99, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe61 */
+    { .symbols = { 0x99, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe62 */
+    { .symbols = { 0x99, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe63 */
+    { .symbols = { 0x9a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe64 */
+    { .symbols = { 0x9a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe65 */
+    { .symbols = { 0x9a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe66 */
+    { .symbols = { 0x9a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe67 */
+    { .symbols = { 0x9b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe68 */
+    { .symbols = { 0x9b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe69 */
+    { .symbols = { 0x9b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe6a */
+    { .symbols = { 0x9b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe6b */
+    { .symbols = { 0x9c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe6c */
+    { .symbols = { 0x9c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe6d */
+    { .symbols = { 0x9c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe6e */
+    { .symbols = { 0x9c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe6f */
+    { .symbols = { 0x9d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe70 */
+    { .symbols = { 0x9d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe71 */
+    { .symbols = { 0x9d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe72 */
+    { .symbols = { 0x9d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe73 */
+    { .symbols = { 0x9e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe74 */
+    { .symbols = { 0x9e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe75 */
+    { .symbols = { 0x9e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe76 */
+    { .symbols = { 0x9e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe77 */
+    { .symbols = { 0x9f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe78 */
+    { .symbols = { 0x9f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe79 */
+    { .symbols = { 0x9f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe7a */
+    { .symbols = { 0x9f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe7b */
+    { .symbols = { 0xa0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe7c */
+    { .symbols = { 0xa0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe7d */
+    { .symbols = { 0xa0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe7e */
+    { .symbols = { 0xa0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe7f */
+    { .symbols = { 0xa1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe80 */
+    { .symbols = { 0xa1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe81 */
+    { .symbols = { 0xa1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe82 */
+    { .symbols = { 0xa1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe83 */
+    { .symbols = { 0xa2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe84 */
+    { .symbols = { 0xa2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe85 */
+    { .symbols = { 0xa2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe86 */
+    { .symbols = { 0xa2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe87 */
+    { .symbols = { 0xa3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe88 */
+    { .symbols = { 0xa3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe89 */
+    { .symbols = { 0xa3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe8a */
+    { .symbols = { 0xa3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe8b */
+    { .symbols = { 0xa4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe8c */
+    { .symbols = { 0xa4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe8d */
+    { .symbols = { 0xa4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe8e */
+    { .symbols = { 0xa4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe8f */
+    { .symbols = { 0xa5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe90 */
+    { .symbols = { 0xa5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe91 */
+    { .symbols = { 0xa5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe92 */
+    { .symbols = { 0xa5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe93 */
+    { .symbols = { 0xa6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe94 */
+    { .symbols = { 0xa6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe95 */
+    { .symbols = { 0xa6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe96 */
+    { .symbols = { 0xa6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe97 */
+    { .symbols = { 0xa7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe98 */
+    { .symbols = { 0xa7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe99 */
+    { .symbols = { 0xa7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe9a */
+    { .symbols = { 0xa7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe9b */
+    { .symbols = { 0xa8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe9c */
+    { .symbols = { 0xa8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe9d */
+    { .symbols = { 0xa8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe9e */
+    { .symbols = { 0xa8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe9f */
+    { .symbols = { 0xa9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea0 */
+    { .symbols = { 0xa9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea1 */
+    { .symbols = { 0xa9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea2 */
+    { .symbols = { 0xa9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea3 */
+    { .symbols = { 0xaa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea4 */
+    { .symbols = { 0xaa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea5 */
+    { .symbols = { 0xaa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea6 */
+    { .symbols = { 0xaa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea7 */
+    { .symbols = { 0xab, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea8 */
+    { .symbols = { 0xab, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea9 */
+    { .symbols = { 0xab, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeaa */
+    { .symbols = { 0xab, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeab */
+    { .symbols = { 0xac, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeac */
+    { .symbols = { 0xac, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xead */
+    { .symbols = { 0xac, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeae */
+    { .symbols = { 0xac, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeaf */
+    { .symbols = { 0xad, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb0 */
+    { .symbols = { 0xad, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb1 */
+    { .symbols = { 0xad, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb2 */
+    { .symbols = { 0xad, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb3 */
+    { .symbols = { 0xae, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb4 */
+    { .symbols = { 0xae, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb5 */
+    { .symbols = { 0xae, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb6 */
+    { .symbols = { 0xae, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb7 */
+    { .symbols = { 0xaf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb8 */
+    { .symbols = { 0xaf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb9 */
+    { .symbols = { 0xaf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeba */
+    { .symbols = { 0xaf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xebb */
+    { .symbols = { 0xb0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xebc */
+    { .symbols = { 0xb0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xebd */
+    { .symbols = { 0xb0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xebe */
+    { .symbols = { 0xb0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xebf */
+    { .symbols = { 0xb1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec0 */
+    { .symbols = { 0xb1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec1 */
+    { .symbols = { 0xb1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec2 */
+    { .symbols = { 0xb1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec3 */
+    { .symbols = { 0xb2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec4 */
+    { .symbols = { 0xb2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec5 */
+    { .symbols = { 0xb2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec6 */
+    { .symbols = { 0xb2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec7 */
+    { .symbols = { 0xb3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec8 */
+    { .symbols = { 0xb3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec9 */
+    { .symbols = { 0xb3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeca */
+    { .symbols = { 0xb3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xecb */
+    { .symbols = { 0xb4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xecc */
+    { .symbols = { 0xb4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xecd */
+    { .symbols = { 0xb4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xece */
+    { .symbols = { 0xb4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xecf */
+    { .symbols = { 0xb5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed0 */
+    { .symbols = { 0xb5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed1 */
+    { .symbols = { 0xb5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed2 */
+    { .symbols = { 0xb5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed3 */
+    { .symbols = { 0xb6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed4 */
+    { .symbols = { 0xb6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed5 */
+    { .symbols = { 0xb6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed6 */
+    { .symbols = { 0xb6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed7 */
+    { .symbols = { 0xb7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed8 */
+    { .symbols = { 0xb7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed9 */
+    { .symbols = { 0xb7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeda */
+    { .symbols = { 0xb7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xedb */
+    { .symbols = { 0xb8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xedc */
+    { .symbols = { 0xb8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xedd */
+    { .symbols = { 0xb8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xede */
+    { .symbols = { 0xb8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xedf */
+    { .symbols = { 0xb9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee0 */
+    { .symbols = { 0xb9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee1 */
+    { .symbols = { 0xb9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee2 */
+    { .symbols = { 0xb9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee3 */
+    { .symbols = { 0xba, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee4 */
+    { .symbols = { 0xba, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee5 */
+    { .symbols = { 0xba, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee6 */
+    { .symbols = { 0xba, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee7 */
+    { .symbols = { 0xbb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee8 */
+    { .symbols = { 0xbb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee9 */
+    { .symbols = { 0xbb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeea */
+    { .symbols = { 0xbb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeeb */
+    { .symbols = { 0xbc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeec */
+    { .symbols = { 0xbc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeed */
+    { .symbols = { 0xbc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeee */
+    { .symbols = { 0xbc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeef */
+    { .symbols = { 0xbd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef0 */
+    { .symbols = { 0xbd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef1 */
+    { .symbols = { 0xbd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef2 */
+    { .symbols = { 0xbd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef3 */
+    { .symbols = { 0xbe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef4 */
+    { .symbols = { 0xbe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef5 */
+    { .symbols = { 0xbe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef6 */
+    { .symbols = { 0xbe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef7 */
+    { .symbols = { 0xbf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef8 */
+    { .symbols = { 0xbf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef9 */
+    { .symbols = { 0xbf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xefa */
+    { .symbols = { 0xbf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xefb */
+    { .symbols = { 0xc0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xefc */
+    { .symbols = { 0xc0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xefd */
+    { .symbols = { 0xc0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xefe */
+    { .symbols = { 0xc0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeff */
+    { .symbols = { 0xc1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf00 */
+    { .symbols = { 0xc1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf01 */
+    { .symbols = { 0xc1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf02 */
+    { .symbols = { 0xc1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf03 */
+    { .symbols = { 0xc2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf04 */
+    { .symbols = { 0xc2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf05 */
+    { .symbols = { 0xc2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf06 */
+    { .symbols = { 0xc2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf07 */
+    { .symbols = { 0xc3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf08 */
+    { .symbols = { 0xc3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf09 */
+    { .symbols = { 0xc3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf0a */
+    { .symbols = { 0xc3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf0b */
+    { .symbols = { 0xc4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf0c */
+    { .symbols = { 0xc4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf0d */
+    { .symbols = { 0xc4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf0e */
+    { .symbols = { 0xc4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf0f */
+    { .symbols = { 0xc5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf10 */
+    { .symbols = { 0xc5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf11 */
+    { .symbols = { 0xc5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf12 */
+    { .symbols = { 0xc5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf13 */
+    { .symbols = { 0xc6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf14 */
+    { .symbols = { 0xc6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf15 */
+    { .symbols = { 0xc6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf16 */
+    { .symbols = { 0xc6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf17 */
+    { .symbols = { 0xc7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf18 */
+    { .symbols = { 0xc7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf19 */
+    { .symbols = { 0xc7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf1a */
+    { .symbols = { 0xc7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf1b */
+    { .symbols = { 0xc8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf1c */
+    { .symbols = { 0xc8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf1d */
+    { .symbols = { 0xc8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf1e */
+    { .symbols = { 0xc8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf1f */
+    { .symbols = { 0xc9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf20 */
+    { .symbols = { 0xc9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf21 */
+    { .symbols = { 0xc9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf22 */
+    { .symbols = { 0xc9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf23 */
+    { .symbols = { 0xca, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf24 */
+    { .symbols = { 0xca, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf25 */
+    { .symbols = { 0xca, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf26 */
+    { .symbols = { 0xca, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf27 */
+    { .symbols = { 0xcb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf28 */
+    { .symbols = { 0xcb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf29 */
+    { .symbols = { 0xcb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf2a */
+    { .symbols = { 0xcb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf2b */
+    { .symbols = { 0xcc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf2c */
+    { .symbols = { 0xcc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf2d */
+    { .symbols = { 0xcc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf2e */
+    { .symbols = { 0xcc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf2f */
+    { .symbols = { 0xcd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf30 */
+    { .symbols = { 0xcd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf31 */
+    { .symbols = { 0xcd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf32 */
+    { .symbols = { 0xcd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf33 */
+    { .symbols = { 0xce, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf34 */
+    { .symbols = { 0xce, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf35 */
+    { .symbols = { 0xce, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf36 */
+    { .symbols = { 0xce, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf37 */
+    { .symbols = { 0xcf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf38 */
+    { .symbols = { 0xcf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf39 */
+    { .symbols = { 0xcf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf3a */
+    { .symbols = { 0xcf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf3b */
+    { .symbols = { 0xd0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf3c */
+    { .symbols = { 0xd0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf3d */
+    { .symbols = { 0xd0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf3e */
+    { .symbols = { 0xd0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf3f */
+    { .symbols = { 0xd1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf40 */
+    { .symbols = { 0xd1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf41 */
+    { .symbols = { 0xd1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf42 */
+    { .symbols = { 0xd1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf43 */
+    { .symbols = { 0xd2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf44 */
+    { .symbols = { 0xd2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf45 */
+    { .symbols = { 0xd2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf46 */
+    { .symbols = { 0xd2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf47 */
+    { .symbols = { 0xd3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf48 */
+    { .symbols = { 0xd3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf49 */
+    { .symbols = { 0xd3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf4a */
+    { .symbols = { 0xd3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf4b */
+    { .symbols = { 0xd4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf4c */
+    { .symbols = { 0xd4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf4d */
+    { .symbols = { 0xd4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf4e */
+    { .symbols = { 0xd4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf4f */
+    { .symbols = { 0xd5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf50 */
+    { .symbols = { 0xd5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf51 */
+    { .symbols = { 0xd5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf52 */
+    { .symbols = { 0xd5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf53 */
+    { .symbols = { 0xd6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf54 */
+    { .symbols = { 0xd6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf55 */
+    { .symbols = { 0xd6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf56 */
+    { .symbols = { 0xd6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf57 */
+    { .symbols = { 0xd7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf58 */
+    { .symbols = { 0xd7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf59 */
+    { .symbols = { 0xd7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf5a */
+    { .symbols = { 0xd7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf5b */
+    { .symbols = { 0xd8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf5c */
+    { .symbols = { 0xd8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf5d */
+    { .symbols = { 0xd8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf5e */
+    { .symbols = { 0xd8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf5f */
+    { .symbols = { 0xd9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf60 */
+    { .symbols = { 0xd9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf61 */
+    { .symbols = { 0xd9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf62 */
+    { .symbols = { 0xd9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf63 */
+    { .symbols = { 0xda, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf64 */
+    { .symbols = { 0xda, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf65 */
+    { .symbols = { 0xda, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf66 */
+    { .symbols = { 0xda, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf67 */
+    { .symbols = { 0xdb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf68 */
+    { .symbols = { 0xdb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf69 */
+    { .symbols = { 0xdb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf6a */
+    { .symbols = { 0xdb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf6b */
+    { .symbols = { 0xdc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf6c */
+    { .symbols = { 0xdc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf6d */
+    { .symbols = { 0xdc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf6e */
+    { .symbols = { 0xdc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf6f */
+    { .symbols = { 0xdd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf70 */
+    { .symbols = { 0xdd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf71 */
+    { .symbols = { 0xdd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf72 */
+    { .symbols = { 0xdd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf73 */
+    { .symbols = { 0xde, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf74 */
+    { .symbols = { 0xde, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf75 */
+    { .symbols = { 0xde, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf76 */
+    { .symbols = { 0xde, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf77 */
+    { .symbols = { 0xdf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf78 */
+    { .symbols = { 0xdf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf79 */
+    { .symbols = { 0xdf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf7a */
+    { .symbols = { 0xdf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf7b */
+    { .symbols = { 0xe0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf7c */
+    { .symbols = { 0xe0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf7d */
+    { .symbols = { 0xe0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf7e */
+    { .symbols = { 0xe0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf7f */
+    { .symbols = { 0xe1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf80 */
+    { .symbols = { 0xe1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf81 */
+    { .symbols = { 0xe1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf82 */
+    { .symbols = { 0xe1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf83 */
+    { .symbols = { 0xe2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf84 */
+    { .symbols = { 0xe2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf85 */
+    { .symbols = { 0xe2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf86 */
+    { .symbols = { 0xe2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf87 */
+    { .symbols = { 0xe3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf88 */
+    { .symbols = { 0xe3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf89 */
+    { .symbols = { 0xe3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf8a */
+    { .symbols = { 0xe3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf8b */
+    { .symbols = { 0xe4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf8c */
+    { .symbols = { 0xe4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf8d */
+    { .symbols = { 0xe4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf8e */
+    { .symbols = { 0xe4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf8f */
+    { .symbols = { 0xe5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf90 */
+    { .symbols = { 0xe5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf91 */
+    { .symbols = { 0xe5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf92 */
+    { .symbols = { 0xe5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf93 */
+    { .symbols = { 0xe6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf94 */
+    { .symbols = { 0xe6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf95 */
+    { .symbols = { 0xe6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf96 */
+    { .symbols = { 0xe6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf97 */
+    { .symbols = { 0xe7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf98 */
+    { .symbols = { 0xe7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf99 */
+    { .symbols = { 0xe7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf9a */
+    { .symbols = { 0xe7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf9b */
+    { .symbols = { 0xe8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf9c */
+    { .symbols = { 0xe8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf9d */
+    { .symbols = { 0xe8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf9e */
+    { .symbols = { 0xe8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf9f */
+    { .symbols = { 0xe9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa0 */
+    { .symbols = { 0xe9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa1 */
+    { .symbols = { 0xe9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa2 */
+    { .symbols = { 0xe9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa3 */
+    { .symbols = { 0xea, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa4 */
+    { .symbols = { 0xea, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa5 */
+    { .symbols = { 0xea, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa6 */
+    { .symbols = { 0xea, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa7 */
+    { .symbols = { 0xeb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa8 */
+    { .symbols = { 0xeb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa9 */
+    { .symbols = { 0xeb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfaa */
+    { .symbols = { 0xeb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfab */
+    { .symbols = { 0xec, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfac */
+    { .symbols = { 0xec, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfad */
+    { .symbols = { 0xec, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfae */
+    { .symbols = { 0xec, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfaf */
+    { .symbols = { 0xed, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb0 */
+    { .symbols = { 0xed, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb1 */
+    { .symbols = { 0xed, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb2 */
+    { .symbols = { 0xed, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb3 */
+    { .symbols = { 0xee, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb4 */
+    { .symbols = { 0xee, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb5 */
+    { .symbols = { 0xee, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb6 */
+    { .symbols = { 0xee, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb7 */
+    { .symbols = { 0xef, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb8 */
+    { .symbols = { 0xef, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb9 */
+    { .symbols = { 0xef, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfba */
+    { .symbols = { 0xef, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfbb */
+    { .symbols = { 0xf0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfbc */
+    { .symbols = { 0xf0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfbd */
+    { .symbols = { 0xf0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfbe */
+    { .symbols = { 0xf0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfbf */
+    { .symbols = { 0xf1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc0 */
+    { .symbols = { 0xf1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc1 */
+    { .symbols = { 0xf1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc2 */
+    { .symbols = { 0xf1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc3 */
+    { .symbols = { 0xf2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc4 */
+    { .symbols = { 0xf2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc5 */
+    { .symbols = { 0xf2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc6 */
+    { .symbols = { 0xf2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc7 */
+    { .symbols = { 0xf3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc8 */
+    { .symbols = { 0xf3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc9 */
+    { .symbols = { 0xf3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfca */
+    { .symbols = { 0xf3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfcb */
+    { .symbols = { 0xf4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfcc */
+    { .symbols = { 0xf4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfcd */
+    { .symbols = { 0xf4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfce */
+    { .symbols = { 0xf4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfcf */
+    { .symbols = { 0xf5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd0 */
+    { .symbols = { 0xf5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd1 */
+    { .symbols = { 0xf5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd2 */
+    { .symbols = { 0xf5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd3 */
+    { .symbols = { 0xf6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd4 */
+    { .symbols = { 0xf6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd5 */
+    { .symbols = { 0xf6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd6 */
+    { .symbols = { 0xf6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd7 */
+    { .symbols = { 0xf7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd8 */
+    { .symbols = { 0xf7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd9 */
+    { .symbols = { 0xf7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfda */
+    { .symbols = { 0xf7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfdb */
+    { .symbols = { 0xf8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfdc */
+    { .symbols = { 0xf8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfdd */
+    { .symbols = { 0xf8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfde */
+    { .symbols = { 0xf8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfdf */
+    { .symbols = { 0xf9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe0 */
+    { .symbols = { 0xf9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe1 */
+    { .symbols = { 0xf9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe2 */
+    { .symbols = { 0xf9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe3 */
+    { .symbols = { 0xfa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe4 */
+    { .symbols = { 0xfa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe5 */
+    { .symbols = { 0xfa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe6 */
+    { .symbols = { 0xfa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe7 */
+    { .symbols = { 0xfb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe8 */
+    { .symbols = { 0xfb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe9 */
+    { .symbols = { 0xfb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfea */
+    { .symbols = { 0xfb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfeb */
+    { .symbols = { 0xfc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfec */
+    { .symbols = { 0xfc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfed */
+    { .symbols = { 0xfc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfee */
+    { .symbols = { 0xfc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfef */
+    { .symbols = { 0xfd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff0 */
+    { .symbols = { 0xfd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff1 */
+    { .symbols = { 0xfd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff2 */
+    { .symbols = { 0xfd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff3 */
+    { .symbols = { 0xfe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff4 */
+    { .symbols = { 0xfe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff5 */
+    { .symbols = { 0xfe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff6 */
+    { .symbols = { 0xfe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff7 */
+    { .symbols = { 0xff, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff8 */
+    { .symbols = { 0xff, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff9 */
+    { .symbols = { 0xff, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xffa */
+    { .symbols = { 0xff, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xffb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xffc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xffd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xffe */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xfff */
+};
+
+static const struct aws_huffman_multi_symbol_table multi_symbol_table = {
+    .entries = multi_symbol_entries,
+    .index_bits = 12,
+};
+
+/* Indexed by (state * 16 + nibble), each entry is { next_state, flags, symbol } */
+static const struct aws_huffman_fsm_transition fsm_transitions[] = {
+    /* state 0:  */
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 4, 0x0, 0x0 }, { 5, 0x0, 0x0 },
+    { 8, 0x0, 0x0 }, { 9, 0x0, 0x0 }, { 11, 0x0, 0x0 }, { 0, 0x4, 0x0 },
+    { 15, 0x0, 0x0 }, { 18, 0x0, 0x0 }, { 22, 0x0, 0x0 }, { 26, 0x0, 0x0 },
+    { 39, 0x0, 0x0 }, { 74, 0x0, 0x0 }, { 138, 0x0, 0x0 }, { 201, 0x1, 0x0 },
+    /* state 1: 0 */
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x3, 0x20 }, { 0, 0x3, 0x61 }, { 0, 0x3, 0x65 }, { 0, 0x3, 0x69 },
+    { 0, 0x3, 0x6e }, { 0, 0x3, 0x6f }, { 0, 0x3, 0x72 }, { 0, 0x3, 0x73 },
+    { 0, 0x3, 0x74 }, { 0, 0x3, 0x75 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 2: 00 */
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 1, 0x2, 0x20 }, { 12, 0x3, 0x20 }, { 1, 0x2, 0x61 }, { 12, 0x3, 0x61 },
+    { 1, 0x2, 0x65 }, { 12, 0x3, 0x65 }, { 1, 0x2, 0x69 }, { 12, 0x3, 0x69 },
+    /* state 3: 001 */
+    { 2, 0x2, 0x20 }, { 6, 0x2, 0x20 }, { 13, 0x2, 0x20 }, { 37, 0x3, 0x20 },
+    { 2, 0x2, 0x61 }, { 6, 0x2, 0x61 }, { 13, 0x2, 0x61 }, { 37, 0x3, 0x61 },
+    { 2, 0x2, 0x65 }, { 6, 0x2, 0x65 }, { 13, 0x2, 0x65 }, { 37, 0x3, 0x65 },
+    { 2, 0x2, 0x69 }, { 6, 0x2, 0x69 }, { 13, 0x2, 0x69 }, { 37, 0x3, 0x69 },
+    /* state 4: 0010 */
+    { 0, 0x4, 0x20 }, { 3, 0x2, 0x20 }, { 7, 0x2, 0x20 }, { 10, 0x2, 0x20 },
+    { 14, 0x2, 0x20 }, { 21, 0x2, 0x20 }, { 38, 0x2, 0x20 }, { 137, 0x3, 0x20 },
+    { 0, 0x4, 0x61 }, { 3, 0x2, 0x61 }, { 7, 0x2, 0x61 }, { 10, 0x2, 0x61 },
+    { 14, 0x2, 0x61 }, { 21, 0x2, 0x61 }, { 38, 0x2, 0x61 }, { 137, 0x3, 0x61 },
+    /* state 5: 0011 */
+    { 0, 0x4, 0x65 }, { 3, 0x2, 0x65 }, { 7, 0x2, 0x65 }, { 10, 0x2, 0x65 },
+    { 14, 0x2, 0x65 }, { 21, 0x2, 0x65 }, { 38, 0x2, 0x65 }, { 137, 0x3, 0x65 },
+    { 0, 0x4, 0x69 }, { 3, 0x2, 0x69 }, { 7, 0x2, 0x69 }, { 10, 0x2, 0x69 },
+    { 14, 0x2, 0x69 }, { 21, 0x2, 0x69 }, { 38, 0x2, 0x69 }, { 137, 0x3, 0x69 },
+    /* state 6: 01 */
+    { 1, 0x2, 0x6e }, { 12, 0x3, 0x6e }, { 1, 0x2, 0x6f }, { 12, 0x3, 0x6f },
+    { 1, 0x2, 0x72 }, { 12, 0x3, 0x72 }, { 1, 0x2, 0x73 }, { 12, 0x3, 0x73 },
+    { 1, 0x2, 0x74 }, { 12, 0x3, 0x74 }, { 1, 0x2, 0x75 }, { 12, 0x3, 0x75 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 7: 010 */
+    { 2, 0x2, 0x6e }, { 6, 0x2, 0x6e }, { 13, 0x2, 0x6e }, { 37, 0x3, 0x6e },
+    { 2, 0x2, 0x6f }, { 6, 0x2, 0x6f }, { 13, 0x2, 0x6f }, { 37, 0x3, 0x6f },
+    { 2, 0x2, 0x72 }, { 6, 0x2, 0x72 }, { 13, 0x2, 0x72 }, { 37, 0x3, 0x72 },
+    { 2, 0x2, 0x73 }, { 6, 0x2, 0x73 }, { 13, 0x2, 0x73 }, { 37, 0x3, 0x73 },
+    /* state 8: 0100 */
+    { 0, 0x4, 0x6e }, { 3, 0x2, 0x6e }, { 7, 0x2, 0x6e }, { 10, 0x2, 0x6e },
+    { 14, 0x2, 0x6e }, { 21, 0x2, 0x6e }, { 38, 0x2, 0x6e }, { 137, 0x3, 0x6e },
+    { 0, 0x4, 0x6f }, { 3, 0x2, 0x6f }, { 7, 0x2, 0x6f }, { 10, 0x2, 0x6f },
+    { 14, 0x2, 0x6f }, { 21, 0x2, 0x6f }, { 38, 0x2, 0x6f }, { 137, 0x3, 0x6f },
+    /* state 9: 0101 */
+    { 0, 0x4, 0x72 }, { 3, 0x2, 0x72 }, { 7, 0x2, 0x72 }, { 10, 0x2, 0x72 },
+    { 14, 0x2, 0x72 }, { 21, 0x2, 0x72 }, { 38, 0x2, 0x72 }, { 137, 0x3, 0x72 },
+    { 0, 0x4, 0x73 }, { 3, 0x2, 0x73 }, { 7, 0x2, 0x73 }, { 10, 0x2, 0x73 },
+    { 14, 0x2, 0x73 }, { 21, 0x2, 0x73 }, { 38, 0x2, 0x73 }, { 137, 0x3, 0x73 },
+    /* state 10: 011 */
+    { 2, 0x2, 0x74 }, { 6, 0x2, 0x74 }, { 13, 0x2, 0x74 }, { 37, 0x3, 0x74 },
+    { 2, 0x2, 0x75 }, { 6, 0x2, 0x75 }, { 13, 0x2, 0x75 }, { 37, 0x3, 0x75 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 11: 0110 */
+    { 0, 0x4, 0x74 }, { 3, 0x2, 0x74 }, { 7, 0x2, 0x74 }, { 10, 0x2, 0x74 },
+    { 14, 0x2, 0x74 }, { 21, 0x2, 0x74 }, { 38, 0x2, 0x74 }, { 137, 0x3, 0x74 },
+    { 0, 0x4, 0x75 }, { 3, 0x2, 0x75 }, { 7, 0x2, 0x75 }, { 10, 0x2, 0x75 },
+    { 14, 0x2, 0x75 }, { 21, 0x2, 0x75 }, { 38, 0x2, 0x75 }, { 137, 0x3, 0x75 },
+    /* state 12: 1 */
+    { 16, 0x0, 0x0 }, { 17, 0x0, 0x0 }, { 19, 0x0, 0x0 }, { 20, 0x0, 0x0 },
+    { 23, 0x0, 0x0 }, { 24, 0x0, 0x0 }, { 27, 0x0, 0x0 }, { 30, 0x0, 0x0 },
+    { 40, 0x0, 0x0 }, { 50, 0x0, 0x0 }, { 75, 0x0, 0x0 }, { 106, 0x0, 0x0 },
+    { 139, 0x0, 0x0 }, { 170, 0x0, 0x0 }, { 202, 0x0, 0x0 }, { 233, 0x1, 0x0 },
+    /* state 13: 10 */
+    { 0, 0x3, 0x63 }, { 0, 0x3, 0x64 }, { 0, 0x3, 0x66 }, { 0, 0x3, 0x68 },
+    { 0, 0x3, 0x6b }, { 0, 0x3, 0x6c }, { 0, 0x3, 0x6d }, { 0, 0x3, 0x77 },
+    { 0, 0x3, 0x79 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 25, 0x0, 0x0 },
+    { 28, 0x0, 0x0 }, { 29, 0x0, 0x0 }, { 31, 0x0, 0x0 }, { 34, 0x0, 0x0 },
+    /* state 14: 100 */
+    { 1, 0x2, 0x63 }, { 12, 0x3, 0x63 }, { 1, 0x2, 0x64 }, { 12, 0x3, 0x64 },
+    { 1, 0x2, 0x66 }, { 12, 0x3, 0x66 }, { 1, 0x2, 0x68 }, { 12, 0x3, 0x68 },
+    { 1, 0x2, 0x6b }, { 12, 0x3, 0x6b }, { 1, 0x2, 0x6c }, { 12, 0x3, 0x6c },
+    { 1, 0x2, 0x6d }, { 12, 0x3, 0x6d }, { 1, 0x2, 0x77 }, { 12, 0x3, 0x77 },
+    /* state 15: 1000 */
+    { 2, 0x2, 0x63 }, { 6, 0x2, 0x63 }, { 13, 0x2, 0x63 }, { 37, 0x3, 0x63 },
+    { 2, 0x2, 0x64 }, { 6, 0x2, 0x64 }, { 13, 0x2, 0x64 }, { 37, 0x3, 0x64 },
+    { 2, 0x2, 0x66 }, { 6, 0x2, 0x66 }, { 13, 0x2, 0x66 }, { 37, 0x3, 0x66 },
+    { 2, 0x2, 0x68 }, { 6, 0x2, 0x68 }, { 13, 0x2, 0x68 }, { 37, 0x3, 0x68 },
+    /* state 16: 10000 */
+    { 0, 0x4, 0x63 }, { 3, 0x2, 0x63 }, { 7, 0x2, 0x63 }, { 10, 0x2, 0x63 },
+    { 14, 0x2, 0x63 }, { 21, 0x2, 0x63 }, { 38, 0x2, 0x63 }, { 137, 0x3, 0x63 },
+    { 0, 0x4, 0x64 }, { 3, 0x2, 0x64 }, { 7, 0x2, 0x64 }, { 10, 0x2, 0x64 },
+    { 14, 0x2, 0x64 }, { 21, 0x2, 0x64 }, { 38, 0x2, 0x64 }, { 137, 0x3, 0x64 },
+    /* state 17: 10001 */
+    { 0, 0x4, 0x66 }, { 3, 0x2, 0x66 }, { 7, 0x2, 0x66 }, { 10, 0x2, 0x66 },
+    { 14, 0x2, 0x66 }, { 21, 0x2, 0x66 }, { 38, 0x2, 0x66 }, { 137, 0x3, 0x66 },
+    { 0, 0x4, 0x68 }, { 3, 0x2, 0x68 }, { 7, 0x2, 0x68 }, { 10, 0x2, 0x68 },
+    { 14, 0x2, 0x68 }, { 21, 0x2, 0x68 }, { 38, 0x2, 0x68 }, { 137, 0x3, 0x68 },
+    /* state 18: 1001 */
+    { 2, 0x2, 0x6b }, { 6, 0x2, 0x6b }, { 13, 0x2, 0x6b }, { 37, 0x3, 0x6b },
+    { 2, 0x2, 0x6c }, { 6, 0x2, 0x6c }, { 13, 0x2, 0x6c }, { 37, 0x3, 0x6c },
+    { 2, 0x2, 0x6d }, { 6, 0x2, 0x6d }, { 13, 0x2, 0x6d }, { 37, 0x3, 0x6d },
+    { 2, 0x2, 0x77 }, { 6, 0x2, 0x77 }, { 13, 0x2, 0x77 }, { 37, 0x3, 0x77 },
+    /* state 19: 10010 */
+    { 0, 0x4, 0x6b }, { 3, 0x2, 0x6b }, { 7, 0x2, 0x6b }, { 10, 0x2, 0x6b },
+    { 14, 0x2, 0x6b }, { 21, 0x2, 0x6b }, { 38, 0x2, 0x6b }, { 137, 0x3, 0x6b },
+    { 0, 0x4, 0x6c }, { 3, 0x2, 0x6c }, { 7, 0x2, 0x6c }, { 10, 0x2, 0x6c },
+    { 14, 0x2, 0x6c }, { 21, 0x2, 0x6c }, { 38, 0x2, 0x6c }, { 137, 0x3, 0x6c },
+    /* state 20: 10011 */
+    { 0, 0x4, 0x6d }, { 3, 0x2, 0x6d }, { 7, 0x2, 0x6d }, { 10, 0x2, 0x6d },
+    { 14, 0x2, 0x6d }, { 21, 0x2, 0x6d }, { 38, 0x2, 0x6d }, { 137, 0x3, 0x6d },
+    { 0, 0x4, 0x77 }, { 3, 0x2, 0x77 }, { 7, 0x2, 0x77 }, { 10, 0x2, 0x77 },
+    { 14, 0x2, 0x77 }, { 21, 0x2, 0x77 }, { 38, 0x2, 0x77 }, { 137, 0x3, 0x77 },
+    /* state 21: 101 */
+    { 1, 0x2, 0x79 }, { 12, 0x3, 0x79 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x3, 0x27 }, { 0, 0x3, 0x2e },
+    { 0, 0x3, 0x62 }, { 0, 0x3, 0x67 }, { 0, 0x3, 0x70 }, { 0, 0x4, 0x0 },
+    { 32, 0x0, 0x0 }, { 33, 0x0, 0x0 }, { 35, 0x0, 0x0 }, { 36, 0x0, 0x0 },
+    /* state 22: 1010 */
+    { 2, 0x2, 0x79 }, { 6, 0x2, 0x79 }, { 13, 0x2, 0x79 }, { 37, 0x3, 0x79 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 1, 0x2, 0x27 }, { 12, 0x3, 0x27 }, { 1, 0x2, 0x2e }, { 12, 0x3, 0x2e },
+    /* state 23: 10100 */
+    { 0, 0x4, 0x79 }, { 3, 0x2, 0x79 }, { 7, 0x2, 0x79 }, { 10, 0x2, 0x79 },
+    { 14, 0x2, 0x79 }, { 21, 0x2, 0x79 }, { 38, 0x2, 0x79 }, { 137, 0x3, 0x79 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 24: 10101 */
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 2, 0x2, 0x27 }, { 6, 0x2, 0x27 }, { 13, 0x2, 0x27 }, { 37, 0x3, 0x27 },
+    { 2, 0x2, 0x2e }, { 6, 0x2, 0x2e }, { 13, 0x2, 0x2e }, { 37, 0x3, 0x2e },
+    /* state 25: 101011 */
+    { 0, 0x4, 0x27 }, { 3, 0x2, 0x27 }, { 7, 0x2, 0x27 }, { 10, 0x2, 0x27 },
+    { 14, 0x2, 0x27 }, { 21, 0x2, 0x27 }, { 38, 0x2, 0x27 }, { 137, 0x3, 0x27 },
+    { 0, 0x4, 0x2e }, { 3, 0x2, 0x2e }, { 7, 0x2, 0x2e }, { 10, 0x2, 0x2e },
+    { 14, 0x2, 0x2e }, { 21, 0x2, 0x2e }, { 38, 0x2, 0x2e }, { 137, 0x3, 0x2e },
+    /* state 26: 1011 */
+    { 1, 0x2, 0x62 }, { 12, 0x3, 0x62 }, { 1, 0x2, 0x67 }, { 12, 0x3, 0x67 },
+    { 1, 0x2, 0x70 }, { 12, 0x3, 0x70 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x3, 0xa }, { 0, 0x3, 0x2c }, { 0, 0x3, 0x3f }, { 0, 0x3, 0x42 },
+    { 0, 0x3, 0x49 }, { 0, 0x3, 0x54 }, { 0, 0x3, 0x57 }, { 0, 0x3, 0x6a },
+    /* state 27: 10110 */
+    { 2, 0x2, 0x62 }, { 6, 0x2, 0x62 }, { 13, 0x2, 0x62 }, { 37, 0x3, 0x62 },
+    { 2, 0x2, 0x67 }, { 6, 0x2, 0x67 }, { 13, 0x2, 0x67 }, { 37, 0x3, 0x67 },
+    { 2, 0x2, 0x70 }, { 6, 0x2, 0x70 }, { 13, 0x2, 0x70 }, { 37, 0x3, 0x70 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 28: 101100 */
+    { 0, 0x4, 0x62 }, { 3, 0x2, 0x62 }, { 7, 0x2, 0x62 }, { 10, 0x2, 0x62 },
+    { 14, 0x2, 0x62 }, { 21, 0x2, 0x62 }, { 38, 0x2, 0x62 }, { 137, 0x3, 0x62 },
+    { 0, 0x4, 0x67 }, { 3, 0x2, 0x67 }, { 7, 0x2, 0x67 }, { 10, 0x2, 0x67 },
+    { 14, 0x2, 0x67 }, { 21, 0x2, 0x67 }, { 38, 0x2, 0x67 }, { 137, 0x3, 0x67 },
+    /* state 29: 101101 */
+    { 0, 0x4, 0x70 }, { 3, 0x2, 0x70 }, { 7, 0x2, 0x70 }, { 10, 0x2, 0x70 },
+    { 14, 0x2, 0x70 }, { 21, 0x2, 0x70 }, { 38, 0x2, 0x70 }, { 137, 0x3, 0x70 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 30: 10111 */
+    { 1, 0x2, 0xa }, { 12, 0x3, 0xa }, { 1, 0x2, 0x2c }, { 12, 0x3, 0x2c },
+    { 1, 0x2, 0x3f }, { 12, 0x3, 0x3f }, { 1, 0x2, 0x42 }, { 12, 0x3, 0x42 },
+    { 1, 0x2, 0x49 }, { 12, 0x3, 0x49 }, { 1, 0x2, 0x54 }, { 12, 0x3, 0x54 },
+    { 1, 0x2, 0x57 }, { 12, 0x3, 0x57 }, { 1, 0x2, 0x6a }, { 12, 0x3, 0x6a },
+    /* state 31: 101110 */
+    { 2, 0x2, 0xa }, { 6, 0x2, 0xa }, { 13, 0x2, 0xa }, { 37, 0x3, 0xa },
+    { 2, 0x2, 0x2c }, { 6, 0x2, 0x2c }, { 13, 0x2, 0x2c }, { 37, 0x3, 0x2c },
+    { 2, 0x2, 0x3f }, { 6, 0x2, 0x3f }, { 13, 0x2, 0x3f }, { 37, 0x3, 0x3f },
+    { 2, 0x2, 0x42 }, { 6, 0x2, 0x42 }, { 13, 0x2, 0x42 }, { 37, 0x3, 0x42 },
+    /* state 32: 1011100 */
+    { 0, 0x4, 0xa }, { 3, 0x2, 0xa }, { 7, 0x2, 0xa }, { 10, 0x2, 0xa },
+    { 14, 0x2, 0xa }, { 21, 0x2, 0xa }, { 38, 0x2, 0xa }, { 137, 0x3, 0xa },
+    { 0, 0x4, 0x2c }, { 3, 0x2, 0x2c }, { 7, 0x2, 0x2c }, { 10, 0x2, 0x2c },
+    { 14, 0x2, 0x2c }, { 21, 0x2, 0x2c }, { 38, 0x2, 0x2c }, { 137, 0x3, 0x2c },
+    /* state 33: 1011101 */
+    { 0, 0x4, 0x3f }, { 3, 0x2, 0x3f }, { 7, 0x2, 0x3f }, { 10, 0x2, 0x3f },
+    { 14, 0x2, 0x3f }, { 21, 0x2, 0x3f }, { 38, 0x2, 0x3f }, { 137, 0x3, 0x3f },
+    { 0, 0x4, 0x42 }, { 3, 0x2, 0x42 }, { 7, 0x2, 0x42 }, { 10, 0x2, 0x42 },
+    { 14, 0x2, 0x42 }, { 21, 0x2, 0x42 }, { 38, 0x2, 0x42 }, { 137, 0x3, 0x42 },
+    /* state 34: 101111 */
+    { 2, 0x2, 0x49 }, { 6, 0x2, 0x49 }, { 13, 0x2, 0x49 }, { 37, 0x3, 0x49 },
+    { 2, 0x2, 0x54 }, { 6, 0x2, 0x54 }, { 13, 0x2, 0x54 }, { 37, 0x3, 0x54 },
+    { 2, 0x2, 0x57 }, { 6, 0x2, 0x57 }, { 13, 0x2, 0x57 }, { 37, 0x3, 0x57 },
+    { 2, 0x2, 0x6a }, { 6, 0x2, 0x6a }, { 13, 0x2, 0x6a }, { 37, 0x3, 0x6a },
+    /* state 35: 1011110 */
+    { 0, 0x4, 0x49 }, { 3, 0x2, 0x49 }, { 7, 0x2, 0x49 }, { 10, 0x2, 0x49 },
+    { 14, 0x2, 0x49 }, { 21, 0x2, 0x49 }, { 38, 0x2, 0x49 }, { 137, 0x3, 0x49 },
+    { 0, 0x4, 0x54 }, { 3, 0x2, 0x54 }, { 7, 0x2, 0x54 }, { 10, 0x2, 0x54 },
+    { 14, 0x2, 0x54 }, { 21, 0x2, 0x54 }, { 38, 0x2, 0x54 }, { 137, 0x3, 0x54 },
+    /* state 36: 1011111 */
+    { 0, 0x4, 0x57 }, { 3, 0x2, 0x57 }, { 7, 0x2, 0x57 }, { 10, 0x2, 0x57 },
+    { 14, 0x2, 0x57 }, { 21, 0x2, 0x57 }, { 38, 0x2, 0x57 }, { 137, 0x3, 0x57 },
+    { 0, 0x4, 0x6a }, { 3, 0x2, 0x6a }, { 7, 0x2, 0x6a }, { 10, 0x2, 0x6a },
+    { 14, 0x2, 0x6a }, { 21, 0x2, 0x6a }, { 38, 0x2, 0x6a }, { 137, 0x3, 0x6a },
+    /* state 37: 11 */
+    { 41, 0x0, 0x0 }, { 43, 0x0, 0x0 }, { 51, 0x0, 0x0 }, { 59, 0x0, 0x0 },
+    { 76, 0x0, 0x0 }, { 91, 0x0, 0x0 }, { 107, 0x0, 0x0 }, { 122, 0x0, 0x0 },
+    { 140, 0x0, 0x0 }, { 155, 0x0, 0x0 }, { 171, 0x0, 0x0 }, { 186, 0x0, 0x0 },
+    { 203, 0x0, 0x0 }, { 218, 0x0, 0x0 }, { 234, 0x0, 0x0 }, { 249, 0x1, 0x0 },
+    /* state 38: 110 */
+    { 42, 0x0, 0x0 }, { 0, 0x4, 0x0 }, { 44, 0x0, 0x0 }, { 47, 0x0, 0x0 },
+    { 52, 0x0, 0x0 }, { 55, 0x0, 0x0 }, { 60, 0x0, 0x0 }, { 67, 0x0, 0x0 },
+    { 77, 0x0, 0x0 }, { 84, 0x0, 0x0 }, { 92, 0x0, 0x0 }, { 99, 0x0, 0x0 },
+    { 108, 0x0, 0x0 }, { 115, 0x0, 0x0 }, { 123, 0x0, 0x0 }, { 130, 0x0, 0x0 },
+    /* state 39: 1100 */
+    { 0, 0x3, 0x76 }, { 0, 0x3, 0x78 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 45, 0x0, 0x0 }, { 46, 0x0, 0x0 }, { 48, 0x0, 0x0 }, { 49, 0x0, 0x0 },
+    { 53, 0x0, 0x0 }, { 54, 0x0, 0x0 }, { 56, 0x0, 0x0 }, { 57, 0x0, 0x0 },
+    { 61, 0x0, 0x0 }, { 64, 0x0, 0x0 }, { 68, 0x0, 0x0 }, { 71, 0x0, 0x0 },
+    /* state 40: 11000 */
+    { 1, 0x2, 0x76 }, { 12, 0x3, 0x76 }, { 1, 0x2, 0x78 }, { 12, 0x3, 0x78 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x3, 0x2d }, { 0, 0x3, 0x43 }, { 0, 0x3, 0x44 }, { 0, 0x3, 0x45 },
+    { 0, 0x3, 0x46 }, { 0, 0x3, 0x47 }, { 0, 0x3, 0x48 }, { 0, 0x3, 0x4c },
+    /* state 41: 110000 */
+    { 2, 0x2, 0x76 }, { 6, 0x2, 0x76 }, { 13, 0x2, 0x76 }, { 37, 0x3, 0x76 },
+    { 2, 0x2, 0x78 }, { 6, 0x2, 0x78 }, { 13, 0x2, 0x78 }, { 37, 0x3, 0x78 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 42: 1100000 */
+    { 0, 0x4, 0x76 }, { 3, 0x2, 0x76 }, { 7, 0x2, 0x76 }, { 10, 0x2, 0x76 },
+    { 14, 0x2, 0x76 }, { 21, 0x2, 0x76 }, { 38, 0x2, 0x76 }, { 137, 0x3, 0x76 },
+    { 0, 0x4, 0x78 }, { 3, 0x2, 0x78 }, { 7, 0x2, 0x78 }, { 10, 0x2, 0x78 },
+    { 14, 0x2, 0x78 }, { 21, 0x2, 0x78 }, { 38, 0x2, 0x78 }, { 137, 0x3, 0x78 },
+    /* state 43: 110001 */
+    { 1, 0x2, 0x2d }, { 12, 0x3, 0x2d }, { 1, 0x2, 0x43 }, { 12, 0x3, 0x43 },
+    { 1, 0x2, 0x44 }, { 12, 0x3, 0x44 }, { 1, 0x2, 0x45 }, { 12, 0x3, 0x45 },
+    { 1, 0x2, 0x46 }, { 12, 0x3, 0x46 }, { 1, 0x2, 0x47 }, { 12, 0x3, 0x47 },
+    { 1, 0x2, 0x48 }, { 12, 0x3, 0x48 }, { 1, 0x2, 0x4c }, { 12, 0x3, 0x4c },
+    /* state 44: 1100010 */
+    { 2, 0x2, 0x2d }, { 6, 0x2, 0x2d }, { 13, 0x2, 0x2d }, { 37, 0x3, 0x2d },
+    { 2, 0x2, 0x43 }, { 6, 0x2, 0x43 }, { 13, 0x2, 0x43 }, { 37, 0x3, 0x43 },
+    { 2, 0x2, 0x44 }, { 6, 0x2, 0x44 }, { 13, 0x2, 0x44 }, { 37, 0x3, 0x44 },
+    { 2, 0x2, 0x45 }, { 6, 0x2, 0x45 }, { 13, 0x2, 0x45 }, { 37, 0x3, 0x45 },
+    /* state 45: 11000100 */
+    { 0, 0x4, 0x2d }, { 3, 0x2, 0x2d }, { 7, 0x2, 0x2d }, { 10, 0x2, 0x2d },
+    { 14, 0x2, 0x2d }, { 21, 0x2, 0x2d }, { 38, 0x2, 0x2d }, { 137, 0x3, 0x2d },
+    { 0, 0x4, 0x43 }, { 3, 0x2, 0x43 }, { 7, 0x2, 0x43 }, { 10, 0x2, 0x43 },
+    { 14, 0x2, 0x43 }, { 21, 0x2, 0x43 }, { 38, 0x2, 0x43 }, { 137, 0x3, 0x43 },
+    /* state 46: 11000101 */
+    { 0, 0x4, 0x44 }, { 3, 0x2, 0x44 }, { 7, 0x2, 0x44 }, { 10, 0x2, 0x44 },
+    { 14, 0x2, 0x44 }, { 21, 0x2, 0x44 }, { 38, 0x2, 0x44 }, { 137, 0x3, 0x44 },
+    { 0, 0x4, 0x45 }, { 3, 0x2, 0x45 }, { 7, 0x2, 0x45 }, { 10, 0x2, 0x45 },
+    { 14, 0x2, 0x45 }, { 21, 0x2, 0x45 }, { 38, 0x2, 0x45 }, { 137, 0x3, 0x45 },
+    /* state 47: 1100011 */
+    { 2, 0x2, 0x46 }, { 6, 0x2, 0x46 }, { 13, 0x2, 0x46 }, { 37, 0x3, 0x46 },
+    { 2, 0x2, 0x47 }, { 6, 0x2, 0x47 }, { 13, 0x2, 0x47 }, { 37, 0x3, 0x47 },
+    { 2, 0x2, 0x48 }, { 6, 0x2, 0x48 }, { 13, 0x2, 0x48 }, { 37, 0x3, 0x48 },
+    { 2, 0x2, 0x4c }, { 6, 0x2, 0x4c }, { 13, 0x2, 0x4c }, { 37, 0x3, 0x4c },
+    /* state 48: 11000110 */
+    { 0, 0x4, 0x46 }, { 3, 0x2, 0x46 }, { 7, 0x2, 0x46 }, { 10, 0x2, 0x46 },
+    { 14, 0x2, 0x46 }, { 21, 0x2, 0x46 }, { 38, 0x2, 0x46 }, { 137, 0x3, 0x46 },
+    { 0, 0x4, 0x47 }, { 3, 0x2, 0x47 }, { 7, 0x2, 0x47 }, { 10, 0x2, 0x47 },
+    { 14, 0x2, 0x47 }, { 21, 0x2, 0x47 }, { 38, 0x2, 0x47 }, { 137, 0x3, 0x47 },
+    /* state 49: 11000111 */
+    { 0, 0x4, 0x48 }, { 3, 0x2, 0x48 }, { 7, 0x2, 0x48 }, { 10, 0x2, 0x48 },
+    { 14, 0x2, 0x48 }, { 21, 0x2, 0x48 }, { 38, 0x2, 0x48 }, { 137, 0x3, 0x48 },
+    { 0, 0x4, 0x4c }, { 3, 0x2, 0x4c }, { 7, 0x2, 0x4c }, { 10, 0x2, 0x4c },
+    { 14, 0x2, 0x4c }, { 21, 0x2, 0x4c }, { 38, 0x2, 0x4c }, { 137, 0x3, 0x4c },
+    /* state 50: 11001 */
+    { 0, 0x3, 0x4d }, { 0, 0x3, 0x50 }, { 0, 0x3, 0x56 }, { 0, 0x3, 0x59 },
+    { 0, 0x3, 0x71 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 58, 0x0, 0x0 },
+    { 62, 0x0, 0x0 }, { 63, 0x0, 0x0 }, { 65, 0x0, 0x0 }, { 66, 0x0, 0x0 },
+    { 69, 0x0, 0x0 }, { 70, 0x0, 0x0 }, { 72, 0x0, 0x0 }, { 73, 0x0, 0x0 },
+    /* state 51: 110010 */
+    { 1, 0x2, 0x4d }, { 12, 0x3, 0x4d }, { 1, 0x2, 0x50 }, { 12, 0x3, 0x50 },
+    { 1, 0x2, 0x56 }, { 12, 0x3, 0x56 }, { 1, 0x2, 0x59 }, { 12, 0x3, 0x59 },
+    { 1, 0x2, 0x71 }, { 12, 0x3, 0x71 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x3, 0x0 }, { 0, 0x3, 0x1 },
+    /* state 52: 1100100 */
+    { 2, 0x2, 0x4d }, { 6, 0x2, 0x4d }, { 13, 0x2, 0x4d }, { 37, 0x3, 0x4d },
+    { 2, 0x2, 0x50 }, { 6, 0x2, 0x50 }, { 13, 0x2, 0x50 }, { 37, 0x3, 0x50 },
+    { 2, 0x2, 0x56 }, { 6, 0x2, 0x56 }, { 13, 0x2, 0x56 }, { 37, 0x3, 0x56 },
+    { 2, 0x2, 0x59 }, { 6, 0x2, 0x59 }, { 13, 0x2, 0x59 }, { 37, 0x3, 0x59 },
+    /* state 53: 11001000 */
+    { 0, 0x4, 0x4d }, { 3, 0x2, 0x4d }, { 7, 0x2, 0x4d }, { 10, 0x2, 0x4d },
+    { 14, 0x2, 0x4d }, { 21, 0x2, 0x4d }, { 38, 0x2, 0x4d }, { 137, 0x3, 0x4d },
+    { 0, 0x4, 0x50 }, { 3, 0x2, 0x50 }, { 7, 0x2, 0x50 }, { 10, 0x2, 0x50 },
+    { 14, 0x2, 0x50 }, { 21, 0x2, 0x50 }, { 38, 0x2, 0x50 }, { 137, 0x3, 0x50 },
+    /* state 54: 11001001 */
+    { 0, 0x4, 0x56 }, { 3, 0x2, 0x56 }, { 7, 0x2, 0x56 }, { 10, 0x2, 0x56 },
+    { 14, 0x2, 0x56 }, { 21, 0x2, 0x56 }, { 38, 0x2, 0x56 }, { 137, 0x3, 0x56 },
+    { 0, 0x4, 0x59 }, { 3, 0x2, 0x59 }, { 7, 0x2, 0x59 }, { 10, 0x2, 0x59 },
+    { 14, 0x2, 0x59 }, { 21, 0x2, 0x59 }, { 38, 0x2, 0x59 }, { 137, 0x3, 0x59 },
+    /* state 55: 1100101 */
+    { 2, 0x2, 0x71 }, { 6, 0x2, 0x71 }, { 13, 0x2, 0x71 }, { 37, 0x3, 0x71 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 1, 0x2, 0x0 }, { 12, 0x3, 0x0 }, { 1, 0x2, 0x1 }, { 12, 0x3, 0x1 },
+    /* state 56: 11001010 */
+    { 0, 0x4, 0x71 }, { 3, 0x2, 0x71 }, { 7, 0x2, 0x71 }, { 10, 0x2, 0x71 },
+    { 14, 0x2, 0x71 }, { 21, 0x2, 0x71 }, { 38, 0x2, 0x71 }, { 137, 0x3, 0x71 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 57: 11001011 */
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 2, 0x2, 0x0 }, { 6, 0x2, 0x0 }, { 13, 0x2, 0x0 }, { 37, 0x3, 0x0 },
+    { 2, 0x2, 0x1 }, { 6, 0x2, 0x1 }, { 13, 0x2, 0x1 }, { 37, 0x3, 0x1 },
+    /* state 58: 110010111 */
+    { 0, 0x4, 0x0 }, { 3, 0x2, 0x0 }, { 7, 0x2, 0x0 }, { 10, 0x2, 0x0 },
+    { 14, 0x2, 0x0 }, { 21, 0x2, 0x0 }, { 38, 0x2, 0x0 }, { 137, 0x3, 0x0 },
+    { 0, 0x4, 0x1 }, { 3, 0x2, 0x1 }, { 7, 0x2, 0x1 }, { 10, 0x2, 0x1 },
+    { 14, 0x2, 0x1 }, { 21, 0x2, 0x1 }, { 38, 0x2, 0x1 }, { 137, 0x3, 0x1 },
+    /* state 59: 110011 */
+    { 0, 0x3, 0x2 }, { 0, 0x3, 0x3 }, { 0, 0x3, 0x4 }, { 0, 0x3, 0x5 },
+    { 0, 0x3, 0x6 }, { 0, 0x3, 0x7 }, { 0, 0x3, 0x8 }, { 0, 0x3, 0x9 },
+    { 0, 0x3, 0xb }, { 0, 0x3, 0xc }, { 0, 0x3, 0xd }, { 0, 0x3, 0xe },
+    { 0, 0x3, 0xf }, { 0, 0x3, 0x10 }, { 0, 0x3, 0x11 }, { 0, 0x3, 0x12 },
+    /* state 60: 1100110 */
+    { 1, 0x2, 0x2 }, { 12, 0x3, 0x2 }, { 1, 0x2, 0x3 }, { 12, 0x3, 0x3 },
+    { 1, 0x2, 0x4 }, { 12, 0x3, 0x4 }, { 1, 0x2, 0x5 }, { 12, 0x3, 0x5 },
+    { 1, 0x2, 0x6 }, { 12, 0x3, 0x6 }, { 1, 0x2, 0x7 }, { 12, 0x3, 0x7 },
+    { 1, 0x2, 0x8 }, { 12, 0x3, 0x8 }, { 1, 0x2, 0x9 }, { 12, 0x3, 0x9 },
+    /* state 61: 11001100 */
+    { 2, 0x2, 0x2 }, { 6, 0x2, 0x2 }, { 13, 0x2, 0x2 }, { 37, 0x3, 0x2 },
+    { 2, 0x2, 0x3 }, { 6, 0x2, 0x3 }, { 13, 0x2, 0x3 }, { 37, 0x3, 0x3 },
+    { 2, 0x2, 0x4 }, { 6, 0x2, 0x4 }, { 13, 0x2, 0x4 }, { 37, 0x3, 0x4 },
+    { 2, 0x2, 0x5 }, { 6, 0x2, 0x5 }, { 13, 0x2, 0x5 }, { 37, 0x3, 0x5 },
+    /* state 62: 110011000 */
+    { 0, 0x4, 0x2 }, { 3, 0x2, 0x2 }, { 7, 0x2, 0x2 }, { 10, 0x2, 0x2 },
+    { 14, 0x2, 0x2 }, { 21, 0x2, 0x2 }, { 38, 0x2, 0x2 }, { 137, 0x3, 0x2 },
+    { 0, 0x4, 0x3 }, { 3, 0x2, 0x3 }, { 7, 0x2, 0x3 }, { 10, 0x2, 0x3 },
+    { 14, 0x2, 0x3 }, { 21, 0x2, 0x3 }, { 38, 0x2, 0x3 }, { 137, 0x3, 0x3 },
+    /* state 63: 110011001 */
+    { 0, 0x4, 0x4 }, { 3, 0x2, 0x4 }, { 7, 0x2, 0x4 }, { 10, 0x2, 0x4 },
+    { 14, 0x2, 0x4 }, { 21, 0x2, 0x4 }, { 38, 0x2, 0x4 }, { 137, 0x3, 0x4 },
+    { 0, 0x4, 0x5 }, { 3, 0x2, 0x5 }, { 7, 0x2, 0x5 }, { 10, 0x2, 0x5 },
+    { 14, 0x2, 0x5 }, { 21, 0x2, 0x5 }, { 38, 0x2, 0x5 }, { 137, 0x3, 0x5 },
+    /* state 64: 11001101 */
+    { 2, 0x2, 0x6 }, { 6, 0x2, 0x6 }, { 13, 0x2, 0x6 }, { 37, 0x3, 0x6 },
+    { 2, 0x2, 0x7 }, { 6, 0x2, 0x7 }, { 13, 0x2, 0x7 }, { 37, 0x3, 0x7 },
+    { 2, 0x2, 0x8 }, { 6, 0x2, 0x8 }, { 13, 0x2, 0x8 }, { 37, 0x3, 0x8 },
+    { 2, 0x2, 0x9 }, { 6, 0x2, 0x9 }, { 13, 0x2, 0x9 }, { 37, 0x3, 0x9 },
+    /* state 65: 110011010 */
+    { 0, 0x4, 0x6 }, { 3, 0x2, 0x6 }, { 7, 0x2, 0x6 }, { 10, 0x2, 0x6 },
+    { 14, 0x2, 0x6 }, { 21, 0x2, 0x6 }, { 38, 0x2, 0x6 }, { 137, 0x3, 0x6 },
+    { 0, 0x4, 0x7 }, { 3, 0x2, 0x7 }, { 7, 0x2, 0x7 }, { 10, 0x2, 0x7 },
+    { 14, 0x2, 0x7 }, { 21, 0x2, 0x7 }, { 38, 0x2, 0x7 }, { 137, 0x3, 0x7 },
+    /* state 66: 110011011 */
+    { 0, 0x4, 0x8 }, { 3, 0x2, 0x8 }, { 7, 0x2, 0x8 }, { 10, 0x2, 0x8 },
+    { 14, 0x2, 0x8 }, { 21, 0x2, 0x8 }, { 38, 0x2, 0x8 }, { 137, 0x3, 0x8 },
+    { 0, 0x4, 0x9 }, { 3, 0x2, 0x9 }, { 7, 0x2, 0x9 }, { 10, 0x2, 0x9 },
+    { 14, 0x2, 0x9 }, { 21, 0x2, 0x9 }, { 38, 0x2, 0x9 }, { 137, 0x3, 0x9 },
+    /* state 67: 1100111 */
+    { 1, 0x2, 0xb }, { 12, 0x3, 0xb }, { 1, 0x2, 0xc }, { 12, 0x3, 0xc },
+    { 1, 0x2, 0xd }, { 12, 0x3, 0xd }, { 1, 0x2, 0xe }, { 12, 0x3, 0xe },
+    { 1, 0x2, 0xf }, { 12, 0x3, 0xf }, { 1, 0x2, 0x10 }, { 12, 0x3, 0x10 },
+    { 1, 0x2, 0x11 }, { 12, 0x3, 0x11 }, { 1, 0x2, 0x12 }, { 12, 0x3, 0x12 },
+    /* state 68: 11001110 */
+    { 2, 0x2, 0xb }, { 6, 0x2, 0xb }, { 13, 0x2, 0xb }, { 37, 0x3, 0xb },
+    { 2, 0x2, 0xc }, { 6, 0x2, 0xc }, { 13, 0x2, 0xc }, { 37, 0x3, 0xc },
+    { 2, 0x2, 0xd }, { 6, 0x2, 0xd }, { 13, 0x2, 0xd }, { 37, 0x3, 0xd },
+    { 2, 0x2, 0xe }, { 6, 0x2, 0xe }, { 13, 0x2, 0xe }, { 37, 0x3, 0xe },
+    /* state 69: 110011100 */
+    { 0, 0x4, 0xb }, { 3, 0x2, 0xb }, { 7, 0x2, 0xb }, { 10, 0x2, 0xb },
+    { 14, 0x2, 0xb }, { 21, 0x2, 0xb }, { 38, 0x2, 0xb }, { 137, 0x3, 0xb },
+    { 0, 0x4, 0xc }, { 3, 0x2, 0xc }, { 7, 0x2, 0xc }, { 10, 0x2, 0xc },
+    { 14, 0x2, 0xc }, { 21, 0x2, 0xc }, { 38, 0x2, 0xc }, { 137, 0x3, 0xc },
+    /* state 70: 110011101 */
+    { 0, 0x4, 0xd }, { 3, 0x2, 0xd }, { 7, 0x2, 0xd }, { 10, 0x2, 0xd },
+    { 14, 0x2, 0xd }, { 21, 0x2, 0xd }, { 38, 0x2, 0xd }, { 137, 0x3, 0xd },
+    { 0, 0x4, 0xe }, { 3, 0x2, 0xe }, { 7, 0x2, 0xe }, { 10, 0x2, 0xe },
+    { 14, 0x2, 0xe }, { 21, 0x2, 0xe }, { 38, 0x2, 0xe }, { 137, 0x3, 0xe },
+    /* state 71: 11001111 */
+    { 2, 0x2, 0xf }, { 6, 0x2, 0xf }, { 13, 0x2, 0xf }, { 37, 0x3, 0xf },
+    { 2, 0x2, 0x10 }, { 6, 0x2, 0x10 }, { 13, 0x2, 0x10 }, { 37, 0x3, 0x10 },
+    { 2, 0x2, 0x11 }, { 6, 0x2, 0x11 }, { 13, 0x2, 0x11 }, { 37, 0x3, 0x11 },
+    { 2, 0x2, 0x12 }, { 6, 0x2, 0x12 }, { 13, 0x2, 0x12 }, { 37, 0x3, 0x12 },
+    /* state 72: 110011110 */
+    { 0, 0x4, 0xf }, { 3, 0x2, 0xf }, { 7, 0x2, 0xf }, { 10, 0x2, 0xf },
+    { 14, 0x2, 0xf }, { 21, 0x2, 0xf }, { 38, 0x2, 0xf }, { 137, 0x3, 0xf },
+    { 0, 0x4, 0x10 }, { 3, 0x2, 0x10 }, { 7, 0x2, 0x10 }, { 10, 0x2, 0x10 },
+    { 14, 0x2, 0x10 }, { 21, 0x2, 0x10 }, { 38, 0x2, 0x10 }, { 137, 0x3, 0x10 },
+    /* state 73: 110011111 */
+    { 0, 0x4, 0x11 }, { 3, 0x2, 0x11 }, { 7, 0x2, 0x11 }, { 10, 0x2, 0x11 },
+    { 14, 0x2, 0x11 }, { 21, 0x2, 0x11 }, { 38, 0x2, 0x11 }, { 137, 0x3, 0x11 },
+    { 0, 0x4, 0x12 }, { 3, 0x2, 0x12 }, { 7, 0x2, 0x12 }, { 10, 0x2, 0x12 },
+    { 14, 0x2, 0x12 }, { 21, 0x2, 0x12 }, { 38, 0x2, 0x12 }, { 137, 0x3, 0x12 },
+    /* state 74: 1101 */
+    { 78, 0x0, 0x0 }, { 81, 0x0, 0x0 }, { 85, 0x0, 0x0 }, { 88, 0x0, 0x0 },
+    { 93, 0x0, 0x0 }, { 96, 0x0, 0x0 }, { 100, 0x0, 0x0 }, { 103, 0x0, 0x0 },
+    { 109, 0x0, 0x0 }, { 112, 0x0, 0x0 }, { 116, 0x0, 0x0 }, { 119, 0x0, 0x0 },
+    { 124, 0x0, 0x0 }, { 127, 0x0, 0x0 }, { 131, 0x0, 0x0 }, { 134, 0x0, 0x0 },
+    /* state 75: 11010 */
+    { 79, 0x0, 0x0 }, { 80, 0x0, 0x0 }, { 82, 0x0, 0x0 }, { 83, 0x0, 0x0 },
+    { 86, 0x0, 0x0 }, { 87, 0x0, 0x0 }, { 89, 0x0, 0x0 }, { 90, 0x0, 0x0 },
+    { 94, 0x0, 0x0 }, { 95, 0x0, 0x0 }, { 97, 0x0, 0x0 }, { 98, 0x0, 0x0 },
+    { 101, 0x0, 0x0 }, { 102, 0x0, 0x0 }, { 104, 0x0, 0x0 }, { 105, 0x0, 0x0 },
+    /* state 76: 110100 */
+    { 0, 0x3, 0x13 }, { 0, 0x3, 0x14 }, { 0, 0x3, 0x15 }, { 0, 0x3, 0x16 },
+    { 0, 0x3, 0x17 }, { 0, 0x3, 0x18 }, { 0, 0x3, 0x19 }, { 0, 0x3, 0x1a },
+    { 0, 0x3, 0x1b }, { 0, 0x3, 0x1c }, { 0, 0x3, 0x1d }, { 0, 0x3, 0x1e },
+    { 0, 0x3, 0x1f }, { 0, 0x3, 0x21 }, { 0, 0x3, 0x22 }, { 0, 0x3, 0x23 },
+    /* state 77: 1101000 */
+    { 1, 0x2, 0x13 }, { 12, 0x3, 0x13 }, { 1, 0x2, 0x14 }, { 12, 0x3, 0x14 },
+    { 1, 0x2, 0x15 }, { 12, 0x3, 0x15 }, { 1, 0x2, 0x16 }, { 12, 0x3, 0x16 },
+    { 1, 0x2, 0x17 }, { 12, 0x3, 0x17 }, { 1, 0x2, 0x18 }, { 12, 0x3, 0x18 },
+    { 1, 0x2, 0x19 }, { 12, 0x3, 0x19 }, { 1, 0x2, 0x1a }, { 12, 0x3, 0x1a },
+    /* state 78: 11010000 */
+    { 2, 0x2, 0x13 }, { 6, 0x2, 0x13 }, { 13, 0x2, 0x13 }, { 37, 0x3, 0x13 },
+    { 2, 0x2, 0x14 }, { 6, 0x2, 0x14 }, { 13, 0x2, 0x14 }, { 37, 0x3, 0x14 },
+    { 2, 0x2, 0x15 }, { 6, 0x2, 0x15 }, { 13, 0x2, 0x15 }, { 37, 0x3, 0x15 },
+    { 2, 0x2, 0x16 }, { 6, 0x2, 0x16 }, { 13, 0x2, 0x16 }, { 37, 0x3, 0x16 },
+    /* state 79: 110100000 */
+    { 0, 0x4, 0x13 }, { 3, 0x2, 0x13 }, { 7, 0x2, 0x13 }, { 10, 0x2, 0x13 },
+    { 14, 0x2, 0x13 }, { 21, 0x2, 0x13 }, { 38, 0x2, 0x13 }, { 137, 0x3, 0x13 },
+    { 0, 0x4, 0x14 }, { 3, 0x2, 0x14 }, { 7, 0x2, 0x14 }, { 10, 0x2, 0x14 },
+    { 14, 0x2, 0x14 }, { 21, 0x2, 0x14 }, { 38, 0x2, 0x14 }, { 137, 0x3, 0x14 },
+    /* state 80: 110100001 */
+    { 0, 0x4, 0x15 }, { 3, 0x2, 0x15 }, { 7, 0x2, 0x15 }, { 10, 0x2, 0x15 },
+    { 14, 0x2, 0x15 }, { 21, 0x2, 0x15 }, { 38, 0x2, 0x15 }, { 137, 0x3, 0x15 },
+    { 0, 0x4, 0x16 }, { 3, 0x2, 0x16 }, { 7, 0x2, 0x16 }, { 10, 0x2, 0x16 },
+    { 14, 0x2, 0x16 }, { 21, 0x2, 0x16 }, { 38, 0x2, 0x16 }, { 137, 0x3, 0x16 },
+    /* state 81: 11010001 */
+    { 2, 0x2, 0x17 }, { 6, 0x2, 0x17 }, { 13, 0x2, 0x17 }, { 37, 0x3, 0x17 },
+    { 2, 0x2, 0x18 }, { 6, 0x2, 0x18 }, { 13, 0x2, 0x18 }, { 37, 0x3, 0x18 },
+    { 2, 0x2, 0x19 }, { 6, 0x2, 0x19 }, { 13, 0x2, 0x19 }, { 37, 0x3, 0x19 },
+    { 2, 0x2, 0x1a }, { 6, 0x2, 0x1a }, { 13, 0x2, 0x1a }, { 37, 0x3, 0x1a },
+    /* state 82: 110100010 */
+    { 0, 0x4, 0x17 }, { 3, 0x2, 0x17 }, { 7, 0x2, 0x17 }, { 10, 0x2, 0x17 },
+    { 14, 0x2, 0x17 }, { 21, 0x2, 0x17 }, { 38, 0x2, 0x17 }, { 137, 0x3, 0x17 },
+    { 0, 0x4, 0x18 }, { 3, 0x2, 0x18 }, { 7, 0x2, 0x18 }, { 10, 0x2, 0x18 },
+    { 14, 0x2, 0x18 }, { 21, 0x2, 0x18 }, { 38, 0x2, 0x18 }, { 137, 0x3, 0x18 },
+    /* state 83: 110100011 */
+    { 0, 0x4, 0x19 }, { 3, 0x2, 0x19 }, { 7, 0x2, 0x19 }, { 10, 0x2, 0x19 },
+    { 14, 0x2, 0x19 }, { 21, 0x2, 0x19 }, { 38, 0x2, 0x19 }, { 137, 0x3, 0x19 },
+    { 0, 0x4, 0x1a }, { 3, 0x2, 0x1a }, { 7, 0x2, 0x1a }, { 10, 0x2, 0x1a },
+    { 14, 0x2, 0x1a }, { 21, 0x2, 0x1a }, { 38, 0x2, 0x1a }, { 137, 0x3, 0x1a },
+    /* state 84: 1101001 */
+    { 1, 0x2, 0x1b }, { 12, 0x3, 0x1b }, { 1, 0x2, 0x1c }, { 12, 0x3, 0x1c },
+    { 1, 0x2, 0x1d }, { 12, 0x3, 0x1d }, { 1, 0x2, 0x1e }, { 12, 0x3, 0x1e },
+    { 1, 0x2, 0x1f }, { 12, 0x3, 0x1f }, { 1, 0x2, 0x21 }, { 12, 0x3, 0x21 },
+    { 1, 0x2, 0x22 }, { 12, 0x3, 0x22 }, { 1, 0x2, 0x23 }, { 12, 0x3, 0x23 },
+    /* state 85: 11010010 */
+    { 2, 0x2, 0x1b }, { 6, 0x2, 0x1b }, { 13, 0x2, 0x1b }, { 37, 0x3, 0x1b },
+    { 2, 0x2, 0x1c }, { 6, 0x2, 0x1c }, { 13, 0x2, 0x1c }, { 37, 0x3, 0x1c },
+    { 2, 0x2, 0x1d }, { 6, 0x2, 0x1d }, { 13, 0x2, 0x1d }, { 37, 0x3, 0x1d },
+    { 2, 0x2, 0x1e }, { 6, 0x2, 0x1e }, { 13, 0x2, 0x1e }, { 37, 0x3, 0x1e },
+    /* state 86: 110100100 */
+    { 0, 0x4, 0x1b }, { 3, 0x2, 0x1b }, { 7, 0x2, 0x1b }, { 10, 0x2, 0x1b },
+    { 14, 0x2, 0x1b }, { 21, 0x2, 0x1b }, { 38, 0x2, 0x1b }, { 137, 0x3, 0x1b },
+    { 0, 0x4, 0x1c }, { 3, 0x2, 0x1c }, { 7, 0x2, 0x1c }, { 10, 0x2, 0x1c },
+    { 14, 0x2, 0x1c }, { 21, 0x2, 0x1c }, { 38, 0x2, 0x1c }, { 137, 0x3, 0x1c },
+    /* state 87: 110100101 */
+    { 0, 0x4, 0x1d }, { 3, 0x2, 0x1d }, { 7, 0x2, 0x1d }, { 10, 0x2, 0x1d },
+    { 14, 0x2, 0x1d }, { 21, 0x2, 0x1d }, { 38, 0x2, 0x1d }, { 137, 0x3, 0x1d },
+    { 0, 0x4, 0x1e }, { 3, 0x2, 0x1e }, { 7, 0x2, 0x1e }, { 10, 0x2, 0x1e },
+    { 14, 0x2, 0x1e }, { 21, 0x2, 0x1e }, { 38, 0x2, 0x1e }, { 137, 0x3, 0x1e },
+    /* state 88: 11010011 */
+    { 2, 0x2, 0x1f }, { 6, 0x2, 0x1f }, { 13, 0x2, 0x1f }, { 37, 0x3, 0x1f },
+    { 2, 0x2, 0x21 }, { 6, 0x2, 0x21 }, { 13, 0x2, 0x21 }, { 37, 0x3, 0x21 },
+    { 2, 0x2, 0x22 }, { 6, 0x2, 0x22 }, { 13, 0x2, 0x22 }, { 37, 0x3, 0x22 },
+    { 2, 0x2, 0x23 }, { 6, 0x2, 0x23 }, { 13, 0x2, 0x23 }, { 37, 0x3, 0x23 },
+    /* state 89: 110100110 */
+    { 0, 0x4, 0x1f }, { 3, 0x2, 0x1f }, { 7, 0x2, 0x1f }, { 10, 0x2, 0x1f },
+    { 14, 0x2, 0x1f }, { 21, 0x2, 0x1f }, { 38, 0x2, 0x1f }, { 137, 0x3, 0x1f },
+    { 0, 0x4, 0x21 }, { 3, 0x2, 0x21 }, { 7, 0x2, 0x21 }, { 10, 0x2, 0x21 },
+    { 14, 0x2, 0x21 }, { 21, 0x2, 0x21 }, { 38, 0x2, 0x21 }, { 137, 0x3, 0x21 },
+    /* state 90: 110100111 */
+    { 0, 0x4, 0x22 }, { 3, 0x2, 0x22 }, { 7, 0x2, 0x22 }, { 10, 0x2, 0x22 },
+    { 14, 0x2, 0x22 }, { 21, 0x2, 0x22 }, { 38, 0x2, 0x22 }, { 137, 0x3, 0x22 },
+    { 0, 0x4, 0x23 }, { 3, 0x2, 0x23 }, { 7, 0x2, 0x23 }, { 10, 0x2, 0x23 },
+    { 14, 0x2, 0x23 }, { 21, 0x2, 0x23 }, { 38, 0x2, 0x23 }, { 137, 0x3, 0x23 },
+    /* state 91: 110101 */
+    { 0, 0x3, 0x24 }, { 0, 0x3, 0x25 }, { 0, 0x3, 0x26 }, { 0, 0x3, 0x28 },
+    { 0, 0x3, 0x29 }, { 0, 0x3, 0x2a }, { 0, 0x3, 0x2b }, { 0, 0x3, 0x2f },
+    { 0, 0x3, 0x30 }, { 0, 0x3, 0x31 }, { 0, 0x3, 0x32 }, { 0, 0x3, 0x33 },
+    { 0, 0x3, 0x34 }, { 0, 0x3, 0x35 }, { 0, 0x3, 0x36 }, { 0, 0x3, 0x37 },
+    /* state 92: 1101010 */
+    { 1, 0x2, 0x24 }, { 12, 0x3, 0x24 }, { 1, 0x2, 0x25 }, { 12, 0x3, 0x25 },
+    { 1, 0x2, 0x26 }, { 12, 0x3, 0x26 }, { 1, 0x2, 0x28 }, { 12, 0x3, 0x28 },
+    { 1, 0x2, 0x29 }, { 12, 0x3, 0x29 }, { 1, 0x2, 0x2a }, { 12, 0x3, 0x2a },
+    { 1, 0x2, 0x2b }, { 12, 0x3, 0x2b }, { 1, 0x2, 0x2f }, { 12, 0x3, 0x2f },
+    /* state 93: 11010100 */
+    { 2, 0x2, 0x24 }, { 6, 0x2, 0x24 }, { 13, 0x2, 0x24 }, { 37, 0x3, 0x24 },
+    { 2, 0x2, 0x25 }, { 6, 0x2, 0x25 }, { 13, 0x2, 0x25 }, { 37, 0x3, 0x25 },
+    { 2, 0x2, 0x26 }, { 6, 0x2, 0x26 }, { 13, 0x2, 0x26 }, { 37, 0x3, 0x26 },
+    { 2, 0x2, 0x28 }, { 6, 0x2, 0x28 }, { 13, 0x2, 0x28 }, { 37, 0x3, 0x28 },
+    /* state 94: 110101000 */
+    { 0, 0x4, 0x24 }, { 3, 0x2, 0x24 }, { 7, 0x2, 0x24 }, { 10, 0x2, 0x24 },
+    { 14, 0x2, 0x24 }, { 21, 0x2, 0x24 }, { 38, 0x2, 0x24 }, { 137, 0x3, 0x24 },
+    { 0, 0x4, 0x25 }, { 3, 0x2, 0x25 }, { 7, 0x2, 0x25 }, { 10, 0x2, 0x25 },
+    { 14, 0x2, 0x25 }, { 21, 0x2, 0x25 }, { 38, 0x2, 0x25 }, { 137, 0x3, 0x25 },
+    /* state 95: 110101001 */
+    { 0, 0x4, 0x26 }, { 3, 0x2, 0x26 }, { 7, 0x2, 0x26 }, { 10, 0x2, 0x26 },
+    { 14, 0x2, 0x26 }, { 21, 0x2, 0x26 }, { 38, 0x2, 0x26 }, { 137, 0x3, 0x26 },
+    { 0, 0x4, 0x28 }, { 3, 0x2, 0x28 }, { 7, 0x2, 0x28 }, { 10, 0x2, 0x28 },
+    { 14, 0x2, 0x28 }, { 21, 0x2, 0x28 }, { 38, 0x2, 0x28 }, { 137, 0x3, 0x28 },
+    /* state 96: 11010101 */
+    { 2, 0x2, 0x29 }, { 6, 0x2, 0x29 }, { 13, 0x2, 0x29 }, { 37, 0x3, 0x29 },
+    { 2, 0x2, 0x2a }, { 6, 0x2, 0x2a }, { 13, 0x2, 0x2a }, { 37, 0x3, 0x2a },
+    { 2, 0x2, 0x2b }, { 6, 0x2, 0x2b }, { 13, 0x2, 0x2b }, { 37, 0x3, 0x2b },
+    { 2, 0x2, 0x2f }, { 6, 0x2, 0x2f }, { 13, 0x2, 0x2f }, { 37, 0x3, 0x2f },
+    /* state 97: 110101010 */
+    { 0, 0x4, 0x29 }, { 3, 0x2, 0x29 }, { 7, 0x2, 0x29 }, { 10, 0x2, 0x29 },
+    { 14, 0x2, 0x29 }, { 21, 0x2, 0x29 }, { 38, 0x2, 0x29 }, { 137, 0x3, 0x29 },
+    { 0, 0x4, 0x2a }, { 3, 0x2, 0x2a }, { 7, 0x2, 0x2a }, { 10, 0x2, 0x2a },
+    { 14, 0x2, 0x2a }, { 21, 0x2, 0x2a }, { 38, 0x2, 0x2a }, { 137, 0x3, 0x2a },
+    /* state 98: 110101011 */
+    { 0, 0x4, 0x2b }, { 3, 0x2, 0x2b }, { 7, 0x2, 0x2b }, { 10, 0x2, 0x2b },
+    { 14, 0x2, 0x2b }, { 21, 0x2, 0x2b }, { 38, 0x2, 0x2b }, { 137, 0x3, 0x2b },
+    { 0, 0x4, 0x2f }, { 3, 0x2, 0x2f }, { 7, 0x2, 0x2f }, { 10, 0x2, 0x2f },
+    { 14, 0x2, 0x2f }, { 21, 0x2, 0x2f }, { 38, 0x2, 0x2f }, { 137, 0x3, 0x2f },
+    /* state 99: 1101011 */
+    { 1, 0x2, 0x30 }, { 12, 0x3, 0x30 }, { 1, 0x2, 0x31 }, { 12, 0x3, 0x31 },
+    { 1, 0x2, 0x32 }, { 12, 0x3, 0x32 }, { 1, 0x2, 0x33 }, { 12, 0x3, 0x33 },
+    { 1, 0x2, 0x34 }, { 12, 0x3, 0x34 }, { 1, 0x2, 0x35 }, { 12, 0x3, 0x35 },
+    { 1, 0x2, 0x36 }, { 12, 0x3, 0x36 }, { 1, 0x2, 0x37 }, { 12, 0x3, 0x37 },
+    /* state 100: 11010110 */
+    { 2, 0x2, 0x30 }, { 6, 0x2, 0x30 }, { 13, 0x2, 0x30 }, { 37, 0x3, 0x30 },
+    { 2, 0x2, 0x31 }, { 6, 0x2, 0x31 }, { 13, 0x2, 0x31 }, { 37, 0x3, 0x31 },
+    { 2, 0x2, 0x32 }, { 6, 0x2, 0x32 }, { 13, 0x2, 0x32 }, { 37, 0x3, 0x32 },
+    { 2, 0x2, 0x33 }, { 6, 0x2, 0x33 }, { 13, 0x2, 0x33 }, { 37, 0x3, 0x33 },
+    /* state 101: 110101100 */
+    { 0, 0x4, 0x30 }, { 3, 0x2, 0x30 }, { 7, 0x2, 0x30 }, { 10, 0x2, 0x30 },
+    { 14, 0x2, 0x30 }, { 21, 0x2, 0x30 }, { 38, 0x2, 0x30 }, { 137, 0x3, 0x30 },
+    { 0, 0x4, 0x31 }, { 3, 0x2, 0x31 }, { 7, 0x2, 0x31 }, { 10, 0x2, 0x31 },
+    { 14, 0x2, 0x31 }, { 21, 0x2, 0x31 }, { 38, 0x2, 0x31 }, { 137, 0x3, 0x31 },
+    /* state 102: 110101101 */
+    { 0, 0x4, 0x32 }, { 3, 0x2, 0x32 }, { 7, 0x2, 0x32 }, { 10, 0x2, 0x32 },
+    { 14, 0x2, 0x32 }, { 21, 0x2, 0x32 }, { 38, 0x2, 0x32 }, { 137, 0x3, 0x32 },
+    { 0, 0x4, 0x33 }, { 3, 0x2, 0x33 }, { 7, 0x2, 0x33 }, { 10, 0x2, 0x33 },
+    { 14, 0x2, 0x33 }, { 21, 0x2, 0x33 }, { 38, 0x2, 0x33 }, { 137, 0x3, 0x33 },
+    /* state 103: 11010111 */
+    { 2, 0x2, 0x34 }, { 6, 0x2, 0x34 }, { 13, 0x2, 0x34 }, { 37, 0x3, 0x34 },
+    { 2, 0x2, 0x35 }, { 6, 0x2, 0x35 }, { 13, 0x2, 0x35 }, { 37, 0x3, 0x35 },
+    { 2, 0x2, 0x36 }, { 6, 0x2, 0x36 }, { 13, 0x2, 0x36 }, { 37, 0x3, 0x36 },
+    { 2, 0x2, 0x37 }, { 6, 0x2, 0x37 }, { 13, 0x2, 0x37 }, { 37, 0x3, 0x37 },
+    /* state 104: 110101110 */
+    { 0, 0x4, 0x34 }, { 3, 0x2, 0x34 }, { 7, 0x2, 0x34 }, { 10, 0x2, 0x34 },
+    { 14, 0x2, 0x34 }, { 21, 0x2, 0x34 }, { 38, 0x2, 0x34 }, { 137, 0x3, 0x34 },
+    { 0, 0x4, 0x35 }, { 3, 0x2, 0x35 }, { 7, 0x2, 0x35 }, { 10, 0x2, 0x35 },
+    { 14, 0x2, 0x35 }, { 21, 0x2, 0x35 }, { 38, 0x2, 0x35 }, { 137, 0x3, 0x35 },
+    /* state 105: 110101111 */
+    { 0, 0x4, 0x36 }, { 3, 0x2, 0x36 }, { 7, 0x2, 0x36 }, { 10, 0x2, 0x36 },
+    { 14, 0x2, 0x36 }, { 21, 0x2, 0x36 }, { 38, 0x2, 0x36 }, { 137, 0x3, 0x36 },
+    { 0, 0x4, 0x37 }, { 3, 0x2, 0x37 }, { 7, 0x2, 0x37 }, { 10, 0x2, 0x37 },
+    { 14, 0x2, 0x37 }, { 21, 0x2, 0x37 }, { 38, 0x2, 0x37 }, { 137, 0x3, 0x37 },
+    /* state 106: 11011 */
+    { 110, 0x0, 0x0 }, { 111, 0x0, 0x0 }, { 113, 0x0, 0x0 }, { 114, 0x0, 0x0 },
+    { 117, 0x0, 0x0 }, { 118, 0x0, 0x0 }, { 120, 0x0, 0x0 }, { 121, 0x0, 0x0 },
+    { 125, 0x0, 0x0 }, { 126, 0x0, 0x0 }, { 128, 0x0, 0x0 }, { 129, 0x0, 0x0 },
+    { 132, 0x0, 0x0 }, { 133, 0x0, 0x0 }, { 135, 0x0, 0x0 }, { 136, 0x0, 0x0 },
+    /* state 107: 110110 */
+    { 0, 0x3, 0x38 }, { 0, 0x3, 0x39 }, { 0, 0x3, 0x3a }, { 0, 0x3, 0x3b },
+    { 0, 0x3, 0x3c }, { 0, 0x3, 0x3d }, { 0, 0x3, 0x3e }, { 0, 0x3, 0x40 },
+    { 0, 0x3, 0x41 }, { 0, 0x3, 0x4a }, { 0, 0x3, 0x4b }, { 0, 0x3, 0x4e },
+    { 0, 0x3, 0x4f }, { 0, 0x3, 0x51 }, { 0, 0x3, 0x52 }, { 0, 0x3, 0x53 },
+    /* state 108: 1101100 */
+    { 1, 0x2, 0x38 }, { 12, 0x3, 0x38 }, { 1, 0x2, 0x39 }, { 12, 0x3, 0x39 },
+    { 1, 0x2, 0x3a }, { 12, 0x3, 0x3a }, { 1, 0x2, 0x3b }, { 12, 0x3, 0x3b },
+    { 1, 0x2, 0x3c }, { 12, 0x3, 0x3c }, { 1, 0x2, 0x3d }, { 12, 0x3, 0x3d },
+    { 1, 0x2, 0x3e }, { 12, 0x3, 0x3e }, { 1, 0x2, 0x40 }, { 12, 0x3, 0x40 },
+    /* state 109: 11011000 */
+    { 2, 0x2, 0x38 }, { 6, 0x2, 0x38 }, { 13, 0x2, 0x38 }, { 37, 0x3, 0x38 },
+    { 2, 0x2, 0x39 }, { 6, 0x2, 0x39 }, { 13, 0x2, 0x39 }, { 37, 0x3, 0x39 },
+    { 2, 0x2, 0x3a }, { 6, 0x2, 0x3a }, { 13, 0x2, 0x3a }, { 37, 0x3, 0x3a },
+    { 2, 0x2, 0x3b }, { 6, 0x2, 0x3b }, { 13, 0x2, 0x3b }, { 37, 0x3, 0x3b },
+    /* state 110: 110110000 */
+    { 0, 0x4, 0x38 }, { 3, 0x2, 0x38 }, { 7, 0x2, 0x38 }, { 10, 0x2, 0x38 },
+    { 14, 0x2, 0x38 }, { 21, 0x2, 0x38 }, { 38, 0x2, 0x38 }, { 137, 0x3, 0x38 },
+    { 0, 0x4, 0x39 }, { 3, 0x2, 0x39 }, { 7, 0x2, 0x39 }, { 10, 0x2, 0x39 },
+    { 14, 0x2, 0x39 }, { 21, 0x2, 0x39 }, { 38, 0x2, 0x39 }, { 137, 0x3, 0x39 },
+    /* state 111: 110110001 */
+    { 0, 0x4, 0x3a }, { 3, 0x2, 0x3a }, { 7, 0x2, 0x3a }, { 10, 0x2, 0x3a },
+    { 14, 0x2, 0x3a }, { 21, 0x2, 0x3a }, { 38, 0x2, 0x3a }, { 137, 0x3, 0x3a },
+    { 0, 0x4, 0x3b }, { 3, 0x2, 0x3b }, { 7, 0x2, 0x3b }, { 10, 0x2, 0x3b },
+    { 14, 0x2, 0x3b }, { 21, 0x2, 0x3b }, { 38, 0x2, 0x3b }, { 137, 0x3, 0x3b },
+    /* state 112: 11011001 */
+    { 2, 0x2, 0x3c }, { 6, 0x2, 0x3c }, { 13, 0x2, 0x3c }, { 37, 0x3, 0x3c },
+    { 2, 0x2, 0x3d }, { 6, 0x2, 0x3d }, { 13, 0x2, 0x3d }, { 37, 0x3, 0x3d },
+    { 2, 0x2, 0x3e }, { 6, 0x2, 0x3e }, { 13, 0x2, 0x3e }, { 37, 0x3, 0x3e },
+    { 2, 0x2, 0x40 }, { 6, 0x2, 0x40 }, { 13, 0x2, 0x40 }, { 37, 0x3, 0x40 },
+    /* state 113: 110110010 */
+    { 0, 0x4, 0x3c }, { 3, 0x2, 0x3c }, { 7, 0x2, 0x3c }, { 10, 0x2, 0x3c },
+    { 14, 0x2, 0x3c }, { 21, 0x2, 0x3c }, { 38, 0x2, 0x3c }, { 137, 0x3, 0x3c },
+    { 0, 0x4, 0x3d }, { 3, 0x2, 0x3d }, { 7, 0x2, 0x3d }, { 10, 0x2, 0x3d },
+    { 14, 0x2, 0x3d }, { 21, 0x2, 0x3d }, { 38, 0x2, 0x3d }, { 137, 0x3, 0x3d },
+    /* state 114: 110110011 */
+    { 0, 0x4, 0x3e }, { 3, 0x2, 0x3e }, { 7, 0x2, 0x3e }, { 10, 0x2, 0x3e },
+    { 14, 0x2, 0x3e }, { 21, 0x2, 0x3e }, { 38, 0x2, 0x3e }, { 137, 0x3, 0x3e },
+    { 0, 0x4, 0x40 }, { 3, 0x2, 0x40 }, { 7, 0x2, 0x40 }, { 10, 0x2, 0x40 },
+    { 14, 0x2, 0x40 }, { 21, 0x2, 0x40 }, { 38, 0x2, 0x40 }, { 137, 0x3, 0x40 },
+    /* state 115: 1101101 */
+    { 1, 0x2, 0x41 }, { 12, 0x3, 0x41 }, { 1, 0x2, 0x4a }, { 12, 0x3, 0x4a },
+    { 1, 0x2, 0x4b }, { 12, 0x3, 0x4b }, { 1, 0x2, 0x4e }, { 12, 0x3, 0x4e },
+    { 1, 0x2, 0x4f }, { 12, 0x3, 0x4f }, { 1, 0x2, 0x51 }, { 12, 0x3, 0x51 },
+    { 1, 0x2, 0x52 }, { 12, 0x3, 0x52 }, { 1, 0x2, 0x53 }, { 12, 0x3, 0x53 },
+    /* state 116: 11011010 */
+    { 2, 0x2, 0x41 }, { 6, 0x2, 0x41 }, { 13, 0x2, 0x41 }, { 37, 0x3, 0x41 },
+    { 2, 0x2, 0x4a }, { 6, 0x2, 0x4a }, { 13, 0x2, 0x4a }, { 37, 0x3, 0x4a },
+    { 2, 0x2, 0x4b }, { 6, 0x2, 0x4b }, { 13, 0x2, 0x4b }, { 37, 0x3, 0x4b },
+    { 2, 0x2, 0x4e }, { 6, 0x2, 0x4e }, { 13, 0x2, 0x4e }, { 37, 0x3, 0x4e },
+    /* state 117: 110110100 */
+    { 0, 0x4, 0x41 }, { 3, 0x2, 0x41 }, { 7, 0x2, 0x41 }, { 10, 0x2, 0x41 },
+    { 14, 0x2, 0x41 }, { 21, 0x2, 0x41 }, { 38, 0x2, 0x41 }, { 137, 0x3, 0x41 },
+    { 0, 0x4, 0x4a }, { 3, 0x2, 0x4a }, { 7, 0x2, 0x4a }, { 10, 0x2, 0x4a },
+    { 14, 0x2, 0x4a }, { 21, 0x2, 0x4a }, { 38, 0x2, 0x4a }, { 137, 0x3, 0x4a },
+    /* state 118: 110110101 */
+    { 0, 0x4, 0x4b }, { 3, 0x2, 0x4b }, { 7, 0x2, 0x4b }, { 10, 0x2, 0x4b },
+    { 14, 0x2, 0x4b }, { 21, 0x2, 0x4b }, { 38, 0x2, 0x4b }, { 137, 0x3, 0x4b },
+    { 0, 0x4, 0x4e }, { 3, 0x2, 0x4e }, { 7, 0x2, 0x4e }, { 10, 0x2, 0x4e },
+    { 14, 0x2, 0x4e }, { 21, 0x2, 0x4e }, { 38, 0x2, 0x4e }, { 137, 0x3, 0x4e },
+    /* state 119: 11011011 */
+    { 2, 0x2, 0x4f }, { 6, 0x2, 0x4f }, { 13, 0x2, 0x4f }, { 37, 0x3, 0x4f },
+    { 2, 0x2, 0x51 }, { 6, 0x2, 0x51 }, { 13, 0x2, 0x51 }, { 37, 0x3, 0x51 },
+    { 2, 0x2, 0x52 }, { 6, 0x2, 0x52 }, { 13, 0x2, 0x52 }, { 37, 0x3, 0x52 },
+    { 2, 0x2, 0x53 }, { 6, 0x2, 0x53 }, { 13, 0x2, 0x53 }, { 37, 0x3, 0x53 },
+    /* state 120: 110110110 */
+    { 0, 0x4, 0x4f }, { 3, 0x2, 0x4f }, { 7, 0x2, 0x4f }, { 10, 0x2, 0x4f },
+    { 14, 0x2, 0x4f }, { 21, 0x2, 0x4f }, { 38, 0x2, 0x4f }, { 137, 0x3, 0x4f },
+    { 0, 0x4, 0x51 }, { 3, 0x2, 0x51 }, { 7, 0x2, 0x51 }, { 10, 0x2, 0x51 },
+    { 14, 0x2, 0x51 }, { 21, 0x2, 0x51 }, { 38, 0x2, 0x51 }, { 137, 0x3, 0x51 },
+    /* state 121: 110110111 */
+    { 0, 0x4, 0x52 }, { 3, 0x2, 0x52 }, { 7, 0x2, 0x52 }, { 10, 0x2, 0x52 },
+    { 14, 0x2, 0x52 }, { 21, 0x2, 0x52 }, { 38, 0x2, 0x52 }, { 137, 0x3, 0x52 },
+    { 0, 0x4, 0x53 }, { 3, 0x2, 0x53 }, { 7, 0x2, 0x53 }, { 10, 0x2, 0x53 },
+    { 14, 0x2, 0x53 }, { 21, 0x2, 0x53 }, { 38, 0x2, 0x53 }, { 137, 0x3, 0x53 },
+    /* state 122: 110111 */
+    { 0, 0x3, 0x55 }, { 0, 0x3, 0x58 }, { 0, 0x3, 0x5a }, { 0, 0x3, 0x5b },
+    { 0, 0x3, 0x5c }, { 0, 0x3, 0x5d }, { 0, 0x3, 0x5e }, { 0, 0x3, 0x5f },
+    { 0, 0x3, 0x60 }, { 0, 0x3, 0x7a }, { 0, 0x3, 0x7b }, { 0, 0x3, 0x7c },
+    { 0, 0x3, 0x7d }, { 0, 0x3, 0x7e }, { 0, 0x3, 0x7f }, { 0, 0x3, 0x80 },
+    /* state 123: 1101110 */
+    { 1, 0x2, 0x55 }, { 12, 0x3, 0x55 }, { 1, 0x2, 0x58 }, { 12, 0x3, 0x58 },
+    { 1, 0x2, 0x5a }, { 12, 0x3, 0x5a }, { 1, 0x2, 0x5b }, { 12, 0x3, 0x5b },
+    { 1, 0x2, 0x5c }, { 12, 0x3, 0x5c }, { 1, 0x2, 0x5d }, { 12, 0x3, 0x5d },
+    { 1, 0x2, 0x5e }, { 12, 0x3, 0x5e }, { 1, 0x2, 0x5f }, { 12, 0x3, 0x5f },
+    /* state 124: 11011100 */
+    { 2, 0x2, 0x55 }, { 6, 0x2, 0x55 }, { 13, 0x2, 0x55 }, { 37, 0x3, 0x55 },
+    { 2, 0x2, 0x58 }, { 6, 0x2, 0x58 }, { 13, 0x2, 0x58 }, { 37, 0x3, 0x58 },
+    { 2, 0x2, 0x5a }, { 6, 0x2, 0x5a }, { 13, 0x2, 0x5a }, { 37, 0x3, 0x5a },
+    { 2, 0x2, 0x5b }, { 6, 0x2, 0x5b }, { 13, 0x2, 0x5b }, { 37, 0x3, 0x5b },
+    /* state 125: 110111000 */
+    { 0, 0x4, 0x55 }, { 3, 0x2, 0x55 }, { 7, 0x2, 0x55 }, { 10, 0x2, 0x55 },
+    { 14, 0x2, 0x55 }, { 21, 0x2, 0x55 }, { 38, 0x2, 0x55 }, { 137, 0x3, 0x55 },
+    { 0, 0x4, 0x58 }, { 3, 0x2, 0x58 }, { 7, 0x2, 0x58 }, { 10, 0x2, 0x58 },
+    { 14, 0x2, 0x58 }, { 21, 0x2, 0x58 }, { 38, 0x2, 0x58 }, { 137, 0x3, 0x58 },
+    /* state 126: 110111001 */
+    { 0, 0x4, 0x5a }, { 3, 0x2, 0x5a }, { 7, 0x2, 0x5a }, { 10, 0x2, 0x5a },
+    { 14, 0x2, 0x5a }, { 21, 0x2, 0x5a }, { 38, 0x2, 0x5a }, { 137, 0x3, 0x5a },
+    { 0, 0x4, 0x5b }, { 3, 0x2, 0x5b }, { 7, 0x2, 0x5b }, { 10, 0x2, 0x5b },
+    { 14, 0x2, 0x5b }, { 21, 0x2, 0x5b }, { 38, 0x2, 0x5b }, { 137, 0x3, 0x5b },
+    /* state 127: 11011101 */
+    { 2, 0x2, 0x5c }, { 6, 0x2, 0x5c }, { 13, 0x2, 0x5c }, { 37, 0x3, 0x5c },
+    { 2, 0x2, 0x5d }, { 6, 0x2, 0x5d }, { 13, 0x2, 0x5d }, { 37, 0x3, 0x5d },
+    { 2, 0x2, 0x5e }, { 6, 0x2, 0x5e }, { 13, 0x2, 0x5e }, { 37, 0x3, 0x5e },
+    { 2, 0x2, 0x5f }, { 6, 0x2, 0x5f }, { 13, 0x2, 0x5f }, { 37, 0x3, 0x5f },
+    /* state 128: 110111010 */
+    { 0, 0x4, 0x5c }, { 3, 0x2, 0x5c }, { 7, 0x2, 0x5c }, { 10, 0x2, 0x5c },
+    { 14, 0x2, 0x5c }, { 21, 0x2, 0x5c }, { 38, 0x2, 0x5c }, { 137, 0x3, 0x5c },
+    { 0, 0x4, 0x5d }, { 3, 0x2, 0x5d }, { 7, 0x2, 0x5d }, { 10, 0x2, 0x5d },
+    { 14, 0x2, 0x5d }, { 21, 0x2, 0x5d }, { 38, 0x2, 0x5d }, { 137, 0x3, 0x5d },
+    /* state 129: 110111011 */
+    { 0, 0x4, 0x5e }, { 3, 0x2, 0x5e }, { 7, 0x2, 0x5e }, { 10, 0x2, 0x5e },
+    { 14, 0x2, 0x5e }, { 21, 0x2, 0x5e }, { 38, 0x2, 0x5e }, { 137, 0x3, 0x5e },
+    { 0, 0x4, 0x5f }, { 3, 0x2, 0x5f }, { 7, 0x2, 0x5f }, { 10, 0x2, 0x5f },
+    { 14, 0x2, 0x5f }, { 21, 0x2, 0x5f }, { 38, 0x2, 0x5f }, { 137, 0x3, 0x5f },
+    /* state 130: 1101111 */
+    { 1, 0x2, 0x60 }, { 12, 0x3, 0x60 }, { 1, 0x2, 0x7a }, { 12, 0x3, 0x7a },
+    { 1, 0x2, 0x7b }, { 12, 0x3, 0x7b }, { 1, 0x2, 0x7c }, { 12, 0x3, 0x7c },
+    { 1, 0x2, 0x7d }, { 12, 0x3, 0x7d }, { 1, 0x2, 0x7e }, { 12, 0x3, 0x7e },
+    { 1, 0x2, 0x7f }, { 12, 0x3, 0x7f }, { 1, 0x2, 0x80 }, { 12, 0x3, 0x80 },
+    /* state 131: 11011110 */
+    { 2, 0x2, 0x60 }, { 6, 0x2, 0x60 }, { 13, 0x2, 0x60 }, { 37, 0x3, 0x60 },
+    { 2, 0x2, 0x7a }, { 6, 0x2, 0x7a }, { 13, 0x2, 0x7a }, { 37, 0x3, 0x7a },
+    { 2, 0x2, 0x7b }, { 6, 0x2, 0x7b }, { 13, 0x2, 0x7b }, { 37, 0x3, 0x7b },
+    { 2, 0x2, 0x7c }, { 6, 0x2, 0x7c }, { 13, 0x2, 0x7c }, { 37, 0x3, 0x7c },
+    /* state 132: 110111100 */
+    { 0, 0x4, 0x60 }, { 3, 0x2, 0x60 }, { 7, 0x2, 0x60 }, { 10, 0x2, 0x60 },
+    { 14, 0x2, 0x60 }, { 21, 0x2, 0x60 }, { 38, 0x2, 0x60 }, { 137, 0x3, 0x60 },
+    { 0, 0x4, 0x7a }, { 3, 0x2, 0x7a }, { 7, 0x2, 0x7a }, { 10, 0x2, 0x7a },
+    { 14, 0x2, 0x7a }, { 21, 0x2, 0x7a }, { 38, 0x2, 0x7a }, { 137, 0x3, 0x7a },
+    /* state 133: 110111101 */
+    { 0, 0x4, 0x7b }, { 3, 0x2, 0x7b }, { 7, 0x2, 0x7b }, { 10, 0x2, 0x7b },
+    { 14, 0x2, 0x7b }, { 21, 0x2, 0x7b }, { 38, 0x2, 0x7b }, { 137, 0x3, 0x7b },
+    { 0, 0x4, 0x7c }, { 3, 0x2, 0x7c }, { 7, 0x2, 0x7c }, { 10, 0x2, 0x7c },
+    { 14, 0x2, 0x7c }, { 21, 0x2, 0x7c }, { 38, 0x2, 0x7c }, { 137, 0x3, 0x7c },
+    /* state 134: 11011111 */
+    { 2, 0x2, 0x7d }, { 6, 0x2, 0x7d }, { 13, 0x2, 0x7d }, { 37, 0x3, 0x7d },
+    { 2, 0x2, 0x7e }, { 6, 0x2, 0x7e }, { 13, 0x2, 0x7e }, { 37, 0x3, 0x7e },
+    { 2, 0x2, 0x7f }, { 6, 0x2, 0x7f }, { 13, 0x2, 0x7f }, { 37, 0x3, 0x7f },
+    { 2, 0x2, 0x80 }, { 6, 0x2, 0x80 }, { 13, 0x2, 0x80 }, { 37, 0x3, 0x80 },
+    /* state 135: 110111110 */
+    { 0, 0x4, 0x7d }, { 3, 0x2, 0x7d }, { 7, 0x2, 0x7d }, { 10, 0x2, 0x7d },
+    { 14, 0x2, 0x7d }, { 21, 0x2, 0x7d }, { 38, 0x2, 0x7d }, { 137, 0x3, 0x7d },
+    { 0, 0x4, 0x7e }, { 3, 0x2, 0x7e }, { 7, 0x2, 0x7e }, { 10, 0x2, 0x7e },
+    { 14, 0x2, 0x7e }, { 21, 0x2, 0x7e }, { 38, 0x2, 0x7e }, { 137, 0x3, 0x7e },
+    /* state 136: 110111111 */
+    { 0, 0x4, 0x7f }, { 3, 0x2, 0x7f }, { 7, 0x2, 0x7f }, { 10, 0x2, 0x7f },
+    { 14, 0x2, 0x7f }, { 21, 0x2, 0x7f }, { 38, 0x2, 0x7f }, { 137, 0x3, 0x7f },
+    { 0, 0x4, 0x80 }, { 3, 0x2, 0x80 }, { 7, 0x2, 0x80 }, { 10, 0x2, 0x80 },
+    { 14, 0x2, 0x80 }, { 21, 0x2, 0x80 }, { 38, 0x2, 0x80 }, { 137, 0x3, 0x80 },
+    /* state 137: 111 */
+    { 141, 0x0, 0x0 }, { 148, 0x0, 0x0 }, { 156, 0x0, 0x0 }, { 163, 0x0, 0x0 },
+    { 172, 0x0, 0x0 }, { 179, 0x0, 0x0 }, { 187, 0x0, 0x0 }, { 194, 0x0, 0x0 },
+    { 204, 0x0, 0x0 }, { 211, 0x0, 0x0 }, { 219, 0x0, 0x0 }, { 226, 0x0, 0x0 },
+    { 235, 0x0, 0x0 }, { 242, 0x0, 0x0 }, { 250, 0x0, 0x0 }, { 257, 0x1, 0x0 },
+    /* state 138: 1110 */
+    { 142, 0x0, 0x0 }, { 145, 0x0, 0x0 }, { 149, 0x0, 0x0 }, { 152, 0x0, 0x0 },
+    { 157, 0x0, 0x0 }, { 160, 0x0, 0x0 }, { 164, 0x0, 0x0 }, { 167, 0x0, 0x0 },
+    { 173, 0x0, 0x0 }, { 176, 0x0, 0x0 }, { 180, 0x0, 0x0 }, { 183, 0x0, 0x0 },
+    { 188, 0x0, 0x0 }, { 191, 0x0, 0x0 }, { 195, 0x0, 0x0 }, { 198, 0x0, 0x0 },
+    /* state 139: 11100 */
+    { 143, 0x0, 0x0 }, { 144, 0x0, 0x0 }, { 146, 0x0, 0x0 }, { 147, 0x0, 0x0 },
+    { 150, 0x0, 0x0 }, { 151, 0x0, 0x0 }, { 153, 0x0, 0x0 }, { 154, 0x0, 0x0 },
+    { 158, 0x0, 0x0 }, { 159, 0x0, 0x0 }, { 161, 0x0, 0x0 }, { 162, 0x0, 0x0 },
+    { 165, 0x0, 0x0 }, { 166, 0x0, 0x0 }, { 168, 0x0, 0x0 }, { 169, 0x0, 0x0 },
+    /* state 140: 111000 */
+    { 0, 0x3, 0x81 }, { 0, 0x3, 0x82 }, { 0, 0x3, 0x83 }, { 0, 0x3, 0x84 },
+    { 0, 0x3, 0x85 }, { 0, 0x3, 0x86 }, { 0, 0x3, 0x87 }, { 0, 0x3, 0x88 },
+    { 0, 0x3, 0x89 }, { 0, 0x3, 0x8a }, { 0, 0x3, 0x8b }, { 0, 0x3, 0x8c },
+    { 0, 0x3, 0x8d }, { 0, 0x3, 0x8e }, { 0, 0x3, 0x8f }, { 0, 0x3, 0x90 },
+    /* state 141: 1110000 */
+    { 1, 0x2, 0x81 }, { 12, 0x3, 0x81 }, { 1, 0x2, 0x82 }, { 12, 0x3, 0x82 },
+    { 1, 0x2, 0x83 }, { 12, 0x3, 0x83 }, { 1, 0x2, 0x84 }, { 12, 0x3, 0x84 },
+    { 1, 0x2, 0x85 }, { 12, 0x3, 0x85 }, { 1, 0x2, 0x86 }, { 12, 0x3, 0x86 },
+    { 1, 0x2, 0x87 }, { 12, 0x3, 0x87 }, { 1, 0x2, 0x88 }, { 12, 0x3, 0x88 },
+    /* state 142: 11100000 */
+    { 2, 0x2, 0x81 }, { 6, 0x2, 0x81 }, { 13, 0x2, 0x81 }, { 37, 0x3, 0x81 },
+    { 2, 0x2, 0x82 }, { 6, 0x2, 0x82 }, { 13, 0x2, 0x82 }, { 37, 0x3, 0x82 },
+    { 2, 0x2, 0x83 }, { 6, 0x2, 0x83 }, { 13, 0x2, 0x83 }, { 37, 0x3, 0x83 },
+    { 2, 0x2, 0x84 }, { 6, 0x2, 0x84 }, { 13, 0x2, 0x84 }, { 37, 0x3, 0x84 },
+    /* state 143: 111000000 */
+    { 0, 0x4, 0x81 }, { 3, 0x2, 0x81 }, { 7, 0x2, 0x81 }, { 10, 0x2, 0x81 },
+    { 14, 0x2, 0x81 }, { 21, 0x2, 0x81 }, { 38, 0x2, 0x81 }, { 137, 0x3, 0x81 },
+    { 0, 0x4, 0x82 }, { 3, 0x2, 0x82 }, { 7, 0x2, 0x82 }, { 10, 0x2, 0x82 },
+    { 14, 0x2, 0x82 }, { 21, 0x2, 0x82 }, { 38, 0x2, 0x82 }, { 137, 0x3, 0x82 },
+    /* state 144: 111000001 */
+    { 0, 0x4, 0x83 }, { 3, 0x2, 0x83 }, { 7, 0x2, 0x83 }, { 10, 0x2, 0x83 },
+    { 14, 0x2, 0x83 }, { 21, 0x2, 0x83 }, { 38, 0x2, 0x83 }, { 137, 0x3, 0x83 },
+    { 0, 0x4, 0x84 }, { 3, 0x2, 0x84 }, { 7, 0x2, 0x84 }, { 10, 0x2, 0x84 },
+    { 14, 0x2, 0x84 }, { 21, 0x2, 0x84 }, { 38, 0x2, 0x84 }, { 137, 0x3, 0x84 },
+    /* state 145: 11100001 */
+    { 2, 0x2, 0x85 }, { 6, 0x2, 0x85 }, { 13, 0x2, 0x85 }, { 37, 0x3, 0x85 },
+    { 2, 0x2, 0x86 }, { 6, 0x2, 0x86 }, { 13, 0x2, 0x86 }, { 37, 0x3, 0x86 },
+    { 2, 0x2, 0x87 }, { 6, 0x2, 0x87 }, { 13, 0x2, 0x87 }, { 37, 0x3, 0x87 },
+    { 2, 0x2, 0x88 }, { 6, 0x2, 0x88 }, { 13, 0x2, 0x88 }, { 37, 0x3, 0x88 },
+    /* state 146: 111000010 */
+    { 0, 0x4, 0x85 }, { 3, 0x2, 0x85 }, { 7, 0x2, 0x85 }, { 10, 0x2, 0x85 },
+    { 14, 0x2, 0x85 }, { 21, 0x2, 0x85 }, { 38, 0x2, 0x85 }, { 137, 0x3, 0x85 },
+    { 0, 0x4, 0x86 }, { 3, 0x2, 0x86 }, { 7, 0x2, 0x86 }, { 10, 0x2, 0x86 },
+    { 14, 0x2, 0x86 }, { 21, 0x2, 0x86 }, { 38, 0x2, 0x86 }, { 137, 0x3, 0x86 },
+    /* state 147: 111000011 */
+    { 0, 0x4, 0x87 }, { 3, 0x2, 0x87 }, { 7, 0x2, 0x87 }, { 10, 0x2, 0x87 },
+    { 14, 0x2, 0x87 }, { 21, 0x2, 0x87 }, { 38, 0x2, 0x87 }, { 137, 0x3, 0x87 },
+    { 0, 0x4, 0x88 }, { 3, 0x2, 0x88 }, { 7, 0x2, 0x88 }, { 10, 0x2, 0x88 },
+    { 14, 0x2, 0x88 }, { 21, 0x2, 0x88 }, { 38, 0x2, 0x88 }, { 137, 0x3, 0x88 },
+    /* state 148: 1110001 */
+    { 1, 0x2, 0x89 }, { 12, 0x3, 0x89 }, { 1, 0x2, 0x8a }, { 12, 0x3, 0x8a },
+    { 1, 0x2, 0x8b }, { 12, 0x3, 0x8b }, { 1, 0x2, 0x8c }, { 12, 0x3, 0x8c },
+    { 1, 0x2, 0x8d }, { 12, 0x3, 0x8d }, { 1, 0x2, 0x8e }, { 12, 0x3, 0x8e },
+    { 1, 0x2, 0x8f }, { 12, 0x3, 0x8f }, { 1, 0x2, 0x90 }, { 12, 0x3, 0x90 },
+    /* state 149: 11100010 */
+    { 2, 0x2, 0x89 }, { 6, 0x2, 0x89 }, { 13, 0x2, 0x89 }, { 37, 0x3, 0x89 },
+    { 2, 0x2, 0x8a }, { 6, 0x2, 0x8a }, { 13, 0x2, 0x8a }, { 37, 0x3, 0x8a },
+    { 2, 0x2, 0x8b }, { 6, 0x2, 0x8b }, { 13, 0x2, 0x8b }, { 37, 0x3, 0x8b },
+    { 2, 0x2, 0x8c }, { 6, 0x2, 0x8c }, { 13, 0x2, 0x8c }, { 37, 0x3, 0x8c },
+    /* state 150: 111000100 */
+    { 0, 0x4, 0x89 }, { 3, 0x2, 0x89 }, { 7, 0x2, 0x89 }, { 10, 0x2, 0x89 },
+    { 14, 0x2, 0x89 }, { 21, 0x2, 0x89 }, { 38, 0x2, 0x89 }, { 137, 0x3, 0x89 },
+    { 0, 0x4, 0x8a }, { 3, 0x2, 0x8a }, { 7, 0x2, 0x8a }, { 10, 0x2, 0x8a },
+    { 14, 0x2, 0x8a }, { 21, 0x2, 0x8a }, { 38, 0x2, 0x8a }, { 137, 0x3, 0x8a },
+    /* state 151: 111000101 */
+    { 0, 0x4, 0x8b }, { 3, 0x2, 0x8b }, { 7, 0x2, 0x8b }, { 10, 0x2, 0x8b },
+    { 14, 0x2, 0x8b }, { 21, 0x2, 0x8b }, { 38, 0x2, 0x8b }, { 137, 0x3, 0x8b },
+    { 0, 0x4, 0x8c }, { 3, 0x2, 0x8c }, { 7, 0x2, 0x8c }, { 10, 0x2, 0x8c },
+    { 14, 0x2, 0x8c }, { 21, 0x2, 0x8c }, { 38, 0x2, 0x8c }, { 137, 0x3, 0x8c },
+    /* state 152: 11100011 */
+    { 2, 0x2, 0x8d }, { 6, 0x2, 0x8d }, { 13, 0x2, 0x8d }, { 37, 0x3, 0x8d },
+    { 2, 0x2, 0x8e }, { 6, 0x2, 0x8e }, { 13, 0x2, 0x8e }, { 37, 0x3, 0x8e },
+    { 2, 0x2, 0x8f }, { 6, 0x2, 0x8f }, { 13, 0x2, 0x8f }, { 37, 0x3, 0x8f },
+    { 2, 0x2, 0x90 }, { 6, 0x2, 0x90 }, { 13, 0x2, 0x90 }, { 37, 0x3, 0x90 },
+    /* state 153: 111000110 */
+    { 0, 0x4, 0x8d }, { 3, 0x2, 0x8d }, { 7, 0x2, 0x8d }, { 10, 0x2, 0x8d },
+    { 14, 0x2, 0x8d }, { 21, 0x2, 0x8d }, { 38, 0x2, 0x8d }, { 137, 0x3, 0x8d },
+    { 0, 0x4, 0x8e }, { 3, 0x2, 0x8e }, { 7, 0x2, 0x8e }, { 10, 0x2, 0x8e },
+    { 14, 0x2, 0x8e }, { 21, 0x2, 0x8e }, { 38, 0x2, 0x8e }, { 137, 0x3, 0x8e },
+    /* state 154: 111000111 */
+    { 0, 0x4, 0x8f }, { 3, 0x2, 0x8f }, { 7, 0x2, 0x8f }, { 10, 0x2, 0x8f },
+    { 14, 0x2, 0x8f }, { 21, 0x2, 0x8f }, { 38, 0x2, 0x8f }, { 137, 0x3, 0x8f },
+    { 0, 0x4, 0x90 }, { 3, 0x2, 0x90 }, { 7, 0x2, 0x90 }, { 10, 0x2, 0x90 },
+    { 14, 0x2, 0x90 }, { 21, 0x2, 0x90 }, { 38, 0x2, 0x90 }, { 137, 0x3, 0x90 },
+    /* state 155: 111001 */
+    { 0, 0x3, 0x91 }, { 0, 0x3, 0x92 }, { 0, 0x3, 0x93 }, { 0, 0x3, 0x94 },
+    { 0, 0x3, 0x95 }, { 0, 0x3, 0x96 }, { 0, 0x3, 0x97 }, { 0, 0x3, 0x98 },
+    { 0, 0x3, 0x99 }, { 0, 0x3, 0x9a }, { 0, 0x3, 0x9b }, { 0, 0x3, 0x9c },
+    { 0, 0x3, 0x9d }, { 0, 0x3, 0x9e }, { 0, 0x3, 0x9f }, { 0, 0x3, 0xa0 },
+    /* state 156: 1110010 */
+    { 1, 0x2, 0x91 }, { 12, 0x3, 0x91 }, { 1, 0x2, 0x92 }, { 12, 0x3, 0x92 },
+    { 1, 0x2, 0x93 }, { 12, 0x3, 0x93 }, { 1, 0x2, 0x94 }, { 12, 0x3, 0x94 },
+    { 1, 0x2, 0x95 }, { 12, 0x3, 0x95 }, { 1, 0x2, 0x96 }, { 12, 0x3, 0x96 },
+    { 1, 0x2, 0x97 }, { 12, 0x3, 0x97 }, { 1, 0x2, 0x98 }, { 12, 0x3, 0x98 },
+    /* state 157: 11100100 */
+    { 2, 0x2, 0x91 }, { 6, 0x2, 0x91 }, { 13, 0x2, 0x91 }, { 37, 0x3, 0x91 },
+    { 2, 0x2, 0x92 }, { 6, 0x2, 0x92 }, { 13, 0x2, 0x92 }, { 37, 0x3, 0x92 },
+    { 2, 0x2, 0x93 }, { 6, 0x2, 0x93 }, { 13, 0x2, 0x93 }, { 37, 0x3, 0x93 },
+    { 2, 0x2, 0x94 }, { 6, 0x2, 0x94 }, { 13, 0x2, 0x94 }, { 37, 0x3, 0x94 },
+    /* state 158: 111001000 */
+    { 0, 0x4, 0x91 }, { 3, 0x2, 0x91 }, { 7, 0x2, 0x91 }, { 10, 0x2, 0x91 },
+    { 14, 0x2, 0x91 }, { 21, 0x2, 0x91 }, { 38, 0x2, 0x91 }, { 137, 0x3, 0x91 },
+    { 0, 0x4, 0x92 }, { 3, 0x2, 0x92 }, { 7, 0x2, 0x92 }, { 10, 0x2, 0x92 },
+    { 14, 0x2, 0x92 }, { 21, 0x2, 0x92 }, { 38, 0x2, 0x92 }, { 137, 0x3, 0x92 },
+    /* state 159: 111001001 */
+    { 0, 0x4, 0x93 }, { 3, 0x2, 0x93 }, { 7, 0x2, 0x93 }, { 10, 0x2, 0x93 },
+    { 14, 0x2, 0x93 }, { 21, 0x2, 0x93 }, { 38, 0x2, 0x93 }, { 137, 0x3, 0x93 },
+    { 0, 0x4, 0x94 }, { 3, 0x2, 0x94 }, { 7, 0x2, 0x94 }, { 10, 0x2, 0x94 },
+    { 14, 0x2, 0x94 }, { 21, 0x2, 0x94 }, { 38, 0x2, 0x94 }, { 137, 0x3, 0x94 },
+    /* state 160: 11100101 */
+    { 2, 0x2, 0x95 }, { 6, 0x2, 0x95 }, { 13, 0x2, 0x95 }, { 37, 0x3, 0x95 },
+    { 2, 0x2, 0x96 }, { 6, 0x2, 0x96 }, { 13, 0x2, 0x96 }, { 37, 0x3, 0x96 },
+    { 2, 0x2, 0x97 }, { 6, 0x2, 0x97 }, { 13, 0x2, 0x97 }, { 37, 0x3, 0x97 },
+    { 2, 0x2, 0x98 }, { 6, 0x2, 0x98 }, { 13, 0x2, 0x98 }, { 37, 0x3, 0x98 },
+    /* state 161: 111001010 */
+    { 0, 0x4, 0x95 }, { 3, 0x2, 0x95 }, { 7, 0x2, 0x95 }, { 10, 0x2, 0x95 },
+    { 14, 0x2, 0x95 }, { 21, 0x2, 0x95 }, { 38, 0x2, 0x95 }, { 137, 0x3, 0x95 },
+    { 0, 0x4, 0x96 }, { 3, 0x2, 0x96 }, { 7, 0x2, 0x96 }, { 10, 0x2, 0x96 },
+    { 14, 0x2, 0x96 }, { 21, 0x2, 0x96 }, { 38, 0x2, 0x96 }, { 137, 0x3, 0x96 },
+    /* state 162: 111001011 */
+    { 0, 0x4, 0x97 }, { 3, 0x2, 0x97 }, { 7, 0x2, 0x97 }, { 10, 0x2, 0x97 },
+    { 14, 0x2, 0x97 }, { 21, 0x2, 0x97 }, { 38, 0x2, 0x97 }, { 137, 0x3, 0x97 },
+    { 0, 0x4, 0x98 }, { 3, 0x2, 0x98 }, { 7, 0x2, 0x98 }, { 10, 0x2, 0x98 },
+    { 14, 0x2, 0x98 }, { 21, 0x2, 0x98 }, { 38, 0x2, 0x98 }, { 137, 0x3, 0x98 },
+    /* state 163: 1110011 */
+    { 1, 0x2, 0x99 }, { 12, 0x3, 0x99 }, { 1, 0x2, 0x9a }, { 12, 0x3, 0x9a },
+    { 1, 0x2, 0x9b }, { 12, 0x3, 0x9b }, { 1, 0x2, 0x9c }, { 12, 0x3, 0x9c },
+    { 1, 0x2, 0x9d }, { 12, 0x3, 0x9d }, { 1, 0x2, 0x9e }, { 12, 0x3, 0x9e },
+    { 1, 0x2, 0x9f }, { 12, 0x3, 0x9f }, { 1, 0x2, 0xa0 }, { 12, 0x3, 0xa0 },
+    /* state 164: 11100110 */
+    { 2, 0x2, 0x99 }, { 6, 0x2, 0x99 }, { 13, 0x2, 0x99 }, { 37, 0x3, 0x99 },
+    { 2, 0x2, 0x9a }, { 6, 0x2, 0x9a }, { 13, 0x2, 0x9a }, { 37, 0x3, 0x9a },
+    { 2, 0x2, 0x9b }, { 6, 0x2, 0x9b }, { 13, 0x2, 0x9b }, { 37, 0x3, 0x9b },
+    { 2, 0x2, 0x9c }, { 6, 0x2, 0x9c }, { 13, 0x2, 0x9c }, { 37, 0x3, 0x9c },
+    /* state 165: 111001100 */
+    { 0, 0x4, 0x99 }, { 3, 0x2, 0x99 }, { 7, 0x2, 0x99 }, { 10, 0x2, 0x99 },
+    { 14, 0x2, 0x99 }, { 21, 0x2, 0x99 }, { 38, 0x2, 0x99 }, { 137, 0x3, 0x99 },
+    { 0, 0x4, 0x9a }, { 3, 0x2, 0x9a }, { 7, 0x2, 0x9a }, { 10, 0x2, 0x9a },
+    { 14, 0x2, 0x9a }, { 21, 0x2, 0x9a }, { 38, 0x2, 0x9a }, { 137, 0x3, 0x9a },
+    /* state 166: 111001101 */
+    { 0, 0x4, 0x9b }, { 3, 0x2, 0x9b }, { 7, 0x2, 0x9b }, { 10, 0x2, 0x9b },
+    { 14, 0x2, 0x9b }, { 21, 0x2, 0x9b }, { 38, 0x2, 0x9b }, { 137, 0x3, 0x9b },
+    { 0, 0x4, 0x9c }, { 3, 0x2, 0x9c }, { 7, 0x2, 0x9c }, { 10, 0x2, 0x9c },
+    { 14, 0x2, 0x9c }, { 21, 0x2, 0x9c }, { 38, 0x2, 0x9c }, { 137, 0x3, 0x9c },
+    /* state 167: 11100111 */
+    { 2, 0x2, 0x9d }, { 6, 0x2, 0x9d }, { 13, 0x2, 0x9d }, { 37, 0x3, 0x9d },
+    { 2, 0x2, 0x9e }, { 6, 0x2, 0x9e }, { 13, 0x2, 0x9e }, { 37, 0x3, 0x9e },
+    { 2, 0x2, 0x9f }, { 6, 0x2, 0x9f }, { 13, 0x2, 0x9f }, { 37, 0x3, 0x9f },
+    { 2, 0x2, 0xa0 }, { 6, 0x2, 0xa0 }, { 13, 0x2, 0xa0 }, { 37, 0x3, 0xa0 },
+    /* state 168: 111001110 */
+    { 0, 0x4, 0x9d }, { 3, 0x2, 0x9d }, { 7, 0x2, 0x9d }, { 10, 0x2, 0x9d },
+    { 14, 0x2, 0x9d }, { 21, 0x2, 0x9d }, { 38, 0x2, 0x9d }, { 137, 0x3, 0x9d },
+    { 0, 0x4, 0x9e }, { 3, 0x2, 0x9e }, { 7, 0x2, 0x9e }, { 10, 0x2, 0x9e },
+    { 14, 0x2, 0x9e }, { 21, 0x2, 0x9e }, { 38, 0x2, 0x9e }, { 137, 0x3, 0x9e },
+    /* state 169: 111001111 */
+    { 0, 0x4, 0x9f }, { 3, 0x2, 0x9f }, { 7, 0x2, 0x9f }, { 10, 0x2, 0x9f },
+    { 14, 0x2, 0x9f }, { 21, 0x2, 0x9f }, { 38, 0x2, 0x9f }, { 137, 0x3, 0x9f },
+    { 0, 0x4, 0xa0 }, { 3, 0x2, 0xa0 }, { 7, 0x2, 0xa0 }, { 10, 0x2, 0xa0 },
+    { 14, 0x2, 0xa0 }, { 21, 0x2, 0xa0 }, { 38, 0x2, 0xa0 }, { 137, 0x3, 0xa0 },
+    /* state 170: 11101 */
+    { 174, 0x0, 0x0 }, { 175, 0x0, 0x0 }, { 177, 0x0, 0x0 }, { 178, 0x0, 0x0 },
+    { 181, 0x0, 0x0 }, { 182, 0x0, 0x0 }, { 184, 0x0, 0x0 }, { 185, 0x0, 0x0 },
+    { 189, 0x0, 0x0 }, { 190, 0x0, 0x0 }, { 192, 0x0, 0x0 }, { 193, 0x0, 0x0 },
+    { 196, 0x0, 0x0 }, { 197, 0x0, 0x0 }, { 199, 0x0, 0x0 }, { 200, 0x0, 0x0 },
+    /* state 171: 111010 */
+    { 0, 0x3, 0xa1 }, { 0, 0x3, 0xa2 }, { 0, 0x3, 0xa3 }, { 0, 0x3, 0xa4 },
+    { 0, 0x3, 0xa5 }, { 0, 0x3, 0xa6 }, { 0, 0x3, 0xa7 }, { 0, 0x3, 0xa8 },
+    { 0, 0x3, 0xa9 }, { 0, 0x3, 0xaa }, { 0, 0x3, 0xab }, { 0, 0x3, 0xac },
+    { 0, 0x3, 0xad }, { 0, 0x3, 0xae }, { 0, 0x3, 0xaf }, { 0, 0x3, 0xb0 },
+    /* state 172: 1110100 */
+    { 1, 0x2, 0xa1 }, { 12, 0x3, 0xa1 }, { 1, 0x2, 0xa2 }, { 12, 0x3, 0xa2 },
+    { 1, 0x2, 0xa3 }, { 12, 0x3, 0xa3 }, { 1, 0x2, 0xa4 }, { 12, 0x3, 0xa4 },
+    { 1, 0x2, 0xa5 }, { 12, 0x3, 0xa5 }, { 1, 0x2, 0xa6 }, { 12, 0x3, 0xa6 },
+    { 1, 0x2, 0xa7 }, { 12, 0x3, 0xa7 }, { 1, 0x2, 0xa8 }, { 12, 0x3, 0xa8 },
+    /* state 173: 11101000 */
+    { 2, 0x2, 0xa1 }, { 6, 0x2, 0xa1 }, { 13, 0x2, 0xa1 }, { 37, 0x3, 0xa1 },
+    { 2, 0x2, 0xa2 }, { 6, 0x2, 0xa2 }, { 13, 0x2, 0xa2 }, { 37, 0x3, 0xa2 },
+    { 2, 0x2, 0xa3 }, { 6, 0x2, 0xa3 }, { 13, 0x2, 0xa3 }, { 37, 0x3, 0xa3 },
+    { 2, 0x2, 0xa4 }, { 6, 0x2, 0xa4 }, { 13, 0x2, 0xa4 }, { 37, 0x3, 0xa4 },
+    /* state 174: 111010000 */
+    { 0, 0x4, 0xa1 }, { 3, 0x2, 0xa1 }, { 7, 0x2, 0xa1 }, { 10, 0x2, 0xa1 },
+    { 14, 0x2, 0xa1 }, { 21, 0x2, 0xa1 }, { 38, 0x2, 0xa1 }, { 137, 0x3, 0xa1 },
+    { 0, 0x4, 0xa2 }, { 3, 0x2, 0xa2 }, { 7, 0x2, 0xa2 }, { 10, 0x2, 0xa2 },
+    { 14, 0x2, 0xa2 }, { 21, 0x2, 0xa2 }, { 38, 0x2, 0xa2 }, { 137, 0x3, 0xa2 },
+    /* state 175: 111010001 */
+    { 0, 0x4, 0xa3 }, { 3, 0x2, 0xa3 }, { 7, 0x2, 0xa3 }, { 10, 0x2, 0xa3 },
+    { 14, 0x2, 0xa3 }, { 21, 0x2, 0xa3 }, { 38, 0x2, 0xa3 }, { 137, 0x3, 0xa3 },
+    { 0, 0x4, 0xa4 }, { 3, 0x2, 0xa4 }, { 7, 0x2, 0xa4 }, { 10, 0x2, 0xa4 },
+    { 14, 0x2, 0xa4 }, { 21, 0x2, 0xa4 }, { 38, 0x2, 0xa4 }, { 137, 0x3, 0xa4 },
+    /* state 176: 11101001 */
+    { 2, 0x2, 0xa5 }, { 6, 0x2, 0xa5 }, { 13, 0x2, 0xa5 }, { 37, 0x3, 0xa5 },
+    { 2, 0x2, 0xa6 }, { 6, 0x2, 0xa6 }, { 13, 0x2, 0xa6 }, { 37, 0x3, 0xa6 },
+    { 2, 0x2, 0xa7 }, { 6, 0x2, 0xa7 }, { 13, 0x2, 0xa7 }, { 37, 0x3, 0xa7 },
+    { 2, 0x2, 0xa8 }, { 6, 0x2, 0xa8 }, { 13, 0x2, 0xa8 }, { 37, 0x3, 0xa8 },
+    /* state 177: 111010010 */
+    { 0, 0x4, 0xa5 }, { 3, 0x2, 0xa5 }, { 7, 0x2, 0xa5 }, { 10, 0x2, 0xa5 },
+    { 14, 0x2, 0xa5 }, { 21, 0x2, 0xa5 }, { 38, 0x2, 0xa5 }, { 137, 0x3, 0xa5 },
+    { 0, 0x4, 0xa6 }, { 3, 0x2, 0xa6 }, { 7, 0x2, 0xa6 }, { 10, 0x2, 0xa6 },
+    { 14, 0x2, 0xa6 }, { 21, 0x2, 0xa6 }, { 38, 0x2, 0xa6 }, { 137, 0x3, 0xa6 },
+    /* state 178: 111010011 */
+    { 0, 0x4, 0xa7 }, { 3, 0x2, 0xa7 }, { 7, 0x2, 0xa7 }, { 10, 0x2, 0xa7 },
+    { 14, 0x2, 0xa7 }, { 21, 0x2, 0xa7 }, { 38, 0x2, 0xa7 }, { 137, 0x3, 0xa7 },
+    { 0, 0x4, 0xa8 }, { 3, 0x2, 0xa8 }, { 7, 0x2, 0xa8 }, { 10, 0x2, 0xa8 },
+    { 14, 0x2, 0xa8 }, { 21, 0x2, 0xa8 }, { 38, 0x2, 0xa8 }, { 137, 0x3, 0xa8 },
+    /* state 179: 1110101 */
+    { 1, 0x2, 0xa9 }, { 12, 0x3, 0xa9 }, { 1, 0x2, 0xaa }, { 12, 0x3, 0xaa },
+    { 1, 0x2, 0xab }, { 12, 0x3, 0xab }, { 1, 0x2, 0xac }, { 12, 0x3, 0xac },
+    { 1, 0x2, 0xad }, { 12, 0x3, 0xad }, { 1, 0x2, 0xae }, { 12, 0x3, 0xae },
+    { 1, 0x2, 0xaf }, { 12, 0x3, 0xaf }, { 1, 0x2, 0xb0 }, { 12, 0x3, 0xb0 },
+    /* state 180: 11101010 */
+    { 2, 0x2, 0xa9 }, { 6, 0x2, 0xa9 }, { 13, 0x2, 0xa9 }, { 37, 0x3, 0xa9 },
+    { 2, 0x2, 0xaa }, { 6, 0x2, 0xaa }, { 13, 0x2, 0xaa }, { 37, 0x3, 0xaa },
+    { 2, 0x2, 0xab }, { 6, 0x2, 0xab }, { 13, 0x2, 0xab }, { 37, 0x3, 0xab },
+    { 2, 0x2, 0xac }, { 6, 0x2, 0xac }, { 13, 0x2, 0xac }, { 37, 0x3, 0xac },
+    /* state 181: 111010100 */
+    { 0, 0x4, 0xa9 }, { 3, 0x2, 0xa9 }, { 7, 0x2, 0xa9 }, { 10, 0x2, 0xa9 },
+    { 14, 0x2, 0xa9 }, { 21, 0x2, 0xa9 }, { 38, 0x2, 0xa9 }, { 137, 0x3, 0xa9 },
+    { 0, 0x4, 0xaa }, { 3, 0x2, 0xaa }, { 7, 0x2, 0xaa }, { 10, 0x2, 0xaa },
+    { 14, 0x2, 0xaa }, { 21, 0x2, 0xaa }, { 38, 0x2, 0xaa }, { 137, 0x3, 0xaa },
+    /* state 182: 111010101 */
+    { 0, 0x4, 0xab }, { 3, 0x2, 0xab }, { 7, 0x2, 0xab }, { 10, 0x2, 0xab },
+    { 14, 0x2, 0xab }, { 21, 0x2, 0xab }, { 38, 0x2, 0xab }, { 137, 0x3, 0xab },
+    { 0, 0x4, 0xac }, { 3, 0x2, 0xac }, { 7, 0x2, 0xac }, { 10, 0x2, 0xac },
+    { 14, 0x2, 0xac }, { 21, 0x2, 0xac }, { 38, 0x2, 0xac }, { 137, 0x3, 0xac },
+    /* state 183: 11101011 */
+    { 2, 0x2, 0xad }, { 6, 0x2, 0xad }, { 13, 0x2, 0xad }, { 37, 0x3, 0xad },
+    { 2, 0x2, 0xae }, { 6, 0x2, 0xae }, { 13, 0x2, 0xae }, { 37, 0x3, 0xae },
+    { 2, 0x2, 0xaf }, { 6, 0x2, 0xaf }, { 13, 0x2, 0xaf }, { 37, 0x3, 0xaf },
+    { 2, 0x2, 0xb0 }, { 6, 0x2, 0xb0 }, { 13, 0x2, 0xb0 }, { 37, 0x3, 0xb0 },
+    /* state 184: 111010110 */
+    { 0, 0x4, 0xad }, { 3, 0x2, 0xad }, { 7, 0x2, 0xad }, { 10, 0x2, 0xad },
+    { 14, 0x2, 0xad }, { 21, 0x2, 0xad }, { 38, 0x2, 0xad }, { 137, 0x3, 0xad },
+    { 0, 0x4, 0xae }, { 3, 0x2, 0xae }, { 7, 0x2, 0xae }, { 10, 0x2, 0xae },
+    { 14, 0x2, 0xae }, { 21, 0x2, 0xae }, { 38, 0x2, 0xae }, { 137, 0x3, 0xae },
+    /* state 185: 111010111 */
+    { 0, 0x4, 0xaf }, { 3, 0x2, 0xaf }, { 7, 0x2, 0xaf }, { 10, 0x2, 0xaf },
+    { 14, 0x2, 0xaf }, { 21, 0x2, 0xaf }, { 38, 0x2, 0xaf }, { 137, 0x3, 0xaf },
+    { 0, 0x4, 0xb0 }, { 3, 0x2, 0xb0 }, { 7, 0x2, 0xb0 }, { 10, 0x2, 0xb0 },
+    { 14, 0x2, 0xb0 }, { 21, 0x2, 0xb0 }, { 38, 0x2, 0xb0 }, { 137, 0x3, 0xb0 },
+    /* state 186: 111011 */
+    { 0, 0x3, 0xb1 }, { 0, 0x3, 0xb2 }, { 0, 0x3, 0xb3 }, { 0, 0x3, 0xb4 },
+    { 0, 0x3, 0xb5 }, { 0, 0x3, 0xb6 }, { 0, 0x3, 0xb7 }, { 0, 0x3, 0xb8 },
+    { 0, 0x3, 0xb9 }, { 0, 0x3, 0xba }, { 0, 0x3, 0xbb }, { 0, 0x3, 0xbc },
+    { 0, 0x3, 0xbd }, { 0, 0x3, 0xbe }, { 0, 0x3, 0xbf }, { 0, 0x3, 0xc0 },
+    /* state 187: 1110110 */
+    { 1, 0x2, 0xb1 }, { 12, 0x3, 0xb1 }, { 1, 0x2, 0xb2 }, { 12, 0x3, 0xb2 },
+    { 1, 0x2, 0xb3 }, { 12, 0x3, 0xb3 }, { 1, 0x2, 0xb4 }, { 12, 0x3, 0xb4 },
+    { 1, 0x2, 0xb5 }, { 12, 0x3, 0xb5 }, { 1, 0x2, 0xb6 }, { 12, 0x3, 0xb6 },
+    { 1, 0x2, 0xb7 }, { 12, 0x3, 0xb7 }, { 1, 0x2, 0xb8 }, { 12, 0x3, 0xb8 },
+    /* state 188: 11101100 */
+    { 2, 0x2, 0xb1 }, { 6, 0x2, 0xb1 }, { 13, 0x2, 0xb1 }, { 37, 0x3, 0xb1 },
+    { 2, 0x2, 0xb2 }, { 6, 0x2, 0xb2 }, { 13, 0x2, 0xb2 }, { 37, 0x3, 0xb2 },
+    { 2, 0x2, 0xb3 }, { 6, 0x2, 0xb3 }, { 13, 0x2, 0xb3 }, { 37, 0x3, 0xb3 },
+    { 2, 0x2, 0xb4 }, { 6, 0x2, 0xb4 }, { 13, 0x2, 0xb4 }, { 37, 0x3, 0xb4 },
+    /* state 189: 111011000 */
+    { 0, 0x4, 0xb1 }, { 3, 0x2, 0xb1 }, { 7, 0x2, 0xb1 }, { 10, 0x2, 0xb1 },
+    { 14, 0x2, 0xb1 }, { 21, 0x2, 0xb1 }, { 38, 0x2, 0xb1 }, { 137, 0x3, 0xb1 },
+    { 0, 0x4, 0xb2 }, { 3, 0x2, 0xb2 }, { 7, 0x2, 0xb2 }, { 10, 0x2, 0xb2 },
+    { 14, 0x2, 0xb2 }, { 21, 0x2, 0xb2 }, { 38, 0x2, 0xb2 }, { 137, 0x3, 0xb2 },
+    /* state 190: 111011001 */
+    { 0, 0x4, 0xb3 }, { 3, 0x2, 0xb3 }, { 7, 0x2, 0xb3 }, { 10, 0x2, 0xb3 },
+    { 14, 0x2, 0xb3 }, { 21, 0x2, 0xb3 }, { 38, 0x2, 0xb3 }, { 137, 0x3, 0xb3 },
+    { 0, 0x4, 0xb4 }, { 3, 0x2, 0xb4 }, { 7, 0x2, 0xb4 }, { 10, 0x2, 0xb4 },
+    { 14, 0x2, 0xb4 }, { 21, 0x2, 0xb4 }, { 38, 0x2, 0xb4 }, { 137, 0x3, 0xb4 },
+    /* state 191: 11101101 */
+    { 2, 0x2, 0xb5 }, { 6, 0x2, 0xb5 }, { 13, 0x2, 0xb5 }, { 37, 0x3, 0xb5 },
+    { 2, 0x2, 0xb6 }, { 6, 0x2, 0xb6 }, { 13, 0x2, 0xb6 }, { 37, 0x3, 0xb6 },
+    { 2, 0x2, 0xb7 }, { 6, 0x2, 0xb7 }, { 13, 0x2, 0xb7 }, { 37, 0x3, 0xb7 },
+    { 2, 0x2, 0xb8 }, { 6, 0x2, 0xb8 }, { 13, 0x2, 0xb8 }, { 37, 0x3, 0xb8 },
+    /* state 192: 111011010 */
+    { 0, 0x4, 0xb5 }, { 3, 0x2, 0xb5 }, { 7, 0x2, 0xb5 }, { 10, 0x2, 0xb5 },
+    { 14, 0x2, 0xb5 }, { 21, 0x2, 0xb5 }, { 38, 0x2, 0xb5 }, { 137, 0x3, 0xb5 },
+    { 0, 0x4, 0xb6 }, { 3, 0x2, 0xb6 }, { 7, 0x2, 0xb6 }, { 10, 0x2, 0xb6 },
+    { 14, 0x2, 0xb6 }, { 21, 0x2, 0xb6 }, { 38, 0x2, 0xb6 }, { 137, 0x3, 0xb6 },
+    /* state 193: 111011011 */
+    { 0, 0x4, 0xb7 }, { 3, 0x2, 0xb7 }, { 7, 0x2, 0xb7 }, { 10, 0x2, 0xb7 },
+    { 14, 0x2, 0xb7 }, { 21, 0x2, 0xb7 }, { 38, 0x2, 0xb7 }, { 137, 0x3, 0xb7 },
+    { 0, 0x4, 0xb8 }, { 3, 0x2, 0xb8 }, { 7, 0x2, 0xb8 }, { 10, 0x2, 0xb8 },
+    { 14, 0x2, 0xb8 }, { 21, 0x2, 0xb8 }, { 38, 0x2, 0xb8 }, { 137, 0x3, 0xb8 },
+    /* state 194: 1110111 */
+    { 1, 0x2, 0xb9 }, { 12, 0x3, 0xb9 }, { 1, 0x2, 0xba }, { 12, 0x3, 0xba },
+    { 1, 0x2, 0xbb }, { 12, 0x3, 0xbb }, { 1, 0x2, 0xbc }, { 12, 0x3, 0xbc },
+    { 1, 0x2, 0xbd }, { 12, 0x3, 0xbd }, { 1, 0x2, 0xbe }, { 12, 0x3, 0xbe },
+    { 1, 0x2, 0xbf }, { 12, 0x3, 0xbf }, { 1, 0x2, 0xc0 }, { 12, 0x3, 0xc0 },
+    /* state 195: 11101110 */
+    { 2, 0x2, 0xb9 }, { 6, 0x2, 0xb9 }, { 13, 0x2, 0xb9 }, { 37, 0x3, 0xb9 },
+    { 2, 0x2, 0xba }, { 6, 0x2, 0xba }, { 13, 0x2, 0xba }, { 37, 0x3, 0xba },
+    { 2, 0x2, 0xbb }, { 6, 0x2, 0xbb }, { 13, 0x2, 0xbb }, { 37, 0x3, 0xbb },
+    { 2, 0x2, 0xbc }, { 6, 0x2, 0xbc }, { 13, 0x2, 0xbc }, { 37, 0x3, 0xbc },
+    /* state 196: 111011100 */
+    { 0, 0x4, 0xb9 }, { 3, 0x2, 0xb9 }, { 7, 0x2, 0xb9 }, { 10, 0x2, 0xb9 },
+    { 14, 0x2, 0xb9 }, { 21, 0x2, 0xb9 }, { 38, 0x2, 0xb9 }, { 137, 0x3, 0xb9 },
+    { 0, 0x4, 0xba }, { 3, 0x2, 0xba }, { 7, 0x2, 0xba }, { 10, 0x2, 0xba },
+    { 14, 0x2, 0xba }, { 21, 0x2, 0xba }, { 38, 0x2, 0xba }, { 137, 0x3, 0xba },
+    /* state 197: 111011101 */
+    { 0, 0x4, 0xbb }, { 3, 0x2, 0xbb }, { 7, 0x2, 0xbb }, { 10, 0x2, 0xbb },
+    { 14, 0x2, 0xbb }, { 21, 0x2, 0xbb }, { 38, 0x2, 0xbb }, { 137, 0x3, 0xbb },
+    { 0, 0x4, 0xbc }, { 3, 0x2, 0xbc }, { 7, 0x2, 0xbc }, { 10, 0x2, 0xbc },
+    { 14, 0x2, 0xbc }, { 21, 0x2, 0xbc }, { 38, 0x2, 0xbc }, { 137, 0x3, 0xbc },
+    /* state 198: 11101111 */
+    { 2, 0x2, 0xbd }, { 6, 0x2, 0xbd }, { 13, 0x2, 0xbd }, { 37, 0x3, 0xbd },
+    { 2, 0x2, 0xbe }, { 6, 0x2, 0xbe }, { 13, 0x2, 0xbe }, { 37, 0x3, 0xbe },
+    { 2, 0x2, 0xbf }, { 6, 0x2, 0xbf }, { 13, 0x2, 0xbf }, { 37, 0x3, 0xbf },
+    { 2, 0x2, 0xc0 }, { 6, 0x2, 0xc0 }, { 13, 0x2, 0xc0 }, { 37, 0x3, 0xc0 },
+    /* state 199: 111011110 */
+    { 0, 0x4, 0xbd }, { 3, 0x2, 0xbd }, { 7, 0x2, 0xbd }, { 10, 0x2, 0xbd },
+    { 14, 0x2, 0xbd }, { 21, 0x2, 0xbd }, { 38, 0x2, 0xbd }, { 137, 0x3, 0xbd },
+    { 0, 0x4, 0xbe }, { 3, 0x2, 0xbe }, { 7, 0x2, 0xbe }, { 10, 0x2, 0xbe },
+    { 14, 0x2, 0xbe }, { 21, 0x2, 0xbe }, { 38, 0x2, 0xbe }, { 137, 0x3, 0xbe },
+    /* state 200: 111011111 */
+    { 0, 0x4, 0xbf }, { 3, 0x2, 0xbf }, { 7, 0x2, 0xbf }, { 10, 0x2, 0xbf },
+    { 14, 0x2, 0xbf }, { 21, 0x2, 0xbf }, { 38, 0x2, 0xbf }, { 137, 0x3, 0xbf },
+    { 0, 0x4, 0xc0 }, { 3, 0x2, 0xc0 }, { 7, 0x2, 0xc0 }, { 10, 0x2, 0xc0 },
+    { 14, 0x2, 0xc0 }, { 21, 0x2, 0xc0 }, { 38, 0x2, 0xc0 }, { 137, 0x3, 0xc0 },
+    /* state 201: 1111 */
+    { 205, 0x0, 0x0 }, { 208, 0x0, 0x0 }, { 212, 0x0, 0x0 }, { 215, 0x0, 0x0 },
+    { 220, 0x0, 0x0 }, { 223, 0x0, 0x0 }, { 227, 0x0, 0x0 }, { 230, 0x0, 0x0 },
+    { 236, 0x0, 0x0 }, { 239, 0x0, 0x0 }, { 243, 0x0, 0x0 }, { 246, 0x0, 0x0 },
+    { 251, 0x0, 0x0 }, { 254, 0x0, 0x0 }, { 258, 0x0, 0x0 }, { 261, 0x0, 0x0 },
+    /* state 202: 11110 */
+    { 206, 0x0, 0x0 }, { 207, 0x0, 0x0 }, { 209, 0x0, 0x0 }, { 210, 0x0, 0x0 },
+    { 213, 0x0, 0x0 }, { 214, 0x0, 0x0 }, { 216, 0x0, 0x0 }, { 217, 0x0, 0x0 },
+    { 221, 0x0, 0x0 }, { 222, 0x0, 0x0 }, { 224, 0x0, 0x0 }, { 225, 0x0, 0x0 },
+    { 228, 0x0, 0x0 }, { 229, 0x0, 0x0 }, { 231, 0x0, 0x0 }, { 232, 0x0, 0x0 },
+    /* state 203: 111100 */
+    { 0, 0x3, 0xc1 }, { 0, 0x3, 0xc2 }, { 0, 0x3, 0xc3 }, { 0, 0x3, 0xc4 },
+    { 0, 0x3, 0xc5 }, { 0, 0x3, 0xc6 }, { 0, 0x3, 0xc7 }, { 0, 0x3, 0xc8 },
+    { 0, 0x3, 0xc9 }, { 0, 0x3, 0xca }, { 0, 0x3, 0xcb }, { 0, 0x3, 0xcc },
+    { 0, 0x3, 0xcd }, { 0, 0x3, 0xce }, { 0, 0x3, 0xcf }, { 0, 0x3, 0xd0 },
+    /* state 204: 1111000 */
+    { 1, 0x2, 0xc1 }, { 12, 0x3, 0xc1 }, { 1, 0x2, 0xc2 }, { 12, 0x3, 0xc2 },
+    { 1, 0x2, 0xc3 }, { 12, 0x3, 0xc3 }, { 1, 0x2, 0xc4 }, { 12, 0x3, 0xc4 },
+    { 1, 0x2, 0xc5 }, { 12, 0x3, 0xc5 }, { 1, 0x2, 0xc6 }, { 12, 0x3, 0xc6 },
+    { 1, 0x2, 0xc7 }, { 12, 0x3, 0xc7 }, { 1, 0x2, 0xc8 }, { 12, 0x3, 0xc8 },
+    /* state 205: 11110000 */
+    { 2, 0x2, 0xc1 }, { 6, 0x2, 0xc1 }, { 13, 0x2, 0xc1 }, { 37, 0x3, 0xc1 },
+    { 2, 0x2, 0xc2 }, { 6, 0x2, 0xc2 }, { 13, 0x2, 0xc2 }, { 37, 0x3, 0xc2 },
+    { 2, 0x2, 0xc3 }, { 6, 0x2, 0xc3 }, { 13, 0x2, 0xc3 }, { 37, 0x3, 0xc3 },
+    { 2, 0x2, 0xc4 }, { 6, 0x2, 0xc4 }, { 13, 0x2, 0xc4 }, { 37, 0x3, 0xc4 },
+    /* state 206: 111100000 */
+    { 0, 0x4, 0xc1 }, { 3, 0x2, 0xc1 }, { 7, 0x2, 0xc1 }, { 10, 0x2, 0xc1 },
+    { 14, 0x2, 0xc1 }, { 21, 0x2, 0xc1 }, { 38, 0x2, 0xc1 }, { 137, 0x3, 0xc1 },
+    { 0, 0x4, 0xc2 }, { 3, 0x2, 0xc2 }, { 7, 0x2, 0xc2 }, { 10, 0x2, 0xc2 },
+    { 14, 0x2, 0xc2 }, { 21, 0x2, 0xc2 }, { 38, 0x2, 0xc2 }, { 137, 0x3, 0xc2 },
+    /* state 207: 111100001 */
+    { 0, 0x4, 0xc3 }, { 3, 0x2, 0xc3 }, { 7, 0x2, 0xc3 }, { 10, 0x2, 0xc3 },
+    { 14, 0x2, 0xc3 }, { 21, 0x2, 0xc3 }, { 38, 0x2, 0xc3 }, { 137, 0x3, 0xc3 },
+    { 0, 0x4, 0xc4 }, { 3, 0x2, 0xc4 }, { 7, 0x2, 0xc4 }, { 10, 0x2, 0xc4 },
+    { 14, 0x2, 0xc4 }, { 21, 0x2, 0xc4 }, { 38, 0x2, 0xc4 }, { 137, 0x3, 0xc4 },
+    /* state 208: 11110001 */
+    { 2, 0x2, 0xc5 }, { 6, 0x2, 0xc5 }, { 13, 0x2, 0xc5 }, { 37, 0x3, 0xc5 },
+    { 2, 0x2, 0xc6 }, { 6, 0x2, 0xc6 }, { 13, 0x2, 0xc6 }, { 37, 0x3, 0xc6 },
+    { 2, 0x2, 0xc7 }, { 6, 0x2, 0xc7 }, { 13, 0x2, 0xc7 }, { 37, 0x3, 0xc7 },
+    { 2, 0x2, 0xc8 }, { 6, 0x2, 0xc8 }, { 13, 0x2, 0xc8 }, { 37, 0x3, 0xc8 },
+    /* state 209: 111100010 */
+    { 0, 0x4, 0xc5 }, { 3, 0x2, 0xc5 }, { 7, 0x2, 0xc5 }, { 10, 0x2, 0xc5 },
+    { 14, 0x2, 0xc5 }, { 21, 0x2, 0xc5 }, { 38, 0x2, 0xc5 }, { 137, 0x3, 0xc5 },
+    { 0, 0x4, 0xc6 }, { 3, 0x2, 0xc6 }, { 7, 0x2, 0xc6 }, { 10, 0x2, 0xc6 },
+    { 14, 0x2, 0xc6 }, { 21, 0x2, 0xc6 }, { 38, 0x2, 0xc6 }, { 137, 0x3, 0xc6 },
+    /* state 210: 111100011 */
+    { 0, 0x4, 0xc7 }, { 3, 0x2, 0xc7 }, { 7, 0x2, 0xc7 }, { 10, 0x2, 0xc7 },
+    { 14, 0x2, 0xc7 }, { 21, 0x2, 0xc7 }, { 38, 0x2, 0xc7 }, { 137, 0x3, 0xc7 },
+    { 0, 0x4, 0xc8 }, { 3, 0x2, 0xc8 }, { 7, 0x2, 0xc8 }, { 10, 0x2, 0xc8 },
+    { 14, 0x2, 0xc8 }, { 21, 0x2, 0xc8 }, { 38, 0x2, 0xc8 }, { 137, 0x3, 0xc8 },
+    /* state 211: 1111001 */
+    { 1, 0x2, 0xc9 }, { 12, 0x3, 0xc9 }, { 1, 0x2, 0xca }, { 12, 0x3, 0xca },
+    { 1, 0x2, 0xcb }, { 12, 0x3, 0xcb }, { 1, 0x2, 0xcc }, { 12, 0x3, 0xcc },
+    { 1, 0x2, 0xcd }, { 12, 0x3, 0xcd }, { 1, 0x2, 0xce }, { 12, 0x3, 0xce },
+    { 1, 0x2, 0xcf }, { 12, 0x3, 0xcf }, { 1, 0x2, 0xd0 }, { 12, 0x3, 0xd0 },
+    /* state 212: 11110010 */
+    { 2, 0x2, 0xc9 }, { 6, 0x2, 0xc9 }, { 13, 0x2, 0xc9 }, { 37, 0x3, 0xc9 },
+    { 2, 0x2, 0xca }, { 6, 0x2, 0xca }, { 13, 0x2, 0xca }, { 37, 0x3, 0xca },
+    { 2, 0x2, 0xcb }, { 6, 0x2, 0xcb }, { 13, 0x2, 0xcb }, { 37, 0x3, 0xcb },
+    { 2, 0x2, 0xcc }, { 6, 0x2, 0xcc }, { 13, 0x2, 0xcc }, { 37, 0x3, 0xcc },
+    /* state 213: 111100100 */
+    { 0, 0x4, 0xc9 }, { 3, 0x2, 0xc9 }, { 7, 0x2, 0xc9 }, { 10, 0x2, 0xc9 },
+    { 14, 0x2, 0xc9 }, { 21, 0x2, 0xc9 }, { 38, 0x2, 0xc9 }, { 137, 0x3, 0xc9 },
+    { 0, 0x4, 0xca }, { 3, 0x2, 0xca }, { 7, 0x2, 0xca }, { 10, 0x2, 0xca },
+    { 14, 0x2, 0xca }, { 21, 0x2, 0xca }, { 38, 0x2, 0xca }, { 137, 0x3, 0xca },
+    /* state 214: 111100101 */
+    { 0, 0x4, 0xcb }, { 3, 0x2, 0xcb }, { 7, 0x2, 0xcb }, { 10, 0x2, 0xcb },
+    { 14, 0x2, 0xcb }, { 21, 0x2, 0xcb }, { 38, 0x2, 0xcb }, { 137, 0x3, 0xcb },
+    { 0, 0x4, 0xcc }, { 3, 0x2, 0xcc }, { 7, 0x2, 0xcc }, { 10, 0x2, 0xcc },
+    { 14, 0x2, 0xcc }, { 21, 0x2, 0xcc }, { 38, 0x2, 0xcc }, { 137, 0x3, 0xcc },
+    /* state 215: 11110011 */
+    { 2, 0x2, 0xcd }, { 6, 0x2, 0xcd }, { 13, 0x2, 0xcd }, { 37, 0x3, 0xcd },
+    { 2, 0x2, 0xce }, { 6, 0x2, 0xce }, { 13, 0x2, 0xce }, { 37, 0x3, 0xce },
+    { 2, 0x2, 0xcf }, { 6, 0x2, 0xcf }, { 13, 0x2, 0xcf }, { 37, 0x3, 0xcf },
+    { 2, 0x2, 0xd0 }, { 6, 0x2, 0xd0 }, { 13, 0x2, 0xd0 }, { 37, 0x3, 0xd0 },
+    /* state 216: 111100110 */
+    { 0, 0x4, 0xcd }, { 3, 0x2, 0xcd }, { 7, 0x2, 0xcd }, { 10, 0x2, 0xcd },
+    { 14, 0x2, 0xcd }, { 21, 0x2, 0xcd }, { 38, 0x2, 0xcd }, { 137, 0x3, 0xcd },
+    { 0, 0x4, 0xce }, { 3, 0x2, 0xce }, { 7, 0x2, 0xce }, { 10, 0x2, 0xce },
+    { 14, 0x2, 0xce }, { 21, 0x2, 0xce }, { 38, 0x2, 0xce }, { 137, 0x3, 0xce },
+    /* state 217: 111100111 */
+    { 0, 0x4, 0xcf }, { 3, 0x2, 0xcf }, { 7, 0x2, 0xcf }, { 10, 0x2, 0xcf },
+    { 14, 0x2, 0xcf }, { 21, 0x2, 0xcf }, { 38, 0x2, 0xcf }, { 137, 0x3, 0xcf },
+    { 0, 0x4, 0xd0 }, { 3, 0x2, 0xd0 }, { 7, 0x2, 0xd0 }, { 10, 0x2, 0xd0 },
+    { 14, 0x2, 0xd0 }, { 21, 0x2, 0xd0 }, { 38, 0x2, 0xd0 }, { 137, 0x3, 0xd0 },
+    /* state 218: 111101 */
+    { 0, 0x3, 0xd1 }, { 0, 0x3, 0xd2 }, { 0, 0x3, 0xd3 }, { 0, 0x3, 0xd4 },
+    { 0, 0x3, 0xd5 }, { 0, 0x3, 0xd6 }, { 0, 0x3, 0xd7 }, { 0, 0x3, 0xd8 },
+    { 0, 0x3, 0xd9 }, { 0, 0x3, 0xda }, { 0, 0x3, 0xdb }, { 0, 0x3, 0xdc },
+    { 0, 0x3, 0xdd }, { 0, 0x3, 0xde }, { 0, 0x3, 0xdf }, { 0, 0x3, 0xe0 },
+    /* state 219: 1111010 */
+    { 1, 0x2, 0xd1 }, { 12, 0x3, 0xd1 }, { 1, 0x2, 0xd2 }, { 12, 0x3, 0xd2 },
+    { 1, 0x2, 0xd3 }, { 12, 0x3, 0xd3 }, { 1, 0x2, 0xd4 }, { 12, 0x3, 0xd4 },
+    { 1, 0x2, 0xd5 }, { 12, 0x3, 0xd5 }, { 1, 0x2, 0xd6 }, { 12, 0x3, 0xd6 },
+    { 1, 0x2, 0xd7 }, { 12, 0x3, 0xd7 }, { 1, 0x2, 0xd8 }, { 12, 0x3, 0xd8 },
+    /* state 220: 11110100 */
+    { 2, 0x2, 0xd1 }, { 6, 0x2, 0xd1 }, { 13, 0x2, 0xd1 }, { 37, 0x3, 0xd1 },
+    { 2, 0x2, 0xd2 }, { 6, 0x2, 0xd2 }, { 13, 0x2, 0xd2 }, { 37, 0x3, 0xd2 },
+    { 2, 0x2, 0xd3 }, { 6, 0x2, 0xd3 }, { 13, 0x2, 0xd3 }, { 37, 0x3, 0xd3 },
+    { 2, 0x2, 0xd4 }, { 6, 0x2, 0xd4 }, { 13, 0x2, 0xd4 }, { 37, 0x3, 0xd4 },
+    /* state 221: 111101000 */
+    { 0, 0x4, 0xd1 }, { 3, 0x2, 0xd1 }, { 7, 0x2, 0xd1 }, { 10, 0x2, 0xd1 },
+    { 14, 0x2, 0xd1 }, { 21, 0x2, 0xd1 }, { 38, 0x2, 0xd1 }, { 137, 0x3, 0xd1 },
+    { 0, 0x4, 0xd2 }, { 3, 0x2, 0xd2 }, { 7, 0x2, 0xd2 }, { 10, 0x2, 0xd2 },
+    { 14, 0x2, 0xd2 }, { 21, 0x2, 0xd2 }, { 38, 0x2, 0xd2 }, { 137, 0x3, 0xd2 },
+    /* state 222: 111101001 */
+    { 0, 0x4, 0xd3 }, { 3, 0x2, 0xd3 }, { 7, 0x2, 0xd3 }, { 10, 0x2, 0xd3 },
+    { 14, 0x2, 0xd3 }, { 21, 0x2, 0xd3 }, { 38, 0x2, 0xd3 }, { 137, 0x3, 0xd3 },
+    { 0, 0x4, 0xd4 }, { 3, 0x2, 0xd4 }, { 7, 0x2, 0xd4 }, { 10, 0x2, 0xd4 },
+    { 14, 0x2, 0xd4 }, { 21, 0x2, 0xd4 }, { 38, 0x2, 0xd4 }, { 137, 0x3, 0xd4 },
+    /* state 223: 11110101 */
+    { 2, 0x2, 0xd5 }, { 6, 0x2, 0xd5 }, { 13, 0x2, 0xd5 }, { 37, 0x3, 0xd5 },
+    { 2, 0x2, 0xd6 }, { 6, 0x2, 0xd6 }, { 13, 0x2, 0xd6 }, { 37, 0x3, 0xd6 },
+    { 2, 0x2, 0xd7 }, { 6, 0x2, 0xd7 }, { 13, 0x2, 0xd7 }, { 37, 0x3, 0xd7 },
+    { 2, 0x2, 0xd8 }, { 6, 0x2, 0xd8 }, { 13, 0x2, 0xd8 }, { 37, 0x3, 0xd8 },
+    /* state 224: 111101010 */
+    { 0, 0x4, 0xd5 }, { 3, 0x2, 0xd5 }, { 7, 0x2, 0xd5 }, { 10, 0x2, 0xd5 },
+    { 14, 0x2, 0xd5 }, { 21, 0x2, 0xd5 }, { 38, 0x2, 0xd5 }, { 137, 0x3, 0xd5 },
+    { 0, 0x4, 0xd6 }, { 3, 0x2, 0xd6 }, { 7, 0x2, 0xd6 }, { 10, 0x2, 0xd6 },
+    { 14, 0x2, 0xd6 }, { 21, 0x2, 0xd6 }, { 38, 0x2, 0xd6 }, { 137, 0x3, 0xd6 },
+    /* state 225: 111101011 */
+    { 0, 0x4, 0xd7 }, { 3, 0x2, 0xd7 }, { 7, 0x2, 0xd7 }, { 10, 0x2, 0xd7 },
+    { 14, 0x2, 0xd7 }, { 21, 0x2, 0xd7 }, { 38, 0x2, 0xd7 }, { 137, 0x3, 0xd7 },
+    { 0, 0x4, 0xd8 }, { 3, 0x2, 0xd8 }, { 7, 0x2, 0xd8 }, { 10, 0x2, 0xd8 },
+    { 14, 0x2, 0xd8 }, { 21, 0x2, 0xd8 }, { 38, 0x2, 0xd8 }, { 137, 0x3, 0xd8 },
+    /* state 226: 1111011 */
+    { 1, 0x2, 0xd9 }, { 12, 0x3, 0xd9 }, { 1, 0x2, 0xda }, { 12, 0x3, 0xda },
+    { 1, 0x2, 0xdb }, { 12, 0x3, 0xdb }, { 1, 0x2, 0xdc }, { 12, 0x3, 0xdc },
+    { 1, 0x2, 0xdd }, { 12, 0x3, 0xdd }, { 1, 0x2, 0xde }, { 12, 0x3, 0xde },
+    { 1, 0x2, 0xdf }, { 12, 0x3, 0xdf }, { 1, 0x2, 0xe0 }, { 12, 0x3, 0xe0 },
+    /* state 227: 11110110 */
+    { 2, 0x2, 0xd9 }, { 6, 0x2, 0xd9 }, { 13, 0x2, 0xd9 }, { 37, 0x3, 0xd9 },
+    { 2, 0x2, 0xda }, { 6, 0x2, 0xda }, { 13, 0x2, 0xda }, { 37, 0x3, 0xda },
+    { 2, 0x2, 0xdb }, { 6, 0x2, 0xdb }, { 13, 0x2, 0xdb }, { 37, 0x3, 0xdb },
+    { 2, 0x2, 0xdc }, { 6, 0x2, 0xdc }, { 13, 0x2, 0xdc }, { 37, 0x3, 0xdc },
+    /* state 228: 111101100 */
+    { 0, 0x4, 0xd9 }, { 3, 0x2, 0xd9 }, { 7, 0x2, 0xd9 }, { 10, 0x2, 0xd9 },
+    { 14, 0x2, 0xd9 }, { 21, 0x2, 0xd9 }, { 38, 0x2, 0xd9 }, { 137, 0x3, 0xd9 },
+    { 0, 0x4, 0xda }, { 3, 0x2, 0xda }, { 7, 0x2, 0xda }, { 10, 0x2, 0xda },
+    { 14, 0x2, 0xda }, { 21, 0x2, 0xda }, { 38, 0x2, 0xda }, { 137, 0x3, 0xda },
+    /* state 229: 111101101 */
+    { 0, 0x4, 0xdb }, { 3, 0x2, 0xdb }, { 7, 0x2, 0xdb }, { 10, 0x2, 0xdb },
+    { 14, 0x2, 0xdb }, { 21, 0x2, 0xdb }, { 38, 0x2, 0xdb }, { 137, 0x3, 0xdb },
+    { 0, 0x4, 0xdc }, { 3, 0x2, 0xdc }, { 7, 0x2, 0xdc }, { 10, 0x2, 0xdc },
+    { 14, 0x2, 0xdc }, { 21, 0x2, 0xdc }, { 38, 0x2, 0xdc }, { 137, 0x3, 0xdc },
+    /* state 230: 11110111 */
+    { 2, 0x2, 0xdd }, { 6, 0x2, 0xdd }, { 13, 0x2, 0xdd }, { 37, 0x3, 0xdd },
+    { 2, 0x2, 0xde }, { 6, 0x2, 0xde }, { 13, 0x2, 0xde }, { 37, 0x3, 0xde },
+    { 2, 0x2, 0xdf }, { 6, 0x2, 0xdf }, { 13, 0x2, 0xdf }, { 37, 0x3, 0xdf },
+    { 2, 0x2, 0xe0 }, { 6, 0x2, 0xe0 }, { 13, 0x2, 0xe0 }, { 37, 0x3, 0xe0 },
+    /* state 231: 111101110 */
+    { 0, 0x4, 0xdd }, { 3, 0x2, 0xdd }, { 7, 0x2, 0xdd }, { 10, 0x2, 0xdd },
+    { 14, 0x2, 0xdd }, { 21, 0x2, 0xdd }, { 38, 0x2, 0xdd }, { 137, 0x3, 0xdd },
+    { 0, 0x4, 0xde }, { 3, 0x2, 0xde }, { 7, 0x2, 0xde }, { 10, 0x2, 0xde },
+    { 14, 0x2, 0xde }, { 21, 0x2, 0xde }, { 38, 0x2, 0xde }, { 137, 0x3, 0xde },
+    /* state 232: 111101111 */
+    { 0, 0x4, 0xdf }, { 3, 0x2, 0xdf }, { 7, 0x2, 0xdf }, { 10, 0x2, 0xdf },
+    { 14, 0x2, 0xdf }, { 21, 0x2, 0xdf }, { 38, 0x2, 0xdf }, { 137, 0x3, 0xdf },
+    { 0, 0x4, 0xe0 }, { 3, 0x2, 0xe0 }, { 7, 0x2, 0xe0 }, { 10, 0x2, 0xe0 },
+    { 14, 0x2, 0xe0 }, { 21, 0x2, 0xe0 }, { 38, 0x2, 0xe0 }, { 137, 0x3, 0xe0 },
+    /* state 233: 11111 */
+    { 237, 0x0, 0x0 }, { 238, 0x0, 0x0 }, { 240, 0x0, 0x0 }, { 241, 0x0, 0x0 },
+    { 244, 0x0, 0x0 }, { 245, 0x0, 0x0 }, { 247, 0x0, 0x0 }, { 248, 0x0, 0x0 },
+    { 252, 0x0, 0x0 }, { 253, 0x0, 0x0 }, { 255, 0x0, 0x0 }, { 256, 0x0, 0x0 },
+    { 259, 0x0, 0x0 }, { 260, 0x0, 0x0 }, { 262, 0x0, 0x0 }, { 263, 0x0, 0x0 },
+    /* state 234: 111110 */
+    { 0, 0x3, 0xe1 }, { 0, 0x3, 0xe2 }, { 0, 0x3, 0xe3 }, { 0, 0x3, 0xe4 },
+    { 0, 0x3, 0xe5 }, { 0, 0x3, 0xe6 }, { 0, 0x3, 0xe7 }, { 0, 0x3, 0xe8 },
+    { 0, 0x3, 0xe9 }, { 0, 0x3, 0xea }, { 0, 0x3, 0xeb }, { 0, 0x3, 0xec },
+    { 0, 0x3, 0xed }, { 0, 0x3, 0xee }, { 0, 0x3, 0xef }, { 0, 0x3, 0xf0 },
+    /* state 235: 1111100 */
+    { 1, 0x2, 0xe1 }, { 12, 0x3, 0xe1 }, { 1, 0x2, 0xe2 }, { 12, 0x3, 0xe2 },
+    { 1, 0x2, 0xe3 }, { 12, 0x3, 0xe3 }, { 1, 0x2, 0xe4 }, { 12, 0x3, 0xe4 },
+    { 1, 0x2, 0xe5 }, { 12, 0x3, 0xe5 }, { 1, 0x2, 0xe6 }, { 12, 0x3, 0xe6 },
+    { 1, 0x2, 0xe7 }, { 12, 0x3, 0xe7 }, { 1, 0x2, 0xe8 }, { 12, 0x3, 0xe8 },
+    /* state 236: 11111000 */
+    { 2, 0x2, 0xe1 }, { 6, 0x2, 0xe1 }, { 13, 0x2, 0xe1 }, { 37, 0x3, 0xe1 },
+    { 2, 0x2, 0xe2 }, { 6, 0x2, 0xe2 }, { 13, 0x2, 0xe2 }, { 37, 0x3, 0xe2 },
+    { 2, 0x2, 0xe3 }, { 6, 0x2, 0xe3 }, { 13, 0x2, 0xe3 }, { 37, 0x3, 0xe3 },
+    { 2, 0x2, 0xe4 }, { 6, 0x2, 0xe4 }, { 13, 0x2, 0xe4 }, { 37, 0x3, 0xe4 },
+    /* state 237: 111110000 */
+    { 0, 0x4, 0xe1 }, { 3, 0x2, 0xe1 }, { 7, 0x2, 0xe1 }, { 10, 0x2, 0xe1 },
+    { 14, 0x2, 0xe1 }, { 21, 0x2, 0xe1 }, { 38, 0x2, 0xe1 }, { 137, 0x3, 0xe1 },
+    { 0, 0x4, 0xe2 }, { 3, 0x2, 0xe2 }, { 7, 0x2, 0xe2 }, { 10, 0x2, 0xe2 },
+    { 14, 0x2, 0xe2 }, { 21, 0x2, 0xe2 }, { 38, 0x2, 0xe2 }, { 137, 0x3, 0xe2 },
+    /* state 238: 111110001 */
+    { 0, 0x4, 0xe3 }, { 3, 0x2, 0xe3 }, { 7, 0x2, 0xe3 }, { 10, 0x2, 0xe3 },
+    { 14, 0x2, 0xe3 }, { 21, 0x2, 0xe3 }, { 38, 0x2, 0xe3 }, { 137, 0x3, 0xe3 },
+    { 0, 0x4, 0xe4 }, { 3, 0x2, 0xe4 }, { 7, 0x2, 0xe4 }, { 10, 0x2, 0xe4 },
+    { 14, 0x2, 0xe4 }, { 21, 0x2, 0xe4 }, { 38, 0x2, 0xe4 }, { 137, 0x3, 0xe4 },
+    /* state 239: 11111001 */
+    { 2, 0x2, 0xe5 }, { 6, 0x2, 0xe5 }, { 13, 0x2, 0xe5 }, { 37, 0x3, 0xe5 },
+    { 2, 0x2, 0xe6 }, { 6, 0x2, 0xe6 }, { 13, 0x2, 0xe6 }, { 37, 0x3, 0xe6 },
+    { 2, 0x2, 0xe7 }, { 6, 0x2, 0xe7 }, { 13, 0x2, 0xe7 }, { 37, 0x3, 0xe7 },
+    { 2, 0x2, 0xe8 }, { 6, 0x2, 0xe8 }, { 13, 0x2, 0xe8 }, { 37, 0x3, 0xe8 },
+    /* state 240: 111110010 */
+    { 0, 0x4, 0xe5 }, { 3, 0x2, 0xe5 }, { 7, 0x2, 0xe5 }, { 10, 0x2, 0xe5 },
+    { 14, 0x2, 0xe5 }, { 21, 0x2, 0xe5 }, { 38, 0x2, 0xe5 }, { 137, 0x3, 0xe5 },
+    { 0, 0x4, 0xe6 }, { 3, 0x2, 0xe6 }, { 7, 0x2, 0xe6 }, { 10, 0x2, 0xe6 },
+    { 14, 0x2, 0xe6 }, { 21, 0x2, 0xe6 }, { 38, 0x2, 0xe6 }, { 137, 0x3, 0xe6 },
+    /* state 241: 111110011 */
+    { 0, 0x4, 0xe7 }, { 3, 0x2, 0xe7 }, { 7, 0x2, 0xe7 }, { 10, 0x2, 0xe7 },
+    { 14, 0x2, 0xe7 }, { 21, 0x2, 0xe7 }, { 38, 0x2, 0xe7 }, { 137, 0x3, 0xe7 },
+    { 0, 0x4, 0xe8 }, { 3, 0x2, 0xe8 }, { 7, 0x2, 0xe8 }, { 10, 0x2, 0xe8 },
+    { 14, 0x2, 0xe8 }, { 21, 0x2, 0xe8 }, { 38, 0x2, 0xe8 }, { 137, 0x3, 0xe8 },
+    /* state 242: 1111101 */
+    { 1, 0x2, 0xe9 }, { 12, 0x3, 0xe9 }, { 1, 0x2, 0xea }, { 12, 0x3, 0xea },
+    { 1, 0x2, 0xeb }, { 12, 0x3, 0xeb }, { 1, 0x2, 0xec }, { 12, 0x3, 0xec },
+    { 1, 0x2, 0xed }, { 12, 0x3, 0xed }, { 1, 0x2, 0xee }, { 12, 0x3, 0xee },
+    { 1, 0x2, 0xef }, { 12, 0x3, 0xef }, { 1, 0x2, 0xf0 }, { 12, 0x3, 0xf0 },
+    /* state 243: 11111010 */
+    { 2, 0x2, 0xe9 }, { 6, 0x2, 0xe9 }, { 13, 0x2, 0xe9 }, { 37, 0x3, 0xe9 },
+    { 2, 0x2, 0xea }, { 6, 0x2, 0xea }, { 13, 0x2, 0xea }, { 37, 0x3, 0xea },
+    { 2, 0x2, 0xeb }, { 6, 0x2, 0xeb }, { 13, 0x2, 0xeb }, { 37, 0x3, 0xeb },
+    { 2, 0x2, 0xec }, { 6, 0x2, 0xec }, { 13, 0x2, 0xec }, { 37, 0x3, 0xec },
+    /* state 244: 111110100 */
+    { 0, 0x4, 0xe9 }, { 3, 0x2, 0xe9 }, { 7, 0x2, 0xe9 }, { 10, 0x2, 0xe9 },
+    { 14, 0x2, 0xe9 }, { 21, 0x2, 0xe9 }, { 38, 0x2, 0xe9 }, { 137, 0x3, 0xe9 },
+    { 0, 0x4, 0xea }, { 3, 0x2, 0xea }, { 7, 0x2, 0xea }, { 10, 0x2, 0xea },
+    { 14, 0x2, 0xea }, { 21, 0x2, 0xea }, { 38, 0x2, 0xea }, { 137, 0x3, 0xea },
+    /* state 245: 111110101 */
+    { 0, 0x4, 0xeb }, { 3, 0x2, 0xeb }, { 7, 0x2, 0xeb }, { 10, 0x2, 0xeb },
+    { 14, 0x2, 0xeb }, { 21, 0x2, 0xeb }, { 38, 0x2, 0xeb }, { 137, 0x3, 0xeb },
+    { 0, 0x4, 0xec }, { 3, 0x2, 0xec }, { 7, 0x2, 0xec }, { 10, 0x2, 0xec },
+    { 14, 0x2, 0xec }, { 21, 0x2, 0xec }, { 38, 0x2, 0xec }, { 137, 0x3, 0xec },
+    /* state 246: 11111011 */
+    { 2, 0x2, 0xed }, { 6, 0x2, 0xed }, { 13, 0x2, 0xed }, { 37, 0x3, 0xed },
+    { 2, 0x2, 0xee }, { 6, 0x2, 0xee }, { 13, 0x2, 0xee }, { 37, 0x3, 0xee },
+    { 2, 0x2, 0xef }, { 6, 0x2, 0xef }, { 13, 0x2, 0xef }, { 37, 0x3, 0xef },
+    { 2, 0x2, 0xf0 }, { 6, 0x2, 0xf0 }, { 13, 0x2, 0xf0 }, { 37, 0x3, 0xf0 },
+    /* state 247: 111110110 */
+    { 0, 0x4, 0xed }, { 3, 0x2, 0xed }, { 7, 0x2, 0xed }, { 10, 0x2, 0xed },
+    { 14, 0x2, 0xed }, { 21, 0x2, 0xed }, { 38, 0x2, 0xed }, { 137, 0x3, 0xed },
+    { 0, 0x4, 0xee }, { 3, 0x2, 0xee }, { 7, 0x2, 0xee }, { 10, 0x2, 0xee },
+    { 14, 0x2, 0xee }, { 21, 0x2, 0xee }, { 38, 0x2, 0xee }, { 137, 0x3, 0xee },
+    /* state 248: 111110111 */
+    { 0, 0x4, 0xef }, { 3, 0x2, 0xef }, { 7, 0x2, 0xef }, { 10, 0x2, 0xef },
+    { 14, 0x2, 0xef }, { 21, 0x2, 0xef }, { 38, 0x2, 0xef }, { 137, 0x3, 0xef },
+    { 0, 0x4, 0xf0 }, { 3, 0x2, 0xf0 }, { 7, 0x2, 0xf0 }, { 10, 0x2, 0xf0 },
+    { 14, 0x2, 0xf0 }, { 21, 0x2, 0xf0 }, { 38, 0x2, 0xf0 }, { 137, 0x3, 0xf0 },
+    /* state 249: 111111 */
+    { 0, 0x3, 0xf1 }, { 0, 0x3, 0xf2 }, { 0, 0x3, 0xf3 }, { 0, 0x3, 0xf4 },
+    { 0, 0x3, 0xf5 }, { 0, 0x3, 0xf6 }, { 0, 0x3, 0xf7 }, { 0, 0x3, 0xf8 },
+    { 0, 0x3, 0xf9 }, { 0, 0x3, 0xfa }, { 0, 0x3, 0xfb }, { 0, 0x3, 0xfc },
+    { 0, 0x3, 0xfd }, { 0, 0x3, 0xfe }, { 0, 0x3, 0xff }, { 0, 0x4, 0x0 },
+    /* state 250: 1111110 */
+    { 1, 0x2, 0xf1 }, { 12, 0x3, 0xf1 }, { 1, 0x2, 0xf2 }, { 12, 0x3, 0xf2 },
+    { 1, 0x2, 0xf3 }, { 12, 0x3, 0xf3 }, { 1, 0x2, 0xf4 }, { 12, 0x3, 0xf4 },
+    { 1, 0x2, 0xf5 }, { 12, 0x3, 0xf5 }, { 1, 0x2, 0xf6 }, { 12, 0x3, 0xf6 },
+    { 1, 0x2, 0xf7 }, { 12, 0x3, 0xf7 }, { 1, 0x2, 0xf8 }, { 12, 0x3, 0xf8 },
+    /* state 251: 11111100 */
+    { 2, 0x2, 0xf1 }, { 6, 0x2, 0xf1 }, { 13, 0x2, 0xf1 }, { 37, 0x3, 0xf1 },
+    { 2, 0x2, 0xf2 }, { 6, 0x2, 0xf2 }, { 13, 0x2, 0xf2 }, { 37, 0x3, 0xf2 },
+    { 2, 0x2, 0xf3 }, { 6, 0x2, 0xf3 }, { 13, 0x2, 0xf3 }, { 37, 0x3, 0xf3 },
+    { 2, 0x2, 0xf4 }, { 6, 0x2, 0xf4 }, { 13, 0x2, 0xf4 }, { 37, 0x3, 0xf4 },
+    /* state 252: 111111000 */
+    { 0, 0x4, 0xf1 }, { 3, 0x2, 0xf1 }, { 7, 0x2, 0xf1 }, { 10, 0x2, 0xf1 },
+    { 14, 0x2, 0xf1 }, { 21, 0x2, 0xf1 }, { 38, 0x2, 0xf1 }, { 137, 0x3, 0xf1 },
+    { 0, 0x4, 0xf2 }, { 3, 0x2, 0xf2 }, { 7, 0x2, 0xf2 }, { 10, 0x2, 0xf2 },
+    { 14, 0x2, 0xf2 }, { 21, 0x2, 0xf2 }, { 38, 0x2, 0xf2 }, { 137, 0x3, 0xf2 },
+    /* state 253: 111111001 */
+    { 0, 0x4, 0xf3 }, { 3, 0x2, 0xf3 }, { 7, 0x2, 0xf3 }, { 10, 0x2, 0xf3 },
+    { 14, 0x2, 0xf3 }, { 21, 0x2, 0xf3 }, { 38, 0x2, 0xf3 }, { 137, 0x3, 0xf3 },
+    { 0, 0x4, 0xf4 }, { 3, 0x2, 0xf4 }, { 7, 0x2, 0xf4 }, { 10, 0x2, 0xf4 },
+    { 14, 0x2, 0xf4 }, { 21, 0x2, 0xf4 }, { 38, 0x2, 0xf4 }, { 137, 0x3, 0xf4 },
+    /* state 254: 11111101 */
+    { 2, 0x2, 0xf5 }, { 6, 0x2, 0xf5 }, { 13, 0x2, 0xf5 }, { 37, 0x3, 0xf5 },
+    { 2, 0x2, 0xf6 }, { 6, 0x2, 0xf6 }, { 13, 0x2, 0xf6 }, { 37, 0x3, 0xf6 },
+    { 2, 0x2, 0xf7 }, { 6, 0x2, 0xf7 }, { 13, 0x2, 0xf7 }, { 37, 0x3, 0xf7 },
+    { 2, 0x2, 0xf8 }, { 6, 0x2, 0xf8 }, { 13, 0x2, 0xf8 }, { 37, 0x3, 0xf8 },
+    /* state 255: 111111010 */
+    { 0, 0x4, 0xf5 }, { 3, 0x2, 0xf5 }, { 7, 0x2, 0xf5 }, { 10, 0x2, 0xf5 },
+    { 14, 0x2, 0xf5 }, { 21, 0x2, 0xf5 }, { 38, 0x2, 0xf5 }, { 137, 0x3, 0xf5 },
+    { 0, 0x4, 0xf6 }, { 3, 0x2, 0xf6 }, { 7, 0x2, 0xf6 }, { 10, 0x2, 0xf6 },
+    { 14, 0x2, 0xf6 }, { 21, 0x2, 0xf6 }, { 38, 0x2, 0xf6 }, { 137, 0x3, 0xf6 },
+    /* state 256: 111111011 */
+    { 0, 0x4, 0xf7 }, { 3, 0x2, 0xf7 }, { 7, 0x2, 0xf7 }, { 10, 0x2, 0xf7 },
+    { 14, 0x2, 0xf7 }, { 21, 0x2, 0xf7 }, { 38, 0x2, 0xf7 }, { 137, 0x3, 0xf7 },
+    { 0, 0x4, 0xf8 }, { 3, 0x2, 0xf8 }, { 7, 0x2, 0xf8 }, { 10, 0x2, 0xf8 },
+    { 14, 0x2, 0xf8 }, { 21, 0x2, 0xf8 }, { 38, 0x2, 0xf8 }, { 137, 0x3, 0xf8 },
+    /* state 257: 1111111 */
+    { 1, 0x2, 0xf9 }, { 12, 0x3, 0xf9 }, { 1, 0x2, 0xfa }, { 12, 0x3, 0xfa },
+    { 1, 0x2, 0xfb }, { 12, 0x3, 0xfb }, { 1, 0x2, 0xfc }, { 12, 0x3, 0xfc },
+    { 1, 0x2, 0xfd }, { 12, 0x3, 0xfd }, { 1, 0x2, 0xfe }, { 12, 0x3, 0xfe },
+    { 1, 0x2, 0xff }, { 12, 0x3, 0xff }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 258: 11111110 */
+    { 2, 0x2, 0xf9 }, { 6, 0x2, 0xf9 }, { 13, 0x2, 0xf9 }, { 37, 0x3, 0xf9 },
+    { 2, 0x2, 0xfa }, { 6, 0x2, 0xfa }, { 13, 0x2, 0xfa }, { 37, 0x3, 0xfa },
+    { 2, 0x2, 0xfb }, { 6, 0x2, 0xfb }, { 13, 0x2, 0xfb }, { 37, 0x3, 0xfb },
+    { 2, 0x2, 0xfc }, { 6, 0x2, 0xfc }, { 13, 0x2, 0xfc }, { 37, 0x3, 0xfc },
+    /* state 259: 111111100 */
+    { 0, 0x4, 0xf9 }, { 3, 0x2, 0xf9 }, { 7, 0x2, 0xf9 }, { 10, 0x2, 0xf9 },
+    { 14, 0x2, 0xf9 }, { 21, 0x2, 0xf9 }, { 38, 0x2, 0xf9 }, { 137, 0x3, 0xf9 },
+    { 0, 0x4, 0xfa }, { 3, 0x2, 0xfa }, { 7, 0x2, 0xfa }, { 10, 0x2, 0xfa },
+    { 14, 0x2, 0xfa }, { 21, 0x2, 0xfa }, { 38, 0x2, 0xfa }, { 137, 0x3, 0xfa },
+    /* state 260: 111111101 */
+    { 0, 0x4, 0xfb }, { 3, 0x2, 0xfb }, { 7, 0x2, 0xfb }, { 10, 0x2, 0xfb },
+    { 14, 0x2, 0xfb }, { 21, 0x2, 0xfb }, { 38, 0x2, 0xfb }, { 137, 0x3, 0xfb },
+    { 0, 0x4, 0xfc }, { 3, 0x2, 0xfc }, { 7, 0x2, 0xfc }, { 10, 0x2, 0xfc },
+    { 14, 0x2, 0xfc }, { 21, 0x2, 0xfc }, { 38, 0x2, 0xfc }, { 137, 0x3, 0xfc },
+    /* state 261: 11111111 */
+    { 2, 0x2, 0xfd }, { 6, 0x2, 0xfd }, { 13, 0x2, 0xfd }, { 37, 0x3, 0xfd },
+    { 2, 0x2, 0xfe }, { 6, 0x2, 0xfe }, { 13, 0x2, 0xfe }, { 37, 0x3, 0xfe },
+    { 2, 0x2, 0xff }, { 6, 0x2, 0xff }, { 13, 0x2, 0xff }, { 37, 0x3, 0xff },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 262: 111111110 */
+    { 0, 0x4, 0xfd }, { 3, 0x2, 0xfd }, { 7, 0x2, 0xfd }, { 10, 0x2, 0xfd },
+    { 14, 0x2, 0xfd }, { 21, 0x2, 0xfd }, { 38, 0x2, 0xfd }, { 137, 0x3, 0xfd },
+    { 0, 0x4, 0xfe }, { 3, 0x2, 0xfe }, { 7, 0x2, 0xfe }, { 10, 0x2, 0xfe },
+    { 14, 0x2, 0xfe }, { 21, 0x2, 0xfe }, { 38, 0x2, 0xfe }, { 137, 0x3, 0xfe },
+    /* state 263: 111111111 */
+    { 0, 0x4, 0xff }, { 3, 0x2, 0xff }, { 7, 0x2, 0xff }, { 10, 0x2, 0xff },
+    { 14, 0x2, 0xff }, { 21, 0x2, 0xff }, { 38, 0x2, 0xff }, { 137, 0x3, 0xff },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+};
+
+static const struct aws_huffman_fsm_table fsm_table = {
+    .transitions = fsm_transitions,
+    .num_states = 264,
+};
+
+static struct aws_huffman_symbol_coder strategies[] = {
+    {
+        .encode = encode_symbol,
+        .decode = tree_decode_symbol,
+        .userdata = NULL,
+        .encode_table = code_points,
+        .code_lengths = code_lengths,
+    },
+    {
+        .encode = encode_symbol,
+        .decode = table_decode_symbol,
+        .userdata = NULL,
+        .encode_table = code_points,
+        .code_lengths = code_lengths,
+        .decode_table = &table_decode_table,
+    },
+    {
+        .encode = encode_symbol,
+        .decode = flat_decode_symbol,
+        .userdata = NULL,
+        .encode_table = code_points,
+        .code_lengths = code_lengths,
+        .decode_table = &flat_decode_table,
+    },
+    {
+        .encode = encode_symbol,
+        .decode = canonical_decode_symbol,
+        .userdata = NULL,
+        .encode_table = code_points,
+        .code_lengths = code_lengths,
+        .canonical_table = &canonical_table,
+    },
+    {
+        .encode = encode_symbol,
+        .decode = table_decode_symbol,
+        .userdata = NULL,
+        .encode_table = code_points,
+        .code_lengths = code_lengths,
+        .decode_table = &table_decode_table,
+        .multi_symbol_table = &multi_symbol_table,
+    },
+    {
+        .encode = encode_symbol,
+        .decode = table_decode_symbol,
+        .userdata = NULL,
+        .encode_table = code_points,
+        .code_lengths = code_lengths,
+        .decode_table = &table_decode_table,
+        .fsm_table = &fsm_table,
+    },
+};
+
+static const char *const strategy_names[] = {
+    "tree",
+    "table",
+    "flat",
+    "canonical",
+    "multi_symbol",
+    "fsm",
+};
+
+/* The benchmark driver prints the definition that picks the fastest strategy on the machine it runs on */
+#ifndef TEST_AUTOTUNE_STRATEGY
+#    define TEST_AUTOTUNE_STRATEGY 1 /* table */
+#endif
+AWS_STATIC_ASSERT(TEST_AUTOTUNE_STRATEGY < AWS_ARRAY_SIZE(strategies));
+
+struct aws_huffman_symbol_coder *test_autotune_get_strategy_coder(size_t index) {
+    return index < AWS_ARRAY_SIZE(strategies) ? &strategies[index] : NULL;
+}
+
+const char *test_autotune_get_strategy_name(size_t index) {
+    return index < AWS_ARRAY_SIZE(strategy_names) ? strategy_names[index] : NULL;
+}
+
+struct aws_huffman_symbol_coder *test_autotune_get_coder(void) {
+    return &strategies[TEST_AUTOTUNE_STRATEGY];
+}
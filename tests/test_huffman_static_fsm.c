@@ -0,0 +1,3746 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+/* WARNING: THIS FILE WAS AUTOMATICALLY GENERATED. DO NOT EDIT. */
+/* clang-format off */
+
+#include <aws/compression/huffman.h>
+
+struct aws_huffman_symbol_coder *test_fsm_get_coder(void);
+
+static const struct aws_huffman_code code_points[] = {
+    { .pattern = 0x32e, .num_bits = 10 }, /* ' ' 0 */
+    { .pattern = 0x32f, .num_bits = 10 }, /* ' ' 1 */
+    { .pattern = 0x330, .num_bits = 10 }, /* ' ' 2 */
+    { .pattern = 0x331, .num_bits = 10 }, /* ' ' 3 */
+    { .pattern = 0x332, .num_bits = 10 }, /* ' ' 4 */
+    { .pattern = 0x333, .num_bits = 10 }, /* ' ' 5 */
+    { .pattern = 0x334, .num_bits = 10 }, /* ' ' 6 */
+    { .pattern = 0x335, .num_bits = 10 }, /* ' ' 7 */
+    { .pattern = 0x336, .num_bits = 10 }, /* ' ' 8 */
+    { .pattern = 0x337, .num_bits = 10 }, /* ' ' 9 */
+    { .pattern = 0xb8, .num_bits = 8 }, /* ' ' 10 */
+    { .pattern = 0x338, .num_bits = 10 }, /* ' ' 11 */
+    { .pattern = 0x339, .num_bits = 10 }, /* ' ' 12 */
+    { .pattern = 0x33a, .num_bits = 10 }, /* ' ' 13 */
+    { .pattern = 0x33b, .num_bits = 10 }, /* ' ' 14 */
+    { .pattern = 0x33c, .num_bits = 10 }, /* ' ' 15 */
+    { .pattern = 0x33d, .num_bits = 10 }, /* ' ' 16 */
+    { .pattern = 0x33e, .num_bits = 10 }, /* ' ' 17 */
+    { .pattern = 0x33f, .num_bits = 10 }, /* ' ' 18 */
+    { .pattern = 0x340, .num_bits = 10 }, /* ' ' 19 */
+    { .pattern = 0x341, .num_bits = 10 }, /* ' ' 20 */
+    { .pattern = 0x342, .num_bits = 10 }, /* ' ' 21 */
+    { .pattern = 0x343, .num_bits = 10 }, /* ' ' 22 */
+    { .pattern = 0x344, .num_bits = 10 }, /* ' ' 23 */
+    { .pattern = 0x345, .num_bits = 10 }, /* ' ' 24 */
+    { .pattern = 0x346, .num_bits = 10 }, /* ' ' 25 */
+    { .pattern = 0x347, .num_bits = 10 }, /* ' ' 26 */
+    { .pattern = 0x348, .num_bits = 10 }, /* ' ' 27 */
+    { .pattern = 0x349, .num_bits = 10 }, /* ' ' 28 */
+    { .pattern = 0x34a, .num_bits = 10 }, /* ' ' 29 */
+    { .pattern = 0x34b, .num_bits = 10 }, /* ' ' 30 */
+    { .pattern = 0x34c, .num_bits = 10 }, /* ' ' 31 */
+    { .pattern = 0x4, .num_bits = 5 }, /* ' ' 32 */
+    { .pattern = 0x34d, .num_bits = 10 }, /* '!' 33 */
+    { .pattern = 0x34e, .num_bits = 10 }, /* '"' 34 */
+    { .pattern = 0x34f, .num_bits = 10 }, /* '#' 35 */
+    { .pattern = 0x350, .num_bits = 10 }, /* '$' 36 */
+    { .pattern = 0x351, .num_bits = 10 }, /* '%' 37 */
+    { .pattern = 0x352, .num_bits = 10 }, /* '&' 38 */
+    { .pattern = 0x56, .num_bits = 7 }, /* ''' 39 */
+    { .pattern = 0x353, .num_bits = 10 }, /* '(' 40 */
+    { .pattern = 0x354, .num_bits = 10 }, /* ')' 41 */
+    { .pattern = 0x355, .num_bits = 10 }, /* '*' 42 */
+    { .pattern = 0x356, .num_bits = 10 }, /* '+' 43 */
+    { .pattern = 0xb9, .num_bits = 8 }, /* ',' 44 */
+    { .pattern = 0x188, .num_bits = 9 }, /* '-' 45 */
+    { .pattern = 0x57, .num_bits = 7 }, /* '.' 46 */
+    { .pattern = 0x357, .num_bits = 10 }, /* '/' 47 */
+    { .pattern = 0x358, .num_bits = 10 }, /* '0' 48 */
+    { .pattern = 0x359, .num_bits = 10 }, /* '1' 49 */
+    { .pattern = 0x35a, .num_bits = 10 }, /* '2' 50 */
+    { .pattern = 0x35b, .num_bits = 10 }, /* '3' 51 */
+    { .pattern = 0x35c, .num_bits = 10 }, /* '4' 52 */
+    { .pattern = 0x35d, .num_bits = 10 }, /* '5' 53 */
+    { .pattern = 0x35e, .num_bits = 10 }, /* '6' 54 */
+    { .pattern = 0x35f, .num_bits = 10 }, /* '7' 55 */
+    { .pattern = 0x360, .num_bits = 10 }, /* '8' 56 */
+    { .pattern = 0x361, .num_bits = 10 }, /* '9' 57 */
+    { .pattern = 0x362, .num_bits = 10 }, /* ':' 58 */
+    { .pattern = 0x363, .num_bits = 10 }, /* ';' 59 */
+    { .pattern = 0x364, .num_bits = 10 }, /* '<' 60 */
+    { .pattern = 0x365, .num_bits = 10 }, /* '=' 61 */
+    { .pattern = 0x366, .num_bits = 10 }, /* '>' 62 */
+    { .pattern = 0xba, .num_bits = 8 }, /* '?' 63 */
+    { .pattern = 0x367, .num_bits = 10 }, /* '@' 64 */
+    { .pattern = 0x368, .num_bits = 10 }, /* 'A' 65 */
+    { .pattern = 0xbb, .num_bits = 8 }, /* 'B' 66 */
+    { .pattern = 0x189, .num_bits = 9 }, /* 'C' 67 */
+    { .pattern = 0x18a, .num_bits = 9 }, /* 'D' 68 */
+    { .pattern = 0x18b, .num_bits = 9 }, /* 'E' 69 */
+    { .pattern = 0x18c, .num_bits = 9 }, /* 'F' 70 */
+    { .pattern = 0x18d, .num_bits = 9 }, /* 'G' 71 */
+    { .pattern = 0x18e, .num_bits = 9 }, /* 'H' 72 */
+    { .pattern = 0xbc, .num_bits = 8 }, /* 'I' 73 */
+    { .pattern = 0x369, .num_bits = 10 }, /* 'J' 74 */
+    { .pattern = 0x36a, .num_bits = 10 }, /* 'K' 75 */
+    { .pattern = 0x18f, .num_bits = 9 }, /* 'L' 76 */
+    { .pattern = 0x190, .num_bits = 9 }, /* 'M' 77 */
+    { .pattern = 0x36b, .num_bits = 10 }, /* 'N' 78 */
+    { .pattern = 0x36c, .num_bits = 10 }, /* 'O' 79 */
+    { .pattern = 0x191, .num_bits = 9 }, /* 'P' 80 */
+    { .pattern = 0x36d, .num_bits = 10 }, /* 'Q' 81 */
+    { .pattern = 0x36e, .num_bits = 10 }, /* 'R' 82 */
+    { .pattern = 0x36f, .num_bits = 10 }, /* 'S' 83 */
+    { .pattern = 0xbd, .num_bits = 8 }, /* 'T' 84 */
+    { .pattern = 0x370, .num_bits = 10 }, /* 'U' 85 */
+    { .pattern = 0x192, .num_bits = 9 }, /* 'V' 86 */
+    { .pattern = 0xbe, .num_bits = 8 }, /* 'W' 87 */
+    { .pattern = 0x371, .num_bits = 10 }, /* 'X' 88 */
+    { .pattern = 0x193, .num_bits = 9 }, /* 'Y' 89 */
+    { .pattern = 0x372, .num_bits = 10 }, /* 'Z' 90 */
+    { .pattern = 0x373, .num_bits = 10 }, /* '[' 91 */
+    { .pattern = 0x374, .num_bits = 10 }, /* '\' 92 */
+    { .pattern = 0x375, .num_bits = 10 }, /* ']' 93 */
+    { .pattern = 0x376, .num_bits = 10 }, /* '^' 94 */
+    { .pattern = 0x377, .num_bits = 10 }, /* '_' 95 */
+    { .pattern = 0x378, .num_bits = 10 }, /* '`' 96 */
+    { .pattern = 0x5, .num_bits = 5 }, /* 'a' 97 */
+    { .pattern = 0x58, .num_bits = 7 }, /* 'b' 98 */
+    { .pattern = 0x20, .num_bits = 6 }, /* 'c' 99 */
+    { .pattern = 0x21, .num_bits = 6 }, /* 'd' 100 */
+    { .pattern = 0x6, .num_bits = 5 }, /* 'e' 101 */
+    { .pattern = 0x22, .num_bits = 6 }, /* 'f' 102 */
+    { .pattern = 0x59, .num_bits = 7 }, /* 'g' 103 */
+    { .pattern = 0x23, .num_bits = 6 }, /* 'h' 104 */
+    { .pattern = 0x7, .num_bits = 5 }, /* 'i' 105 */
+    { .pattern = 0xbf, .num_bits = 8 }, /* 'j' 106 */
+    { .pattern = 0x24, .num_bits = 6 }, /* 'k' 107 */
+    { .pattern = 0x25, .num_bits = 6 }, /* 'l' 108 */
+    { .pattern = 0x26, .num_bits = 6 }, /* 'm' 109 */
+    { .pattern = 0x8, .num_bits = 5 }, /* 'n' 110 */
+    { .pattern = 0x9, .num_bits = 5 }, /* 'o' 111 */
+    { .pattern = 0x5a, .num_bits = 7 }, /* 'p' 112 */
+    { .pattern = 0x194, .num_bits = 9 }, /* 'q' 113 */
+    { .pattern = 0xa, .num_bits = 5 }, /* 'r' 114 */
+    { .pattern = 0xb, .num_bits = 5 }, /* 's' 115 */
+    { .pattern = 0xc, .num_bits = 5 }, /* 't' 116 */
+    { .pattern = 0xd, .num_bits = 5 }, /* 'u' 117 */
+    { .pattern = 0xc0, .num_bits = 8 }, /* 'v' 118 */
+    { .pattern = 0x27, .num_bits = 6 }, /* 'w' 119 */
+    { .pattern = 0xc1, .num_bits = 8 }, /* 'x' 120 */
+    { .pattern = 0x28, .num_bits = 6 }, /* 'y' 121 */
+    { .pattern = 0x379, .num_bits = 10 }, /* 'z' 122 */
+    { .pattern = 0x37a, .num_bits = 10 }, /* '{' 123 */
+    { .pattern = 0x37b, .num_bits = 10 }, /* '|' 124 */
+    { .pattern = 0x37c, .num_bits = 10 }, /* '}' 125 */
+    { .pattern = 0x37d, .num_bits = 10 }, /* '~' 126 */
+    { .pattern = 0x37e, .num_bits = 10 }, /* ' ' 127 */
+    { .pattern = 0x37f, .num_bits = 10 }, /* ' ' 128 */
+    { .pattern = 0x380, .num_bits = 10 }, /* ' ' 129 */
+    { .pattern = 0x381, .num_bits = 10 }, /* ' ' 130 */
+    { .pattern = 0x382, .num_bits = 10 }, /* ' ' 131 */
+    { .pattern = 0x383, .num_bits = 10 }, /* ' ' 132 */
+    { .pattern = 0x384, .num_bits = 10 }, /* ' ' 133 */
+    { .pattern = 0x385, .num_bits = 10 }, /* ' ' 134 */
+    { .pattern = 0x386, .num_bits = 10 }, /* ' ' 135 */
+    { .pattern = 0x387, .num_bits = 10 }, /* ' ' 136 */
+    { .pattern = 0x388, .num_bits = 10 }, /* ' ' 137 */
+    { .pattern = 0x389, .num_bits = 10 }, /* ' ' 138 */
+    { .pattern = 0x38a, .num_bits = 10 }, /* ' ' 139 */
+    { .pattern = 0x38b, .num_bits = 10 }, /* ' ' 140 */
+    { .pattern = 0x38c, .num_bits = 10 }, /* ' ' 141 */
+    { .pattern = 0x38d, .num_bits = 10 }, /* ' ' 142 */
+    { .pattern = 0x38e, .num_bits = 10 }, /* ' ' 143 */
+    { .pattern = 0x38f, .num_bits = 10 }, /* ' ' 144 */
+    { .pattern = 0x390, .num_bits = 10 }, /* ' ' 145 */
+    { .pattern = 0x391, .num_bits = 10 }, /* ' ' 146 */
+    { .pattern = 0x392, .num_bits = 10 }, /* ' ' 147 */
+    { .pattern = 0x393, .num_bits = 10 }, /* ' ' 148 */
+    { .pattern = 0x394, .num_bits = 10 }, /* ' ' 149 */
+    { .pattern = 0x395, .num_bits = 10 }, /* ' ' 150 */
+    { .pattern = 0x396, .num_bits = 10 }, /* ' ' 151 */
+    { .pattern = 0x397, .num_bits = 10 }, /* ' ' 152 */
+    { .pattern = 0x398, .num_bits = 10 }, /* ' ' 153 */
+    { .pattern = 0x399, .num_bits = 10 }, /* ' ' 154 */
+    { .pattern = 0x39a, .num_bits = 10 }, /* ' ' 155 */
+    { .pattern = 0x39b, .num_bits = 10 }, /* ' ' 156 */
+    { .pattern = 0x39c, .num_bits = 10 }, /* ' ' 157 */
+    { .pattern = 0x39d, .num_bits = 10 }, /* ' ' 158 */
+    { .pattern = 0x39e, .num_bits = 10 }, /* ' ' 159 */
+    { .pattern = 0x39f, .num_bits = 10 }, /* ' ' 160 */
+    { .pattern = 0x3a0, .num_bits = 10 }, /* ' ' 161 */
+    { .pattern = 0x3a1, .num_bits = 10 }, /* ' ' 162 */
+    { .pattern = 0x3a2, .num_bits = 10 }, /* ' ' 163 */
+    { .pattern = 0x3a3, .num_bits = 10 }, /* ' ' 164 */
+    { .pattern = 0x3a4, .num_bits = 10 }, /* ' ' 165 */
+    { .pattern = 0x3a5, .num_bits = 10 }, /* ' ' 166 */
+    { .pattern = 0x3a6, .num_bits = 10 }, /* ' ' 167 */
+    { .pattern = 0x3a7, .num_bits = 10 }, /* ' ' 168 */
+    { .pattern = 0x3a8, .num_bits = 10 }, /* ' ' 169 */
+    { .pattern = 0x3a9, .num_bits = 10 }, /* ' ' 170 */
+    { .pattern = 0x3aa, .num_bits = 10 }, /* ' ' 171 */
+    { .pattern = 0x3ab, .num_bits = 10 }, /* ' ' 172 */
+    { .pattern = 0x3ac, .num_bits = 10 }, /* ' ' 173 */
+    { .pattern = 0x3ad, .num_bits = 10 }, /* ' ' 174 */
+    { .pattern = 0x3ae, .num_bits = 10 }, /* ' ' 175 */
+    { .pattern = 0x3af, .num_bits = 10 }, /* ' ' 176 */
+    { .pattern = 0x3b0, .num_bits = 10 }, /* ' ' 177 */
+    { .pattern = 0x3b1, .num_bits = 10 }, /* ' ' 178 */
+    { .pattern = 0x3b2, .num_bits = 10 }, /* ' ' 179 */
+    { .pattern = 0x3b3, .num_bits = 10 }, /* ' ' 180 */
+    { .pattern = 0x3b4, .num_bits = 10 }, /* ' ' 181 */
+    { .pattern = 0x3b5, .num_bits = 10 }, /* ' ' 182 */
+    { .pattern = 0x3b6, .num_bits = 10 }, /* ' ' 183 */
+    { .pattern = 0x3b7, .num_bits = 10 }, /* ' ' 184 */
+    { .pattern = 0x3b8, .num_bits = 10 }, /* ' ' 185 */
+    { .pattern = 0x3b9, .num_bits = 10 }, /* ' ' 186 */
+    { .pattern = 0x3ba, .num_bits = 10 }, /* ' ' 187 */
+    { .pattern = 0x3bb, .num_bits = 10 }, /* ' ' 188 */
+    { .pattern = 0x3bc, .num_bits = 10 }, /* ' ' 189 */
+    { .pattern = 0x3bd, .num_bits = 10 }, /* ' ' 190 */
+    { .pattern = 0x3be, .num_bits = 10 }, /* ' ' 191 */
+    { .pattern = 0x3bf, .num_bits = 10 }, /* ' ' 192 */
+    { .pattern = 0x3c0, .num_bits = 10 }, /* ' ' 193 */
+    { .pattern = 0x3c1, .num_bits = 10 }, /* ' ' 194 */
+    { .pattern = 0x3c2, .num_bits = 10 }, /* ' ' 195 */
+    { .pattern = 0x3c3, .num_bits = 10 }, /* ' ' 196 */
+    { .pattern = 0x3c4, .num_bits = 10 }, /* ' ' 197 */
+    { .pattern = 0x3c5, .num_bits = 10 }, /* ' ' 198 */
+    { .pattern = 0x3c6, .num_bits = 10 }, /* ' ' 199 */
+    { .pattern = 0x3c7, .num_bits = 10 }, /* ' ' 200 */
+    { .pattern = 0x3c8, .num_bits = 10 }, /* ' ' 201 */
+    { .pattern = 0x3c9, .num_bits = 10 }, /* ' ' 202 */
+    { .pattern = 0x3ca, .num_bits = 10 }, /* ' ' 203 */
+    { .pattern = 0x3cb, .num_bits = 10 }, /* ' ' 204 */
+    { .pattern = 0x3cc, .num_bits = 10 }, /* ' ' 205 */
+    { .pattern = 0x3cd, .num_bits = 10 }, /* ' ' 206 */
+    { .pattern = 0x3ce, .num_bits = 10 }, /* ' ' 207 */
+    { .pattern = 0x3cf, .num_bits = 10 }, /* ' ' 208 */
+    { .pattern = 0x3d0, .num_bits = 10 }, /* ' ' 209 */
+    { .pattern = 0x3d1, .num_bits = 10 }, /* ' ' 210 */
+    { .pattern = 0x3d2, .num_bits = 10 }, /* ' ' 211 */
+    { .pattern = 0x3d3, .num_bits = 10 }, /* ' ' 212 */
+    { .pattern = 0x3d4, .num_bits = 10 }, /* ' ' 213 */
+    { .pattern = 0x3d5, .num_bits = 10 }, /* ' ' 214 */
+    { .pattern = 0x3d6, .num_bits = 10 }, /* ' ' 215 */
+    { .pattern = 0x3d7, .num_bits = 10 }, /* ' ' 216 */
+    { .pattern = 0x3d8, .num_bits = 10 }, /* ' ' 217 */
+    { .pattern = 0x3d9, .num_bits = 10 }, /* ' ' 218 */
+    { .pattern = 0x3da, .num_bits = 10 }, /* ' ' 219 */
+    { .pattern = 0x3db, .num_bits = 10 }, /* ' ' 220 */
+    { .pattern = 0x3dc, .num_bits = 10 }, /* ' ' 221 */
+    { .pattern = 0x3dd, .num_bits = 10 }, /* ' ' 222 */
+    { .pattern = 0x3de, .num_bits = 10 }, /* ' ' 223 */
+    { .pattern = 0x3df, .num_bits = 10 }, /* ' ' 224 */
+    { .pattern = 0x3e0, .num_bits = 10 }, /* ' ' 225 */
+    { .pattern = 0x3e1, .num_bits = 10 }, /* ' ' 226 */
+    { .pattern = 0x3e2, .num_bits = 10 }, /* ' ' 227 */
+    { .pattern = 0x3e3, .num_bits = 10 }, /* ' ' 228 */
+    { .pattern = 0x3e4, .num_bits = 10 }, /* ' ' 229 */
+    { .pattern = 0x3e5, .num_bits = 10 }, /* ' ' 230 */
+    { .pattern = 0x3e6, .num_bits = 10 }, /* ' ' 231 */
+    { .pattern = 0x3e7, .num_bits = 10 }, /* ' ' 232 */
+    { .pattern = 0x3e8, .num_bits = 10 }, /* ' ' 233 */
+    { .pattern = 0x3e9, .num_bits = 10 }, /* ' ' 234 */
+    { .pattern = 0x3ea, .num_bits = 10 }, /* ' ' 235 */
+    { .pattern = 0x3eb, .num_bits = 10 }, /* ' ' 236 */
+    { .pattern = 0x3ec, .num_bits = 10 }, /* ' ' 237 */
+    { .pattern = 0x3ed, .num_bits = 10 }, /* ' ' 238 */
+    { .pattern = 0x3ee, .num_bits = 10 }, /* ' ' 239 */
+    { .pattern = 0x3ef, .num_bits = 10 }, /* ' ' 240 */
+    { .pattern = 0x3f0, .num_bits = 10 }, /* ' ' 241 */
+    { .pattern = 0x3f1, .num_bits = 10 }, /* ' ' 242 */
+    { .pattern = 0x3f2, .num_bits = 10 }, /* ' ' 243 */
+    { .pattern = 0x3f3, .num_bits = 10 }, /* ' ' 244 */
+    { .pattern = 0x3f4, .num_bits = 10 }, /* ' ' 245 */
+    { .pattern = 0x3f5, .num_bits = 10 }, /* ' ' 246 */
+    { .pattern = 0x3f6, .num_bits = 10 }, /* ' ' 247 */
+    { .pattern = 0x3f7, .num_bits = 10 }, /* ' ' 248 */
+    { .pattern = 0x3f8, .num_bits = 10 }, /* ' ' 249 */
+    { .pattern = 0x3f9, .num_bits = 10 }, /* ' ' 250 */
+    { .pattern = 0x3fa, .num_bits = 10 }, /* ' ' 251 */
+    { .pattern = 0x3fb, .num_bits = 10 }, /* ' ' 252 */
+    { .pattern = 0x3fc, .num_bits = 10 }, /* ' ' 253 */
+    { .pattern = 0x3fd, .num_bits = 10 }, /* ' ' 254 */
+    { .pattern = 0x3fe, .num_bits = 10 }, /* ' ' 255 */
+};
+
+static struct aws_huffman_code encode_symbol(uint8_t symbol, void *userdata) {
+    (void)userdata;
+
+    return code_points[symbol];
+}
+
+static const uint8_t code_lengths[] = {
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  8, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+     5, 10, 10, 10, 10, 10, 10,  7, 10, 10, 10, 10,  8,  9,  7, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  8,
+    10, 10,  8,  9,  9,  9,  9,  9,  9,  8, 10, 10,  9,  9, 10, 10,
+     9, 10, 10, 10,  8, 10,  9,  8, 10,  9, 10, 10, 10, 10, 10, 10,
+    10,  5,  7,  6,  6,  5,  6,  7,  6,  5,  8,  6,  6,  6,  5,  5,
+     7,  9,  5,  5,  5,  5,  8,  6,  8,  6, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+};
+
+/* NOLINTNEXTLINE(readability-function-size) */
+static uint8_t decode_symbol(uint32_t bits, uint8_t *symbol, void *userdata) {
+    (void)userdata;
+
+    if (bits & 0x80000000) {
+        goto node_1;
+    } else {
+        goto node_0;
+    }
+
+node_0:
+    if (bits & 0x40000000) {
+        goto node_01;
+    } else {
+        goto node_00;
+    }
+
+node_00:
+    if (bits & 0x20000000) {
+        goto node_001;
+    } else {
+        return 0; /* invalid node */
+    }
+
+node_001:
+    if (bits & 0x10000000) {
+        goto node_0011;
+    } else {
+        goto node_0010;
+    }
+
+node_0010:
+    if (bits & 0x8000000) {
+        *symbol = 97;
+        return 5;
+    } else {
+        *symbol = 32;
+        return 5;
+    }
+
+node_0011:
+    if (bits & 0x8000000) {
+        *symbol = 105;
+        return 5;
+    } else {
+        *symbol = 101;
+        return 5;
+    }
+
+node_01:
+    if (bits & 0x20000000) {
+        goto node_011;
+    } else {
+        goto node_010;
+    }
+
+node_010:
+    if (bits & 0x10000000) {
+        goto node_0101;
+    } else {
+        goto node_0100;
+    }
+
+node_0100:
+    if (bits & 0x8000000) {
+        *symbol = 111;
+        return 5;
+    } else {
+        *symbol = 110;
+        return 5;
+    }
+
+node_0101:
+    if (bits & 0x8000000) {
+        *symbol = 115;
+        return 5;
+    } else {
+        *symbol = 114;
+        return 5;
+    }
+
+node_011:
+    if (bits & 0x10000000) {
+        return 0; /* invalid node */
+    } else {
+        goto node_0110;
+    }
+
+node_0110:
+    if (bits & 0x8000000) {
+        *symbol = 117;
+        return 5;
+    } else {
+        *symbol = 116;
+        return 5;
+    }
+
+node_1:
+    if (bits & 0x40000000) {
+        goto node_11;
+    } else {
+        goto node_10;
+    }
+
+node_10:
+    if (bits & 0x20000000) {
+        goto node_101;
+    } else {
+        goto node_100;
+    }
+
+node_100:
+    if (bits & 0x10000000) {
+        goto node_1001;
+    } else {
+        goto node_1000;
+    }
+
+node_1000:
+    if (bits & 0x8000000) {
+        goto node_10001;
+    } else {
+        goto node_10000;
+    }
+
+node_10000:
+    if (bits & 0x4000000) {
+        *symbol = 100;
+        return 6;
+    } else {
+        *symbol = 99;
+        return 6;
+    }
+
+node_10001:
+    if (bits & 0x4000000) {
+        *symbol = 104;
+        return 6;
+    } else {
+        *symbol = 102;
+        return 6;
+    }
+
+node_1001:
+    if (bits & 0x8000000) {
+        goto node_10011;
+    } else {
+        goto node_10010;
+    }
+
+node_10010:
+    if (bits & 0x4000000) {
+        *symbol = 108;
+        return 6;
+    } else {
+        *symbol = 107;
+        return 6;
+    }
+
+node_10011:
+    if (bits & 0x4000000) {
+        *symbol = 119;
+        return 6;
+    } else {
+        *symbol = 109;
+        return 6;
+    }
+
+node_101:
+    if (bits & 0x10000000) {
+        goto node_1011;
+    } else {
+        goto node_1010;
+    }
+
+node_1010:
+    if (bits & 0x8000000) {
+        goto node_10101;
+    } else {
+        goto node_10100;
+    }
+
+node_10100:
+    if (bits & 0x4000000) {
+        return 0; /* invalid node */
+    } else {
+        *symbol = 121;
+        return 6;
+    }
+
+node_10101:
+    if (bits & 0x4000000) {
+        goto node_101011;
+    } else {
+        return 0; /* invalid node */
+    }
+
+node_101011:
+    if (bits & 0x2000000) {
+        *symbol = 46;
+        return 7;
+    } else {
+        *symbol = 39;
+        return 7;
+    }
+
+node_1011:
+    if (bits & 0x8000000) {
+        goto node_10111;
+    } else {
+        goto node_10110;
+    }
+
+node_10110:
+    if (bits & 0x4000000) {
+        goto node_101101;
+    } else {
+        goto node_101100;
+    }
+
+node_101100:
+    if (bits & 0x2000000) {
+        *symbol = 103;
+        return 7;
+    } else {
+        *symbol = 98;
+        return 7;
+    }
+
+node_101101:
+    if (bits & 0x2000000) {
+        return 0; /* invalid node */
+    } else {
+        *symbol = 112;
+        return 7;
+    }
+
+node_10111:
+    if (bits & 0x4000000) {
+        goto node_101111;
+    } else {
+        goto node_101110;
+    }
+
+node_101110:
+    if (bits & 0x2000000) {
+        goto node_1011101;
+    } else {
+        goto node_1011100;
+    }
+
+node_1011100:
+    if (bits & 0x1000000) {
+        *symbol = 44;
+        return 8;
+    } else {
+        *symbol = 10;
+        return 8;
+    }
+
+node_1011101:
+    if (bits & 0x1000000) {
+        *symbol = 66;
+        return 8;
+    } else {
+        *symbol = 63;
+        return 8;
+    }
+
+node_101111:
+    if (bits & 0x2000000) {
+        goto node_1011111;
+    } else {
+        goto node_1011110;
+    }
+
+node_1011110:
+    if (bits & 0x1000000) {
+        *symbol = 84;
+        return 8;
+    } else {
+        *symbol = 73;
+        return 8;
+    }
+
+node_1011111:
+    if (bits & 0x1000000) {
+        *symbol = 106;
+        return 8;
+    } else {
+        *symbol = 87;
+        return 8;
+    }
+
+node_11:
+    if (bits & 0x20000000) {
+        goto node_111;
+    } else {
+        goto node_110;
+    }
+
+node_110:
+    if (bits & 0x10000000) {
+        goto node_1101;
+    } else {
+        goto node_1100;
+    }
+
+node_1100:
+    if (bits & 0x8000000) {
+        goto node_11001;
+    } else {
+        goto node_11000;
+    }
+
+node_11000:
+    if (bits & 0x4000000) {
+        goto node_110001;
+    } else {
+        goto node_110000;
+    }
+
+node_110000:
+    if (bits & 0x2000000) {
+        return 0; /* invalid node */
+    } else {
+        goto node_1100000;
+    }
+
+node_1100000:
+    if (bits & 0x1000000) {
+        *symbol = 120;
+        return 8;
+    } else {
+        *symbol = 118;
+        return 8;
+    }
+
+node_110001:
+    if (bits & 0x2000000) {
+        goto node_1100011;
+    } else {
+        goto node_1100010;
+    }
+
+node_1100010:
+    if (bits & 0x1000000) {
+        goto node_11000101;
+    } else {
+        goto node_11000100;
+    }
+
+node_11000100:
+    if (bits & 0x800000) {
+        *symbol = 67;
+        return 9;
+    } else {
+        *symbol = 45;
+        return 9;
+    }
+
+node_11000101:
+    if (bits & 0x800000) {
+        *symbol = 69;
+        return 9;
+    } else {
+        *symbol = 68;
+        return 9;
+    }
+
+node_1100011:
+    if (bits & 0x1000000) {
+        goto node_11000111;
+    } else {
+        goto node_11000110;
+    }
+
+node_11000110:
+    if (bits & 0x800000) {
+        *symbol = 71;
+        return 9;
+    } else {
+        *symbol = 70;
+        return 9;
+    }
+
+node_11000111:
+    if (bits & 0x800000) {
+        *symbol = 76;
+        return 9;
+    } else {
+        *symbol = 72;
+        return 9;
+    }
+
+node_11001:
+    if (bits & 0x4000000) {
+        goto node_110011;
+    } else {
+        goto node_110010;
+    }
+
+node_110010:
+    if (bits & 0x2000000) {
+        goto node_1100101;
+    } else {
+        goto node_1100100;
+    }
+
+node_1100100:
+    if (bits & 0x1000000) {
+        goto node_11001001;
+    } else {
+        goto node_11001000;
+    }
+
+node_11001000:
+    if (bits & 0x800000) {
+        *symbol = 80;
+        return 9;
+    } else {
+        *symbol = 77;
+        return 9;
+    }
+
+node_11001001:
+    if (bits & 0x800000) {
+        *symbol = 89;
+        return 9;
+    } else {
+        *symbol = 86;
+        return 9;
+    }
+
+node_1100101:
+    if (bits & 0x1000000) {
+        goto node_11001011;
+    } else {
+        goto node_11001010;
+    }
+
+node_11001010:
+    if (bits & 0x800000) {
+        return 0; /* invalid node */
+    } else {
+        *symbol = 113;
+        return 9;
+    }
+
+node_11001011:
+    if (bits & 0x800000) {
+        goto node_110010111;
+    } else {
+        return 0; /* invalid node */
+    }
+
+node_110010111:
+    if (bits & 0x400000) {
+        *symbol = 1;
+        return 10;
+    } else {
+        *symbol = 0;
+        return 10;
+    }
+
+node_110011:
+    if (bits & 0x2000000) {
+        goto node_1100111;
+    } else {
+        goto node_1100110;
+    }
+
+node_1100110:
+    if (bits & 0x1000000) {
+        goto node_11001101;
+    } else {
+        goto node_11001100;
+    }
+
+node_11001100:
+    if (bits & 0x800000) {
+        goto node_110011001;
+    } else {
+        goto node_110011000;
+    }
+
+node_110011000:
+    if (bits & 0x400000) {
+        *symbol = 3;
+        return 10;
+    } else {
+        *symbol = 2;
+        return 10;
+    }
+
+node_110011001:
+    if (bits & 0x400000) {
+        *symbol = 5;
+        return 10;
+    } else {
+        *symbol = 4;
+        return 10;
+    }
+
+node_11001101:
+    if (bits & 0x800000) {
+        goto node_110011011;
+    } else {
+        goto node_110011010;
+    }
+
+node_110011010:
+    if (bits & 0x400000) {
+        *symbol = 7;
+        return 10;
+    } else {
+        *symbol = 6;
+        return 10;
+    }
+
+node_110011011:
+    if (bits & 0x400000) {
+        *symbol = 9;
+        return 10;
+    } else {
+        *symbol = 8;
+        return 10;
+    }
+
+node_1100111:
+    if (bits & 0x1000000) {
+        goto node_11001111;
+    } else {
+        goto node_11001110;
+    }
+
+node_11001110:
+    if (bits & 0x800000) {
+        goto node_110011101;
+    } else {
+        goto node_110011100;
+    }
+
+node_110011100:
+    if (bits & 0x400000) {
+        *symbol = 12;
+        return 10;
+    } else {
+        *symbol = 11;
+        return 10;
+    }
+
+node_110011101:
+    if (bits & 0x400000) {
+        *symbol = 14;
+        return 10;
+    } else {
+        *symbol = 13;
+        return 10;
+    }
+
+node_11001111:
+    if (bits & 0x800000) {
+        goto node_110011111;
+    } else {
+        goto node_110011110;
+    }
+
+node_110011110:
+    if (bits & 0x400000) {
+        *symbol = 16;
+        return 10;
+    } else {
+        *symbol = 15;
+        return 10;
+    }
+
+node_110011111:
+    if (bits & 0x400000) {
+        *symbol = 18;
+        return 10;
+    } else {
+        *symbol = 17;
+        return 10;
+    }
+
+node_1101:
+    if (bits & 0x8000000) {
+        goto node_11011;
+    } else {
+        goto node_11010;
+    }
+
+node_11010:
+    if (bits & 0x4000000) {
+        goto node_110101;
+    } else {
+        goto node_110100;
+    }
+
+node_110100:
+    if (bits & 0x2000000) {
+        goto node_1101001;
+    } else {
+        goto node_1101000;
+    }
+
+node_1101000:
+    if (bits & 0x1000000) {
+        goto node_11010001;
+    } else {
+        goto node_11010000;
+    }
+
+node_11010000:
+    if (bits & 0x800000) {
+        goto node_110100001;
+    } else {
+        goto node_110100000;
+    }
+
+node_110100000:
+    if (bits & 0x400000) {
+        *symbol = 20;
+        return 10;
+    } else {
+        *symbol = 19;
+        return 10;
+    }
+
+node_110100001:
+    if (bits & 0x400000) {
+        *symbol = 22;
+        return 10;
+    } else {
+        *symbol = 21;
+        return 10;
+    }
+
+node_11010001:
+    if (bits & 0x800000) {
+        goto node_110100011;
+    } else {
+        goto node_110100010;
+    }
+
+node_110100010:
+    if (bits & 0x400000) {
+        *symbol = 24;
+        return 10;
+    } else {
+        *symbol = 23;
+        return 10;
+    }
+
+node_110100011:
+    if (bits & 0x400000) {
+        *symbol = 26;
+        return 10;
+    } else {
+        *symbol = 25;
+        return 10;
+    }
+
+node_1101001:
+    if (bits & 0x1000000) {
+        goto node_11010011;
+    } else {
+        goto node_11010010;
+    }
+
+node_11010010:
+    if (bits & 0x800000) {
+        goto node_110100101;
+    } else {
+        goto node_110100100;
+    }
+
+node_110100100:
+    if (bits & 0x400000) {
+        *symbol = 28;
+        return 10;
+    } else {
+        *symbol = 27;
+        return 10;
+    }
+
+node_110100101:
+    if (bits & 0x400000) {
+        *symbol = 30;
+        return 10;
+    } else {
+        *symbol = 29;
+        return 10;
+    }
+
+node_11010011:
+    if (bits & 0x800000) {
+        goto node_110100111;
+    } else {
+        goto node_110100110;
+    }
+
+node_110100110:
+    if (bits & 0x400000) {
+        *symbol = 33;
+        return 10;
+    } else {
+        *symbol = 31;
+        return 10;
+    }
+
+node_110100111:
+    if (bits & 0x400000) {
+        *symbol = 35;
+        return 10;
+    } else {
+        *symbol = 34;
+        return 10;
+    }
+
+node_110101:
+    if (bits & 0x2000000) {
+        goto node_1101011;
+    } else {
+        goto node_1101010;
+    }
+
+node_1101010:
+    if (bits & 0x1000000) {
+        goto node_11010101;
+    } else {
+        goto node_11010100;
+    }
+
+node_11010100:
+    if (bits & 0x800000) {
+        goto node_110101001;
+    } else {
+        goto node_110101000;
+    }
+
+node_110101000:
+    if (bits & 0x400000) {
+        *symbol = 37;
+        return 10;
+    } else {
+        *symbol = 36;
+        return 10;
+    }
+
+node_110101001:
+    if (bits & 0x400000) {
+        *symbol = 40;
+        return 10;
+    } else {
+        *symbol = 38;
+        return 10;
+    }
+
+node_11010101:
+    if (bits & 0x800000) {
+        goto node_110101011;
+    } else {
+        goto node_110101010;
+    }
+
+node_110101010:
+    if (bits & 0x400000) {
+        *symbol = 42;
+        return 10;
+    } else {
+        *symbol = 41;
+        return 10;
+    }
+
+node_110101011:
+    if (bits & 0x400000) {
+        *symbol = 47;
+        return 10;
+    } else {
+        *symbol = 43;
+        return 10;
+    }
+
+node_1101011:
+    if (bits & 0x1000000) {
+        goto node_11010111;
+    } else {
+        goto node_11010110;
+    }
+
+node_11010110:
+    if (bits & 0x800000) {
+        goto node_110101101;
+    } else {
+        goto node_110101100;
+    }
+
+node_110101100:
+    if (bits & 0x400000) {
+        *symbol = 49;
+        return 10;
+    } else {
+        *symbol = 48;
+        return 10;
+    }
+
+node_110101101:
+    if (bits & 0x400000) {
+        *symbol = 51;
+        return 10;
+    } else {
+        *symbol = 50;
+        return 10;
+    }
+
+node_11010111:
+    if (bits & 0x800000) {
+        goto node_110101111;
+    } else {
+        goto node_110101110;
+    }
+
+node_110101110:
+    if (bits & 0x400000) {
+        *symbol = 53;
+        return 10;
+    } else {
+        *symbol = 52;
+        return 10;
+    }
+
+node_110101111:
+    if (bits & 0x400000) {
+        *symbol = 55;
+        return 10;
+    } else {
+        *symbol = 54;
+        return 10;
+    }
+
+node_11011:
+    if (bits & 0x4000000) {
+        goto node_110111;
+    } else {
+        goto node_110110;
+    }
+
+node_110110:
+    if (bits & 0x2000000) {
+        goto node_1101101;
+    } else {
+        goto node_1101100;
+    }
+
+node_1101100:
+    if (bits & 0x1000000) {
+        goto node_11011001;
+    } else {
+        goto node_11011000;
+    }
+
+node_11011000:
+    if (bits & 0x800000) {
+        goto node_110110001;
+    } else {
+        goto node_110110000;
+    }
+
+node_110110000:
+    if (bits & 0x400000) {
+        *symbol = 57;
+        return 10;
+    } else {
+        *symbol = 56;
+        return 10;
+    }
+
+node_110110001:
+    if (bits & 0x400000) {
+        *symbol = 59;
+        return 10;
+    } else {
+        *symbol = 58;
+        return 10;
+    }
+
+node_11011001:
+    if (bits & 0x800000) {
+        goto node_110110011;
+    } else {
+        goto node_110110010;
+    }
+
+node_110110010:
+    if (bits & 0x400000) {
+        *symbol = 61;
+        return 10;
+    } else {
+        *symbol = 60;
+        return 10;
+    }
+
+node_110110011:
+    if (bits & 0x400000) {
+        *symbol = 64;
+        return 10;
+    } else {
+        *symbol = 62;
+        return 10;
+    }
+
+node_1101101:
+    if (bits & 0x1000000) {
+        goto node_11011011;
+    } else {
+        goto node_11011010;
+    }
+
+node_11011010:
+    if (bits & 0x800000) {
+        goto node_110110101;
+    } else {
+        goto node_110110100;
+    }
+
+node_110110100:
+    if (bits & 0x400000) {
+        *symbol = 74;
+        return 10;
+    } else {
+        *symbol = 65;
+        return 10;
+    }
+
+node_110110101:
+    if (bits & 0x400000) {
+        *symbol = 78;
+        return 10;
+    } else {
+        *symbol = 75;
+        return 10;
+    }
+
+node_11011011:
+    if (bits & 0x800000) {
+        goto node_110110111;
+    } else {
+        goto node_110110110;
+    }
+
+node_110110110:
+    if (bits & 0x400000) {
+        *symbol = 81;
+        return 10;
+    } else {
+        *symbol = 79;
+        return 10;
+    }
+
+node_110110111:
+    if (bits & 0x400000) {
+        *symbol = 83;
+        return 10;
+    } else {
+        *symbol = 82;
+        return 10;
+    }
+
+node_110111:
+    if (bits & 0x2000000) {
+        goto node_1101111;
+    } else {
+        goto node_1101110;
+    }
+
+node_1101110:
+    if (bits & 0x1000000) {
+        goto node_11011101;
+    } else {
+        goto node_11011100;
+    }
+
+node_11011100:
+    if (bits & 0x800000) {
+        goto node_110111001;
+    } else {
+        goto node_110111000;
+    }
+
+node_110111000:
+    if (bits & 0x400000) {
+        *symbol = 88;
+        return 10;
+    } else {
+        *symbol = 85;
+        return 10;
+    }
+
+node_110111001:
+    if (bits & 0x400000) {
+        *symbol = 91;
+        return 10;
+    } else {
+        *symbol = 90;
+        return 10;
+    }
+
+node_11011101:
+    if (bits & 0x800000) {
+        goto node_110111011;
+    } else {
+        goto node_110111010;
+    }
+
+node_110111010:
+    if (bits & 0x400000) {
+        *symbol = 93;
+        return 10;
+    } else {
+        *symbol = 92;
+        return 10;
+    }
+
+node_110111011:
+    if (bits & 0x400000) {
+        *symbol = 95;
+        return 10;
+    } else {
+        *symbol = 94;
+        return 10;
+    }
+
+node_1101111:
+    if (bits & 0x1000000) {
+        goto node_11011111;
+    } else {
+        goto node_11011110;
+    }
+
+node_11011110:
+    if (bits & 0x800000) {
+        goto node_110111101;
+    } else {
+        goto node_110111100;
+    }
+
+node_110111100:
+    if (bits & 0x400000) {
+        *symbol = 122;
+        return 10;
+    } else {
+        *symbol = 96;
+        return 10;
+    }
+
+node_110111101:
+    if (bits & 0x400000) {
+        *symbol = 124;
+        return 10;
+    } else {
+        *symbol = 123;
+        return 10;
+    }
+
+node_11011111:
+    if (bits & 0x800000) {
+        goto node_110111111;
+    } else {
+        goto node_110111110;
+    }
+
+node_110111110:
+    if (bits & 0x400000) {
+        *symbol = 126;
+        return 10;
+    } else {
+        *symbol = 125;
+        return 10;
+    }
+
+node_110111111:
+    if (bits & 0x400000) {
+        *symbol = 128;
+        return 10;
+    } else {
+        *symbol = 127;
+        return 10;
+    }
+
+node_111:
+    if (bits & 0x10000000) {
+        goto node_1111;
+    } else {
+        goto node_1110;
+    }
+
+node_1110:
+    if (bits & 0x8000000) {
+        goto node_11101;
+    } else {
+        goto node_11100;
+    }
+
+node_11100:
+    if (bits & 0x4000000) {
+        goto node_111001;
+    } else {
+        goto node_111000;
+    }
+
+node_111000:
+    if (bits & 0x2000000) {
+        goto node_1110001;
+    } else {
+        goto node_1110000;
+    }
+
+node_1110000:
+    if (bits & 0x1000000) {
+        goto node_11100001;
+    } else {
+        goto node_11100000;
+    }
+
+node_11100000:
+    if (bits & 0x800000) {
+        goto node_111000001;
+    } else {
+        goto node_111000000;
+    }
+
+node_111000000:
+    if (bits & 0x400000) {
+        *symbol = 130;
+        return 10;
+    } else {
+        *symbol = 129;
+        return 10;
+    }
+
+node_111000001:
+    if (bits & 0x400000) {
+        *symbol = 132;
+        return 10;
+    } else {
+        *symbol = 131;
+        return 10;
+    }
+
+node_11100001:
+    if (bits & 0x800000) {
+        goto node_111000011;
+    } else {
+        goto node_111000010;
+    }
+
+node_111000010:
+    if (bits & 0x400000) {
+        *symbol = 134;
+        return 10;
+    } else {
+        *symbol = 133;
+        return 10;
+    }
+
+node_111000011:
+    if (bits & 0x400000) {
+        *symbol = 136;
+        return 10;
+    } else {
+        *symbol = 135;
+        return 10;
+    }
+
+node_1110001:
+    if (bits & 0x1000000) {
+        goto node_11100011;
+    } else {
+        goto node_11100010;
+    }
+
+node_11100010:
+    if (bits & 0x800000) {
+        goto node_111000101;
+    } else {
+        goto node_111000100;
+    }
+
+node_111000100:
+    if (bits & 0x400000) {
+        *symbol = 138;
+        return 10;
+    } else {
+        *symbol = 137;
+        return 10;
+    }
+
+node_111000101:
+    if (bits & 0x400000) {
+        *symbol = 140;
+        return 10;
+    } else {
+        *symbol = 139;
+        return 10;
+    }
+
+node_11100011:
+    if (bits & 0x800000) {
+        goto node_111000111;
+    } else {
+        goto node_111000110;
+    }
+
+node_111000110:
+    if (bits & 0x400000) {
+        *symbol = 142;
+        return 10;
+    } else {
+        *symbol = 141;
+        return 10;
+    }
+
+node_111000111:
+    if (bits & 0x400000) {
+        *symbol = 144;
+        return 10;
+    } else {
+        *symbol = 143;
+        return 10;
+    }
+
+node_111001:
+    if (bits & 0x2000000) {
+        goto node_1110011;
+    } else {
+        goto node_1110010;
+    }
+
+node_1110010:
+    if (bits & 0x1000000) {
+        goto node_11100101;
+    } else {
+        goto node_11100100;
+    }
+
+node_11100100:
+    if (bits & 0x800000) {
+        goto node_111001001;
+    } else {
+        goto node_111001000;
+    }
+
+node_111001000:
+    if (bits & 0x400000) {
+        *symbol = 146;
+        return 10;
+    } else {
+        *symbol = 145;
+        return 10;
+    }
+
+node_111001001:
+    if (bits & 0x400000) {
+        *symbol = 148;
+        return 10;
+    } else {
+        *symbol = 147;
+        return 10;
+    }
+
+node_11100101:
+    if (bits & 0x800000) {
+        goto node_111001011;
+    } else {
+        goto node_111001010;
+    }
+
+node_111001010:
+    if (bits & 0x400000) {
+        *symbol = 150;
+        return 10;
+    } else {
+        *symbol = 149;
+        return 10;
+    }
+
+node_111001011:
+    if (bits & 0x400000) {
+        *symbol = 152;
+        return 10;
+    } else {
+        *symbol = 151;
+        return 10;
+    }
+
+node_1110011:
+    if (bits & 0x1000000) {
+        goto node_11100111;
+    } else {
+        goto node_11100110;
+    }
+
+node_11100110:
+    if (bits & 0x800000) {
+        goto node_111001101;
+    } else {
+        goto node_111001100;
+    }
+
+node_111001100:
+    if (bits & 0x400000) {
+        *symbol = 154;
+        return 10;
+    } else {
+        *symbol = 153;
+        return 10;
+    }
+
+node_111001101:
+    if (bits & 0x400000) {
+        *symbol = 156;
+        return 10;
+    } else {
+        *symbol = 155;
+        return 10;
+    }
+
+node_11100111:
+    if (bits & 0x800000) {
+        goto node_111001111;
+    } else {
+        goto node_111001110;
+    }
+
+node_111001110:
+    if (bits & 0x400000) {
+        *symbol = 158;
+        return 10;
+    } else {
+        *symbol = 157;
+        return 10;
+    }
+
+node_111001111:
+    if (bits & 0x400000) {
+        *symbol = 160;
+        return 10;
+    } else {
+        *symbol = 159;
+        return 10;
+    }
+
+node_11101:
+    if (bits & 0x4000000) {
+        goto node_111011;
+    } else {
+        goto node_111010;
+    }
+
+node_111010:
+    if (bits & 0x2000000) {
+        goto node_1110101;
+    } else {
+        goto node_1110100;
+    }
+
+node_1110100:
+    if (bits & 0x1000000) {
+        goto node_11101001;
+    } else {
+        goto node_11101000;
+    }
+
+node_11101000:
+    if (bits & 0x800000) {
+        goto node_111010001;
+    } else {
+        goto node_111010000;
+    }
+
+node_111010000:
+    if (bits & 0x400000) {
+        *symbol = 162;
+        return 10;
+    } else {
+        *symbol = 161;
+        return 10;
+    }
+
+node_111010001:
+    if (bits & 0x400000) {
+        *symbol = 164;
+        return 10;
+    } else {
+        *symbol = 163;
+        return 10;
+    }
+
+node_11101001:
+    if (bits & 0x800000) {
+        goto node_111010011;
+    } else {
+        goto node_111010010;
+    }
+
+node_111010010:
+    if (bits & 0x400000) {
+        *symbol = 166;
+        return 10;
+    } else {
+        *symbol = 165;
+        return 10;
+    }
+
+node_111010011:
+    if (bits & 0x400000) {
+        *symbol = 168;
+        return 10;
+    } else {
+        *symbol = 167;
+        return 10;
+    }
+
+node_1110101:
+    if (bits & 0x1000000) {
+        goto node_11101011;
+    } else {
+        goto node_11101010;
+    }
+
+node_11101010:
+    if (bits & 0x800000) {
+        goto node_111010101;
+    } else {
+        goto node_111010100;
+    }
+
+node_111010100:
+    if (bits & 0x400000) {
+        *symbol = 170;
+        return 10;
+    } else {
+        *symbol = 169;
+        return 10;
+    }
+
+node_111010101:
+    if (bits & 0x400000) {
+        *symbol = 172;
+        return 10;
+    } else {
+        *symbol = 171;
+        return 10;
+    }
+
+node_11101011:
+    if (bits & 0x800000) {
+        goto node_111010111;
+    } else {
+        goto node_111010110;
+    }
+
+node_111010110:
+    if (bits & 0x400000) {
+        *symbol = 174;
+        return 10;
+    } else {
+        *symbol = 173;
+        return 10;
+    }
+
+node_111010111:
+    if (bits & 0x400000) {
+        *symbol = 176;
+        return 10;
+    } else {
+        *symbol = 175;
+        return 10;
+    }
+
+node_111011:
+    if (bits & 0x2000000) {
+        goto node_1110111;
+    } else {
+        goto node_1110110;
+    }
+
+node_1110110:
+    if (bits & 0x1000000) {
+        goto node_11101101;
+    } else {
+        goto node_11101100;
+    }
+
+node_11101100:
+    if (bits & 0x800000) {
+        goto node_111011001;
+    } else {
+        goto node_111011000;
+    }
+
+node_111011000:
+    if (bits & 0x400000) {
+        *symbol = 178;
+        return 10;
+    } else {
+        *symbol = 177;
+        return 10;
+    }
+
+node_111011001:
+    if (bits & 0x400000) {
+        *symbol = 180;
+        return 10;
+    } else {
+        *symbol = 179;
+        return 10;
+    }
+
+node_11101101:
+    if (bits & 0x800000) {
+        goto node_111011011;
+    } else {
+        goto node_111011010;
+    }
+
+node_111011010:
+    if (bits & 0x400000) {
+        *symbol = 182;
+        return 10;
+    } else {
+        *symbol = 181;
+        return 10;
+    }
+
+node_111011011:
+    if (bits & 0x400000) {
+        *symbol = 184;
+        return 10;
+    } else {
+        *symbol = 183;
+        return 10;
+    }
+
+node_1110111:
+    if (bits & 0x1000000) {
+        goto node_11101111;
+    } else {
+        goto node_11101110;
+    }
+
+node_11101110:
+    if (bits & 0x800000) {
+        goto node_111011101;
+    } else {
+        goto node_111011100;
+    }
+
+node_111011100:
+    if (bits & 0x400000) {
+        *symbol = 186;
+        return 10;
+    } else {
+        *symbol = 185;
+        return 10;
+    }
+
+node_111011101:
+    if (bits & 0x400000) {
+        *symbol = 188;
+        return 10;
+    } else {
+        *symbol = 187;
+        return 10;
+    }
+
+node_11101111:
+    if (bits & 0x800000) {
+        goto node_111011111;
+    } else {
+        goto node_111011110;
+    }
+
+node_111011110:
+    if (bits & 0x400000) {
+        *symbol = 190;
+        return 10;
+    } else {
+        *symbol = 189;
+        return 10;
+    }
+
+node_111011111:
+    if (bits & 0x400000) {
+        *symbol = 192;
+        return 10;
+    } else {
+        *symbol = 191;
+        return 10;
+    }
+
+node_1111:
+    if (bits & 0x8000000) {
+        goto node_11111;
+    } else {
+        goto node_11110;
+    }
+
+node_11110:
+    if (bits & 0x4000000) {
+        goto node_111101;
+    } else {
+        goto node_111100;
+    }
+
+node_111100:
+    if (bits & 0x2000000) {
+        goto node_1111001;
+    } else {
+        goto node_1111000;
+    }
+
+node_1111000:
+    if (bits & 0x1000000) {
+        goto node_11110001;
+    } else {
+        goto node_11110000;
+    }
+
+node_11110000:
+    if (bits & 0x800000) {
+        goto node_111100001;
+    } else {
+        goto node_111100000;
+    }
+
+node_111100000:
+    if (bits & 0x400000) {
+        *symbol = 194;
+        return 10;
+    } else {
+        *symbol = 193;
+        return 10;
+    }
+
+node_111100001:
+    if (bits & 0x400000) {
+        *symbol = 196;
+        return 10;
+    } else {
+        *symbol = 195;
+        return 10;
+    }
+
+node_11110001:
+    if (bits & 0x800000) {
+        goto node_111100011;
+    } else {
+        goto node_111100010;
+    }
+
+node_111100010:
+    if (bits & 0x400000) {
+        *symbol = 198;
+        return 10;
+    } else {
+        *symbol = 197;
+        return 10;
+    }
+
+node_111100011:
+    if (bits & 0x400000) {
+        *symbol = 200;
+        return 10;
+    } else {
+        *symbol = 199;
+        return 10;
+    }
+
+node_1111001:
+    if (bits & 0x1000000) {
+        goto node_11110011;
+    } else {
+        goto node_11110010;
+    }
+
+node_11110010:
+    if (bits & 0x800000) {
+        goto node_111100101;
+    } else {
+        goto node_111100100;
+    }
+
+node_111100100:
+    if (bits & 0x400000) {
+        *symbol = 202;
+        return 10;
+    } else {
+        *symbol = 201;
+        return 10;
+    }
+
+node_111100101:
+    if (bits & 0x400000) {
+        *symbol = 204;
+        return 10;
+    } else {
+        *symbol = 203;
+        return 10;
+    }
+
+node_11110011:
+    if (bits & 0x800000) {
+        goto node_111100111;
+    } else {
+        goto node_111100110;
+    }
+
+node_111100110:
+    if (bits & 0x400000) {
+        *symbol = 206;
+        return 10;
+    } else {
+        *symbol = 205;
+        return 10;
+    }
+
+node_111100111:
+    if (bits & 0x400000) {
+        *symbol = 208;
+        return 10;
+    } else {
+        *symbol = 207;
+        return 10;
+    }
+
+node_111101:
+    if (bits & 0x2000000) {
+        goto node_1111011;
+    } else {
+        goto node_1111010;
+    }
+
+node_1111010:
+    if (bits & 0x1000000) {
+        goto node_11110101;
+    } else {
+        goto node_11110100;
+    }
+
+node_11110100:
+    if (bits & 0x800000) {
+        goto node_111101001;
+    } else {
+        goto node_111101000;
+    }
+
+node_111101000:
+    if (bits & 0x400000) {
+        *symbol = 210;
+        return 10;
+    } else {
+        *symbol = 209;
+        return 10;
+    }
+
+node_111101001:
+    if (bits & 0x400000) {
+        *symbol = 212;
+        return 10;
+    } else {
+        *symbol = 211;
+        return 10;
+    }
+
+node_11110101:
+    if (bits & 0x800000) {
+        goto node_111101011;
+    } else {
+        goto node_111101010;
+    }
+
+node_111101010:
+    if (bits & 0x400000) {
+        *symbol = 214;
+        return 10;
+    } else {
+        *symbol = 213;
+        return 10;
+    }
+
+node_111101011:
+    if (bits & 0x400000) {
+        *symbol = 216;
+        return 10;
+    } else {
+        *symbol = 215;
+        return 10;
+    }
+
+node_1111011:
+    if (bits & 0x1000000) {
+        goto node_11110111;
+    } else {
+        goto node_11110110;
+    }
+
+node_11110110:
+    if (bits & 0x800000) {
+        goto node_111101101;
+    } else {
+        goto node_111101100;
+    }
+
+node_111101100:
+    if (bits & 0x400000) {
+        *symbol = 218;
+        return 10;
+    } else {
+        *symbol = 217;
+        return 10;
+    }
+
+node_111101101:
+    if (bits & 0x400000) {
+        *symbol = 220;
+        return 10;
+    } else {
+        *symbol = 219;
+        return 10;
+    }
+
+node_11110111:
+    if (bits & 0x800000) {
+        goto node_111101111;
+    } else {
+        goto node_111101110;
+    }
+
+node_111101110:
+    if (bits & 0x400000) {
+        *symbol = 222;
+        return 10;
+    } else {
+        *symbol = 221;
+        return 10;
+    }
+
+node_111101111:
+    if (bits & 0x400000) {
+        *symbol = 224;
+        return 10;
+    } else {
+        *symbol = 223;
+        return 10;
+    }
+
+node_11111:
+    if (bits & 0x4000000) {
+        goto node_111111;
+    } else {
+        goto node_111110;
+    }
+
+node_111110:
+    if (bits & 0x2000000) {
+        goto node_1111101;
+    } else {
+        goto node_1111100;
+    }
+
+node_1111100:
+    if (bits & 0x1000000) {
+        goto node_11111001;
+    } else {
+        goto node_11111000;
+    }
+
+node_11111000:
+    if (bits & 0x800000) {
+        goto node_111110001;
+    } else {
+        goto node_111110000;
+    }
+
+node_111110000:
+    if (bits & 0x400000) {
+        *symbol = 226;
+        return 10;
+    } else {
+        *symbol = 225;
+        return 10;
+    }
+
+node_111110001:
+    if (bits & 0x400000) {
+        *symbol = 228;
+        return 10;
+    } else {
+        *symbol = 227;
+        return 10;
+    }
+
+node_11111001:
+    if (bits & 0x800000) {
+        goto node_111110011;
+    } else {
+        goto node_111110010;
+    }
+
+node_111110010:
+    if (bits & 0x400000) {
+        *symbol = 230;
+        return 10;
+    } else {
+        *symbol = 229;
+        return 10;
+    }
+
+node_111110011:
+    if (bits & 0x400000) {
+        *symbol = 232;
+        return 10;
+    } else {
+        *symbol = 231;
+        return 10;
+    }
+
+node_1111101:
+    if (bits & 0x1000000) {
+        goto node_11111011;
+    } else {
+        goto node_11111010;
+    }
+
+node_11111010:
+    if (bits & 0x800000) {
+        goto node_111110101;
+    } else {
+        goto node_111110100;
+    }
+
+node_111110100:
+    if (bits & 0x400000) {
+        *symbol = 234;
+        return 10;
+    } else {
+        *symbol = 233;
+        return 10;
+    }
+
+node_111110101:
+    if (bits & 0x400000) {
+        *symbol = 236;
+        return 10;
+    } else {
+        *symbol = 235;
+        return 10;
+    }
+
+node_11111011:
+    if (bits & 0x800000) {
+        goto node_111110111;
+    } else {
+        goto node_111110110;
+    }
+
+node_111110110:
+    if (bits & 0x400000) {
+        *symbol = 238;
+        return 10;
+    } else {
+        *symbol = 237;
+        return 10;
+    }
+
+node_111110111:
+    if (bits & 0x400000) {
+        *symbol = 240;
+        return 10;
+    } else {
+        *symbol = 239;
+        return 10;
+    }
+
+node_111111:
+    if (bits & 0x2000000) {
+        goto node_1111111;
+    } else {
+        goto node_1111110;
+    }
+
+node_1111110:
+    if (bits & 0x1000000) {
+        goto node_11111101;
+    } else {
+        goto node_11111100;
+    }
+
+node_11111100:
+    if (bits & 0x800000) {
+        goto node_111111001;
+    } else {
+        goto node_111111000;
+    }
+
+node_111111000:
+    if (bits & 0x400000) {
+        *symbol = 242;
+        return 10;
+    } else {
+        *symbol = 241;
+        return 10;
+    }
+
+node_111111001:
+    if (bits & 0x400000) {
+        *symbol = 244;
+        return 10;
+    } else {
+        *symbol = 243;
+        return 10;
+    }
+
+node_11111101:
+    if (bits & 0x800000) {
+        goto node_111111011;
+    } else {
+        goto node_111111010;
+    }
+
+node_111111010:
+    if (bits & 0x400000) {
+        *symbol = 246;
+        return 10;
+    } else {
+        *symbol = 245;
+        return 10;
+    }
+
+node_111111011:
+    if (bits & 0x400000) {
+        *symbol = 248;
+        return 10;
+    } else {
+        *symbol = 247;
+        return 10;
+    }
+
+node_1111111:
+    if (bits & 0x1000000) {
+        goto node_11111111;
+    } else {
+        goto node_11111110;
+    }
+
+node_11111110:
+    if (bits & 0x800000) {
+        goto node_111111101;
+    } else {
+        goto node_111111100;
+    }
+
+node_111111100:
+    if (bits & 0x400000) {
+        *symbol = 250;
+        return 10;
+    } else {
+        *symbol = 249;
+        return 10;
+    }
+
+node_111111101:
+    if (bits & 0x400000) {
+        *symbol = 252;
+        return 10;
+    } else {
+        *symbol = 251;
+        return 10;
+    }
+
+node_11111111:
+    if (bits & 0x800000) {
+        goto node_111111111;
+    } else {
+        goto node_111111110;
+    }
+
+node_111111110:
+    if (bits & 0x400000) {
+        *symbol = 254;
+        return 10;
+    } else {
+        *symbol = 253;
+        return 10;
+    }
+
+node_111111111:
+    if (bits & 0x400000) {
+        return 0; /* invalid node */
+    } else {
+        *symbol = 255;
+        return 10;
+    }
+
+}
+
+/* Indexed by (state * 16 + nibble), each entry is { next_state, flags, symbol } */
+static const struct aws_huffman_fsm_transition fsm_transitions[] = {
+    /* state 0:  */
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 4, 0x0, 0x0 }, { 5, 0x0, 0x0 },
+    { 8, 0x0, 0x0 }, { 9, 0x0, 0x0 }, { 11, 0x0, 0x0 }, { 0, 0x4, 0x0 },
+    { 15, 0x0, 0x0 }, { 18, 0x0, 0x0 }, { 22, 0x0, 0x0 }, { 26, 0x0, 0x0 },
+    { 39, 0x0, 0x0 }, { 74, 0x0, 0x0 }, { 138, 0x0, 0x0 }, { 201, 0x1, 0x0 },
+    /* state 1: 0 */
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x3, 0x20 }, { 0, 0x3, 0x61 }, { 0, 0x3, 0x65 }, { 0, 0x3, 0x69 },
+    { 0, 0x3, 0x6e }, { 0, 0x3, 0x6f }, { 0, 0x3, 0x72 }, { 0, 0x3, 0x73 },
+    { 0, 0x3, 0x74 }, { 0, 0x3, 0x75 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 2: 00 */
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 1, 0x2, 0x20 }, { 12, 0x3, 0x20 }, { 1, 0x2, 0x61 }, { 12, 0x3, 0x61 },
+    { 1, 0x2, 0x65 }, { 12, 0x3, 0x65 }, { 1, 0x2, 0x69 }, { 12, 0x3, 0x69 },
+    /* state 3: 001 */
+    { 2, 0x2, 0x20 }, { 6, 0x2, 0x20 }, { 13, 0x2, 0x20 }, { 37, 0x3, 0x20 },
+    { 2, 0x2, 0x61 }, { 6, 0x2, 0x61 }, { 13, 0x2, 0x61 }, { 37, 0x3, 0x61 },
+    { 2, 0x2, 0x65 }, { 6, 0x2, 0x65 }, { 13, 0x2, 0x65 }, { 37, 0x3, 0x65 },
+    { 2, 0x2, 0x69 }, { 6, 0x2, 0x69 }, { 13, 0x2, 0x69 }, { 37, 0x3, 0x69 },
+    /* state 4: 0010 */
+    { 0, 0x4, 0x20 }, { 3, 0x2, 0x20 }, { 7, 0x2, 0x20 }, { 10, 0x2, 0x20 },
+    { 14, 0x2, 0x20 }, { 21, 0x2, 0x20 }, { 38, 0x2, 0x20 }, { 137, 0x3, 0x20 },
+    { 0, 0x4, 0x61 }, { 3, 0x2, 0x61 }, { 7, 0x2, 0x61 }, { 10, 0x2, 0x61 },
+    { 14, 0x2, 0x61 }, { 21, 0x2, 0x61 }, { 38, 0x2, 0x61 }, { 137, 0x3, 0x61 },
+    /* state 5: 0011 */
+    { 0, 0x4, 0x65 }, { 3, 0x2, 0x65 }, { 7, 0x2, 0x65 }, { 10, 0x2, 0x65 },
+    { 14, 0x2, 0x65 }, { 21, 0x2, 0x65 }, { 38, 0x2, 0x65 }, { 137, 0x3, 0x65 },
+    { 0, 0x4, 0x69 }, { 3, 0x2, 0x69 }, { 7, 0x2, 0x69 }, { 10, 0x2, 0x69 },
+    { 14, 0x2, 0x69 }, { 21, 0x2, 0x69 }, { 38, 0x2, 0x69 }, { 137, 0x3, 0x69 },
+    /* state 6: 01 */
+    { 1, 0x2, 0x6e }, { 12, 0x3, 0x6e }, { 1, 0x2, 0x6f }, { 12, 0x3, 0x6f },
+    { 1, 0x2, 0x72 }, { 12, 0x3, 0x72 }, { 1, 0x2, 0x73 }, { 12, 0x3, 0x73 },
+    { 1, 0x2, 0x74 }, { 12, 0x3, 0x74 }, { 1, 0x2, 0x75 }, { 12, 0x3, 0x75 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 7: 010 */
+    { 2, 0x2, 0x6e }, { 6, 0x2, 0x6e }, { 13, 0x2, 0x6e }, { 37, 0x3, 0x6e },
+    { 2, 0x2, 0x6f }, { 6, 0x2, 0x6f }, { 13, 0x2, 0x6f }, { 37, 0x3, 0x6f },
+    { 2, 0x2, 0x72 }, { 6, 0x2, 0x72 }, { 13, 0x2, 0x72 }, { 37, 0x3, 0x72 },
+    { 2, 0x2, 0x73 }, { 6, 0x2, 0x73 }, { 13, 0x2, 0x73 }, { 37, 0x3, 0x73 },
+    /* state 8: 0100 */
+    { 0, 0x4, 0x6e }, { 3, 0x2, 0x6e }, { 7, 0x2, 0x6e }, { 10, 0x2, 0x6e },
+    { 14, 0x2, 0x6e }, { 21, 0x2, 0x6e }, { 38, 0x2, 0x6e }, { 137, 0x3, 0x6e },
+    { 0, 0x4, 0x6f }, { 3, 0x2, 0x6f }, { 7, 0x2, 0x6f }, { 10, 0x2, 0x6f },
+    { 14, 0x2, 0x6f }, { 21, 0x2, 0x6f }, { 38, 0x2, 0x6f }, { 137, 0x3, 0x6f },
+    /* state 9: 0101 */
+    { 0, 0x4, 0x72 }, { 3, 0x2, 0x72 }, { 7, 0x2, 0x72 }, { 10, 0x2, 0x72 },
+    { 14, 0x2, 0x72 }, { 21, 0x2, 0x72 }, { 38, 0x2, 0x72 }, { 137, 0x3, 0x72 },
+    { 0, 0x4, 0x73 }, { 3, 0x2, 0x73 }, { 7, 0x2, 0x73 }, { 10, 0x2, 0x73 },
+    { 14, 0x2, 0x73 }, { 21, 0x2, 0x73 }, { 38, 0x2, 0x73 }, { 137, 0x3, 0x73 },
+    /* state 10: 011 */
+    { 2, 0x2, 0x74 }, { 6, 0x2, 0x74 }, { 13, 0x2, 0x74 }, { 37, 0x3, 0x74 },
+    { 2, 0x2, 0x75 }, { 6, 0x2, 0x75 }, { 13, 0x2, 0x75 }, { 37, 0x3, 0x75 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 11: 0110 */
+    { 0, 0x4, 0x74 }, { 3, 0x2, 0x74 }, { 7, 0x2, 0x74 }, { 10, 0x2, 0x74 },
+    { 14, 0x2, 0x74 }, { 21, 0x2, 0x74 }, { 38, 0x2, 0x74 }, { 137, 0x3, 0x74 },
+    { 0, 0x4, 0x75 }, { 3, 0x2, 0x75 }, { 7, 0x2, 0x75 }, { 10, 0x2, 0x75 },
+    { 14, 0x2, 0x75 }, { 21, 0x2, 0x75 }, { 38, 0x2, 0x75 }, { 137, 0x3, 0x75 },
+    /* state 12: 1 */
+    { 16, 0x0, 0x0 }, { 17, 0x0, 0x0 }, { 19, 0x0, 0x0 }, { 20, 0x0, 0x0 },
+    { 23, 0x0, 0x0 }, { 24, 0x0, 0x0 }, { 27, 0x0, 0x0 }, { 30, 0x0, 0x0 },
+    { 40, 0x0, 0x0 }, { 50, 0x0, 0x0 }, { 75, 0x0, 0x0 }, { 106, 0x0, 0x0 },
+    { 139, 0x0, 0x0 }, { 170, 0x0, 0x0 }, { 202, 0x0, 0x0 }, { 233, 0x1, 0x0 },
+    /* state 13: 10 */
+    { 0, 0x3, 0x63 }, { 0, 0x3, 0x64 }, { 0, 0x3, 0x66 }, { 0, 0x3, 0x68 },
+    { 0, 0x3, 0x6b }, { 0, 0x3, 0x6c }, { 0, 0x3, 0x6d }, { 0, 0x3, 0x77 },
+    { 0, 0x3, 0x79 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 25, 0x0, 0x0 },
+    { 28, 0x0, 0x0 }, { 29, 0x0, 0x0 }, { 31, 0x0, 0x0 }, { 34, 0x0, 0x0 },
+    /* state 14: 100 */
+    { 1, 0x2, 0x63 }, { 12, 0x3, 0x63 }, { 1, 0x2, 0x64 }, { 12, 0x3, 0x64 },
+    { 1, 0x2, 0x66 }, { 12, 0x3, 0x66 }, { 1, 0x2, 0x68 }, { 12, 0x3, 0x68 },
+    { 1, 0x2, 0x6b }, { 12, 0x3, 0x6b }, { 1, 0x2, 0x6c }, { 12, 0x3, 0x6c },
+    { 1, 0x2, 0x6d }, { 12, 0x3, 0x6d }, { 1, 0x2, 0x77 }, { 12, 0x3, 0x77 },
+    /* state 15: 1000 */
+    { 2, 0x2, 0x63 }, { 6, 0x2, 0x63 }, { 13, 0x2, 0x63 }, { 37, 0x3, 0x63 },
+    { 2, 0x2, 0x64 }, { 6, 0x2, 0x64 }, { 13, 0x2, 0x64 }, { 37, 0x3, 0x64 },
+    { 2, 0x2, 0x66 }, { 6, 0x2, 0x66 }, { 13, 0x2, 0x66 }, { 37, 0x3, 0x66 },
+    { 2, 0x2, 0x68 }, { 6, 0x2, 0x68 }, { 13, 0x2, 0x68 }, { 37, 0x3, 0x68 },
+    /* state 16: 10000 */
+    { 0, 0x4, 0x63 }, { 3, 0x2, 0x63 }, { 7, 0x2, 0x63 }, { 10, 0x2, 0x63 },
+    { 14, 0x2, 0x63 }, { 21, 0x2, 0x63 }, { 38, 0x2, 0x63 }, { 137, 0x3, 0x63 },
+    { 0, 0x4, 0x64 }, { 3, 0x2, 0x64 }, { 7, 0x2, 0x64 }, { 10, 0x2, 0x64 },
+    { 14, 0x2, 0x64 }, { 21, 0x2, 0x64 }, { 38, 0x2, 0x64 }, { 137, 0x3, 0x64 },
+    /* state 17: 10001 */
+    { 0, 0x4, 0x66 }, { 3, 0x2, 0x66 }, { 7, 0x2, 0x66 }, { 10, 0x2, 0x66 },
+    { 14, 0x2, 0x66 }, { 21, 0x2, 0x66 }, { 38, 0x2, 0x66 }, { 137, 0x3, 0x66 },
+    { 0, 0x4, 0x68 }, { 3, 0x2, 0x68 }, { 7, 0x2, 0x68 }, { 10, 0x2, 0x68 },
+    { 14, 0x2, 0x68 }, { 21, 0x2, 0x68 }, { 38, 0x2, 0x68 }, { 137, 0x3, 0x68 },
+    /* state 18: 1001 */
+    { 2, 0x2, 0x6b }, { 6, 0x2, 0x6b }, { 13, 0x2, 0x6b }, { 37, 0x3, 0x6b },
+    { 2, 0x2, 0x6c }, { 6, 0x2, 0x6c }, { 13, 0x2, 0x6c }, { 37, 0x3, 0x6c },
+    { 2, 0x2, 0x6d }, { 6, 0x2, 0x6d }, { 13, 0x2, 0x6d }, { 37, 0x3, 0x6d },
+    { 2, 0x2, 0x77 }, { 6, 0x2, 0x77 }, { 13, 0x2, 0x77 }, { 37, 0x3, 0x77 },
+    /* state 19: 10010 */
+    { 0, 0x4, 0x6b }, { 3, 0x2, 0x6b }, { 7, 0x2, 0x6b }, { 10, 0x2, 0x6b },
+    { 14, 0x2, 0x6b }, { 21, 0x2, 0x6b }, { 38, 0x2, 0x6b }, { 137, 0x3, 0x6b },
+    { 0, 0x4, 0x6c }, { 3, 0x2, 0x6c }, { 7, 0x2, 0x6c }, { 10, 0x2, 0x6c },
+    { 14, 0x2, 0x6c }, { 21, 0x2, 0x6c }, { 38, 0x2, 0x6c }, { 137, 0x3, 0x6c },
+    /* state 20: 10011 */
+    { 0, 0x4, 0x6d }, { 3, 0x2, 0x6d }, { 7, 0x2, 0x6d }, { 10, 0x2, 0x6d },
+    { 14, 0x2, 0x6d }, { 21, 0x2, 0x6d }, { 38, 0x2, 0x6d }, { 137, 0x3, 0x6d },
+    { 0, 0x4, 0x77 }, { 3, 0x2, 0x77 }, { 7, 0x2, 0x77 }, { 10, 0x2, 0x77 },
+    { 14, 0x2, 0x77 }, { 21, 0x2, 0x77 }, { 38, 0x2, 0x77 }, { 137, 0x3, 0x77 },
+    /* state 21: 101 */
+    { 1, 0x2, 0x79 }, { 12, 0x3, 0x79 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x3, 0x27 }, { 0, 0x3, 0x2e },
+    { 0, 0x3, 0x62 }, { 0, 0x3, 0x67 }, { 0, 0x3, 0x70 }, { 0, 0x4, 0x0 },
+    { 32, 0x0, 0x0 }, { 33, 0x0, 0x0 }, { 35, 0x0, 0x0 }, { 36, 0x0, 0x0 },
+    /* state 22: 1010 */
+    { 2, 0x2, 0x79 }, { 6, 0x2, 0x79 }, { 13, 0x2, 0x79 }, { 37, 0x3, 0x79 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 1, 0x2, 0x27 }, { 12, 0x3, 0x27 }, { 1, 0x2, 0x2e }, { 12, 0x3, 0x2e },
+    /* state 23: 10100 */
+    { 0, 0x4, 0x79 }, { 3, 0x2, 0x79 }, { 7, 0x2, 0x79 }, { 10, 0x2, 0x79 },
+    { 14, 0x2, 0x79 }, { 21, 0x2, 0x79 }, { 38, 0x2, 0x79 }, { 137, 0x3, 0x79 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 24: 10101 */
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 2, 0x2, 0x27 }, { 6, 0x2, 0x27 }, { 13, 0x2, 0x27 }, { 37, 0x3, 0x27 },
+    { 2, 0x2, 0x2e }, { 6, 0x2, 0x2e }, { 13, 0x2, 0x2e }, { 37, 0x3, 0x2e },
+    /* state 25: 101011 */
+    { 0, 0x4, 0x27 }, { 3, 0x2, 0x27 }, { 7, 0x2, 0x27 }, { 10, 0x2, 0x27 },
+    { 14, 0x2, 0x27 }, { 21, 0x2, 0x27 }, { 38, 0x2, 0x27 }, { 137, 0x3, 0x27 },
+    { 0, 0x4, 0x2e }, { 3, 0x2, 0x2e }, { 7, 0x2, 0x2e }, { 10, 0x2, 0x2e },
+    { 14, 0x2, 0x2e }, { 21, 0x2, 0x2e }, { 38, 0x2, 0x2e }, { 137, 0x3, 0x2e },
+    /* state 26: 1011 */
+    { 1, 0x2, 0x62 }, { 12, 0x3, 0x62 }, { 1, 0x2, 0x67 }, { 12, 0x3, 0x67 },
+    { 1, 0x2, 0x70 }, { 12, 0x3, 0x70 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x3, 0xa }, { 0, 0x3, 0x2c }, { 0, 0x3, 0x3f }, { 0, 0x3, 0x42 },
+    { 0, 0x3, 0x49 }, { 0, 0x3, 0x54 }, { 0, 0x3, 0x57 }, { 0, 0x3, 0x6a },
+    /* state 27: 10110 */
+    { 2, 0x2, 0x62 }, { 6, 0x2, 0x62 }, { 13, 0x2, 0x62 }, { 37, 0x3, 0x62 },
+    { 2, 0x2, 0x67 }, { 6, 0x2, 0x67 }, { 13, 0x2, 0x67 }, { 37, 0x3, 0x67 },
+    { 2, 0x2, 0x70 }, { 6, 0x2, 0x70 }, { 13, 0x2, 0x70 }, { 37, 0x3, 0x70 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 28: 101100 */
+    { 0, 0x4, 0x62 }, { 3, 0x2, 0x62 }, { 7, 0x2, 0x62 }, { 10, 0x2, 0x62 },
+    { 14, 0x2, 0x62 }, { 21, 0x2, 0x62 }, { 38, 0x2, 0x62 }, { 137, 0x3, 0x62 },
+    { 0, 0x4, 0x67 }, { 3, 0x2, 0x67 }, { 7, 0x2, 0x67 }, { 10, 0x2, 0x67 },
+    { 14, 0x2, 0x67 }, { 21, 0x2, 0x67 }, { 38, 0x2, 0x67 }, { 137, 0x3, 0x67 },
+    /* state 29: 101101 */
+    { 0, 0x4, 0x70 }, { 3, 0x2, 0x70 }, { 7, 0x2, 0x70 }, { 10, 0x2, 0x70 },
+    { 14, 0x2, 0x70 }, { 21, 0x2, 0x70 }, { 38, 0x2, 0x70 }, { 137, 0x3, 0x70 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 30: 10111 */
+    { 1, 0x2, 0xa }, { 12, 0x3, 0xa }, { 1, 0x2, 0x2c }, { 12, 0x3, 0x2c },
+    { 1, 0x2, 0x3f }, { 12, 0x3, 0x3f }, { 1, 0x2, 0x42 }, { 12, 0x3, 0x42 },
+    { 1, 0x2, 0x49 }, { 12, 0x3, 0x49 }, { 1, 0x2, 0x54 }, { 12, 0x3, 0x54 },
+    { 1, 0x2, 0x57 }, { 12, 0x3, 0x57 }, { 1, 0x2, 0x6a }, { 12, 0x3, 0x6a },
+    /* state 31: 101110 */
+    { 2, 0x2, 0xa }, { 6, 0x2, 0xa }, { 13, 0x2, 0xa }, { 37, 0x3, 0xa },
+    { 2, 0x2, 0x2c }, { 6, 0x2, 0x2c }, { 13, 0x2, 0x2c }, { 37, 0x3, 0x2c },
+    { 2, 0x2, 0x3f }, { 6, 0x2, 0x3f }, { 13, 0x2, 0x3f }, { 37, 0x3, 0x3f },
+    { 2, 0x2, 0x42 }, { 6, 0x2, 0x42 }, { 13, 0x2, 0x42 }, { 37, 0x3, 0x42 },
+    /* state 32: 1011100 */
+    { 0, 0x4, 0xa }, { 3, 0x2, 0xa }, { 7, 0x2, 0xa }, { 10, 0x2, 0xa },
+    { 14, 0x2, 0xa }, { 21, 0x2, 0xa }, { 38, 0x2, 0xa }, { 137, 0x3, 0xa },
+    { 0, 0x4, 0x2c }, { 3, 0x2, 0x2c }, { 7, 0x2, 0x2c }, { 10, 0x2, 0x2c },
+    { 14, 0x2, 0x2c }, { 21, 0x2, 0x2c }, { 38, 0x2, 0x2c }, { 137, 0x3, 0x2c },
+    /* state 33: 1011101 */
+    { 0, 0x4, 0x3f }, { 3, 0x2, 0x3f }, { 7, 0x2, 0x3f }, { 10, 0x2, 0x3f },
+    { 14, 0x2, 0x3f }, { 21, 0x2, 0x3f }, { 38, 0x2, 0x3f }, { 137, 0x3, 0x3f },
+    { 0, 0x4, 0x42 }, { 3, 0x2, 0x42 }, { 7, 0x2, 0x42 }, { 10, 0x2, 0x42 },
+    { 14, 0x2, 0x42 }, { 21, 0x2, 0x42 }, { 38, 0x2, 0x42 }, { 137, 0x3, 0x42 },
+    /* state 34: 101111 */
+    { 2, 0x2, 0x49 }, { 6, 0x2, 0x49 }, { 13, 0x2, 0x49 }, { 37, 0x3, 0x49 },
+    { 2, 0x2, 0x54 }, { 6, 0x2, 0x54 }, { 13, 0x2, 0x54 }, { 37, 0x3, 0x54 },
+    { 2, 0x2, 0x57 }, { 6, 0x2, 0x57 }, { 13, 0x2, 0x57 }, { 37, 0x3, 0x57 },
+    { 2, 0x2, 0x6a }, { 6, 0x2, 0x6a }, { 13, 0x2, 0x6a }, { 37, 0x3, 0x6a },
+    /* state 35: 1011110 */
+    { 0, 0x4, 0x49 }, { 3, 0x2, 0x49 }, { 7, 0x2, 0x49 }, { 10, 0x2, 0x49 },
+    { 14, 0x2, 0x49 }, { 21, 0x2, 0x49 }, { 38, 0x2, 0x49 }, { 137, 0x3, 0x49 },
+    { 0, 0x4, 0x54 }, { 3, 0x2, 0x54 }, { 7, 0x2, 0x54 }, { 10, 0x2, 0x54 },
+    { 14, 0x2, 0x54 }, { 21, 0x2, 0x54 }, { 38, 0x2, 0x54 }, { 137, 0x3, 0x54 },
+    /* state 36: 1011111 */
+    { 0, 0x4, 0x57 }, { 3, 0x2, 0x57 }, { 7, 0x2, 0x57 }, { 10, 0x2, 0x57 },
+    { 14, 0x2, 0x57 }, { 21, 0x2, 0x57 }, { 38, 0x2, 0x57 }, { 137, 0x3, 0x57 },
+    { 0, 0x4, 0x6a }, { 3, 0x2, 0x6a }, { 7, 0x2, 0x6a }, { 10, 0x2, 0x6a },
+    { 14, 0x2, 0x6a }, { 21, 0x2, 0x6a }, { 38, 0x2, 0x6a }, { 137, 0x3, 0x6a },
+    /* state 37: 11 */
+    { 41, 0x0, 0x0 }, { 43, 0x0, 0x0 }, { 51, 0x0, 0x0 }, { 59, 0x0, 0x0 },
+    { 76, 0x0, 0x0 }, { 91, 0x0, 0x0 }, { 107, 0x0, 0x0 }, { 122, 0x0, 0x0 },
+    { 140, 0x0, 0x0 }, { 155, 0x0, 0x0 }, { 171, 0x0, 0x0 }, { 186, 0x0, 0x0 },
+    { 203, 0x0, 0x0 }, { 218, 0x0, 0x0 }, { 234, 0x0, 0x0 }, { 249, 0x1, 0x0 },
+    /* state 38: 110 */
+    { 42, 0x0, 0x0 }, { 0, 0x4, 0x0 }, { 44, 0x0, 0x0 }, { 47, 0x0, 0x0 },
+    { 52, 0x0, 0x0 }, { 55, 0x0, 0x0 }, { 60, 0x0, 0x0 }, { 67, 0x0, 0x0 },
+    { 77, 0x0, 0x0 }, { 84, 0x0, 0x0 }, { 92, 0x0, 0x0 }, { 99, 0x0, 0x0 },
+    { 108, 0x0, 0x0 }, { 115, 0x0, 0x0 }, { 123, 0x0, 0x0 }, { 130, 0x0, 0x0 },
+    /* state 39: 1100 */
+    { 0, 0x3, 0x76 }, { 0, 0x3, 0x78 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 45, 0x0, 0x0 }, { 46, 0x0, 0x0 }, { 48, 0x0, 0x0 }, { 49, 0x0, 0x0 },
+    { 53, 0x0, 0x0 }, { 54, 0x0, 0x0 }, { 56, 0x0, 0x0 }, { 57, 0x0, 0x0 },
+    { 61, 0x0, 0x0 }, { 64, 0x0, 0x0 }, { 68, 0x0, 0x0 }, { 71, 0x0, 0x0 },
+    /* state 40: 11000 */
+    { 1, 0x2, 0x76 }, { 12, 0x3, 0x76 }, { 1, 0x2, 0x78 }, { 12, 0x3, 0x78 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x3, 0x2d }, { 0, 0x3, 0x43 }, { 0, 0x3, 0x44 }, { 0, 0x3, 0x45 },
+    { 0, 0x3, 0x46 }, { 0, 0x3, 0x47 }, { 0, 0x3, 0x48 }, { 0, 0x3, 0x4c },
+    /* state 41: 110000 */
+    { 2, 0x2, 0x76 }, { 6, 0x2, 0x76 }, { 13, 0x2, 0x76 }, { 37, 0x3, 0x76 },
+    { 2, 0x2, 0x78 }, { 6, 0x2, 0x78 }, { 13, 0x2, 0x78 }, { 37, 0x3, 0x78 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 42: 1100000 */
+    { 0, 0x4, 0x76 }, { 3, 0x2, 0x76 }, { 7, 0x2, 0x76 }, { 10, 0x2, 0x76 },
+    { 14, 0x2, 0x76 }, { 21, 0x2, 0x76 }, { 38, 0x2, 0x76 }, { 137, 0x3, 0x76 },
+    { 0, 0x4, 0x78 }, { 3, 0x2, 0x78 }, { 7, 0x2, 0x78 }, { 10, 0x2, 0x78 },
+    { 14, 0x2, 0x78 }, { 21, 0x2, 0x78 }, { 38, 0x2, 0x78 }, { 137, 0x3, 0x78 },
+    /* state 43: 110001 */
+    { 1, 0x2, 0x2d }, { 12, 0x3, 0x2d }, { 1, 0x2, 0x43 }, { 12, 0x3, 0x43 },
+    { 1, 0x2, 0x44 }, { 12, 0x3, 0x44 }, { 1, 0x2, 0x45 }, { 12, 0x3, 0x45 },
+    { 1, 0x2, 0x46 }, { 12, 0x3, 0x46 }, { 1, 0x2, 0x47 }, { 12, 0x3, 0x47 },
+    { 1, 0x2, 0x48 }, { 12, 0x3, 0x48 }, { 1, 0x2, 0x4c }, { 12, 0x3, 0x4c },
+    /* state 44: 1100010 */
+    { 2, 0x2, 0x2d }, { 6, 0x2, 0x2d }, { 13, 0x2, 0x2d }, { 37, 0x3, 0x2d },
+    { 2, 0x2, 0x43 }, { 6, 0x2, 0x43 }, { 13, 0x2, 0x43 }, { 37, 0x3, 0x43 },
+    { 2, 0x2, 0x44 }, { 6, 0x2, 0x44 }, { 13, 0x2, 0x44 }, { 37, 0x3, 0x44 },
+    { 2, 0x2, 0x45 }, { 6, 0x2, 0x45 }, { 13, 0x2, 0x45 }, { 37, 0x3, 0x45 },
+    /* state 45: 11000100 */
+    { 0, 0x4, 0x2d }, { 3, 0x2, 0x2d }, { 7, 0x2, 0x2d }, { 10, 0x2, 0x2d },
+    { 14, 0x2, 0x2d }, { 21, 0x2, 0x2d }, { 38, 0x2, 0x2d }, { 137, 0x3, 0x2d },
+    { 0, 0x4, 0x43 }, { 3, 0x2, 0x43 }, { 7, 0x2, 0x43 }, { 10, 0x2, 0x43 },
+    { 14, 0x2, 0x43 }, { 21, 0x2, 0x43 }, { 38, 0x2, 0x43 }, { 137, 0x3, 0x43 },
+    /* state 46: 11000101 */
+    { 0, 0x4, 0x44 }, { 3, 0x2, 0x44 }, { 7, 0x2, 0x44 }, { 10, 0x2, 0x44 },
+    { 14, 0x2, 0x44 }, { 21, 0x2, 0x44 }, { 38, 0x2, 0x44 }, { 137, 0x3, 0x44 },
+    { 0, 0x4, 0x45 }, { 3, 0x2, 0x45 }, { 7, 0x2, 0x45 }, { 10, 0x2, 0x45 },
+    { 14, 0x2, 0x45 }, { 21, 0x2, 0x45 }, { 38, 0x2, 0x45 }, { 137, 0x3, 0x45 },
+    /* state 47: 1100011 */
+    { 2, 0x2, 0x46 }, { 6, 0x2, 0x46 }, { 13, 0x2, 0x46 }, { 37, 0x3, 0x46 },
+    { 2, 0x2, 0x47 }, { 6, 0x2, 0x47 }, { 13, 0x2, 0x47 }, { 37, 0x3, 0x47 },
+    { 2, 0x2, 0x48 }, { 6, 0x2, 0x48 }, { 13, 0x2, 0x48 }, { 37, 0x3, 0x48 },
+    { 2, 0x2, 0x4c }, { 6, 0x2, 0x4c }, { 13, 0x2, 0x4c }, { 37, 0x3, 0x4c },
+    /* state 48: 11000110 */
+    { 0, 0x4, 0x46 }, { 3, 0x2, 0x46 }, { 7, 0x2, 0x46 }, { 10, 0x2, 0x46 },
+    { 14, 0x2, 0x46 }, { 21, 0x2, 0x46 }, { 38, 0x2, 0x46 }, { 137, 0x3, 0x46 },
+    { 0, 0x4, 0x47 }, { 3, 0x2, 0x47 }, { 7, 0x2, 0x47 }, { 10, 0x2, 0x47 },
+    { 14, 0x2, 0x47 }, { 21, 0x2, 0x47 }, { 38, 0x2, 0x47 }, { 137, 0x3, 0x47 },
+    /* state 49: 11000111 */
+    { 0, 0x4, 0x48 }, { 3, 0x2, 0x48 }, { 7, 0x2, 0x48 }, { 10, 0x2, 0x48 },
+    { 14, 0x2, 0x48 }, { 21, 0x2, 0x48 }, { 38, 0x2, 0x48 }, { 137, 0x3, 0x48 },
+    { 0, 0x4, 0x4c }, { 3, 0x2, 0x4c }, { 7, 0x2, 0x4c }, { 10, 0x2, 0x4c },
+    { 14, 0x2, 0x4c }, { 21, 0x2, 0x4c }, { 38, 0x2, 0x4c }, { 137, 0x3, 0x4c },
+    /* state 50: 11001 */
+    { 0, 0x3, 0x4d }, { 0, 0x3, 0x50 }, { 0, 0x3, 0x56 }, { 0, 0x3, 0x59 },
+    { 0, 0x3, 0x71 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 58, 0x0, 0x0 },
+    { 62, 0x0, 0x0 }, { 63, 0x0, 0x0 }, { 65, 0x0, 0x0 }, { 66, 0x0, 0x0 },
+    { 69, 0x0, 0x0 }, { 70, 0x0, 0x0 }, { 72, 0x0, 0x0 }, { 73, 0x0, 0x0 },
+    /* state 51: 110010 */
+    { 1, 0x2, 0x4d }, { 12, 0x3, 0x4d }, { 1, 0x2, 0x50 }, { 12, 0x3, 0x50 },
+    { 1, 0x2, 0x56 }, { 12, 0x3, 0x56 }, { 1, 0x2, 0x59 }, { 12, 0x3, 0x59 },
+    { 1, 0x2, 0x71 }, { 12, 0x3, 0x71 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x3, 0x0 }, { 0, 0x3, 0x1 },
+    /* state 52: 1100100 */
+    { 2, 0x2, 0x4d }, { 6, 0x2, 0x4d }, { 13, 0x2, 0x4d }, { 37, 0x3, 0x4d },
+    { 2, 0x2, 0x50 }, { 6, 0x2, 0x50 }, { 13, 0x2, 0x50 }, { 37, 0x3, 0x50 },
+    { 2, 0x2, 0x56 }, { 6, 0x2, 0x56 }, { 13, 0x2, 0x56 }, { 37, 0x3, 0x56 },
+    { 2, 0x2, 0x59 }, { 6, 0x2, 0x59 }, { 13, 0x2, 0x59 }, { 37, 0x3, 0x59 },
+    /* state 53: 11001000 */
+    { 0, 0x4, 0x4d }, { 3, 0x2, 0x4d }, { 7, 0x2, 0x4d }, { 10, 0x2, 0x4d },
+    { 14, 0x2, 0x4d }, { 21, 0x2, 0x4d }, { 38, 0x2, 0x4d }, { 137, 0x3, 0x4d },
+    { 0, 0x4, 0x50 }, { 3, 0x2, 0x50 }, { 7, 0x2, 0x50 }, { 10, 0x2, 0x50 },
+    { 14, 0x2, 0x50 }, { 21, 0x2, 0x50 }, { 38, 0x2, 0x50 }, { 137, 0x3, 0x50 },
+    /* state 54: 11001001 */
+    { 0, 0x4, 0x56 }, { 3, 0x2, 0x56 }, { 7, 0x2, 0x56 }, { 10, 0x2, 0x56 },
+    { 14, 0x2, 0x56 }, { 21, 0x2, 0x56 }, { 38, 0x2, 0x56 }, { 137, 0x3, 0x56 },
+    { 0, 0x4, 0x59 }, { 3, 0x2, 0x59 }, { 7, 0x2, 0x59 }, { 10, 0x2, 0x59 },
+    { 14, 0x2, 0x59 }, { 21, 0x2, 0x59 }, { 38, 0x2, 0x59 }, { 137, 0x3, 0x59 },
+    /* state 55: 1100101 */
+    { 2, 0x2, 0x71 }, { 6, 0x2, 0x71 }, { 13, 0x2, 0x71 }, { 37, 0x3, 0x71 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 1, 0x2, 0x0 }, { 12, 0x3, 0x0 }, { 1, 0x2, 0x1 }, { 12, 0x3, 0x1 },
+    /* state 56: 11001010 */
+    { 0, 0x4, 0x71 }, { 3, 0x2, 0x71 }, { 7, 0x2, 0x71 }, { 10, 0x2, 0x71 },
+    { 14, 0x2, 0x71 }, { 21, 0x2, 0x71 }, { 38, 0x2, 0x71 }, { 137, 0x3, 0x71 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 57: 11001011 */
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 2, 0x2, 0x0 }, { 6, 0x2, 0x0 }, { 13, 0x2, 0x0 }, { 37, 0x3, 0x0 },
+    { 2, 0x2, 0x1 }, { 6, 0x2, 0x1 }, { 13, 0x2, 0x1 }, { 37, 0x3, 0x1 },
+    /* state 58: 110010111 */
+    { 0, 0x4, 0x0 }, { 3, 0x2, 0x0 }, { 7, 0x2, 0x0 }, { 10, 0x2, 0x0 },
+    { 14, 0x2, 0x0 }, { 21, 0x2, 0x0 }, { 38, 0x2, 0x0 }, { 137, 0x3, 0x0 },
+    { 0, 0x4, 0x1 }, { 3, 0x2, 0x1 }, { 7, 0x2, 0x1 }, { 10, 0x2, 0x1 },
+    { 14, 0x2, 0x1 }, { 21, 0x2, 0x1 }, { 38, 0x2, 0x1 }, { 137, 0x3, 0x1 },
+    /* state 59: 110011 */
+    { 0, 0x3, 0x2 }, { 0, 0x3, 0x3 }, { 0, 0x3, 0x4 }, { 0, 0x3, 0x5 },
+    { 0, 0x3, 0x6 }, { 0, 0x3, 0x7 }, { 0, 0x3, 0x8 }, { 0, 0x3, 0x9 },
+    { 0, 0x3, 0xb }, { 0, 0x3, 0xc }, { 0, 0x3, 0xd }, { 0, 0x3, 0xe },
+    { 0, 0x3, 0xf }, { 0, 0x3, 0x10 }, { 0, 0x3, 0x11 }, { 0, 0x3, 0x12 },
+    /* state 60: 1100110 */
+    { 1, 0x2, 0x2 }, { 12, 0x3, 0x2 }, { 1, 0x2, 0x3 }, { 12, 0x3, 0x3 },
+    { 1, 0x2, 0x4 }, { 12, 0x3, 0x4 }, { 1, 0x2, 0x5 }, { 12, 0x3, 0x5 },
+    { 1, 0x2, 0x6 }, { 12, 0x3, 0x6 }, { 1, 0x2, 0x7 }, { 12, 0x3, 0x7 },
+    { 1, 0x2, 0x8 }, { 12, 0x3, 0x8 }, { 1, 0x2, 0x9 }, { 12, 0x3, 0x9 },
+    /* state 61: 11001100 */
+    { 2, 0x2, 0x2 }, { 6, 0x2, 0x2 }, { 13, 0x2, 0x2 }, { 37, 0x3, 0x2 },
+    { 2, 0x2, 0x3 }, { 6, 0x2, 0x3 }, { 13, 0x2, 0x3 }, { 37, 0x3, 0x3 },
+    { 2, 0x2, 0x4 }, { 6, 0x2, 0x4 }, { 13, 0x2, 0x4 }, { 37, 0x3, 0x4 },
+    { 2, 0x2, 0x5 }, { 6, 0x2, 0x5 }, { 13, 0x2, 0x5 }, { 37, 0x3, 0x5 },
+    /* state 62: 110011000 */
+    { 0, 0x4, 0x2 }, { 3, 0x2, 0x2 }, { 7, 0x2, 0x2 }, { 10, 0x2, 0x2 },
+    { 14, 0x2, 0x2 }, { 21, 0x2, 0x2 }, { 38, 0x2, 0x2 }, { 137, 0x3, 0x2 },
+    { 0, 0x4, 0x3 }, { 3, 0x2, 0x3 }, { 7, 0x2, 0x3 }, { 10, 0x2, 0x3 },
+    { 14, 0x2, 0x3 }, { 21, 0x2, 0x3 }, { 38, 0x2, 0x3 }, { 137, 0x3, 0x3 },
+    /* state 63: 110011001 */
+    { 0, 0x4, 0x4 }, { 3, 0x2, 0x4 }, { 7, 0x2, 0x4 }, { 10, 0x2, 0x4 },
+    { 14, 0x2, 0x4 }, { 21, 0x2, 0x4 }, { 38, 0x2, 0x4 }, { 137, 0x3, 0x4 },
+    { 0, 0x4, 0x5 }, { 3, 0x2, 0x5 }, { 7, 0x2, 0x5 }, { 10, 0x2, 0x5 },
+    { 14, 0x2, 0x5 }, { 21, 0x2, 0x5 }, { 38, 0x2, 0x5 }, { 137, 0x3, 0x5 },
+    /* state 64: 11001101 */
+    { 2, 0x2, 0x6 }, { 6, 0x2, 0x6 }, { 13, 0x2, 0x6 }, { 37, 0x3, 0x6 },
+    { 2, 0x2, 0x7 }, { 6, 0x2, 0x7 }, { 13, 0x2, 0x7 }, { 37, 0x3, 0x7 },
+    { 2, 0x2, 0x8 }, { 6, 0x2, 0x8 }, { 13, 0x2, 0x8 }, { 37, 0x3, 0x8 },
+    { 2, 0x2, 0x9 }, { 6, 0x2, 0x9 }, { 13, 0x2, 0x9 }, { 37, 0x3, 0x9 },
+    /* state 65: 110011010 */
+    { 0, 0x4, 0x6 }, { 3, 0x2, 0x6 }, { 7, 0x2, 0x6 }, { 10, 0x2, 0x6 },
+    { 14, 0x2, 0x6 }, { 21, 0x2, 0x6 }, { 38, 0x2, 0x6 }, { 137, 0x3, 0x6 },
+    { 0, 0x4, 0x7 }, { 3, 0x2, 0x7 }, { 7, 0x2, 0x7 }, { 10, 0x2, 0x7 },
+    { 14, 0x2, 0x7 }, { 21, 0x2, 0x7 }, { 38, 0x2, 0x7 }, { 137, 0x3, 0x7 },
+    /* state 66: 110011011 */
+    { 0, 0x4, 0x8 }, { 3, 0x2, 0x8 }, { 7, 0x2, 0x8 }, { 10, 0x2, 0x8 },
+    { 14, 0x2, 0x8 }, { 21, 0x2, 0x8 }, { 38, 0x2, 0x8 }, { 137, 0x3, 0x8 },
+    { 0, 0x4, 0x9 }, { 3, 0x2, 0x9 }, { 7, 0x2, 0x9 }, { 10, 0x2, 0x9 },
+    { 14, 0x2, 0x9 }, { 21, 0x2, 0x9 }, { 38, 0x2, 0x9 }, { 137, 0x3, 0x9 },
+    /* state 67: 1100111 */
+    { 1, 0x2, 0xb }, { 12, 0x3, 0xb }, { 1, 0x2, 0xc }, { 12, 0x3, 0xc },
+    { 1, 0x2, 0xd }, { 12, 0x3, 0xd }, { 1, 0x2, 0xe }, { 12, 0x3, 0xe },
+    { 1, 0x2, 0xf }, { 12, 0x3, 0xf }, { 1, 0x2, 0x10 }, { 12, 0x3, 0x10 },
+    { 1, 0x2, 0x11 }, { 12, 0x3, 0x11 }, { 1, 0x2, 0x12 }, { 12, 0x3, 0x12 },
+    /* state 68: 11001110 */
+    { 2, 0x2, 0xb }, { 6, 0x2, 0xb }, { 13, 0x2, 0xb }, { 37, 0x3, 0xb },
+    { 2, 0x2, 0xc }, { 6, 0x2, 0xc }, { 13, 0x2, 0xc }, { 37, 0x3, 0xc },
+    { 2, 0x2, 0xd }, { 6, 0x2, 0xd }, { 13, 0x2, 0xd }, { 37, 0x3, 0xd },
+    { 2, 0x2, 0xe }, { 6, 0x2, 0xe }, { 13, 0x2, 0xe }, { 37, 0x3, 0xe },
+    /* state 69: 110011100 */
+    { 0, 0x4, 0xb }, { 3, 0x2, 0xb }, { 7, 0x2, 0xb }, { 10, 0x2, 0xb },
+    { 14, 0x2, 0xb }, { 21, 0x2, 0xb }, { 38, 0x2, 0xb }, { 137, 0x3, 0xb },
+    { 0, 0x4, 0xc }, { 3, 0x2, 0xc }, { 7, 0x2, 0xc }, { 10, 0x2, 0xc },
+    { 14, 0x2, 0xc }, { 21, 0x2, 0xc }, { 38, 0x2, 0xc }, { 137, 0x3, 0xc },
+    /* state 70: 110011101 */
+    { 0, 0x4, 0xd }, { 3, 0x2, 0xd }, { 7, 0x2, 0xd }, { 10, 0x2, 0xd },
+    { 14, 0x2, 0xd }, { 21, 0x2, 0xd }, { 38, 0x2, 0xd }, { 137, 0x3, 0xd },
+    { 0, 0x4, 0xe }, { 3, 0x2, 0xe }, { 7, 0x2, 0xe }, { 10, 0x2, 0xe },
+    { 14, 0x2, 0xe }, { 21, 0x2, 0xe }, { 38, 0x2, 0xe }, { 137, 0x3, 0xe },
+    /* state 71: 11001111 */
+    { 2, 0x2, 0xf }, { 6, 0x2, 0xf }, { 13, 0x2, 0xf }, { 37, 0x3, 0xf },
+    { 2, 0x2, 0x10 }, { 6, 0x2, 0x10 }, { 13, 0x2, 0x10 }, { 37, 0x3, 0x10 },
+    { 2, 0x2, 0x11 }, { 6, 0x2, 0x11 }, { 13, 0x2, 0x11 }, { 37, 0x3, 0x11 },
+    { 2, 0x2, 0x12 }, { 6, 0x2, 0x12 }, { 13, 0x2, 0x12 }, { 37, 0x3, 0x12 },
+    /* state 72: 110011110 */
+    { 0, 0x4, 0xf }, { 3, 0x2, 0xf }, { 7, 0x2, 0xf }, { 10, 0x2, 0xf },
+    { 14, 0x2, 0xf }, { 21, 0x2, 0xf }, { 38, 0x2, 0xf }, { 137, 0x3, 0xf },
+    { 0, 0x4, 0x10 }, { 3, 0x2, 0x10 }, { 7, 0x2, 0x10 }, { 10, 0x2, 0x10 },
+    { 14, 0x2, 0x10 }, { 21, 0x2, 0x10 }, { 38, 0x2, 0x10 }, { 137, 0x3, 0x10 },
+    /* state 73: 110011111 */
+    { 0, 0x4, 0x11 }, { 3, 0x2, 0x11 }, { 7, 0x2, 0x11 }, { 10, 0x2, 0x11 },
+    { 14, 0x2, 0x11 }, { 21, 0x2, 0x11 }, { 38, 0x2, 0x11 }, { 137, 0x3, 0x11 },
+    { 0, 0x4, 0x12 }, { 3, 0x2, 0x12 }, { 7, 0x2, 0x12 }, { 10, 0x2, 0x12 },
+    { 14, 0x2, 0x12 }, { 21, 0x2, 0x12 }, { 38, 0x2, 0x12 }, { 137, 0x3, 0x12 },
+    /* state 74: 1101 */
+    { 78, 0x0, 0x0 }, { 81, 0x0, 0x0 }, { 85, 0x0, 0x0 }, { 88, 0x0, 0x0 },
+    { 93, 0x0, 0x0 }, { 96, 0x0, 0x0 }, { 100, 0x0, 0x0 }, { 103, 0x0, 0x0 },
+    { 109, 0x0, 0x0 }, { 112, 0x0, 0x0 }, { 116, 0x0, 0x0 }, { 119, 0x0, 0x0 },
+    { 124, 0x0, 0x0 }, { 127, 0x0, 0x0 }, { 131, 0x0, 0x0 }, { 134, 0x0, 0x0 },
+    /* state 75: 11010 */
+    { 79, 0x0, 0x0 }, { 80, 0x0, 0x0 }, { 82, 0x0, 0x0 }, { 83, 0x0, 0x0 },
+    { 86, 0x0, 0x0 }, { 87, 0x0, 0x0 }, { 89, 0x0, 0x0 }, { 90, 0x0, 0x0 },
+    { 94, 0x0, 0x0 }, { 95, 0x0, 0x0 }, { 97, 0x0, 0x0 }, { 98, 0x0, 0x0 },
+    { 101, 0x0, 0x0 }, { 102, 0x0, 0x0 }, { 104, 0x0, 0x0 }, { 105, 0x0, 0x0 },
+    /* state 76: 110100 */
+    { 0, 0x3, 0x13 }, { 0, 0x3, 0x14 }, { 0, 0x3, 0x15 }, { 0, 0x3, 0x16 },
+    { 0, 0x3, 0x17 }, { 0, 0x3, 0x18 }, { 0, 0x3, 0x19 }, { 0, 0x3, 0x1a },
+    { 0, 0x3, 0x1b }, { 0, 0x3, 0x1c }, { 0, 0x3, 0x1d }, { 0, 0x3, 0x1e },
+    { 0, 0x3, 0x1f }, { 0, 0x3, 0x21 }, { 0, 0x3, 0x22 }, { 0, 0x3, 0x23 },
+    /* state 77: 1101000 */
+    { 1, 0x2, 0x13 }, { 12, 0x3, 0x13 }, { 1, 0x2, 0x14 }, { 12, 0x3, 0x14 },
+    { 1, 0x2, 0x15 }, { 12, 0x3, 0x15 }, { 1, 0x2, 0x16 }, { 12, 0x3, 0x16 },
+    { 1, 0x2, 0x17 }, { 12, 0x3, 0x17 }, { 1, 0x2, 0x18 }, { 12, 0x3, 0x18 },
+    { 1, 0x2, 0x19 }, { 12, 0x3, 0x19 }, { 1, 0x2, 0x1a }, { 12, 0x3, 0x1a },
+    /* state 78: 11010000 */
+    { 2, 0x2, 0x13 }, { 6, 0x2, 0x13 }, { 13, 0x2, 0x13 }, { 37, 0x3, 0x13 },
+    { 2, 0x2, 0x14 }, { 6, 0x2, 0x14 }, { 13, 0x2, 0x14 }, { 37, 0x3, 0x14 },
+    { 2, 0x2, 0x15 }, { 6, 0x2, 0x15 }, { 13, 0x2, 0x15 }, { 37, 0x3, 0x15 },
+    { 2, 0x2, 0x16 }, { 6, 0x2, 0x16 }, { 13, 0x2, 0x16 }, { 37, 0x3, 0x16 },
+    /* state 79: 110100000 */
+    { 0, 0x4, 0x13 }, { 3, 0x2, 0x13 }, { 7, 0x2, 0x13 }, { 10, 0x2, 0x13 },
+    { 14, 0x2, 0x13 }, { 21, 0x2, 0x13 }, { 38, 0x2, 0x13 }, { 137, 0x3, 0x13 },
+    { 0, 0x4, 0x14 }, { 3, 0x2, 0x14 }, { 7, 0x2, 0x14 }, { 10, 0x2, 0x14 },
+    { 14, 0x2, 0x14 }, { 21, 0x2, 0x14 }, { 38, 0x2, 0x14 }, { 137, 0x3, 0x14 },
+    /* state 80: 110100001 */
+    { 0, 0x4, 0x15 }, { 3, 0x2, 0x15 }, { 7, 0x2, 0x15 }, { 10, 0x2, 0x15 },
+    { 14, 0x2, 0x15 }, { 21, 0x2, 0x15 }, { 38, 0x2, 0x15 }, { 137, 0x3, 0x15 },
+    { 0, 0x4, 0x16 }, { 3, 0x2, 0x16 }, { 7, 0x2, 0x16 }, { 10, 0x2, 0x16 },
+    { 14, 0x2, 0x16 }, { 21, 0x2, 0x16 }, { 38, 0x2, 0x16 }, { 137, 0x3, 0x16 },
+    /* state 81: 11010001 */
+    { 2, 0x2, 0x17 }, { 6, 0x2, 0x17 }, { 13, 0x2, 0x17 }, { 37, 0x3, 0x17 },
+    { 2, 0x2, 0x18 }, { 6, 0x2, 0x18 }, { 13, 0x2, 0x18 }, { 37, 0x3, 0x18 },
+    { 2, 0x2, 0x19 }, { 6, 0x2, 0x19 }, { 13, 0x2, 0x19 }, { 37, 0x3, 0x19 },
+    { 2, 0x2, 0x1a }, { 6, 0x2, 0x1a }, { 13, 0x2, 0x1a }, { 37, 0x3, 0x1a },
+    /* state 82: 110100010 */
+    { 0, 0x4, 0x17 }, { 3, 0x2, 0x17 }, { 7, 0x2, 0x17 }, { 10, 0x2, 0x17 },
+    { 14, 0x2, 0x17 }, { 21, 0x2, 0x17 }, { 38, 0x2, 0x17 }, { 137, 0x3, 0x17 },
+    { 0, 0x4, 0x18 }, { 3, 0x2, 0x18 }, { 7, 0x2, 0x18 }, { 10, 0x2, 0x18 },
+    { 14, 0x2, 0x18 }, { 21, 0x2, 0x18 }, { 38, 0x2, 0x18 }, { 137, 0x3, 0x18 },
+    /* state 83: 110100011 */
+    { 0, 0x4, 0x19 }, { 3, 0x2, 0x19 }, { 7, 0x2, 0x19 }, { 10, 0x2, 0x19 },
+    { 14, 0x2, 0x19 }, { 21, 0x2, 0x19 }, { 38, 0x2, 0x19 }, { 137, 0x3, 0x19 },
+    { 0, 0x4, 0x1a }, { 3, 0x2, 0x1a }, { 7, 0x2, 0x1a }, { 10, 0x2, 0x1a },
+    { 14, 0x2, 0x1a }, { 21, 0x2, 0x1a }, { 38, 0x2, 0x1a }, { 137, 0x3, 0x1a },
+    /* state 84: 1101001 */
+    { 1, 0x2, 0x1b }, { 12, 0x3, 0x1b }, { 1, 0x2, 0x1c }, { 12, 0x3, 0x1c },
+    { 1, 0x2, 0x1d }, { 12, 0x3, 0x1d }, { 1, 0x2, 0x1e }, { 12, 0x3, 0x1e },
+    { 1, 0x2, 0x1f }, { 12, 0x3, 0x1f }, { 1, 0x2, 0x21 }, { 12, 0x3, 0x21 },
+    { 1, 0x2, 0x22 }, { 12, 0x3, 0x22 }, { 1, 0x2, 0x23 }, { 12, 0x3, 0x23 },
+    /* state 85: 11010010 */
+    { 2, 0x2, 0x1b }, { 6, 0x2, 0x1b }, { 13, 0x2, 0x1b }, { 37, 0x3, 0x1b },
+    { 2, 0x2, 0x1c }, { 6, 0x2, 0x1c }, { 13, 0x2, 0x1c }, { 37, 0x3, 0x1c },
+    { 2, 0x2, 0x1d }, { 6, 0x2, 0x1d }, { 13, 0x2, 0x1d }, { 37, 0x3, 0x1d },
+    { 2, 0x2, 0x1e }, { 6, 0x2, 0x1e }, { 13, 0x2, 0x1e }, { 37, 0x3, 0x1e },
+    /* state 86: 110100100 */
+    { 0, 0x4, 0x1b }, { 3, 0x2, 0x1b }, { 7, 0x2, 0x1b }, { 10, 0x2, 0x1b },
+    { 14, 0x2, 0x1b }, { 21, 0x2, 0x1b }, { 38, 0x2, 0x1b }, { 137, 0x3, 0x1b },
+    { 0, 0x4, 0x1c }, { 3, 0x2, 0x1c }, { 7, 0x2, 0x1c }, { 10, 0x2, 0x1c },
+    { 14, 0x2, 0x1c }, { 21, 0x2, 0x1c }, { 38, 0x2, 0x1c }, { 137, 0x3, 0x1c },
+    /* state 87: 110100101 */
+    { 0, 0x4, 0x1d }, { 3, 0x2, 0x1d }, { 7, 0x2, 0x1d }, { 10, 0x2, 0x1d },
+    { 14, 0x2, 0x1d }, { 21, 0x2, 0x1d }, { 38, 0x2, 0x1d }, { 137, 0x3, 0x1d },
+    { 0, 0x4, 0x1e }, { 3, 0x2, 0x1e }, { 7, 0x2, 0x1e }, { 10, 0x2, 0x1e },
+    { 14, 0x2, 0x1e }, { 21, 0x2, 0x1e }, { 38, 0x2, 0x1e }, { 137, 0x3, 0x1e },
+    /* state 88: 11010011 */
+    { 2, 0x2, 0x1f }, { 6, 0x2, 0x1f }, { 13, 0x2, 0x1f }, { 37, 0x3, 0x1f },
+    { 2, 0x2, 0x21 }, { 6, 0x2, 0x21 }, { 13, 0x2, 0x21 }, { 37, 0x3, 0x21 },
+    { 2, 0x2, 0x22 }, { 6, 0x2, 0x22 }, { 13, 0x2, 0x22 }, { 37, 0x3, 0x22 },
+    { 2, 0x2, 0x23 }, { 6, 0x2, 0x23 }, { 13, 0x2, 0x23 }, { 37, 0x3, 0x23 },
+    /* state 89: 110100110 */
+    { 0, 0x4, 0x1f }, { 3, 0x2, 0x1f }, { 7, 0x2, 0x1f }, { 10, 0x2, 0x1f },
+    { 14, 0x2, 0x1f }, { 21, 0x2, 0x1f }, { 38, 0x2, 0x1f }, { 137, 0x3, 0x1f },
+    { 0, 0x4, 0x21 }, { 3, 0x2, 0x21 }, { 7, 0x2, 0x21 }, { 10, 0x2, 0x21 },
+    { 14, 0x2, 0x21 }, { 21, 0x2, 0x21 }, { 38, 0x2, 0x21 }, { 137, 0x3, 0x21 },
+    /* state 90: 110100111 */
+    { 0, 0x4, 0x22 }, { 3, 0x2, 0x22 }, { 7, 0x2, 0x22 }, { 10, 0x2, 0x22 },
+    { 14, 0x2, 0x22 }, { 21, 0x2, 0x22 }, { 38, 0x2, 0x22 }, { 137, 0x3, 0x22 },
+    { 0, 0x4, 0x23 }, { 3, 0x2, 0x23 }, { 7, 0x2, 0x23 }, { 10, 0x2, 0x23 },
+    { 14, 0x2, 0x23 }, { 21, 0x2, 0x23 }, { 38, 0x2, 0x23 }, { 137, 0x3, 0x23 },
+    /* state 91: 110101 */
+    { 0, 0x3, 0x24 }, { 0, 0x3, 0x25 }, { 0, 0x3, 0x26 }, { 0, 0x3, 0x28 },
+    { 0, 0x3, 0x29 }, { 0, 0x3, 0x2a }, { 0, 0x3, 0x2b }, { 0, 0x3, 0x2f },
+    { 0, 0x3, 0x30 }, { 0, 0x3, 0x31 }, { 0, 0x3, 0x32 }, { 0, 0x3, 0x33 },
+    { 0, 0x3, 0x34 }, { 0, 0x3, 0x35 }, { 0, 0x3, 0x36 }, { 0, 0x3, 0x37 },
+    /* state 92: 1101010 */
+    { 1, 0x2, 0x24 }, { 12, 0x3, 0x24 }, { 1, 0x2, 0x25 }, { 12, 0x3, 0x25 },
+    { 1, 0x2, 0x26 }, { 12, 0x3, 0x26 }, { 1, 0x2, 0x28 }, { 12, 0x3, 0x28 },
+    { 1, 0x2, 0x29 }, { 12, 0x3, 0x29 }, { 1, 0x2, 0x2a }, { 12, 0x3, 0x2a },
+    { 1, 0x2, 0x2b }, { 12, 0x3, 0x2b }, { 1, 0x2, 0x2f }, { 12, 0x3, 0x2f },
+    /* state 93: 11010100 */
+    { 2, 0x2, 0x24 }, { 6, 0x2, 0x24 }, { 13, 0x2, 0x24 }, { 37, 0x3, 0x24 },
+    { 2, 0x2, 0x25 }, { 6, 0x2, 0x25 }, { 13, 0x2, 0x25 }, { 37, 0x3, 0x25 },
+    { 2, 0x2, 0x26 }, { 6, 0x2, 0x26 }, { 13, 0x2, 0x26 }, { 37, 0x3, 0x26 },
+    { 2, 0x2, 0x28 }, { 6, 0x2, 0x28 }, { 13, 0x2, 0x28 }, { 37, 0x3, 0x28 },
+    /* state 94: 110101000 */
+    { 0, 0x4, 0x24 }, { 3, 0x2, 0x24 }, { 7, 0x2, 0x24 }, { 10, 0x2, 0x24 },
+    { 14, 0x2, 0x24 }, { 21, 0x2, 0x24 }, { 38, 0x2, 0x24 }, { 137, 0x3, 0x24 },
+    { 0, 0x4, 0x25 }, { 3, 0x2, 0x25 }, { 7, 0x2, 0x25 }, { 10, 0x2, 0x25 },
+    { 14, 0x2, 0x25 }, { 21, 0x2, 0x25 }, { 38, 0x2, 0x25 }, { 137, 0x3, 0x25 },
+    /* state 95: 110101001 */
+    { 0, 0x4, 0x26 }, { 3, 0x2, 0x26 }, { 7, 0x2, 0x26 }, { 10, 0x2, 0x26 },
+    { 14, 0x2, 0x26 }, { 21, 0x2, 0x26 }, { 38, 0x2, 0x26 }, { 137, 0x3, 0x26 },
+    { 0, 0x4, 0x28 }, { 3, 0x2, 0x28 }, { 7, 0x2, 0x28 }, { 10, 0x2, 0x28 },
+    { 14, 0x2, 0x28 }, { 21, 0x2, 0x28 }, { 38, 0x2, 0x28 }, { 137, 0x3, 0x28 },
+    /* state 96: 11010101 */
+    { 2, 0x2, 0x29 }, { 6, 0x2, 0x29 }, { 13, 0x2, 0x29 }, { 37, 0x3, 0x29 },
+    { 2, 0x2, 0x2a }, { 6, 0x2, 0x2a }, { 13, 0x2, 0x2a }, { 37, 0x3, 0x2a },
+    { 2, 0x2, 0x2b }, { 6, 0x2, 0x2b }, { 13, 0x2, 0x2b }, { 37, 0x3, 0x2b },
+    { 2, 0x2, 0x2f }, { 6, 0x2, 0x2f }, { 13, 0x2, 0x2f }, { 37, 0x3, 0x2f },
+    /* state 97: 110101010 */
+    { 0, 0x4, 0x29 }, { 3, 0x2, 0x29 }, { 7, 0x2, 0x29 }, { 10, 0x2, 0x29 },
+    { 14, 0x2, 0x29 }, { 21, 0x2, 0x29 }, { 38, 0x2, 0x29 }, { 137, 0x3, 0x29 },
+    { 0, 0x4, 0x2a }, { 3, 0x2, 0x2a }, { 7, 0x2, 0x2a }, { 10, 0x2, 0x2a },
+    { 14, 0x2, 0x2a }, { 21, 0x2, 0x2a }, { 38, 0x2, 0x2a }, { 137, 0x3, 0x2a },
+    /* state 98: 110101011 */
+    { 0, 0x4, 0x2b }, { 3, 0x2, 0x2b }, { 7, 0x2, 0x2b }, { 10, 0x2, 0x2b },
+    { 14, 0x2, 0x2b }, { 21, 0x2, 0x2b }, { 38, 0x2, 0x2b }, { 137, 0x3, 0x2b },
+    { 0, 0x4, 0x2f }, { 3, 0x2, 0x2f }, { 7, 0x2, 0x2f }, { 10, 0x2, 0x2f },
+    { 14, 0x2, 0x2f }, { 21, 0x2, 0x2f }, { 38, 0x2, 0x2f }, { 137, 0x3, 0x2f },
+    /* state 99: 1101011 */
+    { 1, 0x2, 0x30 }, { 12, 0x3, 0x30 }, { 1, 0x2, 0x31 }, { 12, 0x3, 0x31 },
+    { 1, 0x2, 0x32 }, { 12, 0x3, 0x32 }, { 1, 0x2, 0x33 }, { 12, 0x3, 0x33 },
+    { 1, 0x2, 0x34 }, { 12, 0x3, 0x34 }, { 1, 0x2, 0x35 }, { 12, 0x3, 0x35 },
+    { 1, 0x2, 0x36 }, { 12, 0x3, 0x36 }, { 1, 0x2, 0x37 }, { 12, 0x3, 0x37 },
+    /* state 100: 11010110 */
+    { 2, 0x2, 0x30 }, { 6, 0x2, 0x30 }, { 13, 0x2, 0x30 }, { 37, 0x3, 0x30 },
+    { 2, 0x2, 0x31 }, { 6, 0x2, 0x31 }, { 13, 0x2, 0x31 }, { 37, 0x3, 0x31 },
+    { 2, 0x2, 0x32 }, { 6, 0x2, 0x32 }, { 13, 0x2, 0x32 }, { 37, 0x3, 0x32 },
+    { 2, 0x2, 0x33 }, { 6, 0x2, 0x33 }, { 13, 0x2, 0x33 }, { 37, 0x3, 0x33 },
+    /* state 101: 110101100 */
+    { 0, 0x4, 0x30 }, { 3, 0x2, 0x30 }, { 7, 0x2, 0x30 }, { 10, 0x2, 0x30 },
+    { 14, 0x2, 0x30 }, { 21, 0x2, 0x30 }, { 38, 0x2, 0x30 }, { 137, 0x3, 0x30 },
+    { 0, 0x4, 0x31 }, { 3, 0x2, 0x31 }, { 7, 0x2, 0x31 }, { 10, 0x2, 0x31 },
+    { 14, 0x2, 0x31 }, { 21, 0x2, 0x31 }, { 38, 0x2, 0x31 }, { 137, 0x3, 0x31 },
+    /* state 102: 110101101 */
+    { 0, 0x4, 0x32 }, { 3, 0x2, 0x32 }, { 7, 0x2, 0x32 }, { 10, 0x2, 0x32 },
+    { 14, 0x2, 0x32 }, { 21, 0x2, 0x32 }, { 38, 0x2, 0x32 }, { 137, 0x3, 0x32 },
+    { 0, 0x4, 0x33 }, { 3, 0x2, 0x33 }, { 7, 0x2, 0x33 }, { 10, 0x2, 0x33 },
+    { 14, 0x2, 0x33 }, { 21, 0x2, 0x33 }, { 38, 0x2, 0x33 }, { 137, 0x3, 0x33 },
+    /* state 103: 11010111 */
+    { 2, 0x2, 0x34 }, { 6, 0x2, 0x34 }, { 13, 0x2, 0x34 }, { 37, 0x3, 0x34 },
+    { 2, 0x2, 0x35 }, { 6, 0x2, 0x35 }, { 13, 0x2, 0x35 }, { 37, 0x3, 0x35 },
+    { 2, 0x2, 0x36 }, { 6, 0x2, 0x36 }, { 13, 0x2, 0x36 }, { 37, 0x3, 0x36 },
+    { 2, 0x2, 0x37 }, { 6, 0x2, 0x37 }, { 13, 0x2, 0x37 }, { 37, 0x3, 0x37 },
+    /* state 104: 110101110 */
+    { 0, 0x4, 0x34 }, { 3, 0x2, 0x34 }, { 7, 0x2, 0x34 }, { 10, 0x2, 0x34 },
+    { 14, 0x2, 0x34 }, { 21, 0x2, 0x34 }, { 38, 0x2, 0x34 }, { 137, 0x3, 0x34 },
+    { 0, 0x4, 0x35 }, { 3, 0x2, 0x35 }, { 7, 0x2, 0x35 }, { 10, 0x2, 0x35 },
+    { 14, 0x2, 0x35 }, { 21, 0x2, 0x35 }, { 38, 0x2, 0x35 }, { 137, 0x3, 0x35 },
+    /* state 105: 110101111 */
+    { 0, 0x4, 0x36 }, { 3, 0x2, 0x36 }, { 7, 0x2, 0x36 }, { 10, 0x2, 0x36 },
+    { 14, 0x2, 0x36 }, { 21, 0x2, 0x36 }, { 38, 0x2, 0x36 }, { 137, 0x3, 0x36 },
+    { 0, 0x4, 0x37 }, { 3, 0x2, 0x37 }, { 7, 0x2, 0x37 }, { 10, 0x2, 0x37 },
+    { 14, 0x2, 0x37 }, { 21, 0x2, 0x37 }, { 38, 0x2, 0x37 }, { 137, 0x3, 0x37 },
+    /* state 106: 11011 */
+    { 110, 0x0, 0x0 }, { 111, 0x0, 0x0 }, { 113, 0x0, 0x0 }, { 114, 0x0, 0x0 },
+    { 117, 0x0, 0x0 }, { 118, 0x0, 0x0 }, { 120, 0x0, 0x0 }, { 121, 0x0, 0x0 },
+    { 125, 0x0, 0x0 }, { 126, 0x0, 0x0 }, { 128, 0x0, 0x0 }, { 129, 0x0, 0x0 },
+    { 132, 0x0, 0x0 }, { 133, 0x0, 0x0 }, { 135, 0x0, 0x0 }, { 136, 0x0, 0x0 },
+    /* state 107: 110110 */
+    { 0, 0x3, 0x38 }, { 0, 0x3, 0x39 }, { 0, 0x3, 0x3a }, { 0, 0x3, 0x3b },
+    { 0, 0x3, 0x3c }, { 0, 0x3, 0x3d }, { 0, 0x3, 0x3e }, { 0, 0x3, 0x40 },
+    { 0, 0x3, 0x41 }, { 0, 0x3, 0x4a }, { 0, 0x3, 0x4b }, { 0, 0x3, 0x4e },
+    { 0, 0x3, 0x4f }, { 0, 0x3, 0x51 }, { 0, 0x3, 0x52 }, { 0, 0x3, 0x53 },
+    /* state 108: 1101100 */
+    { 1, 0x2, 0x38 }, { 12, 0x3, 0x38 }, { 1, 0x2, 0x39 }, { 12, 0x3, 0x39 },
+    { 1, 0x2, 0x3a }, { 12, 0x3, 0x3a }, { 1, 0x2, 0x3b }, { 12, 0x3, 0x3b },
+    { 1, 0x2, 0x3c }, { 12, 0x3, 0x3c }, { 1, 0x2, 0x3d }, { 12, 0x3, 0x3d },
+    { 1, 0x2, 0x3e }, { 12, 0x3, 0x3e }, { 1, 0x2, 0x40 }, { 12, 0x3, 0x40 },
+    /* state 109: 11011000 */
+    { 2, 0x2, 0x38 }, { 6, 0x2, 0x38 }, { 13, 0x2, 0x38 }, { 37, 0x3, 0x38 },
+    { 2, 0x2, 0x39 }, { 6, 0x2, 0x39 }, { 13, 0x2, 0x39 }, { 37, 0x3, 0x39 },
+    { 2, 0x2, 0x3a }, { 6, 0x2, 0x3a }, { 13, 0x2, 0x3a }, { 37, 0x3, 0x3a },
+    { 2, 0x2, 0x3b }, { 6, 0x2, 0x3b }, { 13, 0x2, 0x3b }, { 37, 0x3, 0x3b },
+    /* state 110: 110110000 */
+    { 0, 0x4, 0x38 }, { 3, 0x2, 0x38 }, { 7, 0x2, 0x38 }, { 10, 0x2, 0x38 },
+    { 14, 0x2, 0x38 }, { 21, 0x2, 0x38 }, { 38, 0x2, 0x38 }, { 137, 0x3, 0x38 },
+    { 0, 0x4, 0x39 }, { 3, 0x2, 0x39 }, { 7, 0x2, 0x39 }, { 10, 0x2, 0x39 },
+    { 14, 0x2, 0x39 }, { 21, 0x2, 0x39 }, { 38, 0x2, 0x39 }, { 137, 0x3, 0x39 },
+    /* state 111: 110110001 */
+    { 0, 0x4, 0x3a }, { 3, 0x2, 0x3a }, { 7, 0x2, 0x3a }, { 10, 0x2, 0x3a },
+    { 14, 0x2, 0x3a }, { 21, 0x2, 0x3a }, { 38, 0x2, 0x3a }, { 137, 0x3, 0x3a },
+    { 0, 0x4, 0x3b }, { 3, 0x2, 0x3b }, { 7, 0x2, 0x3b }, { 10, 0x2, 0x3b },
+    { 14, 0x2, 0x3b }, { 21, 0x2, 0x3b }, { 38, 0x2, 0x3b }, { 137, 0x3, 0x3b },
+    /* state 112: 11011001 */
+    { 2, 0x2, 0x3c }, { 6, 0x2, 0x3c }, { 13, 0x2, 0x3c }, { 37, 0x3, 0x3c },
+    { 2, 0x2, 0x3d }, { 6, 0x2, 0x3d }, { 13, 0x2, 0x3d }, { 37, 0x3, 0x3d },
+    { 2, 0x2, 0x3e }, { 6, 0x2, 0x3e }, { 13, 0x2, 0x3e }, { 37, 0x3, 0x3e },
+    { 2, 0x2, 0x40 }, { 6, 0x2, 0x40 }, { 13, 0x2, 0x40 }, { 37, 0x3, 0x40 },
+    /* state 113: 110110010 */
+    { 0, 0x4, 0x3c }, { 3, 0x2, 0x3c }, { 7, 0x2, 0x3c }, { 10, 0x2, 0x3c },
+    { 14, 0x2, 0x3c }, { 21, 0x2, 0x3c }, { 38, 0x2, 0x3c }, { 137, 0x3, 0x3c },
+    { 0, 0x4, 0x3d }, { 3, 0x2, 0x3d }, { 7, 0x2, 0x3d }, { 10, 0x2, 0x3d },
+    { 14, 0x2, 0x3d }, { 21, 0x2, 0x3d }, { 38, 0x2, 0x3d }, { 137, 0x3, 0x3d },
+    /* state 114: 110110011 */
+    { 0, 0x4, 0x3e }, { 3, 0x2, 0x3e }, { 7, 0x2, 0x3e }, { 10, 0x2, 0x3e },
+    { 14, 0x2, 0x3e }, { 21, 0x2, 0x3e }, { 38, 0x2, 0x3e }, { 137, 0x3, 0x3e },
+    { 0, 0x4, 0x40 }, { 3, 0x2, 0x40 }, { 7, 0x2, 0x40 }, { 10, 0x2, 0x40 },
+    { 14, 0x2, 0x40 }, { 21, 0x2, 0x40 }, { 38, 0x2, 0x40 }, { 137, 0x3, 0x40 },
+    /* state 115: 1101101 */
+    { 1, 0x2, 0x41 }, { 12, 0x3, 0x41 }, { 1, 0x2, 0x4a }, { 12, 0x3, 0x4a },
+    { 1, 0x2, 0x4b }, { 12, 0x3, 0x4b }, { 1, 0x2, 0x4e }, { 12, 0x3, 0x4e },
+    { 1, 0x2, 0x4f }, { 12, 0x3, 0x4f }, { 1, 0x2, 0x51 }, { 12, 0x3, 0x51 },
+    { 1, 0x2, 0x52 }, { 12, 0x3, 0x52 }, { 1, 0x2, 0x53 }, { 12, 0x3, 0x53 },
+    /* state 116: 11011010 */
+    { 2, 0x2, 0x41 }, { 6, 0x2, 0x41 }, { 13, 0x2, 0x41 }, { 37, 0x3, 0x41 },
+    { 2, 0x2, 0x4a }, { 6, 0x2, 0x4a }, { 13, 0x2, 0x4a }, { 37, 0x3, 0x4a },
+    { 2, 0x2, 0x4b }, { 6, 0x2, 0x4b }, { 13, 0x2, 0x4b }, { 37, 0x3, 0x4b },
+    { 2, 0x2, 0x4e }, { 6, 0x2, 0x4e }, { 13, 0x2, 0x4e }, { 37, 0x3, 0x4e },
+    /* state 117: 110110100 */
+    { 0, 0x4, 0x41 }, { 3, 0x2, 0x41 }, { 7, 0x2, 0x41 }, { 10, 0x2, 0x41 },
+    { 14, 0x2, 0x41 }, { 21, 0x2, 0x41 }, { 38, 0x2, 0x41 }, { 137, 0x3, 0x41 },
+    { 0, 0x4, 0x4a }, { 3, 0x2, 0x4a }, { 7, 0x2, 0x4a }, { 10, 0x2, 0x4a },
+    { 14, 0x2, 0x4a }, { 21, 0x2, 0x4a }, { 38, 0x2, 0x4a }, { 137, 0x3, 0x4a },
+    /* state 118: 110110101 */
+    { 0, 0x4, 0x4b }, { 3, 0x2, 0x4b }, { 7, 0x2, 0x4b }, { 10, 0x2, 0x4b },
+    { 14, 0x2, 0x4b }, { 21, 0x2, 0x4b }, { 38, 0x2, 0x4b }, { 137, 0x3, 0x4b },
+    { 0, 0x4, 0x4e }, { 3, 0x2, 0x4e }, { 7, 0x2, 0x4e }, { 10, 0x2, 0x4e },
+    { 14, 0x2, 0x4e }, { 21, 0x2, 0x4e }, { 38, 0x2, 0x4e }, { 137, 0x3, 0x4e },
+    /* state 119: 11011011 */
+    { 2, 0x2, 0x4f }, { 6, 0x2, 0x4f }, { 13, 0x2, 0x4f }, { 37, 0x3, 0x4f },
+    { 2, 0x2, 0x51 }, { 6, 0x2, 0x51 }, { 13, 0x2, 0x51 }, { 37, 0x3, 0x51 },
+    { 2, 0x2, 0x52 }, { 6, 0x2, 0x52 }, { 13, 0x2, 0x52 }, { 37, 0x3, 0x52 },
+    { 2, 0x2, 0x53 }, { 6, 0x2, 0x53 }, { 13, 0x2, 0x53 }, { 37, 0x3, 0x53 },
+    /* state 120: 110110110 */
+    { 0, 0x4, 0x4f }, { 3, 0x2, 0x4f }, { 7, 0x2, 0x4f }, { 10, 0x2, 0x4f },
+    { 14, 0x2, 0x4f }, { 21, 0x2, 0x4f }, { 38, 0x2, 0x4f }, { 137, 0x3, 0x4f },
+    { 0, 0x4, 0x51 }, { 3, 0x2, 0x51 }, { 7, 0x2, 0x51 }, { 10, 0x2, 0x51 },
+    { 14, 0x2, 0x51 }, { 21, 0x2, 0x51 }, { 38, 0x2, 0x51 }, { 137, 0x3, 0x51 },
+    /* state 121: 110110111 */
+    { 0, 0x4, 0x52 }, { 3, 0x2, 0x52 }, { 7, 0x2, 0x52 }, { 10, 0x2, 0x52 },
+    { 14, 0x2, 0x52 }, { 21, 0x2, 0x52 }, { 38, 0x2, 0x52 }, { 137, 0x3, 0x52 },
+    { 0, 0x4, 0x53 }, { 3, 0x2, 0x53 }, { 7, 0x2, 0x53 }, { 10, 0x2, 0x53 },
+    { 14, 0x2, 0x53 }, { 21, 0x2, 0x53 }, { 38, 0x2, 0x53 }, { 137, 0x3, 0x53 },
+    /* state 122: 110111 */
+    { 0, 0x3, 0x55 }, { 0, 0x3, 0x58 }, { 0, 0x3, 0x5a }, { 0, 0x3, 0x5b },
+    { 0, 0x3, 0x5c }, { 0, 0x3, 0x5d }, { 0, 0x3, 0x5e }, { 0, 0x3, 0x5f },
+    { 0, 0x3, 0x60 }, { 0, 0x3, 0x7a }, { 0, 0x3, 0x7b }, { 0, 0x3, 0x7c },
+    { 0, 0x3, 0x7d }, { 0, 0x3, 0x7e }, { 0, 0x3, 0x7f }, { 0, 0x3, 0x80 },
+    /* state 123: 1101110 */
+    { 1, 0x2, 0x55 }, { 12, 0x3, 0x55 }, { 1, 0x2, 0x58 }, { 12, 0x3, 0x58 },
+    { 1, 0x2, 0x5a }, { 12, 0x3, 0x5a }, { 1, 0x2, 0x5b }, { 12, 0x3, 0x5b },
+    { 1, 0x2, 0x5c }, { 12, 0x3, 0x5c }, { 1, 0x2, 0x5d }, { 12, 0x3, 0x5d },
+    { 1, 0x2, 0x5e }, { 12, 0x3, 0x5e }, { 1, 0x2, 0x5f }, { 12, 0x3, 0x5f },
+    /* state 124: 11011100 */
+    { 2, 0x2, 0x55 }, { 6, 0x2, 0x55 }, { 13, 0x2, 0x55 }, { 37, 0x3, 0x55 },
+    { 2, 0x2, 0x58 }, { 6, 0x2, 0x58 }, { 13, 0x2, 0x58 }, { 37, 0x3, 0x58 },
+    { 2, 0x2, 0x5a }, { 6, 0x2, 0x5a }, { 13, 0x2, 0x5a }, { 37, 0x3, 0x5a },
+    { 2, 0x2, 0x5b }, { 6, 0x2, 0x5b }, { 13, 0x2, 0x5b }, { 37, 0x3, 0x5b },
+    /* state 125: 110111000 */
+    { 0, 0x4, 0x55 }, { 3, 0x2, 0x55 }, { 7, 0x2, 0x55 }, { 10, 0x2, 0x55 },
+    { 14, 0x2, 0x55 }, { 21, 0x2, 0x55 }, { 38, 0x2, 0x55 }, { 137, 0x3, 0x55 },
+    { 0, 0x4, 0x58 }, { 3, 0x2, 0x58 }, { 7, 0x2, 0x58 }, { 10, 0x2, 0x58 },
+    { 14, 0x2, 0x58 }, { 21, 0x2, 0x58 }, { 38, 0x2, 0x58 }, { 137, 0x3, 0x58 },
+    /* state 126: 110111001 */
+    { 0, 0x4, 0x5a }, { 3, 0x2, 0x5a }, { 7, 0x2, 0x5a }, { 10, 0x2, 0x5a },
+    { 14, 0x2, 0x5a }, { 21, 0x2, 0x5a }, { 38, 0x2, 0x5a }, { 137, 0x3, 0x5a },
+    { 0, 0x4, 0x5b }, { 3, 0x2, 0x5b }, { 7, 0x2, 0x5b }, { 10, 0x2, 0x5b },
+    { 14, 0x2, 0x5b }, { 21, 0x2, 0x5b }, { 38, 0x2, 0x5b }, { 137, 0x3, 0x5b },
+    /* state 127: 11011101 */
+    { 2, 0x2, 0x5c }, { 6, 0x2, 0x5c }, { 13, 0x2, 0x5c }, { 37, 0x3, 0x5c },
+    { 2, 0x2, 0x5d }, { 6, 0x2, 0x5d }, { 13, 0x2, 0x5d }, { 37, 0x3, 0x5d },
+    { 2, 0x2, 0x5e }, { 6, 0x2, 0x5e }, { 13, 0x2, 0x5e }, { 37, 0x3, 0x5e },
+    { 2, 0x2, 0x5f }, { 6, 0x2, 0x5f }, { 13, 0x2, 0x5f }, { 37, 0x3, 0x5f },
+    /* state 128: 110111010 */
+    { 0, 0x4, 0x5c }, { 3, 0x2, 0x5c }, { 7, 0x2, 0x5c }, { 10, 0x2, 0x5c },
+    { 14, 0x2, 0x5c }, { 21, 0x2, 0x5c }, { 38, 0x2, 0x5c }, { 137, 0x3, 0x5c },
+    { 0, 0x4, 0x5d }, { 3, 0x2, 0x5d }, { 7, 0x2, 0x5d }, { 10, 0x2, 0x5d },
+    { 14, 0x2, 0x5d }, { 21, 0x2, 0x5d }, { 38, 0x2, 0x5d }, { 137, 0x3, 0x5d },
+    /* state 129: 110111011 */
+    { 0, 0x4, 0x5e }, { 3, 0x2, 0x5e }, { 7, 0x2, 0x5e }, { 10, 0x2, 0x5e },
+    { 14, 0x2, 0x5e }, { 21, 0x2, 0x5e }, { 38, 0x2, 0x5e }, { 137, 0x3, 0x5e },
+    { 0, 0x4, 0x5f }, { 3, 0x2, 0x5f }, { 7, 0x2, 0x5f }, { 10, 0x2, 0x5f },
+    { 14, 0x2, 0x5f }, { 21, 0x2, 0x5f }, { 38, 0x2, 0x5f }, { 137, 0x3, 0x5f },
+    /* state 130: 1101111 */
+    { 1, 0x2, 0x60 }, { 12, 0x3, 0x60 }, { 1, 0x2, 0x7a }, { 12, 0x3, 0x7a },
+    { 1, 0x2, 0x7b }, { 12, 0x3, 0x7b }, { 1, 0x2, 0x7c }, { 12, 0x3, 0x7c },
+    { 1, 0x2, 0x7d }, { 12, 0x3, 0x7d }, { 1, 0x2, 0x7e }, { 12, 0x3, 0x7e },
+    { 1, 0x2, 0x7f }, { 12, 0x3, 0x7f }, { 1, 0x2, 0x80 }, { 12, 0x3, 0x80 },
+    /* state 131: 11011110 */
+    { 2, 0x2, 0x60 }, { 6, 0x2, 0x60 }, { 13, 0x2, 0x60 }, { 37, 0x3, 0x60 },
+    { 2, 0x2, 0x7a }, { 6, 0x2, 0x7a }, { 13, 0x2, 0x7a }, { 37, 0x3, 0x7a },
+    { 2, 0x2, 0x7b }, { 6, 0x2, 0x7b }, { 13, 0x2, 0x7b }, { 37, 0x3, 0x7b },
+    { 2, 0x2, 0x7c }, { 6, 0x2, 0x7c }, { 13, 0x2, 0x7c }, { 37, 0x3, 0x7c },
+    /* state 132: 110111100 */
+    { 0, 0x4, 0x60 }, { 3, 0x2, 0x60 }, { 7, 0x2, 0x60 }, { 10, 0x2, 0x60 },
+    { 14, 0x2, 0x60 }, { 21, 0x2, 0x60 }, { 38, 0x2, 0x60 }, { 137, 0x3, 0x60 },
+    { 0, 0x4, 0x7a }, { 3, 0x2, 0x7a }, { 7, 0x2, 0x7a }, { 10, 0x2, 0x7a },
+    { 14, 0x2, 0x7a }, { 21, 0x2, 0x7a }, { 38, 0x2, 0x7a }, { 137, 0x3, 0x7a },
+    /* state 133: 110111101 */
+    { 0, 0x4, 0x7b }, { 3, 0x2, 0x7b }, { 7, 0x2, 0x7b }, { 10, 0x2, 0x7b },
+    { 14, 0x2, 0x7b }, { 21, 0x2, 0x7b }, { 38, 0x2, 0x7b }, { 137, 0x3, 0x7b },
+    { 0, 0x4, 0x7c }, { 3, 0x2, 0x7c }, { 7, 0x2, 0x7c }, { 10, 0x2, 0x7c },
+    { 14, 0x2, 0x7c }, { 21, 0x2, 0x7c }, { 38, 0x2, 0x7c }, { 137, 0x3, 0x7c },
+    /* state 134: 11011111 */
+    { 2, 0x2, 0x7d }, { 6, 0x2, 0x7d }, { 13, 0x2, 0x7d }, { 37, 0x3, 0x7d },
+    { 2, 0x2, 0x7e }, { 6, 0x2, 0x7e }, { 13, 0x2, 0x7e }, { 37, 0x3, 0x7e },
+    { 2, 0x2, 0x7f }, { 6, 0x2, 0x7f }, { 13, 0x2, 0x7f }, { 37, 0x3, 0x7f },
+    { 2, 0x2, 0x80 }, { 6, 0x2, 0x80 }, { 13, 0x2, 0x80 }, { 37, 0x3, 0x80 },
+    /* state 135: 110111110 */
+    { 0, 0x4, 0x7d }, { 3, 0x2, 0x7d }, { 7, 0x2, 0x7d }, { 10, 0x2, 0x7d },
+    { 14, 0x2, 0x7d }, { 21, 0x2, 0x7d }, { 38, 0x2, 0x7d }, { 137, 0x3, 0x7d },
+    { 0, 0x4, 0x7e }, { 3, 0x2, 0x7e }, { 7, 0x2, 0x7e }, { 10, 0x2, 0x7e },
+    { 14, 0x2, 0x7e }, { 21, 0x2, 0x7e }, { 38, 0x2, 0x7e }, { 137, 0x3, 0x7e },
+    /* state 136: 110111111 */
+    { 0, 0x4, 0x7f }, { 3, 0x2, 0x7f }, { 7, 0x2, 0x7f }, { 10, 0x2, 0x7f },
+    { 14, 0x2, 0x7f }, { 21, 0x2, 0x7f }, { 38, 0x2, 0x7f }, { 137, 0x3, 0x7f },
+    { 0, 0x4, 0x80 }, { 3, 0x2, 0x80 }, { 7, 0x2, 0x80 }, { 10, 0x2, 0x80 },
+    { 14, 0x2, 0x80 }, { 21, 0x2, 0x80 }, { 38, 0x2, 0x80 }, { 137, 0x3, 0x80 },
+    /* state 137: 111 */
+    { 141, 0x0, 0x0 }, { 148, 0x0, 0x0 }, { 156, 0x0, 0x0 }, { 163, 0x0, 0x0 },
+    { 172, 0x0, 0x0 }, { 179, 0x0, 0x0 }, { 187, 0x0, 0x0 }, { 194, 0x0, 0x0 },
+    { 204, 0x0, 0x0 }, { 211, 0x0, 0x0 }, { 219, 0x0, 0x0 }, { 226, 0x0, 0x0 },
+    { 235, 0x0, 0x0 }, { 242, 0x0, 0x0 }, { 250, 0x0, 0x0 }, { 257, 0x1, 0x0 },
+    /* state 138: 1110 */
+    { 142, 0x0, 0x0 }, { 145, 0x0, 0x0 }, { 149, 0x0, 0x0 }, { 152, 0x0, 0x0 },
+    { 157, 0x0, 0x0 }, { 160, 0x0, 0x0 }, { 164, 0x0, 0x0 }, { 167, 0x0, 0x0 },
+    { 173, 0x0, 0x0 }, { 176, 0x0, 0x0 }, { 180, 0x0, 0x0 }, { 183, 0x0, 0x0 },
+    { 188, 0x0, 0x0 }, { 191, 0x0, 0x0 }, { 195, 0x0, 0x0 }, { 198, 0x0, 0x0 },
+    /* state 139: 11100 */
+    { 143, 0x0, 0x0 }, { 144, 0x0, 0x0 }, { 146, 0x0, 0x0 }, { 147, 0x0, 0x0 },
+    { 150, 0x0, 0x0 }, { 151, 0x0, 0x0 }, { 153, 0x0, 0x0 }, { 154, 0x0, 0x0 },
+    { 158, 0x0, 0x0 }, { 159, 0x0, 0x0 }, { 161, 0x0, 0x0 }, { 162, 0x0, 0x0 },
+    { 165, 0x0, 0x0 }, { 166, 0x0, 0x0 }, { 168, 0x0, 0x0 }, { 169, 0x0, 0x0 },
+    /* state 140: 111000 */
+    { 0, 0x3, 0x81 }, { 0, 0x3, 0x82 }, { 0, 0x3, 0x83 }, { 0, 0x3, 0x84 },
+    { 0, 0x3, 0x85 }, { 0, 0x3, 0x86 }, { 0, 0x3, 0x87 }, { 0, 0x3, 0x88 },
+    { 0, 0x3, 0x89 }, { 0, 0x3, 0x8a }, { 0, 0x3, 0x8b }, { 0, 0x3, 0x8c },
+    { 0, 0x3, 0x8d }, { 0, 0x3, 0x8e }, { 0, 0x3, 0x8f }, { 0, 0x3, 0x90 },
+    /* state 141: 1110000 */
+    { 1, 0x2, 0x81 }, { 12, 0x3, 0x81 }, { 1, 0x2, 0x82 }, { 12, 0x3, 0x82 },
+    { 1, 0x2, 0x83 }, { 12, 0x3, 0x83 }, { 1, 0x2, 0x84 }, { 12, 0x3, 0x84 },
+    { 1, 0x2, 0x85 }, { 12, 0x3, 0x85 }, { 1, 0x2, 0x86 }, { 12, 0x3, 0x86 },
+    { 1, 0x2, 0x87 }, { 12, 0x3, 0x87 }, { 1, 0x2, 0x88 }, { 12, 0x3, 0x88 },
+    /* state 142: 11100000 */
+    { 2, 0x2, 0x81 }, { 6, 0x2, 0x81 }, { 13, 0x2, 0x81 }, { 37, 0x3, 0x81 },
+    { 2, 0x2, 0x82 }, { 6, 0x2, 0x82 }, { 13, 0x2, 0x82 }, { 37, 0x3, 0x82 },
+    { 2, 0x2, 0x83 }, { 6, 0x2, 0x83 }, { 13, 0x2, 0x83 }, { 37, 0x3, 0x83 },
+    { 2, 0x2, 0x84 }, { 6, 0x2, 0x84 }, { 13, 0x2, 0x84 }, { 37, 0x3, 0x84 },
+    /* state 143: 111000000 */
+    { 0, 0x4, 0x81 }, { 3, 0x2, 0x81 }, { 7, 0x2, 0x81 }, { 10, 0x2, 0x81 },
+    { 14, 0x2, 0x81 }, { 21, 0x2, 0x81 }, { 38, 0x2, 0x81 }, { 137, 0x3, 0x81 },
+    { 0, 0x4, 0x82 }, { 3, 0x2, 0x82 }, { 7, 0x2, 0x82 }, { 10, 0x2, 0x82 },
+    { 14, 0x2, 0x82 }, { 21, 0x2, 0x82 }, { 38, 0x2, 0x82 }, { 137, 0x3, 0x82 },
+    /* state 144: 111000001 */
+    { 0, 0x4, 0x83 }, { 3, 0x2, 0x83 }, { 7, 0x2, 0x83 }, { 10, 0x2, 0x83 },
+    { 14, 0x2, 0x83 }, { 21, 0x2, 0x83 }, { 38, 0x2, 0x83 }, { 137, 0x3, 0x83 },
+    { 0, 0x4, 0x84 }, { 3, 0x2, 0x84 }, { 7, 0x2, 0x84 }, { 10, 0x2, 0x84 },
+    { 14, 0x2, 0x84 }, { 21, 0x2, 0x84 }, { 38, 0x2, 0x84 }, { 137, 0x3, 0x84 },
+    /* state 145: 11100001 */
+    { 2, 0x2, 0x85 }, { 6, 0x2, 0x85 }, { 13, 0x2, 0x85 }, { 37, 0x3, 0x85 },
+    { 2, 0x2, 0x86 }, { 6, 0x2, 0x86 }, { 13, 0x2, 0x86 }, { 37, 0x3, 0x86 },
+    { 2, 0x2, 0x87 }, { 6, 0x2, 0x87 }, { 13, 0x2, 0x87 }, { 37, 0x3, 0x87 },
+    { 2, 0x2, 0x88 }, { 6, 0x2, 0x88 }, { 13, 0x2, 0x88 }, { 37, 0x3, 0x88 },
+    /* state 146: 111000010 */
+    { 0, 0x4, 0x85 }, { 3, 0x2, 0x85 }, { 7, 0x2, 0x85 }, { 10, 0x2, 0x85 },
+    { 14, 0x2, 0x85 }, { 21, 0x2, 0x85 }, { 38, 0x2, 0x85 }, { 137, 0x3, 0x85 },
+    { 0, 0x4, 0x86 }, { 3, 0x2, 0x86 }, { 7, 0x2, 0x86 }, { 10, 0x2, 0x86 },
+    { 14, 0x2, 0x86 }, { 21, 0x2, 0x86 }, { 38, 0x2, 0x86 }, { 137, 0x3, 0x86 },
+    /* state 147: 111000011 */
+    { 0, 0x4, 0x87 }, { 3, 0x2, 0x87 }, { 7, 0x2, 0x87 }, { 10, 0x2, 0x87 },
+    { 14, 0x2, 0x87 }, { 21, 0x2, 0x87 }, { 38, 0x2, 0x87 }, { 137, 0x3, 0x87 },
+    { 0, 0x4, 0x88 }, { 3, 0x2, 0x88 }, { 7, 0x2, 0x88 }, { 10, 0x2, 0x88 },
+    { 14, 0x2, 0x88 }, { 21, 0x2, 0x88 }, { 38, 0x2, 0x88 }, { 137, 0x3, 0x88 },
+    /* state 148: 1110001 */
+    { 1, 0x2, 0x89 }, { 12, 0x3, 0x89 }, { 1, 0x2, 0x8a }, { 12, 0x3, 0x8a },
+    { 1, 0x2, 0x8b }, { 12, 0x3, 0x8b }, { 1, 0x2, 0x8c }, { 12, 0x3, 0x8c },
+    { 1, 0x2, 0x8d }, { 12, 0x3, 0x8d }, { 1, 0x2, 0x8e }, { 12, 0x3, 0x8e },
+    { 1, 0x2, 0x8f }, { 12, 0x3, 0x8f }, { 1, 0x2, 0x90 }, { 12, 0x3, 0x90 },
+    /* state 149: 11100010 */
+    { 2, 0x2, 0x89 }, { 6, 0x2, 0x89 }, { 13, 0x2, 0x89 }, { 37, 0x3, 0x89 },
+    { 2, 0x2, 0x8a }, { 6, 0x2, 0x8a }, { 13, 0x2, 0x8a }, { 37, 0x3, 0x8a },
+    { 2, 0x2, 0x8b }, { 6, 0x2, 0x8b }, { 13, 0x2, 0x8b }, { 37, 0x3, 0x8b },
+    { 2, 0x2, 0x8c }, { 6, 0x2, 0x8c }, { 13, 0x2, 0x8c }, { 37, 0x3, 0x8c },
+    /* state 150: 111000100 */
+    { 0, 0x4, 0x89 }, { 3, 0x2, 0x89 }, { 7, 0x2, 0x89 }, { 10, 0x2, 0x89 },
+    { 14, 0x2, 0x89 }, { 21, 0x2, 0x89 }, { 38, 0x2, 0x89 }, { 137, 0x3, 0x89 },
+    { 0, 0x4, 0x8a }, { 3, 0x2, 0x8a }, { 7, 0x2, 0x8a }, { 10, 0x2, 0x8a },
+    { 14, 0x2, 0x8a }, { 21, 0x2, 0x8a }, { 38, 0x2, 0x8a }, { 137, 0x3, 0x8a },
+    /* state 151: 111000101 */
+    { 0, 0x4, 0x8b }, { 3, 0x2, 0x8b }, { 7, 0x2, 0x8b }, { 10, 0x2, 0x8b },
+    { 14, 0x2, 0x8b }, { 21, 0x2, 0x8b }, { 38, 0x2, 0x8b }, { 137, 0x3, 0x8b },
+    { 0, 0x4, 0x8c }, { 3, 0x2, 0x8c }, { 7, 0x2, 0x8c }, { 10, 0x2, 0x8c },
+    { 14, 0x2, 0x8c }, { 21, 0x2, 0x8c }, { 38, 0x2, 0x8c }, { 137, 0x3, 0x8c },
+    /* state 152: 11100011 */
+    { 2, 0x2, 0x8d }, { 6, 0x2, 0x8d }, { 13, 0x2, 0x8d }, { 37, 0x3, 0x8d },
+    { 2, 0x2, 0x8e }, { 6, 0x2, 0x8e }, { 13, 0x2, 0x8e }, { 37, 0x3, 0x8e },
+    { 2, 0x2, 0x8f }, { 6, 0x2, 0x8f }, { 13, 0x2, 0x8f }, { 37, 0x3, 0x8f },
+    { 2, 0x2, 0x90 }, { 6, 0x2, 0x90 }, { 13, 0x2, 0x90 }, { 37, 0x3, 0x90 },
+    /* state 153: 111000110 */
+    { 0, 0x4, 0x8d }, { 3, 0x2, 0x8d }, { 7, 0x2, 0x8d }, { 10, 0x2, 0x8d },
+    { 14, 0x2, 0x8d }, { 21, 0x2, 0x8d }, { 38, 0x2, 0x8d }, { 137, 0x3, 0x8d },
+    { 0, 0x4, 0x8e }, { 3, 0x2, 0x8e }, { 7, 0x2, 0x8e }, { 10, 0x2, 0x8e },
+    { 14, 0x2, 0x8e }, { 21, 0x2, 0x8e }, { 38, 0x2, 0x8e }, { 137, 0x3, 0x8e },
+    /* state 154: 111000111 */
+    { 0, 0x4, 0x8f }, { 3, 0x2, 0x8f }, { 7, 0x2, 0x8f }, { 10, 0x2, 0x8f },
+    { 14, 0x2, 0x8f }, { 21, 0x2, 0x8f }, { 38, 0x2, 0x8f }, { 137, 0x3, 0x8f },
+    { 0, 0x4, 0x90 }, { 3, 0x2, 0x90 }, { 7, 0x2, 0x90 }, { 10, 0x2, 0x90 },
+    { 14, 0x2, 0x90 }, { 21, 0x2, 0x90 }, { 38, 0x2, 0x90 }, { 137, 0x3, 0x90 },
+    /* state 155: 111001 */
+    { 0, 0x3, 0x91 }, { 0, 0x3, 0x92 }, { 0, 0x3, 0x93 }, { 0, 0x3, 0x94 },
+    { 0, 0x3, 0x95 }, { 0, 0x3, 0x96 }, { 0, 0x3, 0x97 }, { 0, 0x3, 0x98 },
+    { 0, 0x3, 0x99 }, { 0, 0x3, 0x9a }, { 0, 0x3, 0x9b }, { 0, 0x3, 0x9c },
+    { 0, 0x3, 0x9d }, { 0, 0x3, 0x9e }, { 0, 0x3, 0x9f }, { 0, 0x3, 0xa0 },
+    /* state 156: 1110010 */
+    { 1, 0x2, 0x91 }, { 12, 0x3, 0x91 }, { 1, 0x2, 0x92 }, { 12, 0x3, 0x92 },
+    { 1, 0x2, 0x93 }, { 12, 0x3, 0x93 }, { 1, 0x2, 0x94 }, { 12, 0x3, 0x94 },
+    { 1, 0x2, 0x95 }, { 12, 0x3, 0x95 }, { 1, 0x2, 0x96 }, { 12, 0x3, 0x96 },
+    { 1, 0x2, 0x97 }, { 12, 0x3, 0x97 }, { 1, 0x2, 0x98 }, { 12, 0x3, 0x98 },
+    /* state 157: 11100100 */
+    { 2, 0x2, 0x91 }, { 6, 0x2, 0x91 }, { 13, 0x2, 0x91 }, { 37, 0x3, 0x91 },
+    { 2, 0x2, 0x92 }, { 6, 0x2, 0x92 }, { 13, 0x2, 0x92 }, { 37, 0x3, 0x92 },
+    { 2, 0x2, 0x93 }, { 6, 0x2, 0x93 }, { 13, 0x2, 0x93 }, { 37, 0x3, 0x93 },
+    { 2, 0x2, 0x94 }, { 6, 0x2, 0x94 }, { 13, 0x2, 0x94 }, { 37, 0x3, 0x94 },
+    /* state 158: 111001000 */
+    { 0, 0x4, 0x91 }, { 3, 0x2, 0x91 }, { 7, 0x2, 0x91 }, { 10, 0x2, 0x91 },
+    { 14, 0x2, 0x91 }, { 21, 0x2, 0x91 }, { 38, 0x2, 0x91 }, { 137, 0x3, 0x91 },
+    { 0, 0x4, 0x92 }, { 3, 0x2, 0x92 }, { 7, 0x2, 0x92 }, { 10, 0x2, 0x92 },
+    { 14, 0x2, 0x92 }, { 21, 0x2, 0x92 }, { 38, 0x2, 0x92 }, { 137, 0x3, 0x92 },
+    /* state 159: 111001001 */
+    { 0, 0x4, 0x93 }, { 3, 0x2, 0x93 }, { 7, 0x2, 0x93 }, { 10, 0x2, 0x93 },
+    { 14, 0x2, 0x93 }, { 21, 0x2, 0x93 }, { 38, 0x2, 0x93 }, { 137, 0x3, 0x93 },
+    { 0, 0x4, 0x94 }, { 3, 0x2, 0x94 }, { 7, 0x2, 0x94 }, { 10, 0x2, 0x94 },
+    { 14, 0x2, 0x94 }, { 21, 0x2, 0x94 }, { 38, 0x2, 0x94 }, { 137, 0x3, 0x94 },
+    /* state 160: 11100101 */
+    { 2, 0x2, 0x95 }, { 6, 0x2, 0x95 }, { 13, 0x2, 0x95 }, { 37, 0x3, 0x95 },
+    { 2, 0x2, 0x96 }, { 6, 0x2, 0x96 }, { 13, 0x2, 0x96 }, { 37, 0x3, 0x96 },
+    { 2, 0x2, 0x97 }, { 6, 0x2, 0x97 }, { 13, 0x2, 0x97 }, { 37, 0x3, 0x97 },
+    { 2, 0x2, 0x98 }, { 6, 0x2, 0x98 }, { 13, 0x2, 0x98 }, { 37, 0x3, 0x98 },
+    /* state 161: 111001010 */
+    { 0, 0x4, 0x95 }, { 3, 0x2, 0x95 }, { 7, 0x2, 0x95 }, { 10, 0x2, 0x95 },
+    { 14, 0x2, 0x95 }, { 21, 0x2, 0x95 }, { 38, 0x2, 0x95 }, { 137, 0x3, 0x95 },
+    { 0, 0x4, 0x96 }, { 3, 0x2, 0x96 }, { 7, 0x2, 0x96 }, { 10, 0x2, 0x96 },
+    { 14, 0x2, 0x96 }, { 21, 0x2, 0x96 }, { 38, 0x2, 0x96 }, { 137, 0x3, 0x96 },
+    /* state 162: 111001011 */
+    { 0, 0x4, 0x97 }, { 3, 0x2, 0x97 }, { 7, 0x2, 0x97 }, { 10, 0x2, 0x97 },
+    { 14, 0x2, 0x97 }, { 21, 0x2, 0x97 }, { 38, 0x2, 0x97 }, { 137, 0x3, 0x97 },
+    { 0, 0x4, 0x98 }, { 3, 0x2, 0x98 }, { 7, 0x2, 0x98 }, { 10, 0x2, 0x98 },
+    { 14, 0x2, 0x98 }, { 21, 0x2, 0x98 }, { 38, 0x2, 0x98 }, { 137, 0x3, 0x98 },
+    /* state 163: 1110011 */
+    { 1, 0x2, 0x99 }, { 12, 0x3, 0x99 }, { 1, 0x2, 0x9a }, { 12, 0x3, 0x9a },
+    { 1, 0x2, 0x9b }, { 12, 0x3, 0x9b }, { 1, 0x2, 0x9c }, { 12, 0x3, 0x9c },
+    { 1, 0x2, 0x9d }, { 12, 0x3, 0x9d }, { 1, 0x2, 0x9e }, { 12, 0x3, 0x9e },
+    { 1, 0x2, 0x9f }, { 12, 0x3, 0x9f }, { 1, 0x2, 0xa0 }, { 12, 0x3, 0xa0 },
+    /* state 164: 11100110 */
+    { 2, 0x2, 0x99 }, { 6, 0x2, 0x99 }, { 13, 0x2, 0x99 }, { 37, 0x3, 0x99 },
+    { 2, 0x2, 0x9a }, { 6, 0x2, 0x9a }, { 13, 0x2, 0x9a }, { 37, 0x3, 0x9a },
+    { 2, 0x2, 0x9b }, { 6, 0x2, 0x9b }, { 13, 0x2, 0x9b }, { 37, 0x3, 0x9b },
+    { 2, 0x2, 0x9c }, { 6, 0x2, 0x9c }, { 13, 0x2, 0x9c }, { 37, 0x3, 0x9c },
+    /* state 165: 111001100 */
+    { 0, 0x4, 0x99 }, { 3, 0x2, 0x99 }, { 7, 0x2, 0x99 }, { 10, 0x2, 0x99 },
+    { 14, 0x2, 0x99 }, { 21, 0x2, 0x99 }, { 38, 0x2, 0x99 }, { 137, 0x3, 0x99 },
+    { 0, 0x4, 0x9a }, { 3, 0x2, 0x9a }, { 7, 0x2, 0x9a }, { 10, 0x2, 0x9a },
+    { 14, 0x2, 0x9a }, { 21, 0x2, 0x9a }, { 38, 0x2, 0x9a }, { 137, 0x3, 0x9a },
+    /* state 166: 111001101 */
+    { 0, 0x4, 0x9b }, { 3, 0x2, 0x9b }, { 7, 0x2, 0x9b }, { 10, 0x2, 0x9b },
+    { 14, 0x2, 0x9b }, { 21, 0x2, 0x9b }, { 38, 0x2, 0x9b }, { 137, 0x3, 0x9b },
+    { 0, 0x4, 0x9c }, { 3, 0x2, 0x9c }, { 7, 0x2, 0x9c }, { 10, 0x2, 0x9c },
+    { 14, 0x2, 0x9c }, { 21, 0x2, 0x9c }, { 38, 0x2, 0x9c }, { 137, 0x3, 0x9c },
+    /* state 167: 11100111 */
+    { 2, 0x2, 0x9d }, { 6, 0x2, 0x9d }, { 13, 0x2, 0x9d }, { 37, 0x3, 0x9d },
+    { 2, 0x2, 0x9e }, { 6, 0x2, 0x9e }, { 13, 0x2, 0x9e }, { 37, 0x3, 0x9e },
+    { 2, 0x2, 0x9f }, { 6, 0x2, 0x9f }, { 13, 0x2, 0x9f }, { 37, 0x3, 0x9f },
+    { 2, 0x2, 0xa0 }, { 6, 0x2, 0xa0 }, { 13, 0x2, 0xa0 }, { 37, 0x3, 0xa0 },
+    /* state 168: 111001110 */
+    { 0, 0x4, 0x9d }, { 3, 0x2, 0x9d }, { 7, 0x2, 0x9d }, { 10, 0x2, 0x9d },
+    { 14, 0x2, 0x9d }, { 21, 0x2, 0x9d }, { 38, 0x2, 0x9d }, { 137, 0x3, 0x9d },
+    { 0, 0x4, 0x9e }, { 3, 0x2, 0x9e }, { 7, 0x2, 0x9e }, { 10, 0x2, 0x9e },
+    { 14, 0x2, 0x9e }, { 21, 0x2, 0x9e }, { 38, 0x2, 0x9e }, { 137, 0x3, 0x9e },
+    /* state 169: 111001111 */
+    { 0, 0x4, 0x9f }, { 3, 0x2, 0x9f }, { 7, 0x2, 0x9f }, { 10, 0x2, 0x9f },
+    { 14, 0x2, 0x9f }, { 21, 0x2, 0x9f }, { 38, 0x2, 0x9f }, { 137, 0x3, 0x9f },
+    { 0, 0x4, 0xa0 }, { 3, 0x2, 0xa0 }, { 7, 0x2, 0xa0 }, { 10, 0x2, 0xa0 },
+    { 14, 0x2, 0xa0 }, { 21, 0x2, 0xa0 }, { 38, 0x2, 0xa0 }, { 137, 0x3, 0xa0 },
+    /* state 170: 11101 */
+    { 174, 0x0, 0x0 }, { 175, 0x0, 0x0 }, { 177, 0x0, 0x0 }, { 178, 0x0, 0x0 },
+    { 181, 0x0, 0x0 }, { 182, 0x0, 0x0 }, { 184, 0x0, 0x0 }, { 185, 0x0, 0x0 },
+    { 189, 0x0, 0x0 }, { 190, 0x0, 0x0 }, { 192, 0x0, 0x0 }, { 193, 0x0, 0x0 },
+    { 196, 0x0, 0x0 }, { 197, 0x0, 0x0 }, { 199, 0x0, 0x0 }, { 200, 0x0, 0x0 },
+    /* state 171: 111010 */
+    { 0, 0x3, 0xa1 }, { 0, 0x3, 0xa2 }, { 0, 0x3, 0xa3 }, { 0, 0x3, 0xa4 },
+    { 0, 0x3, 0xa5 }, { 0, 0x3, 0xa6 }, { 0, 0x3, 0xa7 }, { 0, 0x3, 0xa8 },
+    { 0, 0x3, 0xa9 }, { 0, 0x3, 0xaa }, { 0, 0x3, 0xab }, { 0, 0x3, 0xac },
+    { 0, 0x3, 0xad }, { 0, 0x3, 0xae }, { 0, 0x3, 0xaf }, { 0, 0x3, 0xb0 },
+    /* state 172: 1110100 */
+    { 1, 0x2, 0xa1 }, { 12, 0x3, 0xa1 }, { 1, 0x2, 0xa2 }, { 12, 0x3, 0xa2 },
+    { 1, 0x2, 0xa3 }, { 12, 0x3, 0xa3 }, { 1, 0x2, 0xa4 }, { 12, 0x3, 0xa4 },
+    { 1, 0x2, 0xa5 }, { 12, 0x3, 0xa5 }, { 1, 0x2, 0xa6 }, { 12, 0x3, 0xa6 },
+    { 1, 0x2, 0xa7 }, { 12, 0x3, 0xa7 }, { 1, 0x2, 0xa8 }, { 12, 0x3, 0xa8 },
+    /* state 173: 11101000 */
+    { 2, 0x2, 0xa1 }, { 6, 0x2, 0xa1 }, { 13, 0x2, 0xa1 }, { 37, 0x3, 0xa1 },
+    { 2, 0x2, 0xa2 }, { 6, 0x2, 0xa2 }, { 13, 0x2, 0xa2 }, { 37, 0x3, 0xa2 },
+    { 2, 0x2, 0xa3 }, { 6, 0x2, 0xa3 }, { 13, 0x2, 0xa3 }, { 37, 0x3, 0xa3 },
+    { 2, 0x2, 0xa4 }, { 6, 0x2, 0xa4 }, { 13, 0x2, 0xa4 }, { 37, 0x3, 0xa4 },
+    /* state 174: 111010000 */
+    { 0, 0x4, 0xa1 }, { 3, 0x2, 0xa1 }, { 7, 0x2, 0xa1 }, { 10, 0x2, 0xa1 },
+    { 14, 0x2, 0xa1 }, { 21, 0x2, 0xa1 }, { 38, 0x2, 0xa1 }, { 137, 0x3, 0xa1 },
+    { 0, 0x4, 0xa2 }, { 3, 0x2, 0xa2 }, { 7, 0x2, 0xa2 }, { 10, 0x2, 0xa2 },
+    { 14, 0x2, 0xa2 }, { 21, 0x2, 0xa2 }, { 38, 0x2, 0xa2 }, { 137, 0x3, 0xa2 },
+    /* state 175: 111010001 */
+    { 0, 0x4, 0xa3 }, { 3, 0x2, 0xa3 }, { 7, 0x2, 0xa3 }, { 10, 0x2, 0xa3 },
+    { 14, 0x2, 0xa3 }, { 21, 0x2, 0xa3 }, { 38, 0x2, 0xa3 }, { 137, 0x3, 0xa3 },
+    { 0, 0x4, 0xa4 }, { 3, 0x2, 0xa4 }, { 7, 0x2, 0xa4 }, { 10, 0x2, 0xa4 },
+    { 14, 0x2, 0xa4 }, { 21, 0x2, 0xa4 }, { 38, 0x2, 0xa4 }, { 137, 0x3, 0xa4 },
+    /* state 176: 11101001 */
+    { 2, 0x2, 0xa5 }, { 6, 0x2, 0xa5 }, { 13, 0x2, 0xa5 }, { 37, 0x3, 0xa5 },
+    { 2, 0x2, 0xa6 }, { 6, 0x2, 0xa6 }, { 13, 0x2, 0xa6 }, { 37, 0x3, 0xa6 },
+    { 2, 0x2, 0xa7 }, { 6, 0x2, 0xa7 }, { 13, 0x2, 0xa7 }, { 37, 0x3, 0xa7 },
+    { 2, 0x2, 0xa8 }, { 6, 0x2, 0xa8 }, { 13, 0x2, 0xa8 }, { 37, 0x3, 0xa8 },
+    /* state 177: 111010010 */
+    { 0, 0x4, 0xa5 }, { 3, 0x2, 0xa5 }, { 7, 0x2, 0xa5 }, { 10, 0x2, 0xa5 },
+    { 14, 0x2, 0xa5 }, { 21, 0x2, 0xa5 }, { 38, 0x2, 0xa5 }, { 137, 0x3, 0xa5 },
+    { 0, 0x4, 0xa6 }, { 3, 0x2, 0xa6 }, { 7, 0x2, 0xa6 }, { 10, 0x2, 0xa6 },
+    { 14, 0x2, 0xa6 }, { 21, 0x2, 0xa6 }, { 38, 0x2, 0xa6 }, { 137, 0x3, 0xa6 },
+    /* state 178: 111010011 */
+    { 0, 0x4, 0xa7 }, { 3, 0x2, 0xa7 }, { 7, 0x2, 0xa7 }, { 10, 0x2, 0xa7 },
+    { 14, 0x2, 0xa7 }, { 21, 0x2, 0xa7 }, { 38, 0x2, 0xa7 }, { 137, 0x3, 0xa7 },
+    { 0, 0x4, 0xa8 }, { 3, 0x2, 0xa8 }, { 7, 0x2, 0xa8 }, { 10, 0x2, 0xa8 },
+    { 14, 0x2, 0xa8 }, { 21, 0x2, 0xa8 }, { 38, 0x2, 0xa8 }, { 137, 0x3, 0xa8 },
+    /* state 179: 1110101 */
+    { 1, 0x2, 0xa9 }, { 12, 0x3, 0xa9 }, { 1, 0x2, 0xaa }, { 12, 0x3, 0xaa },
+    { 1, 0x2, 0xab }, { 12, 0x3, 0xab }, { 1, 0x2, 0xac }, { 12, 0x3, 0xac },
+    { 1, 0x2, 0xad }, { 12, 0x3, 0xad }, { 1, 0x2, 0xae }, { 12, 0x3, 0xae },
+    { 1, 0x2, 0xaf }, { 12, 0x3, 0xaf }, { 1, 0x2, 0xb0 }, { 12, 0x3, 0xb0 },
+    /* state 180: 11101010 */
+    { 2, 0x2, 0xa9 }, { 6, 0x2, 0xa9 }, { 13, 0x2, 0xa9 }, { 37, 0x3, 0xa9 },
+    { 2, 0x2, 0xaa }, { 6, 0x2, 0xaa }, { 13, 0x2, 0xaa }, { 37, 0x3, 0xaa },
+    { 2, 0x2, 0xab }, { 6, 0x2, 0xab }, { 13, 0x2, 0xab }, { 37, 0x3, 0xab },
+    { 2, 0x2, 0xac }, { 6, 0x2, 0xac }, { 13, 0x2, 0xac }, { 37, 0x3, 0xac },
+    /* state 181: 111010100 */
+    { 0, 0x4, 0xa9 }, { 3, 0x2, 0xa9 }, { 7, 0x2, 0xa9 }, { 10, 0x2, 0xa9 },
+    { 14, 0x2, 0xa9 }, { 21, 0x2, 0xa9 }, { 38, 0x2, 0xa9 }, { 137, 0x3, 0xa9 },
+    { 0, 0x4, 0xaa }, { 3, 0x2, 0xaa }, { 7, 0x2, 0xaa }, { 10, 0x2, 0xaa },
+    { 14, 0x2, 0xaa }, { 21, 0x2, 0xaa }, { 38, 0x2, 0xaa }, { 137, 0x3, 0xaa },
+    /* state 182: 111010101 */
+    { 0, 0x4, 0xab }, { 3, 0x2, 0xab }, { 7, 0x2, 0xab }, { 10, 0x2, 0xab },
+    { 14, 0x2, 0xab }, { 21, 0x2, 0xab }, { 38, 0x2, 0xab }, { 137, 0x3, 0xab },
+    { 0, 0x4, 0xac }, { 3, 0x2, 0xac }, { 7, 0x2, 0xac }, { 10, 0x2, 0xac },
+    { 14, 0x2, 0xac }, { 21, 0x2, 0xac }, { 38, 0x2, 0xac }, { 137, 0x3, 0xac },
+    /* state 183: 11101011 */
+    { 2, 0x2, 0xad }, { 6, 0x2, 0xad }, { 13, 0x2, 0xad }, { 37, 0x3, 0xad },
+    { 2, 0x2, 0xae }, { 6, 0x2, 0xae }, { 13, 0x2, 0xae }, { 37, 0x3, 0xae },
+    { 2, 0x2, 0xaf }, { 6, 0x2, 0xaf }, { 13, 0x2, 0xaf }, { 37, 0x3, 0xaf },
+    { 2, 0x2, 0xb0 }, { 6, 0x2, 0xb0 }, { 13, 0x2, 0xb0 }, { 37, 0x3, 0xb0 },
+    /* state 184: 111010110 */
+    { 0, 0x4, 0xad }, { 3, 0x2, 0xad }, { 7, 0x2, 0xad }, { 10, 0x2, 0xad },
+    { 14, 0x2, 0xad }, { 21, 0x2, 0xad }, { 38, 0x2, 0xad }, { 137, 0x3, 0xad },
+    { 0, 0x4, 0xae }, { 3, 0x2, 0xae }, { 7, 0x2, 0xae }, { 10, 0x2, 0xae },
+    { 14, 0x2, 0xae }, { 21, 0x2, 0xae }, { 38, 0x2, 0xae }, { 137, 0x3, 0xae },
+    /* state 185: 111010111 */
+    { 0, 0x4, 0xaf }, { 3, 0x2, 0xaf }, { 7, 0x2, 0xaf }, { 10, 0x2, 0xaf },
+    { 14, 0x2, 0xaf }, { 21, 0x2, 0xaf }, { 38, 0x2, 0xaf }, { 137, 0x3, 0xaf },
+    { 0, 0x4, 0xb0 }, { 3, 0x2, 0xb0 }, { 7, 0x2, 0xb0 }, { 10, 0x2, 0xb0 },
+    { 14, 0x2, 0xb0 }, { 21, 0x2, 0xb0 }, { 38, 0x2, 0xb0 }, { 137, 0x3, 0xb0 },
+    /* state 186: 111011 */
+    { 0, 0x3, 0xb1 }, { 0, 0x3, 0xb2 }, { 0, 0x3, 0xb3 }, { 0, 0x3, 0xb4 },
+    { 0, 0x3, 0xb5 }, { 0, 0x3, 0xb6 }, { 0, 0x3, 0xb7 }, { 0, 0x3, 0xb8 },
+    { 0, 0x3, 0xb9 }, { 0, 0x3, 0xba }, { 0, 0x3, 0xbb }, { 0, 0x3, 0xbc },
+    { 0, 0x3, 0xbd }, { 0, 0x3, 0xbe }, { 0, 0x3, 0xbf }, { 0, 0x3, 0xc0 },
+    /* state 187: 1110110 */
+    { 1, 0x2, 0xb1 }, { 12, 0x3, 0xb1 }, { 1, 0x2, 0xb2 }, { 12, 0x3, 0xb2 },
+    { 1, 0x2, 0xb3 }, { 12, 0x3, 0xb3 }, { 1, 0x2, 0xb4 }, { 12, 0x3, 0xb4 },
+    { 1, 0x2, 0xb5 }, { 12, 0x3, 0xb5 }, { 1, 0x2, 0xb6 }, { 12, 0x3, 0xb6 },
+    { 1, 0x2, 0xb7 }, { 12, 0x3, 0xb7 }, { 1, 0x2, 0xb8 }, { 12, 0x3, 0xb8 },
+    /* state 188: 11101100 */
+    { 2, 0x2, 0xb1 }, { 6, 0x2, 0xb1 }, { 13, 0x2, 0xb1 }, { 37, 0x3, 0xb1 },
+    { 2, 0x2, 0xb2 }, { 6, 0x2, 0xb2 }, { 13, 0x2, 0xb2 }, { 37, 0x3, 0xb2 },
+    { 2, 0x2, 0xb3 }, { 6, 0x2, 0xb3 }, { 13, 0x2, 0xb3 }, { 37, 0x3, 0xb3 },
+    { 2, 0x2, 0xb4 }, { 6, 0x2, 0xb4 }, { 13, 0x2, 0xb4 }, { 37, 0x3, 0xb4 },
+    /* state 189: 111011000 */
+    { 0, 0x4, 0xb1 }, { 3, 0x2, 0xb1 }, { 7, 0x2, 0xb1 }, { 10, 0x2, 0xb1 },
+    { 14, 0x2, 0xb1 }, { 21, 0x2, 0xb1 }, { 38, 0x2, 0xb1 }, { 137, 0x3, 0xb1 },
+    { 0, 0x4, 0xb2 }, { 3, 0x2, 0xb2 }, { 7, 0x2, 0xb2 }, { 10, 0x2, 0xb2 },
+    { 14, 0x2, 0xb2 }, { 21, 0x2, 0xb2 }, { 38, 0x2, 0xb2 }, { 137, 0x3, 0xb2 },
+    /* state 190: 111011001 */
+    { 0, 0x4, 0xb3 }, { 3, 0x2, 0xb3 }, { 7, 0x2, 0xb3 }, { 10, 0x2, 0xb3 },
+    { 14, 0x2, 0xb3 }, { 21, 0x2, 0xb3 }, { 38, 0x2, 0xb3 }, { 137, 0x3, 0xb3 },
+    { 0, 0x4, 0xb4 }, { 3, 0x2, 0xb4 }, { 7, 0x2, 0xb4 }, { 10, 0x2, 0xb4 },
+    { 14, 0x2, 0xb4 }, { 21, 0x2, 0xb4 }, { 38, 0x2, 0xb4 }, { 137, 0x3, 0xb4 },
+    /* state 191: 11101101 */
+    { 2, 0x2, 0xb5 }, { 6, 0x2, 0xb5 }, { 13, 0x2, 0xb5 }, { 37, 0x3, 0xb5 },
+    { 2, 0x2, 0xb6 }, { 6, 0x2, 0xb6 }, { 13, 0x2, 0xb6 }, { 37, 0x3, 0xb6 },
+    { 2, 0x2, 0xb7 }, { 6, 0x2, 0xb7 }, { 13, 0x2, 0xb7 }, { 37, 0x3, 0xb7 },
+    { 2, 0x2, 0xb8 }, { 6, 0x2, 0xb8 }, { 13, 0x2, 0xb8 }, { 37, 0x3, 0xb8 },
+    /* state 192: 111011010 */
+    { 0, 0x4, 0xb5 }, { 3, 0x2, 0xb5 }, { 7, 0x2, 0xb5 }, { 10, 0x2, 0xb5 },
+    { 14, 0x2, 0xb5 }, { 21, 0x2, 0xb5 }, { 38, 0x2, 0xb5 }, { 137, 0x3, 0xb5 },
+    { 0, 0x4, 0xb6 }, { 3, 0x2, 0xb6 }, { 7, 0x2, 0xb6 }, { 10, 0x2, 0xb6 },
+    { 14, 0x2, 0xb6 }, { 21, 0x2, 0xb6 }, { 38, 0x2, 0xb6 }, { 137, 0x3, 0xb6 },
+    /* state 193: 111011011 */
+    { 0, 0x4, 0xb7 }, { 3, 0x2, 0xb7 }, { 7, 0x2, 0xb7 }, { 10, 0x2, 0xb7 },
+    { 14, 0x2, 0xb7 }, { 21, 0x2, 0xb7 }, { 38, 0x2, 0xb7 }, { 137, 0x3, 0xb7 },
+    { 0, 0x4, 0xb8 }, { 3, 0x2, 0xb8 }, { 7, 0x2, 0xb8 }, { 10, 0x2, 0xb8 },
+    { 14, 0x2, 0xb8 }, { 21, 0x2, 0xb8 }, { 38, 0x2, 0xb8 }, { 137, 0x3, 0xb8 },
+    /* state 194: 1110111 */
+    { 1, 0x2, 0xb9 }, { 12, 0x3, 0xb9 }, { 1, 0x2, 0xba }, { 12, 0x3, 0xba },
+    { 1, 0x2, 0xbb }, { 12, 0x3, 0xbb }, { 1, 0x2, 0xbc }, { 12, 0x3, 0xbc },
+    { 1, 0x2, 0xbd }, { 12, 0x3, 0xbd }, { 1, 0x2, 0xbe }, { 12, 0x3, 0xbe },
+    { 1, 0x2, 0xbf }, { 12, 0x3, 0xbf }, { 1, 0x2, 0xc0 }, { 12, 0x3, 0xc0 },
+    /* state 195: 11101110 */
+    { 2, 0x2, 0xb9 }, { 6, 0x2, 0xb9 }, { 13, 0x2, 0xb9 }, { 37, 0x3, 0xb9 },
+    { 2, 0x2, 0xba }, { 6, 0x2, 0xba }, { 13, 0x2, 0xba }, { 37, 0x3, 0xba },
+    { 2, 0x2, 0xbb }, { 6, 0x2, 0xbb }, { 13, 0x2, 0xbb }, { 37, 0x3, 0xbb },
+    { 2, 0x2, 0xbc }, { 6, 0x2, 0xbc }, { 13, 0x2, 0xbc }, { 37, 0x3, 0xbc },
+    /* state 196: 111011100 */
+    { 0, 0x4, 0xb9 }, { 3, 0x2, 0xb9 }, { 7, 0x2, 0xb9 }, { 10, 0x2, 0xb9 },
+    { 14, 0x2, 0xb9 }, { 21, 0x2, 0xb9 }, { 38, 0x2, 0xb9 }, { 137, 0x3, 0xb9 },
+    { 0, 0x4, 0xba }, { 3, 0x2, 0xba }, { 7, 0x2, 0xba }, { 10, 0x2, 0xba },
+    { 14, 0x2, 0xba }, { 21, 0x2, 0xba }, { 38, 0x2, 0xba }, { 137, 0x3, 0xba },
+    /* state 197: 111011101 */
+    { 0, 0x4, 0xbb }, { 3, 0x2, 0xbb }, { 7, 0x2, 0xbb }, { 10, 0x2, 0xbb },
+    { 14, 0x2, 0xbb }, { 21, 0x2, 0xbb }, { 38, 0x2, 0xbb }, { 137, 0x3, 0xbb },
+    { 0, 0x4, 0xbc }, { 3, 0x2, 0xbc }, { 7, 0x2, 0xbc }, { 10, 0x2, 0xbc },
+    { 14, 0x2, 0xbc }, { 21, 0x2, 0xbc }, { 38, 0x2, 0xbc }, { 137, 0x3, 0xbc },
+    /* state 198: 11101111 */
+    { 2, 0x2, 0xbd }, { 6, 0x2, 0xbd }, { 13, 0x2, 0xbd }, { 37, 0x3, 0xbd },
+    { 2, 0x2, 0xbe }, { 6, 0x2, 0xbe }, { 13, 0x2, 0xbe }, { 37, 0x3, 0xbe },
+    { 2, 0x2, 0xbf }, { 6, 0x2, 0xbf }, { 13, 0x2, 0xbf }, { 37, 0x3, 0xbf },
+    { 2, 0x2, 0xc0 }, { 6, 0x2, 0xc0 }, { 13, 0x2, 0xc0 }, { 37, 0x3, 0xc0 },
+    /* state 199: 111011110 */
+    { 0, 0x4, 0xbd }, { 3, 0x2, 0xbd }, { 7, 0x2, 0xbd }, { 10, 0x2, 0xbd },
+    { 14, 0x2, 0xbd }, { 21, 0x2, 0xbd }, { 38, 0x2, 0xbd }, { 137, 0x3, 0xbd },
+    { 0, 0x4, 0xbe }, { 3, 0x2, 0xbe }, { 7, 0x2, 0xbe }, { 10, 0x2, 0xbe },
+    { 14, 0x2, 0xbe }, { 21, 0x2, 0xbe }, { 38, 0x2, 0xbe }, { 137, 0x3, 0xbe },
+    /* state 200: 111011111 */
+    { 0, 0x4, 0xbf }, { 3, 0x2, 0xbf }, { 7, 0x2, 0xbf }, { 10, 0x2, 0xbf },
+    { 14, 0x2, 0xbf }, { 21, 0x2, 0xbf }, { 38, 0x2, 0xbf }, { 137, 0x3, 0xbf },
+    { 0, 0x4, 0xc0 }, { 3, 0x2, 0xc0 }, { 7, 0x2, 0xc0 }, { 10, 0x2, 0xc0 },
+    { 14, 0x2, 0xc0 }, { 21, 0x2, 0xc0 }, { 38, 0x2, 0xc0 }, { 137, 0x3, 0xc0 },
+    /* state 201: 1111 */
+    { 205, 0x0, 0x0 }, { 208, 0x0, 0x0 }, { 212, 0x0, 0x0 }, { 215, 0x0, 0x0 },
+    { 220, 0x0, 0x0 }, { 223, 0x0, 0x0 }, { 227, 0x0, 0x0 }, { 230, 0x0, 0x0 },
+    { 236, 0x0, 0x0 }, { 239, 0x0, 0x0 }, { 243, 0x0, 0x0 }, { 246, 0x0, 0x0 },
+    { 251, 0x0, 0x0 }, { 254, 0x0, 0x0 }, { 258, 0x0, 0x0 }, { 261, 0x0, 0x0 },
+    /* state 202: 11110 */
+    { 206, 0x0, 0x0 }, { 207, 0x0, 0x0 }, { 209, 0x0, 0x0 }, { 210, 0x0, 0x0 },
+    { 213, 0x0, 0x0 }, { 214, 0x0, 0x0 }, { 216, 0x0, 0x0 }, { 217, 0x0, 0x0 },
+    { 221, 0x0, 0x0 }, { 222, 0x0, 0x0 }, { 224, 0x0, 0x0 }, { 225, 0x0, 0x0 },
+    { 228, 0x0, 0x0 }, { 229, 0x0, 0x0 }, { 231, 0x0, 0x0 }, { 232, 0x0, 0x0 },
+    /* state 203: 111100 */
+    { 0, 0x3, 0xc1 }, { 0, 0x3, 0xc2 }, { 0, 0x3, 0xc3 }, { 0, 0x3, 0xc4 },
+    { 0, 0x3, 0xc5 }, { 0, 0x3, 0xc6 }, { 0, 0x3, 0xc7 }, { 0, 0x3, 0xc8 },
+    { 0, 0x3, 0xc9 }, { 0, 0x3, 0xca }, { 0, 0x3, 0xcb }, { 0, 0x3, 0xcc },
+    { 0, 0x3, 0xcd }, { 0, 0x3, 0xce }, { 0, 0x3, 0xcf }, { 0, 0x3, 0xd0 },
+    /* state 204: 1111000 */
+    { 1, 0x2, 0xc1 }, { 12, 0x3, 0xc1 }, { 1, 0x2, 0xc2 }, { 12, 0x3, 0xc2 },
+    { 1, 0x2, 0xc3 }, { 12, 0x3, 0xc3 }, { 1, 0x2, 0xc4 }, { 12, 0x3, 0xc4 },
+    { 1, 0x2, 0xc5 }, { 12, 0x3, 0xc5 }, { 1, 0x2, 0xc6 }, { 12, 0x3, 0xc6 },
+    { 1, 0x2, 0xc7 }, { 12, 0x3, 0xc7 }, { 1, 0x2, 0xc8 }, { 12, 0x3, 0xc8 },
+    /* state 205: 11110000 */
+    { 2, 0x2, 0xc1 }, { 6, 0x2, 0xc1 }, { 13, 0x2, 0xc1 }, { 37, 0x3, 0xc1 },
+    { 2, 0x2, 0xc2 }, { 6, 0x2, 0xc2 }, { 13, 0x2, 0xc2 }, { 37, 0x3, 0xc2 },
+    { 2, 0x2, 0xc3 }, { 6, 0x2, 0xc3 }, { 13, 0x2, 0xc3 }, { 37, 0x3, 0xc3 },
+    { 2, 0x2, 0xc4 }, { 6, 0x2, 0xc4 }, { 13, 0x2, 0xc4 }, { 37, 0x3, 0xc4 },
+    /* state 206: 111100000 */
+    { 0, 0x4, 0xc1 }, { 3, 0x2, 0xc1 }, { 7, 0x2, 0xc1 }, { 10, 0x2, 0xc1 },
+    { 14, 0x2, 0xc1 }, { 21, 0x2, 0xc1 }, { 38, 0x2, 0xc1 }, { 137, 0x3, 0xc1 },
+    { 0, 0x4, 0xc2 }, { 3, 0x2, 0xc2 }, { 7, 0x2, 0xc2 }, { 10, 0x2, 0xc2 },
+    { 14, 0x2, 0xc2 }, { 21, 0x2, 0xc2 }, { 38, 0x2, 0xc2 }, { 137, 0x3, 0xc2 },
+    /* state 207: 111100001 */
+    { 0, 0x4, 0xc3 }, { 3, 0x2, 0xc3 }, { 7, 0x2, 0xc3 }, { 10, 0x2, 0xc3 },
+    { 14, 0x2, 0xc3 }, { 21, 0x2, 0xc3 }, { 38, 0x2, 0xc3 }, { 137, 0x3, 0xc3 },
+    { 0, 0x4, 0xc4 }, { 3, 0x2, 0xc4 }, { 7, 0x2, 0xc4 }, { 10, 0x2, 0xc4 },
+    { 14, 0x2, 0xc4 }, { 21, 0x2, 0xc4 }, { 38, 0x2, 0xc4 }, { 137, 0x3, 0xc4 },
+    /* state 208: 11110001 */
+    { 2, 0x2, 0xc5 }, { 6, 0x2, 0xc5 }, { 13, 0x2, 0xc5 }, { 37, 0x3, 0xc5 },
+    { 2, 0x2, 0xc6 }, { 6, 0x2, 0xc6 }, { 13, 0x2, 0xc6 }, { 37, 0x3, 0xc6 },
+    { 2, 0x2, 0xc7 }, { 6, 0x2, 0xc7 }, { 13, 0x2, 0xc7 }, { 37, 0x3, 0xc7 },
+    { 2, 0x2, 0xc8 }, { 6, 0x2, 0xc8 }, { 13, 0x2, 0xc8 }, { 37, 0x3, 0xc8 },
+    /* state 209: 111100010 */
+    { 0, 0x4, 0xc5 }, { 3, 0x2, 0xc5 }, { 7, 0x2, 0xc5 }, { 10, 0x2, 0xc5 },
+    { 14, 0x2, 0xc5 }, { 21, 0x2, 0xc5 }, { 38, 0x2, 0xc5 }, { 137, 0x3, 0xc5 },
+    { 0, 0x4, 0xc6 }, { 3, 0x2, 0xc6 }, { 7, 0x2, 0xc6 }, { 10, 0x2, 0xc6 },
+    { 14, 0x2, 0xc6 }, { 21, 0x2, 0xc6 }, { 38, 0x2, 0xc6 }, { 137, 0x3, 0xc6 },
+    /* state 210: 111100011 */
+    { 0, 0x4, 0xc7 }, { 3, 0x2, 0xc7 }, { 7, 0x2, 0xc7 }, { 10, 0x2, 0xc7 },
+    { 14, 0x2, 0xc7 }, { 21, 0x2, 0xc7 }, { 38, 0x2, 0xc7 }, { 137, 0x3, 0xc7 },
+    { 0, 0x4, 0xc8 }, { 3, 0x2, 0xc8 }, { 7, 0x2, 0xc8 }, { 10, 0x2, 0xc8 },
+    { 14, 0x2, 0xc8 }, { 21, 0x2, 0xc8 }, { 38, 0x2, 0xc8 }, { 137, 0x3, 0xc8 },
+    /* state 211: 1111001 */
+    { 1, 0x2, 0xc9 }, { 12, 0x3, 0xc9 }, { 1, 0x2, 0xca }, { 12, 0x3, 0xca },
+    { 1, 0x2, 0xcb }, { 12, 0x3, 0xcb }, { 1, 0x2, 0xcc }, { 12, 0x3, 0xcc },
+    { 1, 0x2, 0xcd }, { 12, 0x3, 0xcd }, { 1, 0x2, 0xce }, { 12, 0x3, 0xce },
+    { 1, 0x2, 0xcf }, { 12, 0x3, 0xcf }, { 1, 0x2, 0xd0 }, { 12, 0x3, 0xd0 },
+    /* state 212: 11110010 */
+    { 2, 0x2, 0xc9 }, { 6, 0x2, 0xc9 }, { 13, 0x2, 0xc9 }, { 37, 0x3, 0xc9 },
+    { 2, 0x2, 0xca }, { 6, 0x2, 0xca }, { 13, 0x2, 0xca }, { 37, 0x3, 0xca },
+    { 2, 0x2, 0xcb }, { 6, 0x2, 0xcb }, { 13, 0x2, 0xcb }, { 37, 0x3, 0xcb },
+    { 2, 0x2, 0xcc }, { 6, 0x2, 0xcc }, { 13, 0x2, 0xcc }, { 37, 0x3, 0xcc },
+    /* state 213: 111100100 */
+    { 0, 0x4, 0xc9 }, { 3, 0x2, 0xc9 }, { 7, 0x2, 0xc9 }, { 10, 0x2, 0xc9 },
+    { 14, 0x2, 0xc9 }, { 21, 0x2, 0xc9 }, { 38, 0x2, 0xc9 }, { 137, 0x3, 0xc9 },
+    { 0, 0x4, 0xca }, { 3, 0x2, 0xca }, { 7, 0x2, 0xca }, { 10, 0x2, 0xca },
+    { 14, 0x2, 0xca }, { 21, 0x2, 0xca }, { 38, 0x2, 0xca }, { 137, 0x3, 0xca },
+    /* state 214: 111100101 */
+    { 0, 0x4, 0xcb }, { 3, 0x2, 0xcb }, { 7, 0x2, 0xcb }, { 10, 0x2, 0xcb },
+    { 14, 0x2, 0xcb }, { 21, 0x2, 0xcb }, { 38, 0x2, 0xcb }, { 137, 0x3, 0xcb },
+    { 0, 0x4, 0xcc }, { 3, 0x2, 0xcc }, { 7, 0x2, 0xcc }, { 10, 0x2, 0xcc },
+    { 14, 0x2, 0xcc }, { 21, 0x2, 0xcc }, { 38, 0x2, 0xcc }, { 137, 0x3, 0xcc },
+    /* state 215: 11110011 */
+    { 2, 0x2, 0xcd }, { 6, 0x2, 0xcd }, { 13, 0x2, 0xcd }, { 37, 0x3, 0xcd },
+    { 2, 0x2, 0xce }, { 6, 0x2, 0xce }, { 13, 0x2, 0xce }, { 37, 0x3, 0xce },
+    { 2, 0x2, 0xcf }, { 6, 0x2, 0xcf }, { 13, 0x2, 0xcf }, { 37, 0x3, 0xcf },
+    { 2, 0x2, 0xd0 }, { 6, 0x2, 0xd0 }, { 13, 0x2, 0xd0 }, { 37, 0x3, 0xd0 },
+    /* state 216: 111100110 */
+    { 0, 0x4, 0xcd }, { 3, 0x2, 0xcd }, { 7, 0x2, 0xcd }, { 10, 0x2, 0xcd },
+    { 14, 0x2, 0xcd }, { 21, 0x2, 0xcd }, { 38, 0x2, 0xcd }, { 137, 0x3, 0xcd },
+    { 0, 0x4, 0xce }, { 3, 0x2, 0xce }, { 7, 0x2, 0xce }, { 10, 0x2, 0xce },
+    { 14, 0x2, 0xce }, { 21, 0x2, 0xce }, { 38, 0x2, 0xce }, { 137, 0x3, 0xce },
+    /* state 217: 111100111 */
+    { 0, 0x4, 0xcf }, { 3, 0x2, 0xcf }, { 7, 0x2, 0xcf }, { 10, 0x2, 0xcf },
+    { 14, 0x2, 0xcf }, { 21, 0x2, 0xcf }, { 38, 0x2, 0xcf }, { 137, 0x3, 0xcf },
+    { 0, 0x4, 0xd0 }, { 3, 0x2, 0xd0 }, { 7, 0x2, 0xd0 }, { 10, 0x2, 0xd0 },
+    { 14, 0x2, 0xd0 }, { 21, 0x2, 0xd0 }, { 38, 0x2, 0xd0 }, { 137, 0x3, 0xd0 },
+    /* state 218: 111101 */
+    { 0, 0x3, 0xd1 }, { 0, 0x3, 0xd2 }, { 0, 0x3, 0xd3 }, { 0, 0x3, 0xd4 },
+    { 0, 0x3, 0xd5 }, { 0, 0x3, 0xd6 }, { 0, 0x3, 0xd7 }, { 0, 0x3, 0xd8 },
+    { 0, 0x3, 0xd9 }, { 0, 0x3, 0xda }, { 0, 0x3, 0xdb }, { 0, 0x3, 0xdc },
+    { 0, 0x3, 0xdd }, { 0, 0x3, 0xde }, { 0, 0x3, 0xdf }, { 0, 0x3, 0xe0 },
+    /* state 219: 1111010 */
+    { 1, 0x2, 0xd1 }, { 12, 0x3, 0xd1 }, { 1, 0x2, 0xd2 }, { 12, 0x3, 0xd2 },
+    { 1, 0x2, 0xd3 }, { 12, 0x3, 0xd3 }, { 1, 0x2, 0xd4 }, { 12, 0x3, 0xd4 },
+    { 1, 0x2, 0xd5 }, { 12, 0x3, 0xd5 }, { 1, 0x2, 0xd6 }, { 12, 0x3, 0xd6 },
+    { 1, 0x2, 0xd7 }, { 12, 0x3, 0xd7 }, { 1, 0x2, 0xd8 }, { 12, 0x3, 0xd8 },
+    /* state 220: 11110100 */
+    { 2, 0x2, 0xd1 }, { 6, 0x2, 0xd1 }, { 13, 0x2, 0xd1 }, { 37, 0x3, 0xd1 },
+    { 2, 0x2, 0xd2 }, { 6, 0x2, 0xd2 }, { 13, 0x2, 0xd2 }, { 37, 0x3, 0xd2 },
+    { 2, 0x2, 0xd3 }, { 6, 0x2, 0xd3 }, { 13, 0x2, 0xd3 }, { 37, 0x3, 0xd3 },
+    { 2, 0x2, 0xd4 }, { 6, 0x2, 0xd4 }, { 13, 0x2, 0xd4 }, { 37, 0x3, 0xd4 },
+    /* state 221: 111101000 */
+    { 0, 0x4, 0xd1 }, { 3, 0x2, 0xd1 }, { 7, 0x2, 0xd1 }, { 10, 0x2, 0xd1 },
+    { 14, 0x2, 0xd1 }, { 21, 0x2, 0xd1 }, { 38, 0x2, 0xd1 }, { 137, 0x3, 0xd1 },
+    { 0, 0x4, 0xd2 }, { 3, 0x2, 0xd2 }, { 7, 0x2, 0xd2 }, { 10, 0x2, 0xd2 },
+    { 14, 0x2, 0xd2 }, { 21, 0x2, 0xd2 }, { 38, 0x2, 0xd2 }, { 137, 0x3, 0xd2 },
+    /* state 222: 111101001 */
+    { 0, 0x4, 0xd3 }, { 3, 0x2, 0xd3 }, { 7, 0x2, 0xd3 }, { 10, 0x2, 0xd3 },
+    { 14, 0x2, 0xd3 }, { 21, 0x2, 0xd3 }, { 38, 0x2, 0xd3 }, { 137, 0x3, 0xd3 },
+    { 0, 0x4, 0xd4 }, { 3, 0x2, 0xd4 }, { 7, 0x2, 0xd4 }, { 10, 0x2, 0xd4 },
+    { 14, 0x2, 0xd4 }, { 21, 0x2, 0xd4 }, { 38, 0x2, 0xd4 }, { 137, 0x3, 0xd4 },
+    /* state 223: 11110101 */
+    { 2, 0x2, 0xd5 }, { 6, 0x2, 0xd5 }, { 13, 0x2, 0xd5 }, { 37, 0x3, 0xd5 },
+    { 2, 0x2, 0xd6 }, { 6, 0x2, 0xd6 }, { 13, 0x2, 0xd6 }, { 37, 0x3, 0xd6 },
+    { 2, 0x2, 0xd7 }, { 6, 0x2, 0xd7 }, { 13, 0x2, 0xd7 }, { 37, 0x3, 0xd7 },
+    { 2, 0x2, 0xd8 }, { 6, 0x2, 0xd8 }, { 13, 0x2, 0xd8 }, { 37, 0x3, 0xd8 },
+    /* state 224: 111101010 */
+    { 0, 0x4, 0xd5 }, { 3, 0x2, 0xd5 }, { 7, 0x2, 0xd5 }, { 10, 0x2, 0xd5 },
+    { 14, 0x2, 0xd5 }, { 21, 0x2, 0xd5 }, { 38, 0x2, 0xd5 }, { 137, 0x3, 0xd5 },
+    { 0, 0x4, 0xd6 }, { 3, 0x2, 0xd6 }, { 7, 0x2, 0xd6 }, { 10, 0x2, 0xd6 },
+    { 14, 0x2, 0xd6 }, { 21, 0x2, 0xd6 }, { 38, 0x2, 0xd6 }, { 137, 0x3, 0xd6 },
+    /* state 225: 111101011 */
+    { 0, 0x4, 0xd7 }, { 3, 0x2, 0xd7 }, { 7, 0x2, 0xd7 }, { 10, 0x2, 0xd7 },
+    { 14, 0x2, 0xd7 }, { 21, 0x2, 0xd7 }, { 38, 0x2, 0xd7 }, { 137, 0x3, 0xd7 },
+    { 0, 0x4, 0xd8 }, { 3, 0x2, 0xd8 }, { 7, 0x2, 0xd8 }, { 10, 0x2, 0xd8 },
+    { 14, 0x2, 0xd8 }, { 21, 0x2, 0xd8 }, { 38, 0x2, 0xd8 }, { 137, 0x3, 0xd8 },
+    /* state 226: 1111011 */
+    { 1, 0x2, 0xd9 }, { 12, 0x3, 0xd9 }, { 1, 0x2, 0xda }, { 12, 0x3, 0xda },
+    { 1, 0x2, 0xdb }, { 12, 0x3, 0xdb }, { 1, 0x2, 0xdc }, { 12, 0x3, 0xdc },
+    { 1, 0x2, 0xdd }, { 12, 0x3, 0xdd }, { 1, 0x2, 0xde }, { 12, 0x3, 0xde },
+    { 1, 0x2, 0xdf }, { 12, 0x3, 0xdf }, { 1, 0x2, 0xe0 }, { 12, 0x3, 0xe0 },
+    /* state 227: 11110110 */
+    { 2, 0x2, 0xd9 }, { 6, 0x2, 0xd9 }, { 13, 0x2, 0xd9 }, { 37, 0x3, 0xd9 },
+    { 2, 0x2, 0xda }, { 6, 0x2, 0xda }, { 13, 0x2, 0xda }, { 37, 0x3, 0xda },
+    { 2, 0x2, 0xdb }, { 6, 0x2, 0xdb }, { 13, 0x2, 0xdb }, { 37, 0x3, 0xdb },
+    { 2, 0x2, 0xdc }, { 6, 0x2, 0xdc }, { 13, 0x2, 0xdc }, { 37, 0x3, 0xdc },
+    /* state 228: 111101100 */
+    { 0, 0x4, 0xd9 }, { 3, 0x2, 0xd9 }, { 7, 0x2, 0xd9 }, { 10, 0x2, 0xd9 },
+    { 14, 0x2, 0xd9 }, { 21, 0x2, 0xd9 }, { 38, 0x2, 0xd9 }, { 137, 0x3, 0xd9 },
+    { 0, 0x4, 0xda }, { 3, 0x2, 0xda }, { 7, 0x2, 0xda }, { 10, 0x2, 0xda },
+    { 14, 0x2, 0xda }, { 21, 0x2, 0xda }, { 38, 0x2, 0xda }, { 137, 0x3, 0xda },
+    /* state 229: 111101101 */
+    { 0, 0x4, 0xdb }, { 3, 0x2, 0xdb }, { 7, 0x2, 0xdb }, { 10, 0x2, 0xdb },
+    { 14, 0x2, 0xdb }, { 21, 0x2, 0xdb }, { 38, 0x2, 0xdb }, { 137, 0x3, 0xdb },
+    { 0, 0x4, 0xdc }, { 3, 0x2, 0xdc }, { 7, 0x2, 0xdc }, { 10, 0x2, 0xdc },
+    { 14, 0x2, 0xdc }, { 21, 0x2, 0xdc }, { 38, 0x2, 0xdc }, { 137, 0x3, 0xdc },
+    /* state 230: 11110111 */
+    { 2, 0x2, 0xdd }, { 6, 0x2, 0xdd }, { 13, 0x2, 0xdd }, { 37, 0x3, 0xdd },
+    { 2, 0x2, 0xde }, { 6, 0x2, 0xde }, { 13, 0x2, 0xde }, { 37, 0x3, 0xde },
+    { 2, 0x2, 0xdf }, { 6, 0x2, 0xdf }, { 13, 0x2, 0xdf }, { 37, 0x3, 0xdf },
+    { 2, 0x2, 0xe0 }, { 6, 0x2, 0xe0 }, { 13, 0x2, 0xe0 }, { 37, 0x3, 0xe0 },
+    /* state 231: 111101110 */
+    { 0, 0x4, 0xdd }, { 3, 0x2, 0xdd }, { 7, 0x2, 0xdd }, { 10, 0x2, 0xdd },
+    { 14, 0x2, 0xdd }, { 21, 0x2, 0xdd }, { 38, 0x2, 0xdd }, { 137, 0x3, 0xdd },
+    { 0, 0x4, 0xde }, { 3, 0x2, 0xde }, { 7, 0x2, 0xde }, { 10, 0x2, 0xde },
+    { 14, 0x2, 0xde }, { 21, 0x2, 0xde }, { 38, 0x2, 0xde }, { 137, 0x3, 0xde },
+    /* state 232: 111101111 */
+    { 0, 0x4, 0xdf }, { 3, 0x2, 0xdf }, { 7, 0x2, 0xdf }, { 10, 0x2, 0xdf },
+    { 14, 0x2, 0xdf }, { 21, 0x2, 0xdf }, { 38, 0x2, 0xdf }, { 137, 0x3, 0xdf },
+    { 0, 0x4, 0xe0 }, { 3, 0x2, 0xe0 }, { 7, 0x2, 0xe0 }, { 10, 0x2, 0xe0 },
+    { 14, 0x2, 0xe0 }, { 21, 0x2, 0xe0 }, { 38, 0x2, 0xe0 }, { 137, 0x3, 0xe0 },
+    /* state 233: 11111 */
+    { 237, 0x0, 0x0 }, { 238, 0x0, 0x0 }, { 240, 0x0, 0x0 }, { 241, 0x0, 0x0 },
+    { 244, 0x0, 0x0 }, { 245, 0x0, 0x0 }, { 247, 0x0, 0x0 }, { 248, 0x0, 0x0 },
+    { 252, 0x0, 0x0 }, { 253, 0x0, 0x0 }, { 255, 0x0, 0x0 }, { 256, 0x0, 0x0 },
+    { 259, 0x0, 0x0 }, { 260, 0x0, 0x0 }, { 262, 0x0, 0x0 }, { 263, 0x0, 0x0 },
+    /* state 234: 111110 */
+    { 0, 0x3, 0xe1 }, { 0, 0x3, 0xe2 }, { 0, 0x3, 0xe3 }, { 0, 0x3, 0xe4 },
+    { 0, 0x3, 0xe5 }, { 0, 0x3, 0xe6 }, { 0, 0x3, 0xe7 }, { 0, 0x3, 0xe8 },
+    { 0, 0x3, 0xe9 }, { 0, 0x3, 0xea }, { 0, 0x3, 0xeb }, { 0, 0x3, 0xec },
+    { 0, 0x3, 0xed }, { 0, 0x3, 0xee }, { 0, 0x3, 0xef }, { 0, 0x3, 0xf0 },
+    /* state 235: 1111100 */
+    { 1, 0x2, 0xe1 }, { 12, 0x3, 0xe1 }, { 1, 0x2, 0xe2 }, { 12, 0x3, 0xe2 },
+    { 1, 0x2, 0xe3 }, { 12, 0x3, 0xe3 }, { 1, 0x2, 0xe4 }, { 12, 0x3, 0xe4 },
+    { 1, 0x2, 0xe5 }, { 12, 0x3, 0xe5 }, { 1, 0x2, 0xe6 }, { 12, 0x3, 0xe6 },
+    { 1, 0x2, 0xe7 }, { 12, 0x3, 0xe7 }, { 1, 0x2, 0xe8 }, { 12, 0x3, 0xe8 },
+    /* state 236: 11111000 */
+    { 2, 0x2, 0xe1 }, { 6, 0x2, 0xe1 }, { 13, 0x2, 0xe1 }, { 37, 0x3, 0xe1 },
+    { 2, 0x2, 0xe2 }, { 6, 0x2, 0xe2 }, { 13, 0x2, 0xe2 }, { 37, 0x3, 0xe2 },
+    { 2, 0x2, 0xe3 }, { 6, 0x2, 0xe3 }, { 13, 0x2, 0xe3 }, { 37, 0x3, 0xe3 },
+    { 2, 0x2, 0xe4 }, { 6, 0x2, 0xe4 }, { 13, 0x2, 0xe4 }, { 37, 0x3, 0xe4 },
+    /* state 237: 111110000 */
+    { 0, 0x4, 0xe1 }, { 3, 0x2, 0xe1 }, { 7, 0x2, 0xe1 }, { 10, 0x2, 0xe1 },
+    { 14, 0x2, 0xe1 }, { 21, 0x2, 0xe1 }, { 38, 0x2, 0xe1 }, { 137, 0x3, 0xe1 },
+    { 0, 0x4, 0xe2 }, { 3, 0x2, 0xe2 }, { 7, 0x2, 0xe2 }, { 10, 0x2, 0xe2 },
+    { 14, 0x2, 0xe2 }, { 21, 0x2, 0xe2 }, { 38, 0x2, 0xe2 }, { 137, 0x3, 0xe2 },
+    /* state 238: 111110001 */
+    { 0, 0x4, 0xe3 }, { 3, 0x2, 0xe3 }, { 7, 0x2, 0xe3 }, { 10, 0x2, 0xe3 },
+    { 14, 0x2, 0xe3 }, { 21, 0x2, 0xe3 }, { 38, 0x2, 0xe3 }, { 137, 0x3, 0xe3 },
+    { 0, 0x4, 0xe4 }, { 3, 0x2, 0xe4 }, { 7, 0x2, 0xe4 }, { 10, 0x2, 0xe4 },
+    { 14, 0x2, 0xe4 }, { 21, 0x2, 0xe4 }, { 38, 0x2, 0xe4 }, { 137, 0x3, 0xe4 },
+    /* state 239: 11111001 */
+    { 2, 0x2, 0xe5 }, { 6, 0x2, 0xe5 }, { 13, 0x2, 0xe5 }, { 37, 0x3, 0xe5 },
+    { 2, 0x2, 0xe6 }, { 6, 0x2, 0xe6 }, { 13, 0x2, 0xe6 }, { 37, 0x3, 0xe6 },
+    { 2, 0x2, 0xe7 }, { 6, 0x2, 0xe7 }, { 13, 0x2, 0xe7 }, { 37, 0x3, 0xe7 },
+    { 2, 0x2, 0xe8 }, { 6, 0x2, 0xe8 }, { 13, 0x2, 0xe8 }, { 37, 0x3, 0xe8 },
+    /* state 240: 111110010 */
+    { 0, 0x4, 0xe5 }, { 3, 0x2, 0xe5 }, { 7, 0x2, 0xe5 }, { 10, 0x2, 0xe5 },
+    { 14, 0x2, 0xe5 }, { 21, 0x2, 0xe5 }, { 38, 0x2, 0xe5 }, { 137, 0x3, 0xe5 },
+    { 0, 0x4, 0xe6 }, { 3, 0x2, 0xe6 }, { 7, 0x2, 0xe6 }, { 10, 0x2, 0xe6 },
+    { 14, 0x2, 0xe6 }, { 21, 0x2, 0xe6 }, { 38, 0x2, 0xe6 }, { 137, 0x3, 0xe6 },
+    /* state 241: 111110011 */
+    { 0, 0x4, 0xe7 }, { 3, 0x2, 0xe7 }, { 7, 0x2, 0xe7 }, { 10, 0x2, 0xe7 },
+    { 14, 0x2, 0xe7 }, { 21, 0x2, 0xe7 }, { 38, 0x2, 0xe7 }, { 137, 0x3, 0xe7 },
+    { 0, 0x4, 0xe8 }, { 3, 0x2, 0xe8 }, { 7, 0x2, 0xe8 }, { 10, 0x2, 0xe8 },
+    { 14, 0x2, 0xe8 }, { 21, 0x2, 0xe8 }, { 38, 0x2, 0xe8 }, { 137, 0x3, 0xe8 },
+    /* state 242: 1111101 */
+    { 1, 0x2, 0xe9 }, { 12, 0x3, 0xe9 }, { 1, 0x2, 0xea }, { 12, 0x3, 0xea },
+    { 1, 0x2, 0xeb }, { 12, 0x3, 0xeb }, { 1, 0x2, 0xec }, { 12, 0x3, 0xec },
+    { 1, 0x2, 0xed }, { 12, 0x3, 0xed }, { 1, 0x2, 0xee }, { 12, 0x3, 0xee },
+    { 1, 0x2, 0xef }, { 12, 0x3, 0xef }, { 1, 0x2, 0xf0 }, { 12, 0x3, 0xf0 },
+    /* state 243: 11111010 */
+    { 2, 0x2, 0xe9 }, { 6, 0x2, 0xe9 }, { 13, 0x2, 0xe9 }, { 37, 0x3, 0xe9 },
+    { 2, 0x2, 0xea }, { 6, 0x2, 0xea }, { 13, 0x2, 0xea }, { 37, 0x3, 0xea },
+    { 2, 0x2, 0xeb }, { 6, 0x2, 0xeb }, { 13, 0x2, 0xeb }, { 37, 0x3, 0xeb },
+    { 2, 0x2, 0xec }, { 6, 0x2, 0xec }, { 13, 0x2, 0xec }, { 37, 0x3, 0xec },
+    /* state 244: 111110100 */
+    { 0, 0x4, 0xe9 }, { 3, 0x2, 0xe9 }, { 7, 0x2, 0xe9 }, { 10, 0x2, 0xe9 },
+    { 14, 0x2, 0xe9 }, { 21, 0x2, 0xe9 }, { 38, 0x2, 0xe9 }, { 137, 0x3, 0xe9 },
+    { 0, 0x4, 0xea }, { 3, 0x2, 0xea }, { 7, 0x2, 0xea }, { 10, 0x2, 0xea },
+    { 14, 0x2, 0xea }, { 21, 0x2, 0xea }, { 38, 0x2, 0xea }, { 137, 0x3, 0xea },
+    /* state 245: 111110101 */
+    { 0, 0x4, 0xeb }, { 3, 0x2, 0xeb }, { 7, 0x2, 0xeb }, { 10, 0x2, 0xeb },
+    { 14, 0x2, 0xeb }, { 21, 0x2, 0xeb }, { 38, 0x2, 0xeb }, { 137, 0x3, 0xeb },
+    { 0, 0x4, 0xec }, { 3, 0x2, 0xec }, { 7, 0x2, 0xec }, { 10, 0x2, 0xec },
+    { 14, 0x2, 0xec }, { 21, 0x2, 0xec }, { 38, 0x2, 0xec }, { 137, 0x3, 0xec },
+    /* state 246: 11111011 */
+    { 2, 0x2, 0xed }, { 6, 0x2, 0xed }, { 13, 0x2, 0xed }, { 37, 0x3, 0xed },
+    { 2, 0x2, 0xee }, { 6, 0x2, 0xee }, { 13, 0x2, 0xee }, { 37, 0x3, 0xee },
+    { 2, 0x2, 0xef }, { 6, 0x2, 0xef }, { 13, 0x2, 0xef }, { 37, 0x3, 0xef },
+    { 2, 0x2, 0xf0 }, { 6, 0x2, 0xf0 }, { 13, 0x2, 0xf0 }, { 37, 0x3, 0xf0 },
+    /* state 247: 111110110 */
+    { 0, 0x4, 0xed }, { 3, 0x2, 0xed }, { 7, 0x2, 0xed }, { 10, 0x2, 0xed },
+    { 14, 0x2, 0xed }, { 21, 0x2, 0xed }, { 38, 0x2, 0xed }, { 137, 0x3, 0xed },
+    { 0, 0x4, 0xee }, { 3, 0x2, 0xee }, { 7, 0x2, 0xee }, { 10, 0x2, 0xee },
+    { 14, 0x2, 0xee }, { 21, 0x2, 0xee }, { 38, 0x2, 0xee }, { 137, 0x3, 0xee },
+    /* state 248: 111110111 */
+    { 0, 0x4, 0xef }, { 3, 0x2, 0xef }, { 7, 0x2, 0xef }, { 10, 0x2, 0xef },
+    { 14, 0x2, 0xef }, { 21, 0x2, 0xef }, { 38, 0x2, 0xef }, { 137, 0x3, 0xef },
+    { 0, 0x4, 0xf0 }, { 3, 0x2, 0xf0 }, { 7, 0x2, 0xf0 }, { 10, 0x2, 0xf0 },
+    { 14, 0x2, 0xf0 }, { 21, 0x2, 0xf0 }, { 38, 0x2, 0xf0 }, { 137, 0x3, 0xf0 },
+    /* state 249: 111111 */
+    { 0, 0x3, 0xf1 }, { 0, 0x3, 0xf2 }, { 0, 0x3, 0xf3 }, { 0, 0x3, 0xf4 },
+    { 0, 0x3, 0xf5 }, { 0, 0x3, 0xf6 }, { 0, 0x3, 0xf7 }, { 0, 0x3, 0xf8 },
+    { 0, 0x3, 0xf9 }, { 0, 0x3, 0xfa }, { 0, 0x3, 0xfb }, { 0, 0x3, 0xfc },
+    { 0, 0x3, 0xfd }, { 0, 0x3, 0xfe }, { 0, 0x3, 0xff }, { 0, 0x4, 0x0 },
+    /* state 250: 1111110 */
+    { 1, 0x2, 0xf1 }, { 12, 0x3, 0xf1 }, { 1, 0x2, 0xf2 }, { 12, 0x3, 0xf2 },
+    { 1, 0x2, 0xf3 }, { 12, 0x3, 0xf3 }, { 1, 0x2, 0xf4 }, { 12, 0x3, 0xf4 },
+    { 1, 0x2, 0xf5 }, { 12, 0x3, 0xf5 }, { 1, 0x2, 0xf6 }, { 12, 0x3, 0xf6 },
+    { 1, 0x2, 0xf7 }, { 12, 0x3, 0xf7 }, { 1, 0x2, 0xf8 }, { 12, 0x3, 0xf8 },
+    /* state 251: 11111100 */
+    { 2, 0x2, 0xf1 }, { 6, 0x2, 0xf1 }, { 13, 0x2, 0xf1 }, { 37, 0x3, 0xf1 },
+    { 2, 0x2, 0xf2 }, { 6, 0x2, 0xf2 }, { 13, 0x2, 0xf2 }, { 37, 0x3, 0xf2 },
+    { 2, 0x2, 0xf3 }, { 6, 0x2, 0xf3 }, { 13, 0x2, 0xf3 }, { 37, 0x3, 0xf3 },
+    { 2, 0x2, 0xf4 }, { 6, 0x2, 0xf4 }, { 13, 0x2, 0xf4 }, { 37, 0x3, 0xf4 },
+    /* state 252: 111111000 */
+    { 0, 0x4, 0xf1 }, { 3, 0x2, 0xf1 }, { 7, 0x2, 0xf1 }, { 10, 0x2, 0xf1 },
+    { 14, 0x2, 0xf1 }, { 21, 0x2, 0xf1 }, { 38, 0x2, 0xf1 }, { 137, 0x3, 0xf1 },
+    { 0, 0x4, 0xf2 }, { 3, 0x2, 0xf2 }, { 7, 0x2, 0xf2 }, { 10, 0x2, 0xf2 },
+    { 14, 0x2, 0xf2 }, { 21, 0x2, 0xf2 }, { 38, 0x2, 0xf2 }, { 137, 0x3, 0xf2 },
+    /* state 253: 111111001 */
+    { 0, 0x4, 0xf3 }, { 3, 0x2, 0xf3 }, { 7, 0x2, 0xf3 }, { 10, 0x2, 0xf3 },
+    { 14, 0x2, 0xf3 }, { 21, 0x2, 0xf3 }, { 38, 0x2, 0xf3 }, { 137, 0x3, 0xf3 },
+    { 0, 0x4, 0xf4 }, { 3, 0x2, 0xf4 }, { 7, 0x2, 0xf4 }, { 10, 0x2, 0xf4 },
+    { 14, 0x2, 0xf4 }, { 21, 0x2, 0xf4 }, { 38, 0x2, 0xf4 }, { 137, 0x3, 0xf4 },
+    /* state 254: 11111101 */
+    { 2, 0x2, 0xf5 }, { 6, 0x2, 0xf5 }, { 13, 0x2, 0xf5 }, { 37, 0x3, 0xf5 },
+    { 2, 0x2, 0xf6 }, { 6, 0x2, 0xf6 }, { 13, 0x2, 0xf6 }, { 37, 0x3, 0xf6 },
+    { 2, 0x2, 0xf7 }, { 6, 0x2, 0xf7 }, { 13, 0x2, 0xf7 }, { 37, 0x3, 0xf7 },
+    { 2, 0x2, 0xf8 }, { 6, 0x2, 0xf8 }, { 13, 0x2, 0xf8 }, { 37, 0x3, 0xf8 },
+    /* state 255: 111111010 */
+    { 0, 0x4, 0xf5 }, { 3, 0x2, 0xf5 }, { 7, 0x2, 0xf5 }, { 10, 0x2, 0xf5 },
+    { 14, 0x2, 0xf5 }, { 21, 0x2, 0xf5 }, { 38, 0x2, 0xf5 }, { 137, 0x3, 0xf5 },
+    { 0, 0x4, 0xf6 }, { 3, 0x2, 0xf6 }, { 7, 0x2, 0xf6 }, { 10, 0x2, 0xf6 },
+    { 14, 0x2, 0xf6 }, { 21, 0x2, 0xf6 }, { 38, 0x2, 0xf6 }, { 137, 0x3, 0xf6 },
+    /* state 256: 111111011 */
+    { 0, 0x4, 0xf7 }, { 3, 0x2, 0xf7 }, { 7, 0x2, 0xf7 }, { 10, 0x2, 0xf7 },
+    { 14, 0x2, 0xf7 }, { 21, 0x2, 0xf7 }, { 38, 0x2, 0xf7 }, { 137, 0x3, 0xf7 },
+    { 0, 0x4, 0xf8 }, { 3, 0x2, 0xf8 }, { 7, 0x2, 0xf8 }, { 10, 0x2, 0xf8 },
+    { 14, 0x2, 0xf8 }, { 21, 0x2, 0xf8 }, { 38, 0x2, 0xf8 }, { 137, 0x3, 0xf8 },
+    /* state 257: 1111111 */
+    { 1, 0x2, 0xf9 }, { 12, 0x3, 0xf9 }, { 1, 0x2, 0xfa }, { 12, 0x3, 0xfa },
+    { 1, 0x2, 0xfb }, { 12, 0x3, 0xfb }, { 1, 0x2, 0xfc }, { 12, 0x3, 0xfc },
+    { 1, 0x2, 0xfd }, { 12, 0x3, 0xfd }, { 1, 0x2, 0xfe }, { 12, 0x3, 0xfe },
+    { 1, 0x2, 0xff }, { 12, 0x3, 0xff }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 258: 11111110 */
+    { 2, 0x2, 0xf9 }, { 6, 0x2, 0xf9 }, { 13, 0x2, 0xf9 }, { 37, 0x3, 0xf9 },
+    { 2, 0x2, 0xfa }, { 6, 0x2, 0xfa }, { 13, 0x2, 0xfa }, { 37, 0x3, 0xfa },
+    { 2, 0x2, 0xfb }, { 6, 0x2, 0xfb }, { 13, 0x2, 0xfb }, { 37, 0x3, 0xfb },
+    { 2, 0x2, 0xfc }, { 6, 0x2, 0xfc }, { 13, 0x2, 0xfc }, { 37, 0x3, 0xfc },
+    /* state 259: 111111100 */
+    { 0, 0x4, 0xf9 }, { 3, 0x2, 0xf9 }, { 7, 0x2, 0xf9 }, { 10, 0x2, 0xf9 },
+    { 14, 0x2, 0xf9 }, { 21, 0x2, 0xf9 }, { 38, 0x2, 0xf9 }, { 137, 0x3, 0xf9 },
+    { 0, 0x4, 0xfa }, { 3, 0x2, 0xfa }, { 7, 0x2, 0xfa }, { 10, 0x2, 0xfa },
+    { 14, 0x2, 0xfa }, { 21, 0x2, 0xfa }, { 38, 0x2, 0xfa }, { 137, 0x3, 0xfa },
+    /* state 260: 111111101 */
+    { 0, 0x4, 0xfb }, { 3, 0x2, 0xfb }, { 7, 0x2, 0xfb }, { 10, 0x2, 0xfb },
+    { 14, 0x2, 0xfb }, { 21, 0x2, 0xfb }, { 38, 0x2, 0xfb }, { 137, 0x3, 0xfb },
+    { 0, 0x4, 0xfc }, { 3, 0x2, 0xfc }, { 7, 0x2, 0xfc }, { 10, 0x2, 0xfc },
+    { 14, 0x2, 0xfc }, { 21, 0x2, 0xfc }, { 38, 0x2, 0xfc }, { 137, 0x3, 0xfc },
+    /* state 261: 11111111 */
+    { 2, 0x2, 0xfd }, { 6, 0x2, 0xfd }, { 13, 0x2, 0xfd }, { 37, 0x3, 0xfd },
+    { 2, 0x2, 0xfe }, { 6, 0x2, 0xfe }, { 13, 0x2, 0xfe }, { 37, 0x3, 0xfe },
+    { 2, 0x2, 0xff }, { 6, 0x2, 0xff }, { 13, 0x2, 0xff }, { 37, 0x3, 0xff },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    /* state 262: 111111110 */
+    { 0, 0x4, 0xfd }, { 3, 0x2, 0xfd }, { 7, 0x2, 0xfd }, { 10, 0x2, 0xfd },
+    { 14, 0x2, 0xfd }, { 21, 0x2, 0xfd }, { 38, 0x2, 0xfd }, { 137, 0x3, 0xfd },
+    { 0, 0x4, 0xfe }, { 3, 0x2, 0xfe }, { 7, 0x2, 0xfe }, { 10, 0x2, 0xfe },
+    { 14, 0x2, 0xfe }, { 21, 0x2, 0xfe }, { 38, 0x2, 0xfe }, { 137, 0x3, 0xfe },
+    /* state 263: 111111111 */
+    { 0, 0x4, 0xff }, { 3, 0x2, 0xff }, { 7, 0x2, 0xff }, { 10, 0x2, 0xff },
+    { 14, 0x2, 0xff }, { 21, 0x2, 0xff }, { 38, 0x2, 0xff }, { 137, 0x3, 0xff },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+    { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 }, { 0, 0x4, 0x0 },
+};
+
+static const struct aws_huffman_fsm_table fsm_table = {
+    .transitions = fsm_transitions,
+    .num_states = 264,
+};
+
+struct aws_huffman_symbol_coder *test_fsm_get_coder(void) {
+
+    static struct aws_huffman_symbol_coder coder = {
+        .encode = encode_symbol,
+        .decode = decode_symbol,
+        .userdata = NULL,
+        .encode_table = code_points,
+        .code_lengths = code_lengths,
+        .fsm_table = &fsm_table,
+    };
+    return &coder;
+}
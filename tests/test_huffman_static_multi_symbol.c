@@ -0,0 +1,5162 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+/* WARNING: THIS FILE WAS AUTOMATICALLY GENERATED. DO NOT EDIT. */
+/* clang-format off */
+
+#include <aws/compression/huffman.h>
+
+struct aws_huffman_symbol_coder *test_multi_symbol_get_coder(void);
+
+static const struct aws_huffman_code code_points[] = {
+    { .pattern = 0x32e, .num_bits = 10 }, /* ' ' 0 */
+    { .pattern = 0x32f, .num_bits = 10 }, /* ' ' 1 */
+    { .pattern = 0x330, .num_bits = 10 }, /* ' ' 2 */
+    { .pattern = 0x331, .num_bits = 10 }, /* ' ' 3 */
+    { .pattern = 0x332, .num_bits = 10 }, /* ' ' 4 */
+    { .pattern = 0x333, .num_bits = 10 }, /* ' ' 5 */
+    { .pattern = 0x334, .num_bits = 10 }, /* ' ' 6 */
+    { .pattern = 0x335, .num_bits = 10 }, /* ' ' 7 */
+    { .pattern = 0x336, .num_bits = 10 }, /* ' ' 8 */
+    { .pattern = 0x337, .num_bits = 10 }, /* ' ' 9 */
+    { .pattern = 0xb8, .num_bits = 8 }, /* ' ' 10 */
+    { .pattern = 0x338, .num_bits = 10 }, /* ' ' 11 */
+    { .pattern = 0x339, .num_bits = 10 }, /* ' ' 12 */
+    { .pattern = 0x33a, .num_bits = 10 }, /* ' ' 13 */
+    { .pattern = 0x33b, .num_bits = 10 }, /* ' ' 14 */
+    { .pattern = 0x33c, .num_bits = 10 }, /* ' ' 15 */
+    { .pattern = 0x33d, .num_bits = 10 }, /* ' ' 16 */
+    { .pattern = 0x33e, .num_bits = 10 }, /* ' ' 17 */
+    { .pattern = 0x33f, .num_bits = 10 }, /* ' ' 18 */
+    { .pattern = 0x340, .num_bits = 10 }, /* ' ' 19 */
+    { .pattern = 0x341, .num_bits = 10 }, /* ' ' 20 */
+    { .pattern = 0x342, .num_bits = 10 }, /* ' ' 21 */
+    { .pattern = 0x343, .num_bits = 10 }, /* ' ' 22 */
+    { .pattern = 0x344, .num_bits = 10 }, /* ' ' 23 */
+    { .pattern = 0x345, .num_bits = 10 }, /* ' ' 24 */
+    { .pattern = 0x346, .num_bits = 10 }, /* ' ' 25 */
+    { .pattern = 0x347, .num_bits = 10 }, /* ' ' 26 */
+    { .pattern = 0x348, .num_bits = 10 }, /* ' ' 27 */
+    { .pattern = 0x349, .num_bits = 10 }, /* ' ' 28 */
+    { .pattern = 0x34a, .num_bits = 10 }, /* ' ' 29 */
+    { .pattern = 0x34b, .num_bits = 10 }, /* ' ' 30 */
+    { .pattern = 0x34c, .num_bits = 10 }, /* ' ' 31 */
+    { .pattern = 0x4, .num_bits = 5 }, /* ' ' 32 */
+    { .pattern = 0x34d, .num_bits = 10 }, /* '!' 33 */
+    { .pattern = 0x34e, .num_bits = 10 }, /* '"' 34 */
+    { .pattern = 0x34f, .num_bits = 10 }, /* '#' 35 */
+    { .pattern = 0x350, .num_bits = 10 }, /* '$' 36 */
+    { .pattern = 0x351, .num_bits = 10 }, /* '%' 37 */
+    { .pattern = 0x352, .num_bits = 10 }, /* '&' 38 */
+    { .pattern = 0x56, .num_bits = 7 }, /* ''' 39 */
+    { .pattern = 0x353, .num_bits = 10 }, /* '(' 40 */
+    { .pattern = 0x354, .num_bits = 10 }, /* ')' 41 */
+    { .pattern = 0x355, .num_bits = 10 }, /* '*' 42 */
+    { .pattern = 0x356, .num_bits = 10 }, /* '+' 43 */
+    { .pattern = 0xb9, .num_bits = 8 }, /* ',' 44 */
+    { .pattern = 0x188, .num_bits = 9 }, /* '-' 45 */
+    { .pattern = 0x57, .num_bits = 7 }, /* '.' 46 */
+    { .pattern = 0x357, .num_bits = 10 }, /* '/' 47 */
+    { .pattern = 0x358, .num_bits = 10 }, /* '0' 48 */
+    { .pattern = 0x359, .num_bits = 10 }, /* '1' 49 */
+    { .pattern = 0x35a, .num_bits = 10 }, /* '2' 50 */
+    { .pattern = 0x35b, .num_bits = 10 }, /* '3' 51 */
+    { .pattern = 0x35c, .num_bits = 10 }, /* '4' 52 */
+    { .pattern = 0x35d, .num_bits = 10 }, /* '5' 53 */
+    { .pattern = 0x35e, .num_bits = 10 }, /* '6' 54 */
+    { .pattern = 0x35f, .num_bits = 10 }, /* '7' 55 */
+    { .pattern = 0x360, .num_bits = 10 }, /* '8' 56 */
+    { .pattern = 0x361, .num_bits = 10 }, /* '9' 57 */
+    { .pattern = 0x362, .num_bits = 10 }, /* ':' 58 */
+    { .pattern = 0x363, .num_bits = 10 }, /* ';' 59 */
+    { .pattern = 0x364, .num_bits = 10 }, /* '<' 60 */
+    { .pattern = 0x365, .num_bits = 10 }, /* '=' 61 */
+    { .pattern = 0x366, .num_bits = 10 }, /* '>' 62 */
+    { .pattern = 0xba, .num_bits = 8 }, /* '?' 63 */
+    { .pattern = 0x367, .num_bits = 10 }, /* '@' 64 */
+    { .pattern = 0x368, .num_bits = 10 }, /* 'A' 65 */
+    { .pattern = 0xbb, .num_bits = 8 }, /* 'B' 66 */
+    { .pattern = 0x189, .num_bits = 9 }, /* 'C' 67 */
+    { .pattern = 0x18a, .num_bits = 9 }, /* 'D' 68 */
+    { .pattern = 0x18b, .num_bits = 9 }, /* 'E' 69 */
+    { .pattern = 0x18c, .num_bits = 9 }, /* 'F' 70 */
+    { .pattern = 0x18d, .num_bits = 9 }, /* 'G' 71 */
+    { .pattern = 0x18e, .num_bits = 9 }, /* 'H' 72 */
+    { .pattern = 0xbc, .num_bits = 8 }, /* 'I' 73 */
+    { .pattern = 0x369, .num_bits = 10 }, /* 'J' 74 */
+    { .pattern = 0x36a, .num_bits = 10 }, /* 'K' 75 */
+    { .pattern = 0x18f, .num_bits = 9 }, /* 'L' 76 */
+    { .pattern = 0x190, .num_bits = 9 }, /* 'M' 77 */
+    { .pattern = 0x36b, .num_bits = 10 }, /* 'N' 78 */
+    { .pattern = 0x36c, .num_bits = 10 }, /* 'O' 79 */
+    { .pattern = 0x191, .num_bits = 9 }, /* 'P' 80 */
+    { .pattern = 0x36d, .num_bits = 10 }, /* 'Q' 81 */
+    { .pattern = 0x36e, .num_bits = 10 }, /* 'R' 82 */
+    { .pattern = 0x36f, .num_bits = 10 }, /* 'S' 83 */
+    { .pattern = 0xbd, .num_bits = 8 }, /* 'T' 84 */
+    { .pattern = 0x370, .num_bits = 10 }, /* 'U' 85 */
+    { .pattern = 0x192, .num_bits = 9 }, /* 'V' 86 */
+    { .pattern = 0xbe, .num_bits = 8 }, /* 'W' 87 */
+    { .pattern = 0x371, .num_bits = 10 }, /* 'X' 88 */
+    { .pattern = 0x193, .num_bits = 9 }, /* 'Y' 89 */
+    { .pattern = 0x372, .num_bits = 10 }, /* 'Z' 90 */
+    { .pattern = 0x373, .num_bits = 10 }, /* '[' 91 */
+    { .pattern = 0x374, .num_bits = 10 }, /* '\' 92 */
+    { .pattern = 0x375, .num_bits = 10 }, /* ']' 93 */
+    { .pattern = 0x376, .num_bits = 10 }, /* '^' 94 */
+    { .pattern = 0x377, .num_bits = 10 }, /* '_' 95 */
+    { .pattern = 0x378, .num_bits = 10 }, /* '`' 96 */
+    { .pattern = 0x5, .num_bits = 5 }, /* 'a' 97 */
+    { .pattern = 0x58, .num_bits = 7 }, /* 'b' 98 */
+    { .pattern = 0x20, .num_bits = 6 }, /* 'c' 99 */
+    { .pattern = 0x21, .num_bits = 6 }, /* 'd' 100 */
+    { .pattern = 0x6, .num_bits = 5 }, /* 'e' 101 */
+    { .pattern = 0x22, .num_bits = 6 }, /* 'f' 102 */
+    { .pattern = 0x59, .num_bits = 7 }, /* 'g' 103 */
+    { .pattern = 0x23, .num_bits = 6 }, /* 'h' 104 */
+    { .pattern = 0x7, .num_bits = 5 }, /* 'i' 105 */
+    { .pattern = 0xbf, .num_bits = 8 }, /* 'j' 106 */
+    { .pattern = 0x24, .num_bits = 6 }, /* 'k' 107 */
+    { .pattern = 0x25, .num_bits = 6 }, /* 'l' 108 */
+    { .pattern = 0x26, .num_bits = 6 }, /* 'm' 109 */
+    { .pattern = 0x8, .num_bits = 5 }, /* 'n' 110 */
+    { .pattern = 0x9, .num_bits = 5 }, /* 'o' 111 */
+    { .pattern = 0x5a, .num_bits = 7 }, /* 'p' 112 */
+    { .pattern = 0x194, .num_bits = 9 }, /* 'q' 113 */
+    { .pattern = 0xa, .num_bits = 5 }, /* 'r' 114 */
+    { .pattern = 0xb, .num_bits = 5 }, /* 's' 115 */
+    { .pattern = 0xc, .num_bits = 5 }, /* 't' 116 */
+    { .pattern = 0xd, .num_bits = 5 }, /* 'u' 117 */
+    { .pattern = 0xc0, .num_bits = 8 }, /* 'v' 118 */
+    { .pattern = 0x27, .num_bits = 6 }, /* 'w' 119 */
+    { .pattern = 0xc1, .num_bits = 8 }, /* 'x' 120 */
+    { .pattern = 0x28, .num_bits = 6 }, /* 'y' 121 */
+    { .pattern = 0x379, .num_bits = 10 }, /* 'z' 122 */
+    { .pattern = 0x37a, .num_bits = 10 }, /* '{' 123 */
+    { .pattern = 0x37b, .num_bits = 10 }, /* '|' 124 */
+    { .pattern = 0x37c, .num_bits = 10 }, /* '}' 125 */
+    { .pattern = 0x37d, .num_bits = 10 }, /* '~' 126 */
+    { .pattern = 0x37e, .num_bits = 10 }, /* ' ' 127 */
+    { .pattern = 0x37f, .num_bits = 10 }, /* ' ' 128 */
+    { .pattern = 0x380, .num_bits = 10 }, /* ' ' 129 */
+    { .pattern = 0x381, .num_bits = 10 }, /* ' ' 130 */
+    { .pattern = 0x382, .num_bits = 10 }, /* ' ' 131 */
+    { .pattern = 0x383, .num_bits = 10 }, /* ' ' 132 */
+    { .pattern = 0x384, .num_bits = 10 }, /* ' ' 133 */
+    { .pattern = 0x385, .num_bits = 10 }, /* ' ' 134 */
+    { .pattern = 0x386, .num_bits = 10 }, /* ' ' 135 */
+    { .pattern = 0x387, .num_bits = 10 }, /* ' ' 136 */
+    { .pattern = 0x388, .num_bits = 10 }, /* ' ' 137 */
+    { .pattern = 0x389, .num_bits = 10 }, /* ' ' 138 */
+    { .pattern = 0x38a, .num_bits = 10 }, /* ' ' 139 */
+    { .pattern = 0x38b, .num_bits = 10 }, /* ' ' 140 */
+    { .pattern = 0x38c, .num_bits = 10 }, /* ' ' 141 */
+    { .pattern = 0x38d, .num_bits = 10 }, /* ' ' 142 */
+    { .pattern = 0x38e, .num_bits = 10 }, /* ' ' 143 */
+    { .pattern = 0x38f, .num_bits = 10 }, /* ' ' 144 */
+    { .pattern = 0x390, .num_bits = 10 }, /* ' ' 145 */
+    { .pattern = 0x391, .num_bits = 10 }, /* ' ' 146 */
+    { .pattern = 0x392, .num_bits = 10 }, /* ' ' 147 */
+    { .pattern = 0x393, .num_bits = 10 }, /* ' ' 148 */
+    { .pattern = 0x394, .num_bits = 10 }, /* ' ' 149 */
+    { .pattern = 0x395, .num_bits = 10 }, /* ' ' 150 */
+    { .pattern = 0x396, .num_bits = 10 }, /* ' ' 151 */
+    { .pattern = 0x397, .num_bits = 10 }, /* ' ' 152 */
+    { .pattern = 0x398, .num_bits = 10 }, /* ' ' 153 */
+    { .pattern = 0x399, .num_bits = 10 }, /* ' ' 154 */
+    { .pattern = 0x39a, .num_bits = 10 }, /* ' ' 155 */
+    { .pattern = 0x39b, .num_bits = 10 }, /* ' ' 156 */
+    { .pattern = 0x39c, .num_bits = 10 }, /* ' ' 157 */
+    { .pattern = 0x39d, .num_bits = 10 }, /* ' ' 158 */
+    { .pattern = 0x39e, .num_bits = 10 }, /* ' ' 159 */
+    { .pattern = 0x39f, .num_bits = 10 }, /* ' ' 160 */
+    { .pattern = 0x3a0, .num_bits = 10 }, /* ' ' 161 */
+    { .pattern = 0x3a1, .num_bits = 10 }, /* ' ' 162 */
+    { .pattern = 0x3a2, .num_bits = 10 }, /* ' ' 163 */
+    { .pattern = 0x3a3, .num_bits = 10 }, /* ' ' 164 */
+    { .pattern = 0x3a4, .num_bits = 10 }, /* ' ' 165 */
+    { .pattern = 0x3a5, .num_bits = 10 }, /* ' ' 166 */
+    { .pattern = 0x3a6, .num_bits = 10 }, /* ' ' 167 */
+    { .pattern = 0x3a7, .num_bits = 10 }, /* ' ' 168 */
+    { .pattern = 0x3a8, .num_bits = 10 }, /* ' ' 169 */
+    { .pattern = 0x3a9, .num_bits = 10 }, /* ' ' 170 */
+    { .pattern = 0x3aa, .num_bits = 10 }, /* ' ' 171 */
+    { .pattern = 0x3ab, .num_bits = 10 }, /* ' ' 172 */
+    { .pattern = 0x3ac, .num_bits = 10 }, /* ' ' 173 */
+    { .pattern = 0x3ad, .num_bits = 10 }, /* ' ' 174 */
+    { .pattern = 0x3ae, .num_bits = 10 }, /* ' ' 175 */
+    { .pattern = 0x3af, .num_bits = 10 }, /* ' ' 176 */
+    { .pattern = 0x3b0, .num_bits = 10 }, /* ' ' 177 */
+    { .pattern = 0x3b1, .num_bits = 10 }, /* ' ' 178 */
+    { .pattern = 0x3b2, .num_bits = 10 }, /* ' ' 179 */
+    { .pattern = 0x3b3, .num_bits = 10 }, /* ' ' 180 */
+    { .pattern = 0x3b4, .num_bits = 10 }, /* ' ' 181 */
+    { .pattern = 0x3b5, .num_bits = 10 }, /* ' ' 182 */
+    { .pattern = 0x3b6, .num_bits = 10 }, /* ' ' 183 */
+    { .pattern = 0x3b7, .num_bits = 10 }, /* ' ' 184 */
+    { .pattern = 0x3b8, .num_bits = 10 }, /* ' ' 185 */
+    { .pattern = 0x3b9, .num_bits = 10 }, /* ' ' 186 */
+    { .pattern = 0x3ba, .num_bits = 10 }, /* ' ' 187 */
+    { .pattern = 0x3bb, .num_bits = 10 }, /* ' ' 188 */
+    { .pattern = 0x3bc, .num_bits = 10 }, /* ' ' 189 */
+    { .pattern = 0x3bd, .num_bits = 10 }, /* ' ' 190 */
+    { .pattern = 0x3be, .num_bits = 10 }, /* ' ' 191 */
+    { .pattern = 0x3bf, .num_bits = 10 }, /* ' ' 192 */
+    { .pattern = 0x3c0, .num_bits = 10 }, /* ' ' 193 */
+    { .pattern = 0x3c1, .num_bits = 10 }, /* ' ' 194 */
+    { .pattern = 0x3c2, .num_bits = 10 }, /* ' ' 195 */
+    { .pattern = 0x3c3, .num_bits = 10 }, /* ' ' 196 */
+    { .pattern = 0x3c4, .num_bits = 10 }, /* ' ' 197 */
+    { .pattern = 0x3c5, .num_bits = 10 }, /* ' ' 198 */
+    { .pattern = 0x3c6, .num_bits = 10 }, /* ' ' 199 */
+    { .pattern = 0x3c7, .num_bits = 10 }, /* ' ' 200 */
+    { .pattern = 0x3c8, .num_bits = 10 }, /* ' ' 201 */
+    { .pattern = 0x3c9, .num_bits = 10 }, /* ' ' 202 */
+    { .pattern = 0x3ca, .num_bits = 10 }, /* ' ' 203 */
+    { .pattern = 0x3cb, .num_bits = 10 }, /* ' ' 204 */
+    { .pattern = 0x3cc, .num_bits = 10 }, /* ' ' 205 */
+    { .pattern = 0x3cd, .num_bits = 10 }, /* ' ' 206 */
+    { .pattern = 0x3ce, .num_bits = 10 }, /* ' ' 207 */
+    { .pattern = 0x3cf, .num_bits = 10 }, /* ' ' 208 */
+    { .pattern = 0x3d0, .num_bits = 10 }, /* ' ' 209 */
+    { .pattern = 0x3d1, .num_bits = 10 }, /* ' ' 210 */
+    { .pattern = 0x3d2, .num_bits = 10 }, /* ' ' 211 */
+    { .pattern = 0x3d3, .num_bits = 10 }, /* ' ' 212 */
+    { .pattern = 0x3d4, .num_bits = 10 }, /* ' ' 213 */
+    { .pattern = 0x3d5, .num_bits = 10 }, /* ' ' 214 */
+    { .pattern = 0x3d6, .num_bits = 10 }, /* ' ' 215 */
+    { .pattern = 0x3d7, .num_bits = 10 }, /* ' ' 216 */
+    { .pattern = 0x3d8, .num_bits = 10 }, /* ' ' 217 */
+    { .pattern = 0x3d9, .num_bits = 10 }, /* ' ' 218 */
+    { .pattern = 0x3da, .num_bits = 10 }, /* ' ' 219 */
+    { .pattern = 0x3db, .num_bits = 10 }, /* ' ' 220 */
+    { .pattern = 0x3dc, .num_bits = 10 }, /* ' ' 221 */
+    { .pattern = 0x3dd, .num_bits = 10 }, /* ' ' 222 */
+    { .pattern = 0x3de, .num_bits = 10 }, /* ' ' 223 */
+    { .pattern = 0x3df, .num_bits = 10 }, /* ' ' 224 */
+    { .pattern = 0x3e0, .num_bits = 10 }, /* ' ' 225 */
+    { .pattern = 0x3e1, .num_bits = 10 }, /* ' ' 226 */
+    { .pattern = 0x3e2, .num_bits = 10 }, /* ' ' 227 */
+    { .pattern = 0x3e3, .num_bits = 10 }, /* ' ' 228 */
+    { .pattern = 0x3e4, .num_bits = 10 }, /* ' ' 229 */
+    { .pattern = 0x3e5, .num_bits = 10 }, /* ' ' 230 */
+    { .pattern = 0x3e6, .num_bits = 10 }, /* ' ' 231 */
+    { .pattern = 0x3e7, .num_bits = 10 }, /* ' ' 232 */
+    { .pattern = 0x3e8, .num_bits = 10 }, /* ' ' 233 */
+    { .pattern = 0x3e9, .num_bits = 10 }, /* ' ' 234 */
+    { .pattern = 0x3ea, .num_bits = 10 }, /* ' ' 235 */
+    { .pattern = 0x3eb, .num_bits = 10 }, /* ' ' 236 */
+    { .pattern = 0x3ec, .num_bits = 10 }, /* ' ' 237 */
+    { .pattern = 0x3ed, .num_bits = 10 }, /* ' ' 238 */
+    { .pattern = 0x3ee, .num_bits = 10 }, /* ' ' 239 */
+    { .pattern = 0x3ef, .num_bits = 10 }, /* ' ' 240 */
+    { .pattern = 0x3f0, .num_bits = 10 }, /* ' ' 241 */
+    { .pattern = 0x3f1, .num_bits = 10 }, /* ' ' 242 */
+    { .pattern = 0x3f2, .num_bits = 10 }, /* ' ' 243 */
+    { .pattern = 0x3f3, .num_bits = 10 }, /* ' ' 244 */
+    { .pattern = 0x3f4, .num_bits = 10 }, /* ' ' 245 */
+    { .pattern = 0x3f5, .num_bits = 10 }, /* ' ' 246 */
+    { .pattern = 0x3f6, .num_bits = 10 }, /* ' ' 247 */
+    { .pattern = 0x3f7, .num_bits = 10 }, /* ' ' 248 */
+    { .pattern = 0x3f8, .num_bits = 10 }, /* ' ' 249 */
+    { .pattern = 0x3f9, .num_bits = 10 }, /* ' ' 250 */
+    { .pattern = 0x3fa, .num_bits = 10 }, /* ' ' 251 */
+    { .pattern = 0x3fb, .num_bits = 10 }, /* ' ' 252 */
+    { .pattern = 0x3fc, .num_bits = 10 }, /* ' ' 253 */
+    { .pattern = 0x3fd, .num_bits = 10 }, /* ' ' 254 */
+    { .pattern = 0x3fe, .num_bits = 10 }, /* ' ' 255 */
+};
+
+static struct aws_huffman_code encode_symbol(uint8_t symbol, void *userdata) {
+    (void)userdata;
+
+    return code_points[symbol];
+}
+
+static const uint8_t code_lengths[] = {
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  8, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+     5, 10, 10, 10, 10, 10, 10,  7, 10, 10, 10, 10,  8,  9,  7, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  8,
+    10, 10,  8,  9,  9,  9,  9,  9,  9,  8, 10, 10,  9,  9, 10, 10,
+     9, 10, 10, 10,  8, 10,  9,  8, 10,  9, 10, 10, 10, 10, 10, 10,
+    10,  5,  7,  6,  6,  5,  6,  7,  6,  5,  8,  6,  6,  6,  5,  5,
+     7,  9,  5,  5,  5,  5,  8,  6,  8,  6, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+};
+
+static const struct aws_huffman_decode_entry decode_entries[] = {
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 0 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 1 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 2 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 3 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 4 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 5 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 6 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 7 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 8 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 9 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 10 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 11 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 12 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 13 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 14 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 15 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 16 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 17 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 18 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 19 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 20 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 21 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 22 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 23 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 24 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 25 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 26 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 27 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 28 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 29 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 30 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 31 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 32 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 33 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 34 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 35 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 36 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 37 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 38 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 39 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 40 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 41 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 42 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 43 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 44 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 45 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 46 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 47 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 48 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 49 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 50 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 51 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 52 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 53 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 54 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 55 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 56 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 57 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 58 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 59 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 60 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 61 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 62 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 63 */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 64 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 65 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 66 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 67 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 68 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 69 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 70 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 71 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 72 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 73 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 74 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 75 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 76 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 77 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 78 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 79 ' ' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 80 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 81 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 82 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 83 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 84 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 85 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 86 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 87 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 88 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 89 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 90 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 91 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 92 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 93 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 94 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 95 'a' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 96 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 97 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 98 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 99 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 100 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 101 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 102 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 103 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 104 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 105 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 106 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 107 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 108 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 109 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 110 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 111 'e' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 112 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 113 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 114 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 115 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 116 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 117 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 118 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 119 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 120 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 121 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 122 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 123 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 124 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 125 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 126 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 127 'i' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 128 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 129 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 130 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 131 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 132 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 133 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 134 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 135 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 136 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 137 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 138 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 139 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 140 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 141 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 142 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 143 'n' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 144 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 145 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 146 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 147 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 148 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 149 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 150 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 151 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 152 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 153 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 154 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 155 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 156 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 157 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 158 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 159 'o' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 160 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 161 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 162 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 163 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 164 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 165 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 166 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 167 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 168 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 169 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 170 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 171 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 172 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 173 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 174 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 175 'r' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 176 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 177 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 178 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 179 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 180 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 181 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 182 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 183 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 184 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 185 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 186 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 187 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 188 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 189 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 190 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 191 's' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 192 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 193 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 194 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 195 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 196 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 197 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 198 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 199 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 200 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 201 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 202 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 203 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 204 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 205 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 206 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 207 't' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 208 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 209 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 210 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 211 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 212 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 213 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 214 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 215 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 216 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 217 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 218 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 219 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 220 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 221 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 222 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 223 'u' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 224 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 225 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 226 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 227 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 228 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 229 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 230 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 231 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 232 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 233 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 234 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 235 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 236 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 237 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 238 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 239 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 240 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 241 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 242 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 243 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 244 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 245 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 246 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 247 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 248 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 249 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 250 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 251 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 252 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 253 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 254 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 255 */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 256 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 257 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 258 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 259 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 260 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 261 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 262 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 263 'c' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 264 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 265 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 266 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 267 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 268 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 269 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 270 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 271 'd' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 272 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 273 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 274 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 275 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 276 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 277 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 278 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 279 'f' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 280 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 281 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 282 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 283 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 284 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 285 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 286 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 287 'h' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 288 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 289 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 290 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 291 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 292 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 293 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 294 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 295 'k' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 296 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 297 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 298 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 299 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 300 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 301 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 302 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 303 'l' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 304 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 305 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 306 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 307 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 308 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 309 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 310 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 311 'm' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 312 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 313 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 314 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 315 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 316 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 317 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 318 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 319 'w' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 320 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 321 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 322 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 323 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 324 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 325 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 326 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 327 'y' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 328 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 329 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 330 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 331 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 332 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 333 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 334 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 335 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 336 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 337 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 338 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 339 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 340 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 341 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 342 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 343 */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 344 ''' */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 345 ''' */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 346 ''' */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 347 ''' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 348 '.' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 349 '.' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 350 '.' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 351 '.' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 352 'b' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 353 'b' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 354 'b' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 355 'b' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 356 'g' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 357 'g' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 358 'g' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 359 'g' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 360 'p' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 361 'p' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 362 'p' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 363 'p' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 364 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 365 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 366 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 367 */
+    { .value = 0xa, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 368 */
+    { .value = 0xa, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 369 */
+    { .value = 0x2c, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 370 ',' */
+    { .value = 0x2c, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 371 ',' */
+    { .value = 0x3f, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 372 '?' */
+    { .value = 0x3f, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 373 '?' */
+    { .value = 0x42, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 374 'B' */
+    { .value = 0x42, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 375 'B' */
+    { .value = 0x49, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 376 'I' */
+    { .value = 0x49, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 377 'I' */
+    { .value = 0x54, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 378 'T' */
+    { .value = 0x54, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 379 'T' */
+    { .value = 0x57, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 380 'W' */
+    { .value = 0x57, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 381 'W' */
+    { .value = 0x6a, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 382 'j' */
+    { .value = 0x6a, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 383 'j' */
+    { .value = 0x76, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 384 'v' */
+    { .value = 0x76, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 385 'v' */
+    { .value = 0x78, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 386 'x' */
+    { .value = 0x78, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 387 'x' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 388 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 389 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 390 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 391 */
+    { .value = 0x2d, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 392 '-' */
+    { .value = 0x43, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 393 'C' */
+    { .value = 0x44, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 394 'D' */
+    { .value = 0x45, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 395 'E' */
+    { .value = 0x46, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 396 'F' */
+    { .value = 0x47, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 397 'G' */
+    { .value = 0x48, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 398 'H' */
+    { .value = 0x4c, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 399 'L' */
+    { .value = 0x4d, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 400 'M' */
+    { .value = 0x50, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 401 'P' */
+    { .value = 0x56, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 402 'V' */
+    { .value = 0x59, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 403 'Y' */
+    { .value = 0x71, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 404 'q' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 405 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 406 */
+    { .value = 0x200, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 407 */
+    { .value = 0x202, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 408 */
+    { .value = 0x204, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 409 */
+    { .value = 0x206, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 410 */
+    { .value = 0x208, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 411 */
+    { .value = 0x20a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 412 */
+    { .value = 0x20c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 413 */
+    { .value = 0x20e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 414 */
+    { .value = 0x210, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 415 */
+    { .value = 0x212, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 416 */
+    { .value = 0x214, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 417 */
+    { .value = 0x216, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 418 */
+    { .value = 0x218, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 419 */
+    { .value = 0x21a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 420 */
+    { .value = 0x21c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 421 */
+    { .value = 0x21e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 422 */
+    { .value = 0x220, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 423 */
+    { .value = 0x222, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 424 */
+    { .value = 0x224, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 425 */
+    { .value = 0x226, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 426 */
+    { .value = 0x228, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 427 */
+    { .value = 0x22a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 428 */
+    { .value = 0x22c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 429 */
+    { .value = 0x22e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 430 */
+    { .value = 0x230, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 431 */
+    { .value = 0x232, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 432 */
+    { .value = 0x234, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 433 */
+    { .value = 0x236, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 434 */
+    { .value = 0x238, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 435 */
+    { .value = 0x23a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 436 */
+    { .value = 0x23c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 437 */
+    { .value = 0x23e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 438 */
+    { .value = 0x240, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 439 */
+    { .value = 0x242, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 440 */
+    { .value = 0x244, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 441 */
+    { .value = 0x246, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 442 */
+    { .value = 0x248, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 443 */
+    { .value = 0x24a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 444 */
+    { .value = 0x24c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 445 */
+    { .value = 0x24e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 446 */
+    { .value = 0x250, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 447 */
+    { .value = 0x252, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 448 */
+    { .value = 0x254, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 449 */
+    { .value = 0x256, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 450 */
+    { .value = 0x258, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 451 */
+    { .value = 0x25a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 452 */
+    { .value = 0x25c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 453 */
+    { .value = 0x25e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 454 */
+    { .value = 0x260, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 455 */
+    { .value = 0x262, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 456 */
+    { .value = 0x264, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 457 */
+    { .value = 0x266, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 458 */
+    { .value = 0x268, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 459 */
+    { .value = 0x26a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 460 */
+    { .value = 0x26c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 461 */
+    { .value = 0x26e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 462 */
+    { .value = 0x270, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 463 */
+    { .value = 0x272, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 464 */
+    { .value = 0x274, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 465 */
+    { .value = 0x276, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 466 */
+    { .value = 0x278, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 467 */
+    { .value = 0x27a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 468 */
+    { .value = 0x27c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 469 */
+    { .value = 0x27e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 470 */
+    { .value = 0x280, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 471 */
+    { .value = 0x282, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 472 */
+    { .value = 0x284, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 473 */
+    { .value = 0x286, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 474 */
+    { .value = 0x288, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 475 */
+    { .value = 0x28a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 476 */
+    { .value = 0x28c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 477 */
+    { .value = 0x28e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 478 */
+    { .value = 0x290, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 479 */
+    { .value = 0x292, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 480 */
+    { .value = 0x294, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 481 */
+    { .value = 0x296, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 482 */
+    { .value = 0x298, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 483 */
+    { .value = 0x29a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 484 */
+    { .value = 0x29c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 485 */
+    { .value = 0x29e, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 486 */
+    { .value = 0x2a0, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 487 */
+    { .value = 0x2a2, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 488 */
+    { .value = 0x2a4, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 489 */
+    { .value = 0x2a6, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 490 */
+    { .value = 0x2a8, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 491 */
+    { .value = 0x2aa, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 492 */
+    { .value = 0x2ac, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 493 */
+    { .value = 0x2ae, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 494 */
+    { .value = 0x2b0, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 495 */
+    { .value = 0x2b2, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 496 */
+    { .value = 0x2b4, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 497 */
+    { .value = 0x2b6, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 498 */
+    { .value = 0x2b8, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 499 */
+    { .value = 0x2ba, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 500 */
+    { .value = 0x2bc, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 501 */
+    { .value = 0x2be, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 502 */
+    { .value = 0x2c0, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 503 */
+    { .value = 0x2c2, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 504 */
+    { .value = 0x2c4, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 505 */
+    { .value = 0x2c6, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 506 */
+    { .value = 0x2c8, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 507 */
+    { .value = 0x2ca, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 508 */
+    { .value = 0x2cc, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 509 */
+    { .value = 0x2ce, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 510 */
+    { .value = 0x2d0, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 511 */
+    { .value = 0x0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 512 */
+    { .value = 0x1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 513 */
+    { .value = 0x2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 514 */
+    { .value = 0x3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 515 */
+    { .value = 0x4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 516 */
+    { .value = 0x5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 517 */
+    { .value = 0x6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 518 */
+    { .value = 0x7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 519 */
+    { .value = 0x8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 520 */
+    { .value = 0x9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 521 */
+    { .value = 0xb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 522 */
+    { .value = 0xc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 523 */
+    { .value = 0xd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 524 */
+    { .value = 0xe, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 525 */
+    { .value = 0xf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 526 */
+    { .value = 0x10, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 527 */
+    { .value = 0x11, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 528 */
+    { .value = 0x12, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 529 */
+    { .value = 0x13, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 530 */
+    { .value = 0x14, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 531 */
+    { .value = 0x15, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 532 */
+    { .value = 0x16, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 533 */
+    { .value = 0x17, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 534 */
+    { .value = 0x18, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 535 */
+    { .value = 0x19, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 536 */
+    { .value = 0x1a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 537 */
+    { .value = 0x1b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 538 */
+    { .value = 0x1c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 539 */
+    { .value = 0x1d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 540 */
+    { .value = 0x1e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 541 */
+    { .value = 0x1f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 542 */
+    { .value = 0x21, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 543 '!' */
+    { .value = 0x22, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 544 '"' */
+    { .value = 0x23, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 545 '#' */
+    { .value = 0x24, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 546 '$' */
+    { .value = 0x25, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 547 '%' */
+    { .value = 0x26, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 548 '&' */
+    { .value = 0x28, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 549 '(' */
+    { .value = 0x29, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 550 ')' */
+    { .value = 0x2a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 551 '*' */
+    { .value = 0x2b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 552 '+' */
+    { .value = 0x2f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 553 '/' */
+    { .value = 0x30, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 554 '0' */
+    { .value = 0x31, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 555 '1' */
+    { .value = 0x32, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 556 '2' */
+    { .value = 0x33, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 557 '3' */
+    { .value = 0x34, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 558 '4' */
+    { .value = 0x35, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 559 '5' */
+    { .value = 0x36, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 560 '6' */
+    { .value = 0x37, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 561 '7' */
+    { .value = 0x38, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 562 '8' */
+    { .value = 0x39, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 563 '9' */
+    { .value = 0x3a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 564 ':' */
+    { .value = 0x3b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 565 ';' */
+    { .value = 0x3c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 566 '<' */
+    { .value = 0x3d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 567 '=' */
+    { .value = 0x3e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 568 '>' */
+    { .value = 0x40, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 569 '@' */
+    { .value = 0x41, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 570 'A' */
+    { .value = 0x4a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 571 'J' */
+    { .value = 0x4b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 572 'K' */
+    { .value = 0x4e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 573 'N' */
+    { .value = 0x4f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 574 'O' */
+    { .value = 0x51, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 575 'Q' */
+    { .value = 0x52, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 576 'R' */
+    { .value = 0x53, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 577 'S' */
+    { .value = 0x55, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 578 'U' */
+    { .value = 0x58, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 579 'X' */
+    { .value = 0x5a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 580 'Z' */
+    { .value = 0x5b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 581 '[' */
+    { .value = 0x5c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 582 '\' */
+    { .value = 0x5d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 583 ']' */
+    { .value = 0x5e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 584 '^' */
+    { .value = 0x5f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 585 '_' */
+    { .value = 0x60, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 586 '`' */
+    { .value = 0x7a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 587 'z' */
+    { .value = 0x7b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 588 '{' */
+    { .value = 0x7c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 589 '|' */
+    { .value = 0x7d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 590 '}' */
+    { .value = 0x7e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 591 '~' */
+    { .value = 0x7f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 592 */
+    { .value = 0x80, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 593 */
+    { .value = 0x81, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 594 */
+    { .value = 0x82, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 595 */
+    { .value = 0x83, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 596 */
+    { .value = 0x84, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 597 */
+    { .value = 0x85, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 598 */
+    { .value = 0x86, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 599 */
+    { .value = 0x87, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 600 */
+    { .value = 0x88, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 601 */
+    { .value = 0x89, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 602 */
+    { .value = 0x8a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 603 */
+    { .value = 0x8b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 604 */
+    { .value = 0x8c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 605 */
+    { .value = 0x8d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 606 */
+    { .value = 0x8e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 607 */
+    { .value = 0x8f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 608 */
+    { .value = 0x90, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 609 */
+    { .value = 0x91, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 610 */
+    { .value = 0x92, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 611 */
+    { .value = 0x93, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 612 */
+    { .value = 0x94, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 613 */
+    { .value = 0x95, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 614 */
+    { .value = 0x96, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 615 */
+    { .value = 0x97, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 616 */
+    { .value = 0x98, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 617 */
+    { .value = 0x99, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 618 */
+    { .value = 0x9a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 619 */
+    { .value = 0x9b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 620 */
+    { .value = 0x9c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 621 */
+    { .value = 0x9d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 622 */
+    { .value = 0x9e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 623 */
+    { .value = 0x9f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 624 */
+    { .value = 0xa0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 625 */
+    { .value = 0xa1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 626 */
+    { .value = 0xa2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 627 */
+    { .value = 0xa3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 628 */
+    { .value = 0xa4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 629 */
+    { .value = 0xa5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 630 */
+    { .value = 0xa6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 631 */
+    { .value = 0xa7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 632 */
+    { .value = 0xa8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 633 */
+    { .value = 0xa9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 634 */
+    { .value = 0xaa, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 635 */
+    { .value = 0xab, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 636 */
+    { .value = 0xac, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 637 */
+    { .value = 0xad, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 638 */
+    { .value = 0xae, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 639 */
+    { .value = 0xaf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 640 */
+    { .value = 0xb0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 641 */
+    { .value = 0xb1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 642 */
+    { .value = 0xb2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 643 */
+    { .value = 0xb3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 644 */
+    { .value = 0xb4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 645 */
+    { .value = 0xb5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 646 */
+    { .value = 0xb6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 647 */
+    { .value = 0xb7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 648 */
+    { .value = 0xb8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 649 */
+    { .value = 0xb9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 650 */
+    { .value = 0xba, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 651 */
+    { .value = 0xbb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 652 */
+    { .value = 0xbc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 653 */
+    { .value = 0xbd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 654 */
+    { .value = 0xbe, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 655 */
+    { .value = 0xbf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 656 */
+    { .value = 0xc0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 657 */
+    { .value = 0xc1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 658 */
+    { .value = 0xc2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 659 */
+    { .value = 0xc3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 660 */
+    { .value = 0xc4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 661 */
+    { .value = 0xc5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 662 */
+    { .value = 0xc6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 663 */
+    { .value = 0xc7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 664 */
+    { .value = 0xc8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 665 */
+    { .value = 0xc9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 666 */
+    { .value = 0xca, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 667 */
+    { .value = 0xcb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 668 */
+    { .value = 0xcc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 669 */
+    { .value = 0xcd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 670 */
+    { .value = 0xce, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 671 */
+    { .value = 0xcf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 672 */
+    { .value = 0xd0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 673 */
+    { .value = 0xd1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 674 */
+    { .value = 0xd2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 675 */
+    { .value = 0xd3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 676 */
+    { .value = 0xd4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 677 */
+    { .value = 0xd5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 678 */
+    { .value = 0xd6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 679 */
+    { .value = 0xd7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 680 */
+    { .value = 0xd8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 681 */
+    { .value = 0xd9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 682 */
+    { .value = 0xda, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 683 */
+    { .value = 0xdb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 684 */
+    { .value = 0xdc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 685 */
+    { .value = 0xdd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 686 */
+    { .value = 0xde, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 687 */
+    { .value = 0xdf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 688 */
+    { .value = 0xe0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 689 */
+    { .value = 0xe1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 690 */
+    { .value = 0xe2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 691 */
+    { .value = 0xe3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 692 */
+    { .value = 0xe4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 693 */
+    { .value = 0xe5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 694 */
+    { .value = 0xe6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 695 */
+    { .value = 0xe7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 696 */
+    { .value = 0xe8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 697 */
+    { .value = 0xe9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 698 */
+    { .value = 0xea, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 699 */
+    { .value = 0xeb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 700 */
+    { .value = 0xec, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 701 */
+    { .value = 0xed, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 702 */
+    { .value = 0xee, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 703 */
+    { .value = 0xef, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 704 */
+    { .value = 0xf0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 705 */
+    { .value = 0xf1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 706 */
+    { .value = 0xf2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 707 */
+    { .value = 0xf3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 708 */
+    { .value = 0xf4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 709 */
+    { .value = 0xf5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 710 */
+    { .value = 0xf6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 711 */
+    { .value = 0xf7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 712 */
+    { .value = 0xf8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 713 */
+    { .value = 0xf9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 714 */
+    { .value = 0xfa, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 715 */
+    { .value = 0xfb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 716 */
+    { .value = 0xfc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 717 */
+    { .value = 0xfd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 718 */
+    { .value = 0xfe, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 719 */
+    { .value = 0xff, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 720 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 721 */
+};
+
+static uint8_t decode_symbol(uint32_t bits, uint8_t *symbol, void *userdata) {
+    (void)userdata;
+
+    const struct aws_huffman_decode_entry *entry = &decode_entries[bits >> (32 - 9)];
+    uint8_t consumed = 9;
+    while (entry->type == AWS_HUFFMAN_DECODE_ENTRY_LINK) {
+        const uint8_t sub_bits = entry->num_bits;
+        entry = &decode_entries[entry->value + ((bits << consumed) >> (32 - sub_bits))];
+        consumed += sub_bits;
+    }
+
+    if (entry->type != AWS_HUFFMAN_DECODE_ENTRY_SYMBOL) {
+        return 0;
+    }
+
+    *symbol = (uint8_t)entry->value;
+    return entry->num_bits;
+}
+
+static const struct aws_huffman_decode_table decode_table = {
+    .entries = decode_entries,
+    .root_bits = 9,
+};
+
+static const struct aws_huffman_multi_symbol_entry multi_symbol_entries[] = {
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x10 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x11 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x12 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x13 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x14 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x15 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x16 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x17 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x18 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x19 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x20 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x21 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x22 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x23 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x24 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x25 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x26 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x27 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x28 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x29 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x2a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x2b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x2c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x2d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x2e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x2f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x30 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x31 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x32 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x33 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x34 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x35 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x36 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x37 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x38 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x39 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x3a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x3b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x3c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x3d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x3e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x3f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x40 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x41 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x42 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x43 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x44 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x45 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x46 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x47 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x48 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x49 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x4a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x4b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x4c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x4d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x4e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x4f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x50 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x51 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x52 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x53 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x54 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x55 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x56 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x57 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x58 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x59 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x5a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x5b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x5c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x5d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x5e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x5f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x60 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x61 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x62 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x63 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x64 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x65 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x66 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x67 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x68 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x69 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x6a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x6b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x6c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x6d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x6e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x6f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x70 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x71 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x72 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x73 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x74 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x75 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x76 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x77 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x78 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x79 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x80 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x81 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x82 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x83 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x84 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x85 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x86 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x87 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x88 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x89 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x8a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x8b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x8c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x8d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x8e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x8f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x90 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x91 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x92 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x93 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x94 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x95 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x96 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x97 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x98 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x99 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x9a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x9b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x9c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x9d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x9e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x9f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xac */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xad */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xae */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xba */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xbb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xbc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xbd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xbe */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xbf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xca */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xce */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xd9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xda */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xdb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xdc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xdd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xde */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xdf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xe9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xea */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xeb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xec */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xed */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xee */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xef */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xf9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xfa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xfb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xfc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xfd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xfe */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xff */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x100 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x101 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x102 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x103 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x104 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x105 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x106 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x107 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x108 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x109 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x10a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x10b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x10c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x10d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x10e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x10f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x110 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x111 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x112 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x113 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x114 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x115 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x116 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x117 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x118 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x119 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x11a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x11b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x11c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x11d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x11e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x11f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x120 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x121 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x122 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x123 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x124 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x125 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x126 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x127 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x128 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x129 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x12a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x12b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x12c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x12d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x12e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x12f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x130 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x131 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x132 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x133 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x134 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x135 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x136 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x137 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x138 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x139 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x13a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x13b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x13c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x13d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x13e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x13f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x140 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x141 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x142 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x143 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x144 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x145 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x146 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x147 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x148 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x149 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x14a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x14b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x14c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x14d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x14e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x14f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x150 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x151 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x152 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x153 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x154 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x155 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x156 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x157 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x158 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x159 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x15a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x15b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x15c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x15d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x15e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x15f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x160 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x161 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x162 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x163 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x164 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x165 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x166 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x167 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x168 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x169 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x16a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x16b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x16c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x16d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x16e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x16f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x170 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x171 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x172 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x173 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x174 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x175 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x176 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x177 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x178 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x179 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x17a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x17b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x17c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x17d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x17e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x17f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x180 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x181 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x182 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x183 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x184 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x185 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x186 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x187 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x188 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x189 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x18a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x18b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x18c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x18d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x18e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x18f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x190 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x191 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x192 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x193 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x194 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x195 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x196 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x197 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x198 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x199 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x19a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x19b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x19c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x19d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x19e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x19f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1a9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1aa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ab */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ac */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ad */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ae */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1af */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1b9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ba */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1bb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1bc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1bd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1be */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1bf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1c9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ca */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1cb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1cc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1cd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ce */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1cf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1d9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1da */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1db */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1dc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1dd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1de */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1df */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1e9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ea */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1eb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ec */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ed */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ee */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ef */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1f9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1fa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1fb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1fc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1fd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1fe */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x1ff */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x200 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x201 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x202 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x203 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x204 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x205 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x206 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x207 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x208 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x209 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x20a */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x20b */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x20c */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x20d */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x20e */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x20f */
+    { .symbols = { 0x20, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x210 */
+    { .symbols = { 0x20, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x211 */
+    { .symbols = { 0x20, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x212 */
+    { .symbols = { 0x20, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x213 */
+    { .symbols = { 0x20, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x214 */
+    { .symbols = { 0x20, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x215 */
+    { .symbols = { 0x20, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x216 */
+    { .symbols = { 0x20, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x217 */
+    { .symbols = { 0x20, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x218 */
+    { .symbols = { 0x20, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x219 */
+    { .symbols = { 0x20, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x21a */
+    { .symbols = { 0x20, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x21b */
+    { .symbols = { 0x20, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x21c */
+    { .symbols = { 0x20, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x21d */
+    { .symbols = { 0x20, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x21e */
+    { .symbols = { 0x20, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x21f */
+    { .symbols = { 0x20, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x220 */
+    { .symbols = { 0x20, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x221 */
+    { .symbols = { 0x20, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x222 */
+    { .symbols = { 0x20, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x223 */
+    { .symbols = { 0x20, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x224 */
+    { .symbols = { 0x20, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x225 */
+    { .symbols = { 0x20, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x226 */
+    { .symbols = { 0x20, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x227 */
+    { .symbols = { 0x20, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x228 */
+    { .symbols = { 0x20, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x229 */
+    { .symbols = { 0x20, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x22a */
+    { .symbols = { 0x20, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x22b */
+    { .symbols = { 0x20, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x22c */
+    { .symbols = { 0x20, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x22d */
+    { .symbols = { 0x20, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x22e */
+    { .symbols = { 0x20, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x22f */
+    { .symbols = { 0x20, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x230 */
+    { .symbols = { 0x20, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x231 */
+    { .symbols = { 0x20, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x232 */
+    { .symbols = { 0x20, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x233 */
+    { .symbols = { 0x20, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x234 */
+    { .symbols = { 0x20, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x235 */
+    { .symbols = { 0x20, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x236 */
+    { .symbols = { 0x20, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x237 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x238 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x239 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x23a */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x23b */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x23c */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x23d */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x23e */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x23f */
+    { .symbols = { 0x20, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x240 */
+    { .symbols = { 0x20, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x241 */
+    { .symbols = { 0x20, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x242 */
+    { .symbols = { 0x20, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x243 */
+    { .symbols = { 0x20, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x244 */
+    { .symbols = { 0x20, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x245 */
+    { .symbols = { 0x20, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x246 */
+    { .symbols = { 0x20, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x247 */
+    { .symbols = { 0x20, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x248 */
+    { .symbols = { 0x20, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x249 */
+    { .symbols = { 0x20, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x24a */
+    { .symbols = { 0x20, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x24b */
+    { .symbols = { 0x20, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x24c */
+    { .symbols = { 0x20, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x24d */
+    { .symbols = { 0x20, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x24e */
+    { .symbols = { 0x20, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x24f */
+    { .symbols = { 0x20, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x250 */
+    { .symbols = { 0x20, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x251 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x252 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x253 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x254 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x255 */
+    { .symbols = { 0x20, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x256 */
+    { .symbols = { 0x20, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x257 */
+    { .symbols = { 0x20, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x258 */
+    { .symbols = { 0x20, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x259 */
+    { .symbols = { 0x20, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x25a */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x25b */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x25c */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x25d */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x25e */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x25f */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x260 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x261 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x262 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x263 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x264 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x265 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x266 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x267 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x268 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x269 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x26a */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x26b */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x26c */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x26d */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x26e */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x26f */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x270 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x271 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x272 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x273 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x274 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x275 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x276 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x277 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x278 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x279 */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x27a */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x27b */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x27c */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x27d */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x27e */
+    { .symbols = { 0x20, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x27f */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x280 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x281 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x282 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x283 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x284 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x285 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x286 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x287 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x288 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x289 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x28a */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x28b */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x28c */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x28d */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x28e */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x28f */
+    { .symbols = { 0x61, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x290 */
+    { .symbols = { 0x61, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x291 */
+    { .symbols = { 0x61, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x292 */
+    { .symbols = { 0x61, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x293 */
+    { .symbols = { 0x61, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x294 */
+    { .symbols = { 0x61, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x295 */
+    { .symbols = { 0x61, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x296 */
+    { .symbols = { 0x61, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x297 */
+    { .symbols = { 0x61, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x298 */
+    { .symbols = { 0x61, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x299 */
+    { .symbols = { 0x61, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x29a */
+    { .symbols = { 0x61, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x29b */
+    { .symbols = { 0x61, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x29c */
+    { .symbols = { 0x61, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x29d */
+    { .symbols = { 0x61, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x29e */
+    { .symbols = { 0x61, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x29f */
+    { .symbols = { 0x61, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a0 */
+    { .symbols = { 0x61, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a1 */
+    { .symbols = { 0x61, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a2 */
+    { .symbols = { 0x61, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a3 */
+    { .symbols = { 0x61, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a4 */
+    { .symbols = { 0x61, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a5 */
+    { .symbols = { 0x61, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a6 */
+    { .symbols = { 0x61, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a7 */
+    { .symbols = { 0x61, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a8 */
+    { .symbols = { 0x61, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2a9 */
+    { .symbols = { 0x61, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2aa */
+    { .symbols = { 0x61, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2ab */
+    { .symbols = { 0x61, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2ac */
+    { .symbols = { 0x61, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2ad */
+    { .symbols = { 0x61, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2ae */
+    { .symbols = { 0x61, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2af */
+    { .symbols = { 0x61, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2b0 */
+    { .symbols = { 0x61, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2b1 */
+    { .symbols = { 0x61, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2b2 */
+    { .symbols = { 0x61, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2b3 */
+    { .symbols = { 0x61, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2b4 */
+    { .symbols = { 0x61, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2b5 */
+    { .symbols = { 0x61, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2b6 */
+    { .symbols = { 0x61, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x2b7 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2b8 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2b9 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2ba */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2bb */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2bc */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2bd */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2be */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2bf */
+    { .symbols = { 0x61, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c0 */
+    { .symbols = { 0x61, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c1 */
+    { .symbols = { 0x61, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c2 */
+    { .symbols = { 0x61, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c3 */
+    { .symbols = { 0x61, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c4 */
+    { .symbols = { 0x61, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c5 */
+    { .symbols = { 0x61, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c6 */
+    { .symbols = { 0x61, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c7 */
+    { .symbols = { 0x61, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c8 */
+    { .symbols = { 0x61, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2c9 */
+    { .symbols = { 0x61, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2ca */
+    { .symbols = { 0x61, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2cb */
+    { .symbols = { 0x61, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2cc */
+    { .symbols = { 0x61, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2cd */
+    { .symbols = { 0x61, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2ce */
+    { .symbols = { 0x61, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2cf */
+    { .symbols = { 0x61, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2d0 */
+    { .symbols = { 0x61, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x2d1 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2d2 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2d3 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2d4 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2d5 */
+    { .symbols = { 0x61, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x2d6 */
+    { .symbols = { 0x61, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x2d7 */
+    { .symbols = { 0x61, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x2d8 */
+    { .symbols = { 0x61, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x2d9 */
+    { .symbols = { 0x61, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x2da */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2db */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2dc */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2dd */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2de */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2df */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e0 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e1 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e2 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e3 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e4 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e5 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e6 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e7 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e8 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2e9 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2ea */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2eb */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2ec */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2ed */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2ee */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2ef */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f0 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f1 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f2 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f3 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f4 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f5 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f6 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f7 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f8 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2f9 */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2fa */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2fb */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2fc */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2fd */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2fe */
+    { .symbols = { 0x61, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x2ff */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x300 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x301 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x302 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x303 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x304 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x305 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x306 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x307 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x308 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x309 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x30a */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x30b */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x30c */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x30d */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x30e */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x30f */
+    { .symbols = { 0x65, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x310 */
+    { .symbols = { 0x65, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x311 */
+    { .symbols = { 0x65, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x312 */
+    { .symbols = { 0x65, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x313 */
+    { .symbols = { 0x65, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x314 */
+    { .symbols = { 0x65, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x315 */
+    { .symbols = { 0x65, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x316 */
+    { .symbols = { 0x65, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x317 */
+    { .symbols = { 0x65, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x318 */
+    { .symbols = { 0x65, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x319 */
+    { .symbols = { 0x65, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x31a */
+    { .symbols = { 0x65, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x31b */
+    { .symbols = { 0x65, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x31c */
+    { .symbols = { 0x65, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x31d */
+    { .symbols = { 0x65, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x31e */
+    { .symbols = { 0x65, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x31f */
+    { .symbols = { 0x65, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x320 */
+    { .symbols = { 0x65, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x321 */
+    { .symbols = { 0x65, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x322 */
+    { .symbols = { 0x65, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x323 */
+    { .symbols = { 0x65, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x324 */
+    { .symbols = { 0x65, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x325 */
+    { .symbols = { 0x65, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x326 */
+    { .symbols = { 0x65, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x327 */
+    { .symbols = { 0x65, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x328 */
+    { .symbols = { 0x65, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x329 */
+    { .symbols = { 0x65, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x32a */
+    { .symbols = { 0x65, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x32b */
+    { .symbols = { 0x65, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x32c */
+    { .symbols = { 0x65, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x32d */
+    { .symbols = { 0x65, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x32e */
+    { .symbols = { 0x65, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x32f */
+    { .symbols = { 0x65, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x330 */
+    { .symbols = { 0x65, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x331 */
+    { .symbols = { 0x65, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x332 */
+    { .symbols = { 0x65, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x333 */
+    { .symbols = { 0x65, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x334 */
+    { .symbols = { 0x65, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x335 */
+    { .symbols = { 0x65, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x336 */
+    { .symbols = { 0x65, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x337 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x338 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x339 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x33a */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x33b */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x33c */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x33d */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x33e */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x33f */
+    { .symbols = { 0x65, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x340 */
+    { .symbols = { 0x65, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x341 */
+    { .symbols = { 0x65, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x342 */
+    { .symbols = { 0x65, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x343 */
+    { .symbols = { 0x65, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x344 */
+    { .symbols = { 0x65, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x345 */
+    { .symbols = { 0x65, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x346 */
+    { .symbols = { 0x65, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x347 */
+    { .symbols = { 0x65, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x348 */
+    { .symbols = { 0x65, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x349 */
+    { .symbols = { 0x65, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x34a */
+    { .symbols = { 0x65, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x34b */
+    { .symbols = { 0x65, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x34c */
+    { .symbols = { 0x65, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x34d */
+    { .symbols = { 0x65, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x34e */
+    { .symbols = { 0x65, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x34f */
+    { .symbols = { 0x65, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x350 */
+    { .symbols = { 0x65, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x351 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x352 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x353 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x354 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x355 */
+    { .symbols = { 0x65, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x356 */
+    { .symbols = { 0x65, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x357 */
+    { .symbols = { 0x65, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x358 */
+    { .symbols = { 0x65, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x359 */
+    { .symbols = { 0x65, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x35a */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x35b */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x35c */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x35d */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x35e */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x35f */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x360 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x361 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x362 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x363 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x364 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x365 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x366 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x367 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x368 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x369 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x36a */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x36b */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x36c */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x36d */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x36e */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x36f */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x370 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x371 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x372 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x373 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x374 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x375 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x376 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x377 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x378 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x379 */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x37a */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x37b */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x37c */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x37d */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x37e */
+    { .symbols = { 0x65, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x37f */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x380 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x381 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x382 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x383 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x384 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x385 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x386 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x387 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x388 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x389 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x38a */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x38b */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x38c */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x38d */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x38e */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x38f */
+    { .symbols = { 0x69, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x390 */
+    { .symbols = { 0x69, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x391 */
+    { .symbols = { 0x69, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x392 */
+    { .symbols = { 0x69, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x393 */
+    { .symbols = { 0x69, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x394 */
+    { .symbols = { 0x69, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x395 */
+    { .symbols = { 0x69, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x396 */
+    { .symbols = { 0x69, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x397 */
+    { .symbols = { 0x69, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x398 */
+    { .symbols = { 0x69, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x399 */
+    { .symbols = { 0x69, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x39a */
+    { .symbols = { 0x69, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x39b */
+    { .symbols = { 0x69, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x39c */
+    { .symbols = { 0x69, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x39d */
+    { .symbols = { 0x69, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x39e */
+    { .symbols = { 0x69, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x39f */
+    { .symbols = { 0x69, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a0 */
+    { .symbols = { 0x69, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a1 */
+    { .symbols = { 0x69, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a2 */
+    { .symbols = { 0x69, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a3 */
+    { .symbols = { 0x69, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a4 */
+    { .symbols = { 0x69, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a5 */
+    { .symbols = { 0x69, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a6 */
+    { .symbols = { 0x69, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a7 */
+    { .symbols = { 0x69, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a8 */
+    { .symbols = { 0x69, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3a9 */
+    { .symbols = { 0x69, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3aa */
+    { .symbols = { 0x69, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3ab */
+    { .symbols = { 0x69, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3ac */
+    { .symbols = { 0x69, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3ad */
+    { .symbols = { 0x69, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3ae */
+    { .symbols = { 0x69, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3af */
+    { .symbols = { 0x69, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3b0 */
+    { .symbols = { 0x69, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3b1 */
+    { .symbols = { 0x69, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3b2 */
+    { .symbols = { 0x69, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3b3 */
+    { .symbols = { 0x69, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3b4 */
+    { .symbols = { 0x69, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3b5 */
+    { .symbols = { 0x69, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3b6 */
+    { .symbols = { 0x69, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x3b7 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3b8 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3b9 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3ba */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3bb */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3bc */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3bd */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3be */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3bf */
+    { .symbols = { 0x69, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c0 */
+    { .symbols = { 0x69, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c1 */
+    { .symbols = { 0x69, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c2 */
+    { .symbols = { 0x69, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c3 */
+    { .symbols = { 0x69, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c4 */
+    { .symbols = { 0x69, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c5 */
+    { .symbols = { 0x69, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c6 */
+    { .symbols = { 0x69, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c7 */
+    { .symbols = { 0x69, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c8 */
+    { .symbols = { 0x69, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3c9 */
+    { .symbols = { 0x69, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3ca */
+    { .symbols = { 0x69, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3cb */
+    { .symbols = { 0x69, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3cc */
+    { .symbols = { 0x69, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3cd */
+    { .symbols = { 0x69, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3ce */
+    { .symbols = { 0x69, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3cf */
+    { .symbols = { 0x69, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3d0 */
+    { .symbols = { 0x69, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x3d1 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3d2 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3d3 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3d4 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3d5 */
+    { .symbols = { 0x69, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x3d6 */
+    { .symbols = { 0x69, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x3d7 */
+    { .symbols = { 0x69, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x3d8 */
+    { .symbols = { 0x69, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x3d9 */
+    { .symbols = { 0x69, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x3da */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3db */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3dc */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3dd */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3de */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3df */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e0 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e1 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e2 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e3 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e4 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e5 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e6 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e7 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e8 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3e9 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3ea */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3eb */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3ec */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3ed */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3ee */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3ef */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f0 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f1 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f2 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f3 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f4 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f5 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f6 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f7 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f8 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3f9 */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3fa */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3fb */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3fc */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3fd */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3fe */
+    { .symbols = { 0x69, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x3ff */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x400 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x401 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x402 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x403 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x404 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x405 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x406 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x407 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x408 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x409 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x40a */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x40b */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x40c */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x40d */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x40e */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x40f */
+    { .symbols = { 0x6e, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x410 */
+    { .symbols = { 0x6e, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x411 */
+    { .symbols = { 0x6e, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x412 */
+    { .symbols = { 0x6e, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x413 */
+    { .symbols = { 0x6e, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x414 */
+    { .symbols = { 0x6e, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x415 */
+    { .symbols = { 0x6e, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x416 */
+    { .symbols = { 0x6e, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x417 */
+    { .symbols = { 0x6e, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x418 */
+    { .symbols = { 0x6e, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x419 */
+    { .symbols = { 0x6e, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x41a */
+    { .symbols = { 0x6e, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x41b */
+    { .symbols = { 0x6e, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x41c */
+    { .symbols = { 0x6e, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x41d */
+    { .symbols = { 0x6e, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x41e */
+    { .symbols = { 0x6e, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x41f */
+    { .symbols = { 0x6e, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x420 */
+    { .symbols = { 0x6e, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x421 */
+    { .symbols = { 0x6e, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x422 */
+    { .symbols = { 0x6e, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x423 */
+    { .symbols = { 0x6e, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x424 */
+    { .symbols = { 0x6e, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x425 */
+    { .symbols = { 0x6e, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x426 */
+    { .symbols = { 0x6e, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x427 */
+    { .symbols = { 0x6e, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x428 */
+    { .symbols = { 0x6e, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x429 */
+    { .symbols = { 0x6e, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x42a */
+    { .symbols = { 0x6e, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x42b */
+    { .symbols = { 0x6e, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x42c */
+    { .symbols = { 0x6e, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x42d */
+    { .symbols = { 0x6e, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x42e */
+    { .symbols = { 0x6e, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x42f */
+    { .symbols = { 0x6e, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x430 */
+    { .symbols = { 0x6e, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x431 */
+    { .symbols = { 0x6e, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x432 */
+    { .symbols = { 0x6e, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x433 */
+    { .symbols = { 0x6e, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x434 */
+    { .symbols = { 0x6e, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x435 */
+    { .symbols = { 0x6e, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x436 */
+    { .symbols = { 0x6e, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x437 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x438 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x439 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x43a */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x43b */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x43c */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x43d */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x43e */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x43f */
+    { .symbols = { 0x6e, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x440 */
+    { .symbols = { 0x6e, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x441 */
+    { .symbols = { 0x6e, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x442 */
+    { .symbols = { 0x6e, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x443 */
+    { .symbols = { 0x6e, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x444 */
+    { .symbols = { 0x6e, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x445 */
+    { .symbols = { 0x6e, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x446 */
+    { .symbols = { 0x6e, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x447 */
+    { .symbols = { 0x6e, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x448 */
+    { .symbols = { 0x6e, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x449 */
+    { .symbols = { 0x6e, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x44a */
+    { .symbols = { 0x6e, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x44b */
+    { .symbols = { 0x6e, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x44c */
+    { .symbols = { 0x6e, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x44d */
+    { .symbols = { 0x6e, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x44e */
+    { .symbols = { 0x6e, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x44f */
+    { .symbols = { 0x6e, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x450 */
+    { .symbols = { 0x6e, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x451 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x452 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x453 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x454 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x455 */
+    { .symbols = { 0x6e, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x456 */
+    { .symbols = { 0x6e, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x457 */
+    { .symbols = { 0x6e, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x458 */
+    { .symbols = { 0x6e, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x459 */
+    { .symbols = { 0x6e, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x45a */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x45b */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x45c */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x45d */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x45e */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x45f */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x460 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x461 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x462 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x463 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x464 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x465 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x466 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x467 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x468 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x469 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x46a */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x46b */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x46c */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x46d */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x46e */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x46f */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x470 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x471 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x472 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x473 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x474 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x475 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x476 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x477 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x478 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x479 */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x47a */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x47b */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x47c */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x47d */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x47e */
+    { .symbols = { 0x6e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x47f */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x480 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x481 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x482 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x483 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x484 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x485 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x486 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x487 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x488 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x489 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x48a */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x48b */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x48c */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x48d */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x48e */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x48f */
+    { .symbols = { 0x6f, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x490 */
+    { .symbols = { 0x6f, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x491 */
+    { .symbols = { 0x6f, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x492 */
+    { .symbols = { 0x6f, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x493 */
+    { .symbols = { 0x6f, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x494 */
+    { .symbols = { 0x6f, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x495 */
+    { .symbols = { 0x6f, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x496 */
+    { .symbols = { 0x6f, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x497 */
+    { .symbols = { 0x6f, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x498 */
+    { .symbols = { 0x6f, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x499 */
+    { .symbols = { 0x6f, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x49a */
+    { .symbols = { 0x6f, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x49b */
+    { .symbols = { 0x6f, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x49c */
+    { .symbols = { 0x6f, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x49d */
+    { .symbols = { 0x6f, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x49e */
+    { .symbols = { 0x6f, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x49f */
+    { .symbols = { 0x6f, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a0 */
+    { .symbols = { 0x6f, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a1 */
+    { .symbols = { 0x6f, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a2 */
+    { .symbols = { 0x6f, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a3 */
+    { .symbols = { 0x6f, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a4 */
+    { .symbols = { 0x6f, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a5 */
+    { .symbols = { 0x6f, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a6 */
+    { .symbols = { 0x6f, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a7 */
+    { .symbols = { 0x6f, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a8 */
+    { .symbols = { 0x6f, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4a9 */
+    { .symbols = { 0x6f, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4aa */
+    { .symbols = { 0x6f, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4ab */
+    { .symbols = { 0x6f, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4ac */
+    { .symbols = { 0x6f, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4ad */
+    { .symbols = { 0x6f, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4ae */
+    { .symbols = { 0x6f, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4af */
+    { .symbols = { 0x6f, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4b0 */
+    { .symbols = { 0x6f, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4b1 */
+    { .symbols = { 0x6f, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4b2 */
+    { .symbols = { 0x6f, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4b3 */
+    { .symbols = { 0x6f, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4b4 */
+    { .symbols = { 0x6f, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4b5 */
+    { .symbols = { 0x6f, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4b6 */
+    { .symbols = { 0x6f, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x4b7 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4b8 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4b9 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4ba */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4bb */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4bc */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4bd */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4be */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4bf */
+    { .symbols = { 0x6f, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c0 */
+    { .symbols = { 0x6f, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c1 */
+    { .symbols = { 0x6f, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c2 */
+    { .symbols = { 0x6f, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c3 */
+    { .symbols = { 0x6f, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c4 */
+    { .symbols = { 0x6f, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c5 */
+    { .symbols = { 0x6f, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c6 */
+    { .symbols = { 0x6f, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c7 */
+    { .symbols = { 0x6f, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c8 */
+    { .symbols = { 0x6f, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4c9 */
+    { .symbols = { 0x6f, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4ca */
+    { .symbols = { 0x6f, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4cb */
+    { .symbols = { 0x6f, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4cc */
+    { .symbols = { 0x6f, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4cd */
+    { .symbols = { 0x6f, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4ce */
+    { .symbols = { 0x6f, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4cf */
+    { .symbols = { 0x6f, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4d0 */
+    { .symbols = { 0x6f, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x4d1 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4d2 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4d3 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4d4 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4d5 */
+    { .symbols = { 0x6f, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x4d6 */
+    { .symbols = { 0x6f, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x4d7 */
+    { .symbols = { 0x6f, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x4d8 */
+    { .symbols = { 0x6f, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x4d9 */
+    { .symbols = { 0x6f, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x4da */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4db */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4dc */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4dd */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4de */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4df */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e0 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e1 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e2 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e3 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e4 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e5 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e6 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e7 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e8 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4e9 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4ea */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4eb */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4ec */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4ed */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4ee */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4ef */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f0 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f1 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f2 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f3 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f4 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f5 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f6 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f7 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f8 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4f9 */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4fa */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4fb */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4fc */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4fd */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4fe */
+    { .symbols = { 0x6f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x4ff */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x500 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x501 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x502 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x503 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x504 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x505 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x506 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x507 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x508 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x509 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x50a */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x50b */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x50c */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x50d */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x50e */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x50f */
+    { .symbols = { 0x72, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x510 */
+    { .symbols = { 0x72, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x511 */
+    { .symbols = { 0x72, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x512 */
+    { .symbols = { 0x72, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x513 */
+    { .symbols = { 0x72, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x514 */
+    { .symbols = { 0x72, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x515 */
+    { .symbols = { 0x72, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x516 */
+    { .symbols = { 0x72, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x517 */
+    { .symbols = { 0x72, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x518 */
+    { .symbols = { 0x72, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x519 */
+    { .symbols = { 0x72, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x51a */
+    { .symbols = { 0x72, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x51b */
+    { .symbols = { 0x72, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x51c */
+    { .symbols = { 0x72, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x51d */
+    { .symbols = { 0x72, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x51e */
+    { .symbols = { 0x72, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x51f */
+    { .symbols = { 0x72, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x520 */
+    { .symbols = { 0x72, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x521 */
+    { .symbols = { 0x72, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x522 */
+    { .symbols = { 0x72, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x523 */
+    { .symbols = { 0x72, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x524 */
+    { .symbols = { 0x72, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x525 */
+    { .symbols = { 0x72, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x526 */
+    { .symbols = { 0x72, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x527 */
+    { .symbols = { 0x72, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x528 */
+    { .symbols = { 0x72, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x529 */
+    { .symbols = { 0x72, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x52a */
+    { .symbols = { 0x72, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x52b */
+    { .symbols = { 0x72, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x52c */
+    { .symbols = { 0x72, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x52d */
+    { .symbols = { 0x72, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x52e */
+    { .symbols = { 0x72, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x52f */
+    { .symbols = { 0x72, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x530 */
+    { .symbols = { 0x72, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x531 */
+    { .symbols = { 0x72, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x532 */
+    { .symbols = { 0x72, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x533 */
+    { .symbols = { 0x72, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x534 */
+    { .symbols = { 0x72, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x535 */
+    { .symbols = { 0x72, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x536 */
+    { .symbols = { 0x72, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x537 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x538 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x539 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x53a */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x53b */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x53c */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x53d */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x53e */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x53f */
+    { .symbols = { 0x72, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x540 */
+    { .symbols = { 0x72, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x541 */
+    { .symbols = { 0x72, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x542 */
+    { .symbols = { 0x72, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x543 */
+    { .symbols = { 0x72, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x544 */
+    { .symbols = { 0x72, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x545 */
+    { .symbols = { 0x72, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x546 */
+    { .symbols = { 0x72, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x547 */
+    { .symbols = { 0x72, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x548 */
+    { .symbols = { 0x72, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x549 */
+    { .symbols = { 0x72, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x54a */
+    { .symbols = { 0x72, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x54b */
+    { .symbols = { 0x72, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x54c */
+    { .symbols = { 0x72, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x54d */
+    { .symbols = { 0x72, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x54e */
+    { .symbols = { 0x72, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x54f */
+    { .symbols = { 0x72, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x550 */
+    { .symbols = { 0x72, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x551 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x552 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x553 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x554 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x555 */
+    { .symbols = { 0x72, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x556 */
+    { .symbols = { 0x72, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x557 */
+    { .symbols = { 0x72, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x558 */
+    { .symbols = { 0x72, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x559 */
+    { .symbols = { 0x72, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x55a */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x55b */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x55c */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x55d */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x55e */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x55f */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x560 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x561 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x562 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x563 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x564 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x565 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x566 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x567 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x568 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x569 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x56a */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x56b */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x56c */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x56d */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x56e */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x56f */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x570 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x571 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x572 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x573 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x574 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x575 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x576 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x577 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x578 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x579 */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x57a */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x57b */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x57c */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x57d */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x57e */
+    { .symbols = { 0x72, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x57f */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x580 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x581 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x582 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x583 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x584 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x585 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x586 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x587 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x588 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x589 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x58a */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x58b */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x58c */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x58d */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x58e */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x58f */
+    { .symbols = { 0x73, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x590 */
+    { .symbols = { 0x73, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x591 */
+    { .symbols = { 0x73, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x592 */
+    { .symbols = { 0x73, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x593 */
+    { .symbols = { 0x73, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x594 */
+    { .symbols = { 0x73, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x595 */
+    { .symbols = { 0x73, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x596 */
+    { .symbols = { 0x73, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x597 */
+    { .symbols = { 0x73, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x598 */
+    { .symbols = { 0x73, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x599 */
+    { .symbols = { 0x73, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x59a */
+    { .symbols = { 0x73, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x59b */
+    { .symbols = { 0x73, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x59c */
+    { .symbols = { 0x73, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x59d */
+    { .symbols = { 0x73, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x59e */
+    { .symbols = { 0x73, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x59f */
+    { .symbols = { 0x73, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a0 */
+    { .symbols = { 0x73, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a1 */
+    { .symbols = { 0x73, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a2 */
+    { .symbols = { 0x73, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a3 */
+    { .symbols = { 0x73, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a4 */
+    { .symbols = { 0x73, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a5 */
+    { .symbols = { 0x73, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a6 */
+    { .symbols = { 0x73, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a7 */
+    { .symbols = { 0x73, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a8 */
+    { .symbols = { 0x73, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5a9 */
+    { .symbols = { 0x73, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5aa */
+    { .symbols = { 0x73, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5ab */
+    { .symbols = { 0x73, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5ac */
+    { .symbols = { 0x73, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5ad */
+    { .symbols = { 0x73, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5ae */
+    { .symbols = { 0x73, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5af */
+    { .symbols = { 0x73, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5b0 */
+    { .symbols = { 0x73, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5b1 */
+    { .symbols = { 0x73, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5b2 */
+    { .symbols = { 0x73, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5b3 */
+    { .symbols = { 0x73, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5b4 */
+    { .symbols = { 0x73, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5b5 */
+    { .symbols = { 0x73, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5b6 */
+    { .symbols = { 0x73, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x5b7 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5b8 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5b9 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5ba */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5bb */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5bc */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5bd */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5be */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5bf */
+    { .symbols = { 0x73, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c0 */
+    { .symbols = { 0x73, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c1 */
+    { .symbols = { 0x73, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c2 */
+    { .symbols = { 0x73, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c3 */
+    { .symbols = { 0x73, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c4 */
+    { .symbols = { 0x73, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c5 */
+    { .symbols = { 0x73, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c6 */
+    { .symbols = { 0x73, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c7 */
+    { .symbols = { 0x73, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c8 */
+    { .symbols = { 0x73, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5c9 */
+    { .symbols = { 0x73, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5ca */
+    { .symbols = { 0x73, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5cb */
+    { .symbols = { 0x73, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5cc */
+    { .symbols = { 0x73, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5cd */
+    { .symbols = { 0x73, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5ce */
+    { .symbols = { 0x73, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5cf */
+    { .symbols = { 0x73, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5d0 */
+    { .symbols = { 0x73, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x5d1 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5d2 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5d3 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5d4 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5d5 */
+    { .symbols = { 0x73, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x5d6 */
+    { .symbols = { 0x73, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x5d7 */
+    { .symbols = { 0x73, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x5d8 */
+    { .symbols = { 0x73, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x5d9 */
+    { .symbols = { 0x73, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x5da */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5db */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5dc */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5dd */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5de */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5df */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e0 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e1 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e2 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e3 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e4 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e5 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e6 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e7 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e8 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5e9 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5ea */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5eb */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5ec */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5ed */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5ee */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5ef */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f0 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f1 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f2 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f3 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f4 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f5 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f6 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f7 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f8 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5f9 */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5fa */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5fb */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5fc */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5fd */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5fe */
+    { .symbols = { 0x73, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x5ff */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x600 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x601 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x602 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x603 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x604 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x605 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x606 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x607 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x608 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x609 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x60a */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x60b */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x60c */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x60d */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x60e */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x60f */
+    { .symbols = { 0x74, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x610 */
+    { .symbols = { 0x74, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x611 */
+    { .symbols = { 0x74, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x612 */
+    { .symbols = { 0x74, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x613 */
+    { .symbols = { 0x74, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x614 */
+    { .symbols = { 0x74, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x615 */
+    { .symbols = { 0x74, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x616 */
+    { .symbols = { 0x74, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x617 */
+    { .symbols = { 0x74, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x618 */
+    { .symbols = { 0x74, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x619 */
+    { .symbols = { 0x74, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x61a */
+    { .symbols = { 0x74, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x61b */
+    { .symbols = { 0x74, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x61c */
+    { .symbols = { 0x74, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x61d */
+    { .symbols = { 0x74, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x61e */
+    { .symbols = { 0x74, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x61f */
+    { .symbols = { 0x74, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x620 */
+    { .symbols = { 0x74, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x621 */
+    { .symbols = { 0x74, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x622 */
+    { .symbols = { 0x74, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x623 */
+    { .symbols = { 0x74, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x624 */
+    { .symbols = { 0x74, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x625 */
+    { .symbols = { 0x74, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x626 */
+    { .symbols = { 0x74, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x627 */
+    { .symbols = { 0x74, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x628 */
+    { .symbols = { 0x74, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x629 */
+    { .symbols = { 0x74, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x62a */
+    { .symbols = { 0x74, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x62b */
+    { .symbols = { 0x74, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x62c */
+    { .symbols = { 0x74, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x62d */
+    { .symbols = { 0x74, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x62e */
+    { .symbols = { 0x74, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x62f */
+    { .symbols = { 0x74, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x630 */
+    { .symbols = { 0x74, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x631 */
+    { .symbols = { 0x74, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x632 */
+    { .symbols = { 0x74, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x633 */
+    { .symbols = { 0x74, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x634 */
+    { .symbols = { 0x74, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x635 */
+    { .symbols = { 0x74, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x636 */
+    { .symbols = { 0x74, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x637 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x638 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x639 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x63a */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x63b */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x63c */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x63d */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x63e */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x63f */
+    { .symbols = { 0x74, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x640 */
+    { .symbols = { 0x74, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x641 */
+    { .symbols = { 0x74, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x642 */
+    { .symbols = { 0x74, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x643 */
+    { .symbols = { 0x74, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x644 */
+    { .symbols = { 0x74, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x645 */
+    { .symbols = { 0x74, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x646 */
+    { .symbols = { 0x74, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x647 */
+    { .symbols = { 0x74, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x648 */
+    { .symbols = { 0x74, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x649 */
+    { .symbols = { 0x74, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x64a */
+    { .symbols = { 0x74, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x64b */
+    { .symbols = { 0x74, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x64c */
+    { .symbols = { 0x74, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x64d */
+    { .symbols = { 0x74, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x64e */
+    { .symbols = { 0x74, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x64f */
+    { .symbols = { 0x74, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x650 */
+    { .symbols = { 0x74, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x651 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x652 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x653 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x654 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x655 */
+    { .symbols = { 0x74, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x656 */
+    { .symbols = { 0x74, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x657 */
+    { .symbols = { 0x74, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x658 */
+    { .symbols = { 0x74, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x659 */
+    { .symbols = { 0x74, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x65a */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x65b */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x65c */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x65d */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x65e */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x65f */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x660 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x661 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x662 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x663 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x664 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x665 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x666 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x667 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x668 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x669 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x66a */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x66b */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x66c */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x66d */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x66e */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x66f */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x670 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x671 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x672 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x673 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x674 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x675 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x676 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x677 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x678 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x679 */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x67a */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x67b */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x67c */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x67d */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x67e */
+    { .symbols = { 0x74, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x67f */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x680 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x681 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x682 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x683 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x684 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x685 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x686 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x687 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x688 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x689 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x68a */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x68b */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x68c */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x68d */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x68e */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x68f */
+    { .symbols = { 0x75, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x690 */
+    { .symbols = { 0x75, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x691 */
+    { .symbols = { 0x75, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x692 */
+    { .symbols = { 0x75, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x693 */
+    { .symbols = { 0x75, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x694 */
+    { .symbols = { 0x75, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x695 */
+    { .symbols = { 0x75, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x696 */
+    { .symbols = { 0x75, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x697 */
+    { .symbols = { 0x75, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x698 */
+    { .symbols = { 0x75, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x699 */
+    { .symbols = { 0x75, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x69a */
+    { .symbols = { 0x75, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x69b */
+    { .symbols = { 0x75, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x69c */
+    { .symbols = { 0x75, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x69d */
+    { .symbols = { 0x75, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x69e */
+    { .symbols = { 0x75, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x69f */
+    { .symbols = { 0x75, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a0 */
+    { .symbols = { 0x75, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a1 */
+    { .symbols = { 0x75, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a2 */
+    { .symbols = { 0x75, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a3 */
+    { .symbols = { 0x75, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a4 */
+    { .symbols = { 0x75, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a5 */
+    { .symbols = { 0x75, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a6 */
+    { .symbols = { 0x75, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a7 */
+    { .symbols = { 0x75, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a8 */
+    { .symbols = { 0x75, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6a9 */
+    { .symbols = { 0x75, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6aa */
+    { .symbols = { 0x75, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6ab */
+    { .symbols = { 0x75, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6ac */
+    { .symbols = { 0x75, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6ad */
+    { .symbols = { 0x75, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6ae */
+    { .symbols = { 0x75, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6af */
+    { .symbols = { 0x75, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6b0 */
+    { .symbols = { 0x75, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6b1 */
+    { .symbols = { 0x75, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6b2 */
+    { .symbols = { 0x75, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6b3 */
+    { .symbols = { 0x75, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6b4 */
+    { .symbols = { 0x75, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6b5 */
+    { .symbols = { 0x75, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6b6 */
+    { .symbols = { 0x75, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 10 }, /* 0x6b7 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6b8 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6b9 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6ba */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6bb */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6bc */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6bd */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6be */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6bf */
+    { .symbols = { 0x75, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c0 */
+    { .symbols = { 0x75, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c1 */
+    { .symbols = { 0x75, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c2 */
+    { .symbols = { 0x75, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c3 */
+    { .symbols = { 0x75, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c4 */
+    { .symbols = { 0x75, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c5 */
+    { .symbols = { 0x75, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c6 */
+    { .symbols = { 0x75, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c7 */
+    { .symbols = { 0x75, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c8 */
+    { .symbols = { 0x75, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6c9 */
+    { .symbols = { 0x75, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6ca */
+    { .symbols = { 0x75, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6cb */
+    { .symbols = { 0x75, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6cc */
+    { .symbols = { 0x75, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6cd */
+    { .symbols = { 0x75, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6ce */
+    { .symbols = { 0x75, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6cf */
+    { .symbols = { 0x75, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6d0 */
+    { .symbols = { 0x75, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x6d1 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6d2 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6d3 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6d4 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6d5 */
+    { .symbols = { 0x75, 0x27, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x6d6 */
+    { .symbols = { 0x75, 0x2e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x6d7 */
+    { .symbols = { 0x75, 0x62, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x6d8 */
+    { .symbols = { 0x75, 0x67, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x6d9 */
+    { .symbols = { 0x75, 0x70, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x6da */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6db */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6dc */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6dd */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6de */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6df */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e0 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e1 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e2 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e3 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e4 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e5 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e6 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e7 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e8 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6e9 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6ea */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6eb */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6ec */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6ed */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6ee */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6ef */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f0 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f1 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f2 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f3 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f4 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f5 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f6 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f7 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f8 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6f9 */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6fa */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6fb */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6fc */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6fd */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6fe */
+    { .symbols = { 0x75, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 5 }, /* 0x6ff */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x700 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x701 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x702 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x703 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x704 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x705 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x706 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x707 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x708 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x709 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x70a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x70b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x70c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x70d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x70e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x70f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x710 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x711 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x712 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x713 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x714 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x715 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x716 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x717 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x718 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x719 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x71a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x71b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x71c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x71d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x71e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x71f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x720 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x721 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x722 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x723 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x724 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x725 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x726 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x727 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x728 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x729 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x72a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x72b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x72c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x72d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x72e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x72f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x730 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x731 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x732 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x733 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x734 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x735 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x736 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x737 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x738 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x739 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x73a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x73b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x73c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x73d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x73e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x73f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x740 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x741 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x742 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x743 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x744 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x745 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x746 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x747 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x748 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x749 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x74a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x74b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x74c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x74d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x74e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x74f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x750 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x751 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x752 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x753 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x754 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x755 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x756 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x757 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x758 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x759 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x75a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x75b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x75c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x75d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x75e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x75f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x760 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x761 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x762 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x763 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x764 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x765 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x766 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x767 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x768 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x769 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x76a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x76b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x76c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x76d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x76e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x76f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x770 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x771 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x772 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x773 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x774 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x775 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x776 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x777 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x778 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x779 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x77a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x77b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x77c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x77d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x77e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x77f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x780 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x781 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x782 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x783 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x784 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x785 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x786 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x787 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x788 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x789 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x78a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x78b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x78c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x78d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x78e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x78f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x790 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x791 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x792 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x793 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x794 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x795 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x796 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x797 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x798 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x799 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x79a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x79b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x79c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x79d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x79e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x79f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7a9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7aa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ab */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ac */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ad */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ae */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7af */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7b9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ba */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7bb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7bc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7bd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7be */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7bf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7c9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ca */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7cb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7cc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7cd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ce */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7cf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7d9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7da */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7db */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7dc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7dd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7de */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7df */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7e9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ea */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7eb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ec */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ed */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ee */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ef */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7f9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7fa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7fb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7fc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7fd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7fe */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0x7ff */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x800 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x801 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x802 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x803 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x804 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x805 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x806 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x807 */
+    { .symbols = { 0x63, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x808 */
+    { .symbols = { 0x63, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x809 */
+    { .symbols = { 0x63, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x80a */
+    { .symbols = { 0x63, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x80b */
+    { .symbols = { 0x63, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x80c */
+    { .symbols = { 0x63, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x80d */
+    { .symbols = { 0x63, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x80e */
+    { .symbols = { 0x63, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x80f */
+    { .symbols = { 0x63, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x810 */
+    { .symbols = { 0x63, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x811 */
+    { .symbols = { 0x63, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x812 */
+    { .symbols = { 0x63, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x813 */
+    { .symbols = { 0x63, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x814 */
+    { .symbols = { 0x63, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x815 */
+    { .symbols = { 0x63, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x816 */
+    { .symbols = { 0x63, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x817 */
+    { .symbols = { 0x63, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x818 */
+    { .symbols = { 0x63, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x819 */
+    { .symbols = { 0x63, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x81a */
+    { .symbols = { 0x63, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x81b */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x81c */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x81d */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x81e */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x81f */
+    { .symbols = { 0x63, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x820 */
+    { .symbols = { 0x63, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x821 */
+    { .symbols = { 0x63, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x822 */
+    { .symbols = { 0x63, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x823 */
+    { .symbols = { 0x63, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x824 */
+    { .symbols = { 0x63, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x825 */
+    { .symbols = { 0x63, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x826 */
+    { .symbols = { 0x63, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x827 */
+    { .symbols = { 0x63, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x828 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x829 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x82a */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x82b */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x82c */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x82d */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x82e */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x82f */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x830 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x831 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x832 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x833 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x834 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x835 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x836 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x837 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x838 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x839 */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x83a */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x83b */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x83c */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x83d */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x83e */
+    { .symbols = { 0x63, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x83f */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x840 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x841 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x842 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x843 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x844 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x845 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x846 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x847 */
+    { .symbols = { 0x64, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x848 */
+    { .symbols = { 0x64, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x849 */
+    { .symbols = { 0x64, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x84a */
+    { .symbols = { 0x64, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x84b */
+    { .symbols = { 0x64, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x84c */
+    { .symbols = { 0x64, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x84d */
+    { .symbols = { 0x64, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x84e */
+    { .symbols = { 0x64, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x84f */
+    { .symbols = { 0x64, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x850 */
+    { .symbols = { 0x64, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x851 */
+    { .symbols = { 0x64, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x852 */
+    { .symbols = { 0x64, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x853 */
+    { .symbols = { 0x64, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x854 */
+    { .symbols = { 0x64, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x855 */
+    { .symbols = { 0x64, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x856 */
+    { .symbols = { 0x64, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x857 */
+    { .symbols = { 0x64, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x858 */
+    { .symbols = { 0x64, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x859 */
+    { .symbols = { 0x64, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x85a */
+    { .symbols = { 0x64, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x85b */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x85c */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x85d */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x85e */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x85f */
+    { .symbols = { 0x64, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x860 */
+    { .symbols = { 0x64, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x861 */
+    { .symbols = { 0x64, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x862 */
+    { .symbols = { 0x64, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x863 */
+    { .symbols = { 0x64, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x864 */
+    { .symbols = { 0x64, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x865 */
+    { .symbols = { 0x64, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x866 */
+    { .symbols = { 0x64, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x867 */
+    { .symbols = { 0x64, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x868 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x869 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x86a */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x86b */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x86c */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x86d */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x86e */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x86f */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x870 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x871 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x872 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x873 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x874 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x875 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x876 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x877 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x878 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x879 */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x87a */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x87b */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x87c */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x87d */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x87e */
+    { .symbols = { 0x64, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x87f */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x880 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x881 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x882 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x883 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x884 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x885 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x886 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x887 */
+    { .symbols = { 0x66, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x888 */
+    { .symbols = { 0x66, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x889 */
+    { .symbols = { 0x66, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x88a */
+    { .symbols = { 0x66, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x88b */
+    { .symbols = { 0x66, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x88c */
+    { .symbols = { 0x66, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x88d */
+    { .symbols = { 0x66, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x88e */
+    { .symbols = { 0x66, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x88f */
+    { .symbols = { 0x66, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x890 */
+    { .symbols = { 0x66, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x891 */
+    { .symbols = { 0x66, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x892 */
+    { .symbols = { 0x66, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x893 */
+    { .symbols = { 0x66, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x894 */
+    { .symbols = { 0x66, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x895 */
+    { .symbols = { 0x66, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x896 */
+    { .symbols = { 0x66, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x897 */
+    { .symbols = { 0x66, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x898 */
+    { .symbols = { 0x66, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x899 */
+    { .symbols = { 0x66, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x89a */
+    { .symbols = { 0x66, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x89b */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x89c */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x89d */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x89e */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x89f */
+    { .symbols = { 0x66, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a0 */
+    { .symbols = { 0x66, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a1 */
+    { .symbols = { 0x66, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a2 */
+    { .symbols = { 0x66, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a3 */
+    { .symbols = { 0x66, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a4 */
+    { .symbols = { 0x66, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a5 */
+    { .symbols = { 0x66, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a6 */
+    { .symbols = { 0x66, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a7 */
+    { .symbols = { 0x66, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8a8 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8a9 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8aa */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ab */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ac */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ad */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ae */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8af */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b0 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b1 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b2 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b3 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b4 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b5 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b6 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b7 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b8 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8b9 */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ba */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8bb */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8bc */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8bd */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8be */
+    { .symbols = { 0x66, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8bf */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8c0 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8c1 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8c2 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8c3 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8c4 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8c5 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8c6 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8c7 */
+    { .symbols = { 0x68, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8c8 */
+    { .symbols = { 0x68, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8c9 */
+    { .symbols = { 0x68, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8ca */
+    { .symbols = { 0x68, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8cb */
+    { .symbols = { 0x68, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8cc */
+    { .symbols = { 0x68, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8cd */
+    { .symbols = { 0x68, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8ce */
+    { .symbols = { 0x68, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8cf */
+    { .symbols = { 0x68, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d0 */
+    { .symbols = { 0x68, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d1 */
+    { .symbols = { 0x68, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d2 */
+    { .symbols = { 0x68, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d3 */
+    { .symbols = { 0x68, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d4 */
+    { .symbols = { 0x68, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d5 */
+    { .symbols = { 0x68, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d6 */
+    { .symbols = { 0x68, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d7 */
+    { .symbols = { 0x68, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d8 */
+    { .symbols = { 0x68, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8d9 */
+    { .symbols = { 0x68, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8da */
+    { .symbols = { 0x68, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x8db */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8dc */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8dd */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8de */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8df */
+    { .symbols = { 0x68, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e0 */
+    { .symbols = { 0x68, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e1 */
+    { .symbols = { 0x68, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e2 */
+    { .symbols = { 0x68, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e3 */
+    { .symbols = { 0x68, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e4 */
+    { .symbols = { 0x68, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e5 */
+    { .symbols = { 0x68, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e6 */
+    { .symbols = { 0x68, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e7 */
+    { .symbols = { 0x68, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x8e8 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8e9 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ea */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8eb */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ec */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ed */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ee */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ef */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f0 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f1 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f2 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f3 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f4 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f5 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f6 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f7 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f8 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8f9 */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8fa */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8fb */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8fc */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8fd */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8fe */
+    { .symbols = { 0x68, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x8ff */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x900 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x901 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x902 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x903 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x904 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x905 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x906 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x907 */
+    { .symbols = { 0x6b, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x908 */
+    { .symbols = { 0x6b, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x909 */
+    { .symbols = { 0x6b, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x90a */
+    { .symbols = { 0x6b, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x90b */
+    { .symbols = { 0x6b, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x90c */
+    { .symbols = { 0x6b, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x90d */
+    { .symbols = { 0x6b, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x90e */
+    { .symbols = { 0x6b, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x90f */
+    { .symbols = { 0x6b, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x910 */
+    { .symbols = { 0x6b, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x911 */
+    { .symbols = { 0x6b, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x912 */
+    { .symbols = { 0x6b, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x913 */
+    { .symbols = { 0x6b, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x914 */
+    { .symbols = { 0x6b, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x915 */
+    { .symbols = { 0x6b, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x916 */
+    { .symbols = { 0x6b, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x917 */
+    { .symbols = { 0x6b, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x918 */
+    { .symbols = { 0x6b, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x919 */
+    { .symbols = { 0x6b, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x91a */
+    { .symbols = { 0x6b, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x91b */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x91c */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x91d */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x91e */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x91f */
+    { .symbols = { 0x6b, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x920 */
+    { .symbols = { 0x6b, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x921 */
+    { .symbols = { 0x6b, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x922 */
+    { .symbols = { 0x6b, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x923 */
+    { .symbols = { 0x6b, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x924 */
+    { .symbols = { 0x6b, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x925 */
+    { .symbols = { 0x6b, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x926 */
+    { .symbols = { 0x6b, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x927 */
+    { .symbols = { 0x6b, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x928 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x929 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x92a */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x92b */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x92c */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x92d */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x92e */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x92f */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x930 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x931 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x932 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x933 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x934 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x935 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x936 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x937 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x938 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x939 */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x93a */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x93b */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x93c */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x93d */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x93e */
+    { .symbols = { 0x6b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x93f */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x940 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x941 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x942 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x943 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x944 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x945 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x946 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x947 */
+    { .symbols = { 0x6c, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x948 */
+    { .symbols = { 0x6c, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x949 */
+    { .symbols = { 0x6c, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x94a */
+    { .symbols = { 0x6c, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x94b */
+    { .symbols = { 0x6c, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x94c */
+    { .symbols = { 0x6c, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x94d */
+    { .symbols = { 0x6c, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x94e */
+    { .symbols = { 0x6c, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x94f */
+    { .symbols = { 0x6c, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x950 */
+    { .symbols = { 0x6c, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x951 */
+    { .symbols = { 0x6c, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x952 */
+    { .symbols = { 0x6c, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x953 */
+    { .symbols = { 0x6c, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x954 */
+    { .symbols = { 0x6c, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x955 */
+    { .symbols = { 0x6c, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x956 */
+    { .symbols = { 0x6c, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x957 */
+    { .symbols = { 0x6c, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x958 */
+    { .symbols = { 0x6c, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x959 */
+    { .symbols = { 0x6c, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x95a */
+    { .symbols = { 0x6c, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x95b */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x95c */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x95d */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x95e */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x95f */
+    { .symbols = { 0x6c, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x960 */
+    { .symbols = { 0x6c, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x961 */
+    { .symbols = { 0x6c, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x962 */
+    { .symbols = { 0x6c, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x963 */
+    { .symbols = { 0x6c, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x964 */
+    { .symbols = { 0x6c, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x965 */
+    { .symbols = { 0x6c, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x966 */
+    { .symbols = { 0x6c, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x967 */
+    { .symbols = { 0x6c, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x968 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x969 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x96a */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x96b */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x96c */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x96d */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x96e */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x96f */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x970 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x971 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x972 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x973 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x974 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x975 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x976 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x977 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x978 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x979 */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x97a */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x97b */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x97c */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x97d */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x97e */
+    { .symbols = { 0x6c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x97f */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x980 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x981 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x982 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x983 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x984 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x985 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x986 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x987 */
+    { .symbols = { 0x6d, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x988 */
+    { .symbols = { 0x6d, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x989 */
+    { .symbols = { 0x6d, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x98a */
+    { .symbols = { 0x6d, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x98b */
+    { .symbols = { 0x6d, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x98c */
+    { .symbols = { 0x6d, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x98d */
+    { .symbols = { 0x6d, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x98e */
+    { .symbols = { 0x6d, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x98f */
+    { .symbols = { 0x6d, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x990 */
+    { .symbols = { 0x6d, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x991 */
+    { .symbols = { 0x6d, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x992 */
+    { .symbols = { 0x6d, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x993 */
+    { .symbols = { 0x6d, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x994 */
+    { .symbols = { 0x6d, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x995 */
+    { .symbols = { 0x6d, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x996 */
+    { .symbols = { 0x6d, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x997 */
+    { .symbols = { 0x6d, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x998 */
+    { .symbols = { 0x6d, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x999 */
+    { .symbols = { 0x6d, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x99a */
+    { .symbols = { 0x6d, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x99b */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x99c */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x99d */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x99e */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x99f */
+    { .symbols = { 0x6d, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a0 */
+    { .symbols = { 0x6d, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a1 */
+    { .symbols = { 0x6d, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a2 */
+    { .symbols = { 0x6d, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a3 */
+    { .symbols = { 0x6d, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a4 */
+    { .symbols = { 0x6d, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a5 */
+    { .symbols = { 0x6d, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a6 */
+    { .symbols = { 0x6d, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a7 */
+    { .symbols = { 0x6d, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9a8 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9a9 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9aa */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ab */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ac */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ad */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ae */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9af */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b0 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b1 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b2 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b3 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b4 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b5 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b6 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b7 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b8 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9b9 */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ba */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9bb */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9bc */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9bd */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9be */
+    { .symbols = { 0x6d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9bf */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9c0 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9c1 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9c2 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9c3 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9c4 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9c5 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9c6 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9c7 */
+    { .symbols = { 0x77, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9c8 */
+    { .symbols = { 0x77, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9c9 */
+    { .symbols = { 0x77, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9ca */
+    { .symbols = { 0x77, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9cb */
+    { .symbols = { 0x77, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9cc */
+    { .symbols = { 0x77, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9cd */
+    { .symbols = { 0x77, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9ce */
+    { .symbols = { 0x77, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9cf */
+    { .symbols = { 0x77, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d0 */
+    { .symbols = { 0x77, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d1 */
+    { .symbols = { 0x77, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d2 */
+    { .symbols = { 0x77, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d3 */
+    { .symbols = { 0x77, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d4 */
+    { .symbols = { 0x77, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d5 */
+    { .symbols = { 0x77, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d6 */
+    { .symbols = { 0x77, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d7 */
+    { .symbols = { 0x77, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d8 */
+    { .symbols = { 0x77, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9d9 */
+    { .symbols = { 0x77, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9da */
+    { .symbols = { 0x77, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0x9db */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9dc */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9dd */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9de */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9df */
+    { .symbols = { 0x77, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e0 */
+    { .symbols = { 0x77, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e1 */
+    { .symbols = { 0x77, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e2 */
+    { .symbols = { 0x77, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e3 */
+    { .symbols = { 0x77, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e4 */
+    { .symbols = { 0x77, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e5 */
+    { .symbols = { 0x77, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e6 */
+    { .symbols = { 0x77, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e7 */
+    { .symbols = { 0x77, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0x9e8 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9e9 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ea */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9eb */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ec */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ed */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ee */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ef */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f0 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f1 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f2 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f3 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f4 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f5 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f6 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f7 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f8 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9f9 */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9fa */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9fb */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9fc */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9fd */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9fe */
+    { .symbols = { 0x77, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0x9ff */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa00 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa01 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa02 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa03 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa04 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa05 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa06 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa07 */
+    { .symbols = { 0x79, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa08 */
+    { .symbols = { 0x79, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa09 */
+    { .symbols = { 0x79, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa0a */
+    { .symbols = { 0x79, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa0b */
+    { .symbols = { 0x79, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa0c */
+    { .symbols = { 0x79, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa0d */
+    { .symbols = { 0x79, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa0e */
+    { .symbols = { 0x79, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa0f */
+    { .symbols = { 0x79, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa10 */
+    { .symbols = { 0x79, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa11 */
+    { .symbols = { 0x79, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa12 */
+    { .symbols = { 0x79, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa13 */
+    { .symbols = { 0x79, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa14 */
+    { .symbols = { 0x79, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa15 */
+    { .symbols = { 0x79, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa16 */
+    { .symbols = { 0x79, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa17 */
+    { .symbols = { 0x79, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa18 */
+    { .symbols = { 0x79, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa19 */
+    { .symbols = { 0x79, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa1a */
+    { .symbols = { 0x79, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 11 }, /* 0xa1b */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa1c */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa1d */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa1e */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa1f */
+    { .symbols = { 0x79, 0x63, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa20 */
+    { .symbols = { 0x79, 0x64, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa21 */
+    { .symbols = { 0x79, 0x66, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa22 */
+    { .symbols = { 0x79, 0x68, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa23 */
+    { .symbols = { 0x79, 0x6b, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa24 */
+    { .symbols = { 0x79, 0x6c, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa25 */
+    { .symbols = { 0x79, 0x6d, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa26 */
+    { .symbols = { 0x79, 0x77, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa27 */
+    { .symbols = { 0x79, 0x79, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xa28 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa29 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa2a */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa2b */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa2c */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa2d */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa2e */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa2f */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa30 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa31 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa32 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa33 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa34 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa35 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa36 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa37 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa38 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa39 */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa3a */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa3b */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa3c */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa3d */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa3e */
+    { .symbols = { 0x79, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 6 }, /* 0xa3f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa40 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa41 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa42 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa43 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa44 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa45 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa46 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa47 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa48 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa49 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa4a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa4b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa4c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa4d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa4e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa4f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa50 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa51 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa52 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa53 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa54 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa55 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa56 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa57 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa58 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa59 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa5a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa5b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa5c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa5d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa5e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa5f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa60 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa61 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa62 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa63 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa64 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa65 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa66 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa67 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa68 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa69 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa6a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa6b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa6c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa6d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa6e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa6f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa70 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa71 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa72 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa73 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa74 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa75 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa76 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa77 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa78 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa79 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa7a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa7b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa7c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa7d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa7e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa7f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa80 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa81 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa82 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa83 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa84 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa85 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa86 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa87 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa88 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa89 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa8a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa8b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa8c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa8d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa8e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa8f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa90 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa91 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa92 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa93 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa94 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa95 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa96 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa97 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa98 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa99 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa9a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa9b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa9c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa9d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa9e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xa9f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaa9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaaa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaab */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaac */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaad */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaae */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaaf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xab9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xaba */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xabb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xabc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xabd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xabe */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xabf */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xac0 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xac1 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xac2 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xac3 */
+    { .symbols = { 0x27, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xac4 */
+    { .symbols = { 0x27, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xac5 */
+    { .symbols = { 0x27, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xac6 */
+    { .symbols = { 0x27, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xac7 */
+    { .symbols = { 0x27, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xac8 */
+    { .symbols = { 0x27, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xac9 */
+    { .symbols = { 0x27, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xaca */
+    { .symbols = { 0x27, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xacb */
+    { .symbols = { 0x27, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xacc */
+    { .symbols = { 0x27, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xacd */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xace */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xacf */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad0 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad1 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad2 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad3 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad4 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad5 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad6 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad7 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad8 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xad9 */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xada */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xadb */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xadc */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xadd */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xade */
+    { .symbols = { 0x27, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xadf */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xae0 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xae1 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xae2 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xae3 */
+    { .symbols = { 0x2e, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xae4 */
+    { .symbols = { 0x2e, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xae5 */
+    { .symbols = { 0x2e, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xae6 */
+    { .symbols = { 0x2e, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xae7 */
+    { .symbols = { 0x2e, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xae8 */
+    { .symbols = { 0x2e, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xae9 */
+    { .symbols = { 0x2e, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xaea */
+    { .symbols = { 0x2e, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xaeb */
+    { .symbols = { 0x2e, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xaec */
+    { .symbols = { 0x2e, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xaed */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaee */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaef */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf0 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf1 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf2 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf3 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf4 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf5 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf6 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf7 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf8 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaf9 */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xafa */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xafb */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xafc */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xafd */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xafe */
+    { .symbols = { 0x2e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xaff */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb00 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb01 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb02 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb03 */
+    { .symbols = { 0x62, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb04 */
+    { .symbols = { 0x62, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb05 */
+    { .symbols = { 0x62, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb06 */
+    { .symbols = { 0x62, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb07 */
+    { .symbols = { 0x62, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb08 */
+    { .symbols = { 0x62, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb09 */
+    { .symbols = { 0x62, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb0a */
+    { .symbols = { 0x62, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb0b */
+    { .symbols = { 0x62, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb0c */
+    { .symbols = { 0x62, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb0d */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb0e */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb0f */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb10 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb11 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb12 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb13 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb14 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb15 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb16 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb17 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb18 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb19 */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb1a */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb1b */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb1c */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb1d */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb1e */
+    { .symbols = { 0x62, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb1f */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb20 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb21 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb22 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb23 */
+    { .symbols = { 0x67, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb24 */
+    { .symbols = { 0x67, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb25 */
+    { .symbols = { 0x67, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb26 */
+    { .symbols = { 0x67, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb27 */
+    { .symbols = { 0x67, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb28 */
+    { .symbols = { 0x67, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb29 */
+    { .symbols = { 0x67, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb2a */
+    { .symbols = { 0x67, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb2b */
+    { .symbols = { 0x67, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb2c */
+    { .symbols = { 0x67, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb2d */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb2e */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb2f */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb30 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb31 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb32 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb33 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb34 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb35 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb36 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb37 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb38 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb39 */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb3a */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb3b */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb3c */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb3d */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb3e */
+    { .symbols = { 0x67, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb3f */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb40 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb41 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb42 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb43 */
+    { .symbols = { 0x70, 0x20, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb44 */
+    { .symbols = { 0x70, 0x61, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb45 */
+    { .symbols = { 0x70, 0x65, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb46 */
+    { .symbols = { 0x70, 0x69, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb47 */
+    { .symbols = { 0x70, 0x6e, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb48 */
+    { .symbols = { 0x70, 0x6f, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb49 */
+    { .symbols = { 0x70, 0x72, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb4a */
+    { .symbols = { 0x70, 0x73, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb4b */
+    { .symbols = { 0x70, 0x74, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb4c */
+    { .symbols = { 0x70, 0x75, 0x0, 0x0 }, .num_symbols = 2, .num_bits = 12 }, /* 0xb4d */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb4e */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb4f */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb50 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb51 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb52 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb53 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb54 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb55 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb56 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb57 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb58 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb59 */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb5a */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb5b */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb5c */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb5d */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb5e */
+    { .symbols = { 0x70, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 7 }, /* 0xb5f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb60 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb61 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb62 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb63 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb64 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb65 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb66 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb67 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb68 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb69 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb6a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb6b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb6c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb6d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb6e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb6f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb70 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb71 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb72 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb73 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb74 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb75 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb76 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb77 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb78 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb79 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb7a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb7b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb7c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb7d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb7e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xb7f */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb80 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb81 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb82 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb83 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb84 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb85 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb86 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb87 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb88 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb89 */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb8a */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb8b */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb8c */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb8d */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb8e */
+    { .symbols = { 0xa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb8f */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb90 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb91 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb92 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb93 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb94 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb95 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb96 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb97 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb98 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb99 */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb9a */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb9b */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb9c */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb9d */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb9e */
+    { .symbols = { 0x2c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xb9f */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba0 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba1 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba2 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba3 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba4 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba5 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba6 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba7 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba8 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xba9 */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbaa */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbab */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbac */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbad */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbae */
+    { .symbols = { 0x3f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbaf */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb0 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb1 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb2 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb3 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb4 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb5 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb6 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb7 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb8 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbb9 */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbba */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbbb */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbbc */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbbd */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbbe */
+    { .symbols = { 0x42, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbbf */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc0 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc1 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc2 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc3 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc4 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc5 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc6 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc7 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc8 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbc9 */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbca */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbcb */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbcc */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbcd */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbce */
+    { .symbols = { 0x49, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbcf */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd0 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd1 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd2 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd3 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd4 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd5 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd6 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd7 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd8 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbd9 */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbda */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbdb */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbdc */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbdd */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbde */
+    { .symbols = { 0x54, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbdf */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe0 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe1 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe2 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe3 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe4 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe5 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe6 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe7 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe8 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbe9 */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbea */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbeb */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbec */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbed */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbee */
+    { .symbols = { 0x57, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbef */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf0 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf1 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf2 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf3 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf4 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf5 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf6 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf7 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf8 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbf9 */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbfa */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbfb */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbfc */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbfd */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbfe */
+    { .symbols = { 0x6a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xbff */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc00 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc01 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc02 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc03 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc04 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc05 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc06 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc07 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc08 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc09 */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc0a */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc0b */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc0c */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc0d */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc0e */
+    { .symbols = { 0x76, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc0f */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc10 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc11 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc12 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc13 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc14 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc15 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc16 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc17 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc18 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc19 */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc1a */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc1b */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc1c */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc1d */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc1e */
+    { .symbols = { 0x78, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 8 }, /* 0xc1f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc20 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc21 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc22 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc23 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc24 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc25 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc26 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc27 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc28 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc29 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc2a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc2b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc2c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc2d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc2e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc2f */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc30 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc31 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc32 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc33 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc34 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc35 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc36 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc37 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc38 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc39 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc3a */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc3b */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc3c */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc3d */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc3e */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xc3f */
+    { .symbols = { 0x2d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc40 */
+    { .symbols = { 0x2d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc41 */
+    { .symbols = { 0x2d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc42 */
+    { .symbols = { 0x2d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc43 */
+    { .symbols = { 0x2d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc44 */
+    { .symbols = { 0x2d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc45 */
+    { .symbols = { 0x2d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc46 */
+    { .symbols = { 0x2d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc47 */
+    { .symbols = { 0x43, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc48 */
+    { .symbols = { 0x43, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc49 */
+    { .symbols = { 0x43, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc4a */
+    { .symbols = { 0x43, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc4b */
+    { .symbols = { 0x43, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc4c */
+    { .symbols = { 0x43, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc4d */
+    { .symbols = { 0x43, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc4e */
+    { .symbols = { 0x43, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc4f */
+    { .symbols = { 0x44, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc50 */
+    { .symbols = { 0x44, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc51 */
+    { .symbols = { 0x44, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc52 */
+    { .symbols = { 0x44, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc53 */
+    { .symbols = { 0x44, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc54 */
+    { .symbols = { 0x44, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc55 */
+    { .symbols = { 0x44, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc56 */
+    { .symbols = { 0x44, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc57 */
+    { .symbols = { 0x45, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc58 */
+    { .symbols = { 0x45, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc59 */
+    { .symbols = { 0x45, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc5a */
+    { .symbols = { 0x45, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc5b */
+    { .symbols = { 0x45, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc5c */
+    { .symbols = { 0x45, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc5d */
+    { .symbols = { 0x45, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc5e */
+    { .symbols = { 0x45, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc5f */
+    { .symbols = { 0x46, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc60 */
+    { .symbols = { 0x46, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc61 */
+    { .symbols = { 0x46, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc62 */
+    { .symbols = { 0x46, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc63 */
+    { .symbols = { 0x46, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc64 */
+    { .symbols = { 0x46, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc65 */
+    { .symbols = { 0x46, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc66 */
+    { .symbols = { 0x46, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc67 */
+    { .symbols = { 0x47, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc68 */
+    { .symbols = { 0x47, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc69 */
+    { .symbols = { 0x47, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc6a */
+    { .symbols = { 0x47, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc6b */
+    { .symbols = { 0x47, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc6c */
+    { .symbols = { 0x47, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc6d */
+    { .symbols = { 0x47, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc6e */
+    { .symbols = { 0x47, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc6f */
+    { .symbols = { 0x48, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc70 */
+    { .symbols = { 0x48, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc71 */
+    { .symbols = { 0x48, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc72 */
+    { .symbols = { 0x48, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc73 */
+    { .symbols = { 0x48, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc74 */
+    { .symbols = { 0x48, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc75 */
+    { .symbols = { 0x48, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc76 */
+    { .symbols = { 0x48, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc77 */
+    { .symbols = { 0x4c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc78 */
+    { .symbols = { 0x4c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc79 */
+    { .symbols = { 0x4c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc7a */
+    { .symbols = { 0x4c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc7b */
+    { .symbols = { 0x4c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc7c */
+    { .symbols = { 0x4c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc7d */
+    { .symbols = { 0x4c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc7e */
+    { .symbols = { 0x4c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc7f */
+    { .symbols = { 0x4d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc80 */
+    { .symbols = { 0x4d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc81 */
+    { .symbols = { 0x4d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc82 */
+    { .symbols = { 0x4d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc83 */
+    { .symbols = { 0x4d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc84 */
+    { .symbols = { 0x4d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc85 */
+    { .symbols = { 0x4d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc86 */
+    { .symbols = { 0x4d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc87 */
+    { .symbols = { 0x50, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc88 */
+    { .symbols = { 0x50, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc89 */
+    { .symbols = { 0x50, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc8a */
+    { .symbols = { 0x50, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc8b */
+    { .symbols = { 0x50, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc8c */
+    { .symbols = { 0x50, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc8d */
+    { .symbols = { 0x50, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc8e */
+    { .symbols = { 0x50, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc8f */
+    { .symbols = { 0x56, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc90 */
+    { .symbols = { 0x56, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc91 */
+    { .symbols = { 0x56, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc92 */
+    { .symbols = { 0x56, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc93 */
+    { .symbols = { 0x56, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc94 */
+    { .symbols = { 0x56, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc95 */
+    { .symbols = { 0x56, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc96 */
+    { .symbols = { 0x56, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc97 */
+    { .symbols = { 0x59, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc98 */
+    { .symbols = { 0x59, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc99 */
+    { .symbols = { 0x59, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc9a */
+    { .symbols = { 0x59, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc9b */
+    { .symbols = { 0x59, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc9c */
+    { .symbols = { 0x59, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc9d */
+    { .symbols = { 0x59, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc9e */
+    { .symbols = { 0x59, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xc9f */
+    { .symbols = { 0x71, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xca0 */
+    { .symbols = { 0x71, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xca1 */
+    { .symbols = { 0x71, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xca2 */
+    { .symbols = { 0x71, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xca3 */
+    { .symbols = { 0x71, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xca4 */
+    { .symbols = { 0x71, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xca5 */
+    { .symbols = { 0x71, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xca6 */
+    { .symbols = { 0x71, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 9 }, /* 0xca7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xca8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xca9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcaa */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcab */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcac */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcad */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcae */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcaf */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb0 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb1 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb2 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb3 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb4 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb5 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb6 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xcb7 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcb8 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcb9 */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcba */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcbb */
+    { .symbols = { 0x1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcbc */
+    { .symbols = { 0x1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcbd */
+    { .symbols = { 0x1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcbe */
+    { .symbols = { 0x1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcbf */
+    { .symbols = { 0x2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc0 */
+    { .symbols = { 0x2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc1 */
+    { .symbols = { 0x2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc2 */
+    { .symbols = { 0x2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc3 */
+    { .symbols = { 0x3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc4 */
+    { .symbols = { 0x3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc5 */
+    { .symbols = { 0x3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc6 */
+    { .symbols = { 0x3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc7 */
+    { .symbols = { 0x4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc8 */
+    { .symbols = { 0x4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcc9 */
+    { .symbols = { 0x4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcca */
+    { .symbols = { 0x4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xccb */
+    { .symbols = { 0x5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xccc */
+    { .symbols = { 0x5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xccd */
+    { .symbols = { 0x5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcce */
+    { .symbols = { 0x5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xccf */
+    { .symbols = { 0x6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd0 */
+    { .symbols = { 0x6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd1 */
+    { .symbols = { 0x6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd2 */
+    { .symbols = { 0x6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd3 */
+    { .symbols = { 0x7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd4 */
+    { .symbols = { 0x7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd5 */
+    { .symbols = { 0x7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd6 */
+    { .symbols = { 0x7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd7 */
+    { .symbols = { 0x8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd8 */
+    { .symbols = { 0x8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcd9 */
+    { .symbols = { 0x8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcda */
+    { .symbols = { 0x8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcdb */
+    { .symbols = { 0x9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcdc */
+    { .symbols = { 0x9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcdd */
+    { .symbols = { 0x9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcde */
+    { .symbols = { 0x9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcdf */
+    { .symbols = { 0xb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce0 */
+    { .symbols = { 0xb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce1 */
+    { .symbols = { 0xb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce2 */
+    { .symbols = { 0xb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce3 */
+    { .symbols = { 0xc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce4 */
+    { .symbols = { 0xc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce5 */
+    { .symbols = { 0xc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce6 */
+    { .symbols = { 0xc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce7 */
+    { .symbols = { 0xd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce8 */
+    { .symbols = { 0xd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xce9 */
+    { .symbols = { 0xd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcea */
+    { .symbols = { 0xd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xceb */
+    { .symbols = { 0xe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcec */
+    { .symbols = { 0xe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xced */
+    { .symbols = { 0xe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcee */
+    { .symbols = { 0xe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcef */
+    { .symbols = { 0xf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf0 */
+    { .symbols = { 0xf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf1 */
+    { .symbols = { 0xf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf2 */
+    { .symbols = { 0xf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf3 */
+    { .symbols = { 0x10, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf4 */
+    { .symbols = { 0x10, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf5 */
+    { .symbols = { 0x10, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf6 */
+    { .symbols = { 0x10, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf7 */
+    { .symbols = { 0x11, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf8 */
+    { .symbols = { 0x11, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcf9 */
+    { .symbols = { 0x11, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcfa */
+    { .symbols = { 0x11, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcfb */
+    { .symbols = { 0x12, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcfc */
+    { .symbols = { 0x12, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcfd */
+    { .symbols = { 0x12, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcfe */
+    { .symbols = { 0x12, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xcff */
+    { .symbols = { 0x13, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd00 */
+    { .symbols = { 0x13, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd01 */
+    { .symbols = { 0x13, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd02 */
+    { .symbols = { 0x13, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd03 */
+    { .symbols = { 0x14, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd04 */
+    { .symbols = { 0x14, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd05 */
+    { .symbols = { 0x14, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd06 */
+    { .symbols = { 0x14, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd07 */
+    { .symbols = { 0x15, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd08 */
+    { .symbols = { 0x15, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd09 */
+    { .symbols = { 0x15, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd0a */
+    { .symbols = { 0x15, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd0b */
+    { .symbols = { 0x16, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd0c */
+    { .symbols = { 0x16, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd0d */
+    { .symbols = { 0x16, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd0e */
+    { .symbols = { 0x16, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd0f */
+    { .symbols = { 0x17, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd10 */
+    { .symbols = { 0x17, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd11 */
+    { .symbols = { 0x17, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd12 */
+    { .symbols = { 0x17, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd13 */
+    { .symbols = { 0x18, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd14 */
+    { .symbols = { 0x18, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd15 */
+    { .symbols = { 0x18, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd16 */
+    { .symbols = { 0x18, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd17 */
+    { .symbols = { 0x19, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd18 */
+    { .symbols = { 0x19, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd19 */
+    { .symbols = { 0x19, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd1a */
+    { .symbols = { 0x19, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd1b */
+    { .symbols = { 0x1a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd1c */
+    { .symbols = { 0x1a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd1d */
+    { .symbols = { 0x1a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd1e */
+    { .symbols = { 0x1a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd1f */
+    { .symbols = { 0x1b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd20 */
+    { .symbols = { 0x1b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd21 */
+    { .symbols = { 0x1b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd22 */
+    { .symbols = { 0x1b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd23 */
+    { .symbols = { 0x1c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd24 */
+    { .symbols = { 0x1c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd25 */
+    { .symbols = { 0x1c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd26 */
+    { .symbols = { 0x1c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd27 */
+    { .symbols = { 0x1d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd28 */
+    { .symbols = { 0x1d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd29 */
+    { .symbols = { 0x1d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd2a */
+    { .symbols = { 0x1d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd2b */
+    { .symbols = { 0x1e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd2c */
+    { .symbols = { 0x1e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd2d */
+    { .symbols = { 0x1e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd2e */
+    { .symbols = { 0x1e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd2f */
+    { .symbols = { 0x1f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd30 */
+    { .symbols = { 0x1f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd31 */
+    { .symbols = { 0x1f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd32 */
+    { .symbols = { 0x1f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd33 */
+    { .symbols = { 0x21, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd34 */
+    { .symbols = { 0x21, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd35 */
+    { .symbols = { 0x21, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd36 */
+    { .symbols = { 0x21, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd37 */
+    { .symbols = { 0x22, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd38 */
+    { .symbols = { 0x22, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd39 */
+    { .symbols = { 0x22, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd3a */
+    { .symbols = { 0x22, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd3b */
+    { .symbols = { 0x23, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd3c */
+    { .symbols = { 0x23, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd3d */
+    { .symbols = { 0x23, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd3e */
+    { .symbols = { 0x23, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd3f */
+    { .symbols = { 0x24, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd40 */
+    { .symbols = { 0x24, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd41 */
+    { .symbols = { 0x24, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd42 */
+    { .symbols = { 0x24, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd43 */
+    { .symbols = { 0x25, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd44 */
+    { .symbols = { 0x25, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd45 */
+    { .symbols = { 0x25, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd46 */
+    { .symbols = { 0x25, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd47 */
+    { .symbols = { 0x26, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd48 */
+    { .symbols = { 0x26, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd49 */
+    { .symbols = { 0x26, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd4a */
+    { .symbols = { 0x26, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd4b */
+    { .symbols = { 0x28, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd4c */
+    { .symbols = { 0x28, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd4d */
+    { .symbols = { 0x28, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd4e */
+    { .symbols = { 0x28, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd4f */
+    { .symbols = { 0x29, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd50 */
+    { .symbols = { 0x29, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd51 */
+    { .symbols = { 0x29, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd52 */
+    { .symbols = { 0x29, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd53 */
+    { .symbols = { 0x2a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd54 */
+    { .symbols = { 0x2a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd55 */
+    { .symbols = { 0x2a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd56 */
+    { .symbols = { 0x2a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd57 */
+    { .symbols = { 0x2b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd58 */
+    { .symbols = { 0x2b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd59 */
+    { .symbols = { 0x2b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd5a */
+    { .symbols = { 0x2b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd5b */
+    { .symbols = { 0x2f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd5c */
+    { .symbols = { 0x2f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd5d */
+    { .symbols = { 0x2f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd5e */
+    { .symbols = { 0x2f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd5f */
+    { .symbols = { 0x30, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd60 */
+    { .symbols = { 0x30, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd61 */
+    { .symbols = { 0x30, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd62 */
+    { .symbols = { 0x30, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd63 */
+    { .symbols = { 0x31, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd64 */
+    { .symbols = { 0x31, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd65 */
+    { .symbols = { 0x31, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd66 */
+    { .symbols = { 0x31, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd67 */
+    { .symbols = { 0x32, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd68 */
+    { .symbols = { 0x32, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd69 */
+    { .symbols = { 0x32, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd6a */
+    { .symbols = { 0x32, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd6b */
+    { .symbols = { 0x33, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd6c */
+    { .symbols = { 0x33, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd6d */
+    { .symbols = { 0x33, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd6e */
+    { .symbols = { 0x33, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd6f */
+    { .symbols = { 0x34, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd70 */
+    { .symbols = { 0x34, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd71 */
+    { .symbols = { 0x34, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd72 */
+    { .symbols = { 0x34, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd73 */
+    { .symbols = { 0x35, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd74 */
+    { .symbols = { 0x35, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd75 */
+    { .symbols = { 0x35, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd76 */
+    { .symbols = { 0x35, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd77 */
+    { .symbols = { 0x36, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd78 */
+    { .symbols = { 0x36, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd79 */
+    { .symbols = { 0x36, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd7a */
+    { .symbols = { 0x36, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd7b */
+    { .symbols = { 0x37, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd7c */
+    { .symbols = { 0x37, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd7d */
+    { .symbols = { 0x37, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd7e */
+    { .symbols = { 0x37, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd7f */
+    { .symbols = { 0x38, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd80 */
+    { .symbols = { 0x38, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd81 */
+    { .symbols = { 0x38, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd82 */
+    { .symbols = { 0x38, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd83 */
+    { .symbols = { 0x39, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd84 */
+    { .symbols = { 0x39, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd85 */
+    { .symbols = { 0x39, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd86 */
+    { .symbols = { 0x39, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd87 */
+    { .symbols = { 0x3a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd88 */
+    { .symbols = { 0x3a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd89 */
+    { .symbols = { 0x3a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd8a */
+    { .symbols = { 0x3a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd8b */
+    { .symbols = { 0x3b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd8c */
+    { .symbols = { 0x3b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd8d */
+    { .symbols = { 0x3b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd8e */
+    { .symbols = { 0x3b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd8f */
+    { .symbols = { 0x3c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd90 */
+    { .symbols = { 0x3c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd91 */
+    { .symbols = { 0x3c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd92 */
+    { .symbols = { 0x3c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd93 */
+    { .symbols = { 0x3d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd94 */
+    { .symbols = { 0x3d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd95 */
+    { .symbols = { 0x3d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd96 */
+    { .symbols = { 0x3d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd97 */
+    { .symbols = { 0x3e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd98 */
+    { .symbols = { 0x3e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd99 */
+    { .symbols = { 0x3e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd9a */
+    { .symbols = { 0x3e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd9b */
+    { .symbols = { 0x40, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd9c */
+    { .symbols = { 0x40, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd9d */
+    { .symbols = { 0x40, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd9e */
+    { .symbols = { 0x40, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xd9f */
+    { .symbols = { 0x41, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda0 */
+    { .symbols = { 0x41, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda1 */
+    { .symbols = { 0x41, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda2 */
+    { .symbols = { 0x41, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda3 */
+    { .symbols = { 0x4a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda4 */
+    { .symbols = { 0x4a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda5 */
+    { .symbols = { 0x4a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda6 */
+    { .symbols = { 0x4a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda7 */
+    { .symbols = { 0x4b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda8 */
+    { .symbols = { 0x4b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xda9 */
+    { .symbols = { 0x4b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdaa */
+    { .symbols = { 0x4b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdab */
+    { .symbols = { 0x4e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdac */
+    { .symbols = { 0x4e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdad */
+    { .symbols = { 0x4e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdae */
+    { .symbols = { 0x4e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdaf */
+    { .symbols = { 0x4f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb0 */
+    { .symbols = { 0x4f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb1 */
+    { .symbols = { 0x4f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb2 */
+    { .symbols = { 0x4f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb3 */
+    { .symbols = { 0x51, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb4 */
+    { .symbols = { 0x51, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb5 */
+    { .symbols = { 0x51, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb6 */
+    { .symbols = { 0x51, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb7 */
+    { .symbols = { 0x52, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb8 */
+    { .symbols = { 0x52, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdb9 */
+    { .symbols = { 0x52, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdba */
+    { .symbols = { 0x52, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdbb */
+    { .symbols = { 0x53, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdbc */
+    { .symbols = { 0x53, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdbd */
+    { .symbols = { 0x53, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdbe */
+    { .symbols = { 0x53, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdbf */
+    { .symbols = { 0x55, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc0 */
+    { .symbols = { 0x55, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc1 */
+    { .symbols = { 0x55, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc2 */
+    { .symbols = { 0x55, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc3 */
+    { .symbols = { 0x58, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc4 */
+    { .symbols = { 0x58, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc5 */
+    { .symbols = { 0x58, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc6 */
+    { .symbols = { 0x58, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc7 */
+    { .symbols = { 0x5a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc8 */
+    { .symbols = { 0x5a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdc9 */
+    { .symbols = { 0x5a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdca */
+    { .symbols = { 0x5a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdcb */
+    { .symbols = { 0x5b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdcc */
+    { .symbols = { 0x5b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdcd */
+    { .symbols = { 0x5b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdce */
+    { .symbols = { 0x5b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdcf */
+    { .symbols = { 0x5c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd0 */
+    { .symbols = { 0x5c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd1 */
+    { .symbols = { 0x5c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd2 */
+    { .symbols = { 0x5c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd3 */
+    { .symbols = { 0x5d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd4 */
+    { .symbols = { 0x5d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd5 */
+    { .symbols = { 0x5d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd6 */
+    { .symbols = { 0x5d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd7 */
+    { .symbols = { 0x5e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd8 */
+    { .symbols = { 0x5e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdd9 */
+    { .symbols = { 0x5e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdda */
+    { .symbols = { 0x5e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xddb */
+    { .symbols = { 0x5f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xddc */
+    { .symbols = { 0x5f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xddd */
+    { .symbols = { 0x5f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdde */
+    { .symbols = { 0x5f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xddf */
+    { .symbols = { 0x60, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde0 */
+    { .symbols = { 0x60, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde1 */
+    { .symbols = { 0x60, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde2 */
+    { .symbols = { 0x60, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde3 */
+    { .symbols = { 0x7a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde4 */
+    { .symbols = { 0x7a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde5 */
+    { .symbols = { 0x7a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde6 */
+    { .symbols = { 0x7a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde7 */
+    { .symbols = { 0x7b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde8 */
+    { .symbols = { 0x7b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xde9 */
+    { .symbols = { 0x7b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdea */
+    { .symbols = { 0x7b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdeb */
+    { .symbols = { 0x7c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdec */
+    { .symbols = { 0x7c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xded */
+    { .symbols = { 0x7c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdee */
+    { .symbols = { 0x7c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdef */
+    { .symbols = { 0x7d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf0 */
+    { .symbols = { 0x7d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf1 */
+    { .symbols = { 0x7d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf2 */
+    { .symbols = { 0x7d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf3 */
+    { .symbols = { 0x7e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf4 */
+    { .symbols = { 0x7e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf5 */
+    { .symbols = { 0x7e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf6 */
+    { .symbols = { 0x7e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf7 */
+    { .symbols = { 0x7f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf8 */
+    { .symbols = { 0x7f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdf9 */
+    { .symbols = { 0x7f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdfa */
+    { .symbols = { 0x7f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdfb */
+    { .symbols = { 0x80, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdfc */
+    { .symbols = { 0x80, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdfd */
+    { .symbols = { 0x80, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdfe */
+    { .symbols = { 0x80, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xdff */
+    { .symbols = { 0x81, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe00 */
+    { .symbols = { 0x81, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe01 */
+    { .symbols = { 0x81, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe02 */
+    { .symbols = { 0x81, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe03 */
+    { .symbols = { 0x82, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe04 */
+    { .symbols = { 0x82, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe05 */
+    { .symbols = { 0x82, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe06 */
+    { .symbols = { 0x82, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe07 */
+    { .symbols = { 0x83, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe08 */
+    { .symbols = { 0x83, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe09 */
+    { .symbols = { 0x83, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe0a */
+    { .symbols = { 0x83, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe0b */
+    { .symbols = { 0x84, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe0c */
+    { .symbols = { 0x84, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe0d */
+    { .symbols = { 0x84, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe0e */
+    { .symbols = { 0x84, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe0f */
+    { .symbols = { 0x85, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe10 */
+    { .symbols = { 0x85, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe11 */
+    { .symbols = { 0x85, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe12 */
+    { .symbols = { 0x85, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe13 */
+    { .symbols = { 0x86, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe14 */
+    { .symbols = { 0x86, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe15 */
+    { .symbols = { 0x86, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe16 */
+    { .symbols = { 0x86, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe17 */
+    { .symbols = { 0x87, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe18 */
+    { .symbols = { 0x87, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe19 */
+    { .symbols = { 0x87, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe1a */
+    { .symbols = { 0x87, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe1b */
+    { .symbols = { 0x88, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe1c */
+    { .symbols = { 0x88, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe1d */
+    { .symbols = { 0x88, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe1e */
+    { .symbols = { 0x88, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe1f */
+    { .symbols = { 0x89, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe20 */
+    { .symbols = { 0x89, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe21 */
+    { .symbols = { 0x89, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe22 */
+    { .symbols = { 0x89, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe23 */
+    { .symbols = { 0x8a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe24 */
+    { .symbols = { 0x8a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe25 */
+    { .symbols = { 0x8a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe26 */
+    { .symbols = { 0x8a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe27 */
+    { .symbols = { 0x8b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe28 */
+    { .symbols = { 0x8b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe29 */
+    { .symbols = { 0x8b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe2a */
+    { .symbols = { 0x8b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe2b */
+    { .symbols = { 0x8c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe2c */
+    { .symbols = { 0x8c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe2d */
+    { .symbols = { 0x8c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe2e */
+    { .symbols = { 0x8c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe2f */
+    { .symbols = { 0x8d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe30 */
+    { .symbols = { 0x8d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe31 */
+    { .symbols = { 0x8d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe32 */
+    { .symbols = { 0x8d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe33 */
+    { .symbols = { 0x8e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe34 */
+    { .symbols = { 0x8e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe35 */
+    { .symbols = { 0x8e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe36 */
+    { .symbols = { 0x8e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe37 */
+    { .symbols = { 0x8f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe38 */
+    { .symbols = { 0x8f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe39 */
+    { .symbols = { 0x8f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe3a */
+    { .symbols = { 0x8f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe3b */
+    { .symbols = { 0x90, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe3c */
+    { .symbols = { 0x90, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe3d */
+    { .symbols = { 0x90, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe3e */
+    { .symbols = { 0x90, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe3f */
+    { .symbols = { 0x91, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe40 */
+    { .symbols = { 0x91, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe41 */
+    { .symbols = { 0x91, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe42 */
+    { .symbols = { 0x91, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe43 */
+    { .symbols = { 0x92, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe44 */
+    { .symbols = { 0x92, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe45 */
+    { .symbols = { 0x92, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe46 */
+    { .symbols = { 0x92, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe47 */
+    { .symbols = { 0x93, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe48 */
+    { .symbols = { 0x93, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe49 */
+    { .symbols = { 0x93, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe4a */
+    { .symbols = { 0x93, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe4b */
+    { .symbols = { 0x94, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe4c */
+    { .symbols = { 0x94, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe4d */
+    { .symbols = { 0x94, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe4e */
+    { .symbols = { 0x94, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe4f */
+    { .symbols = { 0x95, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe50 */
+    { .symbols = { 0x95, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe51 */
+    { .symbols = { 0x95, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe52 */
+    { .symbols = { 0x95, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe53 */
+    { .symbols = { 0x96, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe54 */
+    { .symbols = { 0x96, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe55 */
+    { .symbols = { 0x96, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe56 */
+    { .symbols = { 0x96, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe57 */
+    { .symbols = { 0x97, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe58 */
+    { .symbols = { 0x97, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe59 */
+    { .symbols = { 0x97, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe5a */
+    { .symbols = { 0x97, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe5b */
+    { .symbols = { 0x98, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe5c */
+    { .symbols = { 0x98, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe5d */
+    { .symbols = { 0x98, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe5e */
+    { .symbols = { 0x98, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe5f */
+    { .symbols = { 0x99, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe60 */
+    { .symbols = { 0x99, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe61 */
+    { .symbols = { 0x99, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe62 */
+    { .symbols = { 0x99, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe63 */
+    { .symbols = { 0x9a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe64 */
+    { .symbols = { 0x9a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe65 */
+    { .symbols = { 0x9a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe66 */
+    { .symbols = { 0x9a, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe67 */
+    { .symbols = { 0x9b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe68 */
+    { .symbols = { 0x9b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe69 */
+    { .symbols = { 0x9b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe6a */
+    { .symbols = { 0x9b, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe6b */
+    { .symbols = { 0x9c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe6c */
+    { .symbols = { 0x9c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe6d */
+    { .symbols = { 0x9c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe6e */
+    { .symbols = { 0x9c, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe6f */
+    { .symbols = { 0x9d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe70 */
+    { .symbols = { 0x9d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe71 */
+    { .symbols = { 0x9d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe72 */
+    { .symbols = { 0x9d, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe73 */
+    { .symbols = { 0x9e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe74 */
+    { .symbols = { 0x9e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe75 */
+    { .symbols = { 0x9e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe76 */
+    { .symbols = { 0x9e, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe77 */
+    { .symbols = { 0x9f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe78 */
+    { .symbols = { 0x9f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe79 */
+    { .symbols = { 0x9f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe7a */
+    { .symbols = { 0x9f, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe7b */
+    { .symbols = { 0xa0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe7c */
+    { .symbols = { 0xa0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe7d */
+    { .symbols = { 0xa0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe7e */
+    { .symbols = { 0xa0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe7f */
+    { .symbols = { 0xa1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe80 */
+    { .symbols = { 0xa1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe81 */
+    { .symbols = { 0xa1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe82 */
+    { .symbols = { 0xa1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe83 */
+    { .symbols = { 0xa2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe84 */
+    { .symbols = { 0xa2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe85 */
+    { .symbols = { 0xa2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe86 */
+    { .symbols = { 0xa2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe87 */
+    { .symbols = { 0xa3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe88 */
+    { .symbols = { 0xa3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe89 */
+    { .symbols = { 0xa3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe8a */
+    { .symbols = { 0xa3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe8b */
+    { .symbols = { 0xa4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe8c */
+    { .symbols = { 0xa4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe8d */
+    { .symbols = { 0xa4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe8e */
+    { .symbols = { 0xa4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe8f */
+    { .symbols = { 0xa5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe90 */
+    { .symbols = { 0xa5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe91 */
+    { .symbols = { 0xa5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe92 */
+    { .symbols = { 0xa5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe93 */
+    { .symbols = { 0xa6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe94 */
+    { .symbols = { 0xa6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe95 */
+    { .symbols = { 0xa6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe96 */
+    { .symbols = { 0xa6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe97 */
+    { .symbols = { 0xa7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe98 */
+    { .symbols = { 0xa7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe99 */
+    { .symbols = { 0xa7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe9a */
+    { .symbols = { 0xa7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe9b */
+    { .symbols = { 0xa8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe9c */
+    { .symbols = { 0xa8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe9d */
+    { .symbols = { 0xa8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe9e */
+    { .symbols = { 0xa8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xe9f */
+    { .symbols = { 0xa9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea0 */
+    { .symbols = { 0xa9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea1 */
+    { .symbols = { 0xa9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea2 */
+    { .symbols = { 0xa9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea3 */
+    { .symbols = { 0xaa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea4 */
+    { .symbols = { 0xaa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea5 */
+    { .symbols = { 0xaa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea6 */
+    { .symbols = { 0xaa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea7 */
+    { .symbols = { 0xab, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea8 */
+    { .symbols = { 0xab, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xea9 */
+    { .symbols = { 0xab, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeaa */
+    { .symbols = { 0xab, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeab */
+    { .symbols = { 0xac, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeac */
+    { .symbols = { 0xac, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xead */
+    { .symbols = { 0xac, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeae */
+    { .symbols = { 0xac, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeaf */
+    { .symbols = { 0xad, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb0 */
+    { .symbols = { 0xad, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb1 */
+    { .symbols = { 0xad, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb2 */
+    { .symbols = { 0xad, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb3 */
+    { .symbols = { 0xae, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb4 */
+    { .symbols = { 0xae, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb5 */
+    { .symbols = { 0xae, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb6 */
+    { .symbols = { 0xae, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb7 */
+    { .symbols = { 0xaf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb8 */
+    { .symbols = { 0xaf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeb9 */
+    { .symbols = { 0xaf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeba */
+    { .symbols = { 0xaf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xebb */
+    { .symbols = { 0xb0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xebc */
+    { .symbols = { 0xb0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xebd */
+    { .symbols = { 0xb0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xebe */
+    { .symbols = { 0xb0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xebf */
+    { .symbols = { 0xb1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec0 */
+    { .symbols = { 0xb1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec1 */
+    { .symbols = { 0xb1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec2 */
+    { .symbols = { 0xb1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec3 */
+    { .symbols = { 0xb2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec4 */
+    { .symbols = { 0xb2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec5 */
+    { .symbols = { 0xb2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec6 */
+    { .symbols = { 0xb2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec7 */
+    { .symbols = { 0xb3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec8 */
+    { .symbols = { 0xb3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xec9 */
+    { .symbols = { 0xb3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeca */
+    { .symbols = { 0xb3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xecb */
+    { .symbols = { 0xb4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xecc */
+    { .symbols = { 0xb4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xecd */
+    { .symbols = { 0xb4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xece */
+    { .symbols = { 0xb4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xecf */
+    { .symbols = { 0xb5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed0 */
+    { .symbols = { 0xb5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed1 */
+    { .symbols = { 0xb5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed2 */
+    { .symbols = { 0xb5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed3 */
+    { .symbols = { 0xb6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed4 */
+    { .symbols = { 0xb6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed5 */
+    { .symbols = { 0xb6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed6 */
+    { .symbols = { 0xb6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed7 */
+    { .symbols = { 0xb7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed8 */
+    { .symbols = { 0xb7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xed9 */
+    { .symbols = { 0xb7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeda */
+    { .symbols = { 0xb7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xedb */
+    { .symbols = { 0xb8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xedc */
+    { .symbols = { 0xb8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xedd */
+    { .symbols = { 0xb8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xede */
+    { .symbols = { 0xb8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xedf */
+    { .symbols = { 0xb9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee0 */
+    { .symbols = { 0xb9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee1 */
+    { .symbols = { 0xb9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee2 */
+    { .symbols = { 0xb9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee3 */
+    { .symbols = { 0xba, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee4 */
+    { .symbols = { 0xba, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee5 */
+    { .symbols = { 0xba, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee6 */
+    { .symbols = { 0xba, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee7 */
+    { .symbols = { 0xbb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee8 */
+    { .symbols = { 0xbb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xee9 */
+    { .symbols = { 0xbb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeea */
+    { .symbols = { 0xbb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeeb */
+    { .symbols = { 0xbc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeec */
+    { .symbols = { 0xbc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeed */
+    { .symbols = { 0xbc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeee */
+    { .symbols = { 0xbc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeef */
+    { .symbols = { 0xbd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef0 */
+    { .symbols = { 0xbd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef1 */
+    { .symbols = { 0xbd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef2 */
+    { .symbols = { 0xbd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef3 */
+    { .symbols = { 0xbe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef4 */
+    { .symbols = { 0xbe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef5 */
+    { .symbols = { 0xbe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef6 */
+    { .symbols = { 0xbe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef7 */
+    { .symbols = { 0xbf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef8 */
+    { .symbols = { 0xbf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xef9 */
+    { .symbols = { 0xbf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xefa */
+    { .symbols = { 0xbf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xefb */
+    { .symbols = { 0xc0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xefc */
+    { .symbols = { 0xc0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xefd */
+    { .symbols = { 0xc0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xefe */
+    { .symbols = { 0xc0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xeff */
+    { .symbols = { 0xc1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf00 */
+    { .symbols = { 0xc1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf01 */
+    { .symbols = { 0xc1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf02 */
+    { .symbols = { 0xc1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf03 */
+    { .symbols = { 0xc2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf04 */
+    { .symbols = { 0xc2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf05 */
+    { .symbols = { 0xc2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf06 */
+    { .symbols = { 0xc2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf07 */
+    { .symbols = { 0xc3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf08 */
+    { .symbols = { 0xc3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf09 */
+    { .symbols = { 0xc3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf0a */
+    { .symbols = { 0xc3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf0b */
+    { .symbols = { 0xc4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf0c */
+    { .symbols = { 0xc4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf0d */
+    { .symbols = { 0xc4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf0e */
+    { .symbols = { 0xc4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf0f */
+    { .symbols = { 0xc5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf10 */
+    { .symbols = { 0xc5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf11 */
+    { .symbols = { 0xc5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf12 */
+    { .symbols = { 0xc5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf13 */
+    { .symbols = { 0xc6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf14 */
+    { .symbols = { 0xc6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf15 */
+    { .symbols = { 0xc6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf16 */
+    { .symbols = { 0xc6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf17 */
+    { .symbols = { 0xc7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf18 */
+    { .symbols = { 0xc7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf19 */
+    { .symbols = { 0xc7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf1a */
+    { .symbols = { 0xc7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf1b */
+    { .symbols = { 0xc8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf1c */
+    { .symbols = { 0xc8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf1d */
+    { .symbols = { 0xc8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf1e */
+    { .symbols = { 0xc8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf1f */
+    { .symbols = { 0xc9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf20 */
+    { .symbols = { 0xc9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf21 */
+    { .symbols = { 0xc9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf22 */
+    { .symbols = { 0xc9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf23 */
+    { .symbols = { 0xca, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf24 */
+    { .symbols = { 0xca, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf25 */
+    { .symbols = { 0xca, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf26 */
+    { .symbols = { 0xca, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf27 */
+    { .symbols = { 0xcb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf28 */
+    { .symbols = { 0xcb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf29 */
+    { .symbols = { 0xcb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf2a */
+    { .symbols = { 0xcb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf2b */
+    { .symbols = { 0xcc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf2c */
+    { .symbols = { 0xcc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf2d */
+    { .symbols = { 0xcc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf2e */
+    { .symbols = { 0xcc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf2f */
+    { .symbols = { 0xcd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf30 */
+    { .symbols = { 0xcd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf31 */
+    { .symbols = { 0xcd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf32 */
+    { .symbols = { 0xcd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf33 */
+    { .symbols = { 0xce, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf34 */
+    { .symbols = { 0xce, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf35 */
+    { .symbols = { 0xce, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf36 */
+    { .symbols = { 0xce, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf37 */
+    { .symbols = { 0xcf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf38 */
+    { .symbols = { 0xcf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf39 */
+    { .symbols = { 0xcf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf3a */
+    { .symbols = { 0xcf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf3b */
+    { .symbols = { 0xd0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf3c */
+    { .symbols = { 0xd0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf3d */
+    { .symbols = { 0xd0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf3e */
+    { .symbols = { 0xd0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf3f */
+    { .symbols = { 0xd1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf40 */
+    { .symbols = { 0xd1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf41 */
+    { .symbols = { 0xd1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf42 */
+    { .symbols = { 0xd1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf43 */
+    { .symbols = { 0xd2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf44 */
+    { .symbols = { 0xd2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf45 */
+    { .symbols = { 0xd2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf46 */
+    { .symbols = { 0xd2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf47 */
+    { .symbols = { 0xd3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf48 */
+    { .symbols = { 0xd3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf49 */
+    { .symbols = { 0xd3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf4a */
+    { .symbols = { 0xd3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf4b */
+    { .symbols = { 0xd4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf4c */
+    { .symbols = { 0xd4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf4d */
+    { .symbols = { 0xd4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf4e */
+    { .symbols = { 0xd4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf4f */
+    { .symbols = { 0xd5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf50 */
+    { .symbols = { 0xd5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf51 */
+    { .symbols = { 0xd5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf52 */
+    { .symbols = { 0xd5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf53 */
+    { .symbols = { 0xd6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf54 */
+    { .symbols = { 0xd6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf55 */
+    { .symbols = { 0xd6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf56 */
+    { .symbols = { 0xd6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf57 */
+    { .symbols = { 0xd7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf58 */
+    { .symbols = { 0xd7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf59 */
+    { .symbols = { 0xd7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf5a */
+    { .symbols = { 0xd7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf5b */
+    { .symbols = { 0xd8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf5c */
+    { .symbols = { 0xd8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf5d */
+    { .symbols = { 0xd8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf5e */
+    { .symbols = { 0xd8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf5f */
+    { .symbols = { 0xd9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf60 */
+    { .symbols = { 0xd9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf61 */
+    { .symbols = { 0xd9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf62 */
+    { .symbols = { 0xd9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf63 */
+    { .symbols = { 0xda, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf64 */
+    { .symbols = { 0xda, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf65 */
+    { .symbols = { 0xda, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf66 */
+    { .symbols = { 0xda, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf67 */
+    { .symbols = { 0xdb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf68 */
+    { .symbols = { 0xdb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf69 */
+    { .symbols = { 0xdb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf6a */
+    { .symbols = { 0xdb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf6b */
+    { .symbols = { 0xdc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf6c */
+    { .symbols = { 0xdc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf6d */
+    { .symbols = { 0xdc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf6e */
+    { .symbols = { 0xdc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf6f */
+    { .symbols = { 0xdd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf70 */
+    { .symbols = { 0xdd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf71 */
+    { .symbols = { 0xdd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf72 */
+    { .symbols = { 0xdd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf73 */
+    { .symbols = { 0xde, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf74 */
+    { .symbols = { 0xde, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf75 */
+    { .symbols = { 0xde, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf76 */
+    { .symbols = { 0xde, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf77 */
+    { .symbols = { 0xdf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf78 */
+    { .symbols = { 0xdf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf79 */
+    { .symbols = { 0xdf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf7a */
+    { .symbols = { 0xdf, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf7b */
+    { .symbols = { 0xe0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf7c */
+    { .symbols = { 0xe0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf7d */
+    { .symbols = { 0xe0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf7e */
+    { .symbols = { 0xe0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf7f */
+    { .symbols = { 0xe1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf80 */
+    { .symbols = { 0xe1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf81 */
+    { .symbols = { 0xe1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf82 */
+    { .symbols = { 0xe1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf83 */
+    { .symbols = { 0xe2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf84 */
+    { .symbols = { 0xe2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf85 */
+    { .symbols = { 0xe2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf86 */
+    { .symbols = { 0xe2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf87 */
+    { .symbols = { 0xe3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf88 */
+    { .symbols = { 0xe3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf89 */
+    { .symbols = { 0xe3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf8a */
+    { .symbols = { 0xe3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf8b */
+    { .symbols = { 0xe4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf8c */
+    { .symbols = { 0xe4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf8d */
+    { .symbols = { 0xe4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf8e */
+    { .symbols = { 0xe4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf8f */
+    { .symbols = { 0xe5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf90 */
+    { .symbols = { 0xe5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf91 */
+    { .symbols = { 0xe5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf92 */
+    { .symbols = { 0xe5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf93 */
+    { .symbols = { 0xe6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf94 */
+    { .symbols = { 0xe6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf95 */
+    { .symbols = { 0xe6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf96 */
+    { .symbols = { 0xe6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf97 */
+    { .symbols = { 0xe7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf98 */
+    { .symbols = { 0xe7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf99 */
+    { .symbols = { 0xe7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf9a */
+    { .symbols = { 0xe7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf9b */
+    { .symbols = { 0xe8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf9c */
+    { .symbols = { 0xe8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf9d */
+    { .symbols = { 0xe8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf9e */
+    { .symbols = { 0xe8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xf9f */
+    { .symbols = { 0xe9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa0 */
+    { .symbols = { 0xe9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa1 */
+    { .symbols = { 0xe9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa2 */
+    { .symbols = { 0xe9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa3 */
+    { .symbols = { 0xea, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa4 */
+    { .symbols = { 0xea, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa5 */
+    { .symbols = { 0xea, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa6 */
+    { .symbols = { 0xea, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa7 */
+    { .symbols = { 0xeb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa8 */
+    { .symbols = { 0xeb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfa9 */
+    { .symbols = { 0xeb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfaa */
+    { .symbols = { 0xeb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfab */
+    { .symbols = { 0xec, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfac */
+    { .symbols = { 0xec, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfad */
+    { .symbols = { 0xec, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfae */
+    { .symbols = { 0xec, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfaf */
+    { .symbols = { 0xed, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb0 */
+    { .symbols = { 0xed, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb1 */
+    { .symbols = { 0xed, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb2 */
+    { .symbols = { 0xed, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb3 */
+    { .symbols = { 0xee, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb4 */
+    { .symbols = { 0xee, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb5 */
+    { .symbols = { 0xee, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb6 */
+    { .symbols = { 0xee, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb7 */
+    { .symbols = { 0xef, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb8 */
+    { .symbols = { 0xef, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfb9 */
+    { .symbols = { 0xef, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfba */
+    { .symbols = { 0xef, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfbb */
+    { .symbols = { 0xf0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfbc */
+    { .symbols = { 0xf0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfbd */
+    { .symbols = { 0xf0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfbe */
+    { .symbols = { 0xf0, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfbf */
+    { .symbols = { 0xf1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc0 */
+    { .symbols = { 0xf1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc1 */
+    { .symbols = { 0xf1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc2 */
+    { .symbols = { 0xf1, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc3 */
+    { .symbols = { 0xf2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc4 */
+    { .symbols = { 0xf2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc5 */
+    { .symbols = { 0xf2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc6 */
+    { .symbols = { 0xf2, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc7 */
+    { .symbols = { 0xf3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc8 */
+    { .symbols = { 0xf3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfc9 */
+    { .symbols = { 0xf3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfca */
+    { .symbols = { 0xf3, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfcb */
+    { .symbols = { 0xf4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfcc */
+    { .symbols = { 0xf4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfcd */
+    { .symbols = { 0xf4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfce */
+    { .symbols = { 0xf4, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfcf */
+    { .symbols = { 0xf5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd0 */
+    { .symbols = { 0xf5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd1 */
+    { .symbols = { 0xf5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd2 */
+    { .symbols = { 0xf5, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd3 */
+    { .symbols = { 0xf6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd4 */
+    { .symbols = { 0xf6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd5 */
+    { .symbols = { 0xf6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd6 */
+    { .symbols = { 0xf6, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd7 */
+    { .symbols = { 0xf7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd8 */
+    { .symbols = { 0xf7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfd9 */
+    { .symbols = { 0xf7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfda */
+    { .symbols = { 0xf7, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfdb */
+    { .symbols = { 0xf8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfdc */
+    { .symbols = { 0xf8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfdd */
+    { .symbols = { 0xf8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfde */
+    { .symbols = { 0xf8, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfdf */
+    { .symbols = { 0xf9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe0 */
+    { .symbols = { 0xf9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe1 */
+    { .symbols = { 0xf9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe2 */
+    { .symbols = { 0xf9, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe3 */
+    { .symbols = { 0xfa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe4 */
+    { .symbols = { 0xfa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe5 */
+    { .symbols = { 0xfa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe6 */
+    { .symbols = { 0xfa, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe7 */
+    { .symbols = { 0xfb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe8 */
+    { .symbols = { 0xfb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfe9 */
+    { .symbols = { 0xfb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfea */
+    { .symbols = { 0xfb, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfeb */
+    { .symbols = { 0xfc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfec */
+    { .symbols = { 0xfc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfed */
+    { .symbols = { 0xfc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfee */
+    { .symbols = { 0xfc, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xfef */
+    { .symbols = { 0xfd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff0 */
+    { .symbols = { 0xfd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff1 */
+    { .symbols = { 0xfd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff2 */
+    { .symbols = { 0xfd, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff3 */
+    { .symbols = { 0xfe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff4 */
+    { .symbols = { 0xfe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff5 */
+    { .symbols = { 0xfe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff6 */
+    { .symbols = { 0xfe, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff7 */
+    { .symbols = { 0xff, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff8 */
+    { .symbols = { 0xff, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xff9 */
+    { .symbols = { 0xff, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xffa */
+    { .symbols = { 0xff, 0x0, 0x0, 0x0 }, .num_symbols = 1, .num_bits = 10 }, /* 0xffb */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xffc */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xffd */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xffe */
+    { .symbols = { 0x0, 0x0, 0x0, 0x0 }, .num_symbols = 0, .num_bits = 0 }, /* 0xfff */
+};
+
+static const struct aws_huffman_multi_symbol_table multi_symbol_table = {
+    .entries = multi_symbol_entries,
+    .index_bits = 12,
+};
+
+struct aws_huffman_symbol_coder *test_multi_symbol_get_coder(void) {
+
+    static struct aws_huffman_symbol_coder coder = {
+        .encode = encode_symbol,
+        .decode = decode_symbol,
+        .userdata = NULL,
+        .encode_table = code_points,
+        .code_lengths = code_lengths,
+        .decode_table = &decode_table,
+        .multi_symbol_table = &multi_symbol_table,
+    };
+    return &coder;
+}
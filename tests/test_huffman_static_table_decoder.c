@@ -0,0 +1,1181 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+/* WARNING: THIS FILE WAS AUTOMATICALLY GENERATED. DO NOT EDIT. */
+/* clang-format off */
+
+#include <aws/compression/huffman.h>
+
+struct aws_huffman_symbol_coder *test_table_get_coder(void);
+int test_table_encode(struct aws_byte_cursor *to_encode, struct aws_byte_buf *output);
+int test_table_decode(struct aws_byte_cursor *to_decode, struct aws_byte_buf *output);
+
+static const struct aws_huffman_code code_points[] = {
+    { .pattern = 0x32e, .num_bits = 10 }, /* ' ' 0 */
+    { .pattern = 0x32f, .num_bits = 10 }, /* ' ' 1 */
+    { .pattern = 0x330, .num_bits = 10 }, /* ' ' 2 */
+    { .pattern = 0x331, .num_bits = 10 }, /* ' ' 3 */
+    { .pattern = 0x332, .num_bits = 10 }, /* ' ' 4 */
+    { .pattern = 0x333, .num_bits = 10 }, /* ' ' 5 */
+    { .pattern = 0x334, .num_bits = 10 }, /* ' ' 6 */
+    { .pattern = 0x335, .num_bits = 10 }, /* ' ' 7 */
+    { .pattern = 0x336, .num_bits = 10 }, /* ' ' 8 */
+    { .pattern = 0x337, .num_bits = 10 }, /* ' ' 9 */
+    { .pattern = 0xb8, .num_bits = 8 }, /* ' ' 10 */
+    { .pattern = 0x338, .num_bits = 10 }, /* ' ' 11 */
+    { .pattern = 0x339, .num_bits = 10 }, /* ' ' 12 */
+    { .pattern = 0x33a, .num_bits = 10 }, /* ' ' 13 */
+    { .pattern = 0x33b, .num_bits = 10 }, /* ' ' 14 */
+    { .pattern = 0x33c, .num_bits = 10 }, /* ' ' 15 */
+    { .pattern = 0x33d, .num_bits = 10 }, /* ' ' 16 */
+    { .pattern = 0x33e, .num_bits = 10 }, /* ' ' 17 */
+    { .pattern = 0x33f, .num_bits = 10 }, /* ' ' 18 */
+    { .pattern = 0x340, .num_bits = 10 }, /* ' ' 19 */
+    { .pattern = 0x341, .num_bits = 10 }, /* ' ' 20 */
+    { .pattern = 0x342, .num_bits = 10 }, /* ' ' 21 */
+    { .pattern = 0x343, .num_bits = 10 }, /* ' ' 22 */
+    { .pattern = 0x344, .num_bits = 10 }, /* ' ' 23 */
+    { .pattern = 0x345, .num_bits = 10 }, /* ' ' 24 */
+    { .pattern = 0x346, .num_bits = 10 }, /* ' ' 25 */
+    { .pattern = 0x347, .num_bits = 10 }, /* ' ' 26 */
+    { .pattern = 0x348, .num_bits = 10 }, /* ' ' 27 */
+    { .pattern = 0x349, .num_bits = 10 }, /* ' ' 28 */
+    { .pattern = 0x34a, .num_bits = 10 }, /* ' ' 29 */
+    { .pattern = 0x34b, .num_bits = 10 }, /* ' ' 30 */
+    { .pattern = 0x34c, .num_bits = 10 }, /* ' ' 31 */
+    { .pattern = 0x4, .num_bits = 5 }, /* ' ' 32 */
+    { .pattern = 0x34d, .num_bits = 10 }, /* '!' 33 */
+    { .pattern = 0x34e, .num_bits = 10 }, /* '"' 34 */
+    { .pattern = 0x34f, .num_bits = 10 }, /* '#' 35 */
+    { .pattern = 0x350, .num_bits = 10 }, /* '$' 36 */
+    { .pattern = 0x351, .num_bits = 10 }, /* '%' 37 */
+    { .pattern = 0x352, .num_bits = 10 }, /* '&' 38 */
+    { .pattern = 0x56, .num_bits = 7 }, /* ''' 39 */
+    { .pattern = 0x353, .num_bits = 10 }, /* '(' 40 */
+    { .pattern = 0x354, .num_bits = 10 }, /* ')' 41 */
+    { .pattern = 0x355, .num_bits = 10 }, /* '*' 42 */
+    { .pattern = 0x356, .num_bits = 10 }, /* '+' 43 */
+    { .pattern = 0xb9, .num_bits = 8 }, /* ',' 44 */
+    { .pattern = 0x188, .num_bits = 9 }, /* '-' 45 */
+    { .pattern = 0x57, .num_bits = 7 }, /* '.' 46 */
+    { .pattern = 0x357, .num_bits = 10 }, /* '/' 47 */
+    { .pattern = 0x358, .num_bits = 10 }, /* '0' 48 */
+    { .pattern = 0x359, .num_bits = 10 }, /* '1' 49 */
+    { .pattern = 0x35a, .num_bits = 10 }, /* '2' 50 */
+    { .pattern = 0x35b, .num_bits = 10 }, /* '3' 51 */
+    { .pattern = 0x35c, .num_bits = 10 }, /* '4' 52 */
+    { .pattern = 0x35d, .num_bits = 10 }, /* '5' 53 */
+    { .pattern = 0x35e, .num_bits = 10 }, /* '6' 54 */
+    { .pattern = 0x35f, .num_bits = 10 }, /* '7' 55 */
+    { .pattern = 0x360, .num_bits = 10 }, /* '8' 56 */
+    { .pattern = 0x361, .num_bits = 10 }, /* '9' 57 */
+    { .pattern = 0x362, .num_bits = 10 }, /* ':' 58 */
+    { .pattern = 0x363, .num_bits = 10 }, /* ';' 59 */
+    { .pattern = 0x364, .num_bits = 10 }, /* '<' 60 */
+    { .pattern = 0x365, .num_bits = 10 }, /* '=' 61 */
+    { .pattern = 0x366, .num_bits = 10 }, /* '>' 62 */
+    { .pattern = 0xba, .num_bits = 8 }, /* '?' 63 */
+    { .pattern = 0x367, .num_bits = 10 }, /* '@' 64 */
+    { .pattern = 0x368, .num_bits = 10 }, /* 'A' 65 */
+    { .pattern = 0xbb, .num_bits = 8 }, /* 'B' 66 */
+    { .pattern = 0x189, .num_bits = 9 }, /* 'C' 67 */
+    { .pattern = 0x18a, .num_bits = 9 }, /* 'D' 68 */
+    { .pattern = 0x18b, .num_bits = 9 }, /* 'E' 69 */
+    { .pattern = 0x18c, .num_bits = 9 }, /* 'F' 70 */
+    { .pattern = 0x18d, .num_bits = 9 }, /* 'G' 71 */
+    { .pattern = 0x18e, .num_bits = 9 }, /* 'H' 72 */
+    { .pattern = 0xbc, .num_bits = 8 }, /* 'I' 73 */
+    { .pattern = 0x369, .num_bits = 10 }, /* 'J' 74 */
+    { .pattern = 0x36a, .num_bits = 10 }, /* 'K' 75 */
+    { .pattern = 0x18f, .num_bits = 9 }, /* 'L' 76 */
+    { .pattern = 0x190, .num_bits = 9 }, /* 'M' 77 */
+    { .pattern = 0x36b, .num_bits = 10 }, /* 'N' 78 */
+    { .pattern = 0x36c, .num_bits = 10 }, /* 'O' 79 */
+    { .pattern = 0x191, .num_bits = 9 }, /* 'P' 80 */
+    { .pattern = 0x36d, .num_bits = 10 }, /* 'Q' 81 */
+    { .pattern = 0x36e, .num_bits = 10 }, /* 'R' 82 */
+    { .pattern = 0x36f, .num_bits = 10 }, /* 'S' 83 */
+    { .pattern = 0xbd, .num_bits = 8 }, /* 'T' 84 */
+    { .pattern = 0x370, .num_bits = 10 }, /* 'U' 85 */
+    { .pattern = 0x192, .num_bits = 9 }, /* 'V' 86 */
+    { .pattern = 0xbe, .num_bits = 8 }, /* 'W' 87 */
+    { .pattern = 0x371, .num_bits = 10 }, /* 'X' 88 */
+    { .pattern = 0x193, .num_bits = 9 }, /* 'Y' 89 */
+    { .pattern = 0x372, .num_bits = 10 }, /* 'Z' 90 */
+    { .pattern = 0x373, .num_bits = 10 }, /* '[' 91 */
+    { .pattern = 0x374, .num_bits = 10 }, /* '\' 92 */
+    { .pattern = 0x375, .num_bits = 10 }, /* ']' 93 */
+    { .pattern = 0x376, .num_bits = 10 }, /* '^' 94 */
+    { .pattern = 0x377, .num_bits = 10 }, /* '_' 95 */
+    { .pattern = 0x378, .num_bits = 10 }, /* '`' 96 */
+    { .pattern = 0x5, .num_bits = 5 }, /* 'a' 97 */
+    { .pattern = 0x58, .num_bits = 7 }, /* 'b' 98 */
+    { .pattern = 0x20, .num_bits = 6 }, /* 'c' 99 */
+    { .pattern = 0x21, .num_bits = 6 }, /* 'd' 100 */
+    { .pattern = 0x6, .num_bits = 5 }, /* 'e' 101 */
+    { .pattern = 0x22, .num_bits = 6 }, /* 'f' 102 */
+    { .pattern = 0x59, .num_bits = 7 }, /* 'g' 103 */
+    { .pattern = 0x23, .num_bits = 6 }, /* 'h' 104 */
+    { .pattern = 0x7, .num_bits = 5 }, /* 'i' 105 */
+    { .pattern = 0xbf, .num_bits = 8 }, /* 'j' 106 */
+    { .pattern = 0x24, .num_bits = 6 }, /* 'k' 107 */
+    { .pattern = 0x25, .num_bits = 6 }, /* 'l' 108 */
+    { .pattern = 0x26, .num_bits = 6 }, /* 'm' 109 */
+    { .pattern = 0x8, .num_bits = 5 }, /* 'n' 110 */
+    { .pattern = 0x9, .num_bits = 5 }, /* 'o' 111 */
+    { .pattern = 0x5a, .num_bits = 7 }, /* 'p' 112 */
+    { .pattern = 0x194, .num_bits = 9 }, /* 'q' 113 */
+    { .pattern = 0xa, .num_bits = 5 }, /* 'r' 114 */
+    { .pattern = 0xb, .num_bits = 5 }, /* 's' 115 */
+    { .pattern = 0xc, .num_bits = 5 }, /* 't' 116 */
+    { .pattern = 0xd, .num_bits = 5 }, /* 'u' 117 */
+    { .pattern = 0xc0, .num_bits = 8 }, /* 'v' 118 */
+    { .pattern = 0x27, .num_bits = 6 }, /* 'w' 119 */
+    { .pattern = 0xc1, .num_bits = 8 }, /* 'x' 120 */
+    { .pattern = 0x28, .num_bits = 6 }, /* 'y' 121 */
+    { .pattern = 0x379, .num_bits = 10 }, /* 'z' 122 */
+    { .pattern = 0x37a, .num_bits = 10 }, /* '{' 123 */
+    { .pattern = 0x37b, .num_bits = 10 }, /* '|' 124 */
+    { .pattern = 0x37c, .num_bits = 10 }, /* '}' 125 */
+    { .pattern = 0x37d, .num_bits = 10 }, /* '~' 126 */
+    { .pattern = 0x37e, .num_bits = 10 }, /* ' ' 127 */
+    { .pattern = 0x37f, .num_bits = 10 }, /* ' ' 128 */
+    { .pattern = 0x380, .num_bits = 10 }, /* ' ' 129 */
+    { .pattern = 0x381, .num_bits = 10 }, /* ' ' 130 */
+    { .pattern = 0x382, .num_bits = 10 }, /* ' ' 131 */
+    { .pattern = 0x383, .num_bits = 10 }, /* ' ' 132 */
+    { .pattern = 0x384, .num_bits = 10 }, /* ' ' 133 */
+    { .pattern = 0x385, .num_bits = 10 }, /* ' ' 134 */
+    { .pattern = 0x386, .num_bits = 10 }, /* ' ' 135 */
+    { .pattern = 0x387, .num_bits = 10 }, /* ' ' 136 */
+    { .pattern = 0x388, .num_bits = 10 }, /* ' ' 137 */
+    { .pattern = 0x389, .num_bits = 10 }, /* ' ' 138 */
+    { .pattern = 0x38a, .num_bits = 10 }, /* ' ' 139 */
+    { .pattern = 0x38b, .num_bits = 10 }, /* ' ' 140 */
+    { .pattern = 0x38c, .num_bits = 10 }, /* ' ' 141 */
+    { .pattern = 0x38d, .num_bits = 10 }, /* ' ' 142 */
+    { .pattern = 0x38e, .num_bits = 10 }, /* ' ' 143 */
+    { .pattern = 0x38f, .num_bits = 10 }, /* ' ' 144 */
+    { .pattern = 0x390, .num_bits = 10 }, /* ' ' 145 */
+    { .pattern = 0x391, .num_bits = 10 }, /* ' ' 146 */
+    { .pattern = 0x392, .num_bits = 10 }, /* ' ' 147 */
+    { .pattern = 0x393, .num_bits = 10 }, /* ' ' 148 */
+    { .pattern = 0x394, .num_bits = 10 }, /* ' ' 149 */
+    { .pattern = 0x395, .num_bits = 10 }, /* ' ' 150 */
+    { .pattern = 0x396, .num_bits = 10 }, /* ' ' 151 */
+    { .pattern = 0x397, .num_bits = 10 }, /* ' ' 152 */
+    { .pattern = 0x398, .num_bits = 10 }, /* ' ' 153 */
+    { .pattern = 0x399, .num_bits = 10 }, /* ' ' 154 */
+    { .pattern = 0x39a, .num_bits = 10 }, /* ' ' 155 */
+    { .pattern = 0x39b, .num_bits = 10 }, /* ' ' 156 */
+    { .pattern = 0x39c, .num_bits = 10 }, /* ' ' 157 */
+    { .pattern = 0x39d, .num_bits = 10 }, /* ' ' 158 */
+    { .pattern = 0x39e, .num_bits = 10 }, /* ' ' 159 */
+    { .pattern = 0x39f, .num_bits = 10 }, /* ' ' 160 */
+    { .pattern = 0x3a0, .num_bits = 10 }, /* ' ' 161 */
+    { .pattern = 0x3a1, .num_bits = 10 }, /* ' ' 162 */
+    { .pattern = 0x3a2, .num_bits = 10 }, /* ' ' 163 */
+    { .pattern = 0x3a3, .num_bits = 10 }, /* ' ' 164 */
+    { .pattern = 0x3a4, .num_bits = 10 }, /* ' ' 165 */
+    { .pattern = 0x3a5, .num_bits = 10 }, /* ' ' 166 */
+    { .pattern = 0x3a6, .num_bits = 10 }, /* ' ' 167 */
+    { .pattern = 0x3a7, .num_bits = 10 }, /* ' ' 168 */
+    { .pattern = 0x3a8, .num_bits = 10 }, /* ' ' 169 */
+    { .pattern = 0x3a9, .num_bits = 10 }, /* ' ' 170 */
+    { .pattern = 0x3aa, .num_bits = 10 }, /* ' ' 171 */
+    { .pattern = 0x3ab, .num_bits = 10 }, /* ' ' 172 */
+    { .pattern = 0x3ac, .num_bits = 10 }, /* ' ' 173 */
+    { .pattern = 0x3ad, .num_bits = 10 }, /* ' ' 174 */
+    { .pattern = 0x3ae, .num_bits = 10 }, /* ' ' 175 */
+    { .pattern = 0x3af, .num_bits = 10 }, /* ' ' 176 */
+    { .pattern = 0x3b0, .num_bits = 10 }, /* ' ' 177 */
+    { .pattern = 0x3b1, .num_bits = 10 }, /* ' ' 178 */
+    { .pattern = 0x3b2, .num_bits = 10 }, /* ' ' 179 */
+    { .pattern = 0x3b3, .num_bits = 10 }, /* ' ' 180 */
+    { .pattern = 0x3b4, .num_bits = 10 }, /* ' ' 181 */
+    { .pattern = 0x3b5, .num_bits = 10 }, /* ' ' 182 */
+    { .pattern = 0x3b6, .num_bits = 10 }, /* ' ' 183 */
+    { .pattern = 0x3b7, .num_bits = 10 }, /* ' ' 184 */
+    { .pattern = 0x3b8, .num_bits = 10 }, /* ' ' 185 */
+    { .pattern = 0x3b9, .num_bits = 10 }, /* ' ' 186 */
+    { .pattern = 0x3ba, .num_bits = 10 }, /* ' ' 187 */
+    { .pattern = 0x3bb, .num_bits = 10 }, /* ' ' 188 */
+    { .pattern = 0x3bc, .num_bits = 10 }, /* ' ' 189 */
+    { .pattern = 0x3bd, .num_bits = 10 }, /* ' ' 190 */
+    { .pattern = 0x3be, .num_bits = 10 }, /* ' ' 191 */
+    { .pattern = 0x3bf, .num_bits = 10 }, /* ' ' 192 */
+    { .pattern = 0x3c0, .num_bits = 10 }, /* ' ' 193 */
+    { .pattern = 0x3c1, .num_bits = 10 }, /* ' ' 194 */
+    { .pattern = 0x3c2, .num_bits = 10 }, /* ' ' 195 */
+    { .pattern = 0x3c3, .num_bits = 10 }, /* ' ' 196 */
+    { .pattern = 0x3c4, .num_bits = 10 }, /* ' ' 197 */
+    { .pattern = 0x3c5, .num_bits = 10 }, /* ' ' 198 */
+    { .pattern = 0x3c6, .num_bits = 10 }, /* ' ' 199 */
+    { .pattern = 0x3c7, .num_bits = 10 }, /* ' ' 200 */
+    { .pattern = 0x3c8, .num_bits = 10 }, /* ' ' 201 */
+    { .pattern = 0x3c9, .num_bits = 10 }, /* ' ' 202 */
+    { .pattern = 0x3ca, .num_bits = 10 }, /* ' ' 203 */
+    { .pattern = 0x3cb, .num_bits = 10 }, /* ' ' 204 */
+    { .pattern = 0x3cc, .num_bits = 10 }, /* ' ' 205 */
+    { .pattern = 0x3cd, .num_bits = 10 }, /* ' ' 206 */
+    { .pattern = 0x3ce, .num_bits = 10 }, /* ' ' 207 */
+    { .pattern = 0x3cf, .num_bits = 10 }, /* ' ' 208 */
+    { .pattern = 0x3d0, .num_bits = 10 }, /* ' ' 209 */
+    { .pattern = 0x3d1, .num_bits = 10 }, /* ' ' 210 */
+    { .pattern = 0x3d2, .num_bits = 10 }, /* ' ' 211 */
+    { .pattern = 0x3d3, .num_bits = 10 }, /* ' ' 212 */
+    { .pattern = 0x3d4, .num_bits = 10 }, /* ' ' 213 */
+    { .pattern = 0x3d5, .num_bits = 10 }, /* ' ' 214 */
+    { .pattern = 0x3d6, .num_bits = 10 }, /* ' ' 215 */
+    { .pattern = 0x3d7, .num_bits = 10 }, /* ' ' 216 */
+    { .pattern = 0x3d8, .num_bits = 10 }, /* ' ' 217 */
+    { .pattern = 0x3d9, .num_bits = 10 }, /* ' ' 218 */
+    { .pattern = 0x3da, .num_bits = 10 }, /* ' ' 219 */
+    { .pattern = 0x3db, .num_bits = 10 }, /* ' ' 220 */
+    { .pattern = 0x3dc, .num_bits = 10 }, /* ' ' 221 */
+    { .pattern = 0x3dd, .num_bits = 10 }, /* ' ' 222 */
+    { .pattern = 0x3de, .num_bits = 10 }, /* ' ' 223 */
+    { .pattern = 0x3df, .num_bits = 10 }, /* ' ' 224 */
+    { .pattern = 0x3e0, .num_bits = 10 }, /* ' ' 225 */
+    { .pattern = 0x3e1, .num_bits = 10 }, /* ' ' 226 */
+    { .pattern = 0x3e2, .num_bits = 10 }, /* ' ' 227 */
+    { .pattern = 0x3e3, .num_bits = 10 }, /* ' ' 228 */
+    { .pattern = 0x3e4, .num_bits = 10 }, /* ' ' 229 */
+    { .pattern = 0x3e5, .num_bits = 10 }, /* ' ' 230 */
+    { .pattern = 0x3e6, .num_bits = 10 }, /* ' ' 231 */
+    { .pattern = 0x3e7, .num_bits = 10 }, /* ' ' 232 */
+    { .pattern = 0x3e8, .num_bits = 10 }, /* ' ' 233 */
+    { .pattern = 0x3e9, .num_bits = 10 }, /* ' ' 234 */
+    { .pattern = 0x3ea, .num_bits = 10 }, /* ' ' 235 */
+    { .pattern = 0x3eb, .num_bits = 10 }, /* ' ' 236 */
+    { .pattern = 0x3ec, .num_bits = 10 }, /* ' ' 237 */
+    { .pattern = 0x3ed, .num_bits = 10 }, /* ' ' 238 */
+    { .pattern = 0x3ee, .num_bits = 10 }, /* ' ' 239 */
+    { .pattern = 0x3ef, .num_bits = 10 }, /* ' ' 240 */
+    { .pattern = 0x3f0, .num_bits = 10 }, /* ' ' 241 */
+    { .pattern = 0x3f1, .num_bits = 10 }, /* ' ' 242 */
+    { .pattern = 0x3f2, .num_bits = 10 }, /* ' ' 243 */
+    { .pattern = 0x3f3, .num_bits = 10 }, /* ' ' 244 */
+    { .pattern = 0x3f4, .num_bits = 10 }, /* ' ' 245 */
+    { .pattern = 0x3f5, .num_bits = 10 }, /* ' ' 246 */
+    { .pattern = 0x3f6, .num_bits = 10 }, /* ' ' 247 */
+    { .pattern = 0x3f7, .num_bits = 10 }, /* ' ' 248 */
+    { .pattern = 0x3f8, .num_bits = 10 }, /* ' ' 249 */
+    { .pattern = 0x3f9, .num_bits = 10 }, /* ' ' 250 */
+    { .pattern = 0x3fa, .num_bits = 10 }, /* ' ' 251 */
+    { .pattern = 0x3fb, .num_bits = 10 }, /* ' ' 252 */
+    { .pattern = 0x3fc, .num_bits = 10 }, /* ' ' 253 */
+    { .pattern = 0x3fd, .num_bits = 10 }, /* ' ' 254 */
+    { .pattern = 0x3fe, .num_bits = 10 }, /* ' ' 255 */
+};
+
+static struct aws_huffman_code encode_symbol(uint8_t symbol, void *userdata) {
+    (void)userdata;
+
+    return code_points[symbol];
+}
+
+static const uint8_t code_lengths[] = {
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  8, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+     5, 10, 10, 10, 10, 10, 10,  7, 10, 10, 10, 10,  8,  9,  7, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,  8,
+    10, 10,  8,  9,  9,  9,  9,  9,  9,  8, 10, 10,  9,  9, 10, 10,
+     9, 10, 10, 10,  8, 10,  9,  8, 10,  9, 10, 10, 10, 10, 10, 10,
+    10,  5,  7,  6,  6,  5,  6,  7,  6,  5,  8,  6,  6,  6,  5,  5,
+     7,  9,  5,  5,  5,  5,  8,  6,  8,  6, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+};
+
+static const struct aws_huffman_decode_entry decode_entries[] = {
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 0 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 1 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 2 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 3 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 4 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 5 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 6 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 7 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 8 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 9 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 10 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 11 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 12 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 13 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 14 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 15 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 16 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 17 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 18 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 19 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 20 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 21 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 22 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 23 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 24 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 25 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 26 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 27 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 28 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 29 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 30 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 31 */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 32 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 33 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 34 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 35 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 36 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 37 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 38 ' ' */
+    { .value = 0x20, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 39 ' ' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 40 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 41 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 42 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 43 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 44 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 45 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 46 'a' */
+    { .value = 0x61, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 47 'a' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 48 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 49 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 50 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 51 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 52 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 53 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 54 'e' */
+    { .value = 0x65, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 55 'e' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 56 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 57 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 58 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 59 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 60 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 61 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 62 'i' */
+    { .value = 0x69, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 63 'i' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 64 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 65 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 66 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 67 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 68 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 69 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 70 'n' */
+    { .value = 0x6e, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 71 'n' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 72 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 73 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 74 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 75 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 76 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 77 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 78 'o' */
+    { .value = 0x6f, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 79 'o' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 80 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 81 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 82 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 83 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 84 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 85 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 86 'r' */
+    { .value = 0x72, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 87 'r' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 88 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 89 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 90 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 91 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 92 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 93 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 94 's' */
+    { .value = 0x73, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 95 's' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 96 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 97 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 98 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 99 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 100 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 101 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 102 't' */
+    { .value = 0x74, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 103 't' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 104 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 105 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 106 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 107 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 108 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 109 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 110 'u' */
+    { .value = 0x75, .num_bits = 5, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 111 'u' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 112 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 113 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 114 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 115 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 116 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 117 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 118 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 119 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 120 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 121 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 122 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 123 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 124 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 125 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 126 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 127 */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 128 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 129 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 130 'c' */
+    { .value = 0x63, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 131 'c' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 132 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 133 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 134 'd' */
+    { .value = 0x64, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 135 'd' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 136 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 137 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 138 'f' */
+    { .value = 0x66, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 139 'f' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 140 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 141 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 142 'h' */
+    { .value = 0x68, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 143 'h' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 144 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 145 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 146 'k' */
+    { .value = 0x6b, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 147 'k' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 148 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 149 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 150 'l' */
+    { .value = 0x6c, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 151 'l' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 152 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 153 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 154 'm' */
+    { .value = 0x6d, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 155 'm' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 156 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 157 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 158 'w' */
+    { .value = 0x77, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 159 'w' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 160 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 161 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 162 'y' */
+    { .value = 0x79, .num_bits = 6, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 163 'y' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 164 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 165 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 166 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 167 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 168 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 169 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 170 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 171 */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 172 ''' */
+    { .value = 0x27, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 173 ''' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 174 '.' */
+    { .value = 0x2e, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 175 '.' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 176 'b' */
+    { .value = 0x62, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 177 'b' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 178 'g' */
+    { .value = 0x67, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 179 'g' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 180 'p' */
+    { .value = 0x70, .num_bits = 7, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 181 'p' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 182 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 183 */
+    { .value = 0xa, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 184 */
+    { .value = 0x2c, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 185 ',' */
+    { .value = 0x3f, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 186 '?' */
+    { .value = 0x42, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 187 'B' */
+    { .value = 0x49, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 188 'I' */
+    { .value = 0x54, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 189 'T' */
+    { .value = 0x57, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 190 'W' */
+    { .value = 0x6a, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 191 'j' */
+    { .value = 0x76, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 192 'v' */
+    { .value = 0x78, .num_bits = 8, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 193 'x' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 194 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 195 */
+    { .value = 0x100, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 196 */
+    { .value = 0x102, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 197 */
+    { .value = 0x104, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 198 */
+    { .value = 0x106, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 199 */
+    { .value = 0x108, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 200 */
+    { .value = 0x10a, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 201 */
+    { .value = 0x10c, .num_bits = 1, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 202 */
+    { .value = 0x10e, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 203 */
+    { .value = 0x112, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 204 */
+    { .value = 0x116, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 205 */
+    { .value = 0x11a, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 206 */
+    { .value = 0x11e, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 207 */
+    { .value = 0x122, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 208 */
+    { .value = 0x126, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 209 */
+    { .value = 0x12a, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 210 */
+    { .value = 0x12e, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 211 */
+    { .value = 0x132, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 212 */
+    { .value = 0x136, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 213 */
+    { .value = 0x13a, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 214 */
+    { .value = 0x13e, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 215 */
+    { .value = 0x142, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 216 */
+    { .value = 0x146, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 217 */
+    { .value = 0x14a, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 218 */
+    { .value = 0x14e, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 219 */
+    { .value = 0x152, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 220 */
+    { .value = 0x156, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 221 */
+    { .value = 0x15a, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 222 */
+    { .value = 0x15e, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 223 */
+    { .value = 0x162, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 224 */
+    { .value = 0x166, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 225 */
+    { .value = 0x16a, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 226 */
+    { .value = 0x16e, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 227 */
+    { .value = 0x172, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 228 */
+    { .value = 0x176, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 229 */
+    { .value = 0x17a, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 230 */
+    { .value = 0x17e, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 231 */
+    { .value = 0x182, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 232 */
+    { .value = 0x186, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 233 */
+    { .value = 0x18a, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 234 */
+    { .value = 0x18e, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 235 */
+    { .value = 0x192, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 236 */
+    { .value = 0x196, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 237 */
+    { .value = 0x19a, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 238 */
+    { .value = 0x19e, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 239 */
+    { .value = 0x1a2, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 240 */
+    { .value = 0x1a6, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 241 */
+    { .value = 0x1aa, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 242 */
+    { .value = 0x1ae, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 243 */
+    { .value = 0x1b2, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 244 */
+    { .value = 0x1b6, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 245 */
+    { .value = 0x1ba, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 246 */
+    { .value = 0x1be, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 247 */
+    { .value = 0x1c2, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 248 */
+    { .value = 0x1c6, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 249 */
+    { .value = 0x1ca, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 250 */
+    { .value = 0x1ce, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 251 */
+    { .value = 0x1d2, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 252 */
+    { .value = 0x1d6, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 253 */
+    { .value = 0x1da, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 254 */
+    { .value = 0x1de, .num_bits = 2, .type = AWS_HUFFMAN_DECODE_ENTRY_LINK }, /* 255 */
+    { .value = 0x2d, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 256 '-' */
+    { .value = 0x43, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 257 'C' */
+    { .value = 0x44, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 258 'D' */
+    { .value = 0x45, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 259 'E' */
+    { .value = 0x46, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 260 'F' */
+    { .value = 0x47, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 261 'G' */
+    { .value = 0x48, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 262 'H' */
+    { .value = 0x4c, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 263 'L' */
+    { .value = 0x4d, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 264 'M' */
+    { .value = 0x50, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 265 'P' */
+    { .value = 0x56, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 266 'V' */
+    { .value = 0x59, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 267 'Y' */
+    { .value = 0x71, .num_bits = 9, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 268 'q' */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 269 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 270 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 271 */
+    { .value = 0x0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 272 */
+    { .value = 0x1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 273 */
+    { .value = 0x2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 274 */
+    { .value = 0x3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 275 */
+    { .value = 0x4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 276 */
+    { .value = 0x5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 277 */
+    { .value = 0x6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 278 */
+    { .value = 0x7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 279 */
+    { .value = 0x8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 280 */
+    { .value = 0x9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 281 */
+    { .value = 0xb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 282 */
+    { .value = 0xc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 283 */
+    { .value = 0xd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 284 */
+    { .value = 0xe, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 285 */
+    { .value = 0xf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 286 */
+    { .value = 0x10, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 287 */
+    { .value = 0x11, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 288 */
+    { .value = 0x12, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 289 */
+    { .value = 0x13, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 290 */
+    { .value = 0x14, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 291 */
+    { .value = 0x15, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 292 */
+    { .value = 0x16, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 293 */
+    { .value = 0x17, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 294 */
+    { .value = 0x18, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 295 */
+    { .value = 0x19, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 296 */
+    { .value = 0x1a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 297 */
+    { .value = 0x1b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 298 */
+    { .value = 0x1c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 299 */
+    { .value = 0x1d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 300 */
+    { .value = 0x1e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 301 */
+    { .value = 0x1f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 302 */
+    { .value = 0x21, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 303 '!' */
+    { .value = 0x22, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 304 '"' */
+    { .value = 0x23, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 305 '#' */
+    { .value = 0x24, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 306 '$' */
+    { .value = 0x25, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 307 '%' */
+    { .value = 0x26, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 308 '&' */
+    { .value = 0x28, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 309 '(' */
+    { .value = 0x29, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 310 ')' */
+    { .value = 0x2a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 311 '*' */
+    { .value = 0x2b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 312 '+' */
+    { .value = 0x2f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 313 '/' */
+    { .value = 0x30, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 314 '0' */
+    { .value = 0x31, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 315 '1' */
+    { .value = 0x32, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 316 '2' */
+    { .value = 0x33, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 317 '3' */
+    { .value = 0x34, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 318 '4' */
+    { .value = 0x35, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 319 '5' */
+    { .value = 0x36, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 320 '6' */
+    { .value = 0x37, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 321 '7' */
+    { .value = 0x38, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 322 '8' */
+    { .value = 0x39, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 323 '9' */
+    { .value = 0x3a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 324 ':' */
+    { .value = 0x3b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 325 ';' */
+    { .value = 0x3c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 326 '<' */
+    { .value = 0x3d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 327 '=' */
+    { .value = 0x3e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 328 '>' */
+    { .value = 0x40, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 329 '@' */
+    { .value = 0x41, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 330 'A' */
+    { .value = 0x4a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 331 'J' */
+    { .value = 0x4b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 332 'K' */
+    { .value = 0x4e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 333 'N' */
+    { .value = 0x4f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 334 'O' */
+    { .value = 0x51, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 335 'Q' */
+    { .value = 0x52, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 336 'R' */
+    { .value = 0x53, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 337 'S' */
+    { .value = 0x55, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 338 'U' */
+    { .value = 0x58, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 339 'X' */
+    { .value = 0x5a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 340 'Z' */
+    { .value = 0x5b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 341 '[' */
+    { .value = 0x5c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 342 '\' */
+    { .value = 0x5d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 343 ']' */
+    { .value = 0x5e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 344 '^' */
+    { .value = 0x5f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 345 '_' */
+    { .value = 0x60, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 346 '`' */
+    { .value = 0x7a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 347 'z' */
+    { .value = 0x7b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 348 '{' */
+    { .value = 0x7c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 349 '|' */
+    { .value = 0x7d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 350 '}' */
+    { .value = 0x7e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 351 '~' */
+    { .value = 0x7f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 352 */
+    { .value = 0x80, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 353 */
+    { .value = 0x81, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 354 */
+    { .value = 0x82, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 355 */
+    { .value = 0x83, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 356 */
+    { .value = 0x84, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 357 */
+    { .value = 0x85, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 358 */
+    { .value = 0x86, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 359 */
+    { .value = 0x87, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 360 */
+    { .value = 0x88, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 361 */
+    { .value = 0x89, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 362 */
+    { .value = 0x8a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 363 */
+    { .value = 0x8b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 364 */
+    { .value = 0x8c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 365 */
+    { .value = 0x8d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 366 */
+    { .value = 0x8e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 367 */
+    { .value = 0x8f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 368 */
+    { .value = 0x90, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 369 */
+    { .value = 0x91, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 370 */
+    { .value = 0x92, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 371 */
+    { .value = 0x93, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 372 */
+    { .value = 0x94, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 373 */
+    { .value = 0x95, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 374 */
+    { .value = 0x96, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 375 */
+    { .value = 0x97, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 376 */
+    { .value = 0x98, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 377 */
+    { .value = 0x99, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 378 */
+    { .value = 0x9a, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 379 */
+    { .value = 0x9b, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 380 */
+    { .value = 0x9c, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 381 */
+    { .value = 0x9d, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 382 */
+    { .value = 0x9e, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 383 */
+    { .value = 0x9f, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 384 */
+    { .value = 0xa0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 385 */
+    { .value = 0xa1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 386 */
+    { .value = 0xa2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 387 */
+    { .value = 0xa3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 388 */
+    { .value = 0xa4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 389 */
+    { .value = 0xa5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 390 */
+    { .value = 0xa6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 391 */
+    { .value = 0xa7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 392 */
+    { .value = 0xa8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 393 */
+    { .value = 0xa9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 394 */
+    { .value = 0xaa, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 395 */
+    { .value = 0xab, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 396 */
+    { .value = 0xac, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 397 */
+    { .value = 0xad, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 398 */
+    { .value = 0xae, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 399 */
+    { .value = 0xaf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 400 */
+    { .value = 0xb0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 401 */
+    { .value = 0xb1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 402 */
+    { .value = 0xb2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 403 */
+    { .value = 0xb3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 404 */
+    { .value = 0xb4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 405 */
+    { .value = 0xb5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 406 */
+    { .value = 0xb6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 407 */
+    { .value = 0xb7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 408 */
+    { .value = 0xb8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 409 */
+    { .value = 0xb9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 410 */
+    { .value = 0xba, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 411 */
+    { .value = 0xbb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 412 */
+    { .value = 0xbc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 413 */
+    { .value = 0xbd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 414 */
+    { .value = 0xbe, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 415 */
+    { .value = 0xbf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 416 */
+    { .value = 0xc0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 417 */
+    { .value = 0xc1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 418 */
+    { .value = 0xc2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 419 */
+    { .value = 0xc3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 420 */
+    { .value = 0xc4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 421 */
+    { .value = 0xc5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 422 */
+    { .value = 0xc6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 423 */
+    { .value = 0xc7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 424 */
+    { .value = 0xc8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 425 */
+    { .value = 0xc9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 426 */
+    { .value = 0xca, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 427 */
+    { .value = 0xcb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 428 */
+    { .value = 0xcc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 429 */
+    { .value = 0xcd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 430 */
+    { .value = 0xce, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 431 */
+    { .value = 0xcf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 432 */
+    { .value = 0xd0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 433 */
+    { .value = 0xd1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 434 */
+    { .value = 0xd2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 435 */
+    { .value = 0xd3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 436 */
+    { .value = 0xd4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 437 */
+    { .value = 0xd5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 438 */
+    { .value = 0xd6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 439 */
+    { .value = 0xd7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 440 */
+    { .value = 0xd8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 441 */
+    { .value = 0xd9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 442 */
+    { .value = 0xda, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 443 */
+    { .value = 0xdb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 444 */
+    { .value = 0xdc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 445 */
+    { .value = 0xdd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 446 */
+    { .value = 0xde, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 447 */
+    { .value = 0xdf, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 448 */
+    { .value = 0xe0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 449 */
+    { .value = 0xe1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 450 */
+    { .value = 0xe2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 451 */
+    { .value = 0xe3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 452 */
+    { .value = 0xe4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 453 */
+    { .value = 0xe5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 454 */
+    { .value = 0xe6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 455 */
+    { .value = 0xe7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 456 */
+    { .value = 0xe8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 457 */
+    { .value = 0xe9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 458 */
+    { .value = 0xea, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 459 */
+    { .value = 0xeb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 460 */
+    { .value = 0xec, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 461 */
+    { .value = 0xed, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 462 */
+    { .value = 0xee, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 463 */
+    { .value = 0xef, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 464 */
+    { .value = 0xf0, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 465 */
+    { .value = 0xf1, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 466 */
+    { .value = 0xf2, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 467 */
+    { .value = 0xf3, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 468 */
+    { .value = 0xf4, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 469 */
+    { .value = 0xf5, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 470 */
+    { .value = 0xf6, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 471 */
+    { .value = 0xf7, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 472 */
+    { .value = 0xf8, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 473 */
+    { .value = 0xf9, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 474 */
+    { .value = 0xfa, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 475 */
+    { .value = 0xfb, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 476 */
+    { .value = 0xfc, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 477 */
+    { .value = 0xfd, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 478 */
+    { .value = 0xfe, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 479 */
+    { .value = 0xff, .num_bits = 10, .type = AWS_HUFFMAN_DECODE_ENTRY_SYMBOL }, /* 480 */
+    { .value = 0x0, .num_bits = 0, .type = AWS_HUFFMAN_DECODE_ENTRY_INVALID }, /* 481 */
+};
+
+static uint8_t decode_symbol(uint32_t bits, uint8_t *symbol, void *userdata) {
+    (void)userdata;
+
+    const struct aws_huffman_decode_entry *entry = &decode_entries[bits >> (32 - 8)];
+    uint8_t consumed = 8;
+    while (entry->type == AWS_HUFFMAN_DECODE_ENTRY_LINK) {
+        const uint8_t sub_bits = entry->num_bits;
+        entry = &decode_entries[entry->value + ((bits << consumed) >> (32 - sub_bits))];
+        consumed += sub_bits;
+    }
+
+    if (entry->type != AWS_HUFFMAN_DECODE_ENTRY_SYMBOL) {
+        return 0;
+    }
+
+    *symbol = (uint8_t)entry->value;
+    return entry->num_bits;
+}
+
+static const struct aws_huffman_decode_table decode_table = {
+    .entries = decode_entries,
+    .root_bits = 8,
+};
+
+static const uint8_t pair_ranks[] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0x19, 0xff, 0x14, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x1a, 0xff, 0xff, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x1d, 0xff, 0xff, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x01, 0x15, 0x0a, 0x0b, 0x02, 0x0c, 0x16, 0x0d, 0x03, 0x1f, 0x0e,
+    0x0f, 0x10, 0x04, 0x05, 0x17, 0xff, 0x06, 0x07, 0x08, 0x09, 0xff, 0x11,
+    0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff,
+};
+
+static const uint64_t pair_entries[] = {
+    0x210000000000000a, 0x214000000000000a, 0x218000000000000a, 0x21c000000000000a,
+    0x220000000000000a, 0x224000000000000a, 0x228000000000000a, 0x22c000000000000a,
+    0x230000000000000a, 0x234000000000000a, 0x240000000000000b, 0x242000000000000b,
+    0x244000000000000b, 0x246000000000000b, 0x248000000000000b, 0x24a000000000000b,
+    0x24c000000000000b, 0x24e000000000000b, 0x250000000000000b, 0x256000000000000c,
+    0x257000000000000c, 0x258000000000000c, 0x259000000000000c, 0x25a000000000000c,
+    0x25c000000000000d, 0x25c800000000000d, 0x25d000000000000d, 0x25d800000000000d,
+    0x25e000000000000d, 0x25e800000000000d, 0x25f000000000000d, 0x25f800000000000d,
+    0x290000000000000a, 0x294000000000000a, 0x298000000000000a, 0x29c000000000000a,
+    0x2a0000000000000a, 0x2a4000000000000a, 0x2a8000000000000a, 0x2ac000000000000a,
+    0x2b0000000000000a, 0x2b4000000000000a, 0x2c0000000000000b, 0x2c2000000000000b,
+    0x2c4000000000000b, 0x2c6000000000000b, 0x2c8000000000000b, 0x2ca000000000000b,
+    0x2cc000000000000b, 0x2ce000000000000b, 0x2d0000000000000b, 0x2d6000000000000c,
+    0x2d7000000000000c, 0x2d8000000000000c, 0x2d9000000000000c, 0x2da000000000000c,
+    0x2dc000000000000d, 0x2dc800000000000d, 0x2dd000000000000d, 0x2dd800000000000d,
+    0x2de000000000000d, 0x2de800000000000d, 0x2df000000000000d, 0x2df800000000000d,
+    0x310000000000000a, 0x314000000000000a, 0x318000000000000a, 0x31c000000000000a,
+    0x320000000000000a, 0x324000000000000a, 0x328000000000000a, 0x32c000000000000a,
+    0x330000000000000a, 0x334000000000000a, 0x340000000000000b, 0x342000000000000b,
+    0x344000000000000b, 0x346000000000000b, 0x348000000000000b, 0x34a000000000000b,
+    0x34c000000000000b, 0x34e000000000000b, 0x350000000000000b, 0x356000000000000c,
+    0x357000000000000c, 0x358000000000000c, 0x359000000000000c, 0x35a000000000000c,
+    0x35c000000000000d, 0x35c800000000000d, 0x35d000000000000d, 0x35d800000000000d,
+    0x35e000000000000d, 0x35e800000000000d, 0x35f000000000000d, 0x35f800000000000d,
+    0x390000000000000a, 0x394000000000000a, 0x398000000000000a, 0x39c000000000000a,
+    0x3a0000000000000a, 0x3a4000000000000a, 0x3a8000000000000a, 0x3ac000000000000a,
+    0x3b0000000000000a, 0x3b4000000000000a, 0x3c0000000000000b, 0x3c2000000000000b,
+    0x3c4000000000000b, 0x3c6000000000000b, 0x3c8000000000000b, 0x3ca000000000000b,
+    0x3cc000000000000b, 0x3ce000000000000b, 0x3d0000000000000b, 0x3d6000000000000c,
+    0x3d7000000000000c, 0x3d8000000000000c, 0x3d9000000000000c, 0x3da000000000000c,
+    0x3dc000000000000d, 0x3dc800000000000d, 0x3dd000000000000d, 0x3dd800000000000d,
+    0x3de000000000000d, 0x3de800000000000d, 0x3df000000000000d, 0x3df800000000000d,
+    0x410000000000000a, 0x414000000000000a, 0x418000000000000a, 0x41c000000000000a,
+    0x420000000000000a, 0x424000000000000a, 0x428000000000000a, 0x42c000000000000a,
+    0x430000000000000a, 0x434000000000000a, 0x440000000000000b, 0x442000000000000b,
+    0x444000000000000b, 0x446000000000000b, 0x448000000000000b, 0x44a000000000000b,
+    0x44c000000000000b, 0x44e000000000000b, 0x450000000000000b, 0x456000000000000c,
+    0x457000000000000c, 0x458000000000000c, 0x459000000000000c, 0x45a000000000000c,
+    0x45c000000000000d, 0x45c800000000000d, 0x45d000000000000d, 0x45d800000000000d,
+    0x45e000000000000d, 0x45e800000000000d, 0x45f000000000000d, 0x45f800000000000d,
+    0x490000000000000a, 0x494000000000000a, 0x498000000000000a, 0x49c000000000000a,
+    0x4a0000000000000a, 0x4a4000000000000a, 0x4a8000000000000a, 0x4ac000000000000a,
+    0x4b0000000000000a, 0x4b4000000000000a, 0x4c0000000000000b, 0x4c2000000000000b,
+    0x4c4000000000000b, 0x4c6000000000000b, 0x4c8000000000000b, 0x4ca000000000000b,
+    0x4cc000000000000b, 0x4ce000000000000b, 0x4d0000000000000b, 0x4d6000000000000c,
+    0x4d7000000000000c, 0x4d8000000000000c, 0x4d9000000000000c, 0x4da000000000000c,
+    0x4dc000000000000d, 0x4dc800000000000d, 0x4dd000000000000d, 0x4dd800000000000d,
+    0x4de000000000000d, 0x4de800000000000d, 0x4df000000000000d, 0x4df800000000000d,
+    0x510000000000000a, 0x514000000000000a, 0x518000000000000a, 0x51c000000000000a,
+    0x520000000000000a, 0x524000000000000a, 0x528000000000000a, 0x52c000000000000a,
+    0x530000000000000a, 0x534000000000000a, 0x540000000000000b, 0x542000000000000b,
+    0x544000000000000b, 0x546000000000000b, 0x548000000000000b, 0x54a000000000000b,
+    0x54c000000000000b, 0x54e000000000000b, 0x550000000000000b, 0x556000000000000c,
+    0x557000000000000c, 0x558000000000000c, 0x559000000000000c, 0x55a000000000000c,
+    0x55c000000000000d, 0x55c800000000000d, 0x55d000000000000d, 0x55d800000000000d,
+    0x55e000000000000d, 0x55e800000000000d, 0x55f000000000000d, 0x55f800000000000d,
+    0x590000000000000a, 0x594000000000000a, 0x598000000000000a, 0x59c000000000000a,
+    0x5a0000000000000a, 0x5a4000000000000a, 0x5a8000000000000a, 0x5ac000000000000a,
+    0x5b0000000000000a, 0x5b4000000000000a, 0x5c0000000000000b, 0x5c2000000000000b,
+    0x5c4000000000000b, 0x5c6000000000000b, 0x5c8000000000000b, 0x5ca000000000000b,
+    0x5cc000000000000b, 0x5ce000000000000b, 0x5d0000000000000b, 0x5d6000000000000c,
+    0x5d7000000000000c, 0x5d8000000000000c, 0x5d9000000000000c, 0x5da000000000000c,
+    0x5dc000000000000d, 0x5dc800000000000d, 0x5dd000000000000d, 0x5dd800000000000d,
+    0x5de000000000000d, 0x5de800000000000d, 0x5df000000000000d, 0x5df800000000000d,
+    0x610000000000000a, 0x614000000000000a, 0x618000000000000a, 0x61c000000000000a,
+    0x620000000000000a, 0x624000000000000a, 0x628000000000000a, 0x62c000000000000a,
+    0x630000000000000a, 0x634000000000000a, 0x640000000000000b, 0x642000000000000b,
+    0x644000000000000b, 0x646000000000000b, 0x648000000000000b, 0x64a000000000000b,
+    0x64c000000000000b, 0x64e000000000000b, 0x650000000000000b, 0x656000000000000c,
+    0x657000000000000c, 0x658000000000000c, 0x659000000000000c, 0x65a000000000000c,
+    0x65c000000000000d, 0x65c800000000000d, 0x65d000000000000d, 0x65d800000000000d,
+    0x65e000000000000d, 0x65e800000000000d, 0x65f000000000000d, 0x65f800000000000d,
+    0x690000000000000a, 0x694000000000000a, 0x698000000000000a, 0x69c000000000000a,
+    0x6a0000000000000a, 0x6a4000000000000a, 0x6a8000000000000a, 0x6ac000000000000a,
+    0x6b0000000000000a, 0x6b4000000000000a, 0x6c0000000000000b, 0x6c2000000000000b,
+    0x6c4000000000000b, 0x6c6000000000000b, 0x6c8000000000000b, 0x6ca000000000000b,
+    0x6cc000000000000b, 0x6ce000000000000b, 0x6d0000000000000b, 0x6d6000000000000c,
+    0x6d7000000000000c, 0x6d8000000000000c, 0x6d9000000000000c, 0x6da000000000000c,
+    0x6dc000000000000d, 0x6dc800000000000d, 0x6dd000000000000d, 0x6dd800000000000d,
+    0x6de000000000000d, 0x6de800000000000d, 0x6df000000000000d, 0x6df800000000000d,
+    0x808000000000000b, 0x80a000000000000b, 0x80c000000000000b, 0x80e000000000000b,
+    0x810000000000000b, 0x812000000000000b, 0x814000000000000b, 0x816000000000000b,
+    0x818000000000000b, 0x81a000000000000b, 0x820000000000000c, 0x821000000000000c,
+    0x822000000000000c, 0x823000000000000c, 0x824000000000000c, 0x825000000000000c,
+    0x826000000000000c, 0x827000000000000c, 0x828000000000000c, 0x82b000000000000d,
+    0x82b800000000000d, 0x82c000000000000d, 0x82c800000000000d, 0x82d000000000000d,
+    0x82e000000000000e, 0x82e400000000000e, 0x82e800000000000e, 0x82ec00000000000e,
+    0x82f000000000000e, 0x82f400000000000e, 0x82f800000000000e, 0x82fc00000000000e,
+    0x848000000000000b, 0x84a000000000000b, 0x84c000000000000b, 0x84e000000000000b,
+    0x850000000000000b, 0x852000000000000b, 0x854000000000000b, 0x856000000000000b,
+    0x858000000000000b, 0x85a000000000000b, 0x860000000000000c, 0x861000000000000c,
+    0x862000000000000c, 0x863000000000000c, 0x864000000000000c, 0x865000000000000c,
+    0x866000000000000c, 0x867000000000000c, 0x868000000000000c, 0x86b000000000000d,
+    0x86b800000000000d, 0x86c000000000000d, 0x86c800000000000d, 0x86d000000000000d,
+    0x86e000000000000e, 0x86e400000000000e, 0x86e800000000000e, 0x86ec00000000000e,
+    0x86f000000000000e, 0x86f400000000000e, 0x86f800000000000e, 0x86fc00000000000e,
+    0x888000000000000b, 0x88a000000000000b, 0x88c000000000000b, 0x88e000000000000b,
+    0x890000000000000b, 0x892000000000000b, 0x894000000000000b, 0x896000000000000b,
+    0x898000000000000b, 0x89a000000000000b, 0x8a0000000000000c, 0x8a1000000000000c,
+    0x8a2000000000000c, 0x8a3000000000000c, 0x8a4000000000000c, 0x8a5000000000000c,
+    0x8a6000000000000c, 0x8a7000000000000c, 0x8a8000000000000c, 0x8ab000000000000d,
+    0x8ab800000000000d, 0x8ac000000000000d, 0x8ac800000000000d, 0x8ad000000000000d,
+    0x8ae000000000000e, 0x8ae400000000000e, 0x8ae800000000000e, 0x8aec00000000000e,
+    0x8af000000000000e, 0x8af400000000000e, 0x8af800000000000e, 0x8afc00000000000e,
+    0x8c8000000000000b, 0x8ca000000000000b, 0x8cc000000000000b, 0x8ce000000000000b,
+    0x8d0000000000000b, 0x8d2000000000000b, 0x8d4000000000000b, 0x8d6000000000000b,
+    0x8d8000000000000b, 0x8da000000000000b, 0x8e0000000000000c, 0x8e1000000000000c,
+    0x8e2000000000000c, 0x8e3000000000000c, 0x8e4000000000000c, 0x8e5000000000000c,
+    0x8e6000000000000c, 0x8e7000000000000c, 0x8e8000000000000c, 0x8eb000000000000d,
+    0x8eb800000000000d, 0x8ec000000000000d, 0x8ec800000000000d, 0x8ed000000000000d,
+    0x8ee000000000000e, 0x8ee400000000000e, 0x8ee800000000000e, 0x8eec00000000000e,
+    0x8ef000000000000e, 0x8ef400000000000e, 0x8ef800000000000e, 0x8efc00000000000e,
+    0x908000000000000b, 0x90a000000000000b, 0x90c000000000000b, 0x90e000000000000b,
+    0x910000000000000b, 0x912000000000000b, 0x914000000000000b, 0x916000000000000b,
+    0x918000000000000b, 0x91a000000000000b, 0x920000000000000c, 0x921000000000000c,
+    0x922000000000000c, 0x923000000000000c, 0x924000000000000c, 0x925000000000000c,
+    0x926000000000000c, 0x927000000000000c, 0x928000000000000c, 0x92b000000000000d,
+    0x92b800000000000d, 0x92c000000000000d, 0x92c800000000000d, 0x92d000000000000d,
+    0x92e000000000000e, 0x92e400000000000e, 0x92e800000000000e, 0x92ec00000000000e,
+    0x92f000000000000e, 0x92f400000000000e, 0x92f800000000000e, 0x92fc00000000000e,
+    0x948000000000000b, 0x94a000000000000b, 0x94c000000000000b, 0x94e000000000000b,
+    0x950000000000000b, 0x952000000000000b, 0x954000000000000b, 0x956000000000000b,
+    0x958000000000000b, 0x95a000000000000b, 0x960000000000000c, 0x961000000000000c,
+    0x962000000000000c, 0x963000000000000c, 0x964000000000000c, 0x965000000000000c,
+    0x966000000000000c, 0x967000000000000c, 0x968000000000000c, 0x96b000000000000d,
+    0x96b800000000000d, 0x96c000000000000d, 0x96c800000000000d, 0x96d000000000000d,
+    0x96e000000000000e, 0x96e400000000000e, 0x96e800000000000e, 0x96ec00000000000e,
+    0x96f000000000000e, 0x96f400000000000e, 0x96f800000000000e, 0x96fc00000000000e,
+    0x988000000000000b, 0x98a000000000000b, 0x98c000000000000b, 0x98e000000000000b,
+    0x990000000000000b, 0x992000000000000b, 0x994000000000000b, 0x996000000000000b,
+    0x998000000000000b, 0x99a000000000000b, 0x9a0000000000000c, 0x9a1000000000000c,
+    0x9a2000000000000c, 0x9a3000000000000c, 0x9a4000000000000c, 0x9a5000000000000c,
+    0x9a6000000000000c, 0x9a7000000000000c, 0x9a8000000000000c, 0x9ab000000000000d,
+    0x9ab800000000000d, 0x9ac000000000000d, 0x9ac800000000000d, 0x9ad000000000000d,
+    0x9ae000000000000e, 0x9ae400000000000e, 0x9ae800000000000e, 0x9aec00000000000e,
+    0x9af000000000000e, 0x9af400000000000e, 0x9af800000000000e, 0x9afc00000000000e,
+    0x9c8000000000000b, 0x9ca000000000000b, 0x9cc000000000000b, 0x9ce000000000000b,
+    0x9d0000000000000b, 0x9d2000000000000b, 0x9d4000000000000b, 0x9d6000000000000b,
+    0x9d8000000000000b, 0x9da000000000000b, 0x9e0000000000000c, 0x9e1000000000000c,
+    0x9e2000000000000c, 0x9e3000000000000c, 0x9e4000000000000c, 0x9e5000000000000c,
+    0x9e6000000000000c, 0x9e7000000000000c, 0x9e8000000000000c, 0x9eb000000000000d,
+    0x9eb800000000000d, 0x9ec000000000000d, 0x9ec800000000000d, 0x9ed000000000000d,
+    0x9ee000000000000e, 0x9ee400000000000e, 0x9ee800000000000e, 0x9eec00000000000e,
+    0x9ef000000000000e, 0x9ef400000000000e, 0x9ef800000000000e, 0x9efc00000000000e,
+    0xa08000000000000b, 0xa0a000000000000b, 0xa0c000000000000b, 0xa0e000000000000b,
+    0xa10000000000000b, 0xa12000000000000b, 0xa14000000000000b, 0xa16000000000000b,
+    0xa18000000000000b, 0xa1a000000000000b, 0xa20000000000000c, 0xa21000000000000c,
+    0xa22000000000000c, 0xa23000000000000c, 0xa24000000000000c, 0xa25000000000000c,
+    0xa26000000000000c, 0xa27000000000000c, 0xa28000000000000c, 0xa2b000000000000d,
+    0xa2b800000000000d, 0xa2c000000000000d, 0xa2c800000000000d, 0xa2d000000000000d,
+    0xa2e000000000000e, 0xa2e400000000000e, 0xa2e800000000000e, 0xa2ec00000000000e,
+    0xa2f000000000000e, 0xa2f400000000000e, 0xa2f800000000000e, 0xa2fc00000000000e,
+    0xac4000000000000c, 0xac5000000000000c, 0xac6000000000000c, 0xac7000000000000c,
+    0xac8000000000000c, 0xac9000000000000c, 0xaca000000000000c, 0xacb000000000000c,
+    0xacc000000000000c, 0xacd000000000000c, 0xad0000000000000d, 0xad0800000000000d,
+    0xad1000000000000d, 0xad1800000000000d, 0xad2000000000000d, 0xad2800000000000d,
+    0xad3000000000000d, 0xad3800000000000d, 0xad4000000000000d, 0xad5800000000000e,
+    0xad5c00000000000e, 0xad6000000000000e, 0xad6400000000000e, 0xad6800000000000e,
+    0xad7000000000000f, 0xad7200000000000f, 0xad7400000000000f, 0xad7600000000000f,
+    0xad7800000000000f, 0xad7a00000000000f, 0xad7c00000000000f, 0xad7e00000000000f,
+    0xae4000000000000c, 0xae5000000000000c, 0xae6000000000000c, 0xae7000000000000c,
+    0xae8000000000000c, 0xae9000000000000c, 0xaea000000000000c, 0xaeb000000000000c,
+    0xaec000000000000c, 0xaed000000000000c, 0xaf0000000000000d, 0xaf0800000000000d,
+    0xaf1000000000000d, 0xaf1800000000000d, 0xaf2000000000000d, 0xaf2800000000000d,
+    0xaf3000000000000d, 0xaf3800000000000d, 0xaf4000000000000d, 0xaf5800000000000e,
+    0xaf5c00000000000e, 0xaf6000000000000e, 0xaf6400000000000e, 0xaf6800000000000e,
+    0xaf7000000000000f, 0xaf7200000000000f, 0xaf7400000000000f, 0xaf7600000000000f,
+    0xaf7800000000000f, 0xaf7a00000000000f, 0xaf7c00000000000f, 0xaf7e00000000000f,
+    0xb04000000000000c, 0xb05000000000000c, 0xb06000000000000c, 0xb07000000000000c,
+    0xb08000000000000c, 0xb09000000000000c, 0xb0a000000000000c, 0xb0b000000000000c,
+    0xb0c000000000000c, 0xb0d000000000000c, 0xb10000000000000d, 0xb10800000000000d,
+    0xb11000000000000d, 0xb11800000000000d, 0xb12000000000000d, 0xb12800000000000d,
+    0xb13000000000000d, 0xb13800000000000d, 0xb14000000000000d, 0xb15800000000000e,
+    0xb15c00000000000e, 0xb16000000000000e, 0xb16400000000000e, 0xb16800000000000e,
+    0xb17000000000000f, 0xb17200000000000f, 0xb17400000000000f, 0xb17600000000000f,
+    0xb17800000000000f, 0xb17a00000000000f, 0xb17c00000000000f, 0xb17e00000000000f,
+    0xb24000000000000c, 0xb25000000000000c, 0xb26000000000000c, 0xb27000000000000c,
+    0xb28000000000000c, 0xb29000000000000c, 0xb2a000000000000c, 0xb2b000000000000c,
+    0xb2c000000000000c, 0xb2d000000000000c, 0xb30000000000000d, 0xb30800000000000d,
+    0xb31000000000000d, 0xb31800000000000d, 0xb32000000000000d, 0xb32800000000000d,
+    0xb33000000000000d, 0xb33800000000000d, 0xb34000000000000d, 0xb35800000000000e,
+    0xb35c00000000000e, 0xb36000000000000e, 0xb36400000000000e, 0xb36800000000000e,
+    0xb37000000000000f, 0xb37200000000000f, 0xb37400000000000f, 0xb37600000000000f,
+    0xb37800000000000f, 0xb37a00000000000f, 0xb37c00000000000f, 0xb37e00000000000f,
+    0xb44000000000000c, 0xb45000000000000c, 0xb46000000000000c, 0xb47000000000000c,
+    0xb48000000000000c, 0xb49000000000000c, 0xb4a000000000000c, 0xb4b000000000000c,
+    0xb4c000000000000c, 0xb4d000000000000c, 0xb50000000000000d, 0xb50800000000000d,
+    0xb51000000000000d, 0xb51800000000000d, 0xb52000000000000d, 0xb52800000000000d,
+    0xb53000000000000d, 0xb53800000000000d, 0xb54000000000000d, 0xb55800000000000e,
+    0xb55c00000000000e, 0xb56000000000000e, 0xb56400000000000e, 0xb56800000000000e,
+    0xb57000000000000f, 0xb57200000000000f, 0xb57400000000000f, 0xb57600000000000f,
+    0xb57800000000000f, 0xb57a00000000000f, 0xb57c00000000000f, 0xb57e00000000000f,
+    0xb82000000000000d, 0xb82800000000000d, 0xb83000000000000d, 0xb83800000000000d,
+    0xb84000000000000d, 0xb84800000000000d, 0xb85000000000000d, 0xb85800000000000d,
+    0xb86000000000000d, 0xb86800000000000d, 0xb88000000000000e, 0xb88400000000000e,
+    0xb88800000000000e, 0xb88c00000000000e, 0xb89000000000000e, 0xb89400000000000e,
+    0xb89800000000000e, 0xb89c00000000000e, 0xb8a000000000000e, 0xb8ac00000000000f,
+    0xb8ae00000000000f, 0xb8b000000000000f, 0xb8b200000000000f, 0xb8b400000000000f,
+    0xb8b8000000000010, 0xb8b9000000000010, 0xb8ba000000000010, 0xb8bb000000000010,
+    0xb8bc000000000010, 0xb8bd000000000010, 0xb8be000000000010, 0xb8bf000000000010,
+    0xb92000000000000d, 0xb92800000000000d, 0xb93000000000000d, 0xb93800000000000d,
+    0xb94000000000000d, 0xb94800000000000d, 0xb95000000000000d, 0xb95800000000000d,
+    0xb96000000000000d, 0xb96800000000000d, 0xb98000000000000e, 0xb98400000000000e,
+    0xb98800000000000e, 0xb98c00000000000e, 0xb99000000000000e, 0xb99400000000000e,
+    0xb99800000000000e, 0xb99c00000000000e, 0xb9a000000000000e, 0xb9ac00000000000f,
+    0xb9ae00000000000f, 0xb9b000000000000f, 0xb9b200000000000f, 0xb9b400000000000f,
+    0xb9b8000000000010, 0xb9b9000000000010, 0xb9ba000000000010, 0xb9bb000000000010,
+    0xb9bc000000000010, 0xb9bd000000000010, 0xb9be000000000010, 0xb9bf000000000010,
+    0xba2000000000000d, 0xba2800000000000d, 0xba3000000000000d, 0xba3800000000000d,
+    0xba4000000000000d, 0xba4800000000000d, 0xba5000000000000d, 0xba5800000000000d,
+    0xba6000000000000d, 0xba6800000000000d, 0xba8000000000000e, 0xba8400000000000e,
+    0xba8800000000000e, 0xba8c00000000000e, 0xba9000000000000e, 0xba9400000000000e,
+    0xba9800000000000e, 0xba9c00000000000e, 0xbaa000000000000e, 0xbaac00000000000f,
+    0xbaae00000000000f, 0xbab000000000000f, 0xbab200000000000f, 0xbab400000000000f,
+    0xbab8000000000010, 0xbab9000000000010, 0xbaba000000000010, 0xbabb000000000010,
+    0xbabc000000000010, 0xbabd000000000010, 0xbabe000000000010, 0xbabf000000000010,
+    0xbb2000000000000d, 0xbb2800000000000d, 0xbb3000000000000d, 0xbb3800000000000d,
+    0xbb4000000000000d, 0xbb4800000000000d, 0xbb5000000000000d, 0xbb5800000000000d,
+    0xbb6000000000000d, 0xbb6800000000000d, 0xbb8000000000000e, 0xbb8400000000000e,
+    0xbb8800000000000e, 0xbb8c00000000000e, 0xbb9000000000000e, 0xbb9400000000000e,
+    0xbb9800000000000e, 0xbb9c00000000000e, 0xbba000000000000e, 0xbbac00000000000f,
+    0xbbae00000000000f, 0xbbb000000000000f, 0xbbb200000000000f, 0xbbb400000000000f,
+    0xbbb8000000000010, 0xbbb9000000000010, 0xbbba000000000010, 0xbbbb000000000010,
+    0xbbbc000000000010, 0xbbbd000000000010, 0xbbbe000000000010, 0xbbbf000000000010,
+    0xbc2000000000000d, 0xbc2800000000000d, 0xbc3000000000000d, 0xbc3800000000000d,
+    0xbc4000000000000d, 0xbc4800000000000d, 0xbc5000000000000d, 0xbc5800000000000d,
+    0xbc6000000000000d, 0xbc6800000000000d, 0xbc8000000000000e, 0xbc8400000000000e,
+    0xbc8800000000000e, 0xbc8c00000000000e, 0xbc9000000000000e, 0xbc9400000000000e,
+    0xbc9800000000000e, 0xbc9c00000000000e, 0xbca000000000000e, 0xbcac00000000000f,
+    0xbcae00000000000f, 0xbcb000000000000f, 0xbcb200000000000f, 0xbcb400000000000f,
+    0xbcb8000000000010, 0xbcb9000000000010, 0xbcba000000000010, 0xbcbb000000000010,
+    0xbcbc000000000010, 0xbcbd000000000010, 0xbcbe000000000010, 0xbcbf000000000010,
+    0xbd2000000000000d, 0xbd2800000000000d, 0xbd3000000000000d, 0xbd3800000000000d,
+    0xbd4000000000000d, 0xbd4800000000000d, 0xbd5000000000000d, 0xbd5800000000000d,
+    0xbd6000000000000d, 0xbd6800000000000d, 0xbd8000000000000e, 0xbd8400000000000e,
+    0xbd8800000000000e, 0xbd8c00000000000e, 0xbd9000000000000e, 0xbd9400000000000e,
+    0xbd9800000000000e, 0xbd9c00000000000e, 0xbda000000000000e, 0xbdac00000000000f,
+    0xbdae00000000000f, 0xbdb000000000000f, 0xbdb200000000000f, 0xbdb400000000000f,
+    0xbdb8000000000010, 0xbdb9000000000010, 0xbdba000000000010, 0xbdbb000000000010,
+    0xbdbc000000000010, 0xbdbd000000000010, 0xbdbe000000000010, 0xbdbf000000000010,
+    0xbe2000000000000d, 0xbe2800000000000d, 0xbe3000000000000d, 0xbe3800000000000d,
+    0xbe4000000000000d, 0xbe4800000000000d, 0xbe5000000000000d, 0xbe5800000000000d,
+    0xbe6000000000000d, 0xbe6800000000000d, 0xbe8000000000000e, 0xbe8400000000000e,
+    0xbe8800000000000e, 0xbe8c00000000000e, 0xbe9000000000000e, 0xbe9400000000000e,
+    0xbe9800000000000e, 0xbe9c00000000000e, 0xbea000000000000e, 0xbeac00000000000f,
+    0xbeae00000000000f, 0xbeb000000000000f, 0xbeb200000000000f, 0xbeb400000000000f,
+    0xbeb8000000000010, 0xbeb9000000000010, 0xbeba000000000010, 0xbebb000000000010,
+    0xbebc000000000010, 0xbebd000000000010, 0xbebe000000000010, 0xbebf000000000010,
+    0xbf2000000000000d, 0xbf2800000000000d, 0xbf3000000000000d, 0xbf3800000000000d,
+    0xbf4000000000000d, 0xbf4800000000000d, 0xbf5000000000000d, 0xbf5800000000000d,
+    0xbf6000000000000d, 0xbf6800000000000d, 0xbf8000000000000e, 0xbf8400000000000e,
+    0xbf8800000000000e, 0xbf8c00000000000e, 0xbf9000000000000e, 0xbf9400000000000e,
+    0xbf9800000000000e, 0xbf9c00000000000e, 0xbfa000000000000e, 0xbfac00000000000f,
+    0xbfae00000000000f, 0xbfb000000000000f, 0xbfb200000000000f, 0xbfb400000000000f,
+    0xbfb8000000000010, 0xbfb9000000000010, 0xbfba000000000010, 0xbfbb000000000010,
+    0xbfbc000000000010, 0xbfbd000000000010, 0xbfbe000000000010, 0xbfbf000000000010,
+};
+
+static const struct aws_huffman_pair_table pair_table = {
+    .entries = pair_entries,
+    .ranks = pair_ranks,
+    .num_ranked = 32,
+};
+
+int test_table_encode(struct aws_byte_cursor *to_encode, struct aws_byte_buf *output) {
+    uint64_t working = 0;
+    size_t num_bits = 0;
+    size_t len = output->len;
+
+    for (size_t i = 0; i < to_encode->len; ++i) {
+        const struct aws_huffman_code code = code_points[to_encode->ptr[i]];
+        working |= (uint64_t)code.pattern << (64 - num_bits - code.num_bits);
+        num_bits += code.num_bits;
+
+        while (num_bits >= 8) {
+            if (len == output->capacity) {
+                return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+            }
+            output->buffer[len++] = (uint8_t)(working >> 56);
+            working <<= 8;
+            num_bits -= 8;
+        }
+    }
+
+    /* Pad the last byte with 1s */
+    if (num_bits) {
+        if (len == output->capacity) {
+            return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+        }
+        output->buffer[len++] = (uint8_t)(working >> 56 | 0xffu >> num_bits);
+    }
+
+    output->len = len;
+    aws_byte_cursor_advance(to_encode, to_encode->len);
+    return AWS_OP_SUCCESS;
+}
+
+int test_table_decode(struct aws_byte_cursor *to_decode, struct aws_byte_buf *output) {
+    uint64_t working = 0;
+    size_t num_bits = 0;
+    size_t read = 0;
+    size_t len = output->len;
+
+    while (1) {
+        while (num_bits <= 56 && read < to_decode->len) {
+            working |= (uint64_t)to_decode->ptr[read++] << (56 - num_bits);
+            num_bits += 8;
+        }
+        if (num_bits == 0) {
+            break;
+        }
+
+        uint8_t symbol = 0;
+        const size_t code_bits = decode_symbol((uint32_t)(working >> 32), &symbol, NULL);
+        if (code_bits == 0 || code_bits > num_bits) {
+            /* Whatever is left must be padding: fewer than 8 bits, all 1s */
+            if (num_bits < 8 && working == UINT64_MAX << (64 - num_bits)) {
+                break;
+            }
+            return aws_raise_error(AWS_ERROR_COMPRESSION_UNKNOWN_SYMBOL);
+        }
+
+        if (len == output->capacity) {
+            return aws_raise_error(AWS_ERROR_SHORT_BUFFER);
+        }
+        output->buffer[len++] = symbol;
+        working <<= code_bits;
+        num_bits -= code_bits;
+    }
+
+    output->len = len;
+    aws_byte_cursor_advance(to_decode, to_decode->len);
+    return AWS_OP_SUCCESS;
+}
+
+struct aws_huffman_symbol_coder *test_table_get_coder(void) {
+
+    static struct aws_huffman_symbol_coder coder = {
+        .encode = encode_symbol,
+        .decode = decode_symbol,
+        .userdata = NULL,
+        .encode_table = code_points,
+        .code_lengths = code_lengths,
+        .pair_table = &pair_table,
+        .decode_table = &decode_table,
+    };
+    return &coder;
+}